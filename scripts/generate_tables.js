@@ -0,0 +1,150 @@
+/* Generates the precomputed curve tables used by src/hw_crypto.c */
+
+const fs = require('fs');
+
+/* The file that the tables are written to */
+const outputFile = 'src/hw_crypto_tables.h';
+
+/* The number of 4-bit windows in a (reduced) scalar */
+const windowCount = 64;
+
+/* The number of multiples stored per window (signed digits -8 .. 8) */
+const windowMultiples = 8;
+
+const p = (1n << 255n) - 19n;
+
+const d = (-121665n * modInverse(121666n)) % p;
+
+const G = {
+    x: 0x216936D3CD6E53FEC0A4E231FDD6DC5C692CC7609525A7B2C9562D608F25D51An,
+    y: 0x6666666666666666666666666666666666666666666666666666666666666658n
+};
+
+function mod (a) {
+    const r = a % p;
+
+    return r < 0n ? r + p : r;
+}
+
+function modPow (base, exponent) {
+    let result = 1n;
+
+    base = mod(base);
+
+    while (exponent > 0n) {
+        if (exponent & 1n) {
+            result = (result * base) % p;
+        }
+
+        base = (base * base) % p;
+
+        exponent >>= 1n;
+    }
+
+    return result;
+}
+
+function modInverse (a) {
+    return modPow(a, p - 2n);
+}
+
+/* Affine twisted Edwards addition (a = -1) */
+function add (P, Q) {
+    const t = mod(d * P.x * Q.x * P.y * Q.y);
+
+    return {
+        x: mod((P.x * Q.y + P.y * Q.x) * modInverse(1n + t)),
+        y: mod((P.y * Q.y + P.x * Q.x) * modInverse(1n - t))
+    };
+}
+
+function toBytes (value) {
+    const bytes = [];
+
+    for (let i = 31; i >= 0; i--) {
+        bytes.push(Number((value >> BigInt(i * 8)) & 0xFFn));
+    }
+
+    return bytes;
+}
+
+function hex (bytes, indent) {
+    const rows = [];
+
+    /* 16 bytes per row keeps us within the clang-format column limit */
+    for (let i = 0; i < bytes.length; i += 16) {
+        rows.push(bytes.slice(i, i + 16).map((b) => '0x' + b.toString(16).padStart(2, '0')).join(', '));
+    }
+
+    return rows.join(',\n' + indent);
+}
+
+function main () {
+    const lines = [];
+
+    lines.push('/*****************************************************************************');
+    lines.push(' *   (c) 2020 The TurtleCoin Developers');
+    lines.push(' *');
+    lines.push(' *  Licensed under the Apache License, Version 2.0 (the "License");');
+    lines.push(' *  you may not use this file except in compliance with the License.');
+    lines.push(' *  You may obtain a copy of the License at');
+    lines.push(' *');
+    lines.push(' *      http://www.apache.org/licenses/LICENSE-2.0');
+    lines.push(' *');
+    lines.push(' *  Unless required by applicable law or agreed to in writing, software');
+    lines.push(' *  distributed under the License is distributed on an "AS IS" BASIS,');
+    lines.push(' *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.');
+    lines.push(' *  See the License for the specific language governing permissions and');
+    lines.push(' *  limitations under the License.');
+    lines.push(' *****************************************************************************/');
+    lines.push('');
+    lines.push('/**');
+    lines.push(' * THIS FILE IS GENERATED BY scripts/generate_tables.js -- DO NOT EDIT');
+    lines.push(' */');
+    lines.push('');
+    lines.push('#ifndef HW_CRYPTO_TABLES_H');
+    lines.push('#define HW_CRYPTO_TABLES_H');
+    lines.push('');
+    lines.push('#define G_TABLE_WINDOWS ' + windowCount);
+    lines.push('#define G_TABLE_MULTIPLES ' + windowMultiples);
+    lines.push('#define G_TABLE_POINT_SIZE 64');
+    lines.push('');
+    lines.push('/**');
+    lines.push(' * C_ED25519_G_TABLE[i][j] = (j + 1) * 16^i * G stored as X || Y (BE)');
+    lines.push(' */');
+    lines.push('static const unsigned char WIDE C_ED25519_G_TABLE[G_TABLE_WINDOWS][G_TABLE_MULTIPLES][G_TABLE_POINT_SIZE] = {');
+
+    let base = G;
+
+    for (let i = 0; i < windowCount; i++) {
+        const window = [];
+
+        let multiple = base;
+
+        for (let j = 0; j < windowMultiples; j++) {
+            window.push('        {' + hex(toBytes(multiple.x).concat(toBytes(multiple.y)), '         ') + '}');
+
+            multiple = add(multiple, base);
+        }
+
+        lines.push('    {');
+        lines.push(window.join(',\n'));
+        lines.push('    }' + ((i + 1 < windowCount) ? ',' : ''));
+
+        /* 16^(i + 1) * G = 16 * (16^i * G) */
+        for (let k = 0; k < 4; k++) {
+            base = add(base, base);
+        }
+    }
+
+    lines.push('};');
+    lines.push('');
+    lines.push('#endif // HW_CRYPTO_TABLES_H');
+    lines.push('');
+
+    fs.writeFileSync(outputFile, lines.join('\r\n'));
+
+    console.log('Wrote ' + outputFile);
+}
+
+main();
@@ -0,0 +1,172 @@
+/* Aggregates the trace written by a PROFILE=1 build (see src/profile.h) into per-function totals
+ *
+ * Usage: node scripts/profile.js [trace file] [--folded <output file>] [--weight adds|keccak|nvm]
+ *
+ * The trace file defaults to speculos.log (see docker_test.sh); any line that does not hold a
+ * record is skipped so that the whole console output can be handed over as it is. With --folded
+ * the self cost of every call stack is also written in the folded format that flame graph tools
+ * (flamegraph.pl, speedscope, inferno) take as input */
+
+const fs = require('fs');
+
+/* The counters carried by every record, in the order in which they are written */
+const columns = ['adds', 'keccak', 'nvm'];
+
+/* {'>' or '<'}{function} {point additions} {keccak runs} {NVRAM writes} */
+const record = /([<>])(\w+) (\d+) (\d+) (\d+)/;
+
+function parseArguments (argv) {
+    const options = {
+        input: 'speculos.log',
+        folded: undefined,
+        weight: 'adds'
+    };
+
+    for (let i = 0; i < argv.length; i++) {
+        if (argv[i] === '--folded') {
+            options.folded = argv[++i];
+        } else if (argv[i] === '--weight') {
+            options.weight = argv[++i];
+        } else {
+            options.input = argv[i];
+        }
+    }
+
+    if (columns.indexOf(options.weight) === -1) {
+        throw new Error('Unknown weight: ' + options.weight);
+    }
+
+    return options;
+}
+
+function difference (a, b) {
+    return a.map((value, i) => Math.max(0, value - b[i]));
+}
+
+function sum (a, b) {
+    return a.map((value, i) => value + b[i]);
+}
+
+function zero () {
+    return columns.map(() => 0);
+}
+
+function aggregate (lines) {
+    const functions = new Map();
+
+    const stacks = new Map();
+
+    const stack = [];
+
+    let last = zero();
+
+    /* closes the frame on top of the stack as of the given counters */
+    function close (counters) {
+        const frame = stack.pop();
+
+        const inclusive = difference(counters, frame.start);
+
+        const self = difference(inclusive, frame.children);
+
+        if (!functions.has(frame.name)) {
+            functions.set(frame.name, { calls: 0, inclusive: zero(), self: zero() });
+        }
+
+        const totals = functions.get(frame.name);
+
+        totals.calls++;
+
+        /* recursive calls are only counted once towards the inclusive total */
+        if (!stack.some(parent => parent.name === frame.name)) {
+            totals.inclusive = sum(totals.inclusive, inclusive);
+        }
+
+        totals.self = sum(totals.self, self);
+
+        const path = stack.map(parent => parent.name).concat(frame.name).join(';');
+
+        stacks.set(path, sum(stacks.get(path) || zero(), self));
+
+        if (stack.length !== 0) {
+            const parent = stack[stack.length - 1];
+
+            parent.children = sum(parent.children, inclusive);
+        }
+    }
+
+    for (const line of lines) {
+        const match = line.match(record);
+
+        if (!match) {
+            continue;
+        }
+
+        const counters = match.slice(3, 6).map(value => parseInt(value, 10));
+
+        last = counters;
+
+        if (match[1] === '>') {
+            stack.push({ name: match[2], start: counters, children: zero() });
+
+            continue;
+        }
+
+        /* a THROW skips the exit records of the frames it unwinds, they end when their parent does */
+        if (!stack.some(frame => frame.name === match[2])) {
+            continue;
+        }
+
+        while (stack[stack.length - 1].name !== match[2]) {
+            close(counters);
+        }
+
+        close(counters);
+    }
+
+    while (stack.length !== 0) {
+        close(last);
+    }
+
+    return { functions, stacks };
+}
+
+function pad (value, width) {
+    return value.toString().padStart(width);
+}
+
+function main () {
+    const options = parseArguments(process.argv.slice(2));
+
+    const { functions, stacks } = aggregate(fs.readFileSync(options.input, 'utf8').split(/\r?\n/));
+
+    const weight = columns.indexOf(options.weight);
+
+    const rows = Array.from(functions.entries())
+        .sort((a, b) => b[1].inclusive[weight] - a[1].inclusive[weight]);
+
+    const header = ['calls'].concat(
+        columns.map(column => 'incl ' + column),
+        columns.map(column => 'self ' + column));
+
+    const width = Math.max(...rows.map(([name]) => name.length), 'function'.length);
+
+    console.log('function'.padEnd(width) + header.map(title => pad(title, 12)).join(''));
+
+    for (const [name, totals] of rows) {
+        const values = [totals.calls].concat(totals.inclusive, totals.self);
+
+        console.log(name.padEnd(width) + values.map(value => pad(value, 12)).join(''));
+    }
+
+    if (options.folded) {
+        const folded = Array.from(stacks.entries())
+            .filter(([, self]) => self[weight] !== 0)
+            .map(([path, self]) => path + ' ' + self[weight]);
+
+        fs.writeFileSync(options.folded, folded.join('\n') + '\n');
+
+        console.log('\nWrote ' + options.folded);
+    }
+}
+
+main();
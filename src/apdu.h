@@ -18,31 +18,52 @@
 #define APDU_H
 
 #include <apdu_address.h>
+#include <apdu_approve_session.h>
+#include <apdu_capabilities.h>
+#include <apdu_check_inputs.h>
 #include <apdu_check_key.h>
+#include <apdu_check_keys.h>
 #include <apdu_check_ringsignatures.h>
 #include <apdu_check_scalar.h>
 #include <apdu_check_signature.h>
+#include <apdu_check_signatures.h>
+#include <apdu_check_tx_ringsignatures.h>
 #include <apdu_complete_ringsignature.h>
 #include <apdu_debug.h>
 #include <apdu_derive_public_key.h>
 #include <apdu_derive_secret_key.h>
 #include <apdu_generate_key_derivation.h>
+#include <apdu_generate_key_derivations.h>
 #include <apdu_generate_keyimage.h>
+#include <apdu_generate_keyimages.h>
 #include <apdu_generate_keyimage_primitive.h>
 #include <apdu_generate_ringsignatures.h>
 #include <apdu_generate_signature.h>
+#include <apdu_generate_signatures.h>
+#include <apdu_generate_tx_ringsignatures.h>
 #include <apdu_ident.h>
+#include <apdu_nvram_stats.h>
 #include <apdu_private_to_public.h>
 #include <apdu_public_keys.h>
 #include <apdu_random_key_pair.h>
 #include <apdu_reset_keys.h>
+#include <apdu_resources.h>
+#include <apdu_scan_outputs.h>
+#include <apdu_select_account.h>
 #include <apdu_spend_secret_key.h>
+#include <apdu_tx_approve_batch.h>
 #include <apdu_tx_dump.h>
 #include <apdu_tx_finalize_prefix.h>
 #include <apdu_tx_input_load.h>
+#include <apdu_tx_load_prefix.h>
+#include <apdu_tx_preflight.h>
 #include <apdu_tx_output_load.h>
+#include <apdu_tx_reload_outputs.h>
 #include <apdu_tx_reset.h>
+#include <apdu_tx_resume.h>
+#include <apdu_tx_select_slot.h>
 #include <apdu_tx_sign.h>
+#include <apdu_tx_sign_input.h>
 #include <apdu_tx_start.h>
 #include <apdu_tx_start_input_load.h>
 #include <apdu_tx_start_output_load.h>
@@ -51,13 +72,70 @@
 #include <apdu_view_secret_key.h>
 #include <apdu_view_wallet_keys.h>
 
+typedef void (*apdu_handler_t)(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
+
+/**
+ * Says what a command is checked for before its handler is called, so that the handlers only
+ * ever see requests that are valid as far as the state, the length and the confirmation go
+ */
+typedef struct apdu_command_s
+{
+    uint8_t ins; // 1-byte
+
+    uint16_t states; // 2-bytes, the transaction states the command is allowed in (see APDU_IN_STATE)
+
+    uint16_t length; // 2-bytes, the exact length of the data (see APDU_DATA), or APDU_ANY_LENGTH
+
+    uint8_t policy; // 1-byte, APDU_POLICY_NONE or APDU_POLICY_CONFIRM
+
+    apdu_handler_t handler;
+} apdu_command_t;
+
+#define APDU_IN_STATE(state) (1 << (state))
+#define APDU_ANY_STATE 0xFFFF
+#define APDU_ANY_LENGTH 0xFFFF // the handler checks the length by itself
+
+#define APDU_POLICY_NONE 0x00 // nothing to confirm or the handler decides for itself (see pre_approved)
+#define APDU_POLICY_CONFIRM 0x01 // P1 is P1_CONFIRM, or P1_NON_CONFIRM on debug builds only
+
+/**
+ * Commands either have something to show or confirm, or they are silent and are handled as soon
+ * as they arrive without a splash screen (see run_silent). The silent ones are APDU_CHECK_KEY,
+ * APDU_CHECK_SCALAR, APDU_CHECK_RING_SIGNATURES, APDU_CHECK_SIGNATURE, APDU_TX_START_INPUT_LOAD,
+ * APDU_TX_LOAD_INPUT, APDU_TX_START_OUTPUT_LOAD, APDU_TX_LOAD_OUTPUT, APDU_TX_FINALIZE_PREFIX,
+ * APDU_TX_RELOAD_OUTPUTS, APDU_TX_DUMP, APDU_TX_LOAD_PREFIX, the calibration runs of APDU_CAPABILITIES and the
+ * inputs of APDU_GENERATE_TX_RING_SIGNATURES along with those that answer straight away anyway
+ */
+
 /**
  * @returns major || minor || patch {3 bytes}
  */
 #define APDU_VERSION 0x01
 
 /**
+ * P1 = 0x00
  * @returns debug {1 byte}
+ *
+ * P1 = 0x01 (debug builds only)
+ * @returns stack_size {2 bytes} || stack_high_water {2 bytes}
+ *
+ * P1 = 0x02 (debug builds only)
+ * @returns counters {4 bytes * PROFILE_COUNTERS} || commands {5 bytes * n}
+ *     the calls of each primitive in the order of profile_counter_t, then ins {1 byte} || calls {4 bytes}
+ *     of every command that was requested, P2 = APDU_DEBUG_P2_PROFILE_RESET also sets them back to zero
+ *
+ * P1 = 0x03 (debug builds only)
+ * data: seed {32 bytes} or nothing
+ * @returns seeded {1 byte}
+ *     with a seed every random value (nonces, keys, the seal key) is expanded from it until the app
+ *     exits or the RNG is seeded again, so that benchmarks and replays repeat the same arithmetic,
+ *     without one they come from cx_rng again
  */
 #define APDU_DEBUG 0x02
 
@@ -66,6 +144,65 @@
  */
 #define APDU_IDENT 0x05
 
+/**
+ * @returns transaction || boot || lifetime {36 bytes}
+ *     each is writes {4 bytes} || bytes {4 bytes} || pages {4 bytes}, counting the NVRAM writes since
+ *     the last tx_start, since the app started and since it was installed (see nvram_stats_dump)
+ */
+#define APDU_NVRAM_STATS 0x06
+
+/**
+ * Tells the host how much room this build has, so that it can size its requests to it instead of
+ * hard-coding the limits, all of it big endian
+ *
+ * @returns limits || usage || batches
+ *     limits {17 bytes}
+ *         working_set_size {2 bytes}, the working memory of a request
+ *         chain_max_size {2 bytes}, the most data of a (chained) request
+ *         io_buffer_size {2 bytes}
+ *         tx_pool_size {2 bytes}, the NVRAM area of a transaction slot
+ *         tx_ram_size {2 bytes}, how small a transaction has to be to be built in RAM
+ *         tx_max_dump_size {2 bytes}
+ *         tx_slots {1 byte}
+ *         tx_max_inputs {1 byte}
+ *         tx_max_outputs {1 byte}
+ *         tx_max_ring_size {1 byte}
+ *         tx_extra_max_size {1 byte}
+ *     usage {10 bytes}
+ *         tx_state {1 byte}, of the selected slot
+ *         tx_slot {1 byte}
+ *         tx_capacity {2 bytes}, the bytes that the raw transaction of the slot may take
+ *         tx_size {2 bytes}, the bytes that it takes so far
+ *         stack_size {2 bytes}, 0 unless this is a debug build
+ *         stack_high_water {2 bytes}, as above
+ *     batches {1 + (count * 3) bytes}
+ *         count {1 byte}
+ *         entries {count * 3 bytes}, the most items a single (chained) request of a command may carry
+ *             ins {1 byte}
+ *             max_items {2 bytes}
+ */
+#define APDU_RESOURCES 0x07
+
+/**
+ * Tells the host which protocol paths this build has and lets it put a cost on the primitives that
+ * they are made of, so that it can plan what to do on the device and what to offload per device
+ * model. The SDK gives an app no clock that runs while it computes (see profile.h) so the costs are
+ * measured by the host, which times a calibration request with runs against one without
+ *
+ * P1 = APDU_CAPABILITIES_P1_FEATURES
+ * @returns features {4 bytes} || runs {1 byte}
+ *     features, big endian, a bit for every APDU_CAP_* that this build has
+ *     runs, the number of primitives that can be calibrated (APDU_CAP_RUN_*), APDU_CAP_RUN_NVM_PAGE is
+ *         only counted on debug builds
+ *
+ * P1 = APDU_CAPABILITIES_P1_CALIBRATE, P2 = APDU_CAP_RUN_*
+ * @param count {1 byte}, how many times to run the primitive, on keys that are thrown away
+ * @returns nothing
+ *     APDU_CAP_RUN_NVM_PAGE wears a scratch NVRAM page of its own with every run so it is refused with
+ *     ERR_OP_NOT_PERMITTED unless this is a debug build and count is APDU_CAP_NVM_PAGE_MAX_RUNS at most
+ */
+#define APDU_CAPABILITIES 0x08
+
 /**
  * @returns spend_public_key || view_public_key {64 bytes}
  */
@@ -86,6 +223,15 @@
  */
 #define APDU_VIEW_WALLET_KEYS 0x13
 
+/**
+ * Switches every command that follows to the keys of another BIP-32 account, until the
+ * app exits or another account is selected. The first account is selected at start up
+ *
+ * @param account {1 byte}, less than ACCOUNT_SLOTS
+ * @returns nothing
+ */
+#define APDU_SELECT_ACCOUNT 0x14
+
 /**
  * @param public_key {32 bytes}
  * @returns valid {1 byte}
@@ -99,16 +245,32 @@
 #define APDU_CHECK_SCALAR 0x17
 
 /**
- * @param private_key {32 bytes}
- * @returns public_key {32 bytes}
+ * A (chained) request may carry up to APDU_PTP_MAX_KEYS private keys
+ *
+ * @param private_keys {n * 32 bytes}
+ * @returns public_keys {n * 32 bytes}
  */
 #define APDU_PRIVATE_TO_PUBLIC 0x18
 
 /**
- * @returns public_key || private_key {64 bytes}
+ * P2 is the number of key pairs up to APDU_RKP_MAX_COUNT, 0 for one
+ *
+ * @returns (public_key || private_key) * n {n * 64 bytes}
  */
 #define APDU_RANDOM_KEY_PAIR 0x19
 
+/**
+ * Checks many keys at once, as APDU_CHECK_KEY does, or many scalars, as APDU_CHECK_SCALAR does
+ *
+ * @param keys[] {32 bytes * n}
+ * @returns bitmap {(n + 7) / 8 bytes}, bit (i % 8) of byte (i / 8) is set when key i is valid
+ *
+ * P2 = APDU_CHECK_KEYS_P2_KEYS checks the keys as public keys
+ *
+ * P2 = APDU_CHECK_KEYS_P2_SCALARS checks the keys as scalars
+ */
+#define APDU_CHECK_KEYS 0x1a
+
 /**
  * @returns wallet_address {99 bytes}
  */
@@ -134,6 +296,20 @@
  */
 #define APDU_GENERATE_KEYIMAGE_PRIMITIVE 0x41
 
+/**
+ * Generates the key images of many of our outputs at once, the outputs are grouped by
+ * transaction as they are for APDU_SCAN_OUTPUTS
+ *
+ * @param transactions {n * (32 + 1 + (count * 36)) bytes}
+ *     tx_public_key {32 bytes}
+ *     count {1 byte}
+ *     outputs {count * 36 bytes}
+ *         output_index {4 bytes}
+ *         output_key {32 bytes}
+ * @returns key_images[] {32 bytes * outputs}
+ */
+#define APDU_GENERATE_KEYIMAGES 0x42
+
 /**
  * Input payload of 232 bytes
  *
@@ -170,6 +346,25 @@
  */
 #define APDU_CHECK_RING_SIGNATURES 0x52
 
+/**
+ * Signs many message digests at once with the spend key, after a single review
+ *
+ * @param message_digests[] {32 bytes * n}
+ * @returns signatures[] {64 bytes * n}
+ */
+#define APDU_GENERATE_SIGNATURES 0x53
+
+/**
+ * Checks many signatures made with the same public key at once
+ *
+ * @param public_key {32 bytes}
+ * @param entries[] {96 bytes * n}
+ *     message_digest {32 bytes}
+ *     signature {64 bytes}
+ * @returns bitmap {(n + 7) / 8 bytes}, bit (i % 8) of byte (i / 8) is set when signature i is valid
+ */
+#define APDU_CHECK_SIGNATURES 0x54
+
 /**
  * @param message_digest {32 bytes}
  * @returns signature {64 bytes}
@@ -186,6 +381,61 @@
  */
 #define APDU_CHECK_SIGNATURE 0x56
 
+/**
+ * Asks the user to approve the next operations commands that produce signatures or key images
+ * (APDU_GENERATE_KEYIMAGE, APDU_GENERATE_KEYIMAGE_PRIMITIVE, APDU_GENERATE_RING_SIGNATURES,
+ * APDU_COMPLETE_RING_SIGUATURE and APDU_GENERATE_SIGNATURE) made within the given number of
+ * seconds (up to SESSION_MAX_SECONDS) at once, they then run without prompting. The approval
+ * ends early with APDU_TX_RESET, when the app exits or when this command is sent again
+ *
+ * @param operations {1 byte}
+ * @param seconds {2 bytes}
+ * @returns nothing
+ */
+#define APDU_APPROVE_SESSION 0x57
+
+/**
+ * Checks the ring signatures of every input of a transaction, as many rings as fit in each
+ * (chained) request, against the same prefix hash
+ *
+ * @param tx_prefix_hash {32 bytes}, only when P2 = APDU_CHECK_TX_RING_SIGNATURES_P2_FIRST
+ * @param rings[] {416 bytes * n}
+ *     key_image {32 bytes}
+ *     public_keys {32 bytes * 4}
+ *     signatures {64 bytes * 4}
+ * @returns bitmap {(n + 7) / 8 bytes}, bit (i % 8) of byte (i / 8) is set when ring i of the request is valid
+ *
+ * P2 = APDU_CHECK_TX_RING_SIGNATURES_P2_NEXT checks more rings of the transaction that was
+ * started with the last APDU_CHECK_TX_RING_SIGNATURES_P2_FIRST
+ */
+#define APDU_CHECK_TX_RING_SIGNATURES 0x58
+
+/**
+ * Generates the ring signatures of every input of a transaction whose prefix was built by the
+ * host, one input per request, after a single approval of the prefix hash, the number of inputs
+ * and the total that they spend (as the host states it). The approval ends once every input was
+ * signed, with APDU_TX_RESET, APDU_TX_START or APDU_APPROVE_SESSION, when another account is
+ * selected, when the app exits or when the next transaction is started
+ *
+ * P2 = APDU_GENERATE_TX_RING_SIGNATURES_P2_FIRST starts a transaction, P1 must be P1_CONFIRM
+ * (or P1_NON_CONFIRM on debug builds)
+ * @param tx_prefix_hash {32 bytes}
+ * @param inputs {1 byte}
+ * @param total_amount {8 bytes}
+ * @returns nothing
+ *
+ * P2 = APDU_GENERATE_TX_RING_SIGNATURES_P2_NEXT signs the next input, the output being spent is
+ * input_keys[real_output_index]. The input counts against the approval as soon as it is received,
+ * also when it cannot be signed, so an input that failed is not retried: the transaction is
+ * approved again with P2_FIRST instead
+ * @param tx_public_key {32 bytes}
+ * @param output_index {4 bytes}
+ * @param input_keys[] {32 bytes * 4}
+ * @param real_output_index {4 bytes}
+ * @returns signatures[] {64 bytes * 4 = 256 bytes}
+ */
+#define APDU_GENERATE_TX_RING_SIGNATURES 0x59
+
 /**
  * @param tx_public_key
  * @returns key_derivation {32 bytes}
@@ -210,8 +460,49 @@
  */
 #define APDU_DERIVE_SECRET_KEY 0x62
 
+/**
+ * Checks which of the outputs belong to the wallet, the outputs are grouped by transaction so
+ * that the key derivation is only generated once for all of the outputs of a transaction
+ *
+ * @param transactions {n * (32 + 1 + (count * 36)) bytes}
+ *     tx_public_key {32 bytes}
+ *     count {1 byte}
+ *     outputs {count * 36 bytes}
+ *         output_index {4 bytes}
+ *         output_key {32 bytes}
+ * @returns bitmap {8 bytes}, bit (i % 8) of byte (i / 8) is set when output i belongs to the wallet
+ */
+#define APDU_SCAN_OUTPUTS 0x63
+
+/**
+ * Generates the key derivations of many transactions at once, as many as fit in a (chained)
+ * request up to APDU_GKDS_MAX_KEYS
+ *
+ * @param tx_public_keys {n * 32 bytes}
+ * @returns key_derivations {n * 32 bytes}
+ */
+#define APDU_GENERATE_KEY_DERIVATIONS 0x64
+
+/**
+ * Runs the checks of APDU_TX_LOAD_INPUT on many inputs without loading them, nothing is written to
+ * NVRAM and no transaction is touched, so that the host can drop the inputs that would fail before
+ * it starts one. P2 is the ring size of the inputs (0 = the default ring size)
+ *
+ * @param inputs {n * (32 + 1 + 1 + (ring_size * 32)) bytes}
+ *     tx_public_key {32 bytes}
+ *     output_index {1 byte}
+ *     real_output_index {1 byte}
+ *     public_keys {ring_size * 32 bytes}
+ * @returns results {n * 34 bytes}
+ *     status {2 bytes}, 0x0000 if the input passes, otherwise the error that loading it would fail with
+ *     key_image {32 bytes}, zero if the input fails
+ */
+#define APDU_CHECK_INPUTS 0x65
+
 /**
  * @returns state {1 byte}
+ *
+ * P1 = APDU_TX_STATE_P1_PROGRESS returns state || signed_input_count || input_count {3 bytes}
  */
 #define APDU_TX_STATE 0x70
 
@@ -224,6 +515,15 @@
  * @param tx_public_key {32 bytes}
  * @param has_payment_id {1 byte}
  * @param payment_id {32 bytes} (optional)
+ * @param offset_size {1 byte} (optional), the largest varint that a ring offset will take, 1 to 5 bytes
+ *     (5 when left out), the transaction is sized for it up front and an offset that takes more is refused
+ *
+ * P2 carries the ring size of every input (0 = RING_PARTICIPANTS) in its low seven bits,
+ * the APDU_TX_START_P2_SEAL_INPUTS bit has the host hold the pre-signature state of the inputs
+ *
+ * The APDU_TX_START_P1_AUTO_ADVANCE bit of P1 does away with APDU_TX_START_INPUT_LOAD,
+ * APDU_TX_START_OUTPUT_LOAD and APDU_TX_FINALIZE_PREFIX: the first input and the first output
+ * start their load and the prefix is finalized as soon as the last output is loaded
  */
 #define APDU_TX_START 0x71
 
@@ -233,14 +533,36 @@
 #define APDU_TX_START_INPUT_LOAD 0x72
 
 /**
- * Input payload of 185 bytes
+ * Input payload of 42 + (36 * ring_size) bytes (186 bytes for the default ring size of 4)
  *
  * @param input_tx_public_key {32 bytes}
  * @param input_output_index {1 byte}
  * @param amount {8 bytes}
- * @param public_keys {32 bytes * 4} (ring participant public keys)
- * @param offsets {4 bytes * 4} (relative global index offsets)
+ * @param public_keys {32 bytes * ring_size} (ring participant public keys)
+ * @param offsets {4 bytes * ring_size} (relative global index offsets)
  * @param real_output_index {1 byte}
+ *
+ * Several inputs may follow one after the other in the same payload, as many as fit in the
+ * working set (two of the default ring size), sealed inputs only go one at a time when the
+ * sealed input is larger than the input
+ *
+ * P2 = APDU_TX_INPUT_LOAD_P2_COMPACT takes the inputs in the compact format instead
+ * @param flags {1 byte} (APDU_TX_INPUT_LOAD_SAME_TX_KEY leaves out the tx_public_key of the input in
+ *     front of it in the same payload, so the first input of a payload always carries it)
+ * @param input_tx_public_key {32 bytes} (optional)
+ * @param input_output_index {1 byte}
+ * @param amount {varint}
+ * @param public_keys {32 bytes * ring_size} (ring participant public keys)
+ * @param offsets {varint * ring_size} (relative global index offsets, the shortest encoding that
+ *     the prefix will carry, each held to the offset_size of APDU_TX_START)
+ * @param real_output_index {1 byte}
+ *
+ * An input of the default ring size with one byte offsets and an amount under 2^21 takes 170 bytes
+ * instead of 186, or 138 bytes when it shares the key of the input in front of it, so that three
+ * rather than two fit in the working set. Sealed inputs are returned in place so the inputs of the
+ * payload up to every one of them must take no less room than their sealed inputs
+ *
+ * @returns sealed_input {129 bytes} for every input if the inputs are sealed (see APDU_TX_START), otherwise nothing
  */
 #define APDU_TX_LOAD_INPUT 0x73
 
@@ -250,6 +572,8 @@
 #define APDU_TX_START_OUTPUT_LOAD 0x74
 
 /**
+ * Output payload of 40 bytes for up to APDU_TX_LOAD_OUTPUT_MAX_COUNT outputs one after the other
+ *
  * @param amount {8 bytes}
  * @param key {32 bytes}
  */
@@ -262,12 +586,27 @@
 
 /**
  * @returns tx_hash || tx_size {34 bytes}
+ *
+ * P2 = APDU_TX_SIGN_P2_BY_INPUT only moves the transaction into the signing state
+ * (nothing is returned) so that the inputs are then signed via APDU_TX_SIGN_INPUT
+ *
+ * P2 = APDU_TX_SIGN_P2_STREAM does the same but the signatures of every input are returned
+ * by APDU_TX_SIGN_INPUT instead of being stored for APDU_TX_DUMP
+ *
+ * P2 = APDU_TX_SIGN_P2_ALL with confirmation starts signing the inputs while the user reviews
+ * the transaction, every request is refused with ERR_TRANSACTION_STATE until it is approved or rejected
  */
 #define APDU_TX_SIGN 0x77
 
 /**
  * @param start_offset {2 bytes}
- * @returns raw_transaction {0 - 500 bytes}
+ * @returns raw_transaction {0 - TX_MAX_DUMP_SIZE bytes}
+ *
+ * P1 = APDU_TX_DUMP_P1_SIGNATURES takes the start offset from the start of the signatures
+ * so that the prefix the host already has does not need to be read back
+ *
+ * P1 = APDU_TX_DUMP_P1_PREFIX_HASH (2 byte payload optional) instead returns
+ * prefix_hash || prefix_size {34 bytes}
  */
 #define APDU_TX_DUMP 0x78
 
@@ -276,6 +615,123 @@
  */
 #define APDU_TX_RESET 0x79
 
+/**
+ * Signs the next input of the transaction from mixins prepared by the host,
+ * input payload of 128 * (ring_size - 1) bytes (rings of up to 4 members, 12 on the Nano X)
+ * OR without a payload signs the next P1 inputs on the device (0 = the rest)
+ *
+ * @param mixins {128 bytes * (ring_size - 1)} (c || r || L || R of every mixin in ring order)
+ * @returns tx_hash || tx_size {34 bytes} once the last input is signed, otherwise nothing
+ *
+ * When the signatures are streamed (see APDU_TX_SIGN) there is no payload and a single input is signed
+ * @returns signatures {64 bytes * ring_size} [ || tx_hash || tx_size {34 bytes} after the last input ]
+ *
+ * When the inputs are sealed (see APDU_TX_START) the payload is the sealed input returned by
+ * APDU_TX_LOAD_INPUT for the next input, which is then signed on the device as above
+ * @param sealed_input {129 bytes}
+ *
+ * Builds without NONCE_DRBG do not precompute the ring signature terms so the ring of the next input
+ * has to be resent to sign it on the device, it follows the payload above or is sent on its own
+ * @param public_keys {32 bytes * ring_size} (checked against the ring the input was loaded with)
+ */
+#define APDU_TX_SIGN_INPUT 0x7a
+
+/**
+ * Resumes the transaction session that was checkpointed to NVRAM before the device was
+ * reset or the app was restarted (the state must be TX_UNUSED), a transaction that was
+ * being signed resumes ready to be signed again. A transaction whose signatures were being
+ * streamed (see APDU_TX_SIGN) is refused with ERR_TX_RESUME and dropped, as the
+ * signatures that were already returned are not kept on the device
+ *
+ * @returns state || received_input_count || received_output_count {3 bytes}
+ */
+#define APDU_TX_RESUME 0x7b
+
+/**
+ * Switches the transaction commands over to the transaction slot P1 (TX_SLOTS of them), the
+ * transaction of the slot that was in use is parked as it is and whatever the slot switched to
+ * was left with is picked up again (see APDU_TX_RESUME) so that one transaction can be prepared
+ * while another is being signed or dumped. The slot stays selected until it is switched again
+ *
+ * @returns slot || state || received_input_count || received_output_count {4 bytes}
+ */
+#define APDU_TX_SELECT_SLOT 0x7c
+
+/**
+ * Loads a chunk of the serialized transaction prefix in place of APDU_TX_START_INPUT_LOAD,
+ * APDU_TX_LOAD_INPUT, APDU_TX_START_OUTPUT_LOAD and APDU_TX_LOAD_OUTPUT, the stream carries on
+ * from what APDU_TX_START wrote and a chunk holds whole elements only: the inputs, the number of
+ * outputs and the outputs. Each input is preceded by a witness that is not part of the prefix
+ * so that its key image is checked against its own derivation, sealed inputs go one per chunk
+ *
+ * @param witness {34 bytes + 32 bytes * ring_size} (tx_public_key || output_index || real_output_index || public_keys)
+ * @param input {0x02 || varint amount || varint ring_size || varint offsets || key_image}
+ * @param output_count {varint}
+ * @param output {varint amount || 0x02 || key}
+ *
+ * @returns received_input_count || received_output_count {2 bytes} [ || sealed_input {129 bytes} ]
+ */
+#define APDU_TX_LOAD_PREFIX 0x7d
+
+/**
+ * Asks the user to approve the signing of a number of transactions at once, up to a total amount
+ * to spend (the sum of their inputs, as APDU_TX_SIGN shows it) and a total network fee. Each
+ * APDU_TX_SIGN that the approval still covers then signs without prompting and uses up its share,
+ * and the next APDU_TX_START may follow APDU_TX_DUMP without an APDU_TX_RESET in between, which
+ * keeps the derivations and ring members cached by the last transaction. The approval ends once
+ * used up, with APDU_TX_RESET, when another account is selected, when the app exits or when this
+ * command is sent again, a count of zero only ends it
+ *
+ * @param transactions {1 byte}
+ * @param total_amount {8 bytes}
+ * @param total_fee {8 bytes}
+ * @returns nothing
+ */
+#define APDU_TX_APPROVE_BATCH 0x7e
+
+/**
+ * Works out up front, without starting anything, whether a transaction of the given shape fits
+ * as APDU_TX_START would size it, so that the host splits one that is too large before the device
+ * does any work on it. P2 is the same as for APDU_TX_START
+ *
+ * @param input_count {1 byte}
+ * @param output_count {1 byte}
+ * @param offset_size {1 byte}, the largest varint that a ring offset will take (0 = 5 bytes)
+ * @returns fits || in_ram || max_inputs || size || available {11 bytes}
+ *     fits {1 byte}
+ *     in_ram {1 byte}, whether it would be built in RAM instead of NVRAM
+ *     max_inputs {1 byte}, the most inputs of the same shape that fit along with the same outputs
+ *     size {4 bytes}, the most that it could take of the pool
+ *     available {4 bytes}, the size of the pool
+ */
+#define APDU_TX_PREFLIGHT 0x7f
+
+/**
+ * Rolls the transaction back to where it stood once its inputs were loaded (TX_INPUTS_RECEIVED) so
+ * that only its outputs are loaded again, to bump the fee or to pay someone else, without loading
+ * and checking the inputs again. Allowed from TX_INPUTS_RECEIVED up to TX_PREFIX_READY, the output
+ * count stays what APDU_TX_START was given. It is refused with ERR_TRANSACTION_STATE once signing
+ * has started, also after APDU_TX_RESUME, as the inputs would be signed again with the same nonces
+ *
+ * @returns
+ */
+#define APDU_TX_RELOAD_OUTPUTS 0x80
+
+/**
+ * A request with more data than fits in one APDU is split into fragments that all carry the same
+ * INS, every fragment but the last has P1_MORE set in P1 and is answered with 0x9000 alone. The
+ * last fragment has the same P1 as the unchained command would, the payload is put back together
+ * before the command sees it. Any other command in between is refused with ERR_APDU_CHAIN along
+ * with the fragments received so far.
+ *
+ * A response to a chained request that is longer than CHAIN_CHUNK_SIZE comes back in chunks,
+ * 0x61XX after a chunk means that XX more bytes (or 256 or more when XX is 0x00) are waiting to
+ * be fetched with this command and the last chunk carries the status of the command itself
+ *
+ * @returns the next chunk of the pending response {up to CHAIN_CHUNK_SIZE bytes}
+ */
+#define APDU_GET_RESPONSE 0xc0
+
 /**
  * @returns nothing
  */
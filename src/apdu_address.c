@@ -57,21 +57,18 @@ UX_FLOW(
     &ux_display_address_3_step,
     &ux_display_address_4_step);
 
-void handle_address(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx)
+void handle_address(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-
-    const uint16_t status = generate_public_address(PTR_SPEND_PUBLIC, PTR_VIEW_PUBLIC, APDU_ADDRESS);
-
-    if (status != OP_OK)
-    {
-        return sendError(status);
-    }
+    // the address was encoded when the keys were initialized (see init_keys)
+    os_memmove(APDU_ADDRESS, (void *)N_turtlecoin_wallet->address, BASE58_ADDRESS_SIZE);
 
     /**
      * If the APDU was sent requesting confirmation then
@@ -85,14 +82,10 @@ void handle_address(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volati
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
+    else
     {
         do_address();
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
 }
@@ -21,6 +21,12 @@
 
 #define APDU_ADDRESS_NAME ((unsigned char *)"ADDRESS")
 
-void handle_address(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx);
+void handle_address(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_ADDRESS_H
@@ -0,0 +1,86 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_approve_session.h"
+
+#include <apdu_generate_tx_ringsignatures.h>
+#include <session.h>
+#include <utils.h>
+
+#define APDU_AS_OPERATIONS readUint8(APDU_DATA)
+#define APDU_AS_SECONDS readUint16BE(APDU_DATA + sizeof(uint8_t))
+
+// "255 in 900 seconds"
+static char L_session_text[24];
+
+static void do_approve_session()
+{
+    session_start(APDU_AS_OPERATIONS, APDU_AS_SECONDS);
+
+    sendResponse(0, true);
+}
+
+UX_STEP_NOCB(ux_approve_session_1_step, pnn, {&C_icon_turtlecoin, "Approve", "Session?"});
+
+UX_STEP_NOCB(ux_approve_session_2_step, bnnn_paging, {.title = "Signatures", .text = L_session_text});
+
+UX_STEP_VALID(ux_approve_session_3_step, pb, do_approve_session(), {&C_icon_validate_14, "Approve"});
+
+UX_STEP_VALID(ux_approve_session_4_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
+
+UX_FLOW(
+    ux_approve_session_flow,
+    &ux_approve_session_1_step,
+    &ux_approve_session_2_step,
+    &ux_approve_session_3_step,
+    &ux_approve_session_4_step);
+
+void handle_approve_session(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    if (APDU_AS_OPERATIONS == 0 || APDU_AS_SECONDS == 0 || APDU_AS_SECONDS > SESSION_MAX_SECONDS)
+    {
+        return sendError(ERR_OUT_OF_RANGE);
+    }
+
+    // a new request always replaces the session that is running, even if it is turned down
+    session_end();
+
+    // along with the approval of a transaction that the host built
+    generate_tx_ring_signatures_end();
+
+    if (p1 == P1_CONFIRM)
+    {
+        SPRINTF(L_session_text, "%d in %d seconds", APDU_AS_OPERATIONS, APDU_AS_SECONDS);
+
+        ux_flow_init(0, ux_approve_session_flow, NULL);
+
+        *flags |= IO_ASYNCH_REPLY;
+    }
+    else
+    {
+        do_approve_session();
+
+        *flags |= IO_ASYNCH_REPLY;
+    }
+}
@@ -0,0 +1,176 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_capabilities.h"
+
+#include <keys.h>
+#include <nvram.h>
+#include <transaction.h>
+#include <utils.h>
+
+// every calibration run of APDU_CAP_RUN_NVM_PAGE lands here so that nothing else is worn by it
+#ifdef TARGET_NANOX
+const unsigned char N_state_calibration_pic[NVRAM_PAGE_SIZE] NVRAM_ALIGNED;
+#else
+unsigned char N_state_calibration_pic[NVRAM_PAGE_SIZE] NVRAM_ALIGNED;
+#endif
+
+#define APDU_CAP_CALIBRATION_PAGE ((void *)PIC(N_state_calibration_pic))
+
+// a throwaway key pair and what is computed from it, the keys of the wallet are never touched
+#define APDU_CAP_PUBLIC WORKING_SET
+#define APDU_CAP_PRIVATE APDU_CAP_PUBLIC + KEY_SIZE
+#define APDU_CAP_OUT APDU_CAP_PRIVATE + KEY_SIZE
+
+// what is run and how many times, checked by the handler
+static uint8_t L_calibration_run = APDU_CAP_RUN_SCALARMULT_BASE;
+
+static uint8_t L_calibration_count = 0;
+
+static uint32_t capabilities_features()
+{
+    uint32_t features = APDU_CAP_CHAINING | APDU_CAP_BATCHES | APDU_CAP_COMPACT_INPUTS | APDU_CAP_SIGN_BY_INPUT
+                        | APDU_CAP_SIGN_STREAM | APDU_CAP_SEAL_INPUTS | APDU_CAP_LOAD_PREFIX
+                        | APDU_CAP_TX_RING_SIGNATURES | APDU_CAP_TX_RESUME | APDU_CAP_TX_PREFLIGHT
+                        | APDU_CAP_TX_APPROVE_BATCH | APDU_CAP_TX_RELOAD_OUTPUTS | APDU_CAP_CHECK_INPUTS
+                        | APDU_CAP_SESSION;
+
+    features |= (TX_SLOTS > 1) ? APDU_CAP_TX_SLOTS : 0;
+
+    features |= (TX_RAM_SIZE != 0) ? APDU_CAP_TX_RAM : 0;
+
+    features |= (NONCE_DRBG == 1) ? APDU_CAP_NONCE_DRBG : 0;
+
+    features |= (KECCAK_IN_APP == 1) ? APDU_CAP_KECCAK_IN_APP : 0;
+
+    features |= (ED25519_IN_APP == 1) ? APDU_CAP_ED25519_IN_APP : 0;
+
+    features |= (BUSY_SCREEN == 1) ? APDU_CAP_BUSY_SCREEN : 0;
+
+    features |= (DEBUG_BUILD == 1) ? APDU_CAP_DEBUG : 0;
+
+    return features;
+}
+
+/**
+ * Runs one primitive as many times as asked on keys of its own, so that the host can time a
+ * request with runs against one without and put a cost on the primitive for this very device
+ */
+static void do_calibrate()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            unsigned char page[NVRAM_PAGE_SIZE] = {0};
+
+            hw_generate_keypair(APDU_CAP_PUBLIC, APDU_CAP_PRIVATE);
+
+            for (uint8_t i = 0; i < L_calibration_count; i++)
+            {
+                uint16_t status = OP_OK;
+
+                switch (L_calibration_run)
+                {
+                    case APDU_CAP_RUN_SCALARMULT_BASE:
+                        status = hw_private_key_to_public_key(APDU_CAP_OUT, APDU_CAP_PRIVATE);
+                        break;
+                    case APDU_CAP_RUN_KEY_IMAGE:
+                        status = hw__generate_key_image(APDU_CAP_OUT, APDU_CAP_PUBLIC, APDU_CAP_PRIVATE);
+                        break;
+                    case APDU_CAP_RUN_DERIVE_PUBLIC_KEY:
+                        status = hw_derive_public_key(APDU_CAP_OUT, APDU_CAP_PUBLIC, i, PTR_SPEND_POINT);
+                        break;
+                    case APDU_CAP_RUN_KECCAK:
+                        status = hw_keccak(APDU_CAP_PUBLIC, KEY_SIZE, APDU_CAP_OUT);
+                        break;
+                    case APDU_CAP_RUN_RANDOM:
+                        status = hw_random_bytes(APDU_CAP_OUT, KEY_SIZE);
+                        break;
+                    default:
+                        page[0] = i;
+
+                        nvram_write(APDU_CAP_CALIBRATION_PAGE, page, sizeof(page));
+                        break;
+                }
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+            }
+
+            CLOSE_TRY;
+
+            sendResponse(0, true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY
+        {
+            // Explicitly clear the working memory
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+        };
+    }
+    END_TRY;
+}
+
+void handle_capabilities(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    if (p1 == APDU_CAPABILITIES_P1_CALIBRATE)
+    {
+        if (p2 >= APDU_CAP_RUNS)
+        {
+            return sendError(ERR_OUT_OF_RANGE);
+        }
+        else if (dataLength != 1)
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
+        else if (p2 == APDU_CAP_RUN_NVM_PAGE && (DEBUG_BUILD != 1 || dataBuffer[0] > APDU_CAP_NVM_PAGE_MAX_RUNS))
+        {
+            // nothing confirms a calibration so flash wear is left to debug builds, a few pages at a time
+            return sendError(ERR_OP_NOT_PERMITTED);
+        }
+
+        L_calibration_run = p2;
+
+        L_calibration_count = dataBuffer[0];
+
+        return run_silent(do_calibrate);
+    }
+
+    unsigned char capabilities[APDU_CAPABILITIES_SIZE];
+
+    uint32ToChar(capabilities, capabilities_features());
+
+    // the NVRAM page is the last of the runs and only debug builds calibrate it
+    capabilities[4] = (DEBUG_BUILD == 1) ? APDU_CAP_RUNS : APDU_CAP_RUN_NVM_PAGE;
+
+    /**
+     * What this build can do says nothing about the keys or the transaction
+     * and as thus can be returned without any additional checking
+     */
+    sendResponse(write_io_hybrid(capabilities, sizeof(capabilities), APDU_CAPABILITIES_NAME, true), true);
+}
\ No newline at end of file
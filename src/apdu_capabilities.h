@@ -0,0 +1,71 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef APDU_CAPABILITIES_H
+#define APDU_CAPABILITIES_H
+
+#include <stdint.h>
+
+#define APDU_CAPABILITIES_NAME ((unsigned char *)"CAPABILITIES")
+
+#define APDU_CAPABILITIES_P1_FEATURES 0x00
+#define APDU_CAPABILITIES_P1_CALIBRATE 0x01
+
+// the protocol paths and build options, one bit each
+#define APDU_CAP_CHAINING 0x00000001 // chained requests and APDU_GET_RESPONSE
+#define APDU_CAP_BATCHES 0x00000002 // the batched commands that APDU_RESOURCES lists
+#define APDU_CAP_COMPACT_INPUTS 0x00000004 // APDU_TX_INPUT_LOAD_P2_COMPACT
+#define APDU_CAP_SIGN_BY_INPUT 0x00000008 // APDU_TX_SIGN_P2_BY_INPUT and APDU_TX_SIGN_INPUT
+#define APDU_CAP_SIGN_STREAM 0x00000010 // APDU_TX_SIGN_P2_STREAM
+#define APDU_CAP_SEAL_INPUTS 0x00000020 // APDU_TX_START_P2_SEAL_INPUTS
+#define APDU_CAP_LOAD_PREFIX 0x00000040 // APDU_TX_LOAD_PREFIX
+#define APDU_CAP_TX_RING_SIGNATURES 0x00000080 // APDU_GENERATE_TX_RING_SIGNATURES, the host builds the prefix
+#define APDU_CAP_TX_RESUME 0x00000100 // APDU_TX_RESUME
+#define APDU_CAP_TX_SLOTS 0x00000200 // APDU_TX_SELECT_SLOT with more than one slot
+#define APDU_CAP_TX_RAM 0x00000400 // small transactions are built in RAM (see APDU_RESOURCES)
+#define APDU_CAP_TX_PREFLIGHT 0x00000800 // APDU_TX_PREFLIGHT
+#define APDU_CAP_TX_APPROVE_BATCH 0x00001000 // APDU_TX_APPROVE_BATCH
+#define APDU_CAP_TX_RELOAD_OUTPUTS 0x00002000 // APDU_TX_RELOAD_OUTPUTS
+#define APDU_CAP_CHECK_INPUTS 0x00004000 // APDU_CHECK_INPUTS
+#define APDU_CAP_SESSION 0x00008000 // APDU_APPROVE_SESSION
+#define APDU_CAP_NONCE_DRBG 0x00010000 // NONCE_DRBG=1
+#define APDU_CAP_KECCAK_IN_APP 0x00020000 // KECCAK_IN_APP=1
+#define APDU_CAP_ED25519_IN_APP 0x00040000 // ED25519_IN_APP=1
+#define APDU_CAP_BUSY_SCREEN 0x00080000 // BUSY_SCREEN=1
+#define APDU_CAP_DEBUG 0x00100000 // DEBUG_BUILD=1
+
+// what APDU_CAPABILITIES_P1_CALIBRATE runs, by P2
+#define APDU_CAP_RUN_SCALARMULT_BASE 0x00 // private key to public key
+#define APDU_CAP_RUN_KEY_IMAGE 0x01 // hash to point and a scalar mult, as for every key image
+#define APDU_CAP_RUN_DERIVE_PUBLIC_KEY 0x02 // hash to scalar, scalar mult of the base and a point add
+#define APDU_CAP_RUN_KECCAK 0x03 // cn_fast_hash of a key
+#define APDU_CAP_RUN_RANDOM 0x04 // a key worth of random bytes
+#define APDU_CAP_RUN_NVM_PAGE 0x05 // an NVRAM page written, to a scratch page of its own, debug builds only
+#define APDU_CAP_RUNS 6
+
+#define APDU_CAP_NVM_PAGE_MAX_RUNS 16 // the most NVRAM pages that a single calibration request may write
+
+#define APDU_CAPABILITIES_SIZE 5 // features {4 bytes} || runs {1 byte}
+
+void handle_capabilities(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
+
+#endif // APDU_CAPABILITIES_H
@@ -0,0 +1,104 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_check_inputs.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <review.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_CI_OUTPUT_KEY APDU_DATA + APDU_CI_INPUT_HEADER_SIZE
+#define APDU_CI_RESULTS WORKING_SET
+
+static unsigned int pre_approved = 0;
+
+// the shape of the request, checked by the handler before it is reviewed
+static uint8_t L_ring_size = 0;
+
+static uint16_t L_input_count = 0;
+
+static uint16_t check_inputs()
+{
+    const unsigned char *data = APDU_DATA;
+
+    unsigned char *result = APDU_CI_RESULTS;
+
+    // an input that fails is reported in its own result rather than failing the request
+    for (uint16_t i = 0; i < L_input_count; i++, result += APDU_CI_RESULT_SIZE)
+    {
+        const uint16_t status = tx_check_input(
+            result + sizeof(uint16_t),
+            data,
+            readUint8((uint8_t *)data + KEY_SIZE),
+            data + APDU_CI_INPUT_HEADER_SIZE,
+            L_ring_size,
+            readUint8((uint8_t *)data + KEY_SIZE + sizeof(uint8_t)));
+
+        uint16ToChar(result, status);
+
+        data += APDU_CI_INPUT_HEADER_SIZE + (L_ring_size * KEY_SIZE);
+    }
+
+    review_output_size(result - APDU_CI_RESULTS);
+
+    return OP_OK;
+}
+
+static const review_t C_check_inputs_review = {
+    {"Check", "Inputs?"},
+    "Output Key",
+    {"Checking", "Inputs..."},
+    check_inputs,
+    APDU_CI_RESULTS,
+    0,
+    APDU_CHECK_INPUTS_NAME,
+    &pre_approved,
+    false};
+
+void handle_check_inputs(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    // a ring size of zero in P2 keeps the default ring size, as for APDU_TX_START
+    L_ring_size = (p2 == 0) ? RING_PARTICIPANTS : p2;
+
+    const uint16_t input_size = APDU_CI_INPUT_HEADER_SIZE + (L_ring_size * KEY_SIZE);
+
+    L_input_count = dataLength / input_size;
+
+    if (L_input_count == 0 || L_input_count > APDU_CI_MAX_INPUTS || dataLength % input_size != 0)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    arena_alloc(L_input_count * APDU_CI_RESULT_SIZE);
+
+    // the output key that is reviewed is the one that the first input spends, if it is in its ring
+    uint8_t real_output_index = readUint8(dataBuffer + KEY_SIZE + sizeof(uint8_t));
+
+    if (real_output_index >= L_ring_size)
+    {
+        real_output_index = 0;
+    }
+
+    review_start(&C_check_inputs_review, APDU_CI_OUTPUT_KEY + (real_output_index * KEY_SIZE), p1, flags);
+}
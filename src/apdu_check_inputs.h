@@ -0,0 +1,38 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef APDU_CHECK_INPUTS_H
+#define APDU_CHECK_INPUTS_H
+
+#include <stdint.h>
+
+#define APDU_CHECK_INPUTS_NAME ((unsigned char *)"CHECKINPUTS")
+
+// tx_public_key || output_index || real_output_index, followed by the ring
+#define APDU_CI_INPUT_HEADER_SIZE KEY_SIZE + sizeof(uint8_t) + sizeof(uint8_t)
+#define APDU_CI_RESULT_SIZE sizeof(uint16_t) + KEY_SIZE // status || key_image
+
+#define APDU_CI_MAX_INPUTS WORKING_SET_SIZE / (APDU_CI_RESULT_SIZE)
+
+void handle_check_inputs(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
+
+#endif // APDU_CHECK_INPUTS_H
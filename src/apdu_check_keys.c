@@ -0,0 +1,92 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_check_keys.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_CKS_KEYS APDU_DATA
+
+// what the request holds, and how many of them, checked by the handler
+static uint8_t L_check_mode = APDU_CHECK_KEYS_P2_KEYS;
+
+static uint16_t L_check_count = 0;
+
+static void do_check_keys()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const uint16_t size = (L_check_count + 7) / 8;
+
+            // the bitmap starts out clear as the working set is wiped before every request
+            unsigned char *bitmap = arena_alloc(size);
+
+            for (uint16_t i = 0; i < L_check_count; i++)
+            {
+                const unsigned char *key = APDU_CKS_KEYS + (i * KEY_SIZE);
+
+                const uint16_t status =
+                    (L_check_mode == APDU_CHECK_KEYS_P2_SCALARS) ? hw_check_scalar(key) : hw_check_key(key);
+
+                if (status == OP_OK)
+                {
+                    bitmap[i / 8] |= (1 << (i % 8));
+                }
+            }
+
+            sendResponse(write_io_hybrid(bitmap, size, APDU_CHECK_KEYS_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError((L_check_mode == APDU_CHECK_KEYS_P2_SCALARS) ? ERR_CHECK_SCALAR : ERR_CHECK_KEY);
+        }
+        FINALLY
+        {
+            // Explicitly clear the working memory
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+        };
+    }
+    END_TRY;
+}
+
+void handle_check_keys(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    if (p2 != APDU_CHECK_KEYS_P2_KEYS && p2 != APDU_CHECK_KEYS_P2_SCALARS)
+    {
+        return sendError(ERR_OUT_OF_RANGE);
+    }
+    else if (dataLength == 0 || dataLength % KEY_SIZE != 0)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_check_mode = p2;
+
+    L_check_count = dataLength / KEY_SIZE;
+
+    run_silent(do_check_keys);
+}
\ No newline at end of file
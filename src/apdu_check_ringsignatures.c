@@ -20,8 +20,7 @@
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_CHRS_SIZE KEY_SIZE + KEY_SIZE + (KEY_SIZE * RING_PARTICIPANTS) + (SIG_SIZE * RING_PARTICIPANTS)
-#define APDU_CHRS_TX_PREFIX_HASH WORKING_SET
+#define APDU_CHRS_TX_PREFIX_HASH APDU_DATA
 #define APDU_CHRS_KEY_IMAGE APDU_CHRS_TX_PREFIX_HASH + KEY_SIZE
 #define APDU_CHRS_PUBLIC_KEYS APDU_CHRS_KEY_IMAGE + KEY_SIZE
 #define APDU_CHRS_SIGNATURES APDU_CHRS_PUBLIC_KEYS + (KEY_SIZE * RING_PARTICIPANTS)
@@ -50,14 +49,6 @@ static void do_check_ring_signatures()
     END_TRY;
 }
 
-UX_STEP_SPLASH(
-    ux_check_ring_signatures_1_step,
-    pnn,
-    do_check_ring_signatures(),
-    {&C_icon_turtlecoin, "Checking", "Ring Signatures"});
-
-UX_FLOW(ux_check_ring_signatures_flow, &ux_check_ring_signatures_1_step);
-
 void handle_check_ring_signatures(
     uint8_t p1,
     uint8_t p2,
@@ -68,19 +59,5 @@ void handle_check_ring_signatures(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-    else if (dataLength != APDU_CHRS_SIZE)
-    {
-        return sendError(ERR_WRONG_INPUT_LENGTH);
-    }
-
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
-
-    ux_flow_init(0, ux_check_ring_signatures_flow, NULL);
-
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_check_ring_signatures);
 }
\ No newline at end of file
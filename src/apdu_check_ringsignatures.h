@@ -21,6 +21,8 @@
 
 #define APDU_CHECK_RING_SIGNATURES_NAME ((unsigned char *)"CHKRINGSIGS")
 
+#define APDU_CHRS_SIZE KEY_SIZE + KEY_SIZE + (KEY_SIZE * RING_PARTICIPANTS) + (SIG_SIZE * RING_PARTICIPANTS)
+
 void handle_check_ring_signatures(
     uint8_t p1,
     uint8_t p2,
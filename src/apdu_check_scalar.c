@@ -20,7 +20,7 @@
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_CS_SCALAR WORKING_SET
+#define APDU_CS_SCALAR APDU_DATA
 
 static void do_check_scalar()
 {
@@ -45,10 +45,6 @@ static void do_check_scalar()
     END_TRY;
 }
 
-UX_STEP_SPLASH(ux_check_scalar_1_step, pnn, do_check_scalar(), {&C_icon_turtlecoin, "Checking", "Scalar"});
-
-UX_FLOW(ux_check_scalar_flow, &ux_check_scalar_1_step);
-
 void handle_check_scalar(
     uint8_t p1,
     uint8_t p2,
@@ -59,19 +55,5 @@ void handle_check_scalar(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-    else if (dataLength != KEY_SIZE)
-    {
-        return sendError(ERR_WRONG_INPUT_LENGTH);
-    }
-
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
-
-    ux_flow_init(0, ux_check_scalar_flow, NULL);
-
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_check_scalar);
 }
\ No newline at end of file
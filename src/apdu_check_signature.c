@@ -20,8 +20,7 @@
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_CS_SIZE KEY_SIZE + KEY_SIZE + SIG_SIZE
-#define APDU_CS_MESSAGE_DIGEST WORKING_SET
+#define APDU_CS_MESSAGE_DIGEST APDU_DATA
 #define APDU_CS_PUBLIC_KEY APDU_CS_MESSAGE_DIGEST + KEY_SIZE
 #define APDU_CS_SIGNATURE APDU_CS_PUBLIC_KEY + KEY_SIZE
 
@@ -48,10 +47,6 @@ static void do_check_signature()
     END_TRY;
 }
 
-UX_STEP_SPLASH(ux_check_signature_1_step, pnn, do_check_signature(), {&C_icon_turtlecoin, "Checking", "Signature"});
-
-UX_FLOW(ux_check_signature_flow, &ux_check_signature_1_step);
-
 void handle_check_signature(
     uint8_t p1,
     uint8_t p2,
@@ -62,19 +57,5 @@ void handle_check_signature(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-    else if (dataLength != APDU_CS_SIZE)
-    {
-        return sendError(ERR_WRONG_INPUT_LENGTH);
-    }
-
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
-
-    ux_flow_init(0, ux_check_signature_flow, NULL);
-
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_check_signature);
 }
\ No newline at end of file
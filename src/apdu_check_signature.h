@@ -21,6 +21,8 @@
 
 #define APDU_CHECK_SIGNATURE_NAME ((unsigned char *)"CHECKSIG")
 
+#define APDU_CS_SIZE KEY_SIZE + KEY_SIZE + SIG_SIZE
+
 void handle_check_signature(
     uint8_t p1,
     uint8_t p2,
@@ -0,0 +1,76 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_check_signatures.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_CSS_PUBLIC_KEY APDU_DATA
+#define APDU_CSS_ENTRIES APDU_CSS_PUBLIC_KEY + KEY_SIZE
+
+// the number of signatures in the request, checked by the handler
+static uint16_t L_signatures_count = 0;
+
+static void do_check_signatures()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const uint16_t size = (L_signatures_count + 7) / 8;
+
+            // the bitmap starts out clear as the working set is wiped before every request
+            unsigned char *bitmap = arena_alloc(size);
+
+            hw_check_signatures(bitmap, APDU_CSS_PUBLIC_KEY, APDU_CSS_ENTRIES, L_signatures_count);
+
+            sendResponse(write_io_hybrid(bitmap, size, APDU_CHECK_SIGNATURES_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(ERR_CHECK_SIGNATURE);
+        }
+        FINALLY
+        {
+            // Explicitly clear the working memory
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+        }
+    }
+    END_TRY;
+}
+
+void handle_check_signatures(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    if (dataLength <= KEY_SIZE || (dataLength - KEY_SIZE) % (APDU_CSS_ENTRY_SIZE) != 0)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_signatures_count = (dataLength - KEY_SIZE) / (APDU_CSS_ENTRY_SIZE);
+
+    run_silent(do_check_signatures);
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_check_tx_ringsignatures.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <transaction.h>
+#include <utils.h>
+
+// the prefix hash of the transaction whose rings are being checked, kept between requests
+static unsigned char L_tx_prefix_hash[KEY_SIZE];
+
+static bool L_has_prefix_hash = false;
+
+// where the rings start in the request and how many there are, checked by the handler
+static const unsigned char *L_rings = NULL;
+
+static uint16_t L_rings_count = 0;
+
+static void do_check_tx_ring_signatures()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const uint16_t size = (L_rings_count + 7) / 8;
+
+            // the bitmap starts out clear as the working set is wiped before every request
+            unsigned char *bitmap = arena_alloc(size);
+
+            for (uint16_t i = 0; i < L_rings_count; i++)
+            {
+#define RING L_rings + (i * (APDU_CTRS_RING_SIZE))
+#define KEY_IMAGE RING
+#define PUBLIC_KEYS KEY_IMAGE + KEY_SIZE
+#define SIGNATURES PUBLIC_KEYS + (KEY_SIZE * RING_PARTICIPANTS)
+                // the key image table is built once per ring inside the check
+                if (hw_check_ring_signatures(L_tx_prefix_hash, KEY_IMAGE, PUBLIC_KEYS, SIGNATURES) == 1)
+                {
+                    bitmap[i / 8] |= (1 << (i % 8));
+                }
+#undef SIGNATURES
+#undef PUBLIC_KEYS
+#undef KEY_IMAGE
+#undef RING
+            }
+
+            sendResponse(write_io_hybrid(bitmap, size, APDU_CHECK_TX_RING_SIGNATURES_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(ERR_CHECK_RING_SIGS);
+        }
+        FINALLY
+        {
+            // Explicitly clear the working memory
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+        };
+    }
+    END_TRY;
+}
+
+void handle_check_tx_ring_signatures(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    uint16_t offset = 0;
+
+    if (p2 == APDU_CHECK_TX_RING_SIGNATURES_P2_FIRST)
+    {
+        if (dataLength < KEY_SIZE)
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
+
+        os_memmove(L_tx_prefix_hash, dataBuffer, KEY_SIZE);
+
+        L_has_prefix_hash = true;
+
+        offset = KEY_SIZE;
+    }
+    else if (p2 != APDU_CHECK_TX_RING_SIGNATURES_P2_NEXT || !L_has_prefix_hash)
+    {
+        return sendError(ERR_OUT_OF_RANGE);
+    }
+
+    if (dataLength == offset || (dataLength - offset) % (APDU_CTRS_RING_SIZE) != 0)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_rings = dataBuffer + offset;
+
+    L_rings_count = (dataLength - offset) / (APDU_CTRS_RING_SIZE);
+
+    run_silent(do_check_tx_ring_signatures);
+}
\ No newline at end of file
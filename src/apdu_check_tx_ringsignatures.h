@@ -0,0 +1,37 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef APDU_CHECK_TX_RINGSIGNATURES_H
+#define APDU_CHECK_TX_RINGSIGNATURES_H
+
+#include <stdint.h>
+
+#define APDU_CHECK_TX_RING_SIGNATURES_NAME ((unsigned char *)"CHKTXRINGSIGS")
+
+#define APDU_CHECK_TX_RING_SIGNATURES_P2_FIRST 0x00 // the request starts with the tx prefix hash
+#define APDU_CHECK_TX_RING_SIGNATURES_P2_NEXT 0x01 // the rings are of the same transaction as before
+
+#define APDU_CTRS_RING_SIZE KEY_SIZE + (KEY_SIZE * RING_PARTICIPANTS) + (SIG_SIZE * RING_PARTICIPANTS)
+
+void handle_check_tx_ring_signatures(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
+
+#endif // APDU_CHECK_TX_RINGSIGNATURES_H
\ No newline at end of file
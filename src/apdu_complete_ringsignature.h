@@ -21,6 +21,8 @@
 
 #define APDU_COMPLETE_RING_SIGNATURE_NAME ((unsigned char *)"C-RINGSIG")
 
+#define APDU_CRS_SIZE KEY_SIZE + sizeof(uint32_t) + KEY_SIZE + KEY_SIZE + SIG_SIZE
+
 void handle_complete_ring_signature(
     uint8_t p1,
     uint8_t p2,
@@ -16,10 +16,133 @@
 
 #include "apdu_debug.h"
 
+#include <arena.h>
+#include <hw_crypto.h>
+#include <profile.h>
 #include <utils.h>
 
-void handle_debug()
+#define DEBUG_STACK_PATTERN 0xA5
+#define DEBUG_STACK_HEADROOM 64 // bytes left untouched below the frame that paints the stack
+
+// provided by the linker script, the stack grows down from _estack towards _stack
+extern unsigned char _stack;
+extern unsigned char _estack;
+
+/**
+ * Fills the unused part of the stack with a known pattern so that the deepest
+ * point the stack has reached can be found later on, this only happens in debug builds
+ */
+void debug_stack_paint()
+{
+    if (DEBUG_BUILD != 1)
+    {
+        return;
+    }
+
+    volatile unsigned char marker = 0;
+
+    volatile unsigned char *position = &_stack;
+
+    while (position < &marker - DEBUG_STACK_HEADROOM)
+    {
+        *position++ = DEBUG_STACK_PATTERN;
+    }
+}
+
+/**
+ * Scans up from the bottom of the stack for the first byte that no longer holds
+ * the pattern written by debug_stack_paint()
+ * @return the most bytes of stack that have been used since the stack was painted
+ */
+static uint16_t debug_stack_high_water()
+{
+    volatile unsigned char *position = &_stack;
+
+    while (position < &_estack && *position == DEBUG_STACK_PATTERN)
+    {
+        position++;
+    }
+
+    return (uint16_t)(&_estack - position);
+}
+
+void debug_stack_usage(unsigned char *out)
+{
+    if (DEBUG_BUILD != 1)
+    {
+        explicit_bzero(out, DEBUG_STACK_USAGE_SIZE);
+
+        return;
+    }
+
+    uint16ToChar(out, (uint16_t)(&_estack - &_stack));
+
+    uint16ToChar(out + sizeof(uint16_t), debug_stack_high_water());
+}
+
+void handle_debug(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
+    if (p1 == APDU_DEBUG_P1_STACK)
+    {
+        // the stack is only painted in debug builds so there is nothing to measure otherwise
+        if (DEBUG_BUILD != 1)
+        {
+            return sendError(ERR_OP_NOT_PERMITTED);
+        }
+
+        unsigned char stack[DEBUG_STACK_USAGE_SIZE];
+
+        debug_stack_usage(stack);
+
+        return sendResponse(write_io_hybrid(stack, sizeof(stack), APDU_DEBUG_NAME, true), true);
+    }
+
+    if (p1 == APDU_DEBUG_P1_PROFILE)
+    {
+        // the counters only count in debug builds
+        if (DEBUG_BUILD != 1)
+        {
+            return sendError(ERR_OP_NOT_PERMITTED);
+        }
+
+        unsigned char *counters = arena_alloc(PROFILE_DUMP_MAX_SIZE);
+
+        const uint16_t size = profile_dump(counters);
+
+        if (p2 == APDU_DEBUG_P2_PROFILE_RESET)
+        {
+            profile_reset();
+        }
+
+        return sendResponse(write_io_hybrid(counters, size, APDU_DEBUG_NAME, true), true);
+    }
+
+    if (p1 == APDU_DEBUG_P1_SEED_RNG)
+    {
+        // a predictable RNG is only ever a measuring tool, a release build must not have one
+        if (DEBUG_BUILD != 1)
+        {
+            return sendError(ERR_OP_NOT_PERMITTED);
+        }
+
+        if (dataLength != 0 && dataLength != KEY_SIZE)
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
+
+        hw_debug_rng_seed((dataLength == 0) ? NULL : dataBuffer);
+
+        unsigned char seeded = dataLength != 0;
+
+        return sendResponse(write_io_hybrid(&seeded, 1, APDU_DEBUG_NAME, true), true);
+    }
+
     unsigned char status = DEBUG_BUILD == 1;
 
     /**
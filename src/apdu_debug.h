@@ -17,8 +17,34 @@
 #ifndef APDU_DEBUG_H
 #define APDU_DEBUG_H
 
+#include <stdint.h>
+
 #define APDU_DEBUG_NAME ((unsigned char *)"DEBUG")
 
-void handle_debug();
+#define APDU_DEBUG_P1_BUILD 0x00
+#define APDU_DEBUG_P1_STACK 0x01
+#define APDU_DEBUG_P1_PROFILE 0x02
+#define APDU_DEBUG_P1_SEED_RNG 0x03
+
+#define APDU_DEBUG_P2_PROFILE_RESET 0x01 // the counters start over once they are read
+
+#define DEBUG_STACK_USAGE_SIZE 4 // stack_size {2 bytes} || stack_high_water {2 bytes}
+
+void debug_stack_paint();
+
+/**
+ * Writes the size of the stack and the most of it that has been used since it was painted,
+ * zeroes unless this is a debug build
+ * @param out DEBUG_STACK_USAGE_SIZE bytes
+ */
+void debug_stack_usage(unsigned char *out);
+
+void handle_debug(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_DEBUG_H
@@ -21,6 +21,8 @@
 
 #define APDU_DERIVE_PUBLIC_KEY_NAME ((unsigned char *)"DERIVEPUBLIC")
 
+#define APDU_DPK_SIZE KEY_SIZE + sizeof(uint32_t)
+
 void handle_derive_public_key(
     uint8_t p1,
     uint8_t p2,
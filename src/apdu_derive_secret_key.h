@@ -21,6 +21,8 @@
 
 #define APDU_DERIVE_SECRET_KEY_NAME ((unsigned char *)"DERIVESECRET")
 
+#define APDU_DSK_SIZE KEY_SIZE + sizeof(uint32_t)
+
 void handle_derive_secret_key(
     uint8_t p1,
     uint8_t p2,
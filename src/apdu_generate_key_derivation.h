@@ -21,6 +21,8 @@
 
 #define APDU_GENERATE_KEY_DERIVATION_NAME ((unsigned char *)"GENKEYDERV")
 
+#define APDU_GKD_SIZE KEY_SIZE
+
 void handle_generate_key_derivation(
     uint8_t p1,
     uint8_t p2,
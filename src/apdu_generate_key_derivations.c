@@ -0,0 +1,72 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_generate_key_derivations.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <review.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_GKDS_TX_PUBLIC_KEYS APDU_DATA
+#define APDU_GKDS_DERIVATIONS WORKING_SET
+
+static unsigned int pre_approved = 0;
+
+// the number of transaction public keys in the request, checked by the handler before it is reviewed
+static uint8_t L_derivations_count = 0;
+
+static uint16_t generate_key_derivations()
+{
+    review_output_size(L_derivations_count * KEY_SIZE);
+
+    return hw_generate_key_derivations(
+        APDU_GKDS_DERIVATIONS, APDU_GKDS_TX_PUBLIC_KEYS, L_derivations_count, PTR_VIEW_PRIVATE);
+}
+
+static const review_t C_generate_key_derivations_review = {
+    {"Generate", "Derivations?"},
+    "Tx Public Key",
+    {"Generating", "Derivations..."},
+    generate_key_derivations,
+    APDU_GKDS_DERIVATIONS,
+    0,
+    APDU_GENERATE_KEY_DERIVATIONS_NAME,
+    &pre_approved,
+    false};
+
+void handle_generate_key_derivations(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    if (dataLength == 0 || dataLength % KEY_SIZE != 0 || dataLength / KEY_SIZE > APDU_GKDS_MAX_KEYS)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_derivations_count = dataLength / KEY_SIZE;
+
+    arena_alloc(dataLength);
+
+    review_start(&C_generate_key_derivations_review, APDU_GKDS_TX_PUBLIC_KEYS, p1, flags);
+}
\ No newline at end of file
@@ -16,105 +16,69 @@
 
 #include "apdu_generate_keyimage.h"
 
+#include <cache.h>
 #include <keys.h>
+#include <review.h>
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_GKI_SIZE KEY_SIZE + sizeof(uint32_t) + KEY_SIZE
-#define APDU_GKI_TX_PUBLIC_KEY WORKING_SET
-#define APDU_GKI_OUTPUT_INDEX readUint32BE(WORKING_SET + KEY_SIZE)
-#define APDU_GKI_OUTPUT_KEY WORKING_SET + KEY_SIZE + sizeof(uint32_t)
-#define APDU_GKI_KEY_IMAGE APDU_GKI_OUTPUT_KEY + KEY_SIZE
+#define APDU_GKI_TX_PUBLIC_KEY APDU_DATA
+#define APDU_GKI_OUTPUT_INDEX readUint32BE(APDU_DATA + KEY_SIZE)
+#define APDU_GKI_OUTPUT_KEY APDU_DATA + KEY_SIZE + sizeof(uint32_t)
+#define APDU_GKI_KEY_IMAGE WORKING_SET
 
 static unsigned int pre_approved = 0;
 
-static void do_generate_key_image(const size_t approve_all_this_session)
+uint16_t generate_key_image_cached(
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key)
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            // Try to generate the key image
-            const uint16_t status = hw_generate_key_image(
-                APDU_GKI_KEY_IMAGE,
-                APDU_GKI_TX_PUBLIC_KEY,
-                APDU_GKI_OUTPUT_INDEX,
-                APDU_GKI_OUTPUT_KEY,
-                N_turtlecoin_wallet->view.private,
-                N_turtlecoin_wallet->spend.private,
-                N_turtlecoin_wallet->spend.public);
-
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
-
-            pre_approved = approve_all_this_session;
-
-            CLOSE_TRY;
-
-            sendResponse(write_io_hybrid(APDU_GKI_KEY_IMAGE, KEY_SIZE, APDU_GENERATE_KEYIMAGE_NAME, true), true);
-        }
-        CATCH_OTHER(e)
-        {
-            sendError(e);
-        }
-        FINALLY
-        {
-            // Explicitly clear the working memory
-            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+    // Hand back the key image if we have already generated it for this output
+    uint16_t status = cache_key_image_get(key_image, tx_public_key, output_index, output_key);
 
-            // Explicitly clear any display information
-            explicit_bzero(DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
-        };
+    if (status == OP_OK)
+    {
+        return OP_OK;
     }
-    END_TRY;
-}
-
-UX_STEP_SPLASH(
-    ux_display_generate_keyimage_manual_flow_1_step,
-    pnn,
-    do_generate_key_image(0),
-    {&C_icon_turtlecoin, "Generating", "Key Image..."});
-
-UX_STEP_SPLASH(
-    ux_display_generate_keyimage_auto_flow_1_step,
-    pnn,
-    do_generate_key_image(1),
-    {&C_icon_turtlecoin, "Generating", "Key Image..."});
 
-UX_FLOW(ux_display_generate_keyimage_manual_flow, &ux_display_generate_keyimage_manual_flow_1_step);
-
-UX_FLOW(ux_display_generate_keyimage_auto_flow, &ux_display_generate_keyimage_auto_flow_1_step);
-
-UX_STEP_NOCB(ux_display_generate_keyimage_flow_1_step, pnn, {&C_icon_turtlecoin, " Generate ", "Key Image?"});
-
-UX_STEP_NOCB(
-    ux_display_generate_keyimage_flow_2_step,
-    bnnn_paging,
-    {.title = "Output Key", .text = (char *)DISPLAY_KEY_HEX});
+    // Try to generate the key image
+    status = hw_generate_key_image(
+        key_image,
+        tx_public_key,
+        output_index,
+        output_key,
+        N_turtlecoin_wallet->view8,
+        N_turtlecoin_wallet->spend.private,
+        N_turtlecoin_wallet->spend_point);
+
+    if (status != OP_OK)
+    {
+        return status;
+    }
 
-UX_STEP_VALID(
-    ux_display_generate_keyimage_flow_3_step,
-    pb,
-    ux_flow_init(0, ux_display_generate_keyimage_auto_flow, NULL),
-    {&C_icon_validate_14, "Approve All"});
+    cache_key_image_put(key_image, tx_public_key, output_index, output_key);
 
-UX_STEP_VALID(
-    ux_display_generate_keyimage_flow_4_step,
-    pb,
-    ux_flow_init(0, ux_display_generate_keyimage_manual_flow, NULL),
-    {&C_icon_validate_14, "Approve"});
+    return OP_OK;
+}
 
-UX_STEP_VALID(ux_display_generate_keyimage_flow_5_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
+static uint16_t generate_key_image()
+{
+    return generate_key_image_cached(
+        APDU_GKI_KEY_IMAGE, APDU_GKI_TX_PUBLIC_KEY, APDU_GKI_OUTPUT_INDEX, APDU_GKI_OUTPUT_KEY);
+}
 
-UX_FLOW(
-    ux_display_generate_keyimage_flow,
-    &ux_display_generate_keyimage_flow_1_step,
-    &ux_display_generate_keyimage_flow_2_step,
-    &ux_display_generate_keyimage_flow_3_step,
-    &ux_display_generate_keyimage_flow_4_step,
-    &ux_display_generate_keyimage_flow_5_step);
+static const review_t C_generate_keyimage_review = {
+    {" Generate ", "Key Image?"},
+    "Output Key",
+    {"Generating", "Key Image..."},
+    generate_key_image,
+    APDU_GKI_KEY_IMAGE,
+    KEY_SIZE,
+    APDU_GENERATE_KEYIMAGE_NAME,
+    &pre_approved,
+    true};
 
 void handle_generate_keyimage(
     uint8_t p1,
@@ -126,47 +90,5 @@ void handle_generate_keyimage(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-    else if (dataLength != APDU_GKI_SIZE)
-    {
-        return sendError(ERR_WRONG_INPUT_LENGTH);
-    }
-
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
-
-    toHexString(APDU_GKI_OUTPUT_KEY, KEY_SIZE, DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
-
-    /**
-     * If the APDU was sent requesting confirmation then
-     * we need to start the UX flow and set the flags
-     * to let the i/o handler know that the request is
-     * async and will be completed shortly unless approval
-     * was already provided in this application "session"
-     */
-    if (pre_approved == 1)
-    {
-        ux_flow_init(0, ux_display_generate_keyimage_auto_flow, NULL);
-
-        *flags |= IO_ASYNCH_REPLY;
-    }
-    else if (p1 == P1_CONFIRM)
-    {
-        ux_flow_init(0, ux_display_generate_keyimage_flow, NULL);
-
-        *flags |= IO_ASYNCH_REPLY;
-    }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
-    {
-        ux_flow_init(0, ux_display_generate_keyimage_auto_flow, NULL);
-
-        *flags |= IO_ASYNCH_REPLY;
-    }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
+    review_start(&C_generate_keyimage_review, APDU_GKI_OUTPUT_KEY, p1, flags);
 }
\ No newline at end of file
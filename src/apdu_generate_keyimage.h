@@ -17,10 +17,28 @@
 #ifndef APDU_GENERATE_KEYIMAGE_H
 #define APDU_GENERATE_KEYIMAGE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define APDU_GENERATE_KEYIMAGE_NAME ((unsigned char *)"KEYIMAGE")
 
+#define APDU_GKI_SIZE KEY_SIZE + sizeof(uint32_t) + KEY_SIZE
+
+/**
+ * Generates the key image of one of our outputs, handing back the one in the key image cache
+ * if it was already generated
+ * @param key_image the resulting key image
+ * @param tx_public_key the transaction public key
+ * @param output_index the index of the output in the transaction
+ * @param output_key the output key
+ * @returns OP_OK or the error
+ */
+uint16_t generate_key_image_cached(
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key);
+
 void handle_generate_keyimage(
     uint8_t p1,
     uint8_t p2,
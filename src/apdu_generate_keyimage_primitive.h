@@ -21,6 +21,8 @@
 
 #define APDU_GENERATE_KEYIMAGE_PRIMITIVE_NAME ((unsigned char *)"KEYIMAGE_PRIMITIVE")
 
+#define APDU_GKIP_SIZE KEY_SIZE + sizeof(uint32_t) + KEY_SIZE
+
 void handle_generate_keyimage_primitive(
     uint8_t p1,
     uint8_t p2,
@@ -0,0 +1,102 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_generate_keyimages.h"
+
+#include <apdu_generate_keyimage.h>
+#include <apdu_scan_outputs.h>
+#include <arena.h>
+#include <keys.h>
+#include <review.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_GKIS_OUTPUT_KEY APDU_DATA + APDU_SO_GROUP_SIZE + sizeof(uint32_t)
+#define APDU_GKIS_KEY_IMAGES WORKING_SET
+
+static unsigned int pre_approved = 0;
+
+// the length of the request, checked by the handler before it is reviewed
+static uint16_t L_keyimages_length = 0;
+
+static uint16_t generate_key_images()
+{
+    const unsigned char *data = APDU_DATA;
+
+    const unsigned char *end = APDU_DATA + L_keyimages_length;
+
+    unsigned char *key_image = APDU_GKIS_KEY_IMAGES;
+
+    while (data < end)
+    {
+        const unsigned char *tx_public_key = data;
+
+        const uint8_t count = readUint8((uint8_t *)data + KEY_SIZE);
+
+        data += APDU_SO_GROUP_SIZE;
+
+        // the outputs of a transaction find its derivation in the derivation cache after the first one
+        for (uint8_t i = 0; i < count; i++, data += APDU_SO_OUTPUT_SIZE, key_image += KEY_SIZE)
+        {
+            const uint16_t status = generate_key_image_cached(
+                key_image, tx_public_key, readUint32BE((uint8_t *)data), data + sizeof(uint32_t));
+
+            if (status != OP_OK)
+            {
+                return status;
+            }
+        }
+    }
+
+    review_output_size(key_image - APDU_GKIS_KEY_IMAGES);
+
+    return OP_OK;
+}
+
+static const review_t C_generate_keyimages_review = {
+    {" Generate ", "Key Images?"},
+    "Output Key",
+    {"Generating", "Key Images..."},
+    generate_key_images,
+    APDU_GKIS_KEY_IMAGES,
+    0,
+    APDU_GENERATE_KEYIMAGES_NAME,
+    &pre_approved,
+    false};
+
+void handle_generate_keyimages(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    const uint16_t outputs = scan_count_outputs(dataBuffer, dataLength);
+
+    if (outputs == 0 || outputs > APDU_GKIS_MAX_OUTPUTS)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_keyimages_length = dataLength;
+
+    arena_alloc(outputs * KEY_SIZE);
+
+    review_start(&C_generate_keyimages_review, APDU_GKIS_OUTPUT_KEY, p1, flags);
+}
\ No newline at end of file
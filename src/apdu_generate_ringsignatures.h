@@ -21,6 +21,9 @@
 
 #define APDU_GENERATE_RING_SIGNATURES_NAME ((unsigned char *)"GENRINGSIGS")
 
+#define APDU_GRS_SIZE \
+    KEY_SIZE + sizeof(uint32_t) + KEY_SIZE + KEY_SIZE + (KEY_SIZE * RING_PARTICIPANTS) + sizeof(uint32_t)
+
 void handle_generate_ring_signatures(
     uint8_t p1,
     uint8_t p2,
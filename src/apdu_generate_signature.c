@@ -16,75 +16,36 @@
 
 #include "apdu_generate_signature.h"
 
+#include <arena.h>
 #include <keys.h>
+#include <review.h>
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_GS_SIZE KEY_SIZE
-#define APDU_GS_MESSAGE_DIGEST WORKING_SET
-#define APDU_GS_SIGNATURE APDU_GS_MESSAGE_DIGEST + KEY_SIZE
-#define APDU_GS_MD_HEX APDU_GS_SIGNATURE + SIG_SIZE
+#define APDU_GS_MESSAGE_DIGEST APDU_DATA
+#define APDU_GS_SIGNATURE WORKING_SET
 
-static void do_generate_signature()
-{
-    BEGIN_TRY
-    {
-        TRY
-        {
-            const uint16_t status = hw_generate_signature(
-                APDU_GS_SIGNATURE,
-                APDU_GS_MESSAGE_DIGEST,
-                N_turtlecoin_wallet->spend.public,
-                N_turtlecoin_wallet->spend.private);
-
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+ARENA_ASSERT_FITS(SIG_SIZE, "APDU_GENERATE_SIGNATURE");
 
-            CLOSE_TRY;
-
-            sendResponse(write_io_hybrid(APDU_GS_SIGNATURE, SIG_SIZE, APDU_GENERATE_SIGNATURE_NAME, true), true);
-        }
-        CATCH_OTHER(e)
-        {
-            sendError(e);
-        }
-        FINALLY
-        {
-            // Explicitly clear the working memory
-            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
-        };
-    }
-    END_TRY;
+static uint16_t generate_signature()
+{
+    return hw_generate_signature(
+        APDU_GS_SIGNATURE,
+        APDU_GS_MESSAGE_DIGEST,
+        N_turtlecoin_wallet->spend.public,
+        N_turtlecoin_wallet->spend.private);
 }
 
-UX_STEP_SPLASH(
-    ux_display_generate_signature_splash_1_step,
-    pnn,
-    do_generate_signature(),
-    {&C_icon_turtlecoin, "Signing", "Digest..."});
-
-UX_FLOW(ux_display_generate_signature_splash, &ux_display_generate_signature_splash_1_step);
-
-UX_STEP_NOCB(
-    ux_display_generate_signature_flow_1_step,
-    bnnn_paging,
-    {.title = "Sign Digest?", .text = (char *)APDU_GS_MD_HEX});
-
-UX_STEP_VALID(
-    ux_display_generate_signature_flow_2_step,
-    pb,
-    ux_flow_init(0, ux_display_generate_signature_splash, NULL),
-    {&C_icon_validate_14, "Approve"});
-
-UX_STEP_VALID(ux_display_generate_signature_flow_3_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
-
-UX_FLOW(
-    ux_display_generate_signature_flow,
-    &ux_display_generate_signature_flow_1_step,
-    &ux_display_generate_signature_flow_2_step,
-    &ux_display_generate_signature_flow_3_step);
+static const review_t C_generate_signature_review = {
+    {"Sign", "Digest?"},
+    "Digest",
+    {"Signing", "Digest..."},
+    generate_signature,
+    APDU_GS_SIGNATURE,
+    SIG_SIZE,
+    APDU_GENERATE_SIGNATURE_NAME,
+    NULL,
+    true};
 
 void handle_generate_signature(
     uint8_t p1,
@@ -96,40 +57,5 @@ void handle_generate_signature(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-    else if (dataLength != APDU_GS_SIZE)
-    {
-        return sendError(ERR_WRONG_INPUT_LENGTH);
-    }
-
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
-
-    toHexString(APDU_GS_MESSAGE_DIGEST, KEY_SIZE, APDU_GS_MD_HEX, KEY_HEXSTR_SIZE);
-
-    /**
-     * If the APDU was sent requesting confirmation then
-     * we need to start the UX flow and set the flags
-     * to let the i/o handler know that the request is
-     * async and will be completed shortly
-     */
-    if (p1 == P1_CONFIRM)
-    {
-        ux_flow_init(0, ux_display_generate_signature_flow, NULL);
-
-        *flags |= IO_ASYNCH_REPLY;
-    }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
-    {
-        ux_flow_init(0, ux_display_generate_signature_splash, NULL);
-
-        *flags |= IO_ASYNCH_REPLY;
-    }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
+    review_start(&C_generate_signature_review, APDU_GS_MESSAGE_DIGEST, p1, flags);
 }
\ No newline at end of file
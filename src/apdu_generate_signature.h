@@ -21,6 +21,8 @@
 
 #define APDU_GENERATE_SIGNATURE_NAME ((unsigned char *)"GENSIG")
 
+#define APDU_GS_SIZE KEY_SIZE
+
 void handle_generate_signature(
     uint8_t p1,
     uint8_t p2,
@@ -0,0 +1,83 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_generate_signatures.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <review.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_GSS_MESSAGE_DIGESTS APDU_DATA
+#define APDU_GSS_SIGNATURES WORKING_SET
+
+// the number of digests in the request, checked by the handler before it is reviewed
+static uint16_t L_digests_count = 0;
+
+static uint16_t generate_signatures()
+{
+    for (uint16_t i = 0; i < L_digests_count; i++)
+    {
+        const uint16_t status = hw_generate_signature(
+            APDU_GSS_SIGNATURES + (i * SIG_SIZE),
+            APDU_GSS_MESSAGE_DIGESTS + (i * KEY_SIZE),
+            N_turtlecoin_wallet->spend.public,
+            N_turtlecoin_wallet->spend.private);
+
+        if (status != OP_OK)
+        {
+            return status;
+        }
+    }
+
+    review_output_size(L_digests_count * SIG_SIZE);
+
+    return OP_OK;
+}
+
+static const review_t C_generate_signatures_review = {
+    {"Sign", "Digests?"},
+    "First Digest",
+    {"Signing", "Digests..."},
+    generate_signatures,
+    APDU_GSS_SIGNATURES,
+    0,
+    APDU_GENERATE_SIGNATURES_NAME,
+    NULL,
+    false};
+
+void handle_generate_signatures(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    if (dataLength == 0 || dataLength % KEY_SIZE != 0 || dataLength / KEY_SIZE > APDU_GSS_MAX_COUNT)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_digests_count = dataLength / KEY_SIZE;
+
+    arena_alloc(L_digests_count * SIG_SIZE);
+
+    review_start(&C_generate_signatures_review, APDU_GSS_MESSAGE_DIGESTS, p1, flags);
+}
\ No newline at end of file
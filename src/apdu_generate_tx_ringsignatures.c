@@ -0,0 +1,239 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_generate_tx_ringsignatures.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <transaction.h>
+#include <utils.h>
+
+typedef struct apdu_generate_tx_ring_signatures_set_s
+{
+    uint8_t inputs; // 1-byte
+
+    char inputs_text[4]; // 4-bytes, "255"
+
+    unsigned char amount_text[KEY_SIZE]; // 32-bytes
+} apdu_generate_tx_ring_signatures_set_t;
+
+ARENA_ASSERT_FITS(sizeof(apdu_generate_tx_ring_signatures_set_t), "APDU_GENERATE_TX_RING_SIGNATURES");
+
+ARENA_ASSERT_FITS(SIG_SET_SIZE, "APDU_GENERATE_TX_RING_SIGNATURES");
+
+#define APDU_GTRS ARENA_LAYOUT(apdu_generate_tx_ring_signatures_set_t)
+
+#define APDU_GTRS_TX_PREFIX_HASH APDU_DATA
+#define APDU_GTRS_INPUTS readUint8(APDU_DATA + KEY_SIZE)
+#define APDU_GTRS_AMOUNT readUint64BE(APDU_DATA + KEY_SIZE + sizeof(uint8_t))
+
+#define APDU_GTRS_TX_PUBLIC_KEY APDU_DATA
+#define APDU_GTRS_OUTPUT_IDX readUint32BE(APDU_DATA + KEY_SIZE)
+#define APDU_GTRS_INPUT_KEYS APDU_DATA + KEY_SIZE + sizeof(uint32_t)
+#define APDU_GTRS_REAL_OUTPUT_IDX readUint32BE(APDU_GTRS_INPUT_KEYS + (KEY_SIZE * RING_PARTICIPANTS))
+#define APDU_GTRS_SIGNATURES WORKING_SET
+
+// the prefix hash that the user approved and how many of its inputs may still be signed
+static unsigned char L_tx_prefix_hash[KEY_SIZE];
+
+static uint8_t L_inputs_left = 0;
+
+void generate_tx_ring_signatures_end()
+{
+    explicit_bzero(L_tx_prefix_hash, sizeof(L_tx_prefix_hash));
+
+    L_inputs_left = 0;
+}
+
+static void do_approve_tx_ring_signatures()
+{
+    os_memmove(L_tx_prefix_hash, APDU_GTRS_TX_PREFIX_HASH, KEY_SIZE);
+
+    L_inputs_left = APDU_GTRS->inputs;
+
+    // Explicitly clear any display information
+    explicit_bzero(DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
+
+    sendResponse(0, true);
+}
+
+static void do_generate_tx_ring_signatures()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            // the input is used up whether or not it can be signed (see APDU_GENERATE_TX_RING_SIGNATURES)
+            L_inputs_left--;
+
+            const size_t real_output_index = APDU_GTRS_REAL_OUTPUT_IDX;
+
+            // the output being spent is the member of the ring at the real output index
+            const uint16_t status = hw_generate_ring_signatures(
+                APDU_GTRS_SIGNATURES,
+                APDU_GTRS_TX_PUBLIC_KEY,
+                APDU_GTRS_OUTPUT_IDX,
+                APDU_GTRS_INPUT_KEYS + (real_output_index * KEY_SIZE),
+                L_tx_prefix_hash,
+                APDU_GTRS_INPUT_KEYS,
+                real_output_index,
+                N_turtlecoin_wallet->view8,
+                N_turtlecoin_wallet->spend.private,
+                N_turtlecoin_wallet->spend_point);
+
+            if (status != OP_OK)
+            {
+                THROW(ERR_GENERATE_RING_SIGS);
+            }
+
+            if (L_inputs_left == 0)
+            {
+                generate_tx_ring_signatures_end();
+            }
+
+            CLOSE_TRY;
+
+            sendResponse(
+                write_io_hybrid(
+                    APDU_GTRS_SIGNATURES, SIG_SET_SIZE, APDU_GENERATE_TX_RING_SIGNATURES_NAME, true),
+                true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY
+        {
+            // Explicitly clear the working memory
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+        };
+    }
+    END_TRY;
+}
+
+UX_STEP_NOCB(ux_generate_tx_ring_signatures_1_step, pnn, {&C_icon_turtlecoin, "Sign Tx", "Inputs?"});
+
+UX_STEP_NOCB(ux_generate_tx_ring_signatures_2_step, bnnn_paging, {.title = "Inputs", .text = APDU_GTRS->inputs_text});
+
+UX_STEP_NOCB(
+    ux_generate_tx_ring_signatures_3_step,
+    bnnn_paging,
+    {.title = "Total to Spend", .text = (char *)APDU_GTRS->amount_text});
+
+UX_STEP_NOCB(
+    ux_generate_tx_ring_signatures_4_step,
+    bnnn_paging,
+    {.title = "Tx Prefix Hash", .text = (char *)DISPLAY_KEY_HEX});
+
+UX_STEP_VALID(
+    ux_generate_tx_ring_signatures_5_step,
+    pb,
+    do_approve_tx_ring_signatures(),
+    {&C_icon_validate_14, "Approve"});
+
+UX_STEP_VALID(ux_generate_tx_ring_signatures_6_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
+
+UX_FLOW(
+    ux_generate_tx_ring_signatures_flow,
+    &ux_generate_tx_ring_signatures_1_step,
+    &ux_generate_tx_ring_signatures_2_step,
+    &ux_generate_tx_ring_signatures_3_step,
+    &ux_generate_tx_ring_signatures_4_step,
+    &ux_generate_tx_ring_signatures_5_step,
+    &ux_generate_tx_ring_signatures_6_step);
+
+static void handle_first(const uint8_t p1, const uint16_t dataLength, volatile unsigned int *flags)
+{
+    // a new request always replaces the approval that is running, even if it is turned down
+    generate_tx_ring_signatures_end();
+
+    if (dataLength != APDU_GTRS_FIRST_SIZE)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    if (APDU_GTRS_INPUTS == 0)
+    {
+        return sendError(ERR_OUT_OF_RANGE);
+    }
+
+    apdu_generate_tx_ring_signatures_set_t *set = ARENA_NEW(apdu_generate_tx_ring_signatures_set_t);
+
+    set->inputs = APDU_GTRS_INPUTS;
+
+    if (p1 != P1_CONFIRM)
+    {
+        if (!(p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1))
+        {
+            return sendError(ERR_OP_USER_REQUIRED);
+        }
+
+        do_approve_tx_ring_signatures();
+
+        *flags |= IO_ASYNCH_REPLY;
+
+        return;
+    }
+
+    SPRINTF(set->inputs_text, "%d", set->inputs);
+
+    {
+        unsigned int offset = amountToString(set->amount_text, APDU_GTRS_AMOUNT, KEY_SIZE);
+
+        // copy the ticker on to the end of the amount
+        os_memmove(set->amount_text + offset - 1, TICKER, TICKER_SIZE);
+    }
+
+    toHexString(APDU_GTRS_TX_PREFIX_HASH, KEY_SIZE, DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
+
+    ux_flow_init(0, ux_generate_tx_ring_signatures_flow, NULL);
+
+    *flags |= IO_ASYNCH_REPLY;
+}
+
+void handle_generate_tx_ring_signatures(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    if (p2 == APDU_GENERATE_TX_RING_SIGNATURES_P2_FIRST)
+    {
+        return handle_first(p1, dataLength, flags);
+    }
+    else if (p2 != APDU_GENERATE_TX_RING_SIGNATURES_P2_NEXT)
+    {
+        return sendError(ERR_OUT_OF_RANGE);
+    }
+    else if (L_inputs_left == 0)
+    {
+        return sendError(ERR_OP_USER_REQUIRED);
+    }
+    else if (dataLength != APDU_GTRS_INPUT_SIZE)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+    else if (APDU_GTRS_REAL_OUTPUT_IDX >= RING_PARTICIPANTS)
+    {
+        return sendError(ERR_OUT_OF_RANGE);
+    }
+
+    arena_alloc(SIG_SET_SIZE);
+
+    run_silent(do_generate_tx_ring_signatures);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef APDU_GENERATE_TX_RINGSIGNATURES_H
+#define APDU_GENERATE_TX_RINGSIGNATURES_H
+
+#include <stdint.h>
+
+#define APDU_GENERATE_TX_RING_SIGNATURES_NAME ((unsigned char *)"GENTXRINGSIGS")
+
+#define APDU_GENERATE_TX_RING_SIGNATURES_P2_FIRST 0x00 // the request asks for the approval of the transaction
+#define APDU_GENERATE_TX_RING_SIGNATURES_P2_NEXT 0x01 // the request is an input of the approved transaction
+
+#define APDU_GTRS_FIRST_SIZE KEY_SIZE + sizeof(uint8_t) + sizeof(uint64_t)
+
+#define APDU_GTRS_INPUT_SIZE KEY_SIZE + sizeof(uint32_t) + (KEY_SIZE * RING_PARTICIPANTS) + sizeof(uint32_t)
+
+void handle_generate_tx_ring_signatures(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
+
+/**
+ * Ends the approval of the transaction whose ring signatures are being generated, if any
+ */
+void generate_tx_ring_signatures_end();
+
+#endif // APDU_GENERATE_TX_RINGSIGNATURES_H
\ No newline at end of file
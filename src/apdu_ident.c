@@ -19,7 +19,13 @@
 #include <keys.h>
 #include <utils.h>
 
-void handle_ident()
+void handle_ident(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     /**
      * This is static non-privileged information and as thus
@@ -19,6 +19,12 @@
 
 #define APDU_IDENT_NAME ((unsigned char *)"IDENT")
 
-void handle_ident();
+void handle_ident(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_IDENT_H
@@ -0,0 +1,38 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <apdu_nvram_stats.h>
+#include <nvram.h>
+#include <utils.h>
+
+void handle_nvram_stats(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    unsigned char stats[NVRAM_STATS_DUMP_SIZE];
+
+    nvram_stats_dump(stats);
+
+    /**
+     * The counters say nothing about the keys or the transaction
+     * and as thus can be returned without any additional checking
+     */
+    sendResponse(write_io_hybrid(stats, sizeof(stats), APDU_NVRAM_STATS_NAME, true), true);
+}
\ No newline at end of file
@@ -20,9 +20,11 @@
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_PTP_SIZE KEY_SIZE
-#define APDU_PTP_PRIVATE_KEY WORKING_SET
-#define APDU_PTP_PUBLIC_KEY APDU_PTP_PRIVATE_KEY + KEY_SIZE
+#define APDU_PTP_PRIVATE_KEY APDU_DATA
+#define APDU_PTP_PUBLIC_KEY WORKING_SET
+
+// the number of private keys in the request, checked by the handler
+static uint8_t L_key_count = 1;
 
 static void do_private_to_public()
 {
@@ -30,16 +32,22 @@ static void do_private_to_public()
     {
         TRY
         {
-            const uint16_t status = hw_private_key_to_public_key(APDU_PTP_PUBLIC_KEY, APDU_PTP_PRIVATE_KEY);
-
-            if (status != OP_OK)
+            for (uint8_t i = 0; i < L_key_count; i++)
             {
-                THROW(status);
+                const uint16_t status = hw_private_key_to_public_key(
+                    APDU_PTP_PUBLIC_KEY + (i * KEY_SIZE), APDU_PTP_PRIVATE_KEY + (i * KEY_SIZE));
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
             }
 
             CLOSE_TRY;
 
-            sendResponse(write_io_hybrid(APDU_PTP_PUBLIC_KEY, KEY_SIZE, APDU_PRIVATE_TO_PUBLIC_NAME, true), true);
+            sendResponse(
+                write_io_hybrid(APDU_PTP_PUBLIC_KEY, L_key_count * KEY_SIZE, APDU_PRIVATE_TO_PUBLIC_NAME, true),
+                true);
         }
         CATCH_OTHER(e)
         {
@@ -68,17 +76,13 @@ void handle_private_to_public(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-    else if (dataLength != APDU_PTP_SIZE)
+    // a chained request carries more than one key, the responses to those are chunked as well
+    if (dataLength == 0 || dataLength % KEY_SIZE != 0 || dataLength / KEY_SIZE > APDU_PTP_MAX_KEYS)
     {
         return sendError(ERR_WRONG_INPUT_LENGTH);
     }
 
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
+    L_key_count = dataLength / KEY_SIZE;
 
     ux_flow_init(0, ux_private_to_public_flow, NULL);
 
@@ -21,6 +21,8 @@
 
 #define APDU_PRIVATE_TO_PUBLIC_NAME ((unsigned char *)"PRIVATE2PUBLIC")
 
+#define APDU_PTP_MAX_KEYS WORKING_SET_SIZE / KEY_SIZE
+
 void handle_private_to_public(
     uint8_t p1,
     uint8_t p2,
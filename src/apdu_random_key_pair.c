@@ -20,26 +20,43 @@
 #include <transaction.h>
 #include <utils.h>
 
+#define APDU_RKP_KEY_PAIRS WORKING_SET
+
+// the number of key pairs asked for, checked by the handler
+static uint8_t L_key_pair_count = 1;
+
 static void do_generate_random_key_pair()
 {
-    unsigned char combined[64] = {0};
+    const uint16_t size = L_key_pair_count * KEY_SIZE * 2;
 
     BEGIN_TRY
     {
         TRY
         {
-            const uint16_t status = hw_generate_keypair(combined, combined + KEY_SIZE);
+            // every key pair is public_key || private_key
+            for (uint8_t i = 0; i < L_key_pair_count; i++)
+            {
+                unsigned char *combined = APDU_RKP_KEY_PAIRS + (i * KEY_SIZE * 2);
+
+                const uint16_t status = hw_generate_keypair(combined, combined + KEY_SIZE);
 
-            if (status != OP_OK)
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+            }
+
+            // a response longer than a single APDU goes back in chunks (see APDU_GET_RESPONSE)
+            if (size > CHAIN_CHUNK_SIZE)
             {
-                THROW(status);
+                chain_responses(true);
             }
 
             /**
              * This is static non-privileged information and as thus
              * can be returned without any additional checking
              */
-            sendResponse(write_io_hybrid(combined, sizeof(combined), APDU_RANDOM_KEY_PAIR_NAME, true), true);
+            sendResponse(write_io_hybrid(APDU_RKP_KEY_PAIRS, size, APDU_RANDOM_KEY_PAIR_NAME, true), true);
         }
         CATCH_OTHER(e)
         {
@@ -48,7 +65,7 @@ static void do_generate_random_key_pair()
         FINALLY
         {
             // Explicitly clear the working memory
-            explicit_bzero(combined, sizeof(combined));
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
         }
     }
     END_TRY;
@@ -62,13 +79,23 @@ UX_STEP_SPLASH(
 
 UX_FLOW(ux_generate_random_key_pair_flow, &ux_generate_random_key_pair_flow_1_step);
 
-void handle_generate_random_key_pair(volatile unsigned int *flags)
+void handle_generate_random_key_pair(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
-    if (tx_state() != TX_UNUSED)
+    const uint8_t count = (p2 == 0) ? 1 : p2;
+
+    if (count > APDU_RKP_MAX_COUNT)
     {
-        return sendError(ERR_TRANSACTION_STATE);
+        return sendError(ERR_OUT_OF_RANGE);
     }
 
+    L_key_pair_count = count;
+
     ux_flow_init(0, ux_generate_random_key_pair_flow, NULL);
 
     *flags |= IO_ASYNCH_REPLY;
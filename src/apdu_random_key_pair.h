@@ -19,6 +19,15 @@
 
 #define APDU_RANDOM_KEY_PAIR_NAME ((unsigned char *)"RANDOMKEYS")
 
-void handle_generate_random_key_pair(volatile unsigned int *flags);
+// the key pairs have to fit in the IO buffer along with the status word
+#define APDU_RKP_MAX_COUNT (MIN(WORKING_SET_SIZE, IO_APDU_BUFFER_SIZE - 2) / (KEY_SIZE * 2))
+
+void handle_generate_random_key_pair(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_RANDOM_KEY_PAIR_H
@@ -66,15 +66,16 @@ UX_STEP_VALID(ux_reset_keys_flow_3_step, pb, do_deny(), {&C_icon_crossmark, "Rej
 
 UX_FLOW(ux_reset_keys_flow, &ux_reset_keys_flow_1_step, &ux_reset_keys_flow_2_step, &ux_reset_keys_flow_3_step);
 
-void handle_reset(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx)
+void handle_reset(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-
     /**
      * If the APDU was sent requesting confirmation then
      * we need to start the UX flow and set the flags
@@ -87,14 +88,10 @@ void handle_reset(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
+    else
     {
         ux_flow_init(0, ux_display_reset_keys_splash, NULL);
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
 }
\ No newline at end of file
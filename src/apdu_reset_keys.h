@@ -19,6 +19,12 @@
 
 #include <stdint.h>
 
-void handle_reset(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx);
+void handle_reset(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_RESET_KEYS_H
@@ -0,0 +1,123 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_resources.h"
+
+#include <apdu.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_RES_LIMITS_SIZE 17
+#define APDU_RES_USAGE_SIZE (6 + DEBUG_STACK_USAGE_SIZE)
+#define APDU_RES_NO_LIMIT 0xFFFF // the command takes as many items as fit in a (chained) request
+
+typedef struct resource_batch_s
+{
+    uint8_t ins;
+    uint8_t header; // bytes of a request that come before its items
+    uint8_t item; // bytes of every item
+    uint16_t limit; // the most items that the command takes however large the request
+} resource_batch_t;
+
+// the commands that take a number of items, a grouped request is counted as a single group
+static const resource_batch_t C_resource_batches[] = {
+    {APDU_PRIVATE_TO_PUBLIC, 0, KEY_SIZE, APDU_PTP_MAX_KEYS},
+    {APDU_RANDOM_KEY_PAIR, 0, 0, APDU_RKP_MAX_COUNT},
+    {APDU_CHECK_KEYS, 0, KEY_SIZE, APDU_RES_NO_LIMIT},
+    {APDU_GENERATE_KEYIMAGES, KEY_SIZE + 1, APDU_SO_OUTPUT_SIZE, APDU_GKIS_MAX_OUTPUTS},
+    {APDU_GENERATE_SIGNATURES, 0, KEY_SIZE, APDU_GSS_MAX_COUNT},
+    {APDU_CHECK_SIGNATURES, KEY_SIZE, APDU_CSS_ENTRY_SIZE, APDU_RES_NO_LIMIT},
+    {APDU_SCAN_OUTPUTS, KEY_SIZE + 1, APDU_SO_OUTPUT_SIZE, APDU_SO_MAX_OUTPUTS},
+    {APDU_GENERATE_KEY_DERIVATIONS, 0, KEY_SIZE, APDU_GKDS_MAX_KEYS},
+    {APDU_CHECK_INPUTS, 0, APDU_CI_INPUT_HEADER_SIZE + (RING_PARTICIPANTS * KEY_SIZE), APDU_CI_MAX_INPUTS},
+    {APDU_TX_LOAD_OUTPUT, 0, KEY_SIZE + 8, APDU_TX_LOAD_OUTPUT_MAX_COUNT}};
+
+#define APDU_RES_BATCHES (sizeof(C_resource_batches) / sizeof(resource_batch_t))
+#define APDU_RES_SIZE (APDU_RES_LIMITS_SIZE + APDU_RES_USAGE_SIZE + 1 + (APDU_RES_BATCHES * 3))
+
+/**
+ * The most items of a batch that fit in a single (chained) request, up to its own limit
+ * @param batch the command
+ */
+static uint16_t resources_batch_max(const resource_batch_t *batch)
+{
+    if (batch->item == 0)
+    {
+        return batch->limit;
+    }
+
+    const uint16_t fit = (CHAIN_MAX_SIZE - batch->header) / batch->item;
+
+    return (fit < batch->limit) ? fit : batch->limit;
+}
+
+void handle_resources(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    unsigned char resources[APDU_RES_SIZE];
+
+    unsigned char *out = resources;
+
+    // limits
+    uint16ToChar(out, WORKING_SET_SIZE);
+    uint16ToChar(out + 2, CHAIN_MAX_SIZE);
+    uint16ToChar(out + 4, IO_APDU_BUFFER_SIZE);
+    uint16ToChar(out + 6, TX_POOL_SIZE);
+    uint16ToChar(out + 8, TX_RAM_SIZE);
+    uint16ToChar(out + 10, TX_MAX_DUMP_SIZE);
+
+    out[12] = TX_SLOTS;
+    out[13] = TX_MAX_INPUTS;
+    out[14] = TX_MAX_OUTPUTS;
+    out[15] = TX_MAX_RING_SIZE;
+    out[16] = TX_EXTRA_MAX_SIZE;
+
+    out += APDU_RES_LIMITS_SIZE;
+
+    // usage
+    out[0] = (unsigned char)tx_state();
+    out[1] = tx_slot();
+
+    uint16ToChar(out + 2, tx_capacity());
+    uint16ToChar(out + 4, tx_stored_size());
+
+    debug_stack_usage(out + 6);
+
+    out += APDU_RES_USAGE_SIZE;
+
+    // batches
+    *out++ = APDU_RES_BATCHES;
+
+    for (size_t i = 0; i < APDU_RES_BATCHES; i++, out += 3)
+    {
+        const resource_batch_t *batch = (const resource_batch_t *)PIC(&C_resource_batches[i]);
+
+        out[0] = batch->ins;
+
+        uint16ToChar(out + 1, resources_batch_max(batch));
+    }
+
+    /**
+     * These are the limits of the build and how much of them is in use, which say nothing
+     * about the keys or the transaction and as thus can be returned without any additional checking
+     */
+    sendResponse(write_io_hybrid(resources, sizeof(resources), APDU_RESOURCES_NAME, true), true);
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_scan_outputs.h"
+
+#include <arena.h>
+#include <keys.h>
+#include <review.h>
+#include <transaction.h>
+#include <utils.h>
+
+typedef struct apdu_scan_outputs_set_s
+{
+    unsigned char bitmap[APDU_SO_BITMAP_SIZE]; // 8-bytes, bit i of byte i / 8 is set when output i is ours
+
+    unsigned char derivation[KEY_SIZE]; // 32-bytes, shared by the outputs of a transaction
+
+    unsigned char public_key[KEY_SIZE]; // 32-bytes
+} apdu_scan_outputs_set_t;
+
+ARENA_ASSERT_FITS(sizeof(apdu_scan_outputs_set_t), "APDU_SCAN_OUTPUTS");
+
+#define APDU_SO ARENA_LAYOUT(apdu_scan_outputs_set_t)
+
+#define APDU_SO_TX_PUBLIC_KEY APDU_DATA
+
+static unsigned int pre_approved = 0;
+
+// the length of the request, checked by the handler before it is reviewed
+static uint16_t L_scan_length = 0;
+
+static uint16_t scan_outputs()
+{
+    const unsigned char *data = APDU_DATA;
+
+    const unsigned char *end = APDU_DATA + L_scan_length;
+
+    uint8_t output = 0;
+
+    while (data < end)
+    {
+        // every output of the transaction is checked against the same derivation
+        uint16_t status = hw_generate_key_derivation_loaded(APDU_SO->derivation, data, PTR_VIEW_PRIVATE8);
+
+        if (status != OP_OK)
+        {
+            return status;
+        }
+
+        const uint8_t count = readUint8((uint8_t *)data + KEY_SIZE);
+
+        data += APDU_SO_GROUP_SIZE;
+
+        for (uint8_t i = 0; i < count; i++, output++, data += APDU_SO_OUTPUT_SIZE)
+        {
+            status = hw_derive_public_key(
+                APDU_SO->public_key, APDU_SO->derivation, readUint32BE((uint8_t *)data), PTR_SPEND_POINT);
+
+            if (status != OP_OK)
+            {
+                return status;
+            }
+
+            if (os_memcmp(APDU_SO->public_key, data + sizeof(uint32_t), KEY_SIZE) == 0)
+            {
+                APDU_SO->bitmap[output / 8] |= (1 << (output % 8));
+            }
+        }
+    }
+
+    return OP_OK;
+}
+
+static const review_t C_scan_outputs_review = {
+    {"Scan", "Outputs?"},
+    "Tx Public Key",
+    {"Scanning", "Outputs..."},
+    scan_outputs,
+    WORKING_SET,
+    APDU_SO_BITMAP_SIZE,
+    APDU_SCAN_OUTPUTS_NAME,
+    &pre_approved,
+    false};
+
+uint16_t scan_count_outputs(const uint8_t *data, const uint16_t length)
+{
+    uint16_t offset = 0;
+
+    uint16_t outputs = 0;
+
+    while (offset < length)
+    {
+        if (length - offset < APDU_SO_GROUP_SIZE)
+        {
+            return 0;
+        }
+
+        const uint8_t count = data[offset + KEY_SIZE];
+
+        offset += APDU_SO_GROUP_SIZE;
+
+        if (count == 0 || (length - offset) / (APDU_SO_OUTPUT_SIZE) < count)
+        {
+            return 0;
+        }
+
+        offset += count * (APDU_SO_OUTPUT_SIZE);
+
+        outputs += count;
+    }
+
+    return outputs;
+}
+
+void handle_scan_outputs(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    const uint16_t outputs = scan_count_outputs(dataBuffer, dataLength);
+
+    if (outputs == 0 || outputs > APDU_SO_MAX_OUTPUTS)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    L_scan_length = dataLength;
+
+    // the bitmap starts out clear as the working set is wiped before every request
+    ARENA_NEW(apdu_scan_outputs_set_t);
+
+    review_start(&C_scan_outputs_review, APDU_SO_TX_PUBLIC_KEY, p1, flags);
+}
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef APDU_SCAN_OUTPUTS_H
+#define APDU_SCAN_OUTPUTS_H
+
+#include <stdint.h>
+
+#define APDU_SCAN_OUTPUTS_NAME ((unsigned char *)"SCANOUTPUTS")
+
+#define APDU_SO_GROUP_SIZE KEY_SIZE + sizeof(uint8_t) // tx_public_key || count
+#define APDU_SO_OUTPUT_SIZE sizeof(uint32_t) + KEY_SIZE // output_index || output_key
+
+#define APDU_SO_MAX_OUTPUTS 64
+#define APDU_SO_BITMAP_SIZE APDU_SO_MAX_OUTPUTS / 8
+
+/**
+ * Walks the outputs of a request grouped by transaction, tx_public_key || count || outputs[count]
+ * with each output being output_index || output_key, to make sure that they exactly fill it
+ * @param data the request
+ * @param length the length of the request
+ * @returns the number of outputs in the request, 0 if it is malformed
+ */
+uint16_t scan_count_outputs(const uint8_t *data, const uint16_t length);
+
+void handle_scan_outputs(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
+
+#endif // APDU_SCAN_OUTPUTS_H
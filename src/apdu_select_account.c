@@ -0,0 +1,57 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_select_account.h"
+
+#include <apdu_generate_tx_ringsignatures.h>
+#include <keys.h>
+#include <batch.h>
+#include <session.h>
+#include <utils.h>
+
+#define APDU_SA_ACCOUNT readUint8(APDU_DATA)
+
+void handle_select_account(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    if (APDU_SA_ACCOUNT == selected_account())
+    {
+        return sendResponse(0, true);
+    }
+
+    const uint16_t status = select_account(APDU_SA_ACCOUNT);
+
+    if (status != OP_OK)
+    {
+        return sendError(status);
+    }
+
+    // an approval that was given for the signatures of one account does not carry over to another
+    session_end();
+
+    batch_end();
+
+    generate_tx_ring_signatures_end();
+
+    sendResponse(0, true);
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_approve_batch.h"
+
+#include <arena.h>
+#include <batch.h>
+#include <utils.h>
+
+typedef struct apdu_tx_approve_batch_set_s
+{
+    uint64_t amount; // 8-bytes
+
+    uint64_t fee; // 8-bytes
+
+    uint8_t transactions; // 1-byte
+
+    char transactions_text[4]; // 4-bytes, "255"
+
+    unsigned char amount_text[KEY_SIZE]; // 32-bytes
+
+    unsigned char fee_text[KEY_SIZE]; // 32-bytes
+} apdu_tx_approve_batch_set_t;
+
+ARENA_ASSERT_FITS(sizeof(apdu_tx_approve_batch_set_t), "APDU_TX_APPROVE_BATCH");
+
+#define APDU_TAB ARENA_LAYOUT(apdu_tx_approve_batch_set_t)
+
+#define APDU_TAB_TRANSACTIONS readUint8(APDU_DATA)
+#define APDU_TAB_AMOUNT readUint64BE(APDU_DATA + sizeof(uint8_t))
+#define APDU_TAB_FEE readUint64BE(APDU_DATA + sizeof(uint8_t) + sizeof(uint64_t))
+
+static void do_tx_approve_batch()
+{
+    batch_start(APDU_TAB->transactions, APDU_TAB->amount, APDU_TAB->fee);
+
+    sendResponse(0, true);
+}
+
+UX_STEP_NOCB(ux_tx_approve_batch_1_step, pnn, {&C_icon_turtlecoin, "Approve", "Batch?"});
+
+UX_STEP_NOCB(ux_tx_approve_batch_2_step, bnnn_paging, {.title = "Transactions", .text = APDU_TAB->transactions_text});
+
+UX_STEP_NOCB(
+    ux_tx_approve_batch_3_step,
+    bnnn_paging,
+    {.title = "Total to Spend", .text = (char *)APDU_TAB->amount_text});
+
+UX_STEP_NOCB(
+    ux_tx_approve_batch_4_step,
+    bnnn_paging,
+    {.title = "Total Network Fee", .text = (char *)APDU_TAB->fee_text});
+
+UX_STEP_VALID(ux_tx_approve_batch_5_step, pb, do_tx_approve_batch(), {&C_icon_validate_14, "Approve"});
+
+UX_STEP_VALID(ux_tx_approve_batch_6_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
+
+UX_FLOW(
+    ux_tx_approve_batch_flow,
+    &ux_tx_approve_batch_1_step,
+    &ux_tx_approve_batch_2_step,
+    &ux_tx_approve_batch_3_step,
+    &ux_tx_approve_batch_4_step,
+    &ux_tx_approve_batch_5_step,
+    &ux_tx_approve_batch_6_step);
+
+void handle_tx_approve_batch(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    // a new request always replaces the batch that is running, even if it is turned down
+    batch_end();
+
+    // no transactions at all only ends the batch
+    if (APDU_TAB_TRANSACTIONS == 0)
+    {
+        return sendResponse(0, true);
+    }
+
+    apdu_tx_approve_batch_set_t *set = ARENA_NEW(apdu_tx_approve_batch_set_t);
+
+    set->transactions = APDU_TAB_TRANSACTIONS;
+
+    set->amount = APDU_TAB_AMOUNT;
+
+    set->fee = APDU_TAB_FEE;
+
+    if (p1 != P1_CONFIRM)
+    {
+        do_tx_approve_batch();
+
+        *flags |= IO_ASYNCH_REPLY;
+
+        return;
+    }
+
+    SPRINTF(set->transactions_text, "%d", set->transactions);
+
+    {
+        unsigned int offset = amountToString(set->amount_text, set->amount, KEY_SIZE);
+
+        // copy the ticker on to the end of the amount
+        os_memmove(set->amount_text + offset - 1, TICKER, TICKER_SIZE);
+    }
+
+    {
+        unsigned int offset = amountToString(set->fee_text, set->fee, KEY_SIZE);
+
+        // copy the ticker on to the end of the amount
+        os_memmove(set->fee_text + offset - 1, TICKER, TICKER_SIZE);
+    }
+
+    ux_flow_init(0, ux_tx_approve_batch_flow, NULL);
+
+    *flags |= IO_ASYNCH_REPLY;
+}
\ No newline at end of file
@@ -24,7 +24,16 @@
 #define APDU_TXD_START_OFFSET_INDEX WORKING_SET
 #define APDU_TXD_START_OFFSET readUint16BE(APDU_TXD_START_OFFSET_INDEX)
 
-#define APDU_TXD_RESPONSE WORKING_SET
+// P1 is kept just past the start offset
+#define APDU_TXD_MODE_IDX APDU_TXD_START_OFFSET_INDEX + sizeof(uint16_t)
+#define APDU_TXD_MODE readUint8(APDU_TXD_MODE_IDX)
+
+// the transaction is copied out of NVRAM straight into the response, the mode and offset are read before that
+#define APDU_TXD_RESPONSE IO_RESPONSE
+
+#define APDU_TXD_PREFIX_HASH IO_RESPONSE
+#define APDU_TXD_PREFIX_END_OFFSET APDU_TXD_PREFIX_HASH + KEY_SIZE
+#define APDU_TXD_PREFIX_RESPONSE_SIZE KEY_SIZE + sizeof(uint16_t)
 
 static void do_tx_dump()
 {
@@ -32,19 +41,45 @@ static void do_tx_dump()
     {
         TRY
         {
-            if (APDU_TXD_START_OFFSET > tx_size())
+            if (APDU_TXD_MODE == APDU_TX_DUMP_P1_PREFIX_HASH)
+            {
+                // the host built the prefix itself so this is all it needs to check that we agree
+                const uint16_t status = tx_prefix_hash(APDU_TXD_PREFIX_HASH);
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+
+                uint16ToChar(APDU_TXD_PREFIX_END_OFFSET, tx_prefix_size());
+
+                CLOSE_TRY;
+
+                sendResponse(
+                    write_io_hybrid(APDU_TXD_RESPONSE, APDU_TXD_PREFIX_RESPONSE_SIZE, APDU_TX_DUMP_NAME, true),
+                    true);
+
+                return;
+            }
+
+            // the signatures section starts where the prefix ends
+            const uint16_t start_offset =
+                APDU_TXD_START_OFFSET + ((APDU_TXD_MODE == APDU_TX_DUMP_P1_SIGNATURES) ? tx_prefix_size() : 0);
+
+            // only the prefix is stored if the signatures were streamed to the host
+            if (start_offset > tx_stored_size() || start_offset < APDU_TXD_START_OFFSET)
             {
                 THROW(ERR_OUT_OF_RANGE);
             }
 
-            uint16_t length = tx_size() - APDU_TXD_START_OFFSET;
+            uint16_t length = tx_stored_size() - start_offset;
 
             if (length > TX_MAX_DUMP_SIZE)
             {
                 length = TX_MAX_DUMP_SIZE;
             }
 
-            const uint16_t status = tx_dump(APDU_TXD_RESPONSE, APDU_TXD_START_OFFSET, length);
+            const uint16_t status = tx_dump(APDU_TXD_RESPONSE, start_offset, length);
 
             if (status != OP_OK)
             {
@@ -64,10 +99,6 @@ static void do_tx_dump()
     END_TRY;
 }
 
-UX_STEP_SPLASH(ux_tx_dump_1_step, pnn, do_tx_dump(), {&C_icon_turtlecoin, "Dumping", "Transaction..."});
-
-UX_FLOW(ux_tx_dump_flow, &ux_tx_dump_1_step);
-
 void handle_tx_dump(
     uint8_t p1,
     uint8_t p2,
@@ -76,15 +107,13 @@ void handle_tx_dump(
     volatile unsigned int *flags,
     volatile unsigned int *tx)
 {
-    UNUSED(p1);
-
     UNUSED(p2);
 
-    if (tx_state() != TX_COMPLETE)
+    if (p1 != APDU_TX_DUMP_P1_RAW && p1 != APDU_TX_DUMP_P1_SIGNATURES && p1 != APDU_TX_DUMP_P1_PREFIX_HASH)
     {
-        return sendError(ERR_TRANSACTION_STATE);
+        return sendError(ERR_OP_NOT_PERMITTED);
     }
-    else if (dataLength != APDU_TXD_SIZE)
+    else if (dataLength != APDU_TXD_SIZE && !(p1 == APDU_TX_DUMP_P1_PREFIX_HASH && dataLength == 0))
     {
         return sendError(ERR_WRONG_INPUT_LENGTH);
     }
@@ -92,7 +121,7 @@ void handle_tx_dump(
     // copy the data buffer into the working set
     os_memmove(WORKING_SET, dataBuffer, dataLength);
 
-    ux_flow_init(0, ux_tx_dump_flow, NULL);
+    *(APDU_TXD_MODE_IDX) = p1;
 
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_tx_dump);
 }
\ No newline at end of file
@@ -21,6 +21,10 @@
 
 #define APDU_TX_DUMP_NAME ((unsigned char *)"TX_DUMP")
 
+#define APDU_TX_DUMP_P1_RAW 0x00
+#define APDU_TX_DUMP_P1_SIGNATURES 0x01
+#define APDU_TX_DUMP_P1_PREFIX_HASH 0x02
+
 void handle_tx_dump(
     uint8_t p1,
     uint8_t p2,
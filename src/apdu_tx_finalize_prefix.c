@@ -45,22 +45,13 @@ static void do_tx_finalize_prefix()
     END_TRY;
 }
 
-UX_STEP_SPLASH(
-    ux_tx_finalize_prefix_1_step,
-    pnn,
-    do_tx_finalize_prefix(),
-    {&C_icon_turtlecoin, "Finalizing", "Tx Prefix..."});
-
-UX_FLOW(ux_tx_finalize_prefix_flow, &ux_tx_finalize_prefix_1_step);
-
-void handle_tx_finalize_prefix(volatile unsigned int *flags)
+void handle_tx_finalize_prefix(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
-    if (tx_state() != TX_OUTPUTS_RECEIVED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-
-    ux_flow_init(0, ux_tx_finalize_prefix_flow, NULL);
-
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_tx_finalize_prefix);
 }
\ No newline at end of file
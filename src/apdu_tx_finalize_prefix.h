@@ -17,6 +17,12 @@
 #ifndef APDU_TX_FINALIZE_PREFIX_H
 #define APDU_TX_FINALIZE_PREFIX_H
 
-void handle_tx_finalize_prefix(volatile unsigned int *flags);
+void handle_tx_finalize_prefix(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_TX_FINALIZE_PREFIX_H
@@ -19,24 +19,145 @@
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_TX_LOAD_INPUT_SIZE                                                    \
-    KEY_SIZE + sizeof(uint8_t) + sizeof(uint64_t) + (KEY_SIZE * RING_PARTICIPANTS) \
-        + (sizeof(uint32_t) * RING_PARTICIPANTS) + sizeof(uint8_t)
+#define APDU_TX_LOAD_INPUT_SIZE                                                   \
+    (KEY_SIZE + sizeof(uint8_t) + sizeof(uint64_t) + (KEY_SIZE * tx_ring_size()) \
+     + (sizeof(uint32_t) * tx_ring_size()) + sizeof(uint8_t))
 
-#define APDU_TLI_TX_PUBLIC_KEY WORKING_SET
+// the number of inputs in the payload and the format they come in, they follow one after the other
+#define APDU_TLI_COUNT_IDX WORKING_SET
+#define APDU_TLI_COUNT readUint8(APDU_TLI_COUNT_IDX)
 
-#define APDU_TLI_OUTPUT_INDEX_IDX APDU_TLI_TX_PUBLIC_KEY + KEY_SIZE
-#define APDU_TLI_OUTPUT_INDEX readUint8(APDU_TLI_OUTPUT_INDEX_IDX)
+#define APDU_TLI_FORMAT_IDX APDU_TLI_COUNT_IDX + sizeof(uint8_t)
+#define APDU_TLI_FORMAT readUint8(APDU_TLI_FORMAT_IDX)
 
-#define APDU_TLI_AMOUNT_IDX APDU_TLI_OUTPUT_INDEX_IDX + sizeof(uint8_t)
-#define APDU_TLI_AMOUNT readUint64BE(APDU_TLI_AMOUNT_IDX)
+#define APDU_TLI_INPUTS APDU_TLI_FORMAT_IDX + sizeof(uint8_t)
+#define APDU_TLI_INPUT(index) (APDU_TLI_INPUTS + ((index)*APDU_TX_LOAD_INPUT_SIZE))
 
-#define APDU_TLI_PUBLIC_KEYS APDU_TLI_AMOUNT_IDX + sizeof(uint64_t)
+#define APDU_TLI_MAX_SIZE (WORKING_SET_SIZE - sizeof(uint8_t) - sizeof(uint8_t))
+#define APDU_TLI_MAX_COUNT (APDU_TLI_MAX_SIZE / (APDU_TX_LOAD_INPUT_SIZE))
 
-#define APDU_TLI_OFFSETS_IDX APDU_TLI_PUBLIC_KEYS + (KEY_SIZE * RING_PARTICIPANTS)
+#define APDU_TLI_TX_PUBLIC_KEY(input) (input)
 
-#define APDU_TLI_REAL_OUTPUT_INDEX_IDX APDU_TLI_OFFSETS_IDX + (sizeof(uint32_t) * RING_PARTICIPANTS)
-#define APDU_TLI_REAL_OUTPUT_INDEX readUint8(APDU_TLI_REAL_OUTPUT_INDEX_IDX)
+#define APDU_TLI_OUTPUT_INDEX_IDX(input) APDU_TLI_TX_PUBLIC_KEY(input) + KEY_SIZE
+#define APDU_TLI_OUTPUT_INDEX(input) readUint8(APDU_TLI_OUTPUT_INDEX_IDX(input))
+
+#define APDU_TLI_AMOUNT_IDX(input) APDU_TLI_OUTPUT_INDEX_IDX(input) + sizeof(uint8_t)
+#define APDU_TLI_AMOUNT(input) readUint64BE(APDU_TLI_AMOUNT_IDX(input))
+
+#define APDU_TLI_PUBLIC_KEYS(input) APDU_TLI_AMOUNT_IDX(input) + sizeof(uint64_t)
+
+#define APDU_TLI_OFFSETS_IDX(input) APDU_TLI_PUBLIC_KEYS(input) + (KEY_SIZE * tx_ring_size())
+
+#define APDU_TLI_REAL_OUTPUT_INDEX_IDX(input) APDU_TLI_OFFSETS_IDX(input) + (sizeof(uint32_t) * tx_ring_size())
+#define APDU_TLI_REAL_OUTPUT_INDEX(input) readUint8(APDU_TLI_REAL_OUTPUT_INDEX_IDX(input))
+
+/**
+ * The sealed inputs are returned in place of the inputs that were already loaded, which only works
+ * out for several inputs at once if none of them is ever larger than the input it is returned for
+ */
+#define APDU_TLI_SEALED_INPUT(index) (APDU_TLI_INPUTS + ((index)*TX_SEALED_INPUT_SIZE))
+#define APDU_TLI_SEALS_IN_PLACE (TX_SEALED_INPUT_SIZE <= APDU_TX_LOAD_INPUT_SIZE)
+
+/**
+ * A compact input: flags || [ tx_public_key ] || output_index || varint amount || public_keys ||
+ * varint offsets || real_output_index, the tx_public_key is left out when the flags say that it is
+ * the same as that of the input in front of it
+ */
+typedef struct
+{
+    uint8_t flags;
+    const unsigned char *tx_public_key; // NULL when left out
+    uint8_t output_index;
+    uint64_t amount;
+    const unsigned char *public_keys;
+    const unsigned char *offsets;
+    uint8_t offsets_length;
+    uint8_t real_output_index;
+} compact_input_t;
+
+/**
+ * Finds the fields of the compact input at the front of the payload, the varints of the offsets are
+ * only delimited here and checked by tx_load_encoded_input
+ * @returns the size of the input, or 0 if the payload does not hold a whole input
+ */
+static uint16_t read_compact_input(const unsigned char *data, const uint16_t length, compact_input_t *input)
+{
+    uint16_t pos = 0;
+
+    if (length < sizeof(uint8_t))
+    {
+        return 0;
+    }
+
+    input->flags = data[pos++];
+
+    input->tx_public_key = NULL;
+
+    if (!(input->flags & APDU_TX_INPUT_LOAD_SAME_TX_KEY))
+    {
+        if (length - pos < KEY_SIZE)
+        {
+            return 0;
+        }
+
+        input->tx_public_key = data + pos;
+
+        pos += KEY_SIZE;
+    }
+
+    if (length - pos < sizeof(uint8_t))
+    {
+        return 0;
+    }
+
+    input->output_index = data[pos++];
+
+    const unsigned int amount_size = decode_canonical_varint(data + pos, length - pos, &input->amount);
+
+    if (amount_size == 0 || length - pos - amount_size < KEY_SIZE * tx_ring_size())
+    {
+        return 0;
+    }
+
+    pos += amount_size;
+
+    input->public_keys = data + pos;
+
+    pos += KEY_SIZE * tx_ring_size();
+
+    input->offsets = data + pos;
+
+    uint8_t i;
+    for (i = 0; i < tx_ring_size(); i++)
+    {
+        uint8_t size = 1;
+
+        while (pos < length && (data[pos] & 0x80) && size < 10)
+        {
+            pos++;
+
+            size++;
+        }
+
+        if (pos == length)
+        {
+            return 0;
+        }
+
+        pos++;
+    }
+
+    input->offsets_length = (uint8_t)(data + pos - input->offsets);
+
+    if (length - pos < sizeof(uint8_t))
+    {
+        return 0;
+    }
+
+    input->real_output_index = data[pos++];
+
+    return pos;
+}
 
 static void do_tx_input_load()
 {
@@ -44,34 +165,96 @@ static void do_tx_input_load()
     {
         TRY
         {
-            uint32_t offsets[RING_PARTICIPANTS];
+            uint32_t offsets[TX_MAX_RING_SIZE];
 
-            int i;
+            unsigned char sealed_input[TX_SEALED_INPUT_SIZE];
 
-            for (i = 0; i < RING_PARTICIPANTS; i++)
-            {
-                offsets[i] = readUint32BE(APDU_TLI_OFFSETS_IDX + (i * sizeof(uint32_t)));
-            }
+            // a sealed input may be returned over the input that the next one takes its key from
+            unsigned char tx_public_key[KEY_SIZE];
+
+            compact_input_t compact;
+
+            const uint8_t count = APDU_TLI_COUNT;
+
+            const bool is_compact = (APDU_TLI_FORMAT == APDU_TX_INPUT_LOAD_P2_COMPACT);
+
+            const unsigned char *next = APDU_TLI_INPUTS;
 
-            const uint16_t status = tx_load_input(
-                APDU_TLI_TX_PUBLIC_KEY,
-                APDU_TLI_OUTPUT_INDEX,
-                APDU_TLI_AMOUNT,
-                APDU_TLI_PUBLIC_KEYS,
-                offsets,
-                APDU_TLI_REAL_OUTPUT_INDEX);
+            const unsigned char *end = APDU_TLI_INPUTS + APDU_TLI_MAX_SIZE;
 
-            if (status != OP_OK)
+            uint8_t index;
+
+            // the inputs in front of one that fails stay loaded
+            for (index = 0; index < count; index++)
             {
-                THROW(status);
+                uint16_t status;
+
+                if (is_compact)
+                {
+                    // the handler made sure that every input is whole
+                    next += read_compact_input(next, end - next, &compact);
+
+                    if (compact.tx_public_key != NULL)
+                    {
+                        os_memmove(tx_public_key, compact.tx_public_key, sizeof(tx_public_key));
+                    }
+
+                    status = tx_load_encoded_input(
+                        tx_public_key,
+                        compact.output_index,
+                        compact.amount,
+                        compact.public_keys,
+                        compact.offsets,
+                        compact.offsets_length,
+                        compact.real_output_index,
+                        sealed_input);
+                }
+                else
+                {
+                    unsigned char *input = APDU_TLI_INPUT(index);
+
+                    int i;
+
+                    for (i = 0; i < tx_ring_size(); i++)
+                    {
+                        offsets[i] = readUint32BE(APDU_TLI_OFFSETS_IDX(input) + (i * sizeof(uint32_t)));
+                    }
+
+                    status = tx_load_input(
+                        APDU_TLI_TX_PUBLIC_KEY(input),
+                        APDU_TLI_OUTPUT_INDEX(input),
+                        APDU_TLI_AMOUNT(input),
+                        APDU_TLI_PUBLIC_KEYS(input),
+                        offsets,
+                        APDU_TLI_REAL_OUTPUT_INDEX(input),
+                        sealed_input);
+                }
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+
+                if (tx_seals_inputs())
+                {
+                    os_memmove(APDU_TLI_SEALED_INPUT(index), sealed_input, sizeof(sealed_input));
+                }
             }
 
+            explicit_bzero(sealed_input, sizeof(sealed_input));
+
+            // the host holds on to the sealed inputs until they are signed
+            const size_t length = (tx_seals_inputs()) ? count * TX_SEALED_INPUT_SIZE : 0;
+
             CLOSE_TRY;
 
-            sendResponse(0, true);
+            sendResponse(write_io_hybrid(APDU_TLI_SEALED_INPUT(0), length, APDU_TX_INPUT_LOAD_NAME, true), true);
         }
         CATCH_OTHER(e)
         {
+            // an exception may have unwound out of the precomputation with the DRBG still running
+            hw_nonce_drbg_pause();
+
             sendError(e);
         }
         FINALLY {}
@@ -79,10 +262,6 @@ static void do_tx_input_load()
     END_TRY;
 }
 
-UX_STEP_SPLASH(ux_tx_input_load_1_step, pnn, do_tx_input_load(), {&C_icon_turtlecoin, "Loading Tx", "Input..."});
-
-UX_FLOW(ux_tx_input_load_flow, &ux_tx_input_load_1_step);
-
 void handle_tx_input_load(
     uint8_t p1,
     uint8_t p2,
@@ -91,21 +270,72 @@ void handle_tx_input_load(
     volatile unsigned int *flags,
     volatile unsigned int *tx)
 {
-    UNUSED(p2);
+    // the first input starts the input load by itself if the transaction advances on its own
+    const bool starts_load = (tx_state() == TX_READY && tx_auto_advances());
 
-    if (tx_state() != TX_RECEIVING_INPUTS)
+    if (tx_state() != TX_RECEIVING_INPUTS && !starts_load)
     {
         return sendError(ERR_TRANSACTION_STATE);
     }
-    else if (dataLength != APDU_TX_LOAD_INPUT_SIZE)
+
+    uint16_t count = 0;
+
+    if (p2 == APDU_TX_INPUT_LOAD_P2_COMPACT)
+    {
+        if (dataLength == 0 || dataLength > APDU_TLI_MAX_SIZE)
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
+
+        compact_input_t compact;
+
+        uint16_t pos = 0;
+
+        while (pos < dataLength)
+        {
+            const uint16_t size = read_compact_input(dataBuffer + pos, dataLength - pos, &compact);
+
+            if (size == 0 || count == UINT8_MAX)
+            {
+                return sendError(ERR_WRONG_INPUT_LENGTH);
+            }
+
+            // only the inputs of the same payload can share a key
+            if (count == 0 && compact.tx_public_key == NULL)
+            {
+                return sendError(ERR_TX_LOAD_INPUT);
+            }
+
+            pos += size;
+
+            count++;
+
+            // sealed inputs are returned in place, so they may never run ahead of the inputs they replace
+            if (tx_seals_inputs() && count * TX_SEALED_INPUT_SIZE > pos)
+            {
+                return sendError(ERR_WRONG_INPUT_LENGTH);
+            }
+        }
+    }
+    else
     {
-        return sendError(ERR_WRONG_INPUT_LENGTH);
+        // as many inputs as fit in the working set can be loaded at once
+        count = dataLength / (APDU_TX_LOAD_INPUT_SIZE);
+
+        const uint16_t max_count = (tx_seals_inputs() && !APDU_TLI_SEALS_IN_PLACE) ? 1 : APDU_TLI_MAX_COUNT;
+
+        if (count == 0 || count > max_count || dataLength != count * (APDU_TX_LOAD_INPUT_SIZE))
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
     }
 
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
+    *(APDU_TLI_COUNT_IDX) = (uint8_t)count;
+
+    *(APDU_TLI_FORMAT_IDX) = (p2 == APDU_TX_INPUT_LOAD_P2_COMPACT) ? p2 : APDU_TX_INPUT_LOAD_P2_FIXED;
 
-    ux_flow_init(0, ux_tx_input_load_flow, NULL);
+    // copy the data buffer into the working set
+    os_memmove(APDU_TLI_INPUTS, dataBuffer, dataLength);
 
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_tx_input_load);
 }
\ No newline at end of file
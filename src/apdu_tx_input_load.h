@@ -19,6 +19,14 @@
 
 #include <stdint.h>
 
+#define APDU_TX_INPUT_LOAD_NAME ((unsigned char *)"TX_INPUT_LOAD")
+
+#define APDU_TX_INPUT_LOAD_P2_FIXED 0x00
+#define APDU_TX_INPUT_LOAD_P2_COMPACT 0x02
+
+// the flags that lead a compact input
+#define APDU_TX_INPUT_LOAD_SAME_TX_KEY 0x01
+
 void handle_tx_input_load(
     uint8_t p1,
     uint8_t p2,
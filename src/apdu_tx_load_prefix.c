@@ -0,0 +1,90 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_load_prefix.h"
+
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_TLP_LENGTH_IDX WORKING_SET
+#define APDU_TLP_LENGTH readUint16BE(APDU_TLP_LENGTH_IDX)
+
+#define APDU_TLP_CHUNK APDU_TLP_LENGTH_IDX + sizeof(uint16_t)
+
+static void do_tx_load_prefix()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            unsigned char response[sizeof(uint8_t) + sizeof(uint8_t) + TX_SEALED_INPUT_SIZE];
+
+            const uint8_t received_input_count = tx_received_input_count();
+
+            const uint16_t status = tx_load_prefix(APDU_TLP_CHUNK, APDU_TLP_LENGTH, response + 2);
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            response[0] = tx_received_input_count();
+
+            response[1] = tx_received_output_count();
+
+            // the host holds on to the sealed input until it is signed
+            const bool sealed = tx_seals_inputs() && response[0] != received_input_count;
+
+            const size_t length = (sealed) ? sizeof(response) : 2;
+
+            CLOSE_TRY;
+
+            sendResponse(write_io_hybrid(response, length, APDU_TX_LOAD_PREFIX_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            // an exception may have unwound out of the precomputation with the DRBG still running
+            hw_nonce_drbg_pause();
+
+            sendError(e);
+        }
+        FINALLY {}
+    }
+    END_TRY;
+}
+
+void handle_tx_load_prefix(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    if (dataLength == 0 || dataLength > WORKING_SET_SIZE - sizeof(uint16_t))
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+
+    *(APDU_TLP_LENGTH_IDX) = (uint8_t)(dataLength >> 8);
+
+    *(APDU_TLP_LENGTH_IDX + 1) = (uint8_t)dataLength;
+
+    // copy the data buffer into the working set
+    os_memmove(APDU_TLP_CHUNK, dataBuffer, dataLength);
+
+    run_silent(do_tx_load_prefix);
+}
\ No newline at end of file
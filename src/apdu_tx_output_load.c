@@ -21,10 +21,19 @@
 
 #define APDU_TX_LOAD_OUTPUT_SIZE sizeof(uint64_t) + KEY_SIZE
 
-#define APDU_TLO_AMOUNT_IDX WORKING_SET
-#define APDU_TLO_AMOUNT readUint64BE(APDU_TLO_AMOUNT_IDX)
+// the number of outputs in the payload, they follow one after the other
+#define APDU_TLO_COUNT_IDX WORKING_SET
+#define APDU_TLO_COUNT readUint8(APDU_TLO_COUNT_IDX)
 
-#define APDU_TLO_KEY APDU_TLO_AMOUNT_IDX + sizeof(uint64_t)
+#define APDU_TLO_OUTPUTS APDU_TLO_COUNT_IDX + sizeof(uint8_t)
+#define APDU_TLO_OUTPUT(index) (APDU_TLO_OUTPUTS + ((index)*APDU_TX_LOAD_OUTPUT_SIZE))
+
+#define APDU_TLO_AMOUNT(output) readUint64BE(output)
+
+#define APDU_TLO_KEY(output) (output) + sizeof(uint64_t)
+
+// the keys are gathered one after the other in front of the outputs as their amounts are read
+#define APDU_TLO_KEYS APDU_TLO_OUTPUTS
 
 static void do_tx_output_load()
 {
@@ -32,7 +41,22 @@ static void do_tx_output_load()
     {
         TRY
         {
-            const uint16_t status = tx_load_output(APDU_TLO_AMOUNT, APDU_TLO_KEY);
+            uint64_t amounts[APDU_TX_LOAD_OUTPUT_MAX_COUNT];
+
+            const uint8_t count = APDU_TLO_COUNT;
+
+            uint8_t i;
+
+            for (i = 0; i < count; i++)
+            {
+                unsigned char *output = APDU_TLO_OUTPUT(i);
+
+                amounts[i] = APDU_TLO_AMOUNT(output);
+
+                os_memmove(APDU_TLO_KEYS + (i * KEY_SIZE), APDU_TLO_KEY(output), KEY_SIZE);
+            }
+
+            const uint16_t status = tx_load_outputs(count, amounts, APDU_TLO_KEYS);
 
             if (status != OP_OK)
             {
@@ -52,10 +76,6 @@ static void do_tx_output_load()
     END_TRY;
 }
 
-UX_STEP_SPLASH(ux_tx_output_load_1_step, pnn, do_tx_output_load(), {&C_icon_turtlecoin, "Loading Tx", "Output..."});
-
-UX_FLOW(ux_tx_output_load_flow, &ux_tx_output_load_1_step);
-
 void handle_tx_output_load(
     uint8_t p1,
     uint8_t p2,
@@ -66,19 +86,25 @@ void handle_tx_output_load(
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_RECEIVING_OUTPUTS)
+    // the first output starts the output load by itself if the transaction advances on its own
+    const bool starts_load = (tx_state() == TX_INPUTS_RECEIVED && tx_auto_advances());
+
+    if (tx_state() != TX_RECEIVING_OUTPUTS && !starts_load)
     {
         return sendError(ERR_TRANSACTION_STATE);
     }
-    else if (dataLength != APDU_TX_LOAD_OUTPUT_SIZE)
+
+    const uint16_t count = dataLength / (APDU_TX_LOAD_OUTPUT_SIZE);
+
+    if (count == 0 || count > APDU_TX_LOAD_OUTPUT_MAX_COUNT || dataLength != count * (APDU_TX_LOAD_OUTPUT_SIZE))
     {
         return sendError(ERR_WRONG_INPUT_LENGTH);
     }
 
-    // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
+    *(APDU_TLO_COUNT_IDX) = (uint8_t)count;
 
-    ux_flow_init(0, ux_tx_output_load_flow, NULL);
+    // copy the data buffer into the working set
+    os_memmove(APDU_TLO_OUTPUTS, dataBuffer, dataLength);
 
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_tx_output_load);
 }
\ No newline at end of file
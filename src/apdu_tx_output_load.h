@@ -19,6 +19,8 @@
 
 #include <stdint.h>
 
+#define APDU_TX_LOAD_OUTPUT_MAX_COUNT 10
+
 void handle_tx_output_load(
     uint8_t p1,
     uint8_t p2,
@@ -0,0 +1,76 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_preflight.h"
+
+#include <apdu_tx_start.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_TXP_RESPONSE_SIZE 3 + sizeof(uint32_t) + sizeof(uint32_t)
+
+void handle_tx_preflight(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    // the ring size and the sealing of the inputs arrive in P2 as they do for APDU_TX_START
+    uint8_t ring_size = p2 & APDU_TX_START_P2_RING_SIZE;
+
+    if (ring_size == 0)
+    {
+        ring_size = RING_PARTICIPANTS;
+    }
+
+    if (ring_size > TX_MAX_RING_SIZE)
+    {
+        return sendError(ERR_TX_RING_SIZE);
+    }
+
+    const uint8_t seal_inputs = ((p2 & APDU_TX_START_P2_SEAL_INPUTS) != 0) ? 1 : 0;
+
+    const uint8_t offset_size = (dataBuffer[2] == 0) ? TX_OFFSET_MAX_SIZE : dataBuffer[2];
+
+    if (offset_size > TX_OFFSET_MAX_SIZE)
+    {
+        return sendError(ERR_TX_OFFSET_SIZE);
+    }
+
+    tx_footprint_t footprint;
+
+    tx_footprint(&footprint, dataBuffer[0], dataBuffer[1], ring_size, offset_size, seal_inputs);
+
+    unsigned char response[APDU_TXP_RESPONSE_SIZE];
+
+    response[0] = footprint.fits;
+
+    response[1] = footprint.in_ram;
+
+    response[2] = footprint.max_inputs;
+
+    uint32ToChar(response + 3, footprint.pool_size);
+
+    uint32ToChar(response + 3 + sizeof(uint32_t), TX_POOL_SIZE);
+
+    /**
+     * This is arithmetic on what the host sent along with the limits of the build, it does not
+     * touch the transaction under way and as thus can be returned without any additional checking
+     */
+    sendResponse(write_io_hybrid(response, sizeof(response), APDU_TX_PREFLIGHT_NAME, true), true);
+}
\ No newline at end of file
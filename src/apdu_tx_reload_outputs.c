@@ -0,0 +1,57 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_reload_outputs.h"
+
+#include <transaction.h>
+#include <utils.h>
+
+static void do_tx_reload_outputs()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const int status = tx_reload_outputs();
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            CLOSE_TRY;
+
+            sendResponse(0, true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY {}
+    }
+    END_TRY;
+}
+
+void handle_tx_reload_outputs(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    run_silent(do_tx_reload_outputs);
+}
\ No newline at end of file
@@ -16,6 +16,9 @@
 
 #include "apdu_tx_reset.h"
 
+#include <apdu_generate_tx_ringsignatures.h>
+#include <batch.h>
+#include <session.h>
 #include <transaction.h>
 #include <utils.h>
 
@@ -49,10 +52,22 @@ UX_STEP_SPLASH(ux_tx_reset_1_step, pnn, do_tx_reset(), {&C_icon_turtlecoin, "Cle
 
 UX_FLOW(ux_tx_reset_flow, &ux_tx_reset_1_step);
 
-void handle_tx_reset(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx)
+void handle_tx_reset(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     UNUSED(p2);
 
+    session_end();
+
+    batch_end();
+
+    generate_tx_ring_signatures_end();
+
     // if we are not currently in a transaction construction state then we can return quickly
     if (tx_state() == TX_UNUSED)
     {
@@ -0,0 +1,65 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_resume.h"
+
+#include <transaction.h>
+#include <utils.h>
+
+static void do_tx_resume()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const uint16_t status = tx_resume();
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            unsigned char progress[3] = {tx_state(), tx_received_input_count(), tx_received_output_count()};
+
+            CLOSE_TRY;
+
+            sendResponse(write_io_hybrid(progress, sizeof(progress), APDU_TX_RESUME_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY {}
+    }
+    END_TRY;
+}
+
+UX_STEP_SPLASH(ux_tx_resume_1_step, pnn, do_tx_resume(), {&C_icon_turtlecoin, "Resuming", "Tx State..."});
+
+UX_FLOW(ux_tx_resume_flow, &ux_tx_resume_1_step);
+
+void handle_tx_resume(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    ux_flow_init(0, ux_tx_resume_flow, NULL);
+
+    *flags |= IO_ASYNCH_REPLY;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_select_slot.h"
+
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_TSS_SLOT_IDX WORKING_SET
+#define APDU_TSS_SLOT readUint8(APDU_TSS_SLOT_IDX)
+
+static void do_tx_select_slot()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const uint16_t status = tx_select_slot(APDU_TSS_SLOT);
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            unsigned char progress[4] = {tx_slot(), tx_state(), tx_received_input_count(), tx_received_output_count()};
+
+            CLOSE_TRY;
+
+            sendResponse(write_io_hybrid(progress, sizeof(progress), APDU_TX_SELECT_SLOT_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY {}
+    }
+    END_TRY;
+}
+
+UX_STEP_SPLASH(ux_tx_select_slot_1_step, pnn, do_tx_select_slot(), {&C_icon_turtlecoin, "Switching", "Tx Slot..."});
+
+UX_FLOW(ux_tx_select_slot_flow, &ux_tx_select_slot_1_step);
+
+void handle_tx_select_slot(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    if (p1 >= TX_SLOTS)
+    {
+        return sendError(ERR_TX_SLOT);
+    }
+
+    *(APDU_TSS_SLOT_IDX) = p1;
+
+    ux_flow_init(0, ux_tx_select_slot_flow, NULL);
+
+    *flags |= IO_ASYNCH_REPLY;
+}
\ No newline at end of file
@@ -16,15 +16,29 @@
 
 #include "apdu_tx_sign.h"
 
+#include <arena.h>
+#include <batch.h>
 #include <transaction.h>
 #include <utils.h>
 
-#define APDU_TSIGN_HASH WORKING_SET
-#define APDU_TSIGN_END_OFFSET APDU_TSIGN_HASH + KEY_SIZE
-#define APDU_TSIGN_AMOUNT APDU_TSIGN_END_OFFSET + sizeof(uint16_t)
-#define APDU_TSIGN_FEE APDU_TSIGN_AMOUNT + KEY_SIZE // give the amount plenty of room to breath
+typedef struct apdu_tx_sign_set_s
+{
+    unsigned char hash[KEY_SIZE]; // 32-bytes
+
+    unsigned char end_offset[sizeof(uint16_t)]; // 2-bytes, follows the hash in the response
+
+    unsigned char amount[TX_REVIEW_TEXT_SIZE]; // 32-bytes, give the amount plenty of room to breath
+
+    unsigned char fee[TX_REVIEW_TEXT_SIZE]; // 32-bytes
 
-#define APDU_TSIGN_RESPONSE APDU_TSIGN_HASH
+    uint8_t mode; // 1-byte, P2 of the approved request
+} apdu_tx_sign_set_t;
+
+ARENA_ASSERT_FITS(sizeof(apdu_tx_sign_set_t), "APDU_TX_SIGN");
+
+#define APDU_TSIGN ARENA_LAYOUT(apdu_tx_sign_set_t)
+
+#define APDU_TSIGN_RESPONSE APDU_TSIGN->hash
 #define APDU_TSIGN_RESPONSE_SIZE KEY_SIZE + sizeof(uint16_t)
 
 static void do_tx_sign()
@@ -33,6 +47,22 @@ static void do_tx_sign()
     {
         TRY
         {
+            if (APDU_TSIGN->mode != APDU_TX_SIGN_P2_ALL)
+            {
+                const uint16_t status = tx_sign_begin(APDU_TSIGN->mode == APDU_TX_SIGN_P2_STREAM);
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+
+                CLOSE_TRY;
+
+                sendResponse(0, true);
+
+                return;
+            }
+
             uint16_t status = tx_sign();
 
             if (status != OP_OK)
@@ -40,14 +70,14 @@ static void do_tx_sign()
                 THROW(status);
             }
 
-            status = tx_hash(APDU_TSIGN_HASH);
+            status = tx_hash(APDU_TSIGN->hash);
 
             if (status != OP_OK)
             {
                 THROW(status);
             }
 
-            uint16ToChar(APDU_TSIGN_END_OFFSET, tx_size());
+            uint16ToChar(APDU_TSIGN->end_offset, tx_size());
 
             CLOSE_TRY;
 
@@ -55,6 +85,9 @@ static void do_tx_sign()
         }
         CATCH_OTHER(e)
         {
+            // an exception may have unwound out of the signing loop with the DRBG still running
+            hw_nonce_drbg_pause();
+
             sendError(e);
         }
         FINALLY {}
@@ -62,19 +95,27 @@ static void do_tx_sign()
     END_TRY;
 }
 
+// the inputs that were signed during the review are taken back along with the rest of it
+static void do_tx_sign_deny()
+{
+    tx_speculate_abort();
+
+    do_deny();
+}
+
 UX_STEP_SPLASH(ux_tx_sign_1_step, pnn, do_tx_sign(), {&C_icon_turtlecoin, "Signing", "Transaction..."});
 
 UX_FLOW(ux_tx_sign_flow, &ux_tx_sign_1_step);
 
 UX_STEP_NOCB(ux_tx_sign_2_step, pnn, {&C_icon_turtlecoin, "Sign", "Transaction?"});
 
-UX_STEP_NOCB(ux_tx_sign_3_step, bnnn_paging, {.title = "Amount to Spend", .text = (char *)APDU_TSIGN_AMOUNT});
+UX_STEP_NOCB(ux_tx_sign_3_step, bnnn_paging, {.title = "Amount to Spend", .text = (char *)APDU_TSIGN->amount});
 
-UX_STEP_NOCB(ux_tx_sign_4_step, bnnn_paging, {.title = "Network Fee", .text = (char *)APDU_TSIGN_FEE});
+UX_STEP_NOCB(ux_tx_sign_4_step, bnnn_paging, {.title = "Network Fee", .text = (char *)APDU_TSIGN->fee});
 
 UX_STEP_VALID(ux_tx_sign_5_step, pb, ux_flow_init(0, ux_tx_sign_flow, NULL), {&C_icon_validate_14, "Approve"});
 
-UX_STEP_VALID(ux_tx_sign_6_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
+UX_STEP_VALID(ux_tx_sign_6_step, pb, do_tx_sign_deny(), {&C_icon_crossmark, "Reject"});
 
 UX_FLOW(
     ux_tx_sign_confirm_flow,
@@ -84,49 +125,50 @@ UX_FLOW(
     &ux_tx_sign_5_step,
     &ux_tx_sign_6_step);
 
-void handle_tx_sign(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx)
+void handle_tx_sign(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
-    UNUSED(p2);
-
-    if (tx_state() != TX_PREFIX_READY)
+    if (p2 != APDU_TX_SIGN_P2_ALL && p2 != APDU_TX_SIGN_P2_BY_INPUT && p2 != APDU_TX_SIGN_P2_STREAM)
     {
-        return sendError(ERR_TRANSACTION_STATE);
+        return sendError(ERR_OP_NOT_PERMITTED);
     }
 
-    {
-        unsigned int offset = amountToString(APDU_TSIGN_AMOUNT, tx_input_amount(), KEY_SIZE);
-
-        // copy the ticker on to the end of the amount
-        os_memmove(APDU_TSIGN_AMOUNT + offset - 1, TICKER, TICKER_SIZE);
-    }
+    apdu_tx_sign_set_t *set = ARENA_NEW(apdu_tx_sign_set_t);
 
-    {
-        unsigned int offset = amountToString(APDU_TSIGN_FEE, tx_fee(), KEY_SIZE);
+    // the totals were formatted as the transaction was loaded
+    tx_review_text(set->amount, set->fee);
 
-        // copy the ticker on to the end of the amount
-        os_memmove(APDU_TSIGN_FEE + offset - 1, TICKER, TICKER_SIZE);
-    }
+    // remember how the approved transaction is to be signed
+    set->mode = p2;
 
     /**
      * If the APDU was sent requesting confirmation then
      * we need to start the UX flow and set the flags
      * to let the i/o handler know that the request is
-     * async and will be completed shortly
+     * async and will be completed shortly, unless the
+     * transaction is covered by a batch approval
      */
-    if (p1 == P1_CONFIRM)
+    if (!batch_take(tx_input_amount(), tx_fee()) && p1 == P1_CONFIRM)
     {
+        // the inputs are signed while the user reads the screens, tx_sign only finishes the job
+        if (p2 == APDU_TX_SIGN_P2_ALL)
+        {
+            tx_speculate_begin();
+        }
+
         ux_flow_init(0, ux_tx_sign_confirm_flow, NULL);
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
+    else
     {
         ux_flow_init(0, ux_tx_sign_flow, NULL);
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
 }
\ No newline at end of file
@@ -21,6 +21,16 @@
 
 #define APDU_TX_SIGN_NAME ((unsigned char *)"TX_SIGN")
 
-void handle_tx_sign(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx);
+#define APDU_TX_SIGN_P2_ALL 0x00
+#define APDU_TX_SIGN_P2_BY_INPUT 0x01
+#define APDU_TX_SIGN_P2_STREAM 0x02
+
+void handle_tx_sign(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_TX_SIGN_H
@@ -0,0 +1,248 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "apdu_tx_sign_input.h"
+
+#include <transaction.h>
+#include <utils.h>
+
+#define APDU_TX_SIGN_INPUT_SIZE (TX_MIXIN_SIZE * (tx_ring_size() - 1))
+
+// the number of inputs to sign on the device (0 = the host prepared the mixins)
+#define APDU_TSI_COUNT_IDX WORKING_SET
+#define APDU_TSI_COUNT readUint8(APDU_TSI_COUNT_IDX)
+
+#define APDU_TSI_MIXINS APDU_TSI_COUNT_IDX + sizeof(uint8_t)
+
+#define APDU_TSI_HASH WORKING_SET
+#define APDU_TSI_END_OFFSET APDU_TSI_HASH + KEY_SIZE
+
+#define APDU_TSI_RESPONSE APDU_TSI_HASH
+#define APDU_TSI_RESPONSE_SIZE KEY_SIZE + sizeof(uint16_t)
+
+// streamed signatures are returned ahead of the hash and size
+#define APDU_TSI_SIGNATURES WORKING_SET
+#define APDU_TSI_SIGNATURES_SIZE ((tx_streams_signatures()) ? tx_ring_size() * SIG_SIZE : 0)
+
+// whether the host resent the ring of the input that is signed on its own
+#define APDU_TSI_HAS_RING_IDX WORKING_SET
+#define APDU_TSI_HAS_RING readUint8(APDU_TSI_HAS_RING_IDX)
+
+// the sealed pre-signature state of the input when the host holds it
+#define APDU_TSI_SEALED_INPUT APDU_TSI_HAS_RING_IDX + sizeof(uint8_t)
+
+// the resent ring is kept at the very end of the working set so that the signatures can be staged in front of it
+#define APDU_TSI_RING_SIZE (KEY_SIZE * tx_ring_size())
+#define APDU_TSI_RING (WORKING_SET + WORKING_SET_SIZE - APDU_TSI_RING_SIZE)
+
+static void do_tx_sign_single_input()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const unsigned char *public_keys = (APDU_TSI_HAS_RING == 1) ? APDU_TSI_RING : NULL;
+
+            uint16_t status;
+
+            if (tx_seals_inputs())
+            {
+                // the signatures are staged over the top of the working set so the sealed input is moved out first
+                unsigned char sealed_input[TX_SEALED_INPUT_SIZE];
+
+                os_memmove(sealed_input, APDU_TSI_SEALED_INPUT, sizeof(sealed_input));
+
+                status = tx_sign_sealed_input(sealed_input, APDU_TSI_SIGNATURES, public_keys);
+
+                explicit_bzero(sealed_input, sizeof(sealed_input));
+            }
+            else if (tx_streams_signatures())
+            {
+                status = tx_sign_stream_input(APDU_TSI_SIGNATURES, public_keys);
+            }
+            else
+            {
+                status = tx_sign_ring_input(public_keys);
+            }
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            size_t length = APDU_TSI_SIGNATURES_SIZE;
+
+            if (tx_state() == TX_COMPLETE)
+            {
+                status = tx_hash(APDU_TSI_SIGNATURES + length);
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+
+                uint16ToChar(APDU_TSI_SIGNATURES + length + KEY_SIZE, tx_size());
+
+                length += KEY_SIZE + sizeof(uint16_t);
+            }
+
+            CLOSE_TRY;
+
+            sendResponse(write_io_hybrid(APDU_TSI_SIGNATURES, length, APDU_TX_SIGN_INPUT_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            hw_nonce_drbg_pause();
+
+            sendError(e);
+        }
+        FINALLY {}
+    }
+    END_TRY;
+}
+
+static void do_tx_sign_input()
+{
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const uint8_t count = APDU_TSI_COUNT;
+
+            uint16_t status = (count == 0) ? tx_sign_next_input(APDU_TSI_MIXINS) : tx_sign_inputs(count);
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            // there is nothing to report until the last input has been signed (see APDU_TX_STATE)
+            if (tx_state() != TX_COMPLETE)
+            {
+                CLOSE_TRY;
+
+                sendResponse(0, true);
+
+                return;
+            }
+
+            status = tx_hash(APDU_TSI_HASH);
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            uint16ToChar(APDU_TSI_END_OFFSET, tx_size());
+
+            CLOSE_TRY;
+
+            sendResponse(
+                write_io_hybrid(APDU_TSI_RESPONSE, APDU_TSI_RESPONSE_SIZE, APDU_TX_SIGN_INPUT_NAME, true), true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY {}
+    }
+    END_TRY;
+}
+
+UX_STEP_SPLASH(ux_tx_sign_input_1_step, pnn, do_tx_sign_input(), {&C_icon_turtlecoin, "Signing", "Tx Input..."});
+
+UX_FLOW(ux_tx_sign_input_flow, &ux_tx_sign_input_1_step);
+
+UX_STEP_SPLASH(
+    ux_tx_sign_single_input_1_step,
+    pnn,
+    do_tx_sign_single_input(),
+    {&C_icon_turtlecoin, "Signing", "Tx Input..."});
+
+UX_FLOW(ux_tx_sign_single_input_flow, &ux_tx_sign_single_input_1_step);
+
+void handle_tx_sign_input(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
+{
+    UNUSED(p2);
+
+    const uint16_t sealed_size = (tx_seals_inputs()) ? TX_SEALED_INPUT_SIZE : 0;
+
+    // sealed inputs are handed back and streamed signatures are returned one input at a time
+    const bool single = tx_seals_inputs() || tx_streams_signatures();
+
+    // the ring of the input may follow, on its own it signs the next input on the device (see tx_sign_input)
+    const bool has_ring = (dataLength == sealed_size + APDU_TSI_RING_SIZE);
+
+    if (single || has_ring)
+    {
+        if (!has_ring && dataLength != sealed_size)
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
+        else if (has_ring && sizeof(uint8_t) + sealed_size + APDU_TSI_RING_SIZE > WORKING_SET_SIZE)
+        {
+            return sendError(ERR_TX_RING_SIZE);
+        }
+
+        *(APDU_TSI_HAS_RING_IDX) = (has_ring) ? 1 : 0;
+
+        // copy the data buffer into the working set
+        os_memmove(APDU_TSI_SEALED_INPUT, dataBuffer, sealed_size);
+
+        if (has_ring)
+        {
+            os_memmove(APDU_TSI_RING, dataBuffer + sealed_size, APDU_TSI_RING_SIZE);
+        }
+
+        ux_flow_init(0, ux_tx_sign_single_input_flow, NULL);
+
+        *flags |= IO_ASYNCH_REPLY;
+
+        return;
+    }
+
+    if (dataLength == 0)
+    {
+        // sign a range of inputs on the device
+        *(APDU_TSI_COUNT_IDX) = (p1 == 0) ? TX_MAX_INPUTS : p1;
+    }
+    else if (APDU_TX_SIGN_INPUT_SIZE > WORKING_SET_SIZE - sizeof(uint8_t))
+    {
+        // the mixins of rings this large do not fit in a single request
+        return sendError(ERR_TX_RING_SIZE);
+    }
+    else if (dataLength != APDU_TX_SIGN_INPUT_SIZE)
+    {
+        return sendError(ERR_WRONG_INPUT_LENGTH);
+    }
+    else
+    {
+        *(APDU_TSI_COUNT_IDX) = 0;
+
+        // copy the data buffer into the working set
+        os_memmove(APDU_TSI_MIXINS, dataBuffer, dataLength);
+    }
+
+    ux_flow_init(0, ux_tx_sign_input_flow, NULL);
+
+    *flags |= IO_ASYNCH_REPLY;
+}
\ No newline at end of file
@@ -16,6 +16,8 @@
 
 #include "apdu_tx_start.h"
 
+#include <apdu_generate_tx_ringsignatures.h>
+#include <batch.h>
 #include <transaction.h>
 #include <utils.h>
 
@@ -38,6 +40,22 @@
 
 #define APDU_TS_PAYMENT_ID APDU_TS_HAS_PAYMENT_ID_IDX + sizeof(uint8_t)
 
+// the ring size arrives in P2 and is kept just past the largest payload
+#define APDU_TS_RING_SIZE_IDX APDU_TS_UNLOCK_IDX + APDU_TX_START_ALT_SIZE
+#define APDU_TS_RING_SIZE readUint8(APDU_TS_RING_SIZE_IDX)
+
+// as is the largest varint of a ring offset, which may follow either payload
+#define APDU_TS_OFFSET_SIZE_IDX APDU_TS_RING_SIZE_IDX + sizeof(uint8_t)
+#define APDU_TS_OFFSET_SIZE readUint8(APDU_TS_OFFSET_SIZE_IDX)
+
+// as is whether the inputs are sealed for the host which is flagged in P2
+#define APDU_TS_SEAL_INPUTS_IDX APDU_TS_OFFSET_SIZE_IDX + sizeof(uint8_t)
+#define APDU_TS_SEAL_INPUTS readUint8(APDU_TS_SEAL_INPUTS_IDX)
+
+// and whether the transaction moves on by itself which is flagged in P1
+#define APDU_TS_AUTO_ADVANCE_IDX APDU_TS_SEAL_INPUTS_IDX + sizeof(uint8_t)
+#define APDU_TS_AUTO_ADVANCE readUint8(APDU_TS_AUTO_ADVANCE_IDX)
+
 static void do_tx_start()
 {
     BEGIN_TRY
@@ -48,9 +66,13 @@ static void do_tx_start()
                 APDU_TS_UNLOCK,
                 APDU_TS_INPUT_COUNT,
                 APDU_TS_OUTPUT_COUNT,
+                APDU_TS_RING_SIZE,
+                APDU_TS_OFFSET_SIZE,
                 APDU_TS_TX_PUBLIC_KEY,
                 APDU_TS_HAS_PAYMENT_ID,
-                APDU_TS_PAYMENT_ID);
+                APDU_TS_PAYMENT_ID,
+                APDU_TS_SEAL_INPUTS,
+                APDU_TS_AUTO_ADVANCE);
 
             if (status != OP_OK)
             {
@@ -82,19 +104,48 @@ void handle_tx_start(
     volatile unsigned int *flags,
     volatile unsigned int *tx)
 {
-    UNUSED(p2);
-
-    if (tx_state() != TX_UNUSED)
+    // only a batch approval starts a new transaction straight after the last one was signed
+    if (tx_state() != TX_UNUSED && !batch_active())
     {
         return sendError(ERR_TRANSACTION_STATE);
     }
-    else if (dataLength != APDU_TX_START_SIZE && dataLength != APDU_TX_START_ALT_SIZE)
+
+    // the approval of a transaction that the host built does not outlive the start of another one
+    generate_tx_ring_signatures_end();
+
+    // either payload may be followed by the largest varint that a ring offset is going to take
+    const bool has_offset_size =
+        dataLength == APDU_TX_START_SIZE + sizeof(uint8_t) || dataLength == APDU_TX_START_ALT_SIZE + sizeof(uint8_t);
+
+    if (dataLength != APDU_TX_START_SIZE && dataLength != APDU_TX_START_ALT_SIZE && !has_offset_size)
     {
         return sendError(ERR_WRONG_INPUT_LENGTH);
     }
 
+    const uint8_t offset_size = (has_offset_size) ? dataBuffer[dataLength - 1] : TX_OFFSET_MAX_SIZE;
+
     // copy the data buffer into the working set
-    os_memmove(WORKING_SET, dataBuffer, dataLength);
+    os_memmove(WORKING_SET, dataBuffer, dataLength - ((has_offset_size) ? 1 : 0));
+
+    os_memmove(APDU_TS_OFFSET_SIZE_IDX, &offset_size, sizeof(uint8_t));
+
+    // a ring size of zero in P2 keeps the default ring size
+    uint8_t ring_size = p2 & APDU_TX_START_P2_RING_SIZE;
+
+    if (ring_size == 0)
+    {
+        ring_size = RING_PARTICIPANTS;
+    }
+
+    os_memmove(APDU_TS_RING_SIZE_IDX, &ring_size, sizeof(uint8_t));
+
+    const uint8_t seal_inputs = ((p2 & APDU_TX_START_P2_SEAL_INPUTS) != 0) ? 1 : 0;
+
+    os_memmove(APDU_TS_SEAL_INPUTS_IDX, &seal_inputs, sizeof(uint8_t));
+
+    const uint8_t auto_advance = ((p1 & APDU_TX_START_P1_AUTO_ADVANCE) != 0) ? 1 : 0;
+
+    os_memmove(APDU_TS_AUTO_ADVANCE_IDX, &auto_advance, sizeof(uint8_t));
 
     ux_flow_init(0, ux_tx_start_flow, NULL);
 
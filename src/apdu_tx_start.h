@@ -19,6 +19,11 @@
 
 #include <stdint.h>
 
+#define APDU_TX_START_P2_RING_SIZE 0x7f
+#define APDU_TX_START_P2_SEAL_INPUTS 0x80
+
+#define APDU_TX_START_P1_AUTO_ADVANCE 0x01
+
 void handle_tx_start(
     uint8_t p1,
     uint8_t p2,
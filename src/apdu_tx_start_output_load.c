@@ -45,22 +45,13 @@ static void do_tx_start_output_load()
     END_TRY;
 }
 
-UX_STEP_SPLASH(
-    ux_tx_start_output_load_1_step,
-    pnn,
-    do_tx_start_output_load(),
-    {&C_icon_turtlecoin, "Initializing", "Output Loading..."});
-
-UX_FLOW(ux_tx_start_output_load_flow, &ux_tx_start_output_load_1_step);
-
-void handle_tx_start_output_load(volatile unsigned int *flags)
+void handle_tx_start_output_load(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
-    if (tx_state() != TX_INPUTS_RECEIVED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-
-    ux_flow_init(0, ux_tx_start_output_load_flow, NULL);
-
-    *flags |= IO_ASYNCH_REPLY;
+    run_silent(do_tx_start_output_load);
 }
\ No newline at end of file
@@ -17,6 +17,12 @@
 #ifndef APDU_TX_START_OUTPUT_LOAD_H
 #define APDU_TX_START_OUTPUT_LOAD_H
 
-void handle_tx_start_output_load(volatile unsigned int *flags);
+void handle_tx_start_output_load(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_TX_START_OUTPUT_LOAD_H
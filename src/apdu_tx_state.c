@@ -19,13 +19,21 @@
 #include <transaction.h>
 #include <utils.h>
 
-void handle_tx_state()
+void handle_tx_state(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
-    unsigned char state = tx_state();
+    unsigned char state[3] = {tx_state(), tx_signed_input_count(), tx_input_count()};
+
+    const size_t length = (p1 == APDU_TX_STATE_P1_PROGRESS) ? sizeof(state) : 1;
 
     /**
      * This is static non-privileged information and as thus
      * can be returned without any additional checking
      */
-    sendResponse(write_io_hybrid(&state, 1, APDU_TX_STATE_NAME, true), true);
+    sendResponse(write_io_hybrid(state, length, APDU_TX_STATE_NAME, true), true);
 }
\ No newline at end of file
@@ -17,8 +17,19 @@
 #ifndef APDU_TX_STATE_H
 #define APDU_TX_STATE_H
 
+#include <stdint.h>
+
 #define APDU_TX_STATE_NAME ((unsigned char *)"TX_STATE")
 
-void handle_tx_state();
+#define APDU_TX_STATE_P1_STATE 0x00
+#define APDU_TX_STATE_P1_PROGRESS 0x01
+
+void handle_tx_state(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_TX_STATE_H
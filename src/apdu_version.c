@@ -17,7 +17,13 @@
 #include <apdu_version.h>
 #include <utils.h>
 
-void handle_version()
+void handle_version(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     unsigned char version[3] = {LEDGER_MAJOR_VERSION, LEDGER_MINOR_VERSION, LEDGER_PATCH_VERSION};
 
@@ -19,6 +19,12 @@
 
 #define APDU_VERSION_NAME ((unsigned char *)"VERSION")
 
-void handle_version();
+void handle_version(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_VERSION_H
@@ -58,15 +58,16 @@ UX_FLOW(
     &ux_display_view_secret_key_flow_3_step,
     &ux_display_view_secret_key_flow_4_step);
 
-void handle_view_secret_key(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx)
+void handle_view_secret_key(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-
     toHexString(PTR_VIEW_PRIVATE, KEY_SIZE, APDU_VSK, KEY_HEXSTR_SIZE);
 
     /**
@@ -81,14 +82,10 @@ void handle_view_secret_key(uint8_t p1, uint8_t p2, volatile unsigned int *flags
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
+    else
     {
         do_view_secret_key();
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
 }
\ No newline at end of file
@@ -21,6 +21,12 @@
 
 #define APDU_VIEW_SECRET_KEY_NAME ((unsigned char *)"VIEWSECRET")
 
-void handle_view_secret_key(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx);
+void handle_view_secret_key(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif // APDU_VIEW_SECRET_KEY_H
@@ -63,15 +63,16 @@ UX_FLOW(
 &ux_display_wallet_keys_flow_4_step,
 &ux_display_wallet_keys_flow_5_step);
 
-void handle_view_wallet_keys(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx)
+void handle_view_wallet_keys(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx)
 {
     UNUSED(p2);
 
-    if (tx_state() != TX_UNUSED)
-    {
-        return sendError(ERR_TRANSACTION_STATE);
-    }
-
     toHexString(PTR_SPEND_PUBLIC, KEY_SIZE, APDU_WK_SPEND_PUBLIC, KEY_HEXSTR_SIZE);
 
     toHexString(PTR_VIEW_PRIVATE, KEY_SIZE, APDU_WK_VIEW_PRIVATE, KEY_HEXSTR_SIZE);
@@ -92,14 +93,10 @@ void handle_view_wallet_keys(uint8_t p1, uint8_t p2, volatile unsigned int *flag
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
+    else
     {
         do_view_wallet_keys();
 
         *flags |= IO_ASYNCH_REPLY;
     }
-    else
-    {
-        sendError(ERR_OP_USER_REQUIRED);
-    }
 }
\ No newline at end of file
@@ -21,6 +21,12 @@
 
 #define APDU_WALLET_KEYS_NAME ((unsigned char *)"WALLETKEYS")
 
-void handle_view_wallet_keys(uint8_t p1, uint8_t p2, volatile unsigned int *flags, volatile unsigned int *tx);
+void handle_view_wallet_keys(
+    uint8_t p1,
+    uint8_t p2,
+    uint8_t *dataBuffer,
+    uint16_t dataLength,
+    volatile unsigned int *flags,
+    volatile unsigned int *tx);
 
 #endif //APDU_WALLET_KEYS_H
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "arena.h"
+
+// the start of the part of the working set that is still free
+static uint16_t L_arena_top = 0;
+
+unsigned char *arena_alloc(const size_t size)
+{
+    if (size > WORKING_SET_SIZE - L_arena_top)
+    {
+        THROW(ERR_WORKING_SET);
+    }
+
+    unsigned char *region = WORKING_SET + L_arena_top;
+
+    L_arena_top += size;
+
+    return region;
+}
+
+arena_mark_t arena_mark()
+{
+    return L_arena_top;
+}
+
+void arena_release(const arena_mark_t mark)
+{
+    if (mark >= L_arena_top)
+    {
+        return;
+    }
+
+    explicit_bzero(WORKING_SET + mark, L_arena_top - mark);
+
+    L_arena_top = mark;
+}
+
+void arena_reset()
+{
+    explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+
+    L_arena_top = 0;
+}
@@ -0,0 +1,63 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <common.h>
+
+/**
+ * The working set is handed out front to back for the life of a request and is given back
+ * all at once before the next one is dispatched (see arena_reset). A command whose regions
+ * have to be found again from its UX callbacks lays them out in a struct that is always the
+ * first thing taken from the arena, the rest is taken as it is needed
+ */
+
+// fails the build if a region of the given size can never fit in the working set
+#define ARENA_ASSERT_FITS(size, what) \
+    _Static_assert((size) <= WORKING_SET_SIZE, what " does not fit in the working set")
+
+// the layout of the working set that a command claims first, at the start of the working set
+#define ARENA_LAYOUT(type) ((type *)WORKING_SET)
+
+#define ARENA_NEW(type) ((type *)arena_alloc(sizeof(type)))
+
+typedef uint16_t arena_mark_t;
+
+/**
+ * Takes the next region of the working set, throws ERR_WORKING_SET when it does not fit
+ * @param size the size of the region
+ * @returns the start of the region
+ */
+unsigned char *arena_alloc(const size_t size);
+
+/**
+ * Remembers how much of the working set is taken so that it can be given back with arena_release
+ */
+arena_mark_t arena_mark();
+
+/**
+ * Gives back, and wipes, everything taken since the mark was made
+ * @param mark what arena_mark returned
+ */
+void arena_release(const arena_mark_t mark);
+
+/**
+ * Gives back, and wipes, the whole working set
+ */
+void arena_reset();
+
+#endif // ARENA_H
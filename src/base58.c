@@ -28,51 +28,37 @@ const unsigned int encoded_block_sizes[] = {0, 2, 3, 5, 6, 7, 9, 10, 11};
 #define FULL_ENCODED_BLOCK_SIZE 11 // encoded_block_sizes[full_block_size];
 #define ADDR_CHECKSUM_SIZE 4
 
-static uint64_t uint_8be_to_64(const unsigned char *data, size_t size)
+static void encode_block(const unsigned char *block, size_t size, unsigned char *res)
 {
-    uint64_t res = 0;
-    switch (9 - size)
-    {
-        case 1:
-            res |= *data++;
-        case 2:
-            res <<= 8;
-            res |= *data++;
-        case 3:
-            res <<= 8;
-            res |= *data++;
-        case 4:
-            res <<= 8;
-            res |= *data++;
-        case 5:
-            res <<= 8;
-            res |= *data++;
-        case 6:
-            res <<= 8;
-            res |= *data++;
-        case 7:
-            res <<= 8;
-            res |= *data++;
-        case 8:
-            res <<= 8;
-            res |= *data;
-            break;
-    }
+    // the block is a big-endian number in base 256 that is divided down by 58 in place
+    uint8_t digits[FULL_BLOCK_SIZE];
 
-    return res;
-}
+    os_memmove(digits, block, size);
 
-static void encode_block(const unsigned char *block, size_t size, unsigned char *res)
-{
-    uint64_t num = uint_8be_to_64(block, size);
+    size_t start = 0;
 
     int i = encoded_block_sizes[size];
 
     while (i--)
     {
-        uint64_t remainder = num % alphabet_size;
+        uint32_t remainder = 0;
+
+        for (size_t j = start; j < size; j++)
+        {
+            const uint32_t x = (remainder << 8) | digits[j];
 
-        num /= alphabet_size;
+            const uint32_t quotient = DIV58(x);
+
+            remainder = x - (quotient * alphabet_size);
+
+            digits[j] = (uint8_t)quotient;
+        }
+
+        // the leading digits that are down to zero stay that way
+        while (start < size && digits[start] == 0)
+        {
+            start++;
+        }
 
         res[i] = alphabet[remainder];
     }
@@ -101,6 +87,8 @@ uint16_t base58_encode(const unsigned char *rawAddress, unsigned char *str_b58)
                     &str_b58[full_block_count * FULL_ENCODED_BLOCK_SIZE]);
             }
 
+            CLOSE_TRY;
+
             return OP_OK;
         }
         CATCH_OTHER(e)
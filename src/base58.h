@@ -28,6 +28,12 @@
 #define CHECKSUM_SIZE 4
 #define BASE58_ADDRESS_STR_SIZE BASE58_ADDRESS_SIZE + 1
 
+/**
+ * x / 58 for any x < 58 * 256 as a multiply by the reciprocal (565 / 2^15), the Cortex-M0
+ * has no divide instruction and a 64-bit division is a long software routine
+ */
+#define DIV58(x) (((x)*565) >> 15)
+
 uint16_t base58_encode(const unsigned char *rawAddress, unsigned char *str_b58);
 
 #endif // BASE58_H
@@ -0,0 +1,72 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "batch.h"
+
+#include <cache.h>
+
+typedef struct batch_s
+{
+    uint64_t amount; // 8-bytes, left to spend
+
+    uint64_t fee; // 8-bytes, left to pay
+
+    uint8_t transactions; // 1-byte, left to sign, 0 = no batch
+} batch_t;
+
+static batch_t L_batch;
+
+void batch_start(const uint8_t transactions, const uint64_t amount, const uint64_t fee)
+{
+    batch_end();
+
+    L_batch.transactions = transactions;
+
+    L_batch.amount = amount;
+
+    L_batch.fee = fee;
+}
+
+bool batch_active()
+{
+    return L_batch.transactions != 0;
+}
+
+bool batch_take(const uint64_t amount, const uint64_t fee)
+{
+    if (L_batch.transactions == 0 || amount > L_batch.amount || fee > L_batch.fee)
+    {
+        return false;
+    }
+
+    L_batch.transactions--;
+
+    L_batch.amount -= amount;
+
+    L_batch.fee -= fee;
+
+    return true;
+}
+
+void batch_end()
+{
+    if (L_batch.transactions != 0)
+    {
+        cache_reset();
+    }
+
+    explicit_bzero(&L_batch, sizeof(L_batch));
+}
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <common.h>
+#include <stdbool.h>
+
+/**
+ * A batch approval lets the user approve the signing of a number of transactions at once, up to
+ * a total amount to spend and a total network fee. Each transaction that it still covers is then
+ * signed without prompting, and those that it does not cover are confirmed as usual. While the
+ * batch lasts a new transaction may be started straight after the last one was signed, and the
+ * derivation and ring point caches are kept from one transaction to the next. The batch ends once
+ * it has been used up, with APDU_TX_RESET, when another account is selected or when the app exits
+ */
+
+/**
+ * Starts a batch approval, replacing any that is already running
+ * @param transactions the number of transactions that the batch covers
+ * @param amount the total amount that the transactions may spend
+ * @param fee the total network fee that the transactions may pay
+ */
+void batch_start(const uint8_t transactions, const uint64_t amount, const uint64_t fee);
+
+/**
+ * @returns whether a batch approval is running
+ */
+bool batch_active();
+
+/**
+ * Uses up one of the transactions of the batch approval along with its amount and fee
+ * @param amount the amount that the transaction spends
+ * @param fee the network fee of the transaction
+ * @returns whether the batch approval covered the transaction, nothing is used up if it did not
+ */
+bool batch_take(const uint64_t amount, const uint64_t fee);
+
+/**
+ * Ends the batch approval, if any, and wipes the caches that it kept
+ */
+void batch_end();
+
+#endif // BATCH_H
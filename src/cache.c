@@ -0,0 +1,303 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "cache.h"
+
+#include <hw_crypto.h>
+#include <nvram.h>
+
+#ifdef TARGET_NANOX
+const key_image_cache_t N_state_key_image_cache_pic;
+#else
+key_image_cache_t N_state_key_image_cache_pic;
+#endif
+
+/**
+ * A small least recently used cache of key derivations that lives for a
+ * transaction session (it is wiped every time the transaction state is reset)
+ * so that spending several outputs of the same transaction only pays for the
+ * variable base scalar multiplication once. Entries are looked up by a tag
+ * that binds both the transaction public key and the private view key used
+ */
+static derivation_cache_entry_t L_derivations[DERIVATION_CACHE_SIZE];
+
+static uint16_t L_derivations_clock;
+
+/**
+ * The members of the rings that were signed or checked lately, both as the decompressed
+ * point P and as Hp(P), looked up by their public key. Decoys are picked from the same
+ * outputs often enough that they repeat across the inputs of a transaction, and nothing
+ * in here is secret as both are derived from the public key alone
+ */
+static ring_point_cache_entry_t L_ring_points[RING_POINT_CACHE_SIZE];
+
+static uint16_t L_ring_points_clock;
+
+/**
+ * Looks up the derivation for the given tag
+ * @param derivation the cached derivation
+ * @param tag the tag of the derivation
+ * @return OP_OK if the derivation was found, OP_NOK otherwise
+ */
+uint16_t cache_derivation_get(unsigned char *derivation, const unsigned char *tag)
+{
+    size_t i;
+
+    for (i = 0; i < DERIVATION_CACHE_SIZE; i++)
+    {
+        if (L_derivations[i].last_used != 0 && os_memcmp(L_derivations[i].tag, tag, KEY_SIZE) == 0)
+        {
+            os_memmove(derivation, L_derivations[i].derivation, KEY_SIZE);
+
+            L_derivations[i].last_used = ++L_derivations_clock;
+
+            return OP_OK;
+        }
+    }
+
+    return OP_NOK;
+}
+
+/**
+ * Stores the derivation for the given tag in place of the least recently used entry
+ * @param tag the tag of the derivation
+ * @param derivation the derivation
+ */
+uint16_t cache_derivation_put(const unsigned char *tag, const unsigned char *derivation)
+{
+    // the clock is about to wrap so start over rather than muddle up the ordering
+    if (L_derivations_clock == UINT16_MAX)
+    {
+        cache_reset();
+    }
+
+    size_t oldest = 0;
+
+    size_t i;
+
+    for (i = 1; i < DERIVATION_CACHE_SIZE; i++)
+    {
+        if (L_derivations[i].last_used < L_derivations[oldest].last_used)
+        {
+            oldest = i;
+        }
+    }
+
+    os_memmove(L_derivations[oldest].tag, tag, KEY_SIZE);
+
+    os_memmove(L_derivations[oldest].derivation, derivation, KEY_SIZE);
+
+    L_derivations[oldest].last_used = ++L_derivations_clock;
+
+    return OP_OK;
+}
+
+/**
+ * Looks up the points of the given ring member
+ * @param point the decompressed public key P
+ * @param hash_point Hp(P), or NULL if it is not needed
+ * @param public_key the public key of the ring member
+ * @return OP_OK if the points were found, OP_NOK otherwise
+ */
+uint16_t cache_ring_point_get(unsigned char *point, unsigned char *hash_point, const unsigned char *public_key)
+{
+    size_t i;
+
+    for (i = 0; i < RING_POINT_CACHE_SIZE; i++)
+    {
+        if (L_ring_points[i].last_used != 0 && os_memcmp(L_ring_points[i].public_key, public_key, KEY_SIZE) == 0)
+        {
+            if (point != NULL)
+            {
+                os_memmove(point, L_ring_points[i].point, SIG_STR_SIZE);
+            }
+
+            if (hash_point != NULL)
+            {
+                os_memmove(hash_point, L_ring_points[i].hash_point, SIG_STR_SIZE);
+            }
+
+            L_ring_points[i].last_used = ++L_ring_points_clock;
+
+            return OP_OK;
+        }
+    }
+
+    return OP_NOK;
+}
+
+/**
+ * Stores the points of the given ring member in place of the least recently used entry
+ * @param public_key the public key of the ring member
+ * @param point the decompressed public key P
+ * @param hash_point Hp(P)
+ */
+uint16_t cache_ring_point_put(
+    const unsigned char *public_key,
+    const unsigned char *point,
+    const unsigned char *hash_point)
+{
+    // the clock is about to wrap so start over rather than muddle up the ordering
+    if (L_ring_points_clock == UINT16_MAX)
+    {
+        explicit_bzero(L_ring_points, sizeof(L_ring_points));
+
+        L_ring_points_clock = 0;
+    }
+
+    size_t oldest = 0;
+
+    size_t i;
+
+    for (i = 1; i < RING_POINT_CACHE_SIZE; i++)
+    {
+        if (L_ring_points[i].last_used < L_ring_points[oldest].last_used)
+        {
+            oldest = i;
+        }
+    }
+
+    os_memmove(L_ring_points[oldest].public_key, public_key, KEY_SIZE);
+
+    os_memmove(L_ring_points[oldest].point, point, SIG_STR_SIZE);
+
+    os_memmove(L_ring_points[oldest].hash_point, hash_point, SIG_STR_SIZE);
+
+    L_ring_points[oldest].last_used = ++L_ring_points_clock;
+
+    return OP_OK;
+}
+
+/**
+ * Key images of owned outputs are kept in NVRAM so that they survive a restart,
+ * a wallet that rescans can then have them handed back without any of the curve
+ * work being done again. The tag binds the transaction public key and output index
+ * along with the output key so that a request for an output with the wrong details
+ * still has to go through (and fail) the full key image generation
+ * @param tag the resulting tag
+ * @param tx_public_key the transaction public key
+ * @param output_index the output index in the transaction
+ * @param output_key the output key
+ */
+static void cache_key_image_tag(
+    unsigned char *tag,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key)
+{
+    const uint32_t index = output_index;
+
+    hw_keccak_t context;
+
+    hw_keccak_init(&context);
+
+    hw_keccak_update(&context, tx_public_key, KEY_SIZE);
+
+    hw_keccak_update(&context, (const unsigned char *)&index, sizeof(index));
+
+    hw_keccak_update(&context, output_key, KEY_SIZE);
+
+    hw_keccak_final(&context, tag);
+}
+
+/**
+ * Looks up the key image of the given output
+ * @param key_image the cached key image
+ * @param tx_public_key the transaction public key
+ * @param output_index the output index in the transaction
+ * @param output_key the output key
+ * @return OP_OK if the key image was found, OP_NOK otherwise
+ */
+uint16_t cache_key_image_get(
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key)
+{
+    unsigned char tag[KEY_SIZE];
+
+    cache_key_image_tag(tag, tx_public_key, output_index, output_key);
+
+    size_t i;
+
+    for (i = 0; i < KEY_IMAGE_CACHE_SIZE; i++)
+    {
+        if (os_memcmp((void *)N_key_image_cache->entries[i].tag, tag, KEY_SIZE) == 0)
+        {
+            os_memmove(key_image, (void *)N_key_image_cache->entries[i].key_image, KEY_SIZE);
+
+            return OP_OK;
+        }
+    }
+
+    return OP_NOK;
+}
+
+/**
+ * Stores the key image of the given output in place of the oldest entry
+ * @param key_image the key image
+ * @param tx_public_key the transaction public key
+ * @param output_index the output index in the transaction
+ * @param output_key the output key
+ */
+uint16_t cache_key_image_put(
+    const unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key)
+{
+    key_image_cache_entry_t entry;
+
+    cache_key_image_tag(entry.tag, tx_public_key, output_index, output_key);
+
+    os_memmove(entry.key_image, key_image, KEY_SIZE);
+
+    uint16_t next = N_key_image_cache->next % KEY_IMAGE_CACHE_SIZE;
+
+    nvram_write((void *)&N_key_image_cache->entries[next], (void *)&entry, sizeof(key_image_cache_entry_t));
+
+    next = (next + 1) % KEY_IMAGE_CACHE_SIZE;
+
+    nvram_write((void *)&N_key_image_cache->next, (void *)&next, sizeof(uint16_t));
+
+    return OP_OK;
+}
+
+/**
+ * Wipes the key images that are kept in NVRAM
+ */
+uint16_t cache_key_image_reset()
+{
+    nvram_write((void *)N_key_image_cache, NULL, sizeof(key_image_cache_t));
+
+    return OP_OK;
+}
+
+/**
+ * Wipes every cached (RAM) value
+ */
+uint16_t cache_reset()
+{
+    explicit_bzero(L_derivations, sizeof(L_derivations));
+
+    L_derivations_clock = 0;
+
+    explicit_bzero(L_ring_points, sizeof(L_ring_points));
+
+    L_ring_points_clock = 0;
+
+    return OP_OK;
+}
@@ -0,0 +1,101 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <common.h>
+
+#define DERIVATION_CACHE_SIZE 4
+#define KEY_IMAGE_CACHE_SIZE 64
+
+// enough for a whole ring of the default size, the Nano X can spare the RAM for the largest ring
+#ifdef TARGET_NANOX
+#define RING_POINT_CACHE_SIZE 12
+#else
+#define RING_POINT_CACHE_SIZE RING_PARTICIPANTS
+#endif
+
+typedef struct derivation_cache_entry_s
+{
+    unsigned char tag[KEY_SIZE]; // 32-bytes
+
+    unsigned char derivation[KEY_SIZE]; // 32-bytes
+
+    uint16_t last_used; // 2-bytes, 0 = unused
+} derivation_cache_entry_t;
+
+typedef struct ring_point_cache_entry_s
+{
+    unsigned char public_key[KEY_SIZE]; // 32-bytes
+
+    unsigned char point[SIG_STR_SIZE]; // 65-bytes, P
+
+    unsigned char hash_point[SIG_STR_SIZE]; // 65-bytes, Hp(P)
+
+    uint16_t last_used; // 2-bytes, 0 = unused
+} ring_point_cache_entry_t;
+
+typedef struct key_image_cache_entry_s
+{
+    unsigned char tag[KEY_SIZE]; // 32-bytes
+
+    unsigned char key_image[KEY_SIZE]; // 32-bytes
+} key_image_cache_entry_t;
+
+typedef struct key_image_cache_s
+{
+    key_image_cache_entry_t entries[KEY_IMAGE_CACHE_SIZE]; // 4,096-bytes
+
+    uint16_t next; // 2-bytes
+} key_image_cache_t;
+
+#ifdef TARGET_NANOX
+extern const key_image_cache_t N_state_key_image_cache_pic;
+#define N_key_image_cache ((volatile key_image_cache_t *)PIC(&N_state_key_image_cache_pic))
+#else
+extern key_image_cache_t N_state_key_image_cache_pic;
+#define N_key_image_cache ((WIDE key_image_cache_t *)PIC(&N_state_key_image_cache_pic))
+#endif
+
+uint16_t cache_derivation_get(unsigned char *derivation, const unsigned char *tag);
+
+uint16_t cache_derivation_put(const unsigned char *tag, const unsigned char *derivation);
+
+uint16_t cache_ring_point_get(unsigned char *point, unsigned char *hash_point, const unsigned char *public_key);
+
+uint16_t cache_ring_point_put(
+    const unsigned char *public_key,
+    const unsigned char *point,
+    const unsigned char *hash_point);
+
+uint16_t cache_key_image_get(
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key);
+
+uint16_t cache_key_image_put(
+    const unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key);
+
+uint16_t cache_key_image_reset();
+
+uint16_t cache_reset();
+
+#endif // CACHE_H
@@ -0,0 +1,1200 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "ed25519.h"
+
+// the bits of every limb, alternately 26 and 25 so that ten of them make 255
+#define LIMB_BITS(i) (((i) & 1) ? 25 : 26)
+
+// x = X / Z, y = Y / Z (the doublings only need these)
+typedef struct
+{
+    ed25519_fe X;
+    ed25519_fe Y;
+    ed25519_fe Z;
+} ed25519_p2;
+
+// the completed point that the additions and doublings produce: x = X / Z, y = Y / T
+typedef struct
+{
+    ed25519_fe X;
+    ed25519_fe Y;
+    ed25519_fe Z;
+    ed25519_fe T;
+} ed25519_p1p1;
+
+// an addend prepared for the additions
+typedef struct
+{
+    ed25519_fe YplusX;
+    ed25519_fe YminusX;
+    ed25519_fe Z;
+    ed25519_fe T2d;
+} ed25519_cached;
+
+// an addend in affine coordinates (Z = 1) prepared for the mixed additions
+typedef struct
+{
+    ed25519_fe yplusx;
+    ed25519_fe yminusx;
+    ed25519_fe xy2d;
+} ed25519_precomp;
+
+// d = -121665 / 121666
+static const ed25519_fe C_d = {
+    -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116};
+
+// 2 * d
+static const ed25519_fe C_d2 = {
+    -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199};
+
+// sqrt(-1)
+static const ed25519_fe C_sqrtm1 = {
+    -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482};
+
+static void fe_0(ed25519_fe h)
+{
+    memset(h, 0, sizeof(ed25519_fe));
+}
+
+static void fe_1(ed25519_fe h)
+{
+    fe_0(h);
+
+    h[0] = 1;
+}
+
+static void fe_copy(ed25519_fe h, const ed25519_fe f)
+{
+    memmove(h, f, sizeof(ed25519_fe));
+}
+
+static void fe_add(ed25519_fe h, const ed25519_fe f, const ed25519_fe g)
+{
+    for (size_t i = 0; i < 10; i++)
+    {
+        h[i] = f[i] + g[i];
+    }
+}
+
+static void fe_sub(ed25519_fe h, const ed25519_fe f, const ed25519_fe g)
+{
+    for (size_t i = 0; i < 10; i++)
+    {
+        h[i] = f[i] - g[i];
+    }
+}
+
+static void fe_neg(ed25519_fe h, const ed25519_fe f)
+{
+    for (size_t i = 0; i < 10; i++)
+    {
+        h[i] = -f[i];
+    }
+}
+
+/**
+ * h = g if b = 1, h is left as it is if b = 0, in constant time
+ */
+static void fe_cmov(ed25519_fe h, const ed25519_fe g, const unsigned int b)
+{
+    const int32_t mask = -(int32_t)b;
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        h[i] ^= mask & (h[i] ^ g[i]);
+    }
+}
+
+/**
+ * Carries the 64-bit limbs of a product back into 25.5-bit limbs, in the order of ref10
+ * so that every limb stays within the bounds that the next multiplication takes
+ */
+static void fe_carry(ed25519_fe h, int64_t *t)
+{
+    static const uint8_t C_order[12] = {0, 4, 1, 5, 2, 6, 3, 7, 4, 8, 9, 0};
+
+    for (size_t k = 0; k < sizeof(C_order); k++)
+    {
+        const uint8_t i = C_order[k];
+
+        const int64_t carry = (t[i] + ((int64_t)1 << (LIMB_BITS(i) - 1))) >> LIMB_BITS(i);
+
+        t[i] -= carry * ((int64_t)1 << LIMB_BITS(i));
+
+        if (i == 9)
+        {
+            t[0] += carry * 19;
+        }
+        else
+        {
+            t[i + 1] += carry;
+        }
+    }
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        h[i] = (int32_t)t[i];
+    }
+}
+
+/**
+ * h = f * g, a limb product is doubled when both limbs are odd (their weights round up twice)
+ * and folds back by 19 when it reaches 2^255
+ */
+static void fe_mul(ed25519_fe h, const ed25519_fe f, const ed25519_fe g)
+{
+    int64_t t[10] = {0};
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        const int64_t f1 = f[i];
+
+        const int64_t f2 = f[i] * (int64_t)((i & 1) + 1);
+
+        for (size_t j = 0; j < 10; j++)
+        {
+            const int64_t product = ((j & 1) ? f2 : f1) * g[j];
+
+            if (i + j < 10)
+            {
+                t[i + j] += product;
+            }
+            else
+            {
+                t[i + j - 10] += product * 19;
+            }
+        }
+    }
+
+    fe_carry(h, t);
+}
+
+/**
+ * h = f^2, every cross product is only computed once
+ */
+static void fe_sq(ed25519_fe h, const ed25519_fe f)
+{
+    int64_t t[10] = {0};
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        for (size_t j = i; j < 10; j++)
+        {
+            int64_t product = (int64_t)f[i] * f[j];
+
+            if (i != j)
+            {
+                product *= 2;
+            }
+
+            if ((i & 1) && (j & 1))
+            {
+                product *= 2;
+            }
+
+            if (i + j < 10)
+            {
+                t[i + j] += product;
+            }
+            else
+            {
+                t[i + j - 10] += product * 19;
+            }
+        }
+    }
+
+    fe_carry(h, t);
+}
+
+// h = f^(2^n)
+static void fe_sqn(ed25519_fe h, const ed25519_fe f, const unsigned int n)
+{
+    fe_sq(h, f);
+
+    for (unsigned int i = 1; i < n; i++)
+    {
+        fe_sq(h, h);
+    }
+}
+
+/**
+ * Computes z^(2^250 - 1) which both z^(p - 2) and z^((p - 5) / 8) are built on
+ * @param out z^(2^250 - 1)
+ * @param z11 z^11
+ * @param z the element
+ */
+static void fe_pow2250m1(ed25519_fe out, ed25519_fe z11, const ed25519_fe z)
+{
+    ed25519_fe t0, t1, t2;
+
+    fe_sq(t0, z);                    // z^2
+    fe_sqn(t1, t0, 2);               // z^8
+    fe_mul(t1, z, t1);               // z^9
+    fe_mul(z11, t0, t1);             // z^11
+    fe_sq(t0, z11);                  // z^22
+    fe_mul(t1, t1, t0);              // z^(2^5 - 1)
+    fe_sqn(t0, t1, 5);
+    fe_mul(t1, t0, t1);              // z^(2^10 - 1)
+    fe_sqn(t0, t1, 10);
+    fe_mul(t0, t0, t1);              // z^(2^20 - 1)
+    fe_sqn(t2, t0, 20);
+    fe_mul(t0, t2, t0);              // z^(2^40 - 1)
+    fe_sqn(t0, t0, 10);
+    fe_mul(t1, t0, t1);              // z^(2^50 - 1)
+    fe_sqn(t0, t1, 50);
+    fe_mul(t0, t0, t1);              // z^(2^100 - 1)
+    fe_sqn(t2, t0, 100);
+    fe_mul(t0, t2, t0);              // z^(2^200 - 1)
+    fe_sqn(t0, t0, 50);
+    fe_mul(out, t0, t1);             // z^(2^250 - 1)
+}
+
+// h = 1 / z = z^(p - 2) = z^(2^255 - 21)
+static void fe_invert(ed25519_fe h, const ed25519_fe z)
+{
+    ed25519_fe t, z11;
+
+    fe_pow2250m1(t, z11, z);
+
+    fe_sqn(t, t, 5);
+
+    fe_mul(h, t, z11);
+}
+
+// h = z^((p - 5) / 8) = z^(2^252 - 3)
+static void fe_pow22523(ed25519_fe h, const ed25519_fe z)
+{
+    ed25519_fe t, z11;
+
+    fe_pow2250m1(t, z11, z);
+
+    fe_sqn(t, t, 2);
+
+    fe_mul(h, t, z);
+}
+
+static uint32_t load_le(const unsigned char *s, const size_t n)
+{
+    uint32_t value = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        value |= (uint32_t)s[i] << (8 * i);
+    }
+
+    return value;
+}
+
+/**
+ * Loads 255 bits (LE), the top bit is ignored and a value of p or more is only reduced
+ * by the arithmetic that follows
+ */
+static void fe_frombytes(ed25519_fe h, const unsigned char *s)
+{
+    int64_t t[10];
+
+    t[0] = load_le(s, 4);
+    t[1] = load_le(s + 4, 3) << 6;
+    t[2] = load_le(s + 7, 3) << 5;
+    t[3] = load_le(s + 10, 3) << 3;
+    t[4] = load_le(s + 13, 3) << 2;
+    t[5] = load_le(s + 16, 4);
+    t[6] = load_le(s + 20, 3) << 7;
+    t[7] = load_le(s + 23, 3) << 5;
+    t[8] = load_le(s + 26, 3) << 4;
+    t[9] = (load_le(s + 29, 3) & 0x7fffff) << 2;
+
+    fe_carry(h, t);
+}
+
+/**
+ * Stores the element fully reduced (LE)
+ */
+static void fe_tobytes(unsigned char *s, const ed25519_fe f)
+{
+    int32_t h[10];
+
+    int32_t q;
+
+    size_t i;
+
+    // q = 1 exactly when the element is p or more
+    q = (19 * f[9] + ((int32_t)1 << 24)) >> 25;
+
+    for (i = 0; i < 10; i++)
+    {
+        q = (f[i] + q) >> LIMB_BITS(i);
+    }
+
+    // h = f - q * p, which leaves a carry out of the top limb that is dropped
+    h[0] = f[0] + 19 * q;
+
+    for (i = 1; i < 10; i++)
+    {
+        h[i] = f[i];
+    }
+
+    for (i = 0; i < 9; i++)
+    {
+        const int32_t carry = h[i] >> LIMB_BITS(i);
+
+        h[i + 1] += carry;
+
+        h[i] -= carry * ((int32_t)1 << LIMB_BITS(i));
+    }
+
+    h[9] &= ((int32_t)1 << 25) - 1;
+
+    // pack the limbs, limb i starts at bit ceil(25.5 * i)
+    memset(s, 0, 32);
+
+    unsigned int bit = 0;
+
+    for (i = 0; i < 10; i++)
+    {
+        uint32_t limb = (uint32_t)h[i];
+
+        for (unsigned int b = 0; b < LIMB_BITS(i); b += 8)
+        {
+            const unsigned int at = bit + b;
+
+            const uint32_t chunk = limb >> b;
+
+            s[at / 8] |= (unsigned char)(chunk << (at % 8));
+
+            if (at % 8 != 0 && at / 8 + 1 < 32)
+            {
+                s[at / 8 + 1] |= (unsigned char)(chunk >> (8 - (at % 8)));
+            }
+        }
+
+        bit += LIMB_BITS(i);
+    }
+}
+
+static int fe_isnegative(const ed25519_fe f)
+{
+    unsigned char s[32];
+
+    fe_tobytes(s, f);
+
+    return s[0] & 1;
+}
+
+static int fe_isnonzero(const ed25519_fe f)
+{
+    unsigned char s[32];
+
+    unsigned char bits = 0;
+
+    fe_tobytes(s, f);
+
+    for (size_t i = 0; i < sizeof(s); i++)
+    {
+        bits |= s[i];
+    }
+
+    return bits != 0;
+}
+
+// loads a (BE) coordinate of the uncompressed form
+static void fe_load_be(ed25519_fe h, const unsigned char *be)
+{
+    unsigned char le[32];
+
+    for (size_t i = 0; i < 32; i++)
+    {
+        le[i] = be[31 - i];
+    }
+
+    fe_frombytes(h, le);
+}
+
+// stores a coordinate of the uncompressed form (BE)
+static void fe_store_be(unsigned char *be, const ed25519_fe f)
+{
+    unsigned char le[32];
+
+    fe_tobytes(le, f);
+
+    for (size_t i = 0; i < 32; i++)
+    {
+        be[i] = le[31 - i];
+    }
+}
+
+static void ge_p3_load(ed25519_p3 *r, const unsigned char *point)
+{
+    fe_load_be(r->X, point + 1);
+
+    fe_load_be(r->Y, point + 1 + 32);
+
+    fe_1(r->Z);
+
+    fe_mul(r->T, r->X, r->Y);
+}
+
+static void ge_p2_unload(unsigned char *r, const ed25519_p2 *p)
+{
+    ed25519_fe recip, x, y;
+
+    fe_invert(recip, p->Z);
+
+    fe_mul(x, p->X, recip);
+
+    fe_mul(y, p->Y, recip);
+
+    r[0] = 0x04;
+
+    fe_store_be(r + 1, x);
+
+    fe_store_be(r + 1 + 32, y);
+}
+
+static void ge_precomp_load(ed25519_precomp *r, const unsigned char *point)
+{
+    ed25519_fe x, y;
+
+    fe_load_be(x, point + 1);
+
+    fe_load_be(y, point + 1 + 32);
+
+    fe_add(r->yplusx, y, x);
+
+    fe_sub(r->yminusx, y, x);
+
+    fe_mul(r->xy2d, x, y);
+
+    fe_mul(r->xy2d, r->xy2d, C_d2);
+}
+
+static void ge_p3_to_p2(ed25519_p2 *r, const ed25519_p3 *p)
+{
+    fe_copy(r->X, p->X);
+
+    fe_copy(r->Y, p->Y);
+
+    fe_copy(r->Z, p->Z);
+}
+
+static void ge_p3_to_cached(ed25519_cached *r, const ed25519_p3 *p)
+{
+    fe_add(r->YplusX, p->Y, p->X);
+
+    fe_sub(r->YminusX, p->Y, p->X);
+
+    fe_copy(r->Z, p->Z);
+
+    fe_mul(r->T2d, p->T, C_d2);
+}
+
+static void ge_p1p1_to_p2(ed25519_p2 *r, const ed25519_p1p1 *p)
+{
+    fe_mul(r->X, p->X, p->T);
+
+    fe_mul(r->Y, p->Y, p->Z);
+
+    fe_mul(r->Z, p->Z, p->T);
+}
+
+static void ge_p1p1_to_p3(ed25519_p3 *r, const ed25519_p1p1 *p)
+{
+    fe_mul(r->X, p->X, p->T);
+
+    fe_mul(r->Y, p->Y, p->Z);
+
+    fe_mul(r->Z, p->Z, p->T);
+
+    fe_mul(r->T, p->X, p->Y);
+}
+
+// r = 2 * p
+static void ge_p2_dbl(ed25519_p1p1 *r, const ed25519_p2 *p)
+{
+    ed25519_fe t0;
+
+    fe_sq(r->X, p->X);
+
+    fe_sq(r->Z, p->Y);
+
+    fe_sq(r->T, p->Z);
+
+    fe_add(r->T, r->T, r->T);
+
+    fe_add(r->Y, p->X, p->Y);
+
+    fe_sq(t0, r->Y);
+
+    fe_add(r->Y, r->Z, r->X);
+
+    fe_sub(r->Z, r->Z, r->X);
+
+    fe_sub(r->X, t0, r->Y);
+
+    fe_sub(r->T, r->T, r->Z);
+}
+
+static void ge_p3_dbl(ed25519_p1p1 *r, const ed25519_p3 *p)
+{
+    ed25519_p2 q;
+
+    ge_p3_to_p2(&q, p);
+
+    ge_p2_dbl(r, &q);
+}
+
+// r = p + q, or p - q when subtract is set
+static void ge_add(ed25519_p1p1 *r, const ed25519_p3 *p, const ed25519_cached *q, const bool subtract)
+{
+    ed25519_fe t0;
+
+    fe_add(r->X, p->Y, p->X);
+
+    fe_sub(r->Y, p->Y, p->X);
+
+    fe_mul(r->Z, r->X, (subtract) ? q->YminusX : q->YplusX);
+
+    fe_mul(r->Y, r->Y, (subtract) ? q->YplusX : q->YminusX);
+
+    fe_mul(r->T, q->T2d, p->T);
+
+    fe_mul(r->X, p->Z, q->Z);
+
+    fe_add(t0, r->X, r->X);
+
+    fe_sub(r->X, r->Z, r->Y);
+
+    fe_add(r->Y, r->Z, r->Y);
+
+    if (subtract)
+    {
+        fe_sub(r->Z, t0, r->T);
+
+        fe_add(r->T, t0, r->T);
+    }
+    else
+    {
+        fe_add(r->Z, t0, r->T);
+
+        fe_sub(r->T, t0, r->T);
+    }
+}
+
+// r = p + q, or p - q when subtract is set, for an affine q
+static void ge_madd(ed25519_p1p1 *r, const ed25519_p3 *p, const ed25519_precomp *q, const bool subtract)
+{
+    ed25519_fe t0;
+
+    fe_add(r->X, p->Y, p->X);
+
+    fe_sub(r->Y, p->Y, p->X);
+
+    fe_mul(r->Z, r->X, (subtract) ? q->yminusx : q->yplusx);
+
+    fe_mul(r->Y, r->Y, (subtract) ? q->yplusx : q->yminusx);
+
+    fe_mul(r->T, q->xy2d, p->T);
+
+    fe_add(t0, p->Z, p->Z);
+
+    fe_sub(r->X, r->Z, r->Y);
+
+    fe_add(r->Y, r->Z, r->Y);
+
+    if (subtract)
+    {
+        fe_sub(r->Z, t0, r->T);
+
+        fe_add(r->T, t0, r->T);
+    }
+    else
+    {
+        fe_add(r->Z, t0, r->T);
+
+        fe_sub(r->T, t0, r->T);
+    }
+}
+
+static void ge_cached_identity(ed25519_cached *r)
+{
+    fe_1(r->YplusX);
+
+    fe_1(r->YminusX);
+
+    fe_1(r->Z);
+
+    fe_0(r->T2d);
+}
+
+static void ge_cached_cmov(ed25519_cached *r, const ed25519_cached *q, const unsigned int b)
+{
+    fe_cmov(r->YplusX, q->YplusX, b);
+
+    fe_cmov(r->YminusX, q->YminusX, b);
+
+    fe_cmov(r->Z, q->Z, b);
+
+    fe_cmov(r->T2d, q->T2d, b);
+}
+
+#define SCALAR_BIT(s, size, i) (((i) < 8 * (size)) ? ((s[(size)-1 - ((i) / 8)] >> ((i) % 8)) & 1) : 0)
+
+void ed25519_scalar_recode(signed char *e, const unsigned char *a, const size_t size)
+{
+    const size_t windows = ED25519_DIGITS_SIZE(size);
+
+    signed char carry = 0;
+
+    for (size_t i = 0; i < windows - 1; i++)
+    {
+        e[i] = SCALAR_BIT(a, size, 3 * i) | (SCALAR_BIT(a, size, 3 * i + 1) << 1)
+               | (SCALAR_BIT(a, size, 3 * i + 2) << 2);
+
+        e[i] += carry;
+
+        carry = (e[i] + 4) >> 3;
+
+        e[i] -= carry << 3;
+    }
+
+    e[windows - 1] = carry;
+}
+
+void ed25519_scalarmult(unsigned char *r, const unsigned char *P, const unsigned char *a, const size_t size)
+{
+    signed char e[ED25519_DIGITS_SIZE(ED25519_SCALAR_MAX_SIZE)];
+
+    ed25519_scalar_recode(e, a, size);
+
+    ed25519_scalarmult_digits(r, P, e, ED25519_DIGITS_SIZE(size));
+
+    explicit_bzero(e, sizeof(e));
+}
+
+void ed25519_scalarmult_digits(unsigned char *r, const unsigned char *P, const signed char *e, const size_t windows)
+{
+    ed25519_cached table[4]; // P, 2P, 3P, 4P
+
+    ed25519_cached t;
+
+    ed25519_fe swap;
+
+    ed25519_p3 acc, p;
+
+    ed25519_p1p1 sum;
+
+    ed25519_p2 q;
+
+    size_t i, j;
+
+    ge_p3_load(&p, P);
+
+    ge_p3_to_cached(&table[0], &p);
+
+    ge_p3_dbl(&sum, &p);
+
+    ge_p1p1_to_p3(&acc, &sum);
+
+    ge_p3_to_cached(&table[1], &acc);
+
+    ge_add(&sum, &acc, &table[0], false);
+
+    ge_p1p1_to_p3(&p, &sum);
+
+    ge_p3_to_cached(&table[2], &p);
+
+    ge_p3_dbl(&sum, &acc);
+
+    ge_p1p1_to_p3(&p, &sum);
+
+    ge_p3_to_cached(&table[3], &p);
+
+    ed25519_p3_identity(&acc);
+
+    for (i = windows; i-- > 0;)
+    {
+        const unsigned char negative = ((unsigned char)e[i]) >> 7;
+
+        const unsigned char magnitude = e[i] - ((-negative & e[i]) << 1);
+
+        if (i != windows - 1)
+        {
+            ge_p3_dbl(&sum, &acc);
+
+            ge_p1p1_to_p2(&q, &sum);
+
+            ge_p2_dbl(&sum, &q);
+
+            ge_p1p1_to_p2(&q, &sum);
+
+            ge_p2_dbl(&sum, &q);
+
+            ge_p1p1_to_p3(&acc, &sum);
+        }
+
+        // touch every entry so that the access pattern does not depend on the digit
+        ge_cached_identity(&t);
+
+        for (j = 0; j < 4; j++)
+        {
+            ge_cached_cmov(&t, &table[j], ((uint32_t)(magnitude ^ (j + 1)) - 1) >> 31);
+        }
+
+        // -(Y + X, Y - X, Z, 2dT) = (Y - X, Y + X, Z, -2dT)
+        fe_copy(swap, t.YplusX);
+
+        fe_cmov(t.YplusX, t.YminusX, negative);
+
+        fe_cmov(t.YminusX, swap, negative);
+
+        fe_neg(swap, t.T2d);
+
+        fe_cmov(t.T2d, swap, negative);
+
+        ge_add(&sum, &acc, &t, false);
+
+        ge_p1p1_to_p3(&acc, &sum);
+    }
+
+    ge_p3_to_p2(&q, &acc);
+
+    ge_p2_unload(r, &q);
+
+    explicit_bzero(table, sizeof(table));
+
+    explicit_bzero(&t, sizeof(t));
+
+    explicit_bzero(swap, sizeof(swap));
+
+    explicit_bzero(&acc, sizeof(acc));
+
+    explicit_bzero(&p, sizeof(p));
+
+    explicit_bzero(&sum, sizeof(sum));
+
+    explicit_bzero(&q, sizeof(q));
+}
+
+/**
+ * Recodes a (BE) scalar into odd signed digits of at most the given magnitude with runs of
+ * zeros in between (a sliding window NAF), as ref10 does for its double scalar multiplication
+ * @param r the digits, one per bit and one more for a carry out of the top bit
+ * @param a the (BE) scalar {32 bytes}
+ * @param limit the largest magnitude of a digit (2^w - 1 for a window of w + 1 bits)
+ */
+static void slide(signed char *r, const unsigned char *a, const int limit)
+{
+    int i, b, k;
+
+    for (i = 0; i < 256; i++)
+    {
+        r[i] = SCALAR_BIT(a, 32, i);
+    }
+
+    r[256] = 0;
+
+    for (i = 0; i < 257; i++)
+    {
+        if (!r[i])
+        {
+            continue;
+        }
+
+        for (b = 1; b <= 6 && i + b < 257; b++)
+        {
+            if (!r[i + b])
+            {
+                continue;
+            }
+
+            if (r[i] + (r[i + b] << b) <= limit)
+            {
+                r[i] += r[i + b] << b;
+
+                r[i + b] = 0;
+            }
+            else if (r[i] - (r[i + b] << b) >= -limit)
+            {
+                r[i] -= r[i + b] << b;
+
+                for (k = i + b; k < 257; k++)
+                {
+                    if (!r[k])
+                    {
+                        r[k] = 1;
+
+                        break;
+                    }
+
+                    r[k] = 0;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * r = (a * A) + (b * B) where A is a table of affine odd multiples (added as mixed additions)
+ * and B is a table of odd multiples already prepared for the additions
+ */
+static void ge_double_scalarmult_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char (*A)[ED25519_POINT_SIZE],
+    const size_t a_count,
+    const unsigned char *b,
+    const ed25519_cached *B,
+    const size_t b_count)
+{
+    signed char aslide[257], bslide[257];
+
+    ed25519_precomp addend;
+
+    ed25519_p1p1 t;
+
+    ed25519_p3 u;
+
+    ed25519_p2 acc;
+
+    int i;
+
+    slide(aslide, a, 2 * (int)a_count - 1);
+
+    slide(bslide, b, 2 * (int)b_count - 1);
+
+    fe_0(acc.X);
+
+    fe_1(acc.Y);
+
+    fe_1(acc.Z);
+
+    // skip the doublings of the identity
+    for (i = 256; i >= 0 && !aslide[i] && !bslide[i]; i--)
+    {
+    }
+
+    for (; i >= 0; i--)
+    {
+        ge_p2_dbl(&t, &acc);
+
+        if (aslide[i] != 0)
+        {
+            ge_p1p1_to_p3(&u, &t);
+
+            ge_precomp_load(&addend, A[((aslide[i] > 0) ? aslide[i] : -aslide[i]) / 2]);
+
+            ge_madd(&t, &u, &addend, aslide[i] < 0);
+        }
+
+        if (bslide[i] != 0)
+        {
+            ge_p1p1_to_p3(&u, &t);
+
+            ge_add(&t, &u, &B[((bslide[i] > 0) ? bslide[i] : -bslide[i]) / 2], bslide[i] < 0);
+        }
+
+        ge_p1p1_to_p2(&acc, &t);
+    }
+
+    ge_p2_unload(r, &acc);
+}
+
+// B, 3B prepared for the additions, the B of the double scalar multiplications
+static void ge_prepare_odd_multiples(ed25519_cached *table, const unsigned char *B)
+{
+    ed25519_p3 p, p2;
+
+    ed25519_p1p1 t;
+
+    ge_p3_load(&p, B);
+
+    ge_p3_to_cached(&table[0], &p);
+
+    ge_p3_dbl(&t, &p);
+
+    ge_p1p1_to_p3(&p2, &t);
+
+    ge_add(&t, &p2, &table[0], false);
+
+    ge_p1p1_to_p3(&p, &t);
+
+    ge_p3_to_cached(&table[1], &p);
+}
+
+void ed25519_double_scalarmult_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char *P,
+    const unsigned char *b,
+    const unsigned char *Q)
+{
+    ed25519_cached table[2];
+
+    ge_prepare_odd_multiples(table, Q);
+
+    ge_double_scalarmult_vartime(r, a, (const unsigned char(*)[ED25519_POINT_SIZE])P, 1, b, table, 2);
+}
+
+void ed25519_double_scalarmult_table_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char (*A)[ED25519_POINT_SIZE],
+    const size_t count,
+    const unsigned char *b,
+    const unsigned char *B)
+{
+    ed25519_cached table[2];
+
+    ge_prepare_odd_multiples(table, B);
+
+    ge_double_scalarmult_vartime(r, a, A, count, b, table, 2);
+}
+
+void ed25519_odd_multiples(unsigned char (*table)[ED25519_POINT_SIZE], const unsigned char *P, const size_t count)
+{
+    ed25519_p3 multiples[ED25519_ODD_MULTIPLES_MAX];
+
+    ed25519_fe products[ED25519_ODD_MULTIPLES_MAX], recip, x, y;
+
+    ed25519_cached P2;
+
+    ed25519_p1p1 t;
+
+    size_t i;
+
+    ge_p3_load(&multiples[0], P);
+
+    ge_p3_dbl(&t, &multiples[0]);
+
+    ge_p1p1_to_p3(&multiples[1], &t);
+
+    ge_p3_to_cached(&P2, &multiples[1]);
+
+    for (i = 1; i < count; i++)
+    {
+        ge_add(&t, &multiples[i - 1], &P2, false);
+
+        ge_p1p1_to_p3(&multiples[i], &t);
+    }
+
+    // invert every Z at once: products[i] = Z_0 * .. * Z_i
+    fe_copy(products[0], multiples[0].Z);
+
+    for (i = 1; i < count; i++)
+    {
+        fe_mul(products[i], products[i - 1], multiples[i].Z);
+    }
+
+    fe_invert(recip, products[count - 1]);
+
+    for (i = count; i-- > 0;)
+    {
+        ed25519_fe inverse;
+
+        // 1 / Z_i = (Z_0 * .. * Z_(i - 1)) / (Z_0 * .. * Z_i)
+        if (i > 0)
+        {
+            fe_mul(inverse, recip, products[i - 1]);
+
+            fe_mul(recip, recip, multiples[i].Z);
+        }
+        else
+        {
+            fe_copy(inverse, recip);
+        }
+
+        fe_mul(x, multiples[i].X, inverse);
+
+        fe_mul(y, multiples[i].Y, inverse);
+
+        table[i][0] = 0x04;
+
+        fe_store_be(table[i] + 1, x);
+
+        fe_store_be(table[i] + 1 + 32, y);
+    }
+}
+
+void ed25519_frombytes(unsigned char *point, const unsigned char *key)
+{
+    ed25519_fe x, y, u, v, v3, vxx, check;
+
+    const unsigned char sign = key[31] >> 7;
+
+    // x^2 = (y^2 - 1) / (d * y^2 + 1)
+    fe_frombytes(y, key);
+
+    fe_sq(u, y);
+
+    fe_mul(v, u, C_d);
+
+    fe_1(check);
+
+    fe_sub(u, u, check);
+
+    fe_add(v, v, check);
+
+    // x = u * v^3 * (u * v^7)^((p - 5) / 8)
+    fe_sq(v3, v);
+
+    fe_mul(v3, v3, v);
+
+    fe_sq(x, v3);
+
+    fe_mul(x, x, v);
+
+    fe_mul(x, x, u);
+
+    fe_pow22523(x, x);
+
+    fe_mul(x, x, v3);
+
+    fe_mul(x, x, u);
+
+    fe_sq(vxx, x);
+
+    fe_mul(vxx, vxx, v);
+
+    fe_sub(check, vxx, u);
+
+    if (fe_isnonzero(check))
+    {
+        fe_add(check, vxx, u);
+
+        if (fe_isnonzero(check))
+        {
+            THROW(INVALID_PARAMETER);
+        }
+
+        fe_mul(x, x, C_sqrtm1);
+    }
+
+    if (!fe_isnonzero(x) && sign)
+    {
+        THROW(INVALID_PARAMETER);
+    }
+
+    if (fe_isnegative(x) != sign)
+    {
+        fe_neg(x, x);
+    }
+
+    point[0] = 0x04;
+
+    fe_store_be(point + 1, x);
+
+    fe_store_be(point + 1 + 32, y);
+}
+
+void ed25519_tobytes(unsigned char *key, const unsigned char *point)
+{
+    // both coordinates are kept fully reduced so this is y (LE) with the sign of x on top
+    for (size_t i = 0; i < 32; i++)
+    {
+        key[i] = point[1 + 32 + 31 - i];
+    }
+
+    key[31] |= (point[32] & 1) << 7;
+}
+
+void ed25519_add(unsigned char *r, const unsigned char *p, const unsigned char *q)
+{
+    ed25519_p3 P, Q;
+
+    ed25519_cached addend;
+
+    ed25519_p1p1 t;
+
+    ed25519_p2 sum;
+
+    ge_p3_load(&P, p);
+
+    ge_p3_load(&Q, q);
+
+    ge_p3_to_cached(&addend, &Q);
+
+    ge_add(&t, &P, &addend, false);
+
+    ge_p1p1_to_p2(&sum, &t);
+
+    ge_p2_unload(r, &sum);
+}
+
+void ed25519_mul8(unsigned char *r, const unsigned char *P)
+{
+    ed25519_p3 p;
+
+    ed25519_p1p1 t;
+
+    ed25519_p2 q;
+
+    ge_p3_load(&p, P);
+
+    ge_p3_to_p2(&q, &p);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        ge_p2_dbl(&t, &q);
+
+        ge_p1p1_to_p2(&q, &t);
+    }
+
+    ge_p2_unload(r, &q);
+}
+
+void ed25519_p3_identity(ed25519_p3 *p)
+{
+    fe_0(p->X);
+
+    fe_1(p->Y);
+
+    fe_1(p->Z);
+
+    fe_0(p->T);
+}
+
+void ed25519_p3_add_affine(ed25519_p3 *p, const unsigned char *Q)
+{
+    ed25519_precomp addend;
+
+    ed25519_p1p1 t;
+
+    ge_precomp_load(&addend, Q);
+
+    ge_madd(&t, p, &addend, false);
+
+    ge_p1p1_to_p3(p, &t);
+
+    explicit_bzero(&addend, sizeof(addend));
+
+    explicit_bzero(&t, sizeof(t));
+}
+
+void ed25519_p3_unload(unsigned char *r, const ed25519_p3 *p)
+{
+    ed25519_p2 q;
+
+    ge_p3_to_p2(&q, p);
+
+    ge_p2_unload(r, &q);
+
+    explicit_bzero(&q, sizeof(q));
+}
\ No newline at end of file
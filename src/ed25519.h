@@ -0,0 +1,168 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef ED25519_H
+#define ED25519_H
+
+#include <common.h>
+
+#define ED25519_POINT_SIZE 65 // bytes, 0x04 || x || y (BE) as the cx methods take them
+#define ED25519_SCALAR_MAX_SIZE 33 // bytes, as large as the cofactored scalars of hw_sc_load8
+#define ED25519_ODD_MULTIPLES_MAX 4 // P, 3P, 5P, 7P
+
+// the signed 3-bit digits of a scalar of the given size in bytes, and one more for the carry
+#define ED25519_DIGITS_SIZE(size) ((8 * (size) + 2) / 3 + 1)
+
+/**
+ * The group operations of Ed25519 computed by the app itself instead of by cx_ecfp_* and
+ * cx_edward_*, so that a chain of operations stays in extended coordinates (X : Y : Z : T) on
+ * field elements of ten 25.5-bit limbs (as ref10 does) and only pays for the inversion back to
+ * affine coordinates once at its end. Points come and go in the uncompressed form of the cx
+ * methods so that the rest of hw_crypto.c does not see which backend it runs on. It is only
+ * used when built with ED25519_IN_APP=1
+ */
+typedef int32_t ed25519_fe[10];
+
+// extended coordinates: x = X / Z, y = Y / Z, x * y = T / Z
+typedef struct ed25519_p3_s
+{
+    ed25519_fe X;
+    ed25519_fe Y;
+    ed25519_fe Z;
+    ed25519_fe T;
+} ed25519_p3;
+
+/**
+ * Decompresses a public key, an invalid point raises INVALID_PARAMETER as
+ * cx_edward_decompress_point does
+ * @param point the uncompressed point
+ * @param key the public key
+ */
+void ed25519_frombytes(unsigned char *point, const unsigned char *key);
+
+/**
+ * Compresses an uncompressed point into a public key
+ * @param key the public key
+ * @param point the uncompressed point
+ */
+void ed25519_tobytes(unsigned char *key, const unsigned char *point);
+
+/**
+ * r = p + q
+ * @param r the resulting uncompressed point (may be the same as p or q)
+ * @param p the first uncompressed point
+ * @param q the second uncompressed point
+ */
+void ed25519_add(unsigned char *r, const unsigned char *p, const unsigned char *q);
+
+/**
+ * r = 8 * P
+ * @param r the resulting uncompressed point (may be the same as P)
+ * @param P the uncompressed point
+ */
+void ed25519_mul8(unsigned char *r, const unsigned char *P);
+
+/**
+ * r = a * P in constant time with signed 3-bit windows over { P, 2P, 3P, 4P }
+ * @param r the resulting uncompressed point (may be the same as P)
+ * @param P the uncompressed point
+ * @param a the (BE) scalar, not reduced
+ * @param size the size of the scalar, no more than ED25519_SCALAR_MAX_SIZE
+ */
+void ed25519_scalarmult(unsigned char *r, const unsigned char *P, const unsigned char *a, const size_t size);
+
+/**
+ * Recodes a scalar, in constant time, into the signed digits -4 .. 3 that ed25519_scalarmult
+ * walks so that a scalar that is multiplied by again and again is only recoded once
+ * @param e the digits, least significant first {ED25519_DIGITS_SIZE(size) bytes}
+ * @param a the (BE) scalar, not reduced
+ * @param size the size of the scalar, no more than ED25519_SCALAR_MAX_SIZE
+ */
+void ed25519_scalar_recode(signed char *e, const unsigned char *a, const size_t size);
+
+/**
+ * r = a * P as ed25519_scalarmult computes it, from the digits of a instead of a itself
+ * @param r the resulting uncompressed point (may be the same as P)
+ * @param P the uncompressed point
+ * @param e the digits of a as recoded by ed25519_scalar_recode
+ * @param windows the number of digits, ED25519_DIGITS_SIZE of the size of a
+ */
+void ed25519_scalarmult_digits(unsigned char *r, const unsigned char *P, const signed char *e, const size_t windows);
+
+/**
+ * r = (a * P) + (b * Q) over sliding signed windows, the additions depend on the bits of the
+ * scalars so this must only be used where both scalars are public (signature values)
+ * @param r the resulting uncompressed point (may be the same as P or Q)
+ * @param a the first (BE) scalar
+ * @param P the first uncompressed point
+ * @param b the second (BE) scalar
+ * @param Q the second uncompressed point
+ */
+void ed25519_double_scalarmult_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char *P,
+    const unsigned char *b,
+    const unsigned char *Q);
+
+/**
+ * Fills the table with the odd multiples of the uncompressed point such that
+ * table = { P, 3P, 5P, ... } with a single inversion for all of them
+ * @param table the resulting table of uncompressed points
+ * @param P the uncompressed point
+ * @param count the number of multiples, no more than ED25519_ODD_MULTIPLES_MAX
+ */
+void ed25519_odd_multiples(unsigned char (*table)[ED25519_POINT_SIZE], const unsigned char *P, const size_t count);
+
+/**
+ * r = (a * A) + (b * B) where A is given by its table of odd multiples (ed25519_odd_multiples),
+ * the same as ed25519_double_scalarmult_vartime otherwise
+ * @param r the resulting uncompressed point (may be the same as B)
+ * @param a the first (BE) scalar
+ * @param A the table of odd multiples of the first point
+ * @param count the number of multiples in the table
+ * @param b the second (BE) scalar
+ * @param B the second uncompressed point
+ */
+void ed25519_double_scalarmult_table_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char (*A)[ED25519_POINT_SIZE],
+    const size_t count,
+    const unsigned char *b,
+    const unsigned char *B);
+
+/**
+ * Sets the point to the identity (0, 1)
+ * @param p the point
+ */
+void ed25519_p3_identity(ed25519_p3 *p);
+
+/**
+ * p = p + Q where Q is given in affine coordinates (a mixed addition)
+ * @param p the point
+ * @param Q the uncompressed point
+ */
+void ed25519_p3_add_affine(ed25519_p3 *p, const unsigned char *Q);
+
+/**
+ * Converts the point back to affine coordinates
+ * @param r the resulting uncompressed point
+ * @param p the point
+ */
+void ed25519_p3_unload(unsigned char *r, const ed25519_p3 *p);
+
+#endif // ED25519_H
\ No newline at end of file
@@ -26,6 +26,8 @@
 #define ERR_OP_USER_REQUIRED 0x4001
 #define ERR_WRONG_INPUT_LENGTH 0x4002
 #define ERR_NVRAM_READ 0x4003
+#define ERR_APDU_CHAIN 0x4004
+#define ERR_WORKING_SET 0x4005
 #define ERR_UNKNOWN_ERROR 0x4444
 
 #define ERR_VARINT_DATA_RANGE 0x6000
@@ -42,6 +44,14 @@
 #define ERR_TX_DUMP 0x6508
 #define ERR_TX_INIT 0x6509
 #define ERR_TX_AMOUNT 0x6510
+#define ERR_TX_RING_SIZE 0x6511
+#define ERR_TX_MIXIN 0x6512
+#define ERR_TX_RING_KEYS 0x6513
+#define ERR_TX_RESUME 0x6514
+#define ERR_TX_SLOT 0x6515
+#define ERR_TX_PREFIX 0x6516
+#define ERR_TX_KEY_IMAGE 0x6517
+#define ERR_TX_OFFSET_SIZE 0x6518
 
 #define ERR_PRIVATE_SPEND 0x9400
 #define ERR_PRIVATE_VIEW 0x9401
@@ -70,5 +80,6 @@
 #define ERR_CHECK_KEY 0x9517
 #define ERR_CHECK_SCALAR 0x9518
 #define ERR_CHECK_SIGNATURE 0x9519
+#define ERR_UNSEAL 0x9520
 
 #endif // ERROR_CODES_H
\ No newline at end of file
@@ -37,8 +37,24 @@
 #define P1_CONFIRM 0x01
 #define P1_NON_CONFIRM 0x00
 #define P1_FIRST 0x00
-#define P1_MORE 0x80
+#define P1_MORE 0x80 // another fragment of the same request follows (see APDU_GET_RESPONSE)
+#define CHAIN_CHUNK_SIZE 255 // bytes, of a response to a chained request that go back at a time
+#ifdef TARGET_NANOX
+#define WORKING_SET_SIZE 1440 // the Nano X has the RAM to take three times as much per request
+#else
 #define WORKING_SET_SIZE 480 // reserve 480 bytes of working memory for handling APU inputs
+#endif
+
+#define OFFSET_CDATA 6
+
+// the payload of a chained request has to fit back in the IO buffer (see APDU_GET_RESPONSE)
+#define CHAIN_MAX_SIZE MIN(WORKING_SET_SIZE, IO_APDU_BUFFER_SIZE - OFFSET_CDATA)
+
+// the data of the request being handled, the handlers read their parameters from where it arrived
+#define APDU_DATA ((unsigned char *)G_io_apdu_buffer + OFFSET_CDATA)
+
+// where the response goes back from, a result that is put here is not copied again (see write_io_fixed)
+#define IO_RESPONSE ((unsigned char *)G_io_apdu_buffer)
 
 extern unsigned char G_working_set[WORKING_SET_SIZE];
 
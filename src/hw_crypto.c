@@ -18,8 +18,51 @@
 
 #include "hw_crypto.h"
 
-#define BUFFER G_io_apdu_buffer
-#define BUFFER_SIZE KEY_SIZE + SIG_SET_SIZE
+#include <cache.h>
+#include <profile.h>
+
+#include "hw_crypto_tables.h"
+
+/**
+ * The methods in this file do not open their own exception frames so any
+ * SDK exception raised by the cx methods is handled by the APDU handler that
+ * called into us. This wipes the given memory on the way out of a method
+ * while passing the status through so that every return path looks like
+ * return hw_wipe(buffer, sizeof(buffer), status);
+ * @param buffer the memory to wipe
+ * @param length the length of the memory to wipe
+ * @param status the status to return
+ * @return the status provided
+ */
+static uint16_t hw_wipe(void *buffer, const size_t length, const uint16_t status)
+{
+    explicit_bzero(buffer, length);
+
+    return status;
+}
+
+/**
+ * The methods that need scratch space for their intermediate keys keep it in a local
+ * named buffer rather than borrowing the IO buffer, which holds the request that the
+ * APDU handlers are still reading their parameters from
+ */
+#define hw_wipe_buffer(status) hw_wipe(buffer, sizeof(buffer), status)
+
+/**
+ * Statically allocated scratch space for the uncompressed point temporaries of
+ * the hw_ge_* helpers so that they do not pile up on the stack as the helpers nest.
+ * Every slot has a fixed owner level: the leaf slots are only used by helpers
+ * that never call another user of the scratch space and the caller slots are only
+ * used by helpers that call into the leaves. Lifetimes therefore never overlap and
+ * an exception unwinding through a helper can not leave a slot held
+ */
+#define SCRATCH_LEAF_SLOTS 2
+#define SCRATCH_CALLER_SLOTS 1
+
+static unsigned char L_scratch[SCRATCH_LEAF_SLOTS + SCRATCH_CALLER_SLOTS][SIG_STR_SIZE];
+
+#define SCRATCH_LEAF(n) L_scratch[n]
+#define SCRATCH_CALLER(n) L_scratch[SCRATCH_LEAF_SLOTS + n]
 
 static const uint32_t HARDENED_OFFSET = 0x80000000;
 
@@ -97,40 +140,24 @@ static void reverse32(unsigned char *result, const unsigned char *source)
 
 /**
  * Loads the public key into a raw point for further cx manipulation
+ * An invalid point raises the SDK exception from the decompression which
+ * is handled by the APDU handler that called into us
  * @param point the raw point
  * @param public the public key to load
- * @return whether the operation succeeded
  */
-static uint16_t hw_ge_frombytes_vartime(unsigned char *point, const unsigned char *public)
+static void hw_ge_frombytes_vartime(unsigned char *point, const unsigned char *public)
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            unsigned char aB[SIG_STR_SIZE] = {0};
-
-            // load the public key
-            {
-                aB[0] = 0x02;
-
-                os_memmove(&aB[1], public, KEY_SIZE);
-
-                cx_edward_decompress_point(CX_CURVE_Ed25519, aB, SIG_STR_SIZE);
-            }
+    profile_count(PROFILE_GE_FROMBYTES);
 
-            os_memmove(point, aB, sizeof(aB));
+#if ED25519_IN_APP == 1
+    ed25519_frombytes(point, public);
+#else
+    point[0] = 0x02;
 
-            CLOSE_TRY;
+    os_memmove(point + 1, public, KEY_SIZE);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return ERR_GE_FROMBYTES_VARTIME;
-        }
-        FINALLY {}
-    }
-    END_TRY;
+    cx_edward_decompress_point(CX_CURVE_Ed25519, point, SIG_STR_SIZE);
+#endif
 }
 
 /**
@@ -140,13 +167,132 @@ static uint16_t hw_ge_frombytes_vartime(unsigned char *point, const unsigned cha
  */
 static void hw_ge_tobytes(unsigned char *public, const unsigned char *point)
 {
-    unsigned char aB[SIG_STR_SIZE] = {0};
-
+#if ED25519_IN_APP == 1
+    ed25519_tobytes(public, point);
+#else
+#define aB SCRATCH_LEAF(0)
     os_memmove(aB, point, SIG_STR_SIZE);
 
     cx_edward_compress_point(CX_CURVE_Ed25519, aB, SIG_STR_SIZE);
 
     os_memmove(public, &aB[1], KEY_SIZE);
+
+    explicit_bzero(aB, SIG_STR_SIZE);
+#undef aB
+#endif
+}
+
+/**
+ * The hw_scbe_* methods operate on scalars that are held in the big-endian
+ * form used by the cx math methods so that a chain of scalar operations does
+ * not have to byte swap its operands and results around every cx call.
+ * Scalars are only converted (hw_sc_load / hw_sc_unload) at the boundary
+ * with the little-endian keys and signatures that the API works with.
+ */
+#define hw_sc_load(be, le) reverse32(be, le)
+#define hw_sc_unload(le, be) reverse32(le, be)
+
+/**
+ * r = s mod q
+ * @param r the resulting (BE) scalar (may be the same as s)
+ * @param s the (BE) value to reduce
+ */
+static void hw_scbe_reduce(unsigned char *r, const unsigned char *s)
+{
+    if (r != s)
+    {
+        os_memmove(r, s, KEY_SIZE);
+    }
+
+    cx_math_modm(r, KEY_SIZE, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+}
+
+/**
+ * r = (a + b) mod q
+ * @param r the resulting (BE) scalar
+ * @param a the first (BE) scalar
+ * @param b the second (BE) scalar
+ */
+static void hw_scbe_add(unsigned char *r, const unsigned char *a, const unsigned char *b)
+{
+    cx_math_addm(r, a, b, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+}
+
+/**
+ * r = (a - b) mod q
+ * @param r the resulting (BE) scalar
+ * @param a the first (BE) scalar
+ * @param b the second (BE) scalar
+ */
+static void hw_scbe_sub(unsigned char *r, const unsigned char *a, const unsigned char *b)
+{
+    cx_math_subm(r, a, b, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+}
+
+/**
+ * acc = acc + a without any reduction, the sum is only reduced once it is read back
+ * (see hw_scbe_acc_reduce) rather than for every scalar that goes into it
+ * @param acc the (BE) accumulator
+ * @param size the size of the accumulator, at least KEY_SIZE
+ * @param a the (BE) scalar to add
+ */
+static void hw_scbe_acc_add(unsigned char *acc, const size_t size, const unsigned char *a)
+{
+    const size_t high = size - KEY_SIZE;
+
+    unsigned int carry = (cx_math_add(acc + high, acc + high, a, KEY_SIZE) != 0) ? 1 : 0;
+
+    // the carry ripples through the high bytes the same way whatever their value
+    size_t i;
+
+    for (i = high; i > 0; i--)
+    {
+        acc[i - 1] += carry;
+
+        carry &= (acc[i - 1] == 0) ? 1 : 0;
+    }
+}
+
+/**
+ * r = acc mod q, wiping the accumulator
+ * @param r the resulting (BE) scalar
+ * @param acc the (BE) accumulator
+ * @param size the size of the accumulator, at least KEY_SIZE
+ */
+static void hw_scbe_acc_reduce(unsigned char *r, unsigned char *acc, const size_t size)
+{
+    cx_math_modm(acc, size, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+
+    os_memmove(r, acc + size - KEY_SIZE, KEY_SIZE);
+
+    explicit_bzero(acc, size);
+}
+
+/**
+ * r = (c - (a * b)) mod q, worked out as (c + ((q - a) * b)) mod q so that the product and
+ * the difference are reduced together once instead of once each
+ * @param r the resulting (BE) scalar
+ * @param a the first (BE) scalar, which must be reduced
+ * @param b the second (BE) scalar
+ * @param c the third (BE) scalar
+ */
+static void hw_scbe_mulsub(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *c)
+{
+    unsigned char product[KEY_SIZE * 2];
+
+    unsigned char negated[KEY_SIZE];
+
+    // q - a, which is -a mod q as a < q
+    cx_math_sub(negated, (unsigned char *)C_ED25519_ORDER, a, KEY_SIZE);
+
+    cx_math_mult(product, negated, b, KEY_SIZE);
+
+    // (q - a) * b < q * 2^256 so adding c can not overflow the product
+    hw_scbe_acc_add(product, sizeof(product), c);
+
+    hw_scbe_acc_reduce(r, product, sizeof(product));
+
+    explicit_bzero(negated, sizeof(negated));
 }
 
 /**
@@ -160,13 +306,13 @@ static void hw_sc_reduce32(unsigned char *r, const unsigned char *s)
     unsigned char _s[KEY_SIZE];
 
     // Load the data for reduction
-    reverse32(_s, s);
+    hw_sc_load(_s, s);
 
     // Put it on the curve in the proper order
-    cx_math_modm(_s, KEY_SIZE, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+    hw_scbe_reduce(_s, _s);
 
     // Unload the resulting scalar
-    reverse32(r, _s);
+    hw_sc_unload(r, _s);
 }
 
 /**
@@ -218,303 +364,677 @@ static void hw_sc_add(unsigned char *r, const unsigned char *a, const unsigned c
 
     unsigned char _b[KEY_SIZE];
 
-    // Load scalar a
-    reverse32(_a, a);
+    hw_sc_load(_a, a);
 
-    // Load scalar b
-    reverse32(_b, b);
+    hw_sc_load(_b, b);
 
-    // Add the scalars together
-    cx_math_addm(r, _a, _b, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+    hw_scbe_add(_a, _a, _b);
 
-    // Unload the resulting scalar
-    reverse32(r, r);
+    hw_sc_unload(r, _a);
 }
 
 /**
- * Performs scalar subtraction such that
- * r = (a - b) mod q
+ * Performs scalar subtraction and multiplication such that
+ * r = (c - (a * b)) mod q
  * @param r the result
  * @param a the first scalar
  * @param b the second scalar
+ * @param c the third scalar
  */
-static void hw_sc_sub(unsigned char *r, const unsigned char *a, const unsigned char *b)
+static void hw_sc_mulsub(unsigned char *r, const unsigned char *a, const unsigned char *B, const unsigned char *c)
 {
     unsigned char _a[KEY_SIZE];
 
-    unsigned char _b[KEY_SIZE];
-
-    // Load scalar a
-    reverse32(_a, a);
-
-    // Load scalar b
-    reverse32(_b, b);
+    unsigned char _B[KEY_SIZE];
 
-    // (a - b) mod q
-    cx_math_subm(r, _a, _b, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+    unsigned char _c[KEY_SIZE];
 
-    // Unload the resulting scalar
-    reverse32(r, r);
-}
+    hw_sc_load(_a, a);
 
-/**
- * Performs scalar multiplication such that
- * r = (a * b) mod q
- * @param r the result
- * @param a the first scalar
- * @param b the second scalar
- */
-static void hw_sc_mul(unsigned char *r, const unsigned char *a, const unsigned char *b)
-{
-    unsigned char _a[KEY_SIZE];
+    hw_sc_load(_B, B);
 
-    unsigned char _b[KEY_SIZE];
+    hw_sc_load(_c, c);
 
-    reverse32(_a, a);
+    // r = (c - (a * B) mod q
+    hw_scbe_mulsub(_a, _a, _B, _c);
 
-    reverse32(_b, b);
+    hw_sc_unload(r, _a);
 
-    cx_math_multm(r, _a, _b, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+    explicit_bzero(_B, sizeof(_B));
 
-    reverse32(r, r);
+    explicit_bzero(_c, sizeof(_c));
 }
 
 /**
- * Performs scalar subtraction and multiplication such that
- * r = (c - (a * b)) mod q
- * @param r the result
- * @param a the first scalar
- * @param b the second scalar
- * @param c the third scalar
+ * The point handle methods below operate on uncompressed points in the
+ * 0x04 || X || Y (SIG_STR_SIZE) layout used by the cx ECC methods so
+ * that a chain of curve operations only decompresses its inputs once and
+ * compresses its final result once
  */
-static void hw_sc_mulsub(unsigned char *r, const unsigned char *a, const unsigned char *B, const unsigned char *c)
-{
-    unsigned char aB[KEY_SIZE] = {0};
-
-    // a_b = (a * B) mod q
-    hw_sc_mul(aB, a, B);
-
-    // r = (c - (a * B) mod q
-    hw_sc_sub(r, c, aB);
-}
 
 /**
- * Adds two points together
+ * Adds two uncompressed points together
  * r = p + q
- * @param r the result
+ * @param r the resulting point
  * @param p the first point
  * @param q the second point
  */
-static uint16_t hw_ge_add(unsigned char *r, const unsigned char *p, const unsigned char *q)
+static void hw_ge_p_add(unsigned char *r, const unsigned char *p, const unsigned char *q)
 {
-    unsigned char pxy[SIG_STR_SIZE];
-
-    unsigned char qxy[SIG_STR_SIZE];
-
-    // load point #1
-    uint16_t status = hw_ge_frombytes_vartime(pxy, p);
-
-    if (status != OP_OK)
-    {
-        return status;
-    }
-
-    // load point #2
-    status = hw_ge_frombytes_vartime(qxy, q);
-
-    if (status != OP_OK)
-    {
-        return status;
-    }
-
-    // add them together
-    cx_ecfp_add_point(CX_CURVE_Ed25519, pxy, pxy, qxy, SIG_STR_SIZE);
+    profile_count(PROFILE_GE_ADD);
 
-    // compress the point back to bytes
-    hw_ge_tobytes(r, pxy);
-
-    return OP_OK;
+#if ED25519_IN_APP == 1
+    ed25519_add(r, p, q);
+#else
+    cx_ecfp_add_point(CX_CURVE_Ed25519, r, p, q, SIG_STR_SIZE);
+#endif
 }
 
 /**
- * Calculates a public key from a private key such that
- * A = a * G
- * @param A the public key
- * @param a the private key
+ * Multiplies the uncompressed point by a scalar such that
+ * r = a * P
+ * @param r the resulting point (may be the same as P)
+ * @param P the point
+ * @param a the scalar
  */
-static void hw_ge_scalarmult_base(unsigned char *A, const unsigned char *a)
+static void hw_ge_p_scalarmult(unsigned char *r, const unsigned char *P, const unsigned char *a)
 {
-    unsigned char aG[SIG_STR_SIZE];
+    profile_count(PROFILE_GE_SCALARMULT);
 
     unsigned char _a[KEY_SIZE];
 
-    // Load the private key
+    // Load the scalar
     reverse32(_a, a);
 
-    // Load G as a point
-    os_memmove(aG, C_ED25519_G, SIG_STR_SIZE);
+#if ED25519_IN_APP == 1
+    ed25519_scalarmult(r, P, _a, KEY_SIZE);
+#else
+    if (r != P)
+    {
+        os_memmove(r, P, SIG_STR_SIZE);
+    }
 
-    // Multiply the private key by G
-    cx_ecfp_scalar_mult(CX_CURVE_Ed25519, aG, SIG_STR_SIZE, _a, KEY_SIZE);
+    cx_ecfp_scalar_mult(CX_CURVE_Ed25519, r, SIG_STR_SIZE, _a, KEY_SIZE);
+#endif
 
-    // compress the point back to bytes
-    hw_ge_tobytes(A, aG);
+    explicit_bzero(_a, sizeof(_a));
 }
 
 /**
- * Multiplies the the public and private keys together and returns
- * the resulting point such that
- * r = a * B
- * @param r the result
- * @param B the public key
- * @param a the private key
+ * Selects the precomputed multiple of G for a signed 4-bit digit in
+ * constant time such that
+ * t = digit * 16^i * G
+ * @param t the resulting uncompressed point
+ * @param i the window of the digit
+ * @param digit the signed digit (-8 .. 8)
  */
-static int hw_ge_scalarmult(unsigned char *r, const unsigned char *B, const unsigned char *a)
+static void hw_ge_p_select_base(unsigned char *t, const size_t i, const signed char digit)
 {
-    unsigned char aB[SIG_STR_SIZE] = {0};
+    const unsigned char negative = ((unsigned char)digit) >> 7;
 
-    unsigned char _a[KEY_SIZE] = {0};
+    const unsigned char magnitude = digit - ((-negative & digit) << 1);
 
-    // Load the private key
-    reverse32(_a, a);
+    unsigned char neg_x[KEY_SIZE];
 
-    // Load the public key
-    const uint16_t status = hw_ge_frombytes_vartime(aB, B);
+    unsigned char mask;
 
-    if (status != OP_OK)
+    size_t j, k;
+
+    // start from the identity (0, 1) which is what a zero digit selects
+    explicit_bzero(t, SIG_STR_SIZE);
+
+    t[0] = 0x04;
+
+    t[SIG_STR_SIZE - 1] = 1;
+
+    // touch every entry of the window so the access pattern does not depend on the digit
+    for (j = 0; j < G_TABLE_MULTIPLES; j++)
     {
-        return status;
+        mask = -(unsigned char)(((uint32_t)(magnitude ^ (j + 1)) - 1) >> 31);
+
+        for (k = 0; k < G_TABLE_POINT_SIZE; k++)
+        {
+            t[1 + k] ^= mask & (t[1 + k] ^ C_ED25519_G_TABLE[i][j][k]);
+        }
     }
 
-    // multiply them together
-    cx_ecfp_scalar_mult(CX_CURVE_Ed25519, aB, SIG_STR_SIZE, _a, KEY_SIZE);
+    // -(x, y) = (-x, y)
+    cx_math_sub(neg_x, (unsigned char *)C_ED25519_FIELD, t + 1, KEY_SIZE);
 
-    // compress the point back to bytes
-    hw_ge_tobytes(r, aB);
+    mask = -negative;
 
-    return OP_OK;
+    for (k = 0; k < KEY_SIZE; k++)
+    {
+        t[1 + k] ^= mask & (t[1 + k] ^ neg_x[k]);
+    }
 }
 
 /**
- * Calculates the result of the point on the ED25519 by 8 such that
- * r = 8 * A
- * @param r the result
- * @param A the point
+ * Calculates the uncompressed point of a scalar such that
+ * r = a * G
+ * using the flash resident table of multiples of G so that it only
+ * costs one point addition per 4-bit window of the scalar
+ * @param r the resulting point
+ * @param a the scalar
  */
-static int hw_ge_mul8(unsigned char *r, const unsigned char *A)
+static void hw_ge_p_scalarmult_base(unsigned char *r, const unsigned char *a)
 {
-    unsigned char Pxy[SIG_STR_SIZE];
+    profile_count(PROFILE_GE_SCALARMULT_BASE);
 
-    // Load the point (public key)
-    const uint16_t status = hw_ge_frombytes_vartime(Pxy, A);
+#define t SCRATCH_LEAF(0)
+    unsigned char _a[KEY_SIZE];
 
-    if (status != OP_OK)
-    {
-        return status;
-    }
+    signed char e[G_TABLE_WINDOWS];
 
-    // Add the point to itself x3
-    cx_ecfp_add_point(CX_CURVE_Ed25519, Pxy, Pxy, Pxy, sizeof(Pxy));
+    signed char carry = 0;
 
-    cx_ecfp_add_point(CX_CURVE_Ed25519, Pxy, Pxy, Pxy, sizeof(Pxy));
+    size_t i;
 
-    cx_ecfp_add_point(CX_CURVE_Ed25519, Pxy, Pxy, Pxy, sizeof(Pxy));
+    // G has order q so reducing first keeps the top digit from overflowing
+    hw_sc_reduce32(_a, a);
 
-    // compress the point back to bytes
-    hw_ge_tobytes(r, Pxy);
+    // split the (LE) scalar into 4-bit digits
+    for (i = 0; i < KEY_SIZE; i++)
+    {
+        e[2 * i] = _a[i] & 15;
 
-    return OP_OK;
-}
+        e[2 * i + 1] = (_a[i] >> 4) & 15;
+    }
 
-#define MOD (unsigned char *)C_ED25519_FIELD, KEY_SIZE
-#define fe_isnegative(f) (f[31] & 1)
+    // recode the digits into signed digits -8 .. 7
+    for (i = 0; i < G_TABLE_WINDOWS - 1; i++)
+    {
+        e[i] += carry;
 
-/**
- * Loads the input bytes into a point on the ED25519 curve
- * Thanks to knacc and moneromoo help on IRC #monero-research-lab via
- * https://github.com/LedgerHQ/app-monero/blob/master/src/monero_crypto.c
- * @param ge the resulting point on the ED25519 curve
- * @param bytes the bytes to load
- */
-static void hw_ge_fromfe_frombytes_vartime(unsigned char *ge, const unsigned char *bytes)
-{
-    unsigned char u[KEY_SIZE] = {0};
+        carry = (e[i] + 8) >> 4;
 
-    unsigned char v[KEY_SIZE] = {0};
+        e[i] -= carry << 4;
+    }
 
-    unsigned char w[KEY_SIZE] = {0};
+    e[G_TABLE_WINDOWS - 1] += carry;
 
-    unsigned char x[KEY_SIZE] = {0};
+#if ED25519_IN_APP == 1
+    // r = sum(e[i] * 16^i * G) as mixed additions of the selected multiples, with a single inversion
+    ed25519_p3 acc;
 
-    unsigned char y[KEY_SIZE] = {0};
+    ed25519_p3_identity(&acc);
 
-    unsigned char z[KEY_SIZE] = {0};
+    for (i = 0; i < G_TABLE_WINDOWS; i++)
+    {
+        hw_ge_p_select_base(t, i, e[i]);
 
-    unsigned char rX[KEY_SIZE] = {0};
+        ed25519_p3_add_affine(&acc, t);
+    }
 
-    unsigned char rY[KEY_SIZE] = {0};
+    ed25519_p3_unload(r, &acc);
 
-    unsigned char rZ[KEY_SIZE] = {0};
+    explicit_bzero(&acc, sizeof(acc));
+#else
+    // r = sum(e[i] * 16^i * G)
+    hw_ge_p_select_base(r, 0, e[0]);
 
-    union
+    for (i = 1; i < G_TABLE_WINDOWS; i++)
     {
-        struct
-        {
-            unsigned char _uv7[KEY_SIZE];
-
-            unsigned char _v3[KEY_SIZE];
-        };
+        hw_ge_p_select_base(t, i, e[i]);
 
-        unsigned char _Pxy[SIG_STR_SIZE];
-    } uv;
-
-    unsigned char sign;
-
-    // ledger cx calls work in BE
-    reverse32(u, bytes);
+        hw_ge_p_add(r, r, t);
+    }
+#endif
 
-    cx_math_modm(u, KEY_SIZE, (unsigned char *)C_ED25519_FIELD, KEY_SIZE);
+    explicit_bzero(_a, sizeof(_a));
 
-    cx_math_multm(v, u, u, MOD); // (2 * u^2)
+    explicit_bzero(e, sizeof(e));
 
-    cx_math_addm(v, v, v, MOD);
+    explicit_bzero(t, SIG_STR_SIZE);
+#undef t
+}
 
-    explicit_bzero(w, KEY_SIZE);
+/**
+ * Loads the scalar as 8 * a (BE), shifted into a KEY_SIZE + 1 byte integer
+ * without any reduction so that multiplying by it is identical to 8 * (a * P)
+ * (including for points outside of the prime order subgroup) in a single pass.
+ * The app's own multiplication takes it already recoded into signed digits so
+ * that a key that is loaded once (see hw_wallet_constants) is never recoded again
+ * @param a8 the cofactored scalar {SCALAR8_LOADED_SIZE bytes}
+ * @param a the scalar
+ */
+static void hw_sc_load8(unsigned char *a8, const unsigned char *a)
+{
+    unsigned char shifted[KEY_SIZE + 1] = {0};
 
-    w[31] = 1; // w = 1
+    for (int i = 0; i < KEY_SIZE; i++)
+    {
+        shifted[KEY_SIZE - i - 1] |= a[i] >> 5;
 
-    cx_math_addm(w, v, w, MOD); // w = (2 * u^2 + 1)
+        shifted[KEY_SIZE - i] |= a[i] << 3;
+    }
 
-    cx_math_multm(x, w, w, MOD); // w^2
+#if ED25519_IN_APP == 1
+    ed25519_scalar_recode((signed char *)a8, shifted, sizeof(shifted));
+#else
+    os_memmove(a8, shifted, sizeof(shifted));
+#endif
 
-    cx_math_multm(y, (unsigned char *)C_fe_ma2, v, MOD); // -2 * A^2 * u^2
+    explicit_bzero(shifted, sizeof(shifted));
+}
 
-    cx_math_addm(x, x, y, MOD); // x = w^2 - 2 * A^2 * u^2
+/**
+ * Multiplies the uncompressed point by the cofactored scalar such that
+ * r = (8 * a) * P
+ * @param r the resulting point (may be the same as P)
+ * @param P the point
+ * @param a8 the scalar as loaded by hw_sc_load8
+ */
+static void hw_ge_p_scalarmult8_loaded(unsigned char *r, const unsigned char *P, const unsigned char *a8)
+{
+    profile_count(PROFILE_GE_SCALARMULT);
 
-    // inline fe_divpowm1(r->X, w, x);     // (w / x)^(m + 1) =>
-    // fe_divpowm1(r,u,v)
+#if ED25519_IN_APP == 1
+    ed25519_scalarmult_digits(r, P, (const signed char *)a8, SCALAR8_LOADED_SIZE);
+#else
+    if (r != P)
     {
-        cx_math_multm(uv._v3, x, x, MOD);
+        os_memmove(r, P, SIG_STR_SIZE);
+    }
 
-        cx_math_multm(uv._v3, uv._v3, x, MOD); // v3 = v^3
+    cx_ecfp_scalar_mult(CX_CURVE_Ed25519, r, SIG_STR_SIZE, a8, KEY_SIZE + 1);
+#endif
+}
 
-        cx_math_multm(uv._uv7, uv._v3, uv._v3, MOD);
+/**
+ * Calculates the result of the uncompressed point by 8 such that
+ * r = 8 * P
+ * @param r the resulting point (may be the same as P)
+ * @param P the point
+ */
+static void hw_ge_p_mul8(unsigned char *r, const unsigned char *P)
+{
+#if ED25519_IN_APP == 1
+    ed25519_mul8(r, P);
+#else
+    // Add the point to itself x3
+    cx_ecfp_add_point(CX_CURVE_Ed25519, r, P, P, SIG_STR_SIZE);
 
-        cx_math_multm(uv._uv7, uv._uv7, x, MOD);
+    cx_ecfp_add_point(CX_CURVE_Ed25519, r, r, r, SIG_STR_SIZE);
 
-        cx_math_multm(uv._uv7, uv._uv7, w, MOD); // uv7 = uv^7
+    cx_ecfp_add_point(CX_CURVE_Ed25519, r, r, r, SIG_STR_SIZE);
+#endif
+}
 
-        cx_math_powm(uv._uv7, uv._uv7, (unsigned char *)C_fe_qm5div8, KEY_SIZE,
-                     MOD); // (uv^7)^((q-5)/8)
+/**
+ * Computes the joint multiple of two uncompressed points such that
+ * r = (a * P) + (b * Q)
+ * in a single interleaved (Straus/Shamir) double-and-add pass so that
+ * both scalars share the same point doublings.
+ *
+ * The additions performed depend on the bits of the scalars so this
+ * must only be used where both scalars are public (signature values)
+ * @param r the resulting point (may be the same as P or Q)
+ * @param a the first (BE) scalar
+ * @param P the first uncompressed point
+ * @param b the second (BE) scalar
+ * @param Q the second uncompressed point
+ */
+static void hw_ge_p_double_scalarmult_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char *P,
+    const unsigned char *b,
+    const unsigned char *Q)
+{
+#if ED25519_IN_APP == 1
+    ed25519_double_scalarmult_vartime(r, a, P, b, Q);
+#else
+#define PQ SCRATCH_LEAF(0)
+#define acc SCRATCH_LEAF(1)
+    bool started = false;
 
-        cx_math_multm(uv._uv7, uv._uv7, uv._v3, MOD);
+    int i, bit;
 
-        cx_math_multm(rX, uv._uv7, w, MOD); // u^(m+1)v^(-(m+1))
-    }
+    // P + Q is the addend when both scalars have the current bit set
+    hw_ge_p_add(PQ, P, Q);
 
-    cx_math_multm(y, rX, rX, MOD);
+    for (i = 0; i < KEY_SIZE; i++)
+    {
+        for (bit = 7; bit >= 0; bit--)
+        {
+            const uint8_t select = (((a[i] >> bit) & 1) << 1) | ((b[i] >> bit) & 1);
 
-    cx_math_multm(x, y, x, MOD);
+            const unsigned char *addend = (select == 3) ? PQ : ((select == 2) ? P : Q);
+
+            if (started)
+            {
+                hw_ge_p_add(acc, acc, acc);
+            }
+
+            if (select == 0)
+            {
+                continue;
+            }
+
+            if (started)
+            {
+                hw_ge_p_add(acc, acc, addend);
+            }
+            else
+            {
+                // skip the doublings of the identity until the first set bit
+                os_memmove(acc, addend, SIG_STR_SIZE);
+
+                started = true;
+            }
+        }
+    }
+
+    if (!started)
+    {
+        // both scalars were zero so the result is the identity (0, 1)
+        explicit_bzero(acc, SIG_STR_SIZE);
+
+        acc[0] = 0x04;
+
+        acc[SIG_STR_SIZE - 1] = 1;
+    }
+
+    os_memmove(r, acc, SIG_STR_SIZE);
+#undef acc
+#undef PQ
+#endif
+}
+
+/**
+ * r = (a * P) + (b * G)
+ * @param r the resulting point (may be the same as P)
+ * @param a the first (BE) scalar
+ * @param P the uncompressed point
+ * @param b the second (BE) scalar
+ */
+static void hw_ge_p_double_scalarmult_base(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char *P,
+    const unsigned char *b)
+{
+    hw_ge_p_double_scalarmult_vartime(r, a, P, b, C_ED25519_G);
+}
+
+/**
+ * Fills the table with the odd multiples of the uncompressed point such that
+ * table = { P, 3P, 5P, ... } for the sliding windows of
+ * hw_ge_p_double_scalarmult_table_vartime
+ * @param table the resulting table of KEY_IMAGE_TABLE_SIZE points
+ * @param P the uncompressed point
+ */
+static void hw_ge_p_odd_multiples(unsigned char (*table)[SIG_STR_SIZE], const unsigned char *P)
+{
+#if ED25519_IN_APP == 1
+    _Static_assert(KEY_IMAGE_TABLE_SIZE <= ED25519_ODD_MULTIPLES_MAX, "the key image table is too large");
+
+    ed25519_odd_multiples(table, P, KEY_IMAGE_TABLE_SIZE);
+#else
+#define P2 SCRATCH_LEAF(0)
+    size_t i;
+
+    if (table[0] != P)
+    {
+        os_memmove(table[0], P, SIG_STR_SIZE);
+    }
+
+    hw_ge_p_add(P2, P, P);
+
+    for (i = 1; i < KEY_IMAGE_TABLE_SIZE; i++)
+    {
+        hw_ge_p_add(table[i], table[i - 1], P2);
+    }
+#undef P2
+#endif
+}
+
+#define hw_scbe_bit(s, i) ((s[KEY_SIZE - 1 - ((i) / 8)] >> ((i) % 8)) & 1)
+
+/**
+ * Finds the sliding window of the (BE) scalar that starts at the set bit i
+ * and is at most width bits wide, the window always ends on a set bit so
+ * that its value is odd
+ * @param s the (BE) scalar
+ * @param i the bit that the window starts at
+ * @param width the largest width of the window
+ * @param value the resulting (odd) value of the window
+ * @return the bit that the window ends at
+ */
+static int hw_scbe_window(const unsigned char *s, const int i, const int width, uint8_t *value)
+{
+    int end = (i - width + 1 < 0) ? 0 : i - width + 1;
+
+    int j;
+
+    while (!hw_scbe_bit(s, end))
+    {
+        end++;
+    }
+
+    *value = 0;
+
+    for (j = i; j >= end; j--)
+    {
+        *value = (*value << 1) | hw_scbe_bit(s, j);
+    }
+
+    return end;
+}
+
+/**
+ * Computes the joint multiple of two uncompressed points such that
+ * r = (a * A) + (b * B)
+ * where A is given by its table of odd multiples so that a point that is the same for
+ * every member of a ring (the key image) only has its table built once per ring.
+ * Both scalars are consumed with left to right sliding windows that share the same
+ * point doublings: up to 3 bits wide over the table of A and up to 2 bits wide over
+ * { B, 3B } which costs two point additions to build for every call
+ *
+ * The additions performed depend on the bits of the scalars so this
+ * must only be used where both scalars are public (signature values)
+ * @param r the resulting point (may be the same as B)
+ * @param a the first (BE) scalar
+ * @param A the table of odd multiples of the first point (hw_ge_p_odd_multiples)
+ * @param b the second (BE) scalar
+ * @param B the second uncompressed point
+ */
+static void hw_ge_p_double_scalarmult_table_vartime(
+    unsigned char *r,
+    const unsigned char *a,
+    const unsigned char (*A)[SIG_STR_SIZE],
+    const unsigned char *b,
+    const unsigned char *B)
+{
+#if ED25519_IN_APP == 1
+    ed25519_double_scalarmult_table_vartime(r, a, A, KEY_IMAGE_TABLE_SIZE, b, B);
+#else
+#define acc SCRATCH_LEAF(0)
+#define B3 SCRATCH_LEAF(1)
+    // the bit at which the current window of each scalar is added in (-1 = no window open)
+    int a_end = -1, b_end = -1;
+
+    uint8_t a_value = 0, b_value = 0;
+
+    bool started = false;
+
+    int i;
+
+    hw_ge_p_add(B3, B, B);
+
+    hw_ge_p_add(B3, B3, B);
+
+    for (i = (KEY_SIZE * 8) - 1; i >= 0; i--)
+    {
+        if (started)
+        {
+            hw_ge_p_add(acc, acc, acc);
+        }
+
+        if (a_end < 0 && hw_scbe_bit(a, i))
+        {
+            a_end = hw_scbe_window(a, i, 3, &a_value);
+        }
+
+        if (b_end < 0 && hw_scbe_bit(b, i))
+        {
+            b_end = hw_scbe_window(b, i, 2, &b_value);
+        }
+
+        if (a_end == i)
+        {
+            const unsigned char *addend = A[a_value >> 1];
+
+            if (started)
+            {
+                hw_ge_p_add(acc, acc, addend);
+            }
+            else
+            {
+                // skip the doublings of the identity until the first window
+                os_memmove(acc, addend, SIG_STR_SIZE);
+
+                started = true;
+            }
+
+            a_end = -1;
+        }
+
+        if (b_end == i)
+        {
+            const unsigned char *addend = (b_value == 1) ? B : B3;
+
+            if (started)
+            {
+                hw_ge_p_add(acc, acc, addend);
+            }
+            else
+            {
+                os_memmove(acc, addend, SIG_STR_SIZE);
+
+                started = true;
+            }
+
+            b_end = -1;
+        }
+    }
+
+    if (!started)
+    {
+        // both scalars were zero so the result is the identity (0, 1)
+        explicit_bzero(acc, SIG_STR_SIZE);
+
+        acc[0] = 0x04;
+
+        acc[SIG_STR_SIZE - 1] = 1;
+    }
+
+    os_memmove(r, acc, SIG_STR_SIZE);
+#undef B3
+#undef acc
+#endif
+}
+
+/**
+ * Calculates a public key from a private key such that
+ * A = a * G
+ * @param A the public key
+ * @param a the private key
+ */
+static void hw_ge_scalarmult_base(unsigned char *A, const unsigned char *a)
+{
+#define aG SCRATCH_CALLER(0)
+    // Multiply the private key by G
+    hw_ge_p_scalarmult_base(aG, a);
+
+    // compress the point back to bytes
+    hw_ge_tobytes(A, aG);
+#undef aG
+}
+
+#define MOD (unsigned char *)C_ED25519_FIELD, KEY_SIZE
+#define fe_isnegative(f) (f[31] & 1)
+
+/**
+ * Loads the input bytes into an uncompressed point on the ED25519 curve
+ * Thanks to knacc and moneromoo help on IRC #monero-research-lab via
+ * https://github.com/LedgerHQ/app-monero/blob/master/src/monero_crypto.c
+ * @param ge the resulting uncompressed point on the ED25519 curve
+ * @param bytes the bytes to load
+ */
+static void hw_ge_p_fromfe_frombytes_vartime(unsigned char *ge, const unsigned char *bytes)
+{
+    unsigned char u[KEY_SIZE] = {0};
+
+    unsigned char v[KEY_SIZE] = {0};
+
+    unsigned char w[KEY_SIZE] = {0};
+
+    unsigned char x[KEY_SIZE] = {0};
+
+    unsigned char y[KEY_SIZE] = {0};
+
+    unsigned char z[KEY_SIZE] = {0};
+
+    unsigned char rX[KEY_SIZE] = {0};
+
+    unsigned char rY[KEY_SIZE] = {0};
+
+    unsigned char rZ[KEY_SIZE] = {0};
+
+    struct
+    {
+        unsigned char _uv7[KEY_SIZE];
+
+        unsigned char _v3[KEY_SIZE];
+    } uv;
+
+    unsigned char sign;
+
+    // ledger cx calls work in BE
+    reverse32(u, bytes);
+
+    cx_math_modm(u, KEY_SIZE, (unsigned char *)C_ED25519_FIELD, KEY_SIZE);
+
+    cx_math_multm(v, u, u, MOD); // (2 * u^2)
+
+    cx_math_addm(v, v, v, MOD);
+
+    w[31] = 1; // w = 1
+
+    cx_math_addm(w, v, w, MOD); // w = (2 * u^2 + 1)
+
+    cx_math_multm(x, w, w, MOD); // w^2
+
+    cx_math_multm(y, (unsigned char *)C_fe_ma2, v, MOD); // -2 * A^2 * u^2
+
+    cx_math_addm(x, x, y, MOD); // x = w^2 - 2 * A^2 * u^2
+
+    // inline fe_divpowm1(r->X, w, x);     // (w / x)^(m + 1) =>
+    // fe_divpowm1(r,u,v)
+    {
+        cx_math_multm(uv._v3, x, x, MOD);
+
+        cx_math_multm(uv._v3, uv._v3, x, MOD); // v3 = v^3
+
+        cx_math_multm(uv._uv7, uv._v3, uv._v3, MOD);
+
+        cx_math_multm(uv._uv7, uv._uv7, x, MOD);
+
+        cx_math_multm(uv._uv7, uv._uv7, w, MOD); // uv7 = uv^7
+
+        cx_math_powm(uv._uv7, uv._uv7, (unsigned char *)C_fe_qm5div8, KEY_SIZE,
+                     MOD); // (uv^7)^((q-5)/8)
+
+        cx_math_multm(uv._uv7, uv._uv7, uv._v3, MOD);
+
+        cx_math_multm(rX, uv._uv7, w, MOD); // u^(m+1)v^(-(m+1))
+    }
+
+    cx_math_multm(y, rX, rX, MOD);
+
+    cx_math_multm(x, y, x, MOD);
 
     cx_math_subm(y, w, x, MOD);
 
@@ -578,172 +1098,337 @@ static void hw_ge_fromfe_frombytes_vartime(unsigned char *ge, const unsigned cha
 
         cx_math_subm(rY, z, w, MOD);
 
-        cx_math_multm(rX, rX, rZ, MOD);
-
+        /**
+         * The projective result is (rX * rZ : rY : rZ) so the affine x is
+         * rX itself and only y needs the (single) inversion of rZ
+         */
         cx_math_invprimem(u, rZ, MOD);
 
-        uv._Pxy[0] = 0x04;
+        ge[0] = 0x04;
 
-        cx_math_multm(&uv._Pxy[1], rX, u, MOD);
+        os_memmove(ge + 1, rX, KEY_SIZE);
 
-        cx_math_multm(&uv._Pxy[1 + KEY_SIZE], rY, u, MOD);
-
-        hw_ge_tobytes(ge, uv._Pxy);
+        cx_math_multm(ge + 1 + KEY_SIZE, rY, u, MOD);
     }
     // clang-format on
 }
 
 /**
  * Hashes the given key, then loads the result as an elliptic curve point
- * and then multiplying it by 8
- * @param ec the resulting elliptic curve point
+ * and then multiplying it by 8 such that
+ * ec = 8 * fromfe(H(A))
+ * The point is left uncompressed so that the scalar multiplication that
+ * always follows Hp(P) can use it directly
+ * @param ec the resulting uncompressed elliptic curve point
  * @param A the key to perform the operation on
  */
-static int hw_hash_to_ec(unsigned char *ec, const unsigned char *A)
+static int hw_hash_to_ec_p(unsigned char *ec, const unsigned char *A)
 {
-    const uint16_t status = hw_keccak(A, KEY_SIZE, ec);
+    profile_count(PROFILE_HASH_TO_EC);
+
+    unsigned char hash[KEY_SIZE];
+
+    const uint16_t status = hw_keccak(A, KEY_SIZE, hash);
 
     if (status != OP_OK)
     {
         return status;
     }
 
-    hw_ge_fromfe_frombytes_vartime(ec, ec);
+    hw_ge_p_fromfe_frombytes_vartime(ec, hash);
+
+    hw_ge_p_mul8(ec, ec);
 
-    return hw_ge_mul8(ec, ec);
+    return OP_OK;
 }
 
 /**
- * r = (a * P) + (b * G)
- * @param r the result
- * @param a the first private key
- * @param B the public key
- * @param b the second private key
+ * State of the seeded RNG of debug builds (see hw_debug_rng_seed). While it is active every
+ * byte that would have come from cx_rng is expanded as H(seed || counter) instead, so that two
+ * runs of the same requests compute exactly the same values and take the same time
  */
-static int hw_ge_double_scalarmult_base(
-    unsigned char *r,
-    const unsigned char *a,
-    const unsigned char *P,
-    const unsigned char *b)
+static struct
 {
-    unsigned char aP[KEY_SIZE];
-
-    unsigned char bG[KEY_SIZE];
+    unsigned char seed[KEY_SIZE];
+    uint32_t counter;
+    bool active;
+} L_debug_rng;
 
-    // multiply a * P
-    uint16_t status = hw_ge_scalarmult(aP, P, a);
-
-    if (status != OP_OK)
+// from cx_rng unless a debug build has seeded the RNG
+uint16_t hw_random_bytes(unsigned char *out, size_t length)
+{
+    if (DEBUG_BUILD != 1 || !L_debug_rng.active)
     {
-        return status;
+        cx_rng(out, length);
+
+        return OP_OK;
     }
 
-    // multiply b * G
-    hw_ge_scalarmult_base(bG, b);
+    unsigned char buffer[KEY_SIZE + sizeof(uint32_t)], block[KEY_SIZE];
 
-    // add the two points together
-    status = hw_ge_add(r, aP, bG);
+    os_memmove(buffer, L_debug_rng.seed, KEY_SIZE);
 
-    if (status != OP_OK)
+    for (size_t i = 0; i < length; i += KEY_SIZE)
     {
-        return status;
+        os_memmove(buffer + KEY_SIZE, &L_debug_rng.counter, sizeof(uint32_t));
+
+        L_debug_rng.counter++;
+
+        hw_keccak(buffer, sizeof(buffer), block);
+
+        os_memmove(out + i, block, (length - i < KEY_SIZE) ? length - i : KEY_SIZE);
     }
 
-    return OP_OK;
+    explicit_bzero(buffer, sizeof(buffer));
+
+    return hw_wipe(block, sizeof(block), OP_OK);
 }
 
+#define DRBG_BLOCK_SIZE KEY_SIZE * 2
+
 /**
- * r = (a * I) + (b * Hp(P))
- * @param r the result
- * @param a the first private key
- * @param I the first public key (key image)
- * @param b the second private key
- * @param P the second public key (point)
+ * State of the keccak DRBG used as the nonce source while it is active.
+ * The seed is drawn from cx_rng once and every nonce is then expanded as
+ * Hs512(seed || domain || counter) so that signing a transaction with many
+ * inputs does not pay for a round trip to the RNG for every nonce. The seed
+ * outlives a pause so that the nonces of a domain can be expanded again later
  */
-static int hw_ge_double_scalarmult(
-    unsigned char *r,
-    const unsigned char *a,
-    const unsigned char *I,
-    const unsigned char *b,
-    const unsigned char *P)
+static struct
 {
-    unsigned char aI[KEY_SIZE];
+    unsigned char seed[KEY_SIZE];
+    uint32_t domain;
+    uint32_t counter;
+    bool seeded;
+    bool active;
+} L_nonce_drbg;
 
-    unsigned char bP[KEY_SIZE];
+/**
+ * Expands the next (BE) scalar from the DRBG such that
+ * private = Hs512(seed || domain || counter) mod q
+ * @param private the resulting scalar
+ */
+static void hw_nonce_drbg_scalar_be(unsigned char *private)
+{
+    hw_keccak_t context;
 
-    // multiply a * I
-    uint16_t status = hw_ge_scalarmult(aI, I, a);
+    unsigned char block[DRBG_BLOCK_SIZE];
 
-    if (status != OP_OK)
-    {
-        return status;
-    }
+#if KECCAK_IN_APP == 1
+    keccak_init(&context, DRBG_BLOCK_SIZE * 8);
 
-    // mutliply b * P
-    status = hw_ge_scalarmult(bP, P, b);
+    keccak_update(&context, L_nonce_drbg.seed, KEY_SIZE);
 
-    if (status != OP_OK)
-    {
-        return status;
-    }
+    keccak_update(&context, (unsigned char *)&L_nonce_drbg.domain, sizeof(uint32_t));
 
-    // add the two points together
-    status = hw_ge_add(r, aI, bP);
+    keccak_update(&context, (unsigned char *)&L_nonce_drbg.counter, sizeof(uint32_t));
 
-    if (status != OP_OK)
-    {
-        return status;
-    }
+    keccak_final(&context, block, DRBG_BLOCK_SIZE);
+#else
+    cx_keccak_init(&context, DRBG_BLOCK_SIZE * 8);
 
-    return OP_OK;
+    cx_hash((cx_hash_t *)&context, 0, L_nonce_drbg.seed, KEY_SIZE, NULL, 0);
+
+    cx_hash((cx_hash_t *)&context, 0, (unsigned char *)&L_nonce_drbg.domain, sizeof(uint32_t), NULL, 0);
+
+    cx_hash(
+        (cx_hash_t *)&context,
+        CX_LAST,
+        (unsigned char *)&L_nonce_drbg.counter,
+        sizeof(uint32_t),
+        block,
+        DRBG_BLOCK_SIZE);
+#endif
+
+    L_nonce_drbg.counter++;
+
+    // reduce the full 512-bit output so that the resulting nonce is not biased
+    cx_math_modm(block, DRBG_BLOCK_SIZE, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
+
+    os_memmove(private, block + KEY_SIZE, KEY_SIZE);
+
+    explicit_bzero(block, sizeof(block));
+
+    explicit_bzero(&context, sizeof(context));
 }
 
 /**
- * Generates a random scalar
+ * Generates a random (BE) scalar
  * @param private the resulting scalar
  */
-static void hw_random_scalar(unsigned char *private)
+static void hw_random_scalar_be(unsigned char *private)
 {
+    if (L_nonce_drbg.active)
+    {
+        hw_nonce_drbg_scalar_be(private);
+
+        return;
+    }
+
     unsigned char random[KEY_SIZE + 8];
 
-    cx_rng(random, KEY_SIZE + 8);
+    hw_random_bytes(random, KEY_SIZE + 8);
 
     cx_math_modm(random, KEY_SIZE + 8, (unsigned char *)C_ED25519_ORDER, KEY_SIZE);
 
-    reverse32(private, random + 8);
+    os_memmove(private, random + 8, KEY_SIZE);
+
+    explicit_bzero(random, sizeof(random));
+}
+
+/**
+ * Generates a random scalar
+ * @param private the resulting scalar
+ */
+static void hw_random_scalar(unsigned char *private)
+{
+    profile_count(PROFILE_RANDOM_SCALAR);
+
+    hw_random_scalar_be(private);
+
+    hw_sc_unload(private, private);
+}
+
+/**
+ * Hashes the input to a (BE) scalar such that
+ * out = H(in) mod q
+ * @param out the resulting scalar
+ * @param in the data to hash
+ * @param length the length of the data to hash
+ */
+static int hw_hash_to_scalar_be(unsigned char *out, const unsigned char *in, size_t length)
+{
+    const uint16_t status = hw_keccak(in, length, out);
+
+    if (status != OP_OK)
+    {
+        return status;
+    }
+
+    hw_sc_load(out, out);
+
+    hw_scbe_reduce(out, out);
+
+    return OP_OK;
 }
 
 static int hw_hash_to_scalar(unsigned char *out, const unsigned char *in, size_t length)
 {
-    unsigned char hash[KEY_SIZE] = {0};
+    const uint16_t status = hw_hash_to_scalar_be(out, in, length);
 
-    BEGIN_TRY
+    if (status != OP_OK)
     {
-        TRY
-        {
-            const uint16_t status = hw_keccak(in, length, hash);
+        return status;
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    hw_sc_unload(out, out);
 
-            hw_sc_reduce32(out, hash);
+    return OP_OK;
+}
 
-            CLOSE_TRY;
+/**
+ * Finalizes the keccak context and reduces the hash to a (BE) scalar such that
+ * out = H(...) mod q
+ * @param context the keccak context that the data was fed into
+ * @param out the resulting scalar
+ */
+static void hw_keccak_final_to_scalar_be(hw_keccak_t *context, unsigned char *out)
+{
+    hw_keccak_final(context, out);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
+    hw_sc_load(out, out);
+
+    hw_scbe_reduce(out, out);
+}
+
+#define SEAL_DOMAIN_CIPHER 0x00
+#define SEAL_DOMAIN_MAC 0x01
+
+/**
+ * Starts a keyed hash for sealing such that H(key || domain || nonce || ...)
+ * @param context the hash context
+ * @param key the sealing key
+ * @param domain what the hash is used for
+ * @param nonce what is being sealed
+ */
+static void hw_seal_context(hw_keccak_t *context, const unsigned char *key, const uint8_t domain, const uint32_t nonce)
+{
+    hw_keccak_init(context);
+
+    hw_keccak_update(context, key, KEY_SIZE);
+
+    hw_keccak_update(context, &domain, sizeof(uint8_t));
+
+    hw_keccak_update(context, (unsigned char *)&nonce, sizeof(uint32_t));
+}
+
+/**
+ * XORs the data with the keystream block[i] = H(key || SEAL_DOMAIN_CIPHER || nonce || i)
+ * @param out the resulting data (may be the same as in)
+ * @param in the data
+ * @param length the length of the data
+ * @param key the sealing key
+ * @param nonce what is being sealed
+ */
+static void hw_seal_cipher(
+    unsigned char *out,
+    const unsigned char *in,
+    const size_t length,
+    const unsigned char *key,
+    const uint32_t nonce)
+{
+    hw_keccak_t context;
+
+    unsigned char block[KEY_SIZE];
+
+    uint8_t counter = 0;
+
+    size_t i;
+    for (i = 0; i < length; i++)
+    {
+        if (i % KEY_SIZE == 0)
         {
-            explicit_bzero(hash, sizeof(hash));
+            hw_seal_context(&context, key, SEAL_DOMAIN_CIPHER, nonce);
+
+            hw_keccak_update(&context, &counter, sizeof(uint8_t));
+
+            hw_keccak_final(&context, block);
+
+            counter++;
         }
+
+        out[i] = in[i] ^ block[i % KEY_SIZE];
     }
-    END_TRY;
+
+    explicit_bzero(&context, sizeof(context));
+
+    explicit_bzero(block, sizeof(block));
+}
+
+/**
+ * Computes the MAC of the sealed data as H(key || SEAL_DOMAIN_MAC || nonce || data),
+ * Keccak is not open to length extension so the keyed hash is enough
+ * @param mac the resulting MAC
+ * @param data the sealed data
+ * @param length the length of the sealed data
+ * @param key the sealing key
+ * @param nonce what is being sealed
+ */
+static void hw_seal_mac(
+    unsigned char *mac,
+    const unsigned char *data,
+    const size_t length,
+    const unsigned char *key,
+    const uint32_t nonce)
+{
+    hw_keccak_t context;
+
+    hw_seal_context(&context, key, SEAL_DOMAIN_MAC, nonce);
+
+    hw_keccak_update(&context, data, length);
+
+    hw_keccak_final(&context, mac);
+
+    explicit_bzero(&context, sizeof(context));
 }
 
 /**
@@ -762,150 +1447,74 @@ static void hw__complete_ring_signature(
         signatures + (real_output_index * SIG_SIZE) + KEY_SIZE, signatures + (real_output_index * SIG_SIZE), x, k);
 }
 
-static uint16_t hw__prepare_ring_signatures(
-    unsigned char *signatures,
-    unsigned char *k,
-    const unsigned char *tx_prefix_hash,
-    const unsigned char *key_image,
-    const unsigned char *public_keys,
-    const size_t real_output_index)
+/**
+ * Generates the key derivation D = (rA) through the derivation cache so that spending
+ * several outputs of the same transaction only pays for the scalar multiplication once
+ * @param derivation the resulting derivation
+ * @param public the transaction public key
+ * @param private8 the private view key as loaded by hw_sc_load8 (see hw_wallet_constants)
+ */
+static uint16_t hw_generate_key_derivation_cached(
+    unsigned char *derivation,
+    const unsigned char *public,
+    const unsigned char *private8)
 {
-    BEGIN_TRY
-    {
-#define REAL_SIG_POSITION signatures + (real_output_index * SIG_SIZE)
-        TRY
-        {
-            // clear the buffer to make sure that it's not polluted
-            explicit_bzero(BUFFER, BUFFER_SIZE);
+    // the tag binds the private view key so a cached value never outlives the keys it was made with
+    unsigned char tag[KEY_SIZE];
 
-            // copy the transaction prefix hash into the buffer
-            os_memmove(BUFFER, tx_prefix_hash, KEY_SIZE);
+    hw_keccak_t context;
 
-            // generate a random scalar
-            hw_random_scalar(k);
+    hw_keccak_init(&context);
 
-            unsigned char sum[KEY_SIZE] = {0};
+    hw_keccak_update(&context, public, KEY_SIZE);
 
-            size_t i;
+    hw_keccak_update(&context, private8, SCALAR8_LOADED_SIZE);
 
-            /**
-             * Loop through the inputs up through the number of ring
-             * participants and perform the necessary calculations to
-             * compute the ring signatures
-             */
-            for (i = 0; i < RING_PARTICIPANTS; i++)
-            {
-#define L signatures + (i * SIG_SIZE)
-#define BL BUFFER + KEY_SIZE + (i * SIG_SIZE)
-#define R signatures + (i * SIG_SIZE) + KEY_SIZE
-#define BR BL + KEY_SIZE
-#define PUBLIC_KEY public_keys + (i * KEY_SIZE)
-#define SIGNATURE signatures + (i * SIG_SIZE)
+    hw_keccak_final(&context, tag);
 
-                /**
-                 * If the current input is the "real" input being spent then
-                 * we do things a little bit differently
-                 */
-                if (i == real_output_index)
-                {
-                    // L = k * G
-                    hw_ge_scalarmult_base(BL, k);
-
-                    // Hp(P)
-                    uint16_t status = hw_hash_to_ec(BR, PUBLIC_KEY);
-
-                    if (status != OP_OK)
-                    {
-                        THROW(status);
-                    }
-
-                    // R = k * Hp(P)
-                    status = hw_ge_scalarmult(BR, BR, k);
-
-                    if (status != OP_OK)
-                    {
-                        THROW(status);
-                    }
-                }
-                else
-                {
-                    /**
-                     * If the current input is not the "real" input (a mixin)
-                     * then we do some the regular signature math
-                     */
-                    // generate a new random scalar
-                    hw_random_scalar(L);
-
-                    // generate a new random scalar
-                    hw_random_scalar(R);
-
-                    // L = (k1 * P) + (k2 * G)
-                    uint16_t status = hw_ge_double_scalarmult_base(BL, L, PUBLIC_KEY, R);
-
-                    if (status != OP_OK)
-                    {
-                        THROW(status);
-                    }
-
-                    // Hp(P)
-                    status = hw_hash_to_ec(BR, PUBLIC_KEY);
-
-                    if (status != OP_OK)
-                    {
-                        THROW(status);
-                    }
-
-                    // R = (k1 * I) + (k2 * Hp(P))
-                    status = hw_ge_double_scalarmult(BR, R, BR, L, key_image);
-
-                    if (status != OP_OK)
-                    {
-                        THROW(status);
-                    }
-
-                    // add L to the current sum
-                    hw_sc_add(sum, sum, L);
-                }
-#undef SIGNATURE
-#undef PUBLIC_KEY
-#undef BR
-#undef R
-#undef BL
-#undef L
-            }
+    explicit_bzero(&context, sizeof(context));
+
+    if (cache_derivation_get(derivation, tag) == OP_OK)
+    {
+        return hw_wipe(tag, sizeof(tag), OP_OK);
+    }
 
-            unsigned char hash[32] = {0};
+    const uint16_t status = hw_generate_key_derivation_loaded(derivation, public, private8);
 
-            // Hs(prefix + L's + R's)
-            const uint16_t status = hw_hash_to_scalar(hash, BUFFER, BUFFER_SIZE);
+    if (status != OP_OK)
+    {
+        return hw_wipe(tag, sizeof(tag), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    cache_derivation_put(tag, derivation);
 
-            // L'r = Hs(prefix + L's + R's) - sum
-            hw_sc_sub(REAL_SIG_POSITION, hash, sum);
+    return hw_wipe(tag, sizeof(tag), OP_OK);
+}
 
-            // R'r = {0}
-            explicit_bzero(REAL_SIG_POSITION + KEY_SIZE, KEY_SIZE);
+/**
+ * Loads a member of a ring as both P and Hp(P) through the ring point cache so that a
+ * member that shows up in more than one ring is only decompressed and hashed once
+ * @param point the decompressed public key P
+ * @param hash_point Hp(P)
+ * @param public_key the public key of the member
+ */
+static uint16_t hw_ring_member_points(unsigned char *point, unsigned char *hash_point, const unsigned char *public_key)
+{
+    if (cache_ring_point_get(point, hash_point, public_key) == OP_OK)
+    {
+        return OP_OK;
+    }
 
-            CLOSE_TRY;
+    hw_ge_frombytes_vartime(point, public_key);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
-#undef REAL_SIG_POSITION
-        }
+    const uint16_t status = hw_hash_to_ec_p(hash_point, public_key);
+
+    if (status != OP_OK)
+    {
+        return status;
     }
-    END_TRY;
+
+    return cache_ring_point_put(public_key, point, hash_point);
 }
 
 /**
@@ -917,57 +1526,119 @@ uint16_t hw_check_signature(
     const unsigned char *public_key,
     const unsigned char *signature)
 {
-#define S_COMM_SIZE KEY_SIZE + KEY_SIZE + KEY_SIZE
-#define MESSAGE_DIGEST BUFFER
-#define KEY MESSAGE_DIGEST + KEY_SIZE
-#define COMM KEY + KEY_SIZE
-#define SCALAR COMM + KEY_SIZE
-    BEGIN_TRY
+    PROFILE_SCOPE();
+
+    // Hs(message_digest + public_key + comm)
+    hw_keccak_t context;
+
+    hw_keccak_init(&context);
+
+    hw_keccak_update(&context, message_digest, KEY_SIZE);
+
+    hw_keccak_update(&context, public_key, KEY_SIZE);
+
+    unsigned char point[SIG_STR_SIZE];
+
+    unsigned char c[KEY_SIZE];
+
+    unsigned char r[KEY_SIZE];
+
+    unsigned char scalar[KEY_SIZE];
+
+    hw_ge_frombytes_vartime(point, public_key);
+
+    // load the signature scalars once for the whole check
+    hw_sc_load(c, signature);
+
+    hw_sc_load(r, signature + KEY_SIZE);
+
+    hw_ge_p_double_scalarmult_base(point, c, point, r);
+
+    // comm
+    hw_ge_tobytes(scalar, point);
+
+    hw_keccak_update(&context, scalar, KEY_SIZE);
+
+    hw_keccak_final_to_scalar_be(&context, scalar);
+
+    hw_scbe_sub(scalar, scalar, c);
+
+    return cx_math_is_zero(scalar, KEY_SIZE);
+}
+
+/**
+ * Checks many signatures made with the same public key. The challenge of each signature is
+ * the hash of its own commitment (cP + rG) so the commitments can not be folded into one
+ * multi-scalar check, instead P is decompressed and its table of odd multiples is built
+ * once for the whole batch and every commitment is a windowed pass over that table
+ * @param bitmap the resulting bitmap, bit (i % 8) of byte (i / 8) is set when signature i is valid
+ * @param public_key the public key (P)
+ * @param entries the message digest || signature of each signature
+ * @param count the number of signatures
+ */
+uint16_t hw_check_signatures(
+    unsigned char *bitmap,
+    const unsigned char *public_key,
+    const unsigned char *entries,
+    const size_t count)
+{
+    PROFILE_SCOPE();
+
+    hw_keccak_t context;
+
+    unsigned char point[SIG_STR_SIZE];
+
+    unsigned char c[KEY_SIZE];
+
+    unsigned char r[KEY_SIZE];
+
+    unsigned char scalar[KEY_SIZE];
+
+    unsigned char table[KEY_IMAGE_TABLE_SIZE][SIG_STR_SIZE];
+
+    // P and its odd multiples (built once for the whole batch)
+    hw_ge_frombytes_vartime(table[0], public_key);
+
+    hw_ge_p_odd_multiples(table, table[0]);
+
+    size_t i;
+
+    for (i = 0; i < count; i++)
     {
-        TRY
-        {
-            os_memmove(MESSAGE_DIGEST, message_digest, KEY_SIZE);
+#define MESSAGE_DIGEST entries + (i * (KEY_SIZE + SIG_SIZE))
+#define SIGNATURE MESSAGE_DIGEST + KEY_SIZE
+        // Hs(message_digest + public_key + comm)
+        hw_keccak_init(&context);
 
-            os_memmove(KEY, public_key, KEY_SIZE);
+        hw_keccak_update(&context, MESSAGE_DIGEST, KEY_SIZE);
 
-            uint16_t status = hw_ge_double_scalarmult_base(COMM, signature, public_key, signature + 32);
+        hw_keccak_update(&context, public_key, KEY_SIZE);
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+        hw_sc_load(c, SIGNATURE);
 
-            status = hw_hash_to_scalar(SCALAR, BUFFER, S_COMM_SIZE);
+        hw_sc_load(r, SIGNATURE + KEY_SIZE);
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+        // comm = (c * P) + (r * G)
+        hw_ge_p_double_scalarmult_table_vartime(
+            point, c, (const unsigned char(*)[SIG_STR_SIZE])table, r, C_ED25519_G);
 
-            hw_sc_sub(SCALAR, SCALAR, signature);
+        hw_ge_tobytes(scalar, point);
 
-            reverse32(SCALAR, SCALAR);
+        hw_keccak_update(&context, scalar, KEY_SIZE);
 
-            CLOSE_TRY;
+        hw_keccak_final_to_scalar_be(&context, scalar);
 
-            return cx_math_is_zero(SCALAR, KEY_SIZE);
-        }
-        CATCH_OTHER(e)
+        hw_scbe_sub(scalar, scalar, c);
+
+        if (cx_math_is_zero(scalar, KEY_SIZE))
         {
-            return e;
+            bitmap[i / 8] |= (1 << (i % 8));
         }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
-#undef SCALAR
-#undef COMM
-#undef KEY
+#undef SIGNATURE
 #undef MESSAGE_DIGEST
-#undef S_COMM_SIZE
-        }
     }
-    END_TRY;
+
+    return OP_OK;
 }
 
 uint16_t hw_check_ring_signatures(
@@ -976,93 +1647,87 @@ uint16_t hw_check_ring_signatures(
     const unsigned char *public_keys,
     const unsigned char *signatures)
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            // clear the buffer to make sure that it's not polluted
-            explicit_bzero(BUFFER, BUFFER_SIZE);
+    PROFILE_SCOPE();
 
-            // copy the transaction prefix hash into the buffer
-            os_memmove(BUFFER, tx_prefix_hash, KEY_SIZE);
+    // Hs(prefix + L's + R's) is fed as each of the values are produced
+    hw_keccak_t context;
 
-            unsigned char sum[KEY_SIZE] = {0};
+    hw_keccak_init(&context);
 
-            size_t i;
+    hw_keccak_update(&context, tx_prefix_hash, KEY_SIZE);
 
-            for (i = 0; i < RING_PARTICIPANTS; i++)
-            {
-#define BL BUFFER + KEY_SIZE + (i * SIG_SIZE)
-#define BR BL + KEY_SIZE
+    // the running sum of the L scalars (BE), reduced once all of them are in
+    unsigned char sum[SCALAR_ACC_SIZE] = {0};
+
+    unsigned char c[KEY_SIZE];
+
+    unsigned char r[KEY_SIZE];
+
+    unsigned char bytes[KEY_SIZE];
+
+    unsigned char point[SIG_STR_SIZE];
+
+    unsigned char hash_point[SIG_STR_SIZE];
+
+    unsigned char image[KEY_IMAGE_TABLE_SIZE][SIG_STR_SIZE];
+
+    // I and its odd multiples (built once for the whole ring)
+    hw_ge_frombytes_vartime(image[0], key_image);
+
+    hw_ge_p_odd_multiples(image, image[0]);
+
+    size_t i;
+
+    for (i = 0; i < RING_PARTICIPANTS; i++)
+    {
 #define PUBLIC_KEY public_keys + (i * KEY_SIZE)
 #define SIGNATURE signatures + (i * SIG_SIZE)
 #define L SIGNATURE
 #define R SIGNATURE + KEY_SIZE
-                // L = (k1 * P) + (k2 * G)
-                uint16_t status = hw_ge_double_scalarmult_base(BL, L, PUBLIC_KEY, R);
+        // P and Hp(P)
+        const uint16_t status = hw_ring_member_points(point, hash_point, PUBLIC_KEY);
+
+        if (status != OP_OK)
+        {
+            return status;
+        }
+
+        hw_sc_load(c, L);
+
+        hw_sc_load(r, R);
+
+        // L = (k1 * P) + (k2 * G)
+        hw_ge_p_double_scalarmult_base(point, c, point, r);
 
-                if (status != OP_OK)
-                {
-                    THROW(status);
-                }
+        hw_ge_tobytes(bytes, point);
 
-                // Hp(P)
-                status = hw_hash_to_ec(BR, PUBLIC_KEY);
+        hw_keccak_update(&context, bytes, KEY_SIZE);
 
-                if (status != OP_OK)
-                {
-                    THROW(status);
-                }
+        // R = (k1 * I) + (k2 * Hp(P))
+        hw_ge_p_double_scalarmult_table_vartime(
+            point, c, (const unsigned char(*)[SIG_STR_SIZE])image, r, hash_point);
 
-                // R = (k1 * I) + (k2 * Hp(P))
-                status = hw_ge_double_scalarmult(BR, R, BR, L, key_image);
+        hw_ge_tobytes(bytes, point);
 
-                if (status != OP_OK)
-                {
-                    THROW(status);
-                }
+        hw_keccak_update(&context, bytes, KEY_SIZE);
 
-                // add L to the current sum
-                hw_sc_add(sum, sum, L);
+        // add L to the current sum
+        hw_scbe_acc_add(sum, sizeof(sum), c);
 #undef R
 #undef L
 #undef SIGNATURE
 #undef PUBLIC_KEY
-#undef BR
-#undef BL
-            }
-
-            unsigned char hash[KEY_SIZE] = {0};
-
-            // Hs(prefix + L's + R's)
-            const uint16_t status = hw_hash_to_scalar(hash, BUFFER, BUFFER_SIZE);
-
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    }
 
-            // L'r = Hs(prefix + L's + R's) - sum
-            hw_sc_sub(hash, hash, sum);
+    unsigned char hash[KEY_SIZE] = {0};
 
-            reverse32(hash, hash);
+    // Hs(prefix + L's + R's)
+    hw_keccak_final_to_scalar_be(&context, hash);
 
-            CLOSE_TRY;
+    hw_scbe_acc_reduce(bytes, sum, sizeof(sum));
 
-            return cx_math_is_zero(hash, KEY_SIZE);
-        }
-        CATCH_OTHER(e)
-        {
-            // this would be (false) to mere humans
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
-        }
-    }
-    END_TRY;
+    // L'r = Hs(prefix + L's + R's) - sum is zero when both sides, which are reduced, are equal
+    return cx_math_cmp(hash, bytes, KEY_SIZE) == 0;
 }
 
 uint16_t hw_complete_ring_signature(
@@ -1071,113 +1736,91 @@ uint16_t hw_complete_ring_signature(
     const size_t output_index,
     const unsigned char *output_key,
     const unsigned char *k,
-    const unsigned char *privateView,
+    const unsigned char *privateView8,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend)
+    const unsigned char *spendPoint)
 {
-#define DERIVATION BUFFER
+    PROFILE_SCOPE();
+
+    unsigned char buffer[KEY_SIZE * 3] = {0};
+
+#define DERIVATION buffer
 #define PUBLIC_EPHEMERAL DERIVATION + KEY_SIZE
 #define PRIVATE_EPHEMERAL PUBLIC_EPHEMERAL + KEY_SIZE
 
-    BEGIN_TRY
+    // Generate the transaction key derivation D = (rA)
+    uint16_t status = hw_generate_key_derivation_cached(DERIVATION, tx_public_key, privateView8);
+
+    if (status != OP_OK)
     {
-        TRY
-        {
-            // Generate the transaction key derivation D = (rA)
-            uint16_t status = hw_generate_key_derivation(DERIVATION, tx_public_key, privateView);
+        return hw_wipe_buffer(status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the public ephemeral for the given output P = H(D || n)G + B
+    status = hw_derive_public_key(PUBLIC_EPHEMERAL, DERIVATION, output_index, spendPoint);
 
-            // Generate the public ephemeral for the given output P = H(D || n)G + B
-            status = hw_derive_public_key(PUBLIC_EPHEMERAL, DERIVATION, output_index, publicSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    /**
+     * This checks to verify that the key generation request that we are
+     * processing is for an output that was actually sent to us, otherwise, we
+     * will fail
+     */
+    status = os_memcmp(PUBLIC_EPHEMERAL, output_key, KEY_SIZE);
 
-            /**
-             * This checks to verify that the key generation request that we are
-             * processing is for an output that was actually sent to us, otherwise, we
-             * will fail
-             */
-            status = os_memcmp(PUBLIC_EPHEMERAL, output_key, KEY_SIZE);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(ERR_PUBKEY_MISMATCH);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the private ephemeral for the given output x = H(D || N) + b
+    status = hw_derive_secret_key(PRIVATE_EPHEMERAL, DERIVATION, output_index, privateSpend);
 
-            // Generate the private ephemeral for the given output x = H(D || N) + b
-            status = hw_derive_secret_key(PRIVATE_EPHEMERAL, DERIVATION, output_index, privateSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Complete the provided ring signature using the supplied k value and
+    // private ephemeral
+    hw__complete_ring_signature(signature, 0, k, PRIVATE_EPHEMERAL);
 
-            // Complete the provided ring signature using the supplied k value and
-            // private ephemeral
-            hw__complete_ring_signature(signature, 0, k, PRIVATE_EPHEMERAL);
-
-            CLOSE_TRY;
-
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
-#undef PRIVATE_EPHEMERAL
-#undef PUBLIC_EPHEMERAL
-#undef DERIVATION
-        }
-    }
-    END_TRY;
-}
+    return hw_wipe_buffer(OP_OK);
+#undef PRIVATE_EPHEMERAL
+#undef PUBLIC_EPHEMERAL
+#undef DERIVATION
+}
 
 uint16_t hw_derive_public_key(
     unsigned char *key,
     const unsigned char *derivation,
     const size_t output_index,
-    const unsigned char *publicSpend)
+    const unsigned char *spendPoint)
 {
+    PROFILE_SCOPE();
+
     unsigned char temp[KEY_SIZE] = {0};
 
-    BEGIN_TRY
+    unsigned char point[SIG_STR_SIZE];
+
+    uint16_t status = hw_derivation_to_scalar(temp, derivation, output_index);
+
+    if (status != OP_OK)
     {
-        TRY
-        {
-            const uint16_t status = hw_derivation_to_scalar(temp, derivation, output_index);
+        return hw_wipe(temp, sizeof(temp), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // P = H(D || n)G + B
+    hw_ge_p_scalarmult_base(point, temp);
 
-            hw_ge_scalarmult_base(temp, temp);
+    hw_ge_p_add(point, point, spendPoint);
 
-            CLOSE_TRY;
+    hw_ge_tobytes(key, point);
 
-            return hw_ge_add(key, temp, publicSpend);
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        };
-        FINALLY
-        {
-            explicit_bzero(temp, sizeof(temp));
-        };
-    }
-    END_TRY;
+    return hw_wipe(temp, sizeof(temp), OP_OK);
 }
 
 uint16_t hw_derive_secret_key(
@@ -1186,58 +1829,31 @@ uint16_t hw_derive_secret_key(
     const size_t output_index,
     const unsigned char *privateSpend)
 {
-    unsigned char temp[KEY_SIZE] = {0};
+    PROFILE_SCOPE();
 
-    BEGIN_TRY
-    {
-        TRY
-        {
-            const uint16_t status = hw_derivation_to_scalar(temp, derivation, output_index);
+    unsigned char temp[KEY_SIZE] = {0};
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    const uint16_t status = hw_derivation_to_scalar(temp, derivation, output_index);
 
-            hw_sc_add(key, temp, privateSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe(temp, sizeof(temp), status);
+    }
 
-            CLOSE_TRY;
+    hw_sc_add(key, temp, privateSpend);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        };
-        FINALLY
-        {
-            explicit_bzero(temp, sizeof(temp));
-        };
-    }
-    END_TRY;
+    return hw_wipe(temp, sizeof(temp), OP_OK);
 }
 
 uint16_t hw_generate_keypair(unsigned char *public, unsigned char *private)
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            hw_random_scalar(private);
+    PROFILE_SCOPE();
 
-            hw_ge_scalarmult_base(public, private);
+    hw_random_scalar(private);
 
-            CLOSE_TRY;
+    hw_ge_scalarmult_base(public, private);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY {}
-    }
-    END_TRY;
+    return OP_OK;
 }
 
 uint16_t hw_generate_ring_signatures(
@@ -1248,10 +1864,12 @@ uint16_t hw_generate_ring_signatures(
     const unsigned char *tx_prefix_hash,
     const unsigned char *public_keys,
     const size_t real_output_index,
-    const unsigned char *privateView,
+    const unsigned char *privateView8,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend)
+    const unsigned char *spendPoint)
 {
+    PROFILE_SCOPE();
+
     /**
      * We have to use a local buffer here to avoid running into issues in using
      * the shared working space that hw__generate_ring_signatures() will use
@@ -1262,110 +1880,124 @@ uint16_t hw_generate_ring_signatures(
 #define DERIVATION LOCAL_BUFFER
 #define EPHEMERAL DERIVATION + KEY_SIZE
 
-    BEGIN_TRY
-    {
-        TRY
-        {
-            // Generate the transaction key derivation D = (rA)
-            uint16_t status = hw_generate_key_derivation(DERIVATION, tx_public_key, privateView);
-
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the transaction key derivation D = (rA)
+    uint16_t status = hw_generate_key_derivation_cached(DERIVATION, tx_public_key, privateView8);
 
-            // Generate the public ephemeral for the given output P = H(D || n)G + B
-            status = hw_derive_public_key(EPHEMERAL, DERIVATION, output_index, publicSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe(buffer, sizeof(buffer), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the public ephemeral for the given output P = H(D || n)G + B
+    status = hw_derive_public_key(EPHEMERAL, DERIVATION, output_index, spendPoint);
 
-            /**
-             * This checks to verify that the key generation request that we are
-             * processing is for an output that was actually sent to us, otherwise, we
-             * will fail
-             */
-            status = os_memcmp(EPHEMERAL, output_key, KEY_SIZE);
+    if (status != OP_OK)
+    {
+        return hw_wipe(buffer, sizeof(buffer), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    /**
+     * This checks to verify that the key generation request that we are
+     * processing is for an output that was actually sent to us, otherwise, we
+     * will fail
+     */
+    status = os_memcmp(EPHEMERAL, output_key, KEY_SIZE);
 
-            // Generate the private ephemeral for the given output x = H(D || N) + b
-            status = hw_derive_secret_key(EPHEMERAL, DERIVATION, output_index, privateSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe(buffer, sizeof(buffer), ERR_PUBKEY_MISMATCH);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the private ephemeral for the given output x = H(D || N) + b
+    status = hw_derive_secret_key(EPHEMERAL, DERIVATION, output_index, privateSpend);
 
-            // generate the key image and store it in the derivation to reduce memory
-            // use
-            status = hw__generate_key_image(DERIVATION, output_key, EPHEMERAL);
+    if (status != OP_OK)
+    {
+        return hw_wipe(buffer, sizeof(buffer), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // generate the key image and store it in the derivation to reduce memory
+    // use
+    status = hw__generate_key_image(DERIVATION, output_key, EPHEMERAL);
 
-            // generate the ring signatures
-            status = hw__generate_ring_signatures(
-                signatures, tx_prefix_hash, DERIVATION, public_keys, EPHEMERAL, real_output_index);
+    if (status != OP_OK)
+    {
+        return hw_wipe(buffer, sizeof(buffer), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // generate the ring signatures
+    status = hw__generate_ring_signatures(
+        signatures, tx_prefix_hash, DERIVATION, public_keys, EPHEMERAL, real_output_index);
 
-            CLOSE_TRY;
+    if (status != OP_OK)
+    {
+        return hw_wipe(buffer, sizeof(buffer), status);
+    }
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(buffer, sizeof(buffer));
+    return hw_wipe(buffer, sizeof(buffer), OP_OK);
 #undef PRIVATE_EPHEMERAL
 #undef PUBLIC_EPHEMERAL
 #undef DERIVATION
 #undef LOCAL_BUFFER
-        }
-    }
-    END_TRY;
 }
 
 uint16_t
     hw_generate_key_derivation(unsigned char *derivation, const unsigned char *public, const unsigned char *private)
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            const uint16_t status = hw_ge_scalarmult(derivation, public, private);
+    unsigned char a8[SCALAR8_LOADED_SIZE];
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    hw_sc_load8(a8, private);
 
-            CLOSE_TRY;
+    const uint16_t status = hw_generate_key_derivation_loaded(derivation, public, a8);
 
-            return hw_ge_mul8(derivation, derivation);
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY {}
+    return hw_wipe(a8, sizeof(a8), status);
+}
+
+uint16_t hw_generate_key_derivation_loaded(
+    unsigned char *derivation,
+    const unsigned char *public,
+    const unsigned char *private8)
+{
+    unsigned char point[SIG_STR_SIZE];
+
+    hw_ge_frombytes_vartime(point, public);
+
+    // D = 8 * (a * R) = (8 * a) * R
+    hw_ge_p_scalarmult8_loaded(point, point, private8);
+
+    hw_ge_tobytes(derivation, point);
+
+    return OP_OK;
+}
+
+uint16_t hw_generate_key_derivations(
+    unsigned char *derivations,
+    const unsigned char *publics,
+    const size_t count,
+    const unsigned char *private)
+{
+    PROFILE_SCOPE();
+
+    unsigned char point[SIG_STR_SIZE];
+
+    // 8 * a is loaded once for the whole batch
+    unsigned char a8[SCALAR8_LOADED_SIZE];
+
+    hw_sc_load8(a8, private);
+
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        hw_ge_frombytes_vartime(point, publics + (i * KEY_SIZE));
+
+        // D = (8 * a) * R
+        hw_ge_p_scalarmult8_loaded(point, point, a8);
+
+        hw_ge_tobytes(derivations + (i * KEY_SIZE), point);
     }
-    END_TRY;
+
+    return hw_wipe(a8, sizeof(a8), OP_OK);
 }
 
 uint16_t hw_generate_key_image(
@@ -1373,72 +2005,59 @@ uint16_t hw_generate_key_image(
     const unsigned char *tx_public_key,
     const size_t output_index,
     const unsigned char *output_key,
-    const unsigned char *privateView,
+    const unsigned char *privateView8,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend)
+    const unsigned char *spendPoint)
 {
-    BEGIN_TRY
-    {
-#define DERIVATION BUFFER
+    PROFILE_SCOPE();
+
+    unsigned char buffer[KEY_SIZE * 3] = {0};
+
+#define DERIVATION buffer
 #define PUBLIC_EPHEMERAL DERIVATION + KEY_SIZE
 #define PRIVATE_EPHEMERAL PUBLIC_EPHEMERAL + KEY_SIZE
-        TRY
-        {
-            // Generate the transaction key derivation D = (rA)
-            uint16_t status = hw_generate_key_derivation(DERIVATION, tx_public_key, privateView);
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the transaction key derivation D = (rA)
+    uint16_t status = hw_generate_key_derivation_cached(DERIVATION, tx_public_key, privateView8);
 
-            // Generate the public ephemeral for the given output P = H(D || n)G + B
-            status = hw_derive_public_key(PUBLIC_EPHEMERAL, DERIVATION, output_index, publicSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the public ephemeral for the given output P = H(D || n)G + B
+    status = hw_derive_public_key(PUBLIC_EPHEMERAL, DERIVATION, output_index, spendPoint);
 
-            /**
-             * This checks to verify that the key generation request that we are
-             * processing is for an output that was actually sent to us, otherwise, we
-             * will fail
-             */
-            status = os_memcmp(PUBLIC_EPHEMERAL, output_key, KEY_SIZE);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(ERR_PUBKEY_MISMATCH);
-            }
+    /**
+     * This checks to verify that the key generation request that we are
+     * processing is for an output that was actually sent to us, otherwise, we
+     * will fail
+     */
+    status = os_memcmp(PUBLIC_EPHEMERAL, output_key, KEY_SIZE);
 
-            // Generate the private ephemeral for the given output x = H(D || N) + b
-            status = hw_derive_secret_key(PRIVATE_EPHEMERAL, DERIVATION, output_index, privateSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(ERR_PUBKEY_MISMATCH);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the private ephemeral for the given output x = H(D || N) + b
+    status = hw_derive_secret_key(PRIVATE_EPHEMERAL, DERIVATION, output_index, privateSpend);
 
-            CLOSE_TRY;
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            // Generate the key image I = Hp(P)x
-            return hw__generate_key_image(key_image, PUBLIC_EPHEMERAL, PRIVATE_EPHEMERAL);
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
+    // Generate the key image I = Hp(P)x
+    return hw_wipe_buffer(hw__generate_key_image(key_image, PUBLIC_EPHEMERAL, PRIVATE_EPHEMERAL));
 #undef PRIVATE_EPHEMERAL
 #undef PUBLIC_EPHEMERAL
 #undef DERIVATION
-        }
-    }
-    END_TRY;
 }
 
 uint16_t hw_generate_key_image_primitive(
@@ -1447,64 +2066,53 @@ uint16_t hw_generate_key_image_primitive(
     const size_t output_index,
     const unsigned char *output_key,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend)
+    const unsigned char *spendPoint)
 {
-    BEGIN_TRY
-    {
-#define PUBLIC_EPHEMERAL BUFFER
+    PROFILE_SCOPE();
+
+    unsigned char buffer[KEY_SIZE * 2] = {0};
+
+#define PUBLIC_EPHEMERAL buffer
 #define PRIVATE_EPHEMERAL PUBLIC_EPHEMERAL + KEY_SIZE
-        TRY
-        {
-            // Generate the public ephemeral for the given output P = H(D || n)G + B
-            uint16_t status = hw_derive_public_key(PUBLIC_EPHEMERAL, derivation, output_index, publicSpend);
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the public ephemeral for the given output P = H(D || n)G + B
+    uint16_t status = hw_derive_public_key(PUBLIC_EPHEMERAL, derivation, output_index, spendPoint);
 
-            /**
-             * This checks to verify that the key generation request that we are
-             * processing is for an output that was actually sent to us, otherwise, we
-             * will fail
-             */
-            status = os_memcmp(PUBLIC_EPHEMERAL, output_key, KEY_SIZE);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(ERR_PUBKEY_MISMATCH);
-            }
+    /**
+     * This checks to verify that the key generation request that we are
+     * processing is for an output that was actually sent to us, otherwise, we
+     * will fail
+     */
+    status = os_memcmp(PUBLIC_EPHEMERAL, output_key, KEY_SIZE);
 
-            // Generate the private ephemeral for the given output x = H(D || N) + b
-            status = hw_derive_secret_key(PRIVATE_EPHEMERAL, derivation, output_index, privateSpend);
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(ERR_PUBKEY_MISMATCH);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Generate the private ephemeral for the given output x = H(D || N) + b
+    status = hw_derive_secret_key(PRIVATE_EPHEMERAL, derivation, output_index, privateSpend);
 
-            CLOSE_TRY;
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            // Generate the key image I = Hp(P)x
-            return hw__generate_key_image(key_image, PUBLIC_EPHEMERAL, PRIVATE_EPHEMERAL);
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
+    // Generate the key image I = Hp(P)x
+    return hw_wipe_buffer(hw__generate_key_image(key_image, PUBLIC_EPHEMERAL, PRIVATE_EPHEMERAL));
 #undef PRIVATE_EPHEMERAL
 #undef PUBLIC_EPHEMERAL
-        }
-    }
-    END_TRY;
 }
 
 uint16_t hw_generate_private_view_key(unsigned char *privateView, const unsigned char *privateSpend)
 {
+    PROFILE_SCOPE();
+
     return hw_hash_to_scalar(privateView, privateSpend, KEY_SIZE);
 }
 
@@ -1514,211 +2122,444 @@ uint16_t hw_generate_signature(
     const unsigned char *public_key,
     const unsigned char *private_key)
 {
-#define S_COMM_SIZE KEY_SIZE + KEY_SIZE + KEY_SIZE
-#define MESSAGE_DIGEST BUFFER
-#define KEY MESSAGE_DIGEST + KEY_SIZE
-#define COMM KEY + KEY_SIZE
-#define K COMM + SIG_SIZE
-    BEGIN_TRY
-    {
-        TRY
-        {
-            os_memmove(MESSAGE_DIGEST, message_digest, KEY_SIZE);
+    PROFILE_SCOPE();
 
-            os_memmove(KEY, public_key, KEY_SIZE);
+    unsigned char K[KEY_SIZE];
 
-            hw_random_scalar(K);
+    unsigned char comm[KEY_SIZE];
 
-            hw_ge_scalarmult_base(COMM, K);
+    // Hs(message_digest + public_key + comm)
+    hw_keccak_t context;
 
-            const uint16_t status = hw_hash_to_scalar(signature, BUFFER, S_COMM_SIZE);
+    hw_keccak_init(&context);
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    hw_keccak_update(&context, message_digest, KEY_SIZE);
 
-            hw_sc_mulsub(signature + KEY_SIZE, signature, private_key, K);
+    hw_keccak_update(&context, public_key, KEY_SIZE);
 
-            CLOSE_TRY;
+    hw_random_scalar(K);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
-#undef K
-#undef COMM
-#undef KEY
-#undef MESSAGE_DIGEST
-#undef S_COMM_SIZE
-        }
-    }
-    END_TRY;
+    hw_ge_scalarmult_base(comm, K);
+
+    hw_keccak_update(&context, comm, KEY_SIZE);
+
+    hw_keccak_final(&context, signature);
+
+    hw_sc_reduce32(signature, signature);
+
+    hw_sc_mulsub(signature + KEY_SIZE, signature, private_key, K);
+
+    return hw_wipe(K, sizeof(K), OP_OK);
 }
 
 // cn_fast_hash
 uint16_t hw_keccak(const unsigned char *in, size_t length, unsigned char *out)
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            cx_sha3_t hw_keccak_context;
+    profile_count(PROFILE_KECCAK);
 
-            cx_keccak_init(&hw_keccak_context, KECCAK_BITS);
+    hw_keccak_t hw_keccak_context;
 
-            cx_hash((cx_hash_t *)&hw_keccak_context, CX_LAST, in, length, out, KEY_SIZE);
+#if KECCAK_IN_APP == 1
+    keccak_init(&hw_keccak_context, KECCAK_BITS);
 
-            CLOSE_TRY;
+    keccak_update(&hw_keccak_context, in, length);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return ERR_KECCAK;
-        }
-        FINALLY {}
-    }
-    END_TRY;
-}
+    keccak_final(&hw_keccak_context, out, KEY_SIZE);
+#else
+    cx_keccak_init(&hw_keccak_context, KECCAK_BITS);
 
-uint16_t hw_private_key_to_public_key(unsigned char *public, const unsigned char *private)
+    cx_hash((cx_hash_t *)&hw_keccak_context, CX_LAST, in, length, out, KEY_SIZE);
+#endif
+
+    return OP_OK;
+}
+
+uint16_t hw_keccak_init(hw_keccak_t *context)
 {
-    BEGIN_TRY
+#if KECCAK_IN_APP == 1
+    keccak_init(context, KECCAK_BITS);
+#else
+    cx_keccak_init(context, KECCAK_BITS);
+#endif
+
+    return OP_OK;
+}
+
+uint16_t hw_keccak_update(hw_keccak_t *context, const unsigned char *in, size_t length)
+{
+#if KECCAK_IN_APP == 1
+    keccak_update(context, in, length);
+#else
+    cx_hash((cx_hash_t *)context, 0, in, length, NULL, 0);
+#endif
+
+    return OP_OK;
+}
+
+uint16_t hw_keccak_final(hw_keccak_t *context, unsigned char *out)
+{
+    profile_count(PROFILE_KECCAK);
+
+#if KECCAK_IN_APP == 1
+    keccak_final(context, out, KEY_SIZE);
+#else
+    cx_hash((cx_hash_t *)context, CX_LAST, NULL, 0, out, KEY_SIZE);
+#endif
+
+    return OP_OK;
+}
+
+uint16_t hw_debug_rng_seed(const unsigned char *seed)
+{
+    if (DEBUG_BUILD != 1)
     {
-        TRY
-        {
-            hw_ge_scalarmult_base(public, private);
+        return OP_NOK;
+    }
 
-            CLOSE_TRY;
+    if (seed == NULL)
+    {
+        explicit_bzero(&L_debug_rng, sizeof(L_debug_rng));
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return ERR_PRIVATE_TO_PUBLIC;
-        }
-        FINALLY {}
+        return OP_OK;
     }
-    END_TRY;
+
+    os_memmove(L_debug_rng.seed, seed, KEY_SIZE);
+
+    L_debug_rng.counter = 0;
+
+    L_debug_rng.active = true;
+
+    return OP_OK;
 }
 
-uint16_t hw_retrieve_private_spend_key(unsigned char *private)
+uint16_t hw_nonce_drbg_domain(const uint32_t domain)
 {
-    BEGIN_TRY
+    L_nonce_drbg.domain = domain;
+
+    L_nonce_drbg.counter = 0;
+
+    L_nonce_drbg.active = L_nonce_drbg.seeded;
+
+    return (L_nonce_drbg.seeded) ? OP_OK : OP_NOK;
+}
+
+uint16_t hw_nonce_drbg_pause()
+{
+    L_nonce_drbg.active = false;
+
+    return OP_OK;
+}
+
+uint16_t hw_nonce_drbg_restore(const unsigned char *seed)
+{
+    if (NONCE_DRBG != 1)
+    {
+        return OP_OK;
+    }
+
+    os_memmove(L_nonce_drbg.seed, seed, KEY_SIZE);
+
+    L_nonce_drbg.domain = 0;
+
+    L_nonce_drbg.counter = 0;
+
+    L_nonce_drbg.seeded = true;
+
+    L_nonce_drbg.active = false;
+
+    return OP_OK;
+}
+
+uint16_t hw_nonce_drbg_save(unsigned char *seed)
+{
+    if (!L_nonce_drbg.seeded)
     {
-#define SEED BUFFER
+        explicit_bzero(seed, KEY_SIZE);
+
+        return OP_NOK;
+    }
+
+    os_memmove(seed, L_nonce_drbg.seed, KEY_SIZE);
+
+    return OP_OK;
+}
+
+uint16_t hw_nonce_drbg_start()
+{
+    if (NONCE_DRBG != 1)
+    {
+        return OP_OK;
+    }
+
+    hw_random_bytes(L_nonce_drbg.seed, KEY_SIZE);
+
+    L_nonce_drbg.domain = 0;
+
+    L_nonce_drbg.counter = 0;
+
+    L_nonce_drbg.seeded = true;
+
+    L_nonce_drbg.active = true;
+
+    return OP_OK;
+}
+
+uint16_t hw_nonce_drbg_stop()
+{
+    return hw_wipe(&L_nonce_drbg, sizeof(L_nonce_drbg), OP_OK);
+}
+
+uint16_t hw_private_key_to_public_key(unsigned char *public, const unsigned char *private)
+{
+    PROFILE_SCOPE();
+
+    hw_ge_scalarmult_base(public, private);
+
+    return OP_OK;
+}
+
+uint16_t hw_retrieve_private_spend_key(unsigned char *private, const uint8_t account)
+{
+    PROFILE_SCOPE();
+
+    unsigned char buffer[KEY_SIZE * 4] = {0};
+
+#define SEED buffer
 #define KEY SEED + KEY_SIZE + KEY_SIZE
 #define CHAIN KEY + KEY_SIZE
-        TRY
-        {
-            uint32_t bip32Path[BIP32_PATH];
 
-            os_memmove(bip32Path, derivePath, sizeof(derivePath));
+    uint32_t bip32Path[BIP32_PATH];
 
-            // Retrieve the hardware wallet seed for our defined curve and BIP-32 path
-            os_perso_derive_node_bip32(CX_CURVE_Ed25519, bip32Path, BIP32_PATH, SEED, CHAIN);
+    os_memmove(bip32Path, derivePath, sizeof(derivePath));
 
-            // Hash that seed
-            const uint16_t status = hw_keccak(SEED, KEY_SIZE, KEY);
+    // m/44'/1984'/account'/0'/0'
+    bip32Path[2] = account | HARDENED_OFFSET;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    // Retrieve the hardware wallet seed for our defined curve and BIP-32 path
+    os_perso_derive_node_bip32(CX_CURVE_Ed25519, bip32Path, BIP32_PATH, SEED, CHAIN);
 
-            // Reduce the hash to a scalar
-            hw_sc_reduce32(private, KEY);
+    // Hash that seed
+    const uint16_t status = hw_keccak(SEED, KEY_SIZE, KEY);
 
-            CLOSE_TRY;
+    if (status != OP_OK)
+    {
+        return hw_wipe_buffer(status);
+    }
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            // wipe the buffer as we don't want that leaking
-            explicit_bzero(BUFFER, BUFFER_SIZE);
+    // Reduce the hash to a scalar
+    hw_sc_reduce32(private, KEY);
+
+    return hw_wipe_buffer(OP_OK);
 #undef CHAIN
 #undef KEY
 #undef SEED
-        }
+}
+
+/**
+ * Encrypts and MACs data that is to be held by the host so that it can be handed back to us later,
+ * the nonce must never be used twice with the same key
+ * @param out the sealed data (length + KEY_SIZE bytes)
+ * @param in the data to seal
+ * @param length the length of the data
+ * @param key the sealing key that never leaves the device
+ * @param nonce what is being sealed (such as the input index)
+ */
+uint16_t hw_seal(
+    unsigned char *out,
+    const unsigned char *in,
+    const size_t length,
+    const unsigned char *key,
+    const uint32_t nonce)
+{
+    PROFILE_SCOPE();
+
+    hw_seal_cipher(out, in, length, key, nonce);
+
+    hw_seal_mac(out + length, out, length, key, nonce);
+
+    return OP_OK;
+}
+
+/**
+ * Checks and decrypts data sealed by hw_seal, nothing is decrypted unless the MAC matches
+ * @param out the data (length bytes)
+ * @param in the sealed data (length + KEY_SIZE bytes)
+ * @param length the length of the data
+ * @param key the sealing key
+ * @param nonce what was sealed
+ */
+uint16_t hw_unseal(
+    unsigned char *out,
+    const unsigned char *in,
+    const size_t length,
+    const unsigned char *key,
+    const uint32_t nonce)
+{
+    PROFILE_SCOPE();
+
+    unsigned char mac[KEY_SIZE];
+
+    hw_seal_mac(mac, in, length, key, nonce);
+
+    // compare the whole MAC so that the time taken says nothing about where it differs
+    uint8_t difference = 0;
+
+    size_t i;
+    for (i = 0; i < KEY_SIZE; i++)
+    {
+        difference |= mac[i] ^ in[length + i];
     }
-    END_TRY;
+
+    if (difference != 0)
+    {
+        return hw_wipe(mac, sizeof(mac), ERR_UNSEAL);
+    }
+
+    hw_seal_cipher(out, in, length, key, nonce);
+
+    return hw_wipe(mac, sizeof(mac), OP_OK);
 }
 
 uint16_t hw_check_key(const unsigned char *key)
 {
+    /**
+     * The most common misuse of keys is dropping a public in a private spot
+     * or a private in a public spot. This simply checks to make sure that we
+     * did not drop a scalar in where we expected a public key as a public key
+     * is never a scalar :)
+     */
+    if (hw_check_scalar(key) != OP_OK)
+    {
+        return OP_OK;
+    }
+
+    unsigned char point[SIG_STR_SIZE];
+
+    unsigned char encoded[KEY_SIZE];
+
+    volatile uint16_t status = OP_NOK;
+
+    // it also has to be a point on the curve in the one encoding that compressing it gives back
     BEGIN_TRY
     {
         TRY
         {
-            /**
-             * The most common misuse of keys is dropping a public in a private spot
-             * or a private in a public spot. This simply checks to make sure that we
-             * did not drop a scalar in where we expected a public key as a public key
-             * is never a scalar :)
-             */
-            const uint16_t status = hw_check_scalar(key);
+            hw_ge_frombytes_vartime(point, key);
 
-            if (status != OP_OK)
+            hw_ge_tobytes(encoded, point);
+
+            if (os_memcmp(encoded, key, KEY_SIZE) != 0)
             {
-                THROW(status);
+                status = OP_OK;
             }
-
-            CLOSE_TRY;
-
-            return OP_NOK;
         }
         CATCH_OTHER(e)
         {
-            return OP_OK;
+            status = OP_OK;
         }
         FINALLY {}
     }
     END_TRY;
+
+    explicit_bzero(point, sizeof(point));
+
+    return status;
 }
 
 uint16_t hw_check_scalar(const unsigned char *scalar)
 {
     unsigned char reduced[KEY_SIZE] = {0};
 
-    BEGIN_TRY
+    hw_sc_reduce32(reduced, scalar);
+
+    // a scalar is already reduced
+    const int compare = os_memcmp(reduced, scalar, KEY_SIZE);
+
+    explicit_bzero(reduced, KEY_SIZE);
+
+    if (compare != 0)
     {
-        TRY
-        {
-            hw_sc_reduce32(reduced, scalar);
+        return OP_OK;
+    }
 
-            const uint16_t status = os_memcmp(reduced, scalar, KEY_SIZE);
+    return OP_NOK;
+}
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+uint16_t hw_wallet_constants(
+    unsigned char *spendPoint,
+    unsigned char *privateView8,
+    const unsigned char *publicSpend,
+    const unsigned char *privateView)
+{
+    // B decompressed once so that deriving an output key is a single addition
+    hw_ge_frombytes_vartime(spendPoint, publicSpend);
 
-            CLOSE_TRY;
+    // 8 * a so that a derivation is a single scalar multiplication of R
+    hw_sc_load8(privateView8, privateView);
 
-            return OP_NOK;
-        }
-        CATCH_OTHER(e)
-        {
-            return OP_OK;
-        }
-        FINALLY
-        {
-            explicit_bzero(reduced, KEY_SIZE);
-        }
+    return OP_OK;
+}
+
+/**
+ * Derives the keys needed to spend an output in a single pass such that
+ * D = 8 * (a * R)
+ * x = Hs(D || n) + b
+ * I = Hp(P)x
+ * where xG must be the output key P, otherwise the output does not belong to us
+ * @param private_ephemeral the resulting private ephemeral (x)
+ * @param key_image the resulting key image (I)
+ * @param tx_public_key the transaction public key (R)
+ * @param output_index the output index (n)
+ * @param output_key the output key (P)
+ * @param privateView8 the private view key as loaded by hw_sc_load8 (8 * a)
+ * @param privateSpend the private spend key (b)
+ */
+uint16_t hw__derive_input_keys(
+    unsigned char *private_ephemeral,
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key,
+    const unsigned char *privateView8,
+    const unsigned char *privateSpend)
+{
+    PROFILE_SCOPE();
+
+    unsigned char derivation[KEY_SIZE];
+
+    unsigned char public_ephemeral[KEY_SIZE];
+
+    // D = 8 * (a * R)
+    uint16_t status = hw_generate_key_derivation_cached(derivation, tx_public_key, privateView8);
+
+    if (status != OP_OK)
+    {
+        return hw_wipe(derivation, sizeof(derivation), status);
     }
-    END_TRY;
+
+    // x = Hs(D || n) + b (the only Hs(D || n) that we need)
+    status = hw_derive_secret_key(private_ephemeral, derivation, output_index, privateSpend);
+
+    explicit_bzero(derivation, sizeof(derivation));
+
+    if (status != OP_OK)
+    {
+        return status;
+    }
+
+    /**
+     * P = xG is the same as Hs(D || n)G + B so this single check confirms both
+     * that the output is ours and that the private ephemeral matches it
+     */
+    hw_ge_scalarmult_base(public_ephemeral, private_ephemeral);
+
+    if (os_memcmp(public_ephemeral, output_key, KEY_SIZE) != 0)
+    {
+        return hw_wipe(private_ephemeral, KEY_SIZE, ERR_PUBKEY_MISMATCH);
+    }
+
+    // I = Hp(P)x
+    return hw__generate_key_image(key_image, output_key, private_ephemeral);
 }
 
 /**
@@ -1730,10 +2571,12 @@ uint16_t hw_check_scalar(const unsigned char *scalar)
  */
 uint16_t hw__generate_key_image(unsigned char *I, const unsigned char *P, const unsigned char *x)
 {
-    unsigned char HpP[KEY_SIZE] = {0};
+    PROFILE_SCOPE();
+
+    unsigned char HpP[SIG_STR_SIZE];
 
     // Hp(P)
-    uint16_t status = hw_hash_to_ec(HpP, P);
+    const uint16_t status = hw_hash_to_ec_p(HpP, P);
 
     if (status != OP_OK)
     {
@@ -1741,12 +2584,9 @@ uint16_t hw__generate_key_image(unsigned char *I, const unsigned char *P, const
     }
 
     // I = Hp(P) * x
-    status = hw_ge_scalarmult(I, HpP, x);
+    hw_ge_p_scalarmult(HpP, HpP, x);
 
-    if (status != OP_OK)
-    {
-        return status;
-    }
+    hw_ge_tobytes(I, HpP);
 
     return OP_OK;
 }
@@ -1768,19 +2608,315 @@ uint16_t hw__generate_ring_signatures(
     const unsigned char *private_ephemeral,
     const size_t real_output_index)
 {
-    unsigned char k[KEY_SIZE] = {0};
+    PROFILE_SCOPE();
+
+    hw_ring_signer_t signer;
 
-    // prepare the ring signatures
-    uint16_t status =
-        hw__prepare_ring_signatures(signatures, k, tx_prefix_hash, key_image, public_keys, real_output_index);
+    uint16_t status = hw__ring_signer_init(&signer, tx_prefix_hash, key_image);
 
     if (status != OP_OK)
     {
-        return status;
+        return hw_wipe(&signer, sizeof(signer), status);
+    }
+
+    size_t i;
+
+    for (i = 0; i < RING_PARTICIPANTS; i++)
+    {
+        status = hw__ring_signer_update(
+            &signer, signatures + (i * SIG_SIZE), public_keys + (i * KEY_SIZE), i == real_output_index);
+
+        if (status != OP_OK)
+        {
+            return hw_wipe(&signer, sizeof(signer), status);
+        }
     }
 
     // complete the ring signatures
-    hw__complete_ring_signature(signatures, real_output_index, k, private_ephemeral);
+    return hw__ring_signer_final(&signer, signatures + (real_output_index * SIG_SIZE), private_ephemeral);
+}
+
+/**
+ * Puts a ring member in the ring point cache ahead of the ring signature that needs it (see idle_post)
+ * @param public_key the public key of the member
+ */
+uint16_t hw__ring_member_warm(const unsigned char *public_key)
+{
+    unsigned char point[SIG_STR_SIZE];
+
+    unsigned char hash_point[SIG_STR_SIZE];
+
+    const uint16_t status = hw_ring_member_points(point, hash_point, public_key);
+
+    explicit_bzero(point, sizeof(point));
+
+    return hw_wipe(hash_point, sizeof(hash_point), status);
+}
+
+/**
+ * Starts a ring signature set, the challenge hash Hs(prefix + L's + R's) is absorbed
+ * member by member so that the memory used does not depend on the size of the ring.
+ * Without a prefix hash the set only produces the terms of its members (they do not
+ * depend on the prefix) and without a key image it can only replay terms produced earlier
+ * @param signer the signing state
+ * @param tx_prefix_hash the transaction prefix hash (or NULL)
+ * @param key_image the key image of the input being spent (or NULL)
+ */
+uint16_t hw__ring_signer_init(
+    hw_ring_signer_t *signer,
+    const unsigned char *tx_prefix_hash,
+    const unsigned char *key_image)
+{
+    PROFILE_SCOPE();
+
+    if (tx_prefix_hash != NULL)
+    {
+        hw_keccak_init(&signer->context);
+
+        hw_keccak_update(&signer->context, tx_prefix_hash, KEY_SIZE);
+    }
+
+    // generate a random scalar
+    hw_random_scalar(signer->k);
+
+    explicit_bzero(signer->sum, sizeof(signer->sum));
+
+    if (key_image != NULL)
+    {
+        // I and its odd multiples (built once for every mixin)
+        hw_ge_frombytes_vartime(signer->image[0], key_image);
+
+        hw_ge_p_odd_multiples(signer->image, signer->image[0]);
+    }
 
     return OP_OK;
-}
\ No newline at end of file
+}
+
+/**
+ * Adds the next member of the ring from a mixin that was prepared elsewhere (by the host)
+ * where the record holds its signature and its terms such that record = c || r || L || R,
+ * a bad record can only produce a set that does not verify as the nonce of the real member
+ * is always fresh
+ * @param signer the signing state
+ * @param signature the signature for this member
+ * @param record the prepared mixin
+ */
+uint16_t hw__ring_signer_mixin(hw_ring_signer_t *signer, unsigned char *signature, const unsigned char *record)
+{
+    PROFILE_SCOPE();
+
+    unsigned char c[KEY_SIZE];
+
+    os_memmove(signature, record, SIG_SIZE);
+
+    hw_keccak_update(&signer->context, record + SIG_SIZE, SIG_SIZE);
+
+    // add L to the current sum
+    hw_sc_load(c, record);
+
+    hw_scbe_acc_add(signer->sum, sizeof(signer->sum), c);
+
+    return OP_OK;
+}
+
+/**
+ * Replays the terms of the next member of the ring that were produced earlier by
+ * hw__ring_signer_terms, the nonce source must be in the same position as it was then so
+ * that the mixin scalars come out the same and no point arithmetic is needed
+ * @param signer the signing state
+ * @param signature the signature for this member
+ * @param terms the L and R of this member
+ * @param real whether this member is the output being spent
+ */
+uint16_t hw__ring_signer_replay(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    const unsigned char *terms,
+    const bool real)
+{
+    PROFILE_SCOPE();
+
+    hw_keccak_update(&signer->context, terms, SIG_SIZE);
+
+    if (real)
+    {
+        explicit_bzero(signature, SIG_SIZE);
+
+        return OP_OK;
+    }
+
+    unsigned char c[KEY_SIZE];
+
+    unsigned char r[KEY_SIZE];
+
+    // generate a new random scalar
+    hw_random_scalar_be(c);
+
+    // generate a new random scalar
+    hw_random_scalar_be(r);
+
+    hw_sc_unload(signature, c);
+
+    hw_sc_unload(signature + KEY_SIZE, r);
+
+    // add L to the current sum
+    hw_scbe_acc_add(signer->sum, sizeof(signer->sum), c);
+
+    return OP_OK;
+}
+
+/**
+ * Produces the terms (L and R) of the next member of the ring without absorbing them,
+ * mixins receive their final signature while the real member is zeroed
+ * @param signer the signing state
+ * @param signature the signature for this member
+ * @param terms the resulting L and R of this member
+ * @param public_key the public key of this member
+ * @param real whether this member is the output being spent
+ */
+uint16_t hw__ring_signer_terms(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    unsigned char *terms,
+    const unsigned char *public_key,
+    const bool real)
+{
+    PROFILE_SCOPE();
+
+    unsigned char c[KEY_SIZE];
+
+    unsigned char r[KEY_SIZE];
+
+    unsigned char point[SIG_STR_SIZE];
+
+    unsigned char hash_point[SIG_STR_SIZE];
+
+    if (real)
+    {
+        // L = k * G
+        hw_ge_p_scalarmult_base(point, signer->k);
+
+        hw_ge_tobytes(terms, point);
+
+        // Hp(P), P itself is not needed so a miss is not worth the decompression to fill the cache
+        if (cache_ring_point_get(NULL, point, public_key) != OP_OK)
+        {
+            const uint16_t status = hw_hash_to_ec_p(point, public_key);
+
+            if (status != OP_OK)
+            {
+                return status;
+            }
+        }
+
+        // R = k * Hp(P)
+        hw_ge_p_scalarmult(point, point, signer->k);
+
+        hw_ge_tobytes(terms + KEY_SIZE, point);
+
+        explicit_bzero(signature, SIG_SIZE);
+
+        return OP_OK;
+    }
+
+    // generate a new random scalar
+    hw_random_scalar_be(c);
+
+    // generate a new random scalar
+    hw_random_scalar_be(r);
+
+    hw_sc_unload(signature, c);
+
+    hw_sc_unload(signature + KEY_SIZE, r);
+
+    // P and Hp(P)
+    const uint16_t status = hw_ring_member_points(point, hash_point, public_key);
+
+    if (status != OP_OK)
+    {
+        return status;
+    }
+
+    // L = (k1 * P) + (k2 * G)
+    hw_ge_p_double_scalarmult_base(point, c, point, r);
+
+    hw_ge_tobytes(terms, point);
+
+    // R = (k1 * I) + (k2 * Hp(P))
+    hw_ge_p_double_scalarmult_table_vartime(
+        point, c, (const unsigned char(*)[SIG_STR_SIZE])signer->image, r, hash_point);
+
+    hw_ge_tobytes(terms + KEY_SIZE, point);
+
+    // add L to the current sum
+    hw_scbe_acc_add(signer->sum, sizeof(signer->sum), c);
+
+    return OP_OK;
+}
+
+/**
+ * Adds the next member of the ring to the signature set, mixins receive their
+ * final signature while the real member is zeroed until the set is completed
+ * @param signer the signing state
+ * @param signature the signature for this member
+ * @param public_key the public key of this member
+ * @param real whether this member is the output being spent
+ */
+uint16_t hw__ring_signer_update(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    const unsigned char *public_key,
+    const bool real)
+{
+    PROFILE_SCOPE();
+
+    unsigned char terms[SIG_SIZE];
+
+    const uint16_t status = hw__ring_signer_terms(signer, signature, terms, public_key, real);
+
+    if (status != OP_OK)
+    {
+        return status;
+    }
+
+    hw_keccak_update(&signer->context, terms, SIG_SIZE);
+
+    return OP_OK;
+}
+
+/**
+ * Completes the signature of the real member once every member of the ring has
+ * been added and wipes the signing state
+ * @param signer the signing state
+ * @param signature the signature of the real member
+ * @param private_ephemeral the private ephemeral for the input being spent
+ */
+uint16_t hw__ring_signer_final(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    const unsigned char *private_ephemeral)
+{
+    PROFILE_SCOPE();
+
+    unsigned char hash[KEY_SIZE] = {0};
+
+    unsigned char sum[KEY_SIZE];
+
+    // Hs(prefix + L's + R's)
+    hw_keccak_final_to_scalar_be(&signer->context, hash);
+
+    hw_scbe_acc_reduce(sum, signer->sum, sizeof(signer->sum));
+
+    // L'r = Hs(prefix + L's + R's) - sum
+    hw_scbe_sub(hash, hash, sum);
+
+    explicit_bzero(sum, sizeof(sum));
+
+    hw_sc_unload(signature, hash);
+
+    hw__complete_ring_signature(signature, 0, signer->k, private_ephemeral);
+
+    explicit_bzero(hash, sizeof(hash));
+
+    return hw_wipe(signer, sizeof(hw_ring_signer_t), OP_OK);
+}
@@ -20,9 +20,41 @@
 #define HW_CRYPTO_H
 
 #include <common.h>
+#include <ed25519.h>
+#include <keccak.h>
+#include <stdbool.h>
 #include <string.h>
 #include <varint.h>
 
+#define KEY_IMAGE_TABLE_SIZE 4 // I, 3I, 5I, 7I
+
+#define SCALAR_ACC_SIZE KEY_SIZE + 8 // an unreduced sum of up to 2^64 scalars (see hw_scbe_acc_add)
+
+// a cofactored scalar as hw_sc_load8 loads it: 8 * a (BE), or its signed digits when the app multiplies by itself
+#if ED25519_IN_APP == 1
+#define SCALAR8_LOADED_SIZE ED25519_DIGITS_SIZE(KEY_SIZE + 1)
+#else
+#define SCALAR8_LOADED_SIZE (KEY_SIZE + 1)
+#endif
+
+// the running hashes of hw_keccak_*, computed by the app or by cx_keccak as the build selects (KECCAK_IN_APP)
+#if KECCAK_IN_APP == 1
+typedef keccak_t hw_keccak_t;
+#else
+typedef cx_sha3_t hw_keccak_t;
+#endif
+
+typedef struct hw_ring_signer_s
+{
+    hw_keccak_t context; // Hs(prefix + L's + R's)
+
+    unsigned char k[KEY_SIZE]; // 32-bytes
+
+    unsigned char sum[SCALAR_ACC_SIZE]; // 40-bytes, unreduced running sum of the mixin L scalars (BE)
+
+    unsigned char image[KEY_IMAGE_TABLE_SIZE][SIG_STR_SIZE]; // 260-bytes, odd multiples of the (uncompressed) key image
+} hw_ring_signer_t;
+
 uint16_t hw_check_key(const unsigned char *key);
 
 uint16_t hw_check_scalar(const unsigned char *scalar);
@@ -32,6 +64,12 @@ uint16_t hw_check_signature(
     const unsigned char *public_key,
     const unsigned char *signature);
 
+uint16_t hw_check_signatures(
+    unsigned char *bitmap,
+    const unsigned char *public_key,
+    const unsigned char *entries,
+    const size_t count);
+
 uint16_t hw_check_ring_signatures(
     const unsigned char *tx_prefix_hash,
     const unsigned char *key_image,
@@ -44,15 +82,15 @@ uint16_t hw_complete_ring_signature(
     const size_t output_index,
     const unsigned char *output_key,
     const unsigned char *k,
-    const unsigned char *privateView,
+    const unsigned char *privateView8,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend);
+    const unsigned char *spendPoint);
 
 uint16_t hw_derive_public_key(
     unsigned char *key,
     const unsigned char *derivation,
     const size_t output_index,
-    const unsigned char *publicSpend);
+    const unsigned char *spendPoint);
 
 uint16_t hw_derive_secret_key(
     unsigned char *key,
@@ -63,14 +101,25 @@ uint16_t hw_derive_secret_key(
 uint16_t
     hw_generate_key_derivation(unsigned char *derivation, const unsigned char *public, const unsigned char *private);
 
+uint16_t hw_generate_key_derivation_loaded(
+    unsigned char *derivation,
+    const unsigned char *public,
+    const unsigned char *private8);
+
+uint16_t hw_generate_key_derivations(
+    unsigned char *derivations,
+    const unsigned char *publics,
+    const size_t count,
+    const unsigned char *private);
+
 uint16_t hw_generate_key_image(
     unsigned char *key_image,
     const unsigned char *tx_public_key,
     const size_t output_index,
     const unsigned char *output_key,
-    const unsigned char *privateView,
+    const unsigned char *privateView8,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend);
+    const unsigned char *spendPoint);
 
 uint16_t hw_generate_key_image_primitive(
     unsigned char *key_image,
@@ -78,7 +127,7 @@ uint16_t hw_generate_key_image_primitive(
     const size_t output_index,
     const unsigned char *output_key,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend);
+    const unsigned char *spendPoint);
 
 uint16_t hw_generate_keypair(unsigned char *public, unsigned char *private);
 
@@ -92,9 +141,9 @@ uint16_t hw_generate_ring_signatures(
     const unsigned char *tx_prefix_hash,
     const unsigned char *public_keys,
     const size_t real_output_index,
-    const unsigned char *privateView,
+    const unsigned char *privateView8,
     const unsigned char *privateSpend,
-    const unsigned char *publicSpend);
+    const unsigned char *spendPoint);
 
 uint16_t hw_generate_signature(
     unsigned char *signature,
@@ -102,11 +151,62 @@ uint16_t hw_generate_signature(
     const unsigned char *public_key,
     const unsigned char *private_key);
 
+uint16_t hw_debug_rng_seed(const unsigned char *seed);
+
 uint16_t hw_keccak(const unsigned char *in, size_t len, unsigned char *out);
 
+uint16_t hw_keccak_init(hw_keccak_t *context);
+
+uint16_t hw_keccak_update(hw_keccak_t *context, const unsigned char *in, size_t length);
+
+uint16_t hw_keccak_final(hw_keccak_t *context, unsigned char *out);
+
+uint16_t hw_nonce_drbg_domain(const uint32_t domain);
+
+uint16_t hw_nonce_drbg_pause();
+
+uint16_t hw_nonce_drbg_restore(const unsigned char *seed);
+
+uint16_t hw_nonce_drbg_save(unsigned char *seed);
+
+uint16_t hw_nonce_drbg_start();
+
+uint16_t hw_nonce_drbg_stop();
+
 uint16_t hw_private_key_to_public_key(unsigned char *public, const unsigned char *private);
 
-uint16_t hw_retrieve_private_spend_key(unsigned char *private);
+uint16_t hw_random_bytes(unsigned char *out, size_t length);
+
+uint16_t hw_retrieve_private_spend_key(unsigned char *private, const uint8_t account);
+
+uint16_t hw_seal(
+    unsigned char *out,
+    const unsigned char *in,
+    const size_t length,
+    const unsigned char *key,
+    const uint32_t nonce);
+
+uint16_t hw_unseal(
+    unsigned char *out,
+    const unsigned char *in,
+    const size_t length,
+    const unsigned char *key,
+    const uint32_t nonce);
+
+uint16_t hw_wallet_constants(
+    unsigned char *spendPoint,
+    unsigned char *privateView8,
+    const unsigned char *publicSpend,
+    const unsigned char *privateView);
+
+uint16_t hw__derive_input_keys(
+    unsigned char *private_ephemeral,
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const size_t output_index,
+    const unsigned char *output_key,
+    const unsigned char *privateView8,
+    const unsigned char *privateSpend);
 
 uint16_t hw__generate_key_image(unsigned char *I, const unsigned char *P, const unsigned char *x);
 
@@ -118,4 +218,37 @@ uint16_t hw__generate_ring_signatures(
     const unsigned char *private_ephemeral,
     const size_t real_output_index);
 
+uint16_t hw__ring_member_warm(const unsigned char *public_key);
+
+uint16_t hw__ring_signer_final(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    const unsigned char *private_ephemeral);
+
+uint16_t hw__ring_signer_init(
+    hw_ring_signer_t *signer,
+    const unsigned char *tx_prefix_hash,
+    const unsigned char *key_image);
+
+uint16_t hw__ring_signer_mixin(hw_ring_signer_t *signer, unsigned char *signature, const unsigned char *record);
+
+uint16_t hw__ring_signer_replay(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    const unsigned char *terms,
+    const bool real);
+
+uint16_t hw__ring_signer_terms(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    unsigned char *terms,
+    const unsigned char *public_key,
+    const bool real);
+
+uint16_t hw__ring_signer_update(
+    hw_ring_signer_t *signer,
+    unsigned char *signature,
+    const unsigned char *public_key,
+    const bool real);
+
 #endif // HW_CRYPTO_H
@@ -0,0 +1,2210 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+/**
+ * THIS FILE IS GENERATED BY scripts/generate_tables.js -- DO NOT EDIT
+ */
+
+#ifndef HW_CRYPTO_TABLES_H
+#define HW_CRYPTO_TABLES_H
+
+#define G_TABLE_WINDOWS 64
+#define G_TABLE_MULTIPLES 8
+#define G_TABLE_POINT_SIZE 64
+
+/**
+ * C_ED25519_G_TABLE[i][j] = (j + 1) * 16^i * G stored as X || Y (BE)
+ */
+static const unsigned char WIDE C_ED25519_G_TABLE[G_TABLE_WINDOWS][G_TABLE_MULTIPLES][G_TABLE_POINT_SIZE] = {
+    {
+        {0x21, 0x69, 0x36, 0xd3, 0xcd, 0x6e, 0x53, 0xfe, 0xc0, 0xa4, 0xe2, 0x31, 0xfd, 0xd6, 0xdc, 0x5c,
+         0x69, 0x2c, 0xc7, 0x60, 0x95, 0x25, 0xa7, 0xb2, 0xc9, 0x56, 0x2d, 0x60, 0x8f, 0x25, 0xd5, 0x1a,
+         0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+         0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x58},
+        {0x36, 0xab, 0x38, 0x4c, 0x9f, 0x5a, 0x04, 0x6c, 0x3d, 0x04, 0x3b, 0x7d, 0x18, 0x33, 0xe7, 0xac,
+         0x08, 0x0d, 0x8e, 0x45, 0x15, 0xd7, 0xa4, 0x5f, 0x83, 0xc5, 0xa1, 0x4e, 0x28, 0x43, 0xce, 0x0e,
+         0x22, 0x60, 0xcd, 0xf3, 0x09, 0x23, 0x29, 0xc2, 0x1d, 0xa2, 0x5e, 0xe8, 0xc9, 0xa2, 0x1f, 0x56,
+         0x97, 0x39, 0x0f, 0x51, 0x64, 0x38, 0x51, 0x56, 0x0e, 0x5f, 0x46, 0xae, 0x6a, 0xf8, 0xa3, 0xc9},
+        {0x67, 0xae, 0x9c, 0x4a, 0x22, 0x92, 0x8f, 0x49, 0x1f, 0xf4, 0xae, 0x74, 0x3e, 0xda, 0xc8, 0x3a,
+         0x63, 0x43, 0x98, 0x19, 0x81, 0x62, 0x48, 0x86, 0xac, 0x62, 0x48, 0x5f, 0xd3, 0xf8, 0xe2, 0x5c,
+         0x12, 0x67, 0xb1, 0xd1, 0x77, 0xee, 0x69, 0xab, 0xa1, 0x26, 0xa1, 0x8e, 0x60, 0x26, 0x9e, 0xf7,
+         0x9f, 0x16, 0xec, 0x17, 0x67, 0x24, 0x03, 0x04, 0x02, 0xc3, 0x68, 0x48, 0x78, 0xf5, 0xb4, 0xd4},
+        {0x20, 0x3d, 0xa8, 0xdb, 0x56, 0xcf, 0xf1, 0x46, 0x83, 0x25, 0xd4, 0xb8, 0x7a, 0x35, 0x20, 0xf9,
+         0x1a, 0x73, 0x9e, 0xc1, 0x93, 0xce, 0x15, 0x47, 0x49, 0x3a, 0xa6, 0x57, 0xc4, 0xc9, 0xf8, 0x70,
+         0x47, 0xd0, 0xe8, 0x27, 0xcb, 0x15, 0x95, 0xe1, 0x47, 0x0e, 0xb8, 0x85, 0x80, 0xd5, 0x71, 0x6c,
+         0x4c, 0xf2, 0x28, 0x32, 0xea, 0x2f, 0x0f, 0xf0, 0xdf, 0x38, 0xab, 0x61, 0xca, 0x32, 0x11, 0x2f},
+        {0x49, 0xfd, 0xa7, 0x3e, 0xad, 0xe3, 0x58, 0x7b, 0xfc, 0xef, 0x7c, 0xf7, 0xd1, 0x2d, 0xa5, 0xde,
+         0x5c, 0x28, 0x19, 0xf9, 0x3e, 0x1b, 0xe1, 0xa5, 0x91, 0x40, 0x9c, 0xc0, 0x32, 0x2e, 0xf2, 0x33,
+         0x5f, 0x48, 0x25, 0xb2, 0x98, 0xfe, 0xae, 0x6f, 0xe0, 0x2c, 0x6e, 0x14, 0x89, 0x92, 0x46, 0x66,
+         0x31, 0x28, 0x2e, 0xca, 0x89, 0x43, 0x0b, 0x5d, 0x10, 0xd2, 0x1f, 0x83, 0xd6, 0x76, 0xc8, 0xed},
+        {0x4c, 0x97, 0x97, 0xba, 0x7a, 0x45, 0x60, 0x1c, 0x62, 0xae, 0xac, 0xc0, 0xdd, 0x0a, 0x29, 0xbe,
+         0xa1, 0xe5, 0x99, 0x82, 0x6c, 0x7b, 0x44, 0x27, 0x78, 0x3a, 0x74, 0x1a, 0x7d, 0xcb, 0xf2, 0x3d,
+         0x05, 0x4d, 0xe3, 0xfc, 0x28, 0x86, 0xd8, 0xa1, 0x1d, 0xb7, 0x09, 0xa7, 0xfd, 0x4f, 0x7d, 0x77,
+         0xf9, 0x41, 0x7c, 0x06, 0x94, 0x4d, 0x6b, 0x60, 0xc1, 0xd2, 0x7a, 0xd0, 0xf9, 0x49, 0x7e, 0xf4},
+        {0x14, 0x56, 0x86, 0x85, 0xfc, 0xf4, 0xbd, 0x4e, 0xe9, 0xe3, 0xee, 0x19, 0x4b, 0x1d, 0x81, 0x07,
+         0x83, 0xe8, 0x09, 0xf3, 0xbb, 0xf1, 0xce, 0x95, 0x58, 0x55, 0x98, 0x1a, 0xf5, 0x0e, 0x41, 0x07,
+         0x31, 0xc5, 0x63, 0xe3, 0x2b, 0x47, 0xd5, 0x2f, 0x87, 0xce, 0x64, 0x68, 0xdd, 0x36, 0xad, 0x41,
+         0xf0, 0x88, 0x2b, 0x46, 0xf7, 0xab, 0xf2, 0x3d, 0x12, 0xc4, 0xc4, 0xb5, 0x9f, 0x40, 0x62, 0xb8},
+        {0x67, 0x42, 0xe1, 0x5f, 0x97, 0xd7, 0x71, 0xb6, 0x42, 0x86, 0x2d, 0x5c, 0xf8, 0x4e, 0xcf, 0x93,
+         0xeb, 0x3a, 0xc6, 0x7b, 0x80, 0x69, 0x8b, 0x99, 0x3b, 0x87, 0xfd, 0xbc, 0x08, 0xa5, 0x84, 0xc8,
+         0x21, 0xd3, 0x06, 0x00, 0xc9, 0xe5, 0x73, 0x79, 0x6e, 0xad, 0x6f, 0x09, 0x66, 0x8a, 0xf3, 0x8f,
+         0x81, 0x78, 0x3c, 0xfc, 0x62, 0x1e, 0xe4, 0x93, 0x1e, 0x2f, 0x5b, 0xa9, 0xfc, 0x37, 0xb9, 0xb4}
+    },
+    {
+        {0x23, 0xa4, 0x86, 0x06, 0x27, 0xe5, 0x3a, 0xee, 0xb8, 0xe2, 0x2b, 0x15, 0x08, 0x24, 0x9c, 0x91,
+         0x09, 0x57, 0x8d, 0x33, 0xe7, 0xbf, 0x23, 0x74, 0x59, 0xb2, 0x59, 0x6d, 0x6c, 0x28, 0xf9, 0xf8,
+         0x70, 0x96, 0x96, 0xf2, 0x82, 0x7f, 0xc3, 0x72, 0x9f, 0x98, 0x0f, 0x2e, 0x3a, 0xad, 0x6e, 0x78,
+         0xb0, 0x6a, 0x11, 0xff, 0x8e, 0x07, 0x9c, 0x27, 0xd8, 0x7a, 0xab, 0x37, 0xc1, 0x67, 0x27, 0xeb},
+        {0x39, 0xcf, 0x6c, 0x69, 0x17, 0x42, 0x1a, 0xf9, 0x85, 0x82, 0x56, 0x1d, 0x0b, 0x39, 0x56, 0x7d,
+         0xe6, 0x03, 0x31, 0x90, 0xf9, 0x78, 0x52, 0xfc, 0x4f, 0xdd, 0x40, 0xf6, 0x97, 0x7e, 0x4f, 0x26,
+         0x44, 0x34, 0xa9, 0x0e, 0xe1, 0x2c, 0xce, 0x6b, 0x7a, 0xde, 0x93, 0xec, 0xc0, 0xf8, 0x8b, 0x78,
+         0xb4, 0x12, 0x05, 0xe7, 0x4c, 0x8c, 0x40, 0x38, 0xf9, 0x2d, 0x39, 0x4f, 0x3a, 0x06, 0xd2, 0x69},
+        {0x4d, 0x62, 0x04, 0xa5, 0x26, 0xde, 0xc7, 0xd0, 0x9f, 0x14, 0x8a, 0x93, 0x13, 0x77, 0x04, 0x53,
+         0x2e, 0x8a, 0x41, 0xae, 0x27, 0xbd, 0x0f, 0x58, 0xcf, 0x2d, 0x0f, 0x6f, 0x7b, 0xa4, 0xd7, 0x79,
+         0x65, 0x43, 0x30, 0x72, 0x6d, 0x32, 0xaa, 0xa4, 0xa8, 0x97, 0x84, 0xe2, 0x14, 0x1f, 0xd2, 0x1a,
+         0x8b, 0xe6, 0x73, 0x87, 0x88, 0x2b, 0x44, 0xa3, 0x87, 0x45, 0xea, 0x7b, 0xa2, 0x06, 0xdf, 0x11},
+        {0x05, 0xfa, 0x64, 0x20, 0x0b, 0xf8, 0x29, 0x13, 0x9c, 0xf2, 0x90, 0xf9, 0x87, 0x1d, 0x79, 0xa8,
+         0xb8, 0xe8, 0x46, 0xfd, 0x6a, 0xd9, 0xd6, 0x78, 0xf1, 0x51, 0x7a, 0x0f, 0xb0, 0x3c, 0xa4, 0x0b,
+         0x3d, 0x19, 0x9e, 0xea, 0xf9, 0x26, 0x00, 0x28, 0x72, 0xf4, 0x86, 0x79, 0x6f, 0xa8, 0xaa, 0x4c,
+         0x99, 0xf1, 0x12, 0x5e, 0x6e, 0x0d, 0x19, 0x6a, 0xfb, 0xd6, 0x95, 0xaf, 0x17, 0xda, 0x09, 0x26},
+        {0x78, 0xb4, 0x3c, 0xc5, 0xbc, 0x02, 0x0e, 0x13, 0x51, 0x4e, 0xdd, 0x21, 0xe5, 0xa5, 0x6e, 0x1a,
+         0x19, 0x12, 0xc6, 0x15, 0x02, 0x91, 0x52, 0xa1, 0x3c, 0xdf, 0xe8, 0xd7, 0xf6, 0x42, 0x53, 0x11,
+         0x75, 0x35, 0x8a, 0x78, 0x2e, 0x64, 0xb3, 0x6e, 0x2f, 0x87, 0x62, 0x96, 0x0f, 0x21, 0x56, 0x46,
+         0xa0, 0x1f, 0xbc, 0x92, 0x6f, 0x27, 0xd6, 0xac, 0x7e, 0x18, 0x8d, 0x0c, 0xd2, 0xfb, 0x4d, 0xb9},
+        {0x00, 0x3b, 0x5c, 0x6a, 0x2e, 0x0d, 0x4c, 0xb9, 0xcb, 0xdd, 0x2d, 0xa2, 0x1e, 0xbf, 0x38, 0xf0,
+         0x15, 0x9c, 0x0b, 0x57, 0xfd, 0xb7, 0xe6, 0x32, 0xcc, 0xf5, 0x6d, 0x4f, 0xc1, 0x5b, 0x14, 0x16,
+         0x1b, 0xd9, 0x00, 0x68, 0x46, 0xac, 0xb5, 0x7c, 0x13, 0x48, 0x63, 0x97, 0x68, 0xd9, 0x84, 0x73,
+         0x6a, 0xed, 0xbd, 0xda, 0xe4, 0x1b, 0xc8, 0x13, 0x93, 0x44, 0x9f, 0xba, 0xfc, 0x24, 0x3d, 0x1e},
+        {0x38, 0x4b, 0xd6, 0x9c, 0xa7, 0xd6, 0x9c, 0xb9, 0xdc, 0x7d, 0xab, 0x33, 0x8f, 0x67, 0xd3, 0x36,
+         0x86, 0x7b, 0x24, 0xf2, 0xd9, 0x1e, 0xcf, 0xa3, 0xd7, 0xe3, 0x38, 0x0b, 0x3e, 0x48, 0xf8, 0xea,
+         0x12, 0x13, 0x51, 0xd7, 0x93, 0x52, 0xd7, 0x34, 0xa4, 0x6a, 0x16, 0xb1, 0xb8, 0xbc, 0xaa, 0xca,
+         0xbe, 0xba, 0x9c, 0x9f, 0xf3, 0x0a, 0x08, 0x41, 0x70, 0x31, 0x24, 0xb6, 0xde, 0xc0, 0xa6, 0xe5},
+        {0x37, 0x9d, 0xbe, 0xb1, 0xa9, 0x7b, 0x5f, 0x08, 0x24, 0x02, 0xea, 0xbf, 0x1a, 0xd2, 0x8b, 0xb7,
+         0x8a, 0x83, 0x7a, 0xa4, 0x26, 0x23, 0x7a, 0x40, 0x5d, 0xa2, 0x49, 0x5b, 0xf0, 0xcf, 0xdd, 0x87,
+         0x28, 0xeb, 0x9f, 0xe0, 0x01, 0xce, 0x99, 0xd0, 0x63, 0xf7, 0x99, 0x53, 0x48, 0x55, 0x9b, 0xfc,
+         0x23, 0x32, 0x61, 0xc1, 0x34, 0x09, 0x45, 0x21, 0xfd, 0xa0, 0xe7, 0xee, 0x08, 0x4b, 0x86, 0xfc}
+    },
+    {
+        {0x5e, 0x7e, 0x07, 0xed, 0x4e, 0x1d, 0xec, 0xbf, 0xe6, 0xe9, 0xcb, 0xc1, 0x26, 0x90, 0x54, 0x49,
+         0xd4, 0xb5, 0x78, 0xfb, 0xb5, 0x61, 0x57, 0x6d, 0x20, 0xb8, 0xbc, 0xdd, 0x0c, 0xc2, 0xa5, 0x56,
+         0x0f, 0x55, 0x75, 0x5c, 0x51, 0xf1, 0x02, 0x79, 0x6b, 0xf5, 0xeb, 0xaa, 0x81, 0xd3, 0x26, 0x0e,
+         0x7d, 0x1b, 0x3d, 0x9a, 0xc1, 0x27, 0xd9, 0xa8, 0x0e, 0x14, 0x20, 0x31, 0x56, 0x6c, 0xf6, 0xc7},
+        {0x2e, 0xec, 0xbf, 0x81, 0xb3, 0xd0, 0x84, 0x73, 0x33, 0x31, 0xf9, 0xee, 0xfa, 0x70, 0xd4, 0x26,
+         0x21, 0xef, 0xfd, 0x9b, 0x30, 0x39, 0x61, 0xd2, 0x54, 0x09, 0x33, 0x3c, 0x82, 0xcd, 0x34, 0x0a,
+         0x54, 0xd2, 0xdc, 0x2d, 0xa1, 0x37, 0x82, 0x7c, 0x41, 0x32, 0xd9, 0xb7, 0x40, 0xa1, 0x19, 0xb6,
+         0x48, 0x4d, 0x4d, 0x48, 0x49, 0xe6, 0xe0, 0x74, 0xb8, 0x9c, 0xf7, 0x64, 0x00, 0x8b, 0x93, 0xe8},
+        {0x70, 0xb2, 0x25, 0x14, 0x74, 0x63, 0xbe, 0x28, 0xa5, 0xaa, 0x7b, 0x18, 0x79, 0xcd, 0x8d, 0xbe,
+         0x57, 0xea, 0xdd, 0x2a, 0xa5, 0x3d, 0x51, 0xb9, 0x45, 0x66, 0xce, 0xf3, 0x14, 0xcc, 0x93, 0xbb,
+         0x24, 0x49, 0x80, 0xde, 0xd3, 0x2f, 0xf4, 0x01, 0xc2, 0x60, 0x67, 0x27, 0xf9, 0x4d, 0x60, 0x9a,
+         0x14, 0x79, 0x34, 0x00, 0x4d, 0xd9, 0x16, 0x0a, 0x5b, 0x9e, 0x73, 0x92, 0xb1, 0x8d, 0x9c, 0x02},
+        {0x6b, 0x11, 0x3a, 0x52, 0xf9, 0xf3, 0xfd, 0x05, 0x90, 0xac, 0x7c, 0xb6, 0xc8, 0xcb, 0xb3, 0x7a,
+         0xbc, 0xf1, 0x47, 0xc4, 0x4b, 0x2a, 0xe1, 0x1d, 0x91, 0x51, 0xc7, 0xd5, 0x5b, 0x4a, 0x2b, 0x68,
+         0x1a, 0xeb, 0x01, 0x71, 0x59, 0x69, 0x7e, 0x79, 0x2e, 0xb8, 0xda, 0x18, 0x05, 0x51, 0x9c, 0x06,
+         0x29, 0x65, 0x95, 0xf4, 0xf5, 0x79, 0x96, 0xc5, 0x90, 0x95, 0x43, 0x59, 0xf3, 0x27, 0xc1, 0x3d},
+        {0x66, 0x1b, 0x75, 0x75, 0x7a, 0xbb, 0xc1, 0x79, 0xad, 0x6a, 0x11, 0xdd, 0x39, 0x90, 0x40, 0x59,
+         0x1e, 0x05, 0x7e, 0xe8, 0x3f, 0xe6, 0x42, 0x87, 0x19, 0xc2, 0xfd, 0xe6, 0xe9, 0xa9, 0x5b, 0xd2,
+         0x05, 0xda, 0x1a, 0xe1, 0xb5, 0xd4, 0xbb, 0x12, 0xf0, 0xce, 0x02, 0x2f, 0x4f, 0x80, 0x7c, 0x07,
+         0xd1, 0x0c, 0x95, 0x57, 0xd6, 0xdb, 0x12, 0xae, 0x49, 0x7d, 0x97, 0xe4, 0x2a, 0x7b, 0x09, 0xbe},
+        {0x60, 0x3b, 0xa4, 0xad, 0xc3, 0x4a, 0x9f, 0xeb, 0x3b, 0x4b, 0x4d, 0xe2, 0x20, 0x65, 0xbd, 0x3e,
+         0x2c, 0xaf, 0xd6, 0xaa, 0xc3, 0x14, 0x20, 0x34, 0x2f, 0xea, 0x3c, 0x8a, 0xb6, 0x49, 0x06, 0x15,
+         0x1f, 0xdb, 0xaf, 0x2c, 0x34, 0x82, 0xcc, 0xd9, 0x0f, 0xac, 0xd4, 0x6a, 0xe0, 0x46, 0xc5, 0x0c,
+         0xbc, 0x48, 0xbe, 0x06, 0xd2, 0xf3, 0x7a, 0x9a, 0x81, 0x2a, 0x2a, 0x95, 0xc0, 0xe6, 0x58, 0xbc},
+        {0x3d, 0x71, 0x8e, 0x64, 0x4b, 0xf2, 0xd3, 0xa4, 0x5d, 0x1e, 0x15, 0xaf, 0x3a, 0xf9, 0xe3, 0x30,
+         0xeb, 0xd6, 0xa8, 0x5b, 0xd1, 0x2c, 0x16, 0x93, 0x36, 0x9d, 0x40, 0x31, 0x0b, 0x39, 0x1d, 0x99,
+         0x32, 0x0d, 0x05, 0x5d, 0xbb, 0xa3, 0xf4, 0x14, 0x2f, 0x22, 0x88, 0x11, 0x3a, 0x22, 0xa8, 0x92,
+         0x5f, 0x90, 0x2a, 0xc7, 0x7f, 0x1f, 0x72, 0x80, 0xa8, 0x8e, 0x3b, 0xf5, 0xa2, 0x36, 0x00, 0xf9},
+        {0x3c, 0x1a, 0xe7, 0x52, 0x76, 0x12, 0xd3, 0x8b, 0xb5, 0x41, 0xf5, 0x11, 0xfc, 0xc6, 0x28, 0x3d,
+         0x84, 0x82, 0xaf, 0xe9, 0x31, 0x15, 0xb3, 0x45, 0xec, 0xd2, 0xbc, 0xfb, 0xbd, 0x13, 0x17, 0xf7,
+         0x05, 0x1c, 0x91, 0xc3, 0xf9, 0xd7, 0xe5, 0x7e, 0xb7, 0x86, 0x11, 0x6c, 0x85, 0x45, 0xf9, 0x0f,
+         0xa6, 0x7f, 0x5e, 0x8b, 0x62, 0xc3, 0x2a, 0xc4, 0x51, 0x20, 0x15, 0xa2, 0x07, 0x11, 0x36, 0x4e}
+    },
+    {
+        {0x7d, 0x13, 0xc0, 0x24, 0x8b, 0x89, 0x1b, 0x47, 0xeb, 0x52, 0x4f, 0x26, 0x92, 0x00, 0x8e, 0x2f,
+         0x97, 0xb1, 0x99, 0xba, 0xc4, 0x26, 0xcb, 0x59, 0x02, 0xb9, 0x00, 0x3a, 0x29, 0xde, 0xd6, 0xea,
+         0x59, 0xa9, 0x76, 0xab, 0x2c, 0x01, 0xa8, 0x1a, 0x91, 0xf1, 0xa5, 0x6c, 0x75, 0xcc, 0xc7, 0x7a,
+         0x9e, 0x1e, 0x9e, 0x87, 0x8e, 0x9f, 0xe9, 0xc3, 0x95, 0x20, 0x80, 0xa6, 0x80, 0x5b, 0x20, 0xd5},
+        {0x17, 0xd5, 0xa9, 0xff, 0x7f, 0x33, 0x8d, 0x8e, 0xe5, 0x3c, 0x26, 0x53, 0x1f, 0x9a, 0x5d, 0x4a,
+         0xd2, 0x71, 0x82, 0x34, 0xb5, 0xd4, 0x6a, 0x14, 0x35, 0xaa, 0x16, 0x10, 0x31, 0xb1, 0xc9, 0xde,
+         0x73, 0x02, 0x22, 0x87, 0xd3, 0xb7, 0x3f, 0x6c, 0x43, 0xc3, 0xf9, 0x07, 0x1c, 0xf0, 0xa8, 0x7a,
+         0xac, 0x83, 0xda, 0xbd, 0x44, 0xef, 0xad, 0x1d, 0xe0, 0x10, 0xd5, 0x64, 0xa4, 0xf6, 0xaf, 0x89},
+        {0x08, 0x6f, 0x2f, 0x76, 0x8e, 0xec, 0x28, 0x9d, 0x7b, 0x7d, 0x2f, 0x8c, 0xbd, 0xbf, 0x7b, 0x56,
+         0xed, 0xe3, 0xec, 0x13, 0xee, 0x42, 0xd0, 0x87, 0x69, 0xec, 0x71, 0x2f, 0x13, 0x49, 0x1d, 0x64,
+         0x72, 0x94, 0x5a, 0x90, 0x33, 0x8f, 0x3c, 0xa0, 0xec, 0x52, 0xee, 0xa5, 0x01, 0xca, 0xe2, 0xd6,
+         0x91, 0x5b, 0xeb, 0xf0, 0x89, 0x36, 0x03, 0x57, 0x4e, 0xfc, 0xef, 0x15, 0x4d, 0x5f, 0xf5, 0x22},
+        {0x07, 0xa8, 0xbc, 0x68, 0xbf, 0x5f, 0x3e, 0xd3, 0xbe, 0xd7, 0x9c, 0x11, 0xbf, 0x2d, 0x6b, 0x20,
+         0xcb, 0x84, 0x44, 0x2d, 0xfe, 0x4a, 0xe1, 0x85, 0xb0, 0xc2, 0xda, 0xbc, 0x38, 0xe7, 0x4b, 0x8a,
+         0x72, 0x49, 0xd7, 0xc4, 0x7a, 0xfd, 0x42, 0x70, 0x18, 0xb3, 0x2d, 0x20, 0xa2, 0xa8, 0x13, 0x07,
+         0xbd, 0xdc, 0x3e, 0x03, 0x95, 0x74, 0xc8, 0x03, 0x29, 0xaa, 0x78, 0x6a, 0x22, 0x28, 0x89, 0x01},
+        {0x40, 0x26, 0x04, 0x6d, 0x77, 0x7a, 0x6c, 0x85, 0x09, 0x19, 0xc5, 0xba, 0xed, 0x48, 0x73, 0x22,
+         0xc0, 0xbf, 0x25, 0x65, 0x4e, 0x44, 0x8c, 0xe2, 0x3f, 0x9d, 0x7e, 0xb8, 0x77, 0xd9, 0x2b, 0xc3,
+         0x59, 0xc7, 0x11, 0xb1, 0xd9, 0x13, 0x6c, 0x1b, 0x74, 0x7a, 0xd3, 0x1a, 0xba, 0x2c, 0xa8, 0xcd,
+         0x51, 0x0f, 0x84, 0xb3, 0x41, 0x09, 0x98, 0x4f, 0xda, 0x6a, 0x25, 0x3c, 0x1e, 0xda, 0x97, 0xc1},
+        {0x34, 0xf4, 0xc8, 0xc3, 0x5f, 0x88, 0x73, 0x3d, 0xf1, 0x77, 0xed, 0x7c, 0xe5, 0x46, 0x4a, 0xf3,
+         0xb8, 0xec, 0x99, 0x6a, 0xe1, 0x15, 0xa5, 0x7f, 0xee, 0x2b, 0x9e, 0xfb, 0x16, 0xd2, 0xc3, 0x4d,
+         0x67, 0x7b, 0x89, 0xcd, 0x3d, 0x6f, 0x14, 0x3c, 0x13, 0x88, 0x64, 0xec, 0xc9, 0x29, 0x52, 0xb0,
+         0xc9, 0x5b, 0xa4, 0xdb, 0x17, 0x1a, 0xda, 0x60, 0xe8, 0xa3, 0xae, 0x0f, 0x9e, 0x07, 0xbd, 0x96},
+        {0x43, 0xae, 0xe4, 0x27, 0x72, 0x4e, 0x56, 0x52, 0x95, 0x7c, 0x7f, 0x03, 0x38, 0x8b, 0x16, 0x0b,
+         0x90, 0x22, 0x28, 0x0b, 0xca, 0xca, 0xa1, 0x97, 0xf7, 0x13, 0xad, 0x74, 0xcc, 0xfe, 0xf7, 0xf9,
+         0x43, 0x56, 0xa6, 0x46, 0xeb, 0xa8, 0x9f, 0xb7, 0xb3, 0xe7, 0x1a, 0x1a, 0x74, 0xe1, 0x39, 0x60,
+         0x70, 0x98, 0xbf, 0xed, 0x18, 0x3f, 0x60, 0xea, 0x94, 0xcb, 0x72, 0x44, 0xf1, 0x8d, 0x16, 0xbc},
+        {0x5b, 0x4f, 0xd9, 0xf4, 0xa9, 0xa7, 0x9b, 0x1f, 0x34, 0xa4, 0xc4, 0x26, 0xc1, 0xa4, 0x67, 0xd3,
+         0x65, 0x60, 0x33, 0x8b, 0x1a, 0x54, 0x57, 0xe8, 0x32, 0x54, 0x93, 0x5c, 0x2b, 0x32, 0xff, 0x02,
+         0x40, 0xeb, 0xd1, 0x23, 0x04, 0x68, 0xfb, 0xf8, 0x5a, 0x49, 0xaa, 0x47, 0x27, 0x8e, 0xc1, 0x37,
+         0x5a, 0x3c, 0xf9, 0xc2, 0xec, 0xc5, 0xbb, 0xdf, 0x68, 0x5b, 0x26, 0x54, 0x33, 0xb0, 0x8d, 0x46}
+    },
+    {
+        {0x5d, 0xe7, 0xfa, 0xa2, 0xee, 0x4e, 0x70, 0x13, 0x2f, 0x54, 0x1f, 0x79, 0xca, 0x07, 0xcd, 0x54,
+         0xa3, 0x9f, 0xe1, 0x34, 0x7a, 0x68, 0x44, 0xd1, 0x9e, 0x9d, 0x67, 0x8a, 0x84, 0x11, 0xa5, 0x65,
+         0x2c, 0x9f, 0x23, 0x64, 0x1e, 0x1c, 0x2e, 0x0a, 0xab, 0x8e, 0xa9, 0x92, 0x6b, 0x43, 0x2d, 0x92,
+         0xc0, 0xe8, 0xbc, 0x08, 0x90, 0x1d, 0x6f, 0xf6, 0xdf, 0x85, 0xe4, 0xce, 0xf8, 0x54, 0xec, 0x36},
+        {0x74, 0xe3, 0x37, 0xa0, 0x1c, 0x13, 0xb5, 0x37, 0x32, 0x36, 0x63, 0x60, 0x28, 0x11, 0xd1, 0xd5,
+         0x32, 0xd8, 0x74, 0x7e, 0x81, 0x48, 0x94, 0x15, 0x27, 0x14, 0x11, 0xb1, 0x72, 0xd0, 0x4f, 0x27,
+         0x08, 0x64, 0x8f, 0x02, 0xb3, 0xa4, 0xda, 0xf9, 0x6e, 0xcf, 0xfa, 0xbd, 0xba, 0xf3, 0x59, 0x9f,
+         0xb2, 0xee, 0x85, 0xda, 0xe2, 0x53, 0xb2, 0xc2, 0x1c, 0xe6, 0x67, 0x96, 0x11, 0x4e, 0x25, 0xf1},
+        {0x73, 0xce, 0x78, 0xc7, 0x48, 0xa8, 0x72, 0xf2, 0xa1, 0x97, 0xa7, 0xa1, 0x6f, 0xff, 0xc8, 0x1c,
+         0x88, 0x14, 0xe0, 0x7e, 0x49, 0x37, 0x9e, 0xeb, 0x4d, 0xd9, 0x4e, 0x43, 0x90, 0xd7, 0xc2, 0x90,
+         0x33, 0xc1, 0x72, 0xe6, 0x06, 0x06, 0x2e, 0xc6, 0xfe, 0x39, 0x63, 0xcb, 0xf9, 0x60, 0xe0, 0x70,
+         0xce, 0xae, 0x65, 0x3d, 0x3f, 0xbb, 0xa9, 0x94, 0x94, 0x7d, 0xe1, 0x3a, 0x0a, 0x0c, 0xb2, 0xca},
+        {0x6a, 0x6f, 0xbd, 0x51, 0xef, 0xa6, 0xa8, 0x55, 0xe8, 0x2c, 0xb0, 0x14, 0x23, 0x25, 0xba, 0x47,
+         0x3f, 0xd7, 0x55, 0x4a, 0xba, 0x20, 0x8a, 0x40, 0x07, 0x37, 0x47, 0x54, 0x64, 0xf2, 0x94, 0x34,
+         0x16, 0xf5, 0xf8, 0x52, 0x9f, 0x55, 0xfc, 0x2b, 0x7c, 0xf8, 0x11, 0x16, 0x1d, 0x78, 0x70, 0xad,
+         0xe1, 0xd1, 0x61, 0x7e, 0x52, 0xc3, 0xc4, 0xf5, 0x79, 0xea, 0x06, 0xb2, 0x76, 0x16, 0xd6, 0x71},
+        {0x45, 0x5d, 0x90, 0x5f, 0x52, 0xd0, 0x4b, 0x5f, 0xf7, 0x4b, 0xee, 0xbb, 0x11, 0xd7, 0x74, 0xb2,
+         0xc5, 0x76, 0x4a, 0x4d, 0xfa, 0xcc, 0x3b, 0xca, 0x34, 0x45, 0x53, 0x2a, 0x8f, 0x32, 0x0c, 0xa8,
+         0x03, 0x3d, 0xbf, 0x27, 0x1d, 0x5f, 0xc7, 0x2b, 0x69, 0xbc, 0x22, 0x7b, 0xb0, 0xc7, 0x91, 0x3b,
+         0x1e, 0xef, 0x9b, 0xac, 0xa6, 0xc0, 0x28, 0x54, 0x65, 0x74, 0x60, 0x47, 0x0f, 0xe6, 0xa8, 0xb5},
+        {0x58, 0x4e, 0x7f, 0x2a, 0x5e, 0x36, 0x71, 0x73, 0x7f, 0x70, 0x5f, 0x1a, 0x90, 0x6d, 0xab, 0x67,
+         0x57, 0x06, 0x54, 0x9e, 0x04, 0x91, 0xe9, 0xaa, 0xf2, 0x64, 0x64, 0x3d, 0xca, 0x20, 0x43, 0x9a,
+         0x2e, 0x53, 0x27, 0x98, 0x2a, 0x30, 0xdf, 0xe8, 0x12, 0x32, 0xf3, 0xdb, 0xc0, 0xe9, 0xb8, 0x84,
+         0x33, 0x47, 0x32, 0x0e, 0xc0, 0xf6, 0x5d, 0x96, 0x22, 0xf8, 0xfe, 0x4e, 0x54, 0x7c, 0x13, 0x81},
+        {0x77, 0x83, 0xd6, 0x19, 0xf5, 0x2f, 0x8b, 0xd4, 0xe0, 0xc8, 0x39, 0xd8, 0xc7, 0xe2, 0x08, 0x5d,
+         0x11, 0xce, 0x2f, 0xed, 0x6a, 0xbd, 0xa9, 0xa6, 0x66, 0x6e, 0x57, 0xc7, 0x25, 0xde, 0x8f, 0xce,
+         0x7b, 0x87, 0xc3, 0x37, 0x01, 0xd6, 0x09, 0xfe, 0x83, 0x42, 0x12, 0x3d, 0x99, 0xe9, 0xeb, 0xfd,
+         0x44, 0x53, 0xac, 0x1a, 0x10, 0x0d, 0x82, 0x38, 0xb0, 0x05, 0xcf, 0xc4, 0x60, 0x0c, 0x5c, 0x4d},
+        {0x24, 0x3e, 0xb1, 0x88, 0xde, 0x73, 0xa5, 0x54, 0x9b, 0x32, 0xc3, 0x9d, 0x2e, 0xf1, 0xb2, 0x96,
+         0x23, 0x70, 0x9a, 0x9e, 0xad, 0x4c, 0x0e, 0x24, 0x03, 0x14, 0xe0, 0xc5, 0xf6, 0x9a, 0x96, 0x34,
+         0x37, 0x79, 0x29, 0x89, 0x51, 0xf4, 0x52, 0xd8, 0x01, 0xeb, 0x7a, 0x0b, 0x7e, 0xb2, 0x24, 0xcc,
+         0xa2, 0xdb, 0xef, 0x04, 0x10, 0x81, 0xcf, 0xa5, 0x82, 0xaf, 0xb2, 0x5b, 0x1f, 0x4c, 0xe2, 0xf6}
+    },
+    {
+        {0x06, 0xb3, 0x49, 0xee, 0xbf, 0xed, 0x4d, 0xad, 0x4a, 0x80, 0x5b, 0x63, 0xa6, 0xed, 0x22, 0x31,
+         0xa5, 0x65, 0xcd, 0xa7, 0x52, 0xd9, 0x47, 0x7f, 0xf4, 0x27, 0xdd, 0x9a, 0x8c, 0x9a, 0xb5, 0xed,
+         0x07, 0xa0, 0x92, 0x89, 0xff, 0x3e, 0x1f, 0x9a, 0xab, 0x68, 0xaa, 0x37, 0x4c, 0x48, 0xdf, 0x65,
+         0xf5, 0x50, 0xc2, 0x32, 0x36, 0x07, 0xb9, 0x77, 0x44, 0xde, 0xe9, 0x90, 0x60, 0x8b, 0x64, 0xf8},
+        {0x48, 0x2a, 0x4c, 0xdf, 0x57, 0xd9, 0xea, 0xda, 0xab, 0x1c, 0x92, 0xb8, 0xed, 0xd4, 0xd1, 0x5f,
+         0x66, 0xa3, 0x9c, 0x16, 0xb2, 0xeb, 0xaa, 0xf9, 0xec, 0x31, 0x4a, 0xc0, 0x19, 0x9c, 0x4f, 0x7d,
+         0x73, 0x91, 0xde, 0x43, 0x81, 0xc2, 0xf7, 0xa8, 0x0b, 0x3c, 0x5f, 0xc6, 0x14, 0x51, 0x92, 0x98,
+         0x3f, 0x11, 0x5f, 0xa5, 0x25, 0xe4, 0xfd, 0x6a, 0xbd, 0x51, 0x3b, 0x11, 0x6e, 0x4e, 0xb0, 0x4b},
+        {0x30, 0x10, 0xb9, 0xcf, 0x57, 0x73, 0x82, 0x25, 0x13, 0x85, 0x0e, 0x1b, 0xf1, 0x01, 0x81, 0xda,
+         0x70, 0xe1, 0xa9, 0xb1, 0x24, 0xe8, 0x0b, 0xea, 0x80, 0xae, 0x65, 0xbf, 0x75, 0x1e, 0x85, 0xa7,
+         0x20, 0xb5, 0x30, 0xd1, 0xf5, 0x06, 0x1d, 0xb7, 0x7a, 0x69, 0x76, 0x77, 0x47, 0x2a, 0x34, 0x46,
+         0x68, 0xf3, 0x4b, 0x3b, 0xd1, 0x13, 0xbf, 0xa4, 0xba, 0x17, 0xcc, 0x63, 0xe2, 0x68, 0xda, 0x41},
+        {0x3b, 0xad, 0x86, 0xde, 0xfe, 0x0d, 0x24, 0x4d, 0xcc, 0x4b, 0x24, 0x6c, 0x13, 0x7d, 0xcc, 0x68,
+         0xbf, 0x6b, 0x73, 0x3d, 0x1f, 0xff, 0x68, 0x8f, 0x33, 0x43, 0x1f, 0x2a, 0x33, 0x9f, 0x8f, 0x3c,
+         0x2d, 0xe3, 0xcd, 0xf2, 0xfa, 0x86, 0xba, 0x8c, 0x2b, 0x89, 0x9f, 0x9f, 0xc0, 0x4b, 0x8d, 0x53,
+         0x84, 0x14, 0x5c, 0x3f, 0x68, 0xea, 0x9b, 0x6e, 0xe0, 0x53, 0x73, 0xdc, 0x01, 0x81, 0x51, 0x79},
+        {0x5c, 0x08, 0xc8, 0xa6, 0xbc, 0xe5, 0x42, 0xe1, 0x48, 0xf2, 0x4f, 0x20, 0xdd, 0x22, 0x7e, 0xa2,
+         0xca, 0xa3, 0x4a, 0x43, 0x83, 0x92, 0xd1, 0x53, 0xc5, 0x9a, 0xd2, 0xcc, 0xc8, 0x66, 0xb2, 0x08,
+         0x5a, 0x21, 0x79, 0xb1, 0xe6, 0x9c, 0x86, 0x6b, 0xd9, 0x1d, 0x68, 0x69, 0x42, 0xaf, 0x57, 0xbf,
+         0x43, 0x76, 0x6f, 0x5d, 0x9b, 0xc3, 0x99, 0xc4, 0xa9, 0x9d, 0x20, 0xc6, 0x2b, 0xdc, 0x8c, 0x2b},
+        {0x28, 0x7c, 0xe5, 0x3c, 0x7d, 0xcf, 0x4e, 0x89, 0x97, 0xb0, 0x95, 0xa0, 0xad, 0x91, 0x63, 0x36,
+         0x0e, 0x4a, 0xb7, 0x9d, 0x60, 0x6b, 0xcc, 0xab, 0x52, 0x84, 0x3d, 0xdb, 0x5a, 0x29, 0xf9, 0x06,
+         0x2d, 0xe9, 0x09, 0x89, 0xb7, 0x4e, 0x58, 0xb5, 0x2b, 0x00, 0x46, 0xcd, 0xf8, 0xc2, 0x27, 0xbf,
+         0x6d, 0x89, 0xca, 0x9d, 0x7e, 0x44, 0x9a, 0xdf, 0xca, 0xcc, 0xbd, 0xc6, 0xfd, 0x98, 0x69, 0x2e},
+        {0x67, 0x83, 0x31, 0x64, 0x29, 0x4b, 0x32, 0xa9, 0xce, 0xce, 0xc5, 0x20, 0xb4, 0xe9, 0xb3, 0xfd,
+         0xa0, 0xda, 0xa1, 0xd1, 0x10, 0x05, 0x63, 0x4a, 0x65, 0x97, 0x3a, 0x8d, 0x2b, 0x1e, 0xbf, 0x8c,
+         0x62, 0x15, 0xfb, 0x62, 0x25, 0x15, 0xfa, 0x2e, 0x8a, 0xf4, 0xf2, 0x91, 0x61, 0xbb, 0xa9, 0x64,
+         0xa3, 0xb2, 0xc3, 0xd9, 0x31, 0x3c, 0xa0, 0xdd, 0xba, 0x35, 0x6e, 0xb7, 0xeb, 0x9e, 0x72, 0xea},
+        {0x45, 0xaf, 0xc8, 0x5d, 0xc5, 0x71, 0xed, 0x1b, 0xd5, 0xe8, 0x11, 0x5a, 0x96, 0x22, 0xd4, 0x46,
+         0x27, 0xcf, 0x19, 0xfc, 0x4a, 0x86, 0x26, 0xe7, 0xb7, 0x54, 0xb0, 0x05, 0xcb, 0x75, 0xbe, 0x54,
+         0x6c, 0x0c, 0x8a, 0xbf, 0xa6, 0x0b, 0xfc, 0x77, 0x1e, 0x39, 0xa1, 0x8f, 0x57, 0xb8, 0x14, 0x2f,
+         0x7a, 0xdb, 0xcf, 0x22, 0x0b, 0x81, 0xee, 0x23, 0x39, 0x80, 0x9e, 0x49, 0x57, 0x77, 0x7b, 0x40}
+    },
+    {
+        {0x0a, 0xf3, 0x67, 0x95, 0x6a, 0xf6, 0x30, 0x26, 0x6b, 0x1c, 0xc7, 0x60, 0x15, 0x42, 0x56, 0xed,
+         0x79, 0xda, 0x96, 0x0d, 0xdd, 0xca, 0x9d, 0x72, 0xa1, 0xe8, 0xcf, 0x27, 0xd8, 0xd4, 0x3a, 0x77,
+         0x21, 0x10, 0x8d, 0x90, 0x01, 0x34, 0xd3, 0xb3, 0x70, 0x8d, 0xd2, 0x8a, 0xce, 0x96, 0xb0, 0xb2,
+         0x3d, 0xda, 0x91, 0x00, 0xe4, 0xb6, 0xa6, 0x2a, 0x81, 0x31, 0xbd, 0x2f, 0x2b, 0xa4, 0x08, 0xc5},
+        {0x2b, 0x76, 0x01, 0x54, 0xfc, 0x5c, 0xeb, 0x5a, 0x64, 0x14, 0x13, 0x45, 0xf5, 0x5b, 0x1b, 0x57,
+         0xe5, 0xb0, 0xb1, 0xd6, 0xc5, 0xa0, 0x7d, 0xea, 0x8d, 0xdf, 0x07, 0x4f, 0xba, 0xe7, 0x0d, 0x33,
+         0x7d, 0xc8, 0x1a, 0xf9, 0x6f, 0xed, 0x42, 0xe0, 0x37, 0x34, 0x11, 0x20, 0x3f, 0xa2, 0xce, 0xd7,
+         0x62, 0x9f, 0xb2, 0xeb, 0x6a, 0x20, 0x54, 0xe2, 0x4a, 0xfe, 0x36, 0x96, 0xaf, 0xc2, 0x0c, 0x02},
+        {0x45, 0x35, 0xc8, 0x93, 0x11, 0xd6, 0x04, 0xf3, 0xaa, 0xa0, 0xe4, 0xd8, 0x8d, 0x9d, 0x7b, 0x51,
+         0x4f, 0x3d, 0x23, 0xc8, 0xf1, 0xd3, 0xdc, 0xca, 0xc1, 0x42, 0x3f, 0x36, 0xe8, 0x11, 0xb9, 0xd8,
+         0x69, 0xdd, 0x36, 0x61, 0xba, 0x84, 0xb8, 0xe1, 0xaa, 0xa2, 0x0a, 0x3d, 0x90, 0x80, 0x6a, 0xc9,
+         0x37, 0x2d, 0x33, 0xd5, 0x84, 0x0f, 0x6c, 0x97, 0x7a, 0xa7, 0xbf, 0x90, 0x08, 0xd6, 0x36, 0x61},
+        {0x67, 0xdb, 0xc3, 0x34, 0x18, 0xbb, 0xcd, 0x38, 0x78, 0x48, 0x93, 0x98, 0x63, 0x94, 0x84, 0xb6,
+         0xd6, 0xfa, 0x42, 0xf8, 0x75, 0xb8, 0xc5, 0xaf, 0x23, 0xbc, 0x92, 0xc6, 0x9c, 0x5b, 0xdb, 0x6b,
+         0x38, 0x43, 0x6f, 0xdf, 0x85, 0x89, 0xa3, 0x30, 0x59, 0xfc, 0x92, 0xe7, 0xca, 0x7a, 0xa2, 0x25,
+         0x0c, 0xc9, 0xea, 0x48, 0x39, 0x1b, 0x1e, 0x51, 0x7c, 0x6f, 0xb0, 0x56, 0x09, 0x3a, 0xf3, 0x96},
+        {0x69, 0xf0, 0xb6, 0x81, 0x25, 0xb9, 0xab, 0x0c, 0x6e, 0xbc, 0xf6, 0x33, 0x89, 0xc5, 0xcf, 0xd7,
+         0x62, 0x13, 0x79, 0x49, 0x7a, 0x1b, 0xd8, 0xbd, 0xa3, 0xaa, 0x49, 0xb3, 0xeb, 0xdd, 0x10, 0x11,
+         0x0d, 0x2a, 0x89, 0xa1, 0x9c, 0x28, 0x17, 0x46, 0x90, 0xec, 0xca, 0xc4, 0xfb, 0xe3, 0x2d, 0xfe,
+         0x44, 0x4e, 0x1a, 0xd7, 0x63, 0xc5, 0x52, 0x33, 0xd4, 0x6b, 0x7a, 0x47, 0xdc, 0x36, 0x69, 0xd6},
+        {0x34, 0xd9, 0x72, 0x9a, 0x39, 0x45, 0xd4, 0x2c, 0xd0, 0x8c, 0x6c, 0xd2, 0xc0, 0x9f, 0x8f, 0x53,
+         0xdf, 0xca, 0x8d, 0x55, 0x03, 0x1f, 0xea, 0x67, 0x18, 0x9d, 0x5f, 0xfa, 0x51, 0x12, 0xf8, 0xeb,
+         0x65, 0xef, 0xef, 0x05, 0xbd, 0x03, 0xd2, 0x4e, 0xb4, 0x61, 0x54, 0xee, 0x50, 0xe1, 0x68, 0x70,
+         0x7c, 0x01, 0x55, 0x33, 0x64, 0xe7, 0x60, 0x37, 0x0d, 0xb3, 0xcf, 0x40, 0x4c, 0x62, 0x79, 0xb1},
+        {0x27, 0x1b, 0x64, 0x00, 0x6d, 0x3d, 0x02, 0x82, 0x83, 0x27, 0x62, 0xa8, 0x69, 0xc8, 0x67, 0xf4,
+         0x49, 0xf0, 0x88, 0x87, 0x97, 0xe6, 0x10, 0x8a, 0x58, 0xe3, 0x04, 0x03, 0xc9, 0x6f, 0x4e, 0x4c,
+         0x6e, 0x07, 0x46, 0x31, 0x0b, 0x9c, 0x01, 0xc2, 0xfc, 0x64, 0x8f, 0x10, 0x39, 0xd8, 0x03, 0xb0,
+         0x53, 0xef, 0x2e, 0x79, 0x03, 0xed, 0xec, 0xab, 0x32, 0x80, 0x45, 0xdf, 0x50, 0xbd, 0xd7, 0xd9},
+        {0x29, 0xea, 0x44, 0xa5, 0x0a, 0x4b, 0x47, 0xb8, 0xb3, 0xdf, 0xfa, 0x01, 0xdc, 0x5f, 0x22, 0x71,
+         0xd5, 0x43, 0x9b, 0xa8, 0xa8, 0x2a, 0x6e, 0xc0, 0xc4, 0x54, 0xe9, 0xbd, 0x19, 0x44, 0x84, 0x79,
+         0x6c, 0x77, 0x5a, 0xc8, 0xab, 0x2e, 0xda, 0x8c, 0xbb, 0xdb, 0x4b, 0xd1, 0x19, 0x6a, 0xb2, 0x46,
+         0x30, 0xac, 0x6c, 0x1f, 0x97, 0x38, 0x9d, 0xe1, 0x9e, 0x9d, 0x5f, 0x63, 0xaf, 0x50, 0x90, 0x05}
+    },
+    {
+        {0x1e, 0x45, 0xa6, 0x01, 0x40, 0xa3, 0xb2, 0xde, 0xe9, 0xb8, 0xdc, 0x6f, 0xf3, 0x07, 0x15, 0x4a,
+         0x1b, 0x41, 0x0b, 0xcd, 0x38, 0xe0, 0xe3, 0x8f, 0xb1, 0x0b, 0x2f, 0x6d, 0xa1, 0xaf, 0xbe, 0x2b,
+         0x0e, 0x73, 0x0d, 0xa4, 0x73, 0xdf, 0xfd, 0x60, 0xd2, 0xf3, 0x24, 0x1a, 0x85, 0xe6, 0x8a, 0xcb,
+         0x47, 0xd2, 0x6e, 0x50, 0x43, 0xad, 0x04, 0x7d, 0x89, 0x3f, 0x07, 0x2c, 0x8d, 0xda, 0x0a, 0x76},
+        {0x61, 0x70, 0x81, 0x61, 0xcb, 0x46, 0x60, 0xff, 0x22, 0xc3, 0xc1, 0xea, 0xaf, 0xb1, 0x41, 0x42,
+         0x44, 0x57, 0x98, 0x64, 0xb0, 0x7e, 0x73, 0xfb, 0x9b, 0xcd, 0x90, 0xaa, 0xbe, 0xc9, 0x93, 0x5d,
+         0x38, 0xd6, 0x93, 0x6d, 0x12, 0xe8, 0x15, 0x7c, 0x06, 0x21, 0xbd, 0x2d, 0x8f, 0xdf, 0x95, 0xa1,
+         0xf8, 0x49, 0x87, 0xee, 0x72, 0x4e, 0x0c, 0x98, 0xf5, 0xc4, 0xcd, 0x21, 0xfe, 0xb9, 0x82, 0x0d},
+        {0x1d, 0xd4, 0xf6, 0x7c, 0xa8, 0x33, 0x2c, 0xba, 0x42, 0x8e, 0xe9, 0x8c, 0x75, 0xad, 0x78, 0x12,
+         0x15, 0x82, 0xb2, 0x3b, 0x1c, 0xe2, 0x67, 0xca, 0xd8, 0xf8, 0x4e, 0xe3, 0xd2, 0xa0, 0xa1, 0xcf,
+         0x54, 0x55, 0x1d, 0xca, 0x55, 0x3d, 0x2d, 0x3b, 0xa1, 0xfa, 0x3f, 0x37, 0x10, 0x56, 0x0d, 0xfa,
+         0x90, 0x43, 0xa0, 0x32, 0x4c, 0x2e, 0xa3, 0xe6, 0xa0, 0xf4, 0xc5, 0x13, 0x1b, 0xd3, 0x4c, 0xf1},
+        {0x48, 0xf4, 0x51, 0x39, 0x77, 0x92, 0x91, 0x59, 0x09, 0x60, 0x4c, 0x63, 0x2c, 0x83, 0x80, 0x21,
+         0x64, 0x17, 0x49, 0xa6, 0x7f, 0xb8, 0xe9, 0x13, 0x01, 0x42, 0x7d, 0xef, 0xd9, 0x51, 0xf7, 0x91,
+         0x31, 0x53, 0x85, 0xd3, 0xbd, 0x5a, 0x22, 0xb6, 0x90, 0x68, 0xde, 0x89, 0xe5, 0x2a, 0x31, 0x26,
+         0x52, 0x5b, 0xe7, 0xda, 0x88, 0x6d, 0x69, 0x3e, 0x99, 0xff, 0x2f, 0x08, 0x83, 0x22, 0xd5, 0x60},
+        {0x70, 0xe7, 0xd5, 0xa6, 0x2d, 0x4e, 0x84, 0x66, 0xb8, 0x9b, 0x4f, 0x1f, 0xa7, 0x67, 0xc6, 0xd8,
+         0xbf, 0x15, 0x57, 0x33, 0x28, 0x02, 0x8f, 0xb3, 0x5f, 0x08, 0x8e, 0xd3, 0x38, 0x7d, 0x56, 0x50,
+         0x0a, 0x2a, 0x39, 0x77, 0x84, 0xbf, 0xd7, 0x86, 0x04, 0xf8, 0x21, 0xc3, 0x3a, 0x16, 0x78, 0xa2,
+         0x46, 0x3d, 0x80, 0xa1, 0x0b, 0x11, 0x1c, 0x1f, 0xe8, 0x17, 0x06, 0xdd, 0x03, 0x6d, 0x3d, 0x67},
+        {0x04, 0x80, 0x40, 0xd8, 0xdc, 0x65, 0xae, 0xcc, 0xf8, 0x52, 0x3e, 0xac, 0x0e, 0xe6, 0x14, 0xa4,
+         0xba, 0xdf, 0x28, 0x30, 0x1f, 0x56, 0xd8, 0xc9, 0x87, 0x75, 0x13, 0xf8, 0x42, 0xfc, 0xce, 0x62,
+         0x33, 0xfb, 0x86, 0x6f, 0x75, 0x43, 0x19, 0x00, 0x9e, 0xcd, 0x13, 0xc7, 0xf6, 0xcc, 0x27, 0x6c,
+         0xae, 0xe1, 0x8c, 0x77, 0x24, 0xff, 0x99, 0x2c, 0x1f, 0x00, 0x28, 0x26, 0xba, 0x79, 0x53, 0x5f},
+        {0x6e, 0x9b, 0xb2, 0xb9, 0x0b, 0xc9, 0x8c, 0x48, 0x67, 0x43, 0xba, 0xf9, 0x14, 0xde, 0x6c, 0xfb,
+         0x30, 0x23, 0x83, 0x80, 0x6a, 0x7c, 0x5c, 0xa3, 0x08, 0x8f, 0x0f, 0x9f, 0xc1, 0x7f, 0x2e, 0x7c,
+         0x51, 0xd3, 0xda, 0xf8, 0xb8, 0xb9, 0x55, 0x42, 0xc8, 0x0a, 0x11, 0x04, 0x03, 0x70, 0xe1, 0x33,
+         0xd5, 0x02, 0xd3, 0x61, 0x2a, 0x6f, 0x3d, 0xcf, 0x37, 0x1e, 0x2e, 0xa0, 0x53, 0x10, 0x3a, 0xae},
+        {0x79, 0x56, 0xa0, 0x4d, 0xf8, 0x62, 0x17, 0x8e, 0xe4, 0xc7, 0x05, 0xff, 0xbd, 0x30, 0xf9, 0xdc,
+         0xbc, 0xcd, 0xfc, 0x7a, 0xbe, 0x36, 0x2f, 0x2c, 0x1d, 0xa2, 0x4b, 0x3c, 0xf9, 0xdc, 0xce, 0xd8,
+         0x5e, 0xea, 0xc1, 0x7f, 0x2e, 0x77, 0x2f, 0x55, 0x1e, 0x76, 0x19, 0x78, 0xb3, 0x95, 0xb6, 0xdd,
+         0xea, 0x37, 0xa1, 0x6a, 0xa3, 0x3c, 0xff, 0x34, 0xa3, 0x0a, 0x84, 0x53, 0xba, 0xf6, 0xe7, 0x82}
+    },
+    {
+        {0x4d, 0x1e, 0x11, 0x6d, 0x13, 0x61, 0x58, 0xc5, 0xdd, 0xab, 0xd4, 0x27, 0x68, 0x32, 0x80, 0x0f,
+         0x2c, 0x08, 0x1c, 0x10, 0x72, 0xde, 0x6f, 0x2d, 0x93, 0x17, 0x97, 0xa4, 0x6a, 0xbc, 0x0c, 0xbb,
+         0x6d, 0x41, 0x5b, 0xe4, 0x9d, 0x4e, 0x35, 0xb6, 0x5c, 0xc5, 0x13, 0x54, 0xb5, 0x00, 0x8f, 0x8c,
+         0x43, 0xe8, 0x4b, 0x7b, 0x5e, 0x8a, 0x4b, 0x84, 0xf4, 0x4e, 0x1e, 0xfb, 0x10, 0xc9, 0xb9, 0x1a},
+        {0x4b, 0x5b, 0xae, 0x5a, 0x77, 0xa8, 0x67, 0xdd, 0xbe, 0xe3, 0x94, 0x45, 0x24, 0xf8, 0xe2, 0xec,
+         0x8c, 0x2a, 0x61, 0x72, 0xc1, 0x4b, 0xd4, 0x32, 0xcd, 0x42, 0x14, 0x82, 0x48, 0x12, 0x7d, 0x15,
+         0x73, 0x94, 0x76, 0xe0, 0xb3, 0x84, 0x71, 0x21, 0x98, 0x75, 0xa4, 0x58, 0x0e, 0x67, 0x42, 0xec,
+         0xb6, 0xae, 0xcb, 0xa5, 0x7b, 0x8c, 0x0f, 0xa0, 0xd9, 0x23, 0xb8, 0xde, 0x20, 0x9a, 0x77, 0xcb},
+        {0x28, 0xe0, 0x1e, 0x9e, 0xeb, 0xe6, 0x24, 0xf0, 0x50, 0x38, 0x5a, 0x75, 0x98, 0x82, 0xd4, 0xf1,
+         0xae, 0x61, 0xab, 0x87, 0xc7, 0x39, 0xba, 0x5f, 0x1f, 0x16, 0x7e, 0x5a, 0x18, 0xec, 0xc8, 0xf9,
+         0x34, 0xa3, 0xef, 0x20, 0x80, 0x89, 0x42, 0x9b, 0x62, 0x93, 0xa7, 0xc1, 0xab, 0x71, 0x04, 0x8d,
+         0xd3, 0xa1, 0xb4, 0xf6, 0x9b, 0x64, 0x5e, 0x2a, 0x7b, 0x76, 0x82, 0xa0, 0xa5, 0x8a, 0x68, 0xc1},
+        {0x33, 0xbf, 0xa9, 0x0c, 0xc1, 0xb9, 0xdf, 0x13, 0xe1, 0x06, 0xff, 0xcf, 0x6c, 0xa8, 0x98, 0xd0,
+         0x6b, 0x22, 0xd5, 0x1d, 0xf3, 0x37, 0x24, 0x3b, 0xf8, 0x5b, 0x3f, 0x23, 0x28, 0x69, 0xfc, 0xdf,
+         0x53, 0xb1, 0x20, 0xdb, 0x63, 0x27, 0xca, 0xe5, 0x9f, 0xa5, 0xff, 0xf1, 0x09, 0x01, 0x7d, 0x2d,
+         0xf4, 0xac, 0xef, 0x01, 0xd2, 0xf1, 0x09, 0x81, 0x43, 0x9d, 0x82, 0x4f, 0xb2, 0xda, 0x81, 0xd9},
+        {0x67, 0x59, 0xa4, 0xf9, 0x61, 0xd6, 0xac, 0x87, 0x11, 0x6f, 0xf6, 0x82, 0xcc, 0xa6, 0xbb, 0x2a,
+         0xf3, 0x6c, 0xe2, 0xbb, 0xda, 0x22, 0x02, 0xc6, 0x94, 0xf7, 0x0b, 0x4a, 0x11, 0x10, 0xcc, 0x99,
+         0x7e, 0x6c, 0x7c, 0x2d, 0xca, 0x5f, 0x44, 0xc7, 0xb2, 0x59, 0x12, 0x11, 0x60, 0x00, 0x36, 0xd4,
+         0xb1, 0x01, 0x1a, 0x26, 0x05, 0xbe, 0x16, 0x63, 0x3c, 0xa4, 0x3f, 0x61, 0xec, 0xf8, 0xaf, 0x35},
+        {0x56, 0xbe, 0xc7, 0x03, 0x10, 0x91, 0x51, 0xe7, 0x87, 0x69, 0x0e, 0x04, 0x94, 0x4c, 0xe7, 0x75,
+         0xea, 0x94, 0x87, 0x4d, 0xc7, 0xaa, 0x81, 0x15, 0xf0, 0xd4, 0x34, 0xa9, 0xad, 0xe8, 0x02, 0x67,
+         0x6a, 0xb2, 0xdd, 0xd0, 0x75, 0x07, 0x78, 0xcc, 0xdc, 0xa6, 0x56, 0xb4, 0xf3, 0x71, 0x0c, 0x05,
+         0xce, 0x7e, 0x47, 0x70, 0x6c, 0xfa, 0xc8, 0x2b, 0x51, 0x2e, 0x6b, 0x33, 0xec, 0x86, 0xfb, 0x32},
+        {0x4b, 0xbe, 0xfb, 0xdc, 0x2c, 0x60, 0x86, 0x7d, 0xad, 0xf3, 0xa8, 0x17, 0xa0, 0x29, 0xc5, 0x63,
+         0x05, 0xda, 0xe0, 0xa7, 0xb5, 0xeb, 0x28, 0xd0, 0x42, 0x0b, 0xd6, 0x53, 0x0a, 0x7c, 0x82, 0xbc,
+         0x6e, 0xb8, 0x5c, 0xc8, 0x9c, 0x0c, 0x2d, 0xc9, 0x79, 0xd1, 0xce, 0x5d, 0xcc, 0x3e, 0x74, 0xf7,
+         0xac, 0x35, 0x47, 0xe1, 0x07, 0x08, 0xa0, 0x95, 0x04, 0x0e, 0x3f, 0x68, 0x49, 0x53, 0x81, 0x07},
+        {0x44, 0x49, 0x29, 0x34, 0x7c, 0x2d, 0xed, 0x02, 0x9b, 0xc1, 0x95, 0x58, 0xb0, 0xf6, 0x9a, 0x44,
+         0x92, 0x01, 0x7a, 0x9c, 0x35, 0xb3, 0x70, 0x71, 0x1e, 0x08, 0x22, 0x2b, 0xc0, 0xb9, 0xef, 0xc6,
+         0x77, 0x78, 0x5e, 0xc5, 0xcb, 0xbd, 0xab, 0xd6, 0x45, 0xa3, 0x25, 0x1e, 0x7d, 0xa5, 0x7c, 0x8f,
+         0xfc, 0x39, 0x15, 0x8c, 0x0d, 0x7b, 0x25, 0xa4, 0x21, 0x1c, 0x2a, 0xff, 0x2e, 0x1d, 0x62, 0x45}
+    },
+    {
+        {0x2b, 0x6b, 0x89, 0x2a, 0xe9, 0x4b, 0x45, 0x4b, 0x2c, 0x2d, 0x92, 0xbb, 0x94, 0x7f, 0xc4, 0xd5,
+         0x06, 0xd1, 0x73, 0xd2, 0x81, 0x77, 0x9c, 0x2c, 0x15, 0x3c, 0x00, 0x1d, 0xed, 0x42, 0xd3, 0xd0,
+         0x7f, 0x1c, 0xf6, 0x4e, 0x0e, 0x18, 0x0f, 0xc4, 0xd6, 0xe1, 0x2c, 0x1b, 0x5c, 0x52, 0x85, 0xf3,
+         0x76, 0xe9, 0x79, 0x61, 0x6a, 0x52, 0xc9, 0x4a, 0x0d, 0xea, 0x4d, 0x48, 0xc5, 0x88, 0x0c, 0xd2},
+        {0x1b, 0x91, 0x75, 0xb7, 0xfc, 0x19, 0xa6, 0x18, 0xd5, 0x84, 0x8c, 0x57, 0x61, 0xc2, 0xb7, 0x60,
+         0x52, 0x9e, 0x3e, 0xaa, 0xac, 0x08, 0x7b, 0x51, 0x11, 0x2b, 0x1f, 0xcb, 0x42, 0x2e, 0x04, 0xb4,
+         0x17, 0x30, 0xa5, 0x9f, 0xff, 0x47, 0x17, 0xe2, 0x58, 0xcc, 0x85, 0x3d, 0xec, 0xe7, 0xc5, 0xf7,
+         0x0e, 0xcb, 0x52, 0xcc, 0x35, 0x32, 0x0a, 0x53, 0xcc, 0x38, 0x38, 0xc8, 0x44, 0xca, 0x68, 0xe8},
+        {0x37, 0x8c, 0x49, 0x1d, 0x1e, 0x89, 0x3d, 0x0a, 0x64, 0xee, 0xf2, 0x5b, 0x6c, 0x36, 0x97, 0xc7,
+         0xa0, 0x73, 0xda, 0x39, 0x0e, 0x5c, 0x41, 0x37, 0x00, 0x31, 0x75, 0x71, 0xc1, 0xc8, 0xae, 0xe3,
+         0x5c, 0x95, 0x69, 0x29, 0x82, 0x1b, 0x07, 0xbf, 0x55, 0x11, 0xca, 0x93, 0x7f, 0x39, 0x7c, 0xd7,
+         0xc1, 0xf9, 0xf6, 0x56, 0x9c, 0x79, 0xad, 0x08, 0x09, 0x82, 0x2a, 0xa5, 0xc1, 0xb0, 0xe6, 0x4c},
+        {0x01, 0x37, 0x1c, 0xf6, 0x7f, 0xe4, 0x7f, 0x8e, 0xf9, 0x12, 0x46, 0xae, 0x04, 0x85, 0x87, 0x4d,
+         0x60, 0x1e, 0x31, 0x98, 0x4d, 0x85, 0x42, 0x24, 0x56, 0x9a, 0xc2, 0x9e, 0x56, 0xa6, 0xee, 0x87,
+         0x71, 0xca, 0xd7, 0xd8, 0x35, 0x06, 0x61, 0xce, 0x79, 0x8e, 0x33, 0x2a, 0x98, 0xee, 0x5b, 0x62,
+         0xf8, 0x43, 0x1f, 0xd9, 0xac, 0x5a, 0x4a, 0x48, 0x85, 0x6c, 0xe9, 0xc4, 0xc5, 0xb6, 0x4c, 0x73},
+        {0x62, 0x71, 0x08, 0xc7, 0xe3, 0x18, 0x93, 0x85, 0xc8, 0x16, 0x7a, 0xf1, 0xc2, 0xb5, 0x63, 0xb7,
+         0x4b, 0x39, 0x2c, 0x30, 0x78, 0xcd, 0xa3, 0x2b, 0x57, 0xe2, 0xbb, 0x87, 0xf4, 0x5e, 0x69, 0x6e,
+         0x6a, 0x4c, 0x37, 0xae, 0x8d, 0xfa, 0x37, 0xe3, 0x77, 0xd2, 0x3f, 0xd7, 0x31, 0x0b, 0x8a, 0x07,
+         0x97, 0x80, 0xa2, 0x7e, 0x38, 0x37, 0xe6, 0x8c, 0x7f, 0xd8, 0x49, 0xc3, 0xae, 0x93, 0xa8, 0x8a},
+        {0x3e, 0x33, 0x82, 0x85, 0x27, 0x61, 0xe5, 0x03, 0xf2, 0x62, 0x14, 0xe0, 0x1e, 0xe1, 0x32, 0x5d,
+         0x7f, 0xc8, 0x9f, 0x0e, 0xef, 0x28, 0x92, 0x84, 0xa7, 0x1a, 0x52, 0x7c, 0x67, 0xb2, 0xf7, 0x58,
+         0x30, 0xb4, 0x87, 0x1c, 0x89, 0xd0, 0xc3, 0x51, 0xa4, 0xfd, 0xe8, 0x2a, 0xa9, 0xb5, 0x50, 0xfc,
+         0x5a, 0xc2, 0x62, 0x32, 0xeb, 0x11, 0xfa, 0x42, 0x8b, 0xe4, 0x92, 0xf4, 0x94, 0x85, 0x74, 0x1b},
+        {0x6e, 0x73, 0xd4, 0x73, 0x4f, 0x24, 0x05, 0x86, 0x7b, 0xa0, 0x3b, 0xd7, 0xdb, 0xbf, 0xa6, 0x0b,
+         0xa6, 0x81, 0x76, 0xac, 0xf6, 0xbe, 0x4c, 0xcc, 0x27, 0x8a, 0x34, 0x7b, 0x5a, 0x4c, 0xbd, 0xa3,
+         0x30, 0x5c, 0x44, 0x43, 0x00, 0x64, 0x9f, 0x36, 0x87, 0x6b, 0x5c, 0xff, 0x89, 0xd1, 0xd1, 0xa0,
+         0x8b, 0xda, 0xae, 0x84, 0x78, 0x96, 0xf7, 0x83, 0xfa, 0xb5, 0x81, 0x53, 0xc3, 0xae, 0x07, 0x6b},
+        {0x63, 0xbd, 0x67, 0x1e, 0xca, 0x1e, 0x6a, 0xcc, 0xd0, 0xf9, 0x80, 0x84, 0x5b, 0x16, 0x3c, 0xa4,
+         0xe9, 0x27, 0xd2, 0xa7, 0x4d, 0x19, 0x8e, 0x78, 0xcc, 0xcd, 0x8f, 0xca, 0xa6, 0xae, 0xd3, 0x72,
+         0x04, 0x60, 0xcc, 0x32, 0xf5, 0xd2, 0x7a, 0x15, 0xf4, 0x29, 0x4f, 0xaa, 0x20, 0xa9, 0x91, 0x12,
+         0x39, 0x2c, 0xdb, 0xdc, 0x85, 0x15, 0xe9, 0xca, 0xa1, 0xff, 0x48, 0x87, 0xd2, 0x2a, 0x6e, 0x7b}
+    },
+    {
+        {0x0f, 0x6c, 0x3a, 0x96, 0xe0, 0x03, 0x2a, 0x93, 0x94, 0x33, 0x7a, 0x02, 0xff, 0xb2, 0xc8, 0x3b,
+         0xa7, 0x0e, 0xfb, 0x8f, 0x56, 0x6f, 0xea, 0xb5, 0x30, 0xfc, 0x90, 0xfa, 0x3b, 0x47, 0x10, 0xe5,
+         0x3d, 0x4e, 0x97, 0xe2, 0x86, 0x37, 0x86, 0x75, 0x03, 0x8a, 0x4b, 0x58, 0xe8, 0x42, 0x24, 0xee,
+         0x51, 0x5e, 0x1d, 0x66, 0x97, 0xac, 0x79, 0x38, 0x9f, 0x78, 0x47, 0x9b, 0xe1, 0x67, 0x63, 0x5a},
+        {0x3b, 0x13, 0xc7, 0x1c, 0x2a, 0x90, 0xbd, 0x24, 0xc5, 0x1d, 0xf6, 0xbd, 0x13, 0x8c, 0x5d, 0x16,
+         0x20, 0x8a, 0x9c, 0xea, 0xaa, 0x8e, 0xb3, 0x4a, 0x69, 0x46, 0x9f, 0xad, 0xe6, 0xab, 0xb4, 0x40,
+         0x14, 0x89, 0x0a, 0x7a, 0xb2, 0x48, 0x17, 0xb2, 0xbb, 0xa8, 0x26, 0x79, 0x2e, 0x8f, 0xd3, 0x42,
+         0xa6, 0xf7, 0x05, 0xaf, 0x80, 0x02, 0x52, 0x61, 0x64, 0x35, 0xbe, 0x18, 0x0d, 0x16, 0xdc, 0x54},
+        {0x79, 0x83, 0xfc, 0xcb, 0x8f, 0xdf, 0xfd, 0x78, 0x7f, 0x66, 0x95, 0x68, 0xb3, 0x51, 0x89, 0xd0,
+         0x8f, 0xcc, 0x61, 0x94, 0xc3, 0x18, 0x74, 0xed, 0xdf, 0x33, 0x20, 0xf5, 0xfd, 0x1d, 0x64, 0x2b,
+         0x3c, 0x0f, 0xcd, 0xb8, 0xf1, 0xb0, 0xcc, 0xcc, 0x29, 0x27, 0x57, 0x1d, 0xae, 0xba, 0x50, 0x48,
+         0x3d, 0xe1, 0x9e, 0xe5, 0x57, 0x9a, 0xb5, 0xab, 0xbb, 0xd9, 0x63, 0x22, 0x6a, 0x43, 0x68, 0x55},
+        {0x18, 0x4b, 0x48, 0xcb, 0x45, 0x50, 0x00, 0x54, 0x22, 0x59, 0x17, 0x4d, 0xa9, 0xa6, 0xeb, 0x83,
+         0xa9, 0x28, 0xb2, 0x83, 0x51, 0x82, 0x27, 0x8a, 0xbb, 0x6e, 0xc0, 0x91, 0xe3, 0x88, 0xa8, 0x20,
+         0x3e, 0xe0, 0xe0, 0x7a, 0x03, 0xdc, 0x33, 0xa9, 0xdd, 0x60, 0xc2, 0x68, 0x23, 0x80, 0xef, 0x73,
+         0x66, 0x79, 0xa5, 0xe3, 0x83, 0xfa, 0xf4, 0x53, 0xfe, 0x32, 0x4d, 0xba, 0x26, 0xe7, 0x7c, 0x33},
+        {0x5d, 0x17, 0xbc, 0x7a, 0xe6, 0x34, 0x8f, 0xf1, 0xd8, 0x8f, 0x46, 0x0e, 0xb1, 0xa1, 0x87, 0x52,
+         0xc3, 0xff, 0x56, 0x95, 0x29, 0xfc, 0xac, 0x8f, 0x4d, 0x86, 0x23, 0x64, 0xb8, 0x59, 0xc1, 0x13,
+         0x53, 0xda, 0xa8, 0xc1, 0xf0, 0x66, 0x82, 0xf6, 0x16, 0x33, 0x09, 0xad, 0xd5, 0x9e, 0x19, 0x6f,
+         0x44, 0x05, 0x03, 0xb0, 0xa5, 0x51, 0x4f, 0x17, 0x85, 0xcf, 0xf1, 0xed, 0x57, 0x65, 0xa2, 0x3d},
+        {0x2d, 0x86, 0xe1, 0x36, 0x8a, 0xb5, 0x46, 0xc9, 0x54, 0x7c, 0x0e, 0x0e, 0x1a, 0x73, 0x69, 0x19,
+         0x84, 0xc2, 0x20, 0x8a, 0x53, 0xb4, 0xcb, 0xa3, 0xf4, 0x87, 0x47, 0xad, 0x65, 0x63, 0x76, 0xce,
+         0x0b, 0x25, 0x38, 0x61, 0x63, 0x10, 0xb0, 0xbb, 0x96, 0x55, 0x98, 0x90, 0xa1, 0xe5, 0xf8, 0x48,
+         0x82, 0x14, 0x95, 0x1a, 0x9e, 0x1f, 0x77, 0x43, 0x3b, 0xc1, 0x44, 0x29, 0xf0, 0x43, 0x94, 0xf2},
+        {0x52, 0x60, 0x38, 0x5b, 0xe8, 0x42, 0x91, 0x55, 0x75, 0x08, 0xc6, 0x83, 0xf0, 0xe5, 0x9b, 0x89,
+         0x40, 0xaa, 0xaa, 0x46, 0x92, 0xcf, 0x5b, 0x1a, 0xe4, 0x88, 0x43, 0x69, 0xa6, 0x97, 0x69, 0xd1,
+         0x3d, 0x89, 0x4f, 0x1c, 0x3c, 0x8b, 0x53, 0x1d, 0x04, 0x73, 0xec, 0x10, 0x23, 0x10, 0x31, 0xa8,
+         0xee, 0x39, 0x10, 0xa6, 0x3f, 0x8a, 0x9e, 0x4e, 0x72, 0x64, 0x16, 0x4a, 0x69, 0xa4, 0x76, 0xbd},
+        {0x5a, 0x04, 0xae, 0x11, 0x95, 0xed, 0xf5, 0x08, 0x26, 0x21, 0x96, 0xe9, 0xd2, 0x3c, 0x25, 0x9c,
+         0x93, 0x7f, 0x81, 0x76, 0x9b, 0x22, 0x58, 0x54, 0x2b, 0x78, 0xe3, 0xc0, 0xfb, 0x13, 0x5c, 0x34,
+         0x67, 0x66, 0x67, 0x09, 0x21, 0x18, 0xac, 0xcc, 0xec, 0xe8, 0x7e, 0x75, 0xf0, 0xa6, 0x82, 0x5c,
+         0x59, 0x52, 0xf9, 0x2d, 0xd4, 0x99, 0x94, 0x3e, 0xfe, 0x83, 0x1f, 0x97, 0x12, 0xc5, 0xe8, 0xb9}
+    },
+    {
+        {0x52, 0xee, 0x53, 0xb9, 0x81, 0xdf, 0xbc, 0x41, 0xdd, 0xaa, 0x5d, 0xdc, 0x27, 0x54, 0xc4, 0x17,
+         0x5f, 0x48, 0x11, 0xaa, 0x45, 0xf8, 0xe2, 0xb1, 0x9a, 0x42, 0x56, 0x57, 0xc2, 0x38, 0xa8, 0x3e,
+         0x7e, 0xb0, 0xa1, 0xbe, 0x34, 0x00, 0xde, 0xc8, 0x7b, 0x38, 0x8c, 0xad, 0x51, 0x61, 0x39, 0x57,
+         0x64, 0x3c, 0xdf, 0x05, 0x95, 0xb8, 0x91, 0xcc, 0x6f, 0x92, 0x5f, 0xb3, 0x6d, 0xa7, 0xf1, 0xc3},
+        {0x50, 0x1f, 0xe1, 0x38, 0x92, 0x4e, 0x05, 0xcc, 0x1a, 0x05, 0x12, 0x9d, 0x24, 0x1e, 0x6b, 0x5e,
+         0x9d, 0x46, 0xcd, 0x8b, 0x0b, 0xed, 0x38, 0xeb, 0x42, 0xee, 0x20, 0x67, 0x8a, 0x1d, 0x24, 0x25,
+         0x2f, 0x80, 0x22, 0xec, 0xed, 0xe0, 0x18, 0x9c, 0x21, 0x58, 0x82, 0xca, 0x85, 0x6d, 0xae, 0x0f,
+         0x7b, 0x4d, 0xaf, 0x66, 0x75, 0x18, 0x1a, 0x55, 0x8e, 0xbd, 0x11, 0xe6, 0x91, 0x1c, 0xee, 0x4e},
+        {0x05, 0x50, 0x04, 0xf7, 0xd6, 0xa7, 0x6c, 0xfa, 0xb8, 0x8a, 0xa5, 0x22, 0xf9, 0xf8, 0x4a, 0x43,
+         0x91, 0x1e, 0x5e, 0x58, 0x35, 0xb4, 0xa4, 0x46, 0xed, 0x56, 0x13, 0xf3, 0x81, 0xf3, 0xdd, 0x9d,
+         0x47, 0x68, 0x24, 0xe0, 0xcb, 0x7a, 0xf9, 0xf4, 0xc9, 0x39, 0xb9, 0xbe, 0x68, 0xab, 0xf7, 0xf1,
+         0x28, 0xe7, 0xfb, 0x38, 0xce, 0x9e, 0x2f, 0xd9, 0x02, 0xae, 0xaa, 0x6f, 0x20, 0x59, 0x63, 0x40},
+        {0x2d, 0x82, 0x94, 0xfd, 0x94, 0x99, 0x60, 0x32, 0xb7, 0x3b, 0x4f, 0x09, 0xa0, 0xff, 0x64, 0x5c,
+         0xe8, 0xdb, 0x39, 0xdb, 0x54, 0x63, 0xf0, 0xfc, 0x57, 0x15, 0x6a, 0x1d, 0x39, 0x0a, 0x3b, 0x68,
+         0x3a, 0x8a, 0x6f, 0xaa, 0x67, 0xc6, 0xdd, 0x90, 0x5a, 0x4f, 0xde, 0xb9, 0x5a, 0xc1, 0x27, 0xc9,
+         0xfd, 0xe3, 0xac, 0x01, 0x7c, 0x84, 0x7c, 0xea, 0xdb, 0x2c, 0x55, 0xf1, 0x44, 0x5a, 0xf6, 0x24},
+        {0x7d, 0x63, 0x77, 0x0b, 0xa4, 0xe4, 0xf2, 0xa7, 0x2b, 0x37, 0x16, 0xf2, 0x89, 0x8f, 0xf6, 0x3a,
+         0x3b, 0x4e, 0x6e, 0x14, 0xb1, 0x92, 0x2a, 0x5b, 0x3f, 0x87, 0x77, 0xb7, 0x93, 0xab, 0xa7, 0xfd,
+         0x54, 0x4e, 0x04, 0xbd, 0x2b, 0x43, 0xf9, 0xe9, 0xe7, 0x79, 0xda, 0x4e, 0xc2, 0xc6, 0x29, 0x31,
+         0xa5, 0xb4, 0x4e, 0xc3, 0xa5, 0x51, 0xda, 0x7c, 0xeb, 0xc9, 0x79, 0xa9, 0xa4, 0x52, 0xc4, 0x16},
+        {0x2a, 0x37, 0x4c, 0x17, 0x08, 0x87, 0x11, 0xd1, 0xdd, 0x19, 0xa6, 0xcb, 0xd4, 0x82, 0x88, 0xa3,
+         0xa8, 0xa6, 0x06, 0xf1, 0xf8, 0xc1, 0x5f, 0x54, 0xdd, 0xb1, 0x63, 0x97, 0xc9, 0x87, 0x52, 0x78,
+         0x5a, 0xb3, 0x5f, 0xce, 0x03, 0x93, 0x1c, 0xb3, 0x76, 0xe1, 0xb5, 0x4e, 0xb9, 0xe2, 0x1b, 0x8d,
+         0x47, 0x69, 0xbd, 0xca, 0x91, 0xdf, 0xa7, 0x83, 0x1e, 0x24, 0xd9, 0x43, 0x08, 0xf3, 0x0c, 0xa1},
+        {0x3d, 0xea, 0x4b, 0x8a, 0x91, 0xa1, 0xbe, 0xc7, 0x81, 0x99, 0xd6, 0xdf, 0xd4, 0xa4, 0x9f, 0x3d,
+         0x9a, 0xae, 0x58, 0x72, 0x50, 0x8a, 0x3c, 0x27, 0xc7, 0x0d, 0x1c, 0x85, 0xcc, 0x10, 0x5e, 0x02,
+         0x34, 0x79, 0x28, 0x6b, 0xe4, 0xd0, 0x44, 0xe7, 0x3b, 0xda, 0x8c, 0xf9, 0x64, 0xa0, 0x4c, 0x11,
+         0x4c, 0x09, 0x3b, 0xdf, 0x91, 0xa6, 0xea, 0x79, 0xca, 0x49, 0xe1, 0xe5, 0xbd, 0xc8, 0x8c, 0xca},
+        {0x56, 0x85, 0x7d, 0x02, 0x67, 0x42, 0x76, 0xaf, 0x00, 0x99, 0xd6, 0x3b, 0x04, 0xa3, 0x95, 0x44,
+         0xa2, 0x3b, 0x84, 0x1c, 0xb2, 0xef, 0x18, 0x68, 0x8b, 0xa9, 0x50, 0x03, 0x61, 0xe4, 0xda, 0x1d,
+         0x0b, 0x54, 0x3a, 0x67, 0x20, 0xe3, 0x18, 0xd2, 0x64, 0x79, 0x15, 0xbc, 0xd6, 0x19, 0xef, 0xcd,
+         0xed, 0xcf, 0x7f, 0xed, 0x06, 0x57, 0xbe, 0x45, 0xd2, 0x7d, 0xb2, 0x84, 0x29, 0x0e, 0x72, 0xce}
+    },
+    {
+        {0x52, 0xa8, 0x37, 0xbc, 0x7a, 0x7b, 0xc9, 0x45, 0x9b, 0xcc, 0x2e, 0xcf, 0x80, 0xf7, 0x4d, 0x9e,
+         0xd9, 0x9d, 0xef, 0x03, 0x42, 0xe1, 0x8c, 0xfb, 0xe8, 0xe7, 0x99, 0xfb, 0xc5, 0x04, 0xfd, 0x52,
+         0x50, 0xd6, 0x46, 0x01, 0x85, 0xd8, 0x92, 0x4e, 0x54, 0x85, 0xf2, 0x3f, 0x36, 0xa9, 0x8c, 0x86,
+         0x05, 0x35, 0x14, 0xd1, 0x63, 0x54, 0x7a, 0xda, 0xb6, 0xfe, 0x91, 0x47, 0x8a, 0x41, 0x11, 0x96},
+        {0x3f, 0x30, 0xee, 0x69, 0x5b, 0x23, 0x6b, 0xc7, 0x46, 0x20, 0xaf, 0xb1, 0x04, 0x69, 0x32, 0x4b,
+         0x45, 0xc8, 0x20, 0x1a, 0x45, 0xcb, 0xd6, 0x95, 0x42, 0x39, 0xe6, 0x40, 0x86, 0xf3, 0xcd, 0x53,
+         0x41, 0x42, 0x31, 0x53, 0x1d, 0xd5, 0x2e, 0x55, 0x55, 0x64, 0x0f, 0xae, 0xae, 0x60, 0x8c, 0x4a,
+         0x0c, 0x20, 0x5a, 0x04, 0xf5, 0x6d, 0x18, 0x7b, 0xa8, 0x08, 0x55, 0xdb, 0xc0, 0x47, 0x83, 0x70},
+        {0x4f, 0xbf, 0xdb, 0xab, 0x00, 0x55, 0x92, 0xc2, 0xc9, 0x74, 0xa2, 0xcc, 0x3f, 0xd1, 0xb4, 0xef,
+         0x7f, 0x8d, 0xb6, 0x40, 0xaf, 0xbc, 0xdc, 0x83, 0x8b, 0x0a, 0x78, 0x96, 0x6b, 0x88, 0xfc, 0xca,
+         0x68, 0xff, 0xb9, 0x55, 0xa8, 0x3a, 0x0c, 0xe5, 0xa5, 0x53, 0x13, 0xf8, 0x37, 0xbf, 0xc1, 0xce,
+         0xec, 0x03, 0xab, 0xe7, 0x00, 0xfd, 0x18, 0x97, 0xa4, 0x02, 0x65, 0x66, 0x2d, 0x06, 0x1c, 0x93},
+        {0x0e, 0xbc, 0x38, 0xc5, 0x4f, 0xd6, 0xaa, 0x12, 0xdc, 0xc6, 0x0c, 0xa5, 0xc7, 0x2e, 0xd8, 0x65,
+         0xb7, 0xc3, 0x5a, 0x6b, 0xfc, 0xf9, 0x87, 0x78, 0xc2, 0x35, 0x30, 0x7d, 0x30, 0x6d, 0xe6, 0xe4,
+         0x04, 0xb3, 0xa1, 0xd9, 0xf2, 0xef, 0x40, 0xfd, 0xb3, 0xe3, 0x1d, 0xdd, 0x56, 0xa0, 0x85, 0x26,
+         0xdb, 0xda, 0x15, 0xa4, 0xf5, 0x8d, 0x78, 0x16, 0x2c, 0x7b, 0xf2, 0x38, 0x86, 0x76, 0x3c, 0xe2},
+        {0x14, 0xc0, 0x53, 0xb0, 0x40, 0xdf, 0xeb, 0x34, 0x8a, 0xd4, 0x2b, 0xb6, 0x57, 0x38, 0xae, 0x4b,
+         0x07, 0xea, 0x83, 0x0e, 0xfd, 0x00, 0xa6, 0x17, 0xa9, 0x31, 0x85, 0x64, 0x72, 0x41, 0xa6, 0xac,
+         0x7e, 0xc7, 0x70, 0x91, 0xbc, 0x60, 0x57, 0x37, 0x97, 0xe7, 0xd2, 0x9c, 0x67, 0x59, 0xcc, 0x88,
+         0xa8, 0x79, 0x5b, 0x8f, 0xc7, 0x7c, 0xfe, 0x47, 0xf4, 0x28, 0xeb, 0x9c, 0xd0, 0xee, 0xd3, 0xc0},
+        {0x65, 0x18, 0xba, 0xed, 0xfb, 0xa8, 0xe0, 0x47, 0xc2, 0xa5, 0xfd, 0x2d, 0xd7, 0xab, 0x36, 0x03,
+         0xd3, 0xa1, 0xae, 0x44, 0xfa, 0x7d, 0x61, 0xeb, 0xfe, 0x6f, 0x43, 0x24, 0x0d, 0x99, 0xfd, 0x8b,
+         0x07, 0x38, 0x8f, 0x75, 0x38, 0x99, 0x63, 0xa2, 0x11, 0xfb, 0xfb, 0x65, 0x7c, 0x32, 0x87, 0x54,
+         0xd3, 0x1d, 0x66, 0x91, 0x1c, 0xf3, 0x43, 0x05, 0xa7, 0x9e, 0x74, 0xb4, 0xa4, 0xf0, 0x4a, 0x46},
+        {0x78, 0xad, 0x30, 0x7e, 0xa1, 0xd9, 0x17, 0x59, 0x4e, 0x22, 0xf8, 0xc3, 0x31, 0x22, 0x2f, 0xee,
+         0xf8, 0x7d, 0x6a, 0x4c, 0x60, 0x84, 0x6a, 0xb2, 0xd3, 0x15, 0xc7, 0x7b, 0xb5, 0xd3, 0x7d, 0x53,
+         0x60, 0x1b, 0x07, 0x7b, 0x6c, 0xb1, 0x62, 0x50, 0x7f, 0xd2, 0xbf, 0xcc, 0x03, 0x40, 0x47, 0xbd,
+         0xa0, 0xc4, 0x8f, 0x97, 0x8e, 0xbd, 0x17, 0x53, 0x41, 0xe0, 0x55, 0xe2, 0x12, 0x79, 0x1a, 0x2d},
+        {0x3b, 0x75, 0x69, 0x67, 0x30, 0xdc, 0x8d, 0x8c, 0xfb, 0x7d, 0xdb, 0x23, 0x24, 0x1c, 0xc7, 0xce,
+         0x78, 0xa1, 0x3e, 0x6a, 0x37, 0x7d, 0xb5, 0xda, 0x52, 0x7a, 0x10, 0x58, 0xe6, 0x0e, 0x49, 0xdb,
+         0x34, 0xd0, 0x31, 0x74, 0x4c, 0xd2, 0xd9, 0xcf, 0xef, 0x9f, 0x9e, 0xa6, 0x54, 0x00, 0x00, 0x16,
+         0xfb, 0x3e, 0x8b, 0x4a, 0x8c, 0x44, 0x19, 0x87, 0x60, 0xf4, 0x60, 0x16, 0x16, 0x6d, 0xea, 0xa9}
+    },
+    {
+        {0x00, 0x6b, 0x2b, 0xd5, 0xd0, 0x0f, 0xab, 0x38, 0xce, 0xca, 0x21, 0xa2, 0x7d, 0x6a, 0xae, 0xc8,
+         0x26, 0x26, 0xb1, 0x4b, 0x55, 0x5d, 0x85, 0x95, 0x27, 0x71, 0x8f, 0x8c, 0xa4, 0x04, 0xeb, 0xa4,
+         0x72, 0x73, 0x40, 0xc2, 0x7a, 0x15, 0xf6, 0xab, 0x3d, 0x80, 0x54, 0x7f, 0x08, 0x27, 0xc5, 0x6a,
+         0xb1, 0xba, 0x33, 0xbc, 0x30, 0xd1, 0xef, 0x39, 0x09, 0xea, 0x9a, 0x3a, 0xf1, 0x0c, 0x67, 0xe5},
+        {0x1f, 0x4e, 0x89, 0x38, 0xdc, 0xf3, 0xa6, 0xd5, 0x90, 0x7d, 0x88, 0x57, 0x2b, 0xfb, 0x36, 0xa8,
+         0x19, 0x1a, 0xa9, 0xd0, 0x5b, 0xae, 0x8f, 0x68, 0xd3, 0xf1, 0x20, 0xea, 0x16, 0x5b, 0x2b, 0xd8,
+         0x5a, 0x8b, 0x0c, 0x6f, 0x64, 0x9f, 0x8e, 0x19, 0x1a, 0xee, 0xca, 0x65, 0x37, 0x74, 0xa6, 0xdd,
+         0xfc, 0x8c, 0xf8, 0xae, 0x3d, 0x4d, 0x23, 0x2e, 0x21, 0x48, 0x43, 0x3b, 0x9b, 0xda, 0x19, 0xcc},
+        {0x3a, 0x2c, 0xf7, 0x5f, 0xf2, 0xe2, 0xa2, 0x02, 0x22, 0xcb, 0xbb, 0x65, 0x34, 0xda, 0xef, 0x68,
+         0x2f, 0x1c, 0xb4, 0x56, 0x9e, 0x91, 0x39, 0xa0, 0x7f, 0xaf, 0x87, 0x57, 0xd0, 0xde, 0x31, 0x26,
+         0x14, 0x35, 0xac, 0x61, 0x8e, 0x30, 0x48, 0x87, 0xee, 0x63, 0x2d, 0x51, 0x10, 0x82, 0xa5, 0xbb,
+         0x88, 0x8c, 0xb2, 0xfd, 0x76, 0x11, 0xbc, 0x6b, 0xb5, 0x52, 0x4f, 0xa0, 0x44, 0x60, 0x16, 0x92},
+        {0x08, 0xfe, 0x8d, 0xf5, 0x1b, 0x34, 0x59, 0x89, 0x55, 0x34, 0x84, 0xe2, 0x0f, 0x60, 0x0c, 0x2e,
+         0x46, 0xf4, 0xed, 0x25, 0x6f, 0x3c, 0x8d, 0xcc, 0x16, 0x15, 0xb8, 0x72, 0xf0, 0xc2, 0xb9, 0x25,
+         0x27, 0x38, 0xe0, 0x68, 0x10, 0xf4, 0xce, 0xc5, 0xd8, 0x94, 0xc9, 0x14, 0x32, 0xed, 0xea, 0xb5,
+         0xba, 0x63, 0x2e, 0x54, 0xd0, 0x6f, 0x49, 0x4b, 0x75, 0x1b, 0xba, 0x44, 0xbc, 0x93, 0xab, 0xf8},
+        {0x26, 0xcd, 0x26, 0x0b, 0xdd, 0xcd, 0x53, 0xa3, 0x3e, 0x16, 0xf8, 0xcb, 0x2c, 0x32, 0x62, 0x3d,
+         0x6f, 0xbb, 0x5d, 0x83, 0x08, 0xf6, 0xa1, 0xac, 0xa6, 0x6e, 0xf7, 0xf5, 0xf4, 0x32, 0x2a, 0xed,
+         0x28, 0x6e, 0x66, 0x05, 0x9b, 0x8c, 0x5a, 0xf6, 0x32, 0xe2, 0xe9, 0xf4, 0x6f, 0x28, 0x60, 0x3d,
+         0xbd, 0x05, 0xd1, 0x12, 0x50, 0xe0, 0x4b, 0x5e, 0xf3, 0x16, 0x33, 0xcd, 0x90, 0xfa, 0xd2, 0xc3},
+        {0x29, 0x53, 0xa3, 0xc3, 0x0b, 0x74, 0x25, 0x07, 0xd8, 0xb1, 0x3d, 0x52, 0xea, 0x6c, 0xc1, 0x27,
+         0x64, 0xc6, 0xe1, 0x30, 0x0e, 0x85, 0x86, 0x4c, 0x81, 0x0c, 0x8d, 0x54, 0xb7, 0x5b, 0x30, 0x21,
+         0x7d, 0x4c, 0x51, 0x19, 0x6d, 0x28, 0x08, 0x23, 0x57, 0x3e, 0xce, 0xca, 0x7c, 0xc8, 0x09, 0xfe,
+         0x66, 0xc1, 0xa2, 0x67, 0x29, 0x20, 0xba, 0x5c, 0x16, 0x60, 0xaf, 0x77, 0x43, 0x77, 0xcd, 0x9d},
+        {0x3b, 0xdc, 0xef, 0x73, 0x07, 0x88, 0x30, 0x08, 0xa3, 0x8b, 0x4d, 0xf6, 0xa2, 0x8b, 0x8f, 0x7f,
+         0xba, 0xad, 0xf2, 0x43, 0x7f, 0x31, 0x7e, 0xce, 0xb3, 0x57, 0x29, 0xed, 0x53, 0x6e, 0xe0, 0xfa,
+         0x67, 0x4a, 0x47, 0x8f, 0x5a, 0x68, 0xe7, 0xc9, 0x2d, 0xa8, 0x73, 0x21, 0xf7, 0xe6, 0xcd, 0x98,
+         0x8b, 0xac, 0xf8, 0x5d, 0x48, 0xd7, 0xa3, 0x82, 0x2c, 0x5b, 0x08, 0x18, 0x87, 0x49, 0xd4, 0x91},
+        {0x1a, 0x24, 0x03, 0xcc, 0x5e, 0xf2, 0xad, 0x62, 0xb4, 0xf0, 0x9a, 0xfa, 0xc7, 0x9a, 0x48, 0xa5,
+         0xba, 0x8e, 0xf7, 0x4f, 0x33, 0x21, 0xb6, 0x5a, 0x71, 0x61, 0x64, 0xd4, 0x9b, 0x14, 0x1c, 0x74,
+         0x77, 0x79, 0xfb, 0xcd, 0x8b, 0xe5, 0x0c, 0x9b, 0x02, 0x11, 0x80, 0xac, 0x97, 0xa5, 0x44, 0xad,
+         0x0c, 0x21, 0xcd, 0x1f, 0x3b, 0xd2, 0x63, 0xce, 0x59, 0x03, 0xb9, 0xaf, 0xe4, 0xfd, 0x76, 0xf5}
+    },
+    {
+        {0x71, 0xdd, 0x75, 0xfe, 0x35, 0x76, 0x1c, 0x01, 0xa4, 0x85, 0x97, 0xec, 0x73, 0x0b, 0xc3, 0x32,
+         0x37, 0x90, 0x2f, 0xd4, 0xad, 0x86, 0x12, 0xcb, 0xed, 0x10, 0x31, 0xee, 0xbd, 0xf4, 0x0d, 0xe4,
+         0x39, 0x67, 0x4a, 0x45, 0x32, 0x07, 0x8e, 0x34, 0x37, 0x86, 0x67, 0xbe, 0xae, 0x5c, 0xb5, 0x5f,
+         0x81, 0x4e, 0xad, 0x9b, 0xba, 0xf7, 0xe0, 0x1b, 0x3b, 0x69, 0x53, 0x3e, 0x9f, 0x88, 0xa4, 0x11},
+        {0x30, 0x0d, 0x6b, 0x0b, 0xd6, 0x73, 0x4e, 0x61, 0x70, 0xb8, 0x14, 0xd2, 0xf2, 0x8c, 0x82, 0xde,
+         0x4a, 0x2d, 0xeb, 0xb1, 0xc5, 0x58, 0x9b, 0xc8, 0xb2, 0x67, 0x1e, 0x03, 0x20, 0x58, 0x70, 0x90,
+         0x40, 0xca, 0x07, 0x3d, 0x03, 0x43, 0x19, 0x0c, 0x7f, 0x04, 0x2b, 0x83, 0xc7, 0xbc, 0xab, 0xd3,
+         0xfa, 0x99, 0x7d, 0xe9, 0x8f, 0x4b, 0xf0, 0xe2, 0xbd, 0xc4, 0xa7, 0xbf, 0x5c, 0x55, 0xfc, 0x81},
+        {0x0c, 0xeb, 0x59, 0xa9, 0x56, 0x01, 0xdd, 0x68, 0xd8, 0x4a, 0x34, 0xcf, 0x28, 0x9b, 0xa4, 0xbf,
+         0x94, 0x35, 0x83, 0xe7, 0x11, 0x3f, 0xc3, 0x37, 0x44, 0x33, 0xb7, 0xed, 0x36, 0x90, 0x52, 0x32,
+         0x1a, 0x78, 0x1b, 0x6d, 0xe1, 0xc3, 0x4c, 0xed, 0x78, 0x44, 0x26, 0xcc, 0xe7, 0x05, 0x5d, 0x4f,
+         0xc9, 0xa4, 0xf9, 0x77, 0xb0, 0x25, 0xf8, 0xa0, 0xf9, 0x93, 0x58, 0x2b, 0x61, 0x61, 0x5a, 0x85},
+        {0x42, 0x54, 0x5a, 0x6a, 0x59, 0x88, 0x5c, 0x28, 0x26, 0x6a, 0xe0, 0x76, 0x52, 0xd2, 0x45, 0x03,
+         0xc2, 0xfb, 0x58, 0x30, 0xc8, 0x58, 0x17, 0xf6, 0x96, 0x39, 0x81, 0x16, 0x8c, 0xbe, 0xc8, 0xf9,
+         0x70, 0x64, 0x06, 0xcd, 0xbd, 0x1c, 0xe0, 0xbd, 0xbd, 0x9e, 0xa2, 0x69, 0xba, 0xb2, 0xe0, 0x60,
+         0xb1, 0x29, 0xd6, 0xda, 0x0f, 0x1e, 0x69, 0x83, 0xfb, 0x9b, 0x15, 0x67, 0x2c, 0x2e, 0xb5, 0x07},
+        {0x60, 0xfb, 0xa0, 0x61, 0x8a, 0xb4, 0x12, 0x87, 0xa3, 0x27, 0x99, 0xf6, 0x05, 0x66, 0x5a, 0x8e,
+         0x8f, 0xf9, 0xf9, 0xf9, 0x86, 0xe5, 0x1d, 0x36, 0x2c, 0x1e, 0xcf, 0x68, 0xa8, 0x47, 0x6f, 0xf2,
+         0x50, 0xfe, 0xe5, 0x04, 0x97, 0x8d, 0xaf, 0xfe, 0x84, 0x63, 0x7a, 0x29, 0xae, 0x6d, 0x33, 0x91,
+         0x27, 0xf5, 0x84, 0xbc, 0xce, 0xb8, 0xb9, 0xa6, 0xb8, 0x8f, 0x64, 0x50, 0x80, 0x24, 0x5d, 0x2f},
+        {0x7e, 0x97, 0x76, 0x39, 0x70, 0xe9, 0x6e, 0x86, 0xfd, 0x44, 0x4e, 0x2b, 0x16, 0x75, 0x2f, 0x6d,
+         0x95, 0xde, 0xf8, 0x55, 0x5f, 0x6f, 0x8f, 0x25, 0xc8, 0x27, 0x8f, 0x89, 0xe1, 0x8c, 0xfa, 0x41,
+         0x0e, 0x85, 0xb4, 0xc0, 0x8f, 0x01, 0xee, 0x8f, 0x8c, 0x01, 0x91, 0x6e, 0x8d, 0x44, 0xec, 0x3f,
+         0xd2, 0x93, 0x8c, 0x6d, 0xa5, 0x8a, 0xd8, 0x6e, 0x79, 0xd0, 0x7c, 0xa1, 0x14, 0x6b, 0x62, 0x17},
+        {0x02, 0x08, 0x62, 0x2a, 0x2f, 0x72, 0xf9, 0xfb, 0x6c, 0x09, 0xd6, 0xf4, 0xc6, 0x47, 0xaf, 0x66,
+         0x98, 0xcd, 0xba, 0x3b, 0x5d, 0xaf, 0x6d, 0x30, 0x2b, 0x3d, 0x2a, 0x0b, 0x25, 0x76, 0x4c, 0xb8,
+         0x14, 0x46, 0x71, 0x20, 0xe8, 0xa3, 0x1d, 0x04, 0xaa, 0xd8, 0x77, 0x6d, 0xdc, 0xfb, 0x45, 0x9d,
+         0xfc, 0x13, 0xe4, 0x72, 0x01, 0xe1, 0x91, 0x8a, 0x9e, 0x1c, 0x9c, 0xba, 0x53, 0x11, 0x69, 0xf5},
+        {0x6c, 0x12, 0x62, 0xe3, 0xf8, 0xa4, 0x3b, 0x51, 0x76, 0x73, 0xa0, 0xce, 0x20, 0x9f, 0x76, 0xcb,
+         0x22, 0xd7, 0xcd, 0x7e, 0x54, 0xfc, 0xe6, 0xac, 0x23, 0x57, 0x11, 0xe4, 0x41, 0x70, 0x3a, 0x02,
+         0x19, 0x38, 0x41, 0xcf, 0x1e, 0x0f, 0x52, 0x8b, 0x9a, 0x8d, 0x50, 0x8a, 0x27, 0x62, 0x02, 0xa8,
+         0x4f, 0x1f, 0xb0, 0x96, 0xc5, 0xed, 0x01, 0x3a, 0x7f, 0x48, 0x6f, 0x0d, 0x26, 0x9c, 0x00, 0x7f}
+    },
+    {
+        {0x57, 0x42, 0x6a, 0xef, 0xc2, 0x1b, 0xe9, 0xcc, 0xf1, 0x62, 0xe2, 0x3d, 0x25, 0xac, 0x30, 0x02,
+         0xba, 0x85, 0x34, 0x35, 0x1e, 0x65, 0x61, 0x3f, 0x87, 0x0f, 0x69, 0x0f, 0x2f, 0xd4, 0x6c, 0xf5,
+         0x6b, 0x45, 0xb0, 0x02, 0xfb, 0x4e, 0x8a, 0x6f, 0x59, 0xa6, 0xff, 0xb0, 0x06, 0xed, 0x71, 0xf7,
+         0x54, 0x34, 0x21, 0x73, 0x33, 0xb2, 0x66, 0x32, 0x52, 0x04, 0xc7, 0xd1, 0xac, 0x2e, 0x1f, 0x34},
+        {0x20, 0x5a, 0xa3, 0x46, 0x3e, 0x7e, 0x41, 0xaf, 0x60, 0xf5, 0xcf, 0xf4, 0x85, 0x3f, 0xbd, 0x6f,
+         0x74, 0x8a, 0xa1, 0xb1, 0x32, 0xfe, 0x53, 0x08, 0x80, 0x7d, 0x22, 0xc5, 0x03, 0x0b, 0x48, 0xf5,
+         0x32, 0x0b, 0x08, 0xe8, 0xec, 0x61, 0x53, 0xe2, 0xbe, 0x99, 0x55, 0x05, 0x8b, 0xd2, 0x69, 0x93,
+         0xbf, 0x50, 0x35, 0x3e, 0x04, 0x0c, 0x55, 0x6e, 0xf8, 0x97, 0x66, 0x63, 0x44, 0x87, 0x35, 0xaa},
+        {0x68, 0xfc, 0x29, 0xa1, 0xaa, 0x94, 0x81, 0x57, 0xd1, 0xad, 0x91, 0x65, 0xed, 0x3c, 0x62, 0xd5,
+         0xc4, 0xdc, 0x80, 0x25, 0xdb, 0xf8, 0x64, 0xd9, 0x97, 0x2e, 0x59, 0x69, 0x02, 0x45, 0x10, 0xb3,
+         0x5d, 0xe1, 0x5d, 0xe4, 0x1a, 0x8b, 0x7a, 0x67, 0x11, 0x25, 0xe8, 0x84, 0xe9, 0x09, 0x88, 0x20,
+         0x0c, 0x0c, 0xa8, 0xd1, 0x0d, 0x79, 0x17, 0xbb, 0x53, 0x41, 0x21, 0x5a, 0xab, 0x7d, 0xb5, 0xdd},
+        {0x59, 0x2c, 0x8b, 0x88, 0x43, 0xca, 0x1f, 0x7d, 0x9e, 0xe6, 0x92, 0xd5, 0xe2, 0x9b, 0xc1, 0x61,
+         0x2b, 0x0a, 0x98, 0xbe, 0xa4, 0x02, 0xc5, 0xc2, 0xe1, 0xe8, 0x25, 0x3b, 0x65, 0xfe, 0xea, 0x37,
+         0x42, 0xa3, 0x52, 0xd8, 0xdc, 0x52, 0xfe, 0xf9, 0x01, 0x7c, 0xbe, 0x61, 0x7c, 0xdb, 0xee, 0x3a,
+         0xae, 0xfe, 0xd1, 0x93, 0x5a, 0xa6, 0x2f, 0x86, 0x79, 0xaf, 0x6f, 0x2a, 0x1d, 0x00, 0xb5, 0xe0},
+        {0x51, 0x71, 0xa3, 0x09, 0x06, 0x2d, 0x41, 0xc4, 0x11, 0xca, 0xb8, 0xc1, 0xe0, 0xf2, 0x0b, 0x16,
+         0xb8, 0xd9, 0xa6, 0x7c, 0x95, 0x65, 0xb9, 0x98, 0x66, 0x13, 0x19, 0xa8, 0x9a, 0xb8, 0xa2, 0x20,
+         0x10, 0x22, 0x92, 0x7f, 0xee, 0xbf, 0xf7, 0xe6, 0xcb, 0x7d, 0x31, 0x85, 0xf6, 0x3a, 0xcb, 0x8c,
+         0xb1, 0xd4, 0x70, 0x36, 0xe4, 0xb3, 0x15, 0x62, 0xa9, 0x6d, 0xa5, 0x59, 0xf1, 0x0f, 0x60, 0xe3},
+        {0x54, 0x8c, 0xd2, 0xfd, 0x10, 0x81, 0xf7, 0xfe, 0x45, 0x16, 0x19, 0xe9, 0x1f, 0xc7, 0x7d, 0x80,
+         0x26, 0x7b, 0x8c, 0x50, 0x44, 0x57, 0x53, 0x94, 0xbe, 0xde, 0xf0, 0x18, 0x47, 0xb0, 0x21, 0x03,
+         0x0b, 0xce, 0x66, 0x4e, 0x50, 0x5a, 0xab, 0x6b, 0xe5, 0xb1, 0xbd, 0xd3, 0x92, 0xa0, 0xa4, 0x44,
+         0x44, 0x26, 0xc7, 0xbf, 0xfa, 0x7a, 0xfc, 0x24, 0xfe, 0x7c, 0x1b, 0x76, 0xe8, 0x4f, 0xbf, 0xd6},
+        {0x63, 0x4d, 0x61, 0x0a, 0x2a, 0xc9, 0x0d, 0x2a, 0xbe, 0x1d, 0xc8, 0xf4, 0xae, 0x90, 0x24, 0x32,
+         0xca, 0xbe, 0x31, 0x76, 0xf1, 0x44, 0xc1, 0x20, 0x7c, 0xf1, 0x78, 0x1f, 0x55, 0xb9, 0x20, 0x2e,
+         0x17, 0xdf, 0x06, 0x3f, 0x2d, 0x3e, 0x3c, 0xf8, 0x34, 0xa6, 0xfc, 0xc7, 0xf6, 0x29, 0x7b, 0x86,
+         0x67, 0x72, 0x81, 0xbf, 0x53, 0x56, 0x41, 0x2f, 0xae, 0x63, 0xb4, 0x81, 0x52, 0x21, 0x31, 0xfc},
+        {0x04, 0x1c, 0x03, 0x0f, 0xbc, 0xa9, 0x01, 0x51, 0xce, 0x0d, 0x00, 0x64, 0xa8, 0x15, 0xe0, 0x38,
+         0x25, 0xed, 0x77, 0xa4, 0xac, 0x63, 0x46, 0x04, 0xac, 0x71, 0x37, 0xbd, 0x37, 0x13, 0xaf, 0x22,
+         0x72, 0x46, 0x76, 0x25, 0xee, 0x43, 0xfb, 0x7a, 0xc6, 0x7d, 0xc7, 0x1c, 0x65, 0x5e, 0x5c, 0x16,
+         0xe4, 0xe9, 0x7c, 0x2a, 0x3d, 0x44, 0x45, 0xe7, 0xe9, 0xb3, 0x3f, 0xcf, 0x07, 0x80, 0xf9, 0x89}
+    },
+    {
+        {0x62, 0x22, 0xbd, 0x88, 0xbf, 0x2d, 0xf9, 0xd5, 0xd4, 0x4b, 0x60, 0xcf, 0xb4, 0xa0, 0x8a, 0x96,
+         0x00, 0x78, 0xdb, 0x7e, 0xd5, 0x1a, 0x35, 0xeb, 0x3e, 0x0b, 0x6b, 0x8f, 0xf4, 0xed, 0xa2, 0x02,
+         0x03, 0x25, 0xbb, 0x42, 0xea, 0x4e, 0xd0, 0x25, 0xdd, 0x6b, 0xda, 0xed, 0x26, 0x1b, 0x7c, 0x4f,
+         0x54, 0x10, 0xb6, 0x08, 0xba, 0x90, 0x2b, 0x06, 0x8f, 0x1e, 0xfa, 0x57, 0x82, 0xe4, 0x53, 0x13},
+        {0x02, 0x3b, 0xc7, 0xab, 0xc8, 0x4c, 0xb4, 0xc4, 0xae, 0x5f, 0xa6, 0x2b, 0x25, 0xa0, 0xa8, 0x11,
+         0x4e, 0x84, 0x06, 0xd9, 0xbb, 0x93, 0xf2, 0x09, 0x11, 0x42, 0xaa, 0x2d, 0x8b, 0xdb, 0xa5, 0x97,
+         0x4d, 0x2b, 0x97, 0xa7, 0x39, 0xec, 0xeb, 0x14, 0xc9, 0x50, 0x20, 0x37, 0x1d, 0x72, 0x06, 0xe9,
+         0x04, 0xf9, 0x4b, 0x8f, 0x2c, 0x62, 0x0d, 0xce, 0xed, 0x85, 0x11, 0xdf, 0x0f, 0x29, 0xc9, 0xee},
+        {0x13, 0x2a, 0x06, 0x5e, 0xdb, 0x5c, 0x40, 0x41, 0xc5, 0x9a, 0x8b, 0x49, 0xca, 0x8a, 0x61, 0xdf,
+         0x2c, 0xa8, 0xca, 0xa6, 0xcc, 0xea, 0x10, 0xd8, 0x80, 0x07, 0x64, 0x0e, 0x33, 0x26, 0x34, 0x67,
+         0x53, 0x4e, 0xf7, 0x0a, 0x35, 0x32, 0xf7, 0x80, 0x76, 0x2d, 0x6b, 0x7b, 0x85, 0xe5, 0xcf, 0xd1,
+         0xb3, 0x90, 0xb0, 0xdc, 0x31, 0xfe, 0x8e, 0xa5, 0x98, 0x65, 0xfa, 0x3e, 0x1d, 0xd7, 0xde, 0x2f},
+        {0x6d, 0x50, 0x66, 0xcf, 0x71, 0x37, 0xb4, 0xa5, 0x98, 0x0a, 0xa4, 0x53, 0xb6, 0x72, 0xc8, 0x47,
+         0x97, 0xfc, 0x68, 0x56, 0xf0, 0xef, 0x5c, 0xf0, 0xc4, 0xbe, 0x33, 0xfb, 0xbd, 0x39, 0xd1, 0x69,
+         0x54, 0xbb, 0x8c, 0xd8, 0x2a, 0x0a, 0x87, 0xc8, 0x83, 0xab, 0xe3, 0x5a, 0xbe, 0xb8, 0x18, 0x57,
+         0xf9, 0x52, 0x00, 0xb4, 0x22, 0x2e, 0xa9, 0x5b, 0x5c, 0xb3, 0x47, 0x11, 0x52, 0x19, 0xa4, 0x17},
+        {0x35, 0xff, 0x8f, 0x7c, 0xdb, 0x08, 0x69, 0x34, 0x7f, 0x58, 0x21, 0x5a, 0x74, 0xba, 0x0a, 0x8f,
+         0x63, 0xc0, 0x31, 0x0f, 0xb9, 0x9a, 0x0b, 0x27, 0x50, 0x72, 0x42, 0x9c, 0x7b, 0x04, 0xc2, 0xcd,
+         0x50, 0xe1, 0xcc, 0x68, 0x71, 0x15, 0x5f, 0x05, 0x54, 0x69, 0xe8, 0x69, 0x53, 0xbb, 0x60, 0x6b,
+         0x4e, 0x1b, 0x57, 0x17, 0xdf, 0xe1, 0xa8, 0xa9, 0x0f, 0xc4, 0x9c, 0xba, 0xa6, 0xce, 0x8b, 0x8a},
+        {0x6c, 0x63, 0x65, 0xc1, 0x7f, 0x4b, 0xb2, 0x6f, 0x6b, 0x4e, 0x87, 0x07, 0x9a, 0x83, 0x28, 0xe5,
+         0x40, 0x12, 0xbc, 0x64, 0x94, 0x73, 0x85, 0xa1, 0x2a, 0xf2, 0x12, 0x0a, 0x62, 0x2e, 0x02, 0x13,
+         0x1c, 0x57, 0x03, 0xa9, 0xd3, 0xd1, 0xa9, 0x68, 0xc8, 0x32, 0x0a, 0x00, 0x56, 0xa9, 0xec, 0x8e,
+         0x08, 0xdc, 0x33, 0x2a, 0x60, 0xb8, 0xd3, 0xeb, 0x03, 0x09, 0x49, 0x9e, 0x54, 0x94, 0xc7, 0x82},
+        {0x68, 0xb8, 0x18, 0xa5, 0x0b, 0x31, 0xd5, 0x2c, 0xb8, 0x30, 0x01, 0x41, 0xbe, 0x7c, 0xea, 0x83,
+         0x47, 0x9d, 0xe5, 0x18, 0x48, 0xc1, 0xe1, 0x8f, 0x3b, 0x94, 0x4c, 0x67, 0x5b, 0xd8, 0x87, 0xd1,
+         0x1e, 0x8b, 0x23, 0x3e, 0xc0, 0x07, 0x66, 0xb2, 0x28, 0xee, 0x74, 0xd7, 0x53, 0x6d, 0x8f, 0x43,
+         0x96, 0x85, 0x96, 0x55, 0x35, 0xad, 0xdc, 0x77, 0x47, 0x28, 0xe4, 0xdf, 0xed, 0x39, 0x88, 0x26},
+        {0x6b, 0x66, 0x15, 0x9a, 0xc8, 0x70, 0x2d, 0x4e, 0x34, 0x07, 0x3b, 0x76, 0x62, 0x9d, 0xea, 0xb2,
+         0xd3, 0xaa, 0x50, 0x94, 0x2d, 0xb5, 0xb0, 0x0e, 0x4a, 0x73, 0xe8, 0xbe, 0x85, 0x93, 0x62, 0xa9,
+         0x19, 0xdd, 0x4b, 0xef, 0x38, 0xef, 0xd5, 0x04, 0xe4, 0x9b, 0x3a, 0x5d, 0x58, 0x44, 0x32, 0xb9,
+         0xce, 0x63, 0x08, 0x83, 0x22, 0x60, 0x31, 0xe7, 0x5f, 0xee, 0x1a, 0x22, 0xc8, 0xca, 0x96, 0xc5}
+    },
+    {
+        {0x71, 0xac, 0x99, 0x64, 0x7b, 0x61, 0xb9, 0xec, 0xa6, 0xf0, 0xc2, 0x34, 0x32, 0xa5, 0x18, 0xf7,
+         0x38, 0xae, 0xe7, 0x08, 0xd5, 0x93, 0x2d, 0x4e, 0xf0, 0xf1, 0x72, 0x24, 0x02, 0x50, 0xa2, 0x26,
+         0x3a, 0x96, 0xc2, 0xc0, 0x28, 0xeb, 0xe5, 0xf4, 0x89, 0x13, 0xbe, 0x30, 0x14, 0x7e, 0x41, 0xbc,
+         0x5e, 0x1c, 0xab, 0x95, 0x95, 0xd5, 0x40, 0x41, 0x38, 0xa9, 0xaa, 0x1b, 0x55, 0x74, 0xcf, 0x25},
+        {0x22, 0x1b, 0x13, 0x8a, 0x1b, 0xbb, 0x65, 0x48, 0xd2, 0xef, 0x71, 0x9b, 0xba, 0xee, 0x43, 0x61,
+         0x14, 0xe7, 0xcb, 0x6b, 0x32, 0x25, 0xdf, 0xb9, 0x4c, 0x32, 0x76, 0x67, 0xec, 0x45, 0x77, 0x2b,
+         0x79, 0x51, 0xb2, 0x95, 0xfa, 0xb7, 0xfb, 0xff, 0xa4, 0x6c, 0x08, 0xf6, 0x97, 0x9b, 0xb3, 0x20,
+         0x60, 0x97, 0x4f, 0xb0, 0x37, 0xbf, 0x59, 0x98, 0xd0, 0xba, 0x5a, 0x38, 0x18, 0x0c, 0xad, 0x84},
+        {0x29, 0x77, 0x3d, 0xdf, 0x76, 0x13, 0x87, 0x29, 0xe3, 0x3c, 0x8f, 0xa9, 0x87, 0xb9, 0x72, 0x5f,
+         0x5f, 0x67, 0x3e, 0xc6, 0x13, 0xfd, 0x5e, 0xb7, 0xa8, 0x1c, 0xcf, 0x3d, 0x36, 0x59, 0xce, 0x9e,
+         0x5d, 0x8f, 0xfd, 0xb9, 0x7d, 0x47, 0xf6, 0x3d, 0xfb, 0xeb, 0x77, 0x9a, 0xba, 0x11, 0x2c, 0x7e,
+         0xfe, 0xda, 0xb2, 0xc6, 0xac, 0xcf, 0xe6, 0x41, 0x79, 0x78, 0xef, 0x90, 0x9b, 0xf1, 0x90, 0x06},
+        {0x1c, 0x1b, 0x0d, 0x95, 0xdb, 0x6a, 0x05, 0x7e, 0xb3, 0x4f, 0x28, 0xbe, 0xed, 0xa9, 0xf6, 0xbb,
+         0xb5, 0x31, 0x52, 0x85, 0xde, 0x28, 0x04, 0xd1, 0x5c, 0x3b, 0x18, 0x6b, 0xdb, 0x3f, 0x5c, 0x28,
+         0x57, 0xbd, 0x5d, 0xe4, 0xe0, 0x05, 0x6c, 0xbb, 0x4d, 0x98, 0xab, 0xef, 0x9d, 0x1e, 0x0e, 0xd6,
+         0xca, 0xb1, 0x62, 0x8a, 0xc0, 0x8e, 0x36, 0x07, 0x3e, 0x31, 0xd0, 0x0a, 0x9a, 0xc3, 0xc5, 0xd5},
+        {0x32, 0xf5, 0xc5, 0x3b, 0x33, 0x13, 0xbd, 0x76, 0x81, 0x01, 0x7b, 0xbf, 0x23, 0x76, 0x95, 0x36,
+         0x81, 0x88, 0x18, 0x7b, 0xed, 0xfc, 0x94, 0xc0, 0x2c, 0xa0, 0x0d, 0x01, 0x5f, 0xea, 0x2b, 0x34,
+         0x4a, 0x5e, 0xad, 0x73, 0xf1, 0xe4, 0x76, 0x77, 0x5c, 0x4b, 0x73, 0xb8, 0x67, 0x8f, 0x04, 0x85,
+         0x91, 0xe5, 0x1c, 0xf4, 0x70, 0xf8, 0x93, 0xe5, 0xc4, 0xf4, 0xbd, 0x55, 0x93, 0x2b, 0x52, 0xf5},
+        {0x6e, 0xc4, 0x52, 0x37, 0x5e, 0x30, 0x39, 0xc8, 0x2d, 0x6d, 0x27, 0xb4, 0x1d, 0x99, 0xa1, 0x8c,
+         0xa8, 0xa1, 0x26, 0x46, 0xe0, 0x49, 0xab, 0xe1, 0x8e, 0x94, 0xa9, 0xfd, 0xce, 0x27, 0x21, 0xcc,
+         0x0f, 0xbf, 0x6b, 0xd4, 0x6e, 0x7f, 0x4c, 0x6b, 0xdd, 0xda, 0x7e, 0x0f, 0x3e, 0xea, 0x6c, 0x43,
+         0x0f, 0xad, 0x3b, 0xd9, 0x02, 0x1a, 0x14, 0x1b, 0x84, 0x33, 0x15, 0xb0, 0xe7, 0xf4, 0x85, 0xa9},
+        {0x6f, 0x4b, 0xc3, 0x41, 0xe2, 0x2f, 0x0b, 0xda, 0xcf, 0x6a, 0x9b, 0x01, 0xaf, 0x17, 0x7a, 0xec,
+         0xbc, 0xdc, 0x59, 0x4d, 0x29, 0x95, 0xa7, 0xf8, 0x64, 0x95, 0x52, 0x6f, 0xee, 0x66, 0x1c, 0xd3,
+         0x71, 0x49, 0xdb, 0x8a, 0xf3, 0x60, 0xd4, 0xc4, 0x4d, 0xdd, 0xbf, 0x23, 0x99, 0x8a, 0x38, 0xd3,
+         0x98, 0xab, 0x2c, 0x65, 0x00, 0xdf, 0xbd, 0x74, 0xdd, 0xb0, 0x9f, 0x31, 0x63, 0xc8, 0xa3, 0xcd},
+        {0x4f, 0x84, 0x6f, 0xad, 0x2e, 0xef, 0xb8, 0xc9, 0x48, 0xa8, 0xbd, 0x3a, 0x87, 0xd8, 0xb4, 0xdf,
+         0xa0, 0xa0, 0xab, 0x64, 0x3e, 0x72, 0x4e, 0xbb, 0x1c, 0x91, 0x43, 0x7c, 0x56, 0x7c, 0x9f, 0x47,
+         0x0a, 0x26, 0x40, 0xcc, 0xde, 0x50, 0x5d, 0xa1, 0xaa, 0x92, 0x27, 0xba, 0xca, 0xca, 0x13, 0xd4,
+         0x9a, 0x67, 0xa1, 0x99, 0xf0, 0xe1, 0x6a, 0xa9, 0xf8, 0x6c, 0x2a, 0x7e, 0x1b, 0xf0, 0x2d, 0x2d}
+    },
+    {
+        {0x1f, 0x6a, 0x1f, 0xd8, 0xcc, 0x0e, 0x05, 0xb2, 0x74, 0x2b, 0xa0, 0xfc, 0x03, 0x69, 0xb5, 0x24,
+         0x76, 0x70, 0x54, 0x36, 0x37, 0xdd, 0x03, 0x3e, 0x64, 0xdb, 0xce, 0x90, 0xb2, 0xf2, 0x3e, 0x9f,
+         0x77, 0x99, 0x64, 0x40, 0x1e, 0xe8, 0x69, 0xa9, 0xb3, 0x1c, 0x0e, 0xf8, 0x74, 0xa8, 0x64, 0x40,
+         0xba, 0x85, 0xd2, 0x5c, 0x2c, 0xe9, 0x32, 0xbd, 0x31, 0xa0, 0x86, 0x58, 0x69, 0x60, 0x5e, 0x19},
+        {0x6f, 0x0a, 0x87, 0xaf, 0x6e, 0x0f, 0x4a, 0x05, 0xfa, 0x70, 0x67, 0xcf, 0xec, 0xd4, 0xf9, 0x8d,
+         0xad, 0xa3, 0x79, 0x1f, 0x71, 0x4a, 0x66, 0x64, 0x8d, 0xbb, 0x5c, 0xbb, 0xfd, 0x4f, 0x32, 0x6c,
+         0x6b, 0x60, 0x13, 0x81, 0x35, 0x05, 0x92, 0x7d, 0xcb, 0xcb, 0x6a, 0x42, 0xe8, 0x87, 0xcc, 0x1d,
+         0x5f, 0xca, 0x17, 0x5e, 0x4c, 0xd2, 0x26, 0xbe, 0x60, 0x09, 0x24, 0x8c, 0x6c, 0x6e, 0x36, 0xc6},
+        {0x39, 0x8c, 0x8c, 0x8c, 0x8e, 0x8d, 0xac, 0x32, 0x56, 0x74, 0x9d, 0xb6, 0x6b, 0x66, 0xcb, 0x44,
+         0x74, 0x86, 0x13, 0x2e, 0xc4, 0x14, 0xfd, 0x51, 0x6b, 0x4e, 0xaf, 0x0a, 0x0f, 0xcd, 0x15, 0xf4,
+         0x7f, 0xc5, 0xe8, 0x8a, 0x59, 0x6b, 0x42, 0x65, 0xad, 0xbf, 0xa2, 0x21, 0xd1, 0xf6, 0x9e, 0x23,
+         0x41, 0x40, 0xe3, 0xfa, 0x1f, 0x3b, 0x5c, 0x39, 0xf7, 0x6d, 0xef, 0x11, 0x1a, 0x74, 0x59, 0xca},
+        {0x1f, 0x90, 0xc7, 0xef, 0x46, 0x10, 0xdd, 0x08, 0x3b, 0x3d, 0x64, 0xba, 0xc4, 0x75, 0x74, 0xd9,
+         0xda, 0x32, 0x6b, 0x53, 0x6b, 0x9a, 0x6e, 0xb0, 0xf6, 0xc3, 0x13, 0x4a, 0x84, 0x7a, 0x05, 0x64,
+         0x63, 0x34, 0x4c, 0xcb, 0xe4, 0x16, 0x9a, 0xb9, 0x7a, 0x13, 0xc3, 0xcc, 0xb0, 0x97, 0xc0, 0xf4,
+         0xfd, 0xff, 0xbc, 0xf6, 0x28, 0x44, 0x12, 0x30, 0x3c, 0x79, 0xa1, 0xc8, 0xce, 0x3a, 0x2f, 0x7b},
+        {0x3d, 0x22, 0xb5, 0x8c, 0x66, 0x3e, 0xa9, 0x1b, 0x49, 0xe9, 0x5c, 0x17, 0xc7, 0xda, 0x15, 0x63,
+         0xcd, 0xb6, 0xc6, 0xad, 0x70, 0xa4, 0x6d, 0xe9, 0xe2, 0xf5, 0x9f, 0xd6, 0x86, 0x60, 0x3f, 0x08,
+         0x72, 0x40, 0xc7, 0xe8, 0x2b, 0xa8, 0x37, 0x27, 0x33, 0xd8, 0xbf, 0xe2, 0x0d, 0x17, 0x6a, 0xbd,
+         0xa8, 0x09, 0x65, 0xf9, 0xf4, 0xb7, 0xc7, 0x79, 0x97, 0x42, 0xb6, 0x3f, 0xb0, 0x3b, 0x0e, 0xb2},
+        {0x6e, 0x6c, 0x09, 0xdb, 0x77, 0xee, 0xdf, 0x33, 0xe5, 0x01, 0x85, 0xbd, 0x1b, 0xbc, 0xc0, 0xb0,
+         0xef, 0x7f, 0x4f, 0x4f, 0xdf, 0x4b, 0x79, 0xca, 0x47, 0x64, 0x5e, 0x86, 0xf1, 0x90, 0x06, 0x08,
+         0x56, 0x40, 0xb6, 0x67, 0xac, 0x2d, 0x72, 0xe3, 0xee, 0x56, 0x9f, 0x90, 0x63, 0x89, 0xcf, 0x8b,
+         0xba, 0xd9, 0x99, 0xa4, 0xf5, 0x39, 0x3f, 0x0d, 0xc1, 0xe0, 0xec, 0xeb, 0x9c, 0x91, 0x6f, 0x07},
+        {0x0a, 0x87, 0x28, 0xe5, 0xd7, 0x85, 0x18, 0x03, 0x54, 0xc8, 0x6e, 0x45, 0x31, 0x92, 0xf0, 0xf7,
+         0x6e, 0xdc, 0x78, 0x72, 0x7d, 0x7f, 0xfc, 0xd4, 0xb5, 0x00, 0x93, 0x39, 0xd2, 0x47, 0x57, 0x46,
+         0x7e, 0xf3, 0x95, 0x52, 0xf5, 0x07, 0x67, 0x02, 0xa3, 0xea, 0x62, 0x10, 0x39, 0x06, 0x55, 0x65,
+         0xa0, 0xd3, 0x7f, 0xb0, 0x93, 0x23, 0xf7, 0x08, 0xcc, 0xef, 0xd4, 0x1c, 0xde, 0xd4, 0x90, 0xc8},
+        {0x47, 0xac, 0x42, 0xe7, 0xc5, 0x94, 0x81, 0xa9, 0x28, 0x34, 0x8d, 0x7a, 0xaa, 0xad, 0xe8, 0x8b,
+         0x00, 0xb7, 0xaa, 0xe4, 0xe7, 0x3e, 0xbe, 0x0d, 0xd2, 0x0e, 0x33, 0x09, 0x2d, 0xd3, 0x4e, 0x07,
+         0x28, 0xa6, 0xc1, 0xd1, 0x35, 0x6c, 0x10, 0xeb, 0xea, 0x15, 0xcb, 0xfd, 0x16, 0x1a, 0xe9, 0x74,
+         0xf3, 0xb2, 0xa4, 0xf5, 0x1e, 0xd0, 0x64, 0x03, 0xc2, 0xf0, 0x9b, 0xb5, 0x8f, 0x7a, 0x89, 0x24}
+    },
+    {
+        {0x22, 0xe2, 0xc0, 0x39, 0x06, 0x79, 0x20, 0xc4, 0x29, 0x80, 0xdc, 0xb3, 0xa9, 0x05, 0xfc, 0x91,
+         0x60, 0x1c, 0x2b, 0x34, 0xe8, 0x19, 0xce, 0x15, 0x32, 0xad, 0xa4, 0xa5, 0xfc, 0x39, 0xd5, 0xcc,
+         0x63, 0x1c, 0xf9, 0x94, 0x5a, 0x09, 0xbf, 0x26, 0xd7, 0xe5, 0x95, 0xb3, 0xf8, 0xe3, 0x39, 0x06,
+         0x96, 0x87, 0x05, 0x12, 0x82, 0x0d, 0xf6, 0x3c, 0x54, 0x18, 0x57, 0x70, 0x89, 0xe1, 0xa8, 0xbb},
+        {0x1a, 0x62, 0xe8, 0x5b, 0xa4, 0xa1, 0x4a, 0x3f, 0x24, 0xf9, 0xdc, 0xa8, 0x52, 0x9c, 0xa8, 0x42,
+         0xf5, 0xc7, 0xf1, 0x8a, 0x3f, 0x42, 0x98, 0x86, 0xd6, 0xb1, 0x36, 0x73, 0x64, 0x9a, 0xd5, 0x3d,
+         0x1f, 0x6d, 0x17, 0xd9, 0xa1, 0xe5, 0xc5, 0xd8, 0xcb, 0xb9, 0x81, 0x00, 0x75, 0x7e, 0x51, 0x83,
+         0x55, 0x1d, 0x00, 0x09, 0x11, 0x83, 0xe6, 0xa5, 0xe1, 0xeb, 0x0d, 0xd5, 0x14, 0xc8, 0xbd, 0xc5},
+        {0x45, 0xd5, 0x05, 0x07, 0xf0, 0xc2, 0x88, 0x0a, 0xa1, 0xac, 0xcf, 0xa5, 0x2b, 0x8b, 0x6d, 0xd0,
+         0xff, 0xbe, 0x97, 0xc9, 0x37, 0x02, 0xb7, 0x62, 0xf9, 0x6b, 0xfa, 0x47, 0xee, 0xa2, 0xdc, 0xf9,
+         0x55, 0x4b, 0x5a, 0xab, 0x95, 0x42, 0x20, 0xe3, 0xe5, 0x94, 0x35, 0x2c, 0xf4, 0x43, 0x54, 0x3f,
+         0x50, 0x4d, 0xa4, 0x62, 0xc3, 0x95, 0x2f, 0xc9, 0xad, 0x28, 0x46, 0x05, 0x72, 0x97, 0xeb, 0xe8},
+        {0x36, 0xb5, 0x66, 0xa2, 0xc0, 0xf8, 0xe3, 0x6e, 0x76, 0x09, 0x92, 0xeb, 0x83, 0xd5, 0x09, 0x23,
+         0x87, 0x31, 0x93, 0x9d, 0xd9, 0xdd, 0x0d, 0x19, 0x51, 0x3f, 0x52, 0xe1, 0xe9, 0xe4, 0xf9, 0xea,
+         0x1b, 0xde, 0x4a, 0xd0, 0x43, 0x3e, 0xe4, 0xe1, 0x9e, 0x73, 0x4c, 0x55, 0x89, 0x78, 0xdd, 0x94,
+         0x5e, 0xd2, 0x44, 0xe3, 0x84, 0x14, 0x38, 0x7a, 0x43, 0xe7, 0x02, 0x32, 0xed, 0x39, 0xbb, 0x3a},
+        {0x41, 0xea, 0xa7, 0x19, 0xe1, 0x4d, 0x96, 0xef, 0x63, 0x9a, 0x20, 0x5f, 0x5f, 0x8d, 0x78, 0xcf,
+         0x83, 0xfc, 0x4e, 0x63, 0xd8, 0x22, 0x3d, 0x18, 0xd6, 0x10, 0x82, 0x63, 0xfe, 0x52, 0x73, 0x0c,
+         0x77, 0xdf, 0x8f, 0x3c, 0x75, 0xcc, 0x33, 0xdf, 0xc3, 0x9c, 0x1d, 0x2a, 0x68, 0x99, 0x71, 0x8e,
+         0x6e, 0x10, 0xf2, 0x35, 0x24, 0x84, 0x43, 0x31, 0xb0, 0xb8, 0xeb, 0xed, 0x4d, 0x73, 0x5d, 0x76},
+        {0x17, 0x47, 0x5a, 0x44, 0x2c, 0x17, 0x55, 0xc3, 0x78, 0x90, 0x79, 0xa6, 0xc2, 0x05, 0xc1, 0x72,
+         0xbe, 0x30, 0x12, 0x1f, 0xfe, 0x7f, 0x36, 0x75, 0xf4, 0x54, 0x7f, 0x66, 0xf2, 0x97, 0xf0, 0x48,
+         0x4d, 0x82, 0xda, 0x48, 0xfe, 0x81, 0x04, 0xe9, 0x18, 0x5c, 0x1c, 0xcf, 0x2c, 0x3f, 0x17, 0xf4,
+         0x99, 0x9f, 0x39, 0xf5, 0xe4, 0xe1, 0xf0, 0x67, 0x58, 0xbe, 0x20, 0xe4, 0x7c, 0x0b, 0x4d, 0x5a},
+        {0x46, 0x55, 0x83, 0xd6, 0xeb, 0xd7, 0x37, 0x9a, 0x2c, 0xfe, 0x99, 0xe8, 0x1c, 0x5c, 0xe6, 0x89,
+         0x24, 0x9f, 0xef, 0xf3, 0xb8, 0x06, 0xed, 0xab, 0x74, 0xbb, 0x6f, 0x87, 0xf3, 0xee, 0x8d, 0x61,
+         0x3b, 0xbf, 0xf7, 0x07, 0x97, 0xfe, 0xef, 0x25, 0xa2, 0x25, 0xbe, 0xf3, 0x5a, 0x4f, 0x17, 0x92,
+         0xce, 0x42, 0xd2, 0xbb, 0x06, 0x86, 0x6d, 0xe5, 0x2d, 0xd5, 0x50, 0xd9, 0x4e, 0x65, 0x93, 0xb5},
+        {0x0f, 0xc8, 0xf3, 0x65, 0xbb, 0x4b, 0x04, 0xe2, 0x75, 0xd3, 0x58, 0xbd, 0x3c, 0x27, 0x77, 0x45,
+         0xc5, 0x65, 0xee, 0xdf, 0xf8, 0x41, 0x79, 0xee, 0x72, 0xcb, 0xc5, 0xa3, 0xe3, 0x8f, 0xe7, 0xb2,
+         0x16, 0xf9, 0x1c, 0x81, 0x91, 0xdb, 0x1e, 0x78, 0x17, 0x45, 0x5b, 0x6a, 0x39, 0x5d, 0xe2, 0xb0,
+         0xf4, 0x39, 0x66, 0x97, 0x92, 0x0b, 0xa0, 0xcd, 0x48, 0x74, 0xe2, 0xb5, 0x34, 0x93, 0x7b, 0x24}
+    },
+    {
+        {0x60, 0x8d, 0xe2, 0x73, 0xa9, 0xf6, 0xa5, 0x34, 0x21, 0x9d, 0x7a, 0xae, 0xde, 0x3c, 0xf6, 0x5a,
+         0x81, 0xe4, 0xdc, 0x03, 0xd7, 0xa2, 0x76, 0x5e, 0xce, 0xd1, 0xd2, 0xb7, 0xbe, 0x46, 0x10, 0xf4,
+         0x3b, 0x31, 0xd0, 0x11, 0x3f, 0x98, 0xd8, 0x1a, 0xb1, 0x31, 0x2f, 0xb2, 0x83, 0x7a, 0xa9, 0xc8,
+         0xdc, 0xc7, 0x96, 0x0f, 0x84, 0xeb, 0x37, 0x13, 0x58, 0xc6, 0xd8, 0x41, 0xf6, 0x71, 0x44, 0xfa},
+        {0x08, 0xd1, 0xe7, 0x5a, 0x33, 0xbf, 0x36, 0x3f, 0x2e, 0xf6, 0x4f, 0xaa, 0x0a, 0xb5, 0xf9, 0x58,
+         0x2d, 0x11, 0x81, 0xb7, 0x93, 0xec, 0x94, 0x52, 0xea, 0x93, 0xa3, 0x01, 0x16, 0x34, 0xd5, 0x81,
+         0x47, 0xdd, 0x93, 0x93, 0x50, 0xf0, 0x6a, 0x41, 0xea, 0x9c, 0x3d, 0x88, 0x9d, 0x12, 0x71, 0x55,
+         0xd0, 0x27, 0x59, 0x26, 0xd0, 0x5b, 0x5b, 0xc4, 0x39, 0x77, 0xb5, 0xcc, 0xae, 0x42, 0xcf, 0x1a},
+        {0x4b, 0x55, 0xdf, 0x55, 0x5e, 0xf7, 0x8c, 0xa2, 0x9b, 0xb0, 0x8c, 0xeb, 0xf7, 0x4c, 0xe0, 0x71,
+         0x15, 0x20, 0x51, 0x82, 0x08, 0x9d, 0x86, 0xef, 0xa7, 0x0c, 0x3f, 0x0d, 0xfd, 0x1d, 0xa8, 0x3e,
+         0x2f, 0xae, 0xbe, 0x97, 0x41, 0x6b, 0x3b, 0x52, 0xa2, 0xe9, 0x7e, 0xc0, 0x2e, 0x0f, 0x2e, 0x68,
+         0x41, 0x49, 0xbd, 0x6d, 0x58, 0x14, 0x3a, 0xad, 0x30, 0x4e, 0x6e, 0x8c, 0xdc, 0xd6, 0x19, 0x4d},
+        {0x0b, 0x2f, 0xcb, 0x60, 0xa1, 0x9e, 0x6a, 0x0a, 0x29, 0xbc, 0xc1, 0xe5, 0x22, 0x4e, 0xe0, 0xac,
+         0xfd, 0x64, 0x8e, 0x6e, 0xe2, 0x14, 0x3f, 0x90, 0xa5, 0xf5, 0xaa, 0x1c, 0x6d, 0x51, 0xc9, 0x6f,
+         0x63, 0x01, 0xb5, 0x68, 0xe9, 0xc6, 0x13, 0x86, 0x6d, 0x76, 0xb4, 0xc6, 0x93, 0xde, 0x25, 0xe8,
+         0x34, 0x35, 0x34, 0x47, 0x95, 0xfb, 0x78, 0xc3, 0xc5, 0xe9, 0x44, 0xa1, 0xf3, 0x32, 0x39, 0xdc},
+        {0x6d, 0x18, 0x7e, 0x11, 0xae, 0xdf, 0xd7, 0x14, 0xee, 0x4d, 0xea, 0x36, 0x43, 0xb1, 0x8b, 0x00,
+         0x6f, 0x96, 0x5f, 0x80, 0x58, 0xeb, 0xf3, 0x48, 0x4c, 0x38, 0x02, 0x8d, 0xd6, 0x2e, 0xc7, 0x6e,
+         0x36, 0x07, 0x19, 0x8a, 0x18, 0x19, 0xdc, 0x40, 0xa2, 0x7d, 0x52, 0x37, 0xf9, 0x3e, 0x5e, 0x31,
+         0x07, 0x05, 0x12, 0xd5, 0x61, 0xd0, 0xbc, 0x17, 0xe2, 0xe0, 0x46, 0x4f, 0x0c, 0x1c, 0xe7, 0x45},
+        {0x4d, 0xb4, 0x41, 0x8f, 0x87, 0xf7, 0x78, 0xeb, 0x75, 0x18, 0x5d, 0x9b, 0x62, 0xe9, 0x77, 0xfa,
+         0x43, 0x33, 0x93, 0xaa, 0x9d, 0x26, 0x6f, 0x51, 0x08, 0x1c, 0xd9, 0x97, 0x64, 0x52, 0x9a, 0x1f,
+         0x51, 0x40, 0xb9, 0x86, 0x0c, 0x78, 0xea, 0x80, 0x62, 0x55, 0x4e, 0xc8, 0x6e, 0x1e, 0xdc, 0x7a,
+         0xc7, 0x6c, 0xf7, 0xcd, 0xda, 0xcf, 0xca, 0x01, 0xeb, 0xad, 0x13, 0xe9, 0x3e, 0x82, 0xa8, 0x13},
+        {0x6e, 0x1a, 0x9b, 0xb6, 0x85, 0xad, 0xad, 0x8d, 0x99, 0x71, 0xbe, 0xe7, 0x6c, 0x48, 0xe9, 0x72,
+         0x49, 0x66, 0xd0, 0xb2, 0x85, 0xf5, 0x8e, 0x0d, 0x44, 0x43, 0x1d, 0xda, 0x40, 0x46, 0x54, 0x06,
+         0x31, 0xef, 0x82, 0xc7, 0xb2, 0x81, 0xaa, 0x8d, 0x9f, 0x2c, 0x7c, 0x3e, 0xbf, 0x40, 0x1d, 0x50,
+         0x7a, 0x48, 0x41, 0x75, 0x1f, 0x3e, 0x2b, 0xcb, 0x19, 0x03, 0x9e, 0x6a, 0xca, 0x5e, 0x83, 0xe8},
+        {0x0b, 0x21, 0x6c, 0xee, 0xc2, 0x6c, 0x5c, 0xc8, 0x27, 0xeb, 0xff, 0x75, 0xa3, 0xb4, 0x16, 0x30,
+         0xd8, 0x92, 0x5b, 0xcf, 0x8a, 0xe5, 0x3c, 0x7d, 0xea, 0x34, 0x8f, 0x4c, 0x0d, 0xd3, 0xae, 0x27,
+         0x56, 0x30, 0x53, 0xb0, 0xde, 0xc5, 0x51, 0x8f, 0x24, 0xc5, 0x7a, 0x3f, 0x91, 0x38, 0x91, 0x6e,
+         0xc2, 0x87, 0x60, 0x2e, 0x8a, 0x55, 0x78, 0x19, 0xad, 0x77, 0xaa, 0x2a, 0x53, 0x12, 0xba, 0xc3}
+    },
+    {
+        {0x3f, 0x74, 0x86, 0x17, 0xca, 0x63, 0xab, 0x3e, 0x44, 0xc6, 0xe3, 0x4f, 0x63, 0xe7, 0x32, 0x8e,
+         0xa5, 0x6a, 0x2a, 0x14, 0x6d, 0xa3, 0x43, 0x68, 0xa5, 0x7d, 0xca, 0x18, 0x12, 0x54, 0xfe, 0x02,
+         0x0f, 0xed, 0x89, 0xe6, 0x42, 0x0f, 0xc4, 0x7b, 0x39, 0x38, 0xa2, 0x89, 0x1b, 0xa9, 0xac, 0xee,
+         0x4c, 0xbb, 0x28, 0x99, 0xee, 0x4e, 0x9c, 0xa1, 0x5a, 0x13, 0xdc, 0x52, 0x7d, 0xc1, 0x64, 0x1e},
+        {0x08, 0xf0, 0x50, 0xe6, 0xe4, 0xbb, 0xb5, 0xe4, 0x3b, 0x75, 0x6c, 0x82, 0xa0, 0xff, 0xd6, 0x07,
+         0x23, 0xf7, 0x8c, 0x3f, 0xdf, 0xb4, 0x9c, 0x50, 0x37, 0x8a, 0x10, 0x83, 0x80, 0x8c, 0x3c, 0xf3,
+         0x38, 0x90, 0x00, 0x48, 0xf0, 0x76, 0x85, 0x42, 0xb4, 0xb9, 0x35, 0x47, 0x36, 0xb6, 0x88, 0x06,
+         0x32, 0xa9, 0x46, 0x01, 0xa1, 0x7a, 0x15, 0xad, 0xf4, 0xf2, 0x33, 0x92, 0x48, 0x75, 0xee, 0x62},
+        {0x10, 0x24, 0x81, 0x1d, 0xca, 0xcc, 0xa4, 0x3b, 0xe0, 0x00, 0x39, 0x02, 0x5e, 0x7d, 0x2c, 0xa4,
+         0xb6, 0xd0, 0x68, 0xc1, 0x81, 0x15, 0x9d, 0x64, 0xbb, 0x39, 0xd1, 0x95, 0xc3, 0x9d, 0x15, 0x51,
+         0x49, 0xe4, 0xfc, 0x36, 0xff, 0x8a, 0x92, 0x25, 0xc4, 0xe7, 0xd0, 0x29, 0x8a, 0xee, 0xef, 0xf4,
+         0x91, 0xcf, 0xa5, 0xbf, 0x5b, 0x4d, 0xfe, 0x70, 0xcd, 0x5a, 0x46, 0xd9, 0x37, 0xf9, 0x29, 0xe7},
+        {0x25, 0x83, 0x37, 0x44, 0x56, 0xf2, 0x0c, 0x85, 0xe7, 0x8e, 0x82, 0x02, 0x63, 0xe1, 0x50, 0x75,
+         0x24, 0x89, 0x7a, 0x52, 0x32, 0x05, 0x0b, 0xd0, 0xeb, 0xfc, 0x35, 0x7d, 0x04, 0xb9, 0x00, 0xbd,
+         0x62, 0xd1, 0xc4, 0xff, 0xfd, 0x5a, 0xc7, 0x2c, 0x7e, 0x7d, 0xd5, 0x2c, 0x2b, 0xc9, 0xea, 0x40,
+         0x77, 0xeb, 0xb7, 0x03, 0x2a, 0x39, 0x29, 0x1e, 0x02, 0x12, 0xda, 0x60, 0xcb, 0xce, 0xa1, 0x8f},
+        {0x61, 0x01, 0x52, 0x71, 0x21, 0x22, 0x90, 0x0a, 0xd6, 0x72, 0x41, 0xcc, 0x8a, 0xc3, 0x5a, 0xd3,
+         0x5c, 0xcb, 0xda, 0x17, 0xcf, 0xe3, 0x15, 0xd2, 0x36, 0x60, 0x5e, 0x1a, 0x40, 0x73, 0xa5, 0x0e,
+         0x2e, 0x7e, 0x24, 0x6f, 0xc7, 0xad, 0xf9, 0xea, 0x24, 0x2b, 0x6a, 0x5e, 0x95, 0xf9, 0x86, 0x9c,
+         0x92, 0x05, 0x4c, 0x44, 0x6c, 0xf6, 0x3c, 0x08, 0xe7, 0xa9, 0x7b, 0x26, 0x17, 0x03, 0xb1, 0x75},
+        {0x2f, 0xba, 0x67, 0xcb, 0xc1, 0x77, 0xc2, 0x78, 0x00, 0x4a, 0x74, 0xe9, 0xea, 0xad, 0x3d, 0xc2,
+         0xe2, 0xdd, 0x98, 0x35, 0x9f, 0xb2, 0xd1, 0x56, 0x80, 0xe3, 0x22, 0x15, 0x42, 0x1c, 0x92, 0xba,
+         0x36, 0x39, 0x48, 0xc1, 0x0b, 0xaf, 0xb3, 0xe7, 0x6c, 0xdd, 0xd4, 0x6f, 0x83, 0xdd, 0x0d, 0x2d,
+         0x38, 0xd4, 0x89, 0x4b, 0x87, 0xf4, 0xe5, 0x05, 0x15, 0xc0, 0xf2, 0xd6, 0xe8, 0xea, 0x91, 0xd7},
+        {0x4d, 0x08, 0x92, 0xa3, 0xb6, 0x1e, 0xcd, 0x0f, 0x86, 0xa1, 0xc0, 0xc0, 0x56, 0xc0, 0xd3, 0x6c,
+         0xe6, 0xeb, 0x35, 0x67, 0x63, 0x7b, 0x54, 0x22, 0x64, 0x83, 0x3d, 0xb0, 0xb0, 0x11, 0xb9, 0x07,
+         0x38, 0xec, 0x39, 0x46, 0x9a, 0x1e, 0x53, 0xb1, 0xb3, 0x0e, 0xfd, 0x34, 0x4a, 0x8a, 0x0e, 0xcc,
+         0xa8, 0xbf, 0xa7, 0x50, 0x77, 0xf5, 0xb7, 0xd8, 0xb0, 0x95, 0xaa, 0xaa, 0x81, 0x9f, 0xab, 0x6f},
+        {0x05, 0xb4, 0x07, 0x9d, 0x8c, 0x7a, 0x5a, 0x10, 0xbb, 0x68, 0x98, 0x42, 0x33, 0xb2, 0x72, 0x6b,
+         0xd9, 0x51, 0x96, 0xae, 0x2b, 0x50, 0xe6, 0x05, 0x24, 0x41, 0xfc, 0x4e, 0x5b, 0x98, 0x88, 0x1d,
+         0x23, 0x29, 0x43, 0x22, 0x53, 0xe9, 0xaa, 0x57, 0x90, 0x1c, 0x13, 0x69, 0xe5, 0x7e, 0x54, 0xe4,
+         0xa3, 0x63, 0xd2, 0xcf, 0xe6, 0x90, 0x69, 0x10, 0x8c, 0x83, 0x3f, 0xa8, 0xd7, 0x9f, 0x61, 0x2f}
+    },
+    {
+        {0x69, 0xd9, 0x8b, 0x5e, 0xcc, 0x35, 0xd5, 0x6c, 0x97, 0xc0, 0xbf, 0x31, 0x29, 0x55, 0xd1, 0x99,
+         0xbe, 0xfe, 0x11, 0x6b, 0x41, 0x7d, 0x70, 0xf5, 0xf5, 0x7e, 0x2d, 0xfd, 0x0a, 0xf8, 0x1c, 0xe5,
+         0x3e, 0x26, 0xd4, 0x87, 0xfb, 0xfe, 0x36, 0xab, 0x44, 0xe0, 0xca, 0x3b, 0x24, 0x8f, 0xe9, 0x4b,
+         0xce, 0x92, 0xa6, 0x9b, 0x81, 0x54, 0xd5, 0x0e, 0x2d, 0x54, 0x81, 0xf8, 0x25, 0x9f, 0x4e, 0x8e},
+        {0x62, 0xa8, 0xa8, 0x39, 0xf4, 0x56, 0x60, 0x75, 0x9f, 0x74, 0x1c, 0x78, 0x92, 0x70, 0x33, 0x26,
+         0xe4, 0xad, 0x11, 0xbd, 0x9e, 0x10, 0x2c, 0x07, 0x70, 0xaf, 0x6a, 0xd4, 0x9d, 0xd4, 0xb6, 0xd9,
+         0x3d, 0x45, 0xd6, 0xc6, 0x1b, 0x8a, 0x03, 0xc2, 0x9d, 0x11, 0xcb, 0x1e, 0x96, 0x60, 0x11, 0x29,
+         0x95, 0xfd, 0x3b, 0xc8, 0xc1, 0x55, 0x3a, 0xe8, 0x97, 0x44, 0x8b, 0x61, 0x35, 0x55, 0xbf, 0x3b},
+        {0x5f, 0xf0, 0x31, 0xa9, 0xe8, 0xf4, 0xa9, 0xa2, 0x8d, 0x7e, 0xb3, 0xa9, 0x7f, 0xe4, 0x33, 0x44,
+         0x33, 0x11, 0x22, 0x99, 0xc6, 0xb8, 0x25, 0xd0, 0xa5, 0x5d, 0x14, 0x4b, 0xa1, 0xee, 0x33, 0x47,
+         0x67, 0xc7, 0xce, 0x28, 0x74, 0xdf, 0x5a, 0xb0, 0x40, 0xea, 0xe5, 0x15, 0xee, 0x26, 0xeb, 0x81,
+         0x25, 0x2d, 0xae, 0x35, 0x76, 0xff, 0x40, 0xd7, 0x32, 0x92, 0x7f, 0x6f, 0x65, 0xc1, 0x63, 0xf9},
+        {0x4e, 0x1c, 0x03, 0x62, 0x04, 0xe1, 0x23, 0xf3, 0x11, 0xe8, 0xda, 0x4e, 0x3f, 0xa2, 0x12, 0xfc,
+         0xf0, 0xac, 0xaf, 0xbd, 0xed, 0x42, 0x5b, 0x71, 0xa6, 0x6b, 0x0d, 0xcc, 0xb2, 0x50, 0x0e, 0x7e,
+         0x6a, 0x59, 0x08, 0xd9, 0x61, 0xf0, 0x0a, 0x62, 0xa2, 0xac, 0x90, 0x4f, 0xd8, 0x24, 0xf6, 0x93,
+         0x2f, 0x0e, 0x73, 0x5f, 0x25, 0x7a, 0x7d, 0x0d, 0x27, 0x3d, 0x61, 0x73, 0x6f, 0x1b, 0xb1, 0xc8},
+        {0x2e, 0xc3, 0x41, 0x49, 0x92, 0x96, 0x44, 0x70, 0x60, 0x35, 0xf4, 0x1d, 0x42, 0x29, 0x42, 0xc1,
+         0xe1, 0xfa, 0xb3, 0x7c, 0x0d, 0x6e, 0xa3, 0x5d, 0x04, 0x0a, 0xdb, 0x65, 0x17, 0x41, 0x36, 0xb3,
+         0x2e, 0xcb, 0x17, 0x53, 0x0e, 0x69, 0xea, 0x2c, 0xc5, 0x5c, 0x3c, 0x54, 0xa7, 0x81, 0x60, 0xf2,
+         0x72, 0xe4, 0xfc, 0x3d, 0xd4, 0x0e, 0x3e, 0x39, 0xb3, 0xa3, 0x3c, 0x31, 0x99, 0x9a, 0xba, 0x40},
+        {0x12, 0x16, 0xd3, 0x90, 0x00, 0xeb, 0xe4, 0x4c, 0xa6, 0x9d, 0x80, 0xa6, 0xac, 0x29, 0x38, 0x55,
+         0xe1, 0xcf, 0x96, 0xc5, 0x50, 0xe2, 0xe2, 0x0d, 0x51, 0x8a, 0x52, 0x0a, 0xb7, 0x7d, 0x56, 0xf3,
+         0x37, 0x41, 0x32, 0xbe, 0x82, 0xd9, 0x73, 0xbd, 0x70, 0x43, 0xaa, 0xb9, 0x12, 0x32, 0x4e, 0xd0,
+         0x3b, 0x4b, 0xd0, 0xd9, 0xa6, 0x49, 0xe3, 0x82, 0x3e, 0x78, 0xf4, 0xfa, 0x15, 0x1f, 0xd1, 0xd4},
+        {0x3c, 0xbe, 0x5d, 0x79, 0xf3, 0x58, 0xc7, 0xe6, 0x03, 0x96, 0x98, 0x0d, 0xd1, 0x05, 0x82, 0x82,
+         0xee, 0x0a, 0x12, 0xa7, 0xac, 0x7e, 0xb9, 0x0c, 0x64, 0x67, 0xf0, 0x36, 0x2d, 0xed, 0xb0, 0x22,
+         0x2a, 0xaa, 0x63, 0x5d, 0x3e, 0x22, 0xc2, 0xe6, 0x39, 0x0f, 0xda, 0x32, 0x22, 0xbe, 0x6c, 0xc5,
+         0xac, 0xed, 0x55, 0xc6, 0x0e, 0x84, 0x9e, 0x2f, 0x69, 0x6e, 0xdd, 0x1a, 0x92, 0xe8, 0x20, 0x34},
+        {0x7f, 0xe8, 0x90, 0x6b, 0x45, 0x5e, 0x9f, 0x3a, 0x49, 0x46, 0x48, 0x10, 0xd3, 0xe6, 0xb8, 0xe5,
+         0xfe, 0xf5, 0xd1, 0x72, 0x26, 0xdd, 0xea, 0x3b, 0x18, 0xf0, 0x8e, 0x2f, 0xf8, 0x55, 0x2d, 0x6f,
+         0x13, 0x00, 0xff, 0x9d, 0x28, 0xf1, 0x35, 0x03, 0x02, 0x03, 0xb1, 0x37, 0xea, 0x4a, 0x3e, 0xc1,
+         0x8d, 0x5d, 0xd0, 0xdd, 0x6b, 0x29, 0xa6, 0xee, 0x70, 0x40, 0xb9, 0x7b, 0x33, 0x69, 0x76, 0xd3}
+    },
+    {
+        {0x1e, 0x34, 0x44, 0x33, 0x47, 0xf9, 0xe6, 0x27, 0xb3, 0x53, 0x11, 0x57, 0xfa, 0xab, 0x6e, 0xac,
+         0xa1, 0xbc, 0x31, 0x14, 0xdf, 0x4a, 0x14, 0x23, 0xcc, 0x12, 0xbf, 0x84, 0x17, 0xb5, 0xd6, 0x22,
+         0x29, 0x59, 0x55, 0xa5, 0xed, 0x06, 0x1e, 0xca, 0x7f, 0x87, 0xb9, 0x48, 0x56, 0x66, 0xba, 0x94,
+         0x89, 0xec, 0x20, 0xa9, 0xc4, 0x84, 0x22, 0x4d, 0xc9, 0x20, 0x35, 0x0b, 0xb4, 0xa6, 0xfc, 0x79},
+        {0x4c, 0xab, 0x81, 0x9c, 0x06, 0xb2, 0xf8, 0x61, 0xb4, 0xbe, 0x5b, 0x06, 0xa9, 0x18, 0xbc, 0x31,
+         0x4b, 0xf2, 0x9f, 0x56, 0xcf, 0xf3, 0x89, 0xae, 0x2b, 0xa8, 0xab, 0xd5, 0xf1, 0xf5, 0xe1, 0x56,
+         0x1f, 0x10, 0xfb, 0x18, 0xbd, 0x5e, 0xcf, 0xe6, 0x33, 0xb5, 0x39, 0x36, 0xf7, 0x0c, 0xe8, 0xe5,
+         0x8b, 0x6a, 0x86, 0x4e, 0x67, 0x92, 0x97, 0x77, 0x0f, 0x2b, 0x38, 0x16, 0x01, 0x76, 0x68, 0x1f},
+        {0x7f, 0xbd, 0x4f, 0x7b, 0xf2, 0xd7, 0x39, 0xbb, 0x2a, 0x5c, 0xf2, 0x84, 0xee, 0xdd, 0x56, 0x01,
+         0xc0, 0x23, 0x19, 0x8f, 0xc8, 0xe3, 0x8c, 0x15, 0xe4, 0xc5, 0x1c, 0xdc, 0x21, 0xd5, 0x60, 0x1b,
+         0x66, 0xe0, 0xdd, 0x39, 0x7f, 0x1c, 0x40, 0x1b, 0xe0, 0x0a, 0x79, 0x16, 0xcb, 0xb3, 0x20, 0x33,
+         0x24, 0x1e, 0x6b, 0x30, 0x37, 0xff, 0xb0, 0xde, 0xe4, 0xc6, 0xcf, 0xa9, 0x4a, 0xa0, 0x69, 0x6e},
+        {0x7c, 0x68, 0x6b, 0x90, 0xcf, 0x6f, 0xf6, 0xa3, 0xa5, 0x9c, 0xc7, 0xd8, 0xa5, 0xe0, 0x0a, 0x2c,
+         0x9b, 0x22, 0x04, 0xde, 0xcf, 0x83, 0xf9, 0x6b, 0xb5, 0x6b, 0x53, 0xef, 0x63, 0x0d, 0xf0, 0x83,
+         0x00, 0x0f, 0x1d, 0xea, 0xb1, 0xd3, 0xa4, 0xa3, 0xd2, 0x52, 0x8d, 0x91, 0x03, 0xd1, 0x18, 0xfa,
+         0xfd, 0xa8, 0x73, 0xcc, 0xf0, 0xa5, 0x18, 0xc4, 0x58, 0x21, 0xd5, 0x1a, 0x7f, 0xd7, 0x15, 0x33},
+        {0x7c, 0xa2, 0x4f, 0xf7, 0x11, 0xcd, 0x60, 0xfa, 0x21, 0x39, 0xd4, 0xbb, 0x96, 0x73, 0x5c, 0xae,
+         0x4e, 0x34, 0xd0, 0x71, 0x71, 0x3c, 0x45, 0xb6, 0xa5, 0x92, 0x92, 0xdc, 0x72, 0xb6, 0x02, 0x44,
+         0x5a, 0x5e, 0xf6, 0x26, 0x9a, 0x11, 0x61, 0xb0, 0x72, 0x14, 0x23, 0x1c, 0x12, 0xe4, 0x4a, 0xaa,
+         0xd9, 0xb1, 0xf9, 0xf2, 0xa8, 0x93, 0x2b, 0x1e, 0x52, 0x2e, 0x2b, 0x56, 0x42, 0x7e, 0x14, 0x18},
+        {0x77, 0xa0, 0xb6, 0x00, 0xee, 0xf1, 0xaf, 0x8c, 0x7f, 0xe1, 0x71, 0xcc, 0xd9, 0x23, 0x1c, 0x4f,
+         0x68, 0x34, 0x24, 0x59, 0x82, 0x8b, 0xf9, 0xaa, 0x84, 0x3f, 0xfd, 0xe5, 0x90, 0x83, 0x48, 0xcc,
+         0x72, 0x27, 0x50, 0xe8, 0xd4, 0x20, 0x81, 0x1f, 0x6c, 0x47, 0x05, 0x6a, 0x7c, 0x02, 0x7f, 0x4d,
+         0x45, 0x19, 0x85, 0x01, 0x4b, 0x6f, 0x69, 0xf2, 0xf4, 0x00, 0x9d, 0x37, 0xf7, 0x61, 0x1a, 0xf5},
+        {0x07, 0x2e, 0x29, 0xe2, 0x97, 0x88, 0x56, 0x33, 0x2c, 0xd7, 0xf4, 0xe4, 0x5a, 0xbb, 0xb6, 0xb4,
+         0xa7, 0x3d, 0x40, 0xb4, 0x09, 0x59, 0xbe, 0x60, 0xab, 0x79, 0xec, 0xa8, 0x22, 0x77, 0x77, 0xfb,
+         0x1a, 0xbc, 0x64, 0x45, 0x01, 0x2e, 0x31, 0x57, 0x56, 0x4f, 0x4f, 0x12, 0x67, 0xdf, 0x94, 0x89,
+         0xaf, 0x7c, 0x84, 0x13, 0x30, 0x9f, 0x96, 0x8b, 0xec, 0xcb, 0xb0, 0x81, 0x98, 0xa3, 0x6c, 0xd9},
+        {0x0a, 0xec, 0xf4, 0xe5, 0xa0, 0xc4, 0xc4, 0xda, 0x70, 0x99, 0x21, 0xa4, 0x4d, 0xca, 0x45, 0x96,
+         0x5f, 0x89, 0xa3, 0x21, 0x5b, 0xb5, 0x44, 0x5c, 0xf7, 0x2d, 0xdd, 0xf4, 0xad, 0xe5, 0x3a, 0x2c,
+         0x19, 0x30, 0x40, 0x20, 0xc0, 0x0e, 0x61, 0x69, 0x71, 0x2d, 0x60, 0x50, 0x73, 0x4b, 0xf5, 0xc5,
+         0x1b, 0xd0, 0xaf, 0x80, 0xb5, 0xba, 0x4a, 0x6a, 0x0b, 0xa0, 0x08, 0xe9, 0x65, 0x21, 0x68, 0x07}
+    },
+    {
+        {0x51, 0xf4, 0xff, 0x8c, 0x59, 0x9b, 0x1c, 0x96, 0xda, 0x82, 0x94, 0x15, 0x20, 0xa9, 0xf5, 0xab,
+         0xf4, 0xa3, 0x1e, 0xb8, 0xb8, 0x4f, 0xc9, 0x50, 0x56, 0x14, 0x5c, 0xeb, 0x3b, 0x57, 0x75, 0xd0,
+         0x35, 0xac, 0x95, 0x88, 0xd4, 0x6e, 0x41, 0xf3, 0xf6, 0xf9, 0x9a, 0xee, 0x38, 0x52, 0xee, 0xb4,
+         0xb1, 0x2e, 0x80, 0x78, 0x07, 0xd4, 0xbd, 0x1b, 0x7f, 0x84, 0x06, 0xb0, 0xd7, 0x86, 0x3a, 0xc1},
+        {0x56, 0x8d, 0xe6, 0x90, 0x13, 0x3c, 0xa6, 0x3f, 0x63, 0xc0, 0x81, 0x61, 0xd8, 0x52, 0x68, 0x2f,
+         0xa5, 0x69, 0x6c, 0x0e, 0xe6, 0x6b, 0xf8, 0xf3, 0xec, 0x72, 0x9b, 0x6a, 0x71, 0xbf, 0x97, 0x41,
+         0x4c, 0x48, 0x22, 0x09, 0x92, 0xe8, 0xe6, 0x47, 0x41, 0xdc, 0xdc, 0x43, 0x3a, 0x0e, 0x65, 0xb4,
+         0x3a, 0x5b, 0xae, 0x7f, 0x4d, 0x74, 0x3e, 0x3d, 0x1b, 0xfd, 0xb1, 0x23, 0x77, 0x30, 0x39, 0xe8},
+        {0x4f, 0x2f, 0x4b, 0x47, 0x7f, 0x6c, 0xa6, 0x32, 0x75, 0x09, 0x65, 0xa4, 0xf9, 0x7d, 0x96, 0x6f,
+         0x9b, 0xb1, 0xa9, 0xe6, 0xfa, 0xf0, 0x3f, 0x47, 0x9f, 0xb2, 0x06, 0xc8, 0xb5, 0x9f, 0x57, 0x85,
+         0x13, 0x11, 0x5f, 0x87, 0x3b, 0x8a, 0x84, 0x39, 0xa1, 0x6d, 0x32, 0x08, 0xa7, 0x04, 0x62, 0xc1,
+         0x6a, 0xe3, 0x85, 0x25, 0xc2, 0x3c, 0xcc, 0xf2, 0x54, 0x80, 0x26, 0x9d, 0x93, 0x59, 0xe9, 0x34},
+        {0x33, 0x42, 0xc4, 0x71, 0x7d, 0x55, 0x22, 0x1d, 0xef, 0x46, 0xb8, 0x9f, 0xdd, 0x23, 0x7c, 0xf4,
+         0xe9, 0x52, 0x81, 0x70, 0xf9, 0xb5, 0x24, 0xbc, 0x6e, 0x73, 0x0c, 0xc4, 0x66, 0x34, 0x03, 0xda,
+         0x50, 0x67, 0x6c, 0xdf, 0x00, 0xc9, 0x35, 0x36, 0x8d, 0x54, 0xcc, 0xf1, 0xfa, 0x7d, 0xd2, 0x67,
+         0x1c, 0xd7, 0xea, 0x46, 0x68, 0x6e, 0x61, 0xfc, 0xa4, 0x9d, 0xc6, 0xa8, 0x5b, 0x69, 0x37, 0xc5},
+        {0x28, 0x2a, 0x40, 0x09, 0x73, 0xb6, 0x4e, 0xd0, 0xa9, 0x30, 0x70, 0xfd, 0xba, 0x88, 0xd5, 0x99,
+         0xfa, 0x2f, 0xd0, 0x54, 0x1f, 0x48, 0xdf, 0x6e, 0x99, 0xfb, 0x0f, 0xb8, 0xf1, 0xec, 0xcc, 0xcb,
+         0x5a, 0x8a, 0x95, 0xd8, 0xce, 0xdd, 0xba, 0x93, 0x59, 0x5c, 0x9f, 0xe0, 0x1a, 0xc6, 0xbf, 0xcd,
+         0x9a, 0xce, 0xa0, 0xd1, 0xe0, 0xc3, 0x15, 0x0c, 0x7f, 0x56, 0x2d, 0xd2, 0x7a, 0xa8, 0x46, 0x86},
+        {0x7a, 0xaf, 0x48, 0xf5, 0x9f, 0x15, 0xc2, 0x0d, 0x43, 0xe5, 0xbc, 0xc0, 0xa9, 0xf0, 0xd5, 0x89,
+         0x52, 0xbb, 0x33, 0x8e, 0x81, 0x86, 0x37, 0x65, 0x20, 0xc2, 0x9d, 0x9e, 0xd2, 0x97, 0xdb, 0xd3,
+         0x27, 0x65, 0xba, 0x6a, 0x9e, 0x76, 0x63, 0x8c, 0x36, 0x14, 0x9c, 0x63, 0xbf, 0xe6, 0x2d, 0xe3,
+         0x8a, 0x8f, 0x0a, 0xc8, 0xe8, 0xe0, 0x93, 0x4d, 0xac, 0x69, 0x89, 0x6b, 0xf1, 0xa5, 0x8d, 0x6e},
+        {0x03, 0x36, 0x49, 0x8f, 0xbd, 0x2b, 0x43, 0x55, 0xce, 0x5f, 0x8c, 0x55, 0x89, 0x1b, 0x95, 0x91,
+         0x33, 0x74, 0x5f, 0x4c, 0xd4, 0x9f, 0x7c, 0x39, 0xbd, 0x4d, 0x97, 0x9b, 0xaa, 0x23, 0x29, 0xb4,
+         0x65, 0x33, 0x38, 0xb6, 0x16, 0x27, 0x9c, 0xe7, 0xe4, 0x4b, 0x1c, 0x37, 0x96, 0x9b, 0x10, 0x9f,
+         0xaf, 0xe0, 0xfd, 0x52, 0xff, 0xf4, 0x8d, 0x9a, 0xa1, 0xe0, 0x8a, 0x7c, 0x5d, 0xd5, 0xcb, 0xd8},
+        {0x33, 0x96, 0x97, 0x8b, 0xfc, 0x50, 0xb3, 0x3d, 0x58, 0xeb, 0x8d, 0xcc, 0xc5, 0x22, 0x01, 0xef,
+         0x36, 0xdf, 0xd2, 0x7b, 0x91, 0x4d, 0x8a, 0xa8, 0x6f, 0x6b, 0xa4, 0x5d, 0x29, 0x42, 0x4d, 0x9a,
+         0x5c, 0xcf, 0x13, 0x59, 0x11, 0x3c, 0x12, 0x7d, 0xcb, 0x9d, 0x35, 0xbf, 0x91, 0x07, 0xcc, 0xcb,
+         0x45, 0x3e, 0xac, 0x7c, 0xa7, 0xdd, 0xbd, 0xab, 0xb1, 0xd0, 0xca, 0x4a, 0xc8, 0x07, 0x33, 0x93}
+    },
+    {
+        {0x3f, 0xaa, 0x2a, 0x09, 0x3a, 0x19, 0xa0, 0x24, 0x24, 0xf6, 0x5a, 0x10, 0x95, 0x51, 0x01, 0xf4,
+         0xdc, 0x01, 0x5c, 0x43, 0xb2, 0xdf, 0xce, 0x8e, 0x00, 0x15, 0x07, 0xab, 0xd7, 0x41, 0xb8, 0x45,
+         0x7a, 0x1d, 0xe1, 0x0d, 0xac, 0xfd, 0xa3, 0x89, 0xca, 0x66, 0x3b, 0x15, 0x57, 0x4b, 0xdc, 0x8a,
+         0xe8, 0xc5, 0xb6, 0xe7, 0xce, 0xe6, 0x47, 0xe7, 0x7b, 0x11, 0xdd, 0xbf, 0xc6, 0xeb, 0x8e, 0xdc},
+        {0x30, 0xf9, 0xcd, 0x30, 0x76, 0xc5, 0x1c, 0x96, 0xa9, 0xba, 0xed, 0xa1, 0x0e, 0xc8, 0x93, 0x10,
+         0x5d, 0x92, 0x0f, 0x02, 0x29, 0x47, 0x71, 0x60, 0x64, 0xe3, 0x27, 0x17, 0xae, 0xe8, 0xe3, 0xc5,
+         0x2c, 0xae, 0xdf, 0xaa, 0x42, 0x01, 0x20, 0xc6, 0x71, 0x19, 0x21, 0x68, 0x4f, 0x9f, 0x5a, 0x2b,
+         0x80, 0x79, 0x04, 0x5f, 0xbf, 0x3a, 0x4e, 0xfd, 0x7e, 0x4f, 0xa7, 0xbc, 0x8c, 0xbd, 0xb0, 0x95},
+        {0x00, 0x44, 0xcf, 0x64, 0x89, 0x8e, 0xda, 0xe2, 0x59, 0x00, 0x19, 0xbd, 0x66, 0xb9, 0xf4, 0xf3,
+         0xde, 0x3c, 0x90, 0xa5, 0xca, 0xe6, 0x43, 0x89, 0xdf, 0x86, 0x49, 0x6b, 0x10, 0x83, 0xbc, 0x71,
+         0x63, 0xd5, 0x74, 0x2d, 0x68, 0x93, 0x5f, 0x7f, 0x4b, 0x1d, 0x2e, 0xb0, 0x9e, 0xc0, 0x1e, 0x28,
+         0xf2, 0xbf, 0xeb, 0x56, 0x70, 0xf7, 0x79, 0x6d, 0xa0, 0x66, 0xb1, 0x52, 0x9f, 0xc7, 0xe5, 0x1d},
+        {0x60, 0x70, 0x95, 0x1e, 0x96, 0xe6, 0x18, 0xbe, 0x7d, 0x75, 0x0f, 0xa8, 0x19, 0x59, 0x3e, 0xcb,
+         0xfe, 0x9c, 0x26, 0x97, 0x24, 0x71, 0xeb, 0xed, 0x72, 0xc0, 0x93, 0x71, 0x4b, 0x7e, 0x6e, 0x90,
+         0x7b, 0xb8, 0xb8, 0x08, 0x6b, 0x2c, 0x8f, 0x27, 0x38, 0x41, 0xde, 0x64, 0x28, 0x71, 0xdc, 0x22,
+         0xc7, 0xad, 0xb5, 0x19, 0x44, 0xd6, 0x43, 0x04, 0xc0, 0xfe, 0x5f, 0x4c, 0x1d, 0x3e, 0x66, 0x89},
+        {0x1c, 0x59, 0x13, 0x9b, 0xc8, 0x53, 0xc6, 0xfb, 0x3c, 0xa2, 0x9d, 0x2c, 0x71, 0x90, 0x71, 0xdb,
+         0xb4, 0xce, 0x4e, 0x11, 0xa0, 0xdc, 0xb6, 0x8f, 0xf9, 0x91, 0x9f, 0x7c, 0x2b, 0x60, 0xd1, 0x52,
+         0x27, 0x8d, 0x3a, 0xb8, 0x50, 0x4c, 0xc6, 0xef, 0x60, 0x3f, 0x4a, 0x31, 0xdd, 0x50, 0xfd, 0x34,
+         0x36, 0x61, 0x5c, 0x7a, 0xe7, 0x15, 0x75, 0xa8, 0x16, 0x03, 0x1f, 0x01, 0xde, 0xd3, 0x7e, 0x33},
+        {0x0e, 0x8e, 0x01, 0x36, 0x76, 0x83, 0x1c, 0x14, 0xb9, 0xf5, 0xc6, 0xb4, 0x5d, 0x0f, 0x6a, 0xed,
+         0x3b, 0x0d, 0x83, 0x3d, 0xde, 0x62, 0xde, 0x60, 0x01, 0xea, 0x66, 0x28, 0xaa, 0xd1, 0x11, 0x2f,
+         0x43, 0xa1, 0x50, 0xe8, 0xa8, 0x45, 0x64, 0x6a, 0x46, 0x5a, 0x67, 0xba, 0x7d, 0xc7, 0x2f, 0x45,
+         0xfa, 0x10, 0x18, 0x4e, 0x94, 0x2e, 0xc9, 0x02, 0xf1, 0xd9, 0x56, 0x8e, 0x73, 0x9f, 0x6a, 0xc7},
+        {0x25, 0x65, 0x53, 0xa8, 0xf6, 0x11, 0x0c, 0x76, 0x25, 0x40, 0x2e, 0xb1, 0x9a, 0xc8, 0x12, 0xa5,
+         0xe2, 0xdd, 0x4e, 0xb3, 0x3d, 0xfd, 0x81, 0xf3, 0xf3, 0x11, 0xaa, 0x4c, 0x25, 0x65, 0xb6, 0x95,
+         0x35, 0xeb, 0x4e, 0x4e, 0xb9, 0xbb, 0xf4, 0x41, 0x67, 0x34, 0x60, 0xe5, 0x68, 0xb0, 0x3d, 0x58,
+         0x73, 0x0a, 0x62, 0x94, 0x59, 0xae, 0x64, 0xd1, 0xb5, 0x6f, 0x97, 0xa0, 0xca, 0x1e, 0x74, 0xd6},
+        {0x1e, 0xc0, 0xeb, 0x04, 0x01, 0x64, 0xdd, 0x81, 0xf5, 0x7e, 0xbc, 0x3a, 0x26, 0xc3, 0xe8, 0x60,
+         0x61, 0x54, 0x30, 0x3a, 0x1e, 0x5d, 0xe3, 0xaf, 0x27, 0xb1, 0xaf, 0xd9, 0x9d, 0x27, 0x70, 0x3d,
+         0x3d, 0xf6, 0x2c, 0x38, 0xb3, 0x07, 0x7c, 0x69, 0x42, 0x68, 0xed, 0x7a, 0xae, 0x9a, 0x33, 0x29,
+         0x99, 0x9e, 0x19, 0x0e, 0xb8, 0x1f, 0x07, 0x32, 0x6e, 0x5c, 0xc3, 0xa1, 0xd1, 0xa4, 0x2c, 0xda}
+    },
+    {
+        {0x19, 0x24, 0x41, 0x69, 0x56, 0xea, 0x2c, 0x12, 0x69, 0x06, 0x25, 0x88, 0x56, 0x9b, 0x18, 0x17,
+         0x80, 0x11, 0xea, 0x7c, 0xba, 0x1a, 0x32, 0x66, 0x28, 0x4f, 0x48, 0xaa, 0x01, 0xd5, 0xa9, 0x0f,
+         0x0c, 0x8e, 0x28, 0x12, 0x7b, 0x7d, 0xcd, 0xd2, 0x06, 0xfb, 0x6f, 0xee, 0x96, 0xeb, 0x88, 0xcf,
+         0xc7, 0xdb, 0x73, 0x19, 0x82, 0x6a, 0xc8, 0xcd, 0xb8, 0xb1, 0xfb, 0x8a, 0xda, 0xf0, 0x21, 0xde},
+        {0x28, 0x98, 0xff, 0xaa, 0xb6, 0x63, 0xed, 0x49, 0xec, 0x57, 0x03, 0x8c, 0xec, 0xd8, 0x98, 0xfb,
+         0x84, 0x07, 0x6b, 0xf4, 0x9b, 0xf6, 0xf5, 0xc4, 0x40, 0x3a, 0xff, 0x28, 0xce, 0x97, 0x44, 0x93,
+         0x09, 0x4f, 0x3b, 0x96, 0xab, 0x6c, 0x94, 0x77, 0xe7, 0x59, 0xd6, 0xbc, 0xb9, 0x93, 0x45, 0x57,
+         0xe6, 0x13, 0xa0, 0xf4, 0xfa, 0x4f, 0xb6, 0xc6, 0xf4, 0xb3, 0xbc, 0x46, 0xf3, 0x35, 0x16, 0x3d},
+        {0x59, 0xde, 0x4b, 0x23, 0x05, 0xd8, 0xb7, 0xaf, 0x6d, 0xa1, 0x76, 0x9d, 0x1b, 0x27, 0x47, 0x3c,
+         0xa5, 0xce, 0xd8, 0xb8, 0x4b, 0x82, 0xa5, 0x4c, 0xeb, 0xfe, 0xd2, 0xe9, 0x8c, 0x19, 0xa7, 0x6a,
+         0x40, 0x78, 0xb0, 0x87, 0x5c, 0xe1, 0x49, 0x84, 0x4f, 0xe1, 0xa6, 0x46, 0x2d, 0xec, 0xa6, 0xe4,
+         0x31, 0x6b, 0xe1, 0x25, 0x9c, 0x17, 0x26, 0xe9, 0x44, 0x77, 0xe2, 0xf9, 0xf1, 0xdb, 0xe4, 0xd5},
+        {0x34, 0xe2, 0xdd, 0xf5, 0x11, 0x57, 0x01, 0x10, 0x5d, 0x5d, 0x59, 0x0f, 0x66, 0x17, 0xcc, 0xd7,
+         0x71, 0x6c, 0x01, 0xb2, 0x47, 0x94, 0x84, 0x70, 0xc1, 0x51, 0x4f, 0x12, 0x01, 0x6b, 0xf7, 0x5a,
+         0x1b, 0xda, 0xea, 0x88, 0xb7, 0x8e, 0xb7, 0x17, 0x77, 0x55, 0x8f, 0x74, 0x52, 0xcd, 0x86, 0x8e,
+         0x6d, 0x7f, 0xc3, 0x3a, 0x0f, 0x85, 0xc3, 0xd2, 0x03, 0x8b, 0xac, 0x58, 0x5c, 0x1f, 0xd9, 0x26},
+        {0x55, 0xea, 0xf5, 0xfe, 0xa1, 0x01, 0xc9, 0x4f, 0xc2, 0xb9, 0x23, 0x4f, 0x2b, 0x62, 0xc5, 0x78,
+         0x60, 0x56, 0xbf, 0xa6, 0xbc, 0x8a, 0x23, 0xe5, 0x99, 0x79, 0xb3, 0x03, 0xea, 0xac, 0x5b, 0x05,
+         0x64, 0x4f, 0x4f, 0x10, 0xc2, 0xa1, 0x3c, 0x7e, 0x31, 0x2a, 0x68, 0x92, 0x74, 0x84, 0xd2, 0x04,
+         0x1c, 0xf6, 0x2a, 0x6b, 0x2e, 0x57, 0x9f, 0xfb, 0x29, 0x1e, 0x32, 0xfc, 0x1e, 0x0e, 0x6d, 0x82},
+        {0x57, 0x26, 0xe2, 0xad, 0xc5, 0xbb, 0xdb, 0xf0, 0xcc, 0x76, 0x25, 0x0d, 0x1c, 0x69, 0xed, 0x6f,
+         0x77, 0xf9, 0x6d, 0x07, 0x5a, 0x84, 0x61, 0x6a, 0x35, 0x79, 0x20, 0x93, 0x40, 0x0e, 0xea, 0xb6,
+         0x79, 0x73, 0x5f, 0x15, 0x5f, 0xd9, 0x2f, 0x05, 0x89, 0x0e, 0xf8, 0xf0, 0xd6, 0xef, 0x86, 0x5e,
+         0x84, 0x98, 0xa9, 0x50, 0xd9, 0xa9, 0x3c, 0xd1, 0x27, 0xed, 0x7d, 0x96, 0x6b, 0x0e, 0xe8, 0xcf},
+        {0x2f, 0xab, 0x75, 0x84, 0xf9, 0xeb, 0xaf, 0xa1, 0x44, 0x80, 0x3f, 0x10, 0xde, 0x98, 0x1a, 0xdb,
+         0xfd, 0xce, 0x1f, 0x5e, 0xb9, 0x7c, 0x95, 0xd2, 0x99, 0x27, 0xc6, 0xb6, 0x74, 0xfd, 0x19, 0x63,
+         0x27, 0xb7, 0x02, 0x48, 0xf4, 0x15, 0xf4, 0x48, 0xda, 0xf4, 0x4f, 0x5a, 0xb0, 0xb2, 0x37, 0x64,
+         0x52, 0x18, 0xee, 0x69, 0x8b, 0x29, 0x65, 0x2b, 0xcf, 0x59, 0xda, 0x26, 0x98, 0xc7, 0xf9, 0x81},
+        {0x4c, 0xb5, 0x6b, 0xd8, 0x3d, 0x7b, 0xb2, 0x55, 0x58, 0xc3, 0x4e, 0xce, 0x98, 0xdd, 0x87, 0x8c,
+         0xa5, 0xfe, 0x85, 0x0a, 0xa7, 0x9f, 0x4b, 0xf6, 0x56, 0x26, 0x9f, 0xed, 0xfe, 0x16, 0x5c, 0xc8,
+         0x5d, 0x1f, 0x6f, 0xb4, 0x63, 0x25, 0x19, 0x14, 0x53, 0x5b, 0xd8, 0x1a, 0x9f, 0x9a, 0x8a, 0xea,
+         0x4d, 0x5e, 0xa5, 0x30, 0x9b, 0x86, 0xc4, 0xeb, 0x8f, 0xb4, 0xa7, 0xfa, 0x15, 0xa0, 0x38, 0x65}
+    },
+    {
+        {0x49, 0x76, 0x1c, 0x57, 0xce, 0x3c, 0x8c, 0x4f, 0x14, 0x35, 0xd4, 0x95, 0x90, 0x3e, 0x2f, 0x53,
+         0x6f, 0x3b, 0xe3, 0x71, 0x2e, 0x76, 0xaf, 0x8d, 0x0b, 0x5a, 0x8b, 0x7d, 0x1e, 0xbc, 0x8f, 0xac,
+         0x32, 0x25, 0x03, 0x5e, 0x10, 0x65, 0x09, 0x4e, 0xf3, 0x2d, 0x7f, 0x3e, 0x7a, 0x6f, 0x8f, 0xf2,
+         0x74, 0x80, 0x25, 0xf9, 0x6e, 0x0c, 0x0b, 0x44, 0xeb, 0x35, 0x57, 0x6b, 0x61, 0xe1, 0x50, 0xa8},
+        {0x65, 0x4b, 0x39, 0xf4, 0x65, 0x08, 0x04, 0xbf, 0xb7, 0xc7, 0x6a, 0x3d, 0x25, 0x43, 0x77, 0x05,
+         0x00, 0x02, 0x24, 0x0e, 0x2f, 0x79, 0x4f, 0x8d, 0xe2, 0x1d, 0xe5, 0x64, 0x0f, 0xdc, 0x60, 0xa9,
+         0x50, 0xce, 0x7b, 0xe2, 0xf1, 0x01, 0x12, 0x18, 0x84, 0x9a, 0x34, 0xce, 0x62, 0x65, 0x44, 0x14,
+         0xa8, 0xdc, 0xae, 0xa8, 0xb4, 0xdb, 0x9b, 0x45, 0xdc, 0xe3, 0xb7, 0x6a, 0x6b, 0x12, 0x19, 0x96},
+        {0x34, 0x21, 0x93, 0x55, 0xb9, 0xa2, 0x90, 0xfd, 0x59, 0x91, 0x88, 0x30, 0xf0, 0x5b, 0xf6, 0x32,
+         0xf0, 0x60, 0xa3, 0xbd, 0x57, 0x82, 0xd8, 0x18, 0xb7, 0x01, 0x47, 0x1b, 0x53, 0x30, 0x21, 0x41,
+         0x51, 0x4b, 0xff, 0x4e, 0x80, 0x6a, 0xb6, 0x90, 0x52, 0x90, 0xc8, 0x30, 0x1d, 0x1c, 0x99, 0xa8,
+         0x00, 0x82, 0x63, 0xec, 0x29, 0x6b, 0xe8, 0x73, 0xd6, 0x6e, 0xf9, 0x6a, 0xeb, 0x9e, 0x67, 0x97},
+        {0x09, 0x16, 0x05, 0xb3, 0x38, 0xea, 0x1b, 0xd9, 0x8b, 0xdf, 0xae, 0x06, 0xba, 0x25, 0xbd, 0x54,
+         0x05, 0x25, 0xa3, 0xb0, 0x2e, 0xfa, 0x65, 0xdf, 0x30, 0xde, 0x5c, 0x6e, 0x8c, 0x63, 0x7d, 0x0f,
+         0x1d, 0xf4, 0x05, 0x52, 0x1e, 0x9a, 0x22, 0x32, 0xba, 0xf6, 0x54, 0xaa, 0x3d, 0x2f, 0x66, 0xbd,
+         0xd6, 0xd5, 0x7f, 0xd5, 0xba, 0xc9, 0x6f, 0x5a, 0xa5, 0xf8, 0xad, 0x28, 0x64, 0xbf, 0x8c, 0xc7},
+        {0x10, 0xfb, 0xdc, 0x33, 0xaf, 0xf0, 0xa0, 0xa1, 0x5b, 0x01, 0x5d, 0xf9, 0x33, 0x37, 0x2a, 0x78,
+         0x80, 0x7d, 0xdb, 0x57, 0x58, 0x15, 0x34, 0x7e, 0xd2, 0x93, 0xf1, 0x74, 0xcf, 0xe8, 0x52, 0x41,
+         0x03, 0xb7, 0x99, 0x14, 0xce, 0xc4, 0x3e, 0x62, 0xe5, 0x64, 0xc5, 0x38, 0xb9, 0x69, 0x18, 0x4b,
+         0xe4, 0xfe, 0x1f, 0x9b, 0x27, 0x29, 0x1f, 0x77, 0x6e, 0x33, 0x18, 0x69, 0xf0, 0x8e, 0x72, 0x5e},
+        {0x6f, 0x2f, 0x32, 0x69, 0x99, 0x1f, 0x14, 0xef, 0xf0, 0x6f, 0x7f, 0x94, 0xc9, 0x3d, 0x70, 0x7b,
+         0xd4, 0xee, 0xca, 0xf9, 0x49, 0x56, 0x96, 0xd7, 0x4c, 0x46, 0x5d, 0x22, 0x74, 0xcc, 0xc8, 0x19,
+         0x79, 0x7c, 0xb6, 0xda, 0xa4, 0xeb, 0x60, 0x44, 0xd7, 0xa7, 0xaf, 0x35, 0x08, 0x13, 0xd7, 0xef,
+         0x75, 0xf8, 0xf7, 0x87, 0xfb, 0xe7, 0x5e, 0x53, 0x2d, 0xb6, 0xc4, 0xaa, 0x4c, 0xe6, 0x1a, 0x13},
+        {0x49, 0x5f, 0xc2, 0xc0, 0x75, 0xbd, 0x1a, 0x86, 0xbf, 0x87, 0xe6, 0x88, 0xf1, 0x2c, 0xd9, 0xd6,
+         0x87, 0xe4, 0xfc, 0x27, 0xfb, 0x53, 0x61, 0xdc, 0x50, 0xd0, 0x29, 0x49, 0x8e, 0x89, 0x5b, 0x32,
+         0x48, 0xd8, 0xf2, 0x5d, 0x9c, 0x57, 0x0d, 0xb8, 0x54, 0xd6, 0x4d, 0xb0, 0xa2, 0x51, 0x1e, 0x56,
+         0xd2, 0xbe, 0xf7, 0x85, 0x0a, 0x02, 0x58, 0xd9, 0x53, 0xb5, 0xa3, 0x8b, 0xab, 0x5b, 0x91, 0xad},
+        {0x46, 0x06, 0xfd, 0xec, 0x56, 0xd4, 0x69, 0x70, 0x93, 0x8a, 0x8f, 0x9f, 0xa5, 0xf2, 0x46, 0x24,
+         0xf5, 0xb9, 0xc6, 0xf4, 0x88, 0xb7, 0x2c, 0xb1, 0xfc, 0x87, 0xe4, 0xfe, 0xeb, 0xbb, 0x1f, 0xaa,
+         0x0f, 0x00, 0xd9, 0xe6, 0x65, 0x6d, 0x82, 0x43, 0xe0, 0x35, 0x0f, 0xa5, 0xb8, 0x9b, 0xee, 0xfa,
+         0x58, 0xe9, 0xaf, 0x95, 0x5e, 0xd6, 0x50, 0xa6, 0xd9, 0x0c, 0xce, 0x34, 0x4e, 0xcf, 0x66, 0x4e}
+    },
+    {
+        {0x43, 0x39, 0xfa, 0x86, 0xa2, 0x32, 0x42, 0x85, 0x1a, 0x16, 0xaf, 0xc3, 0xab, 0x05, 0xb3, 0x52,
+         0xa7, 0xb4, 0xbf, 0x53, 0x59, 0x9a, 0x49, 0xdd, 0x7e, 0x29, 0xd3, 0x64, 0xfc, 0x3a, 0x75, 0x7b,
+         0x6d, 0x07, 0xcc, 0x34, 0x62, 0xba, 0xe9, 0x16, 0x0b, 0xbe, 0xbb, 0x99, 0x75, 0x10, 0x81, 0x70,
+         0x40, 0x76, 0x7f, 0xaa, 0x9d, 0xbd, 0x13, 0xf1, 0x58, 0xa5, 0xfe, 0x8a, 0x63, 0xa3, 0x4b, 0x0e},
+        {0x62, 0x33, 0x2e, 0xe4, 0xf8, 0xee, 0x5e, 0x56, 0x39, 0x8d, 0xd3, 0x04, 0xec, 0xa6, 0xff, 0xbc,
+         0xde, 0x55, 0x64, 0x67, 0xba, 0x2c, 0x0d, 0x5f, 0xab, 0xb6, 0x4e, 0x97, 0x36, 0xc7, 0x01, 0xeb,
+         0x3e, 0x1b, 0xfb, 0x3c, 0x02, 0x18, 0xcf, 0x9f, 0x7e, 0x6a, 0x2f, 0x47, 0xf1, 0x79, 0xf2, 0x9b,
+         0x0a, 0xd6, 0x82, 0x35, 0x92, 0x9b, 0x49, 0x21, 0xfd, 0xa7, 0x4b, 0xc8, 0x9f, 0xb8, 0xef, 0x65},
+        {0x33, 0x28, 0x7c, 0xd3, 0xc5, 0x7f, 0x3d, 0xcd, 0x48, 0x5f, 0xeb, 0x01, 0x91, 0x77, 0xd1, 0xe9,
+         0x69, 0x76, 0xc6, 0x19, 0x39, 0x5d, 0x27, 0x32, 0x6d, 0x1a, 0x39, 0x6a, 0xef, 0x81, 0x07, 0x69,
+         0x70, 0xf3, 0xe2, 0xbe, 0x18, 0x82, 0x48, 0x9b, 0x31, 0x26, 0xff, 0x2b, 0xf7, 0x2c, 0xf7, 0x4c,
+         0x5f, 0x70, 0x35, 0x8f, 0x56, 0x33, 0x29, 0x9e, 0xac, 0x14, 0x6f, 0xea, 0x1c, 0x37, 0x1c, 0xde},
+        {0x7b, 0x9e, 0x00, 0x81, 0xb2, 0xe2, 0x0f, 0x4f, 0x3d, 0x3f, 0x6d, 0x57, 0xf7, 0xbf, 0x97, 0x7b,
+         0x2f, 0x19, 0x21, 0x42, 0xa2, 0xa9, 0xe4, 0x0b, 0x1a, 0xac, 0xd1, 0x51, 0x40, 0xc8, 0x8b, 0x2f,
+         0x09, 0x38, 0x54, 0x71, 0x6e, 0xf9, 0x79, 0x4d, 0x20, 0x57, 0x03, 0x6f, 0xf3, 0xf9, 0x7d, 0xa6,
+         0x86, 0xfa, 0x3a, 0x17, 0x84, 0xc4, 0x22, 0x79, 0xe8, 0xab, 0xf1, 0xfc, 0xc4, 0x2b, 0x85, 0x8c},
+        {0x1c, 0x70, 0x92, 0x7a, 0xa3, 0x06, 0xea, 0xf5, 0x87, 0xc3, 0xca, 0x6f, 0xc2, 0xd4, 0xc6, 0xf0,
+         0x2a, 0xf2, 0x11, 0x9e, 0x03, 0x12, 0x96, 0x31, 0x18, 0x0e, 0x4d, 0x47, 0xa7, 0xc2, 0xe5, 0x5b,
+         0x2e, 0x25, 0x9e, 0xc7, 0x80, 0xda, 0x03, 0x3e, 0x55, 0xc0, 0xba, 0xf4, 0xc3, 0xb4, 0xd8, 0x02,
+         0x68, 0xe8, 0x70, 0xd2, 0x6e, 0x6e, 0xb1, 0xc1, 0x0c, 0xb5, 0x65, 0x4a, 0x07, 0x74, 0x44, 0xf0},
+        {0x1e, 0x22, 0xf8, 0xe8, 0x55, 0x1e, 0xae, 0xa8, 0x3b, 0x68, 0x9b, 0x62, 0x6a, 0xc0, 0x89, 0x59,
+         0x5e, 0xb5, 0xff, 0x9c, 0x9b, 0xfb, 0x4c, 0x3c, 0x44, 0xe1, 0x49, 0x89, 0xf1, 0x3c, 0x72, 0xec,
+         0x12, 0x1f, 0xd5, 0xfd, 0x0c, 0x3a, 0xb0, 0x8f, 0x0d, 0x82, 0xa5, 0x39, 0x87, 0xaa, 0xc6, 0x4d,
+         0x85, 0xa0, 0x71, 0xf3, 0x2e, 0xf0, 0xd6, 0xda, 0xec, 0x01, 0x17, 0xe4, 0xd3, 0x60, 0x98, 0x83},
+        {0x62, 0x37, 0xe9, 0x36, 0x47, 0xe5, 0xe7, 0x84, 0x10, 0x24, 0x27, 0x17, 0x1f, 0x6a, 0xac, 0xe9,
+         0x27, 0x05, 0x84, 0x07, 0x22, 0x24, 0x66, 0x1a, 0x32, 0x60, 0x62, 0xa4, 0x11, 0x18, 0xf9, 0x1a,
+         0x43, 0x8c, 0x3c, 0xaf, 0x8e, 0x40, 0x4f, 0x0c, 0x55, 0xd8, 0x17, 0x94, 0x82, 0x30, 0xe5, 0x04,
+         0xbe, 0x55, 0x87, 0x2b, 0x05, 0x6d, 0x36, 0xc7, 0x97, 0x5d, 0x16, 0x52, 0x45, 0xf5, 0xb2, 0xfb},
+        {0x7e, 0xcf, 0xa6, 0xb2, 0x15, 0x26, 0x52, 0x91, 0xf3, 0x2d, 0x21, 0x77, 0x1e, 0x88, 0x69, 0x9a,
+         0xac, 0x31, 0x33, 0xfd, 0xb9, 0x3e, 0xf3, 0xa4, 0x79, 0xf9, 0x5e, 0x2f, 0xa8, 0x74, 0x29, 0x40,
+         0x10, 0x95, 0x8b, 0x5c, 0xda, 0xf3, 0x6a, 0xfe, 0x55, 0x7b, 0x7e, 0x60, 0x18, 0x42, 0x07, 0xce,
+         0x6d, 0x81, 0x88, 0x3e, 0xdf, 0x03, 0x5b, 0xea, 0x63, 0xcb, 0x7d, 0xa4, 0x6c, 0x47, 0x20, 0xc6}
+    },
+    {
+        {0x6b, 0xda, 0x13, 0x91, 0x8d, 0xcb, 0xaf, 0x85, 0x29, 0xd6, 0x32, 0x6a, 0xe7, 0xa9, 0xc2, 0x78,
+         0xb7, 0x24, 0x17, 0xc2, 0x18, 0x8c, 0x5e, 0xa4, 0xf0, 0x62, 0xfc, 0x50, 0x63, 0x92, 0x95, 0xfb,
+         0x2c, 0x3f, 0xa8, 0x03, 0xb1, 0x62, 0xee, 0x88, 0x7d, 0x0d, 0x97, 0xa6, 0x73, 0x48, 0x66, 0xf9,
+         0x92, 0xf8, 0x46, 0x62, 0x5f, 0x31, 0x41, 0x17, 0x07, 0x5d, 0xa5, 0x4b, 0xb6, 0xc2, 0x0a, 0x36},
+        {0x19, 0xaf, 0x95, 0x6d, 0x2b, 0x5b, 0x4a, 0xc2, 0x8b, 0x0c, 0x67, 0x88, 0x9f, 0x19, 0xad, 0x66,
+         0xa4, 0x0f, 0x4b, 0xca, 0x16, 0x25, 0xe2, 0x00, 0x79, 0x63, 0xe8, 0xa9, 0x8a, 0x70, 0xb1, 0x4a,
+         0x5e, 0x22, 0x8b, 0xb5, 0xfb, 0xae, 0x68, 0x77, 0x54, 0x30, 0x72, 0x87, 0x83, 0x3c, 0x32, 0x45,
+         0xa1, 0xab, 0x34, 0x68, 0x4a, 0x5a, 0x69, 0x17, 0x4f, 0x72, 0xb4, 0x60, 0xcc, 0xb6, 0x9d, 0x8b},
+        {0x7d, 0xc0, 0xf9, 0x40, 0xa4, 0xca, 0x84, 0xf9, 0x0c, 0x1f, 0x32, 0xa6, 0x44, 0x81, 0x80, 0x11,
+         0xf2, 0x85, 0x84, 0xbc, 0x0a, 0xde, 0xca, 0x9c, 0x8d, 0x35, 0xbe, 0xd7, 0x4d, 0x87, 0x3f, 0xa2,
+         0x20, 0x2a, 0x28, 0x36, 0x39, 0x0d, 0x43, 0xd8, 0x9d, 0xe6, 0xf3, 0x40, 0x5d, 0xb6, 0xdc, 0xe0,
+         0xac, 0x61, 0x96, 0x3a, 0xc0, 0xd2, 0xcc, 0x54, 0x0d, 0x1b, 0xcc, 0x63, 0x37, 0xff, 0xb9, 0x0a},
+        {0x45, 0xbf, 0x32, 0x29, 0x97, 0xc4, 0x46, 0x9a, 0xac, 0x6d, 0x1e, 0x42, 0x51, 0xfb, 0x34, 0x90,
+         0xe6, 0x0e, 0x7c, 0x0c, 0xd5, 0xcd, 0xd6, 0xf5, 0xcf, 0xb9, 0xbb, 0xc5, 0x35, 0x87, 0xb9, 0xf1,
+         0x52, 0x9d, 0x88, 0x48, 0x84, 0x07, 0x57, 0x53, 0xfd, 0x9a, 0x2f, 0x9b, 0xa0, 0x21, 0xff, 0x42,
+         0x7f, 0xea, 0x7b, 0x97, 0x73, 0xf0, 0xd4, 0x88, 0x5d, 0xa5, 0xed, 0xc0, 0x24, 0xc6, 0x9e, 0x66},
+        {0x33, 0x30, 0x66, 0x9d, 0x9c, 0x50, 0xd5, 0xcd, 0x1e, 0xa2, 0xc6, 0xf8, 0x02, 0x06, 0xf8, 0x8e,
+         0xfc, 0x31, 0xdb, 0x49, 0x88, 0x2e, 0x8e, 0x7c, 0x78, 0x87, 0x9c, 0x2d, 0xdc, 0x90, 0xec, 0xc1,
+         0x47, 0x2f, 0x41, 0xdb, 0xae, 0x44, 0x12, 0xc9, 0xd8, 0xa2, 0xf5, 0xd0, 0xc3, 0xf1, 0xf2, 0x17,
+         0x4a, 0x2f, 0x83, 0x82, 0x73, 0x3b, 0x66, 0x2b, 0x97, 0x25, 0x93, 0x89, 0xd4, 0x12, 0x53, 0x6e},
+        {0x06, 0x7c, 0x72, 0x89, 0xe5, 0x84, 0x0c, 0xfa, 0x29, 0x3e, 0xa2, 0x35, 0x2f, 0xc8, 0x5e, 0x42,
+         0xc2, 0x21, 0xc0, 0xf2, 0xcf, 0x1a, 0xf4, 0x3d, 0x94, 0xaf, 0x06, 0x2a, 0x34, 0x48, 0x96, 0xc6,
+         0x34, 0x11, 0x13, 0xf4, 0x8b, 0x7b, 0x5c, 0xe6, 0xf5, 0xb5, 0xbe, 0xf9, 0x4d, 0x4b, 0x14, 0x5d,
+         0x8b, 0x56, 0x22, 0xfe, 0xeb, 0xca, 0x8e, 0x5b, 0xb3, 0x6e, 0xa6, 0x89, 0xe5, 0x03, 0x65, 0x32},
+        {0x11, 0x42, 0x9e, 0x2f, 0x0b, 0x19, 0xd6, 0x70, 0x0f, 0xa4, 0x8c, 0xa0, 0xf8, 0x30, 0xe0, 0x86,
+         0x29, 0xd1, 0xe3, 0x18, 0x8b, 0x42, 0x7a, 0xbc, 0xba, 0x59, 0x50, 0x26, 0xc3, 0x59, 0xe2, 0x53,
+         0x0e, 0xca, 0xaf, 0x5d, 0x58, 0x3e, 0x9d, 0x06, 0x23, 0xdb, 0x06, 0x5a, 0xe8, 0x65, 0xca, 0x22,
+         0x79, 0x22, 0xe4, 0xb7, 0xb4, 0x87, 0x8c, 0x5b, 0xc8, 0x62, 0x6d, 0x85, 0xa4, 0xf1, 0xab, 0x90},
+        {0x39, 0x63, 0x22, 0x28, 0xd7, 0xd1, 0x47, 0x18, 0x00, 0xe5, 0x49, 0x12, 0x8f, 0x91, 0xa6, 0x80,
+         0xc9, 0xa6, 0x4e, 0x37, 0xae, 0x27, 0xd9, 0x19, 0xa2, 0x60, 0x9c, 0xe2, 0x15, 0x22, 0xc6, 0x07,
+         0x6f, 0x59, 0x55, 0x7c, 0xab, 0xbd, 0x86, 0xe8, 0xe4, 0xd5, 0x46, 0xe2, 0xaa, 0xe6, 0xac, 0x26,
+         0xb2, 0x7b, 0x67, 0x1e, 0xbd, 0x04, 0x95, 0x39, 0x99, 0x1e, 0x9e, 0xf2, 0x7e, 0x00, 0xe2, 0xe8}
+    },
+    {
+        {0x4d, 0xa4, 0x82, 0x13, 0x14, 0x57, 0x4d, 0x4f, 0xed, 0x4d, 0xcf, 0x69, 0x2c, 0x8b, 0x15, 0xb9,
+         0x9b, 0x73, 0xf1, 0x36, 0x33, 0x21, 0x03, 0x33, 0xce, 0x78, 0x71, 0x35, 0x9b, 0x6e, 0x64, 0x24,
+         0x31, 0x40, 0x16, 0x03, 0x46, 0x73, 0xd2, 0xd2, 0x05, 0x29, 0xbc, 0x93, 0xa2, 0xda, 0xb6, 0xe4,
+         0x62, 0xbc, 0xb5, 0xf6, 0x6e, 0x1f, 0x4a, 0x6b, 0xf2, 0x17, 0x07, 0x59, 0xa4, 0x0a, 0x6e, 0x65},
+        {0x22, 0x42, 0x3c, 0xb8, 0xe8, 0x21, 0x29, 0xda, 0x66, 0x55, 0xd9, 0x43, 0x54, 0x18, 0x1f, 0xeb,
+         0x5b, 0x1c, 0x78, 0x98, 0x06, 0x24, 0x0b, 0x13, 0x5c, 0x4d, 0xa1, 0xbd, 0x15, 0x6d, 0x73, 0x4c,
+         0x62, 0x7d, 0xcf, 0x9b, 0xe9, 0xbe, 0x79, 0x8e, 0xb6, 0x39, 0xf6, 0xb7, 0x76, 0xce, 0x9e, 0xf3,
+         0x45, 0x73, 0xc7, 0xa7, 0xf1, 0xd1, 0xed, 0x22, 0x0b, 0x1a, 0x23, 0x15, 0x6f, 0x08, 0xcd, 0xb4},
+        {0x32, 0xbe, 0xb4, 0xe3, 0x64, 0x11, 0xf5, 0x3e, 0x32, 0x4d, 0xdb, 0xd9, 0x20, 0xd4, 0x2b, 0xd4,
+         0x03, 0xe9, 0x3f, 0x61, 0xe3, 0x95, 0x7c, 0xa6, 0xfd, 0xf1, 0xba, 0xfd, 0x72, 0xfc, 0x5b, 0x92,
+         0x42, 0x5a, 0x36, 0x15, 0x7c, 0x40, 0xb8, 0x50, 0x3c, 0xb9, 0xa0, 0xe6, 0x1a, 0xda, 0x13, 0x59,
+         0xe9, 0xa6, 0xc4, 0x3b, 0xd0, 0x39, 0x2d, 0x6a, 0xa5, 0x10, 0x1f, 0xc9, 0xe7, 0x90, 0x17, 0x86},
+        {0x04, 0x23, 0x02, 0x53, 0xb9, 0x46, 0xf9, 0xc1, 0x76, 0xea, 0x49, 0xe7, 0xfe, 0x2b, 0x91, 0x3a,
+         0x35, 0x73, 0x89, 0x99, 0x75, 0x0b, 0x1e, 0x21, 0x55, 0x51, 0x04, 0xdc, 0xab, 0x32, 0x0b, 0xb4,
+         0x04, 0xdb, 0x9d, 0xd9, 0x2f, 0x8d, 0x93, 0x9e, 0x6e, 0x4d, 0x0b, 0x02, 0x45, 0xef, 0x57, 0xa6,
+         0x2d, 0x79, 0x3b, 0x17, 0x3e, 0x97, 0x7b, 0x8f, 0xa6, 0x95, 0x58, 0x74, 0x1d, 0x1e, 0x5a, 0xfc},
+        {0x65, 0xf7, 0x11, 0x80, 0x7e, 0x58, 0x86, 0x6d, 0xef, 0xe3, 0x42, 0x36, 0x11, 0xcc, 0xa2, 0x54,
+         0xbf, 0x43, 0x82, 0xfb, 0x1e, 0x50, 0xe5, 0x4f, 0x50, 0x83, 0x3c, 0x62, 0xb3, 0x5f, 0x9f, 0x4f,
+         0x06, 0x6f, 0x79, 0xcc, 0xc6, 0x8c, 0x4d, 0x22, 0x25, 0x42, 0x31, 0x5a, 0xbe, 0x14, 0x8d, 0x5f,
+         0xa5, 0x7f, 0x5a, 0xd3, 0xd0, 0xb2, 0x73, 0x3f, 0xd3, 0x56, 0x16, 0xd7, 0xf9, 0xd9, 0x63, 0x7a},
+        {0x11, 0x5b, 0x21, 0x7e, 0xa5, 0x05, 0x82, 0x47, 0xe8, 0x84, 0xbd, 0xc6, 0xa1, 0x16, 0x28, 0xb6,
+         0xb2, 0x12, 0x2a, 0x72, 0x49, 0xab, 0xd7, 0xf6, 0x85, 0x1a, 0xa4, 0x05, 0x2f, 0x89, 0xd6, 0x9a,
+         0x0d, 0x6e, 0x86, 0xf3, 0xa0, 0x86, 0xb7, 0x47, 0x9b, 0xd1, 0x2e, 0xf3, 0x7d, 0xd9, 0x0d, 0x3e,
+         0xb6, 0x5f, 0x06, 0xe7, 0xa9, 0xe6, 0xc9, 0x0b, 0xd2, 0x80, 0x41, 0x37, 0xe9, 0x27, 0x9f, 0x1a},
+        {0x1e, 0x90, 0x73, 0x9a, 0x6b, 0xbf, 0x84, 0x55, 0xcb, 0xec, 0xcf, 0xe1, 0x1a, 0x1f, 0xce, 0x59,
+         0xc6, 0x4f, 0x23, 0x15, 0xb4, 0xc5, 0x1d, 0x17, 0xed, 0x1c, 0xa0, 0xb1, 0xd1, 0x81, 0xa9, 0xaa,
+         0x43, 0x29, 0x9d, 0x97, 0x38, 0x47, 0x22, 0xca, 0x51, 0x3f, 0xd2, 0x49, 0xd8, 0xd6, 0x9f, 0xe0,
+         0xc9, 0x2f, 0x12, 0x82, 0xab, 0x31, 0x3c, 0xd4, 0x98, 0xa5, 0xf8, 0x22, 0x87, 0xb7, 0x86, 0x9c},
+        {0x63, 0xb0, 0x6e, 0x64, 0x8b, 0xf7, 0xaa, 0x8e, 0x8b, 0xbf, 0x75, 0xc0, 0xf3, 0xe0, 0xbc, 0x5d,
+         0x43, 0x86, 0x83, 0xb0, 0x63, 0xbe, 0x9f, 0x4f, 0x09, 0xde, 0x91, 0x58, 0x97, 0x56, 0xd7, 0xc0,
+         0x1b, 0x17, 0xd8, 0x8e, 0xd9, 0x95, 0x41, 0xbf, 0x1b, 0x2c, 0xfd, 0x50, 0xb7, 0xd4, 0xd8, 0x7f,
+         0xfd, 0x62, 0x7b, 0xb7, 0x08, 0xd0, 0xc2, 0x44, 0x5c, 0x68, 0x24, 0x9b, 0xe0, 0x8b, 0xae, 0x16}
+    },
+    {
+        {0x0b, 0x2c, 0xea, 0x00, 0x29, 0xee, 0x96, 0x3c, 0x00, 0x34, 0xb6, 0x1b, 0xf1, 0x9e, 0x38, 0x44,
+         0x35, 0xf1, 0x45, 0x54, 0xa7, 0xd2, 0x97, 0xb5, 0x14, 0x48, 0x38, 0xc3, 0x8e, 0x37, 0x55, 0x86,
+         0x47, 0xea, 0x95, 0xda, 0x28, 0xd3, 0x9a, 0xaa, 0xde, 0x5e, 0xdb, 0x8e, 0xd9, 0x41, 0xc6, 0x87,
+         0x60, 0x3c, 0xfd, 0xd1, 0x50, 0x87, 0x76, 0xe9, 0x6d, 0x66, 0x83, 0x19, 0x9e, 0x99, 0xda, 0xea},
+        {0x06, 0xe3, 0xd1, 0x57, 0xd1, 0xcd, 0x96, 0xbb, 0x4e, 0xd4, 0xcb, 0x06, 0x94, 0x97, 0xe6, 0x04,
+         0x13, 0x34, 0xd6, 0x98, 0xb1, 0x64, 0x0a, 0x59, 0xa4, 0x4a, 0x45, 0xcd, 0xe6, 0x13, 0xaa, 0xbd,
+         0x72, 0xf5, 0xce, 0x3c, 0x9c, 0xe0, 0xc9, 0x3d, 0x93, 0x39, 0xb9, 0x19, 0x78, 0xf1, 0xd9, 0xc6,
+         0x88, 0xb5, 0x6b, 0x3a, 0x38, 0x50, 0x62, 0x7c, 0x7d, 0x7f, 0x93, 0xc4, 0x27, 0x45, 0x6c, 0x7a},
+        {0x7c, 0x65, 0xb0, 0xae, 0x1e, 0x62, 0x93, 0x69, 0xd9, 0x61, 0xdd, 0xf4, 0x8d, 0xaa, 0x42, 0x1b,
+         0xdb, 0x33, 0xce, 0xbb, 0x32, 0xac, 0xe7, 0xe2, 0x97, 0x93, 0xdc, 0x6b, 0xc1, 0xc4, 0x35, 0x0b,
+         0x23, 0xd8, 0x93, 0xf2, 0xff, 0x35, 0xfd, 0xf1, 0x96, 0xb1, 0xbd, 0xed, 0x87, 0xac, 0x89, 0xc6,
+         0x74, 0xed, 0x51, 0xdb, 0xcc, 0x42, 0xce, 0xe5, 0x80, 0x64, 0xdd, 0xfc, 0x79, 0x3e, 0x6b, 0x29},
+        {0x1f, 0x13, 0x20, 0x2c, 0x95, 0x08, 0x3f, 0x85, 0x45, 0x83, 0xff, 0x4c, 0xda, 0x13, 0xef, 0x4b,
+         0x1e, 0x74, 0x5a, 0x88, 0x04, 0x60, 0x85, 0x0e, 0x59, 0xe2, 0x2c, 0x56, 0x7d, 0x23, 0xea, 0x24,
+         0x66, 0x33, 0x6d, 0x35, 0x6c, 0x38, 0x1b, 0x7e, 0xf2, 0x11, 0x09, 0xe7, 0xfd, 0xfd, 0x7f, 0xfa,
+         0x00, 0x85, 0x08, 0x7e, 0xb5, 0x5c, 0x47, 0x78, 0xad, 0x42, 0x02, 0x5c, 0x90, 0x27, 0x5f, 0x48},
+        {0x11, 0x89, 0x92, 0x51, 0xcd, 0xa7, 0xea, 0xda, 0xfd, 0x67, 0xc3, 0xa4, 0x3e, 0x7f, 0x2d, 0x64,
+         0xc0, 0x3f, 0x8d, 0xfc, 0x06, 0x07, 0xbc, 0xa3, 0xec, 0x59, 0x26, 0x50, 0x8a, 0x9c, 0xff, 0x07,
+         0x1d, 0xbe, 0xcc, 0x33, 0x6f, 0x79, 0xbb, 0x03, 0x26, 0xb5, 0xa2, 0x6d, 0x01, 0xa6, 0x3f, 0xe7,
+         0x71, 0x6b, 0x78, 0x54, 0xf0, 0xa6, 0xed, 0x38, 0xc0, 0x1b, 0x47, 0x1a, 0xfb, 0x7d, 0xe6, 0x72},
+        {0x71, 0x4c, 0xa9, 0xe7, 0x46, 0xb2, 0xd4, 0x15, 0xb0, 0xa9, 0x2f, 0x41, 0xb1, 0x84, 0xad, 0x18,
+         0x7c, 0x9e, 0xa4, 0x94, 0x3c, 0xc7, 0x73, 0x93, 0xf2, 0xd9, 0x37, 0xb2, 0x52, 0x31, 0x6e, 0x5c,
+         0x24, 0x43, 0xa8, 0x33, 0x4b, 0x22, 0x34, 0x1b, 0xe7, 0x05, 0x92, 0x96, 0x21, 0x1f, 0x3e, 0x8f,
+         0x61, 0x2c, 0xb5, 0x71, 0x71, 0x9c, 0x94, 0x3c, 0x8e, 0xe9, 0x67, 0x69, 0x84, 0xd7, 0x7f, 0xd0},
+        {0x7c, 0x76, 0xec, 0x62, 0x77, 0x37, 0x7b, 0x7f, 0xf9, 0xbc, 0x00, 0x13, 0x27, 0x14, 0xda, 0x21,
+         0xfd, 0xf1, 0x32, 0x4a, 0x45, 0x7f, 0x47, 0xa5, 0xf2, 0xc6, 0x49, 0xa2, 0x8c, 0x30, 0x92, 0x5c,
+         0x62, 0x37, 0x7e, 0x50, 0xb3, 0x54, 0x38, 0x49, 0x4b, 0x7e, 0xc6, 0x69, 0xc7, 0x64, 0xa0, 0xce,
+         0x2b, 0x50, 0xcf, 0x09, 0x25, 0x8c, 0x7b, 0x67, 0xdc, 0x98, 0x22, 0xf3, 0x40, 0x05, 0xe2, 0x0d},
+        {0x1d, 0x4e, 0x70, 0xe7, 0xfa, 0x35, 0xc1, 0x3e, 0xc6, 0x1e, 0xfe, 0x8d, 0x7b, 0x8a, 0xe9, 0xe6,
+         0x21, 0x14, 0x4c, 0x1e, 0xb2, 0x45, 0x4c, 0x35, 0x09, 0x20, 0xe4, 0xac, 0x81, 0x36, 0x03, 0x93,
+         0x7b, 0x28, 0x07, 0xa9, 0x1c, 0xe0, 0x9f, 0xf2, 0x0a, 0x51, 0x8d, 0x85, 0xbe, 0x72, 0x9e, 0x11,
+         0x8a, 0xe4, 0x48, 0xb5, 0x17, 0x63, 0xe8, 0x80, 0xab, 0xd1, 0x57, 0x95, 0xdd, 0xc2, 0x2e, 0x61}
+    },
+    {
+        {0x4c, 0x27, 0xaf, 0xff, 0x3c, 0x45, 0xf3, 0x2c, 0x95, 0x2d, 0x39, 0x84, 0xe1, 0x4e, 0x29, 0xa0,
+         0x98, 0xe6, 0x85, 0xc9, 0xc2, 0xe7, 0x23, 0xe5, 0xfc, 0x80, 0x47, 0xae, 0x60, 0xb7, 0xe8, 0x24,
+         0x5f, 0x2c, 0x99, 0xe6, 0x52, 0x6d, 0xc8, 0x7d, 0x95, 0xf1, 0x1e, 0xb6, 0x26, 0xc2, 0x9c, 0x3a,
+         0x90, 0xd0, 0xbe, 0x1e, 0x51, 0xa4, 0xc4, 0x9e, 0x5b, 0xba, 0xbd, 0x11, 0x4b, 0xf5, 0xa6, 0x6b},
+        {0x78, 0x6b, 0xe3, 0x07, 0x33, 0xef, 0xda, 0xf7, 0xa0, 0x81, 0x57, 0xf7, 0x90, 0x7d, 0x6e, 0xe4,
+         0xf6, 0x95, 0x2c, 0x72, 0x8f, 0xbf, 0xa2, 0x69, 0xfc, 0xef, 0xd1, 0xb4, 0x32, 0x24, 0xe0, 0x85,
+         0x65, 0x3a, 0x5f, 0x77, 0x2f, 0x34, 0x98, 0x5b, 0x34, 0x27, 0x0e, 0xcd, 0xd4, 0xfd, 0x08, 0x47,
+         0x2a, 0x7c, 0x08, 0xbe, 0xb3, 0x9d, 0x69, 0xbe, 0x4e, 0xab, 0x07, 0x12, 0xc6, 0x3e, 0x27, 0x36},
+        {0x09, 0xc1, 0x86, 0xaf, 0xb8, 0x33, 0x95, 0x1c, 0xa2, 0xfd, 0x3a, 0xa5, 0x8b, 0x84, 0xf0, 0x9b,
+         0xae, 0xa4, 0xba, 0xcc, 0x87, 0x56, 0xd9, 0x4b, 0x31, 0x25, 0xca, 0x89, 0xf1, 0x93, 0xc7, 0xc7,
+         0x61, 0x37, 0xb0, 0x74, 0x60, 0x27, 0xb3, 0x53, 0x93, 0x46, 0x95, 0xb1, 0x49, 0x86, 0x4a, 0x1e,
+         0x02, 0xa8, 0x2a, 0x6b, 0xbe, 0xd5, 0x4f, 0xf1, 0x1a, 0x34, 0x9a, 0x35, 0x7f, 0x7b, 0x06, 0x2f},
+        {0x21, 0xfe, 0xe4, 0x80, 0x49, 0x68, 0xa9, 0x33, 0xdf, 0x89, 0x57, 0x81, 0x5b, 0xc8, 0xdd, 0x9c,
+         0xc6, 0xa4, 0xd0, 0x6b, 0xeb, 0x4d, 0x19, 0xb3, 0x6c, 0xb8, 0x22, 0xf0, 0x4c, 0x2e, 0xaa, 0x13,
+         0x50, 0x0b, 0x77, 0x40, 0x07, 0x2c, 0xb5, 0x1d, 0x41, 0x6c, 0x5d, 0xa1, 0x50, 0x85, 0x83, 0x39,
+         0xbd, 0xa5, 0x36, 0x7a, 0x89, 0x72, 0xc2, 0x31, 0x30, 0x60, 0xd3, 0xe9, 0x30, 0x90, 0x17, 0x00},
+        {0x4a, 0x2e, 0x1f, 0x96, 0xee, 0xe4, 0xe0, 0x82, 0xb8, 0x13, 0xe0, 0x36, 0x5c, 0x89, 0xc9, 0xe8,
+         0xed, 0xa1, 0x0c, 0xe5, 0x97, 0x3c, 0x99, 0x55, 0x49, 0x19, 0xe3, 0xa2, 0xb1, 0x2d, 0x4f, 0x17,
+         0x6c, 0x3f, 0x24, 0x82, 0x2e, 0x18, 0x5c, 0x5b, 0x8c, 0x95, 0x11, 0x88, 0xbf, 0xdf, 0x0d, 0xa8,
+         0xdc, 0x22, 0x9e, 0x51, 0x73, 0x35, 0xa6, 0x64, 0x44, 0xd4, 0xb8, 0x32, 0xac, 0x84, 0x6f, 0xc4},
+        {0x5d, 0xbd, 0x3b, 0xf9, 0x54, 0x94, 0xd7, 0x46, 0x6a, 0xf1, 0x95, 0xbd, 0x86, 0x9d, 0x24, 0x35,
+         0x46, 0x25, 0x30, 0xea, 0x6d, 0x05, 0x36, 0xa0, 0xaf, 0x41, 0x44, 0x9e, 0xc0, 0xec, 0x34, 0x64,
+         0x56, 0xf5, 0xf7, 0x77, 0x76, 0xe9, 0xfb, 0xb0, 0x86, 0x3c, 0xd8, 0xc0, 0xa8, 0x99, 0x2a, 0xb9,
+         0xa3, 0x42, 0xce, 0x2a, 0x7b, 0x7b, 0x9f, 0x8c, 0x13, 0x7c, 0xe1, 0xc7, 0x37, 0xe2, 0x5b, 0x77},
+        {0x4b, 0x37, 0x02, 0x04, 0x45, 0x75, 0xd3, 0xc0, 0xf1, 0xf2, 0xd5, 0x7d, 0xf9, 0x77, 0x1c, 0xeb,
+         0xb5, 0x8e, 0x01, 0x1a, 0xfd, 0x27, 0x5e, 0x11, 0x93, 0x70, 0xba, 0xdc, 0x76, 0xed, 0x56, 0x85,
+         0x54, 0x33, 0x3c, 0x50, 0xac, 0xf3, 0x32, 0xf5, 0x2f, 0x42, 0x7a, 0x80, 0xe5, 0x60, 0x6a, 0xaf,
+         0xe3, 0x6d, 0xcb, 0x0f, 0xaf, 0xcc, 0xe2, 0x92, 0x48, 0x20, 0x27, 0xac, 0xd2, 0x89, 0xb8, 0x20},
+        {0x77, 0xfe, 0x8a, 0x5d, 0x49, 0x0a, 0xfb, 0x6a, 0xe4, 0xa1, 0x98, 0x06, 0x5e, 0x94, 0x88, 0xf8,
+         0xc3, 0x58, 0xad, 0xac, 0xf1, 0xdd, 0x56, 0x4e, 0x28, 0xb7, 0x13, 0x6e, 0x11, 0x46, 0xb3, 0xdf,
+         0x3c, 0x53, 0x0f, 0x01, 0xe0, 0x39, 0xf3, 0x16, 0x8a, 0xc0, 0x03, 0x33, 0x95, 0x21, 0x8d, 0x91,
+         0x22, 0xac, 0xc9, 0xfe, 0x0a, 0x35, 0x45, 0xba, 0x6d, 0x75, 0xc5, 0xaf, 0xa5, 0xf5, 0x02, 0x46}
+    },
+    {
+        {0x53, 0xe2, 0xa4, 0xed, 0x1b, 0xbb, 0x48, 0xbd, 0x01, 0x6c, 0x52, 0x4a, 0x02, 0xf7, 0x97, 0x65,
+         0x4c, 0xfc, 0x96, 0x98, 0x49, 0xf8, 0x67, 0x68, 0x1d, 0xa9, 0x4e, 0x34, 0x1f, 0x37, 0x75, 0x34,
+         0x5a, 0x23, 0x34, 0xfd, 0xda, 0x64, 0x27, 0x32, 0xa3, 0xc9, 0x52, 0x0c, 0xe0, 0x65, 0x81, 0xaa,
+         0x7f, 0x0f, 0x08, 0x28, 0x82, 0x55, 0x4c, 0x37, 0xb8, 0xd3, 0x90, 0xa2, 0x5a, 0x9b, 0xd5, 0x59},
+        {0x26, 0x18, 0x67, 0x6f, 0x8f, 0xb1, 0x8e, 0xf8, 0xc0, 0xff, 0x9e, 0x05, 0x7c, 0x9c, 0xca, 0x37,
+         0x10, 0x4c, 0xba, 0xe6, 0x66, 0x39, 0x8a, 0x1f, 0xc8, 0x23, 0x7b, 0xb3, 0x4d, 0x0c, 0xb0, 0xb5,
+         0x2a, 0xa0, 0x5b, 0x60, 0xa2, 0x32, 0xec, 0x56, 0xc8, 0xf2, 0xf5, 0x1b, 0x1e, 0xb6, 0xcb, 0x7e,
+         0xbb, 0x24, 0x15, 0xfc, 0x4b, 0x1e, 0x8b, 0xa9, 0x4e, 0xa4, 0x1a, 0x23, 0x54, 0x13, 0x41, 0x4b},
+        {0x28, 0x1e, 0x0f, 0x83, 0xff, 0xa5, 0xc7, 0x9b, 0xb0, 0x8f, 0x01, 0x1f, 0x11, 0x33, 0xe2, 0xc8,
+         0xb9, 0xa6, 0x3e, 0xd5, 0x5c, 0xb2, 0xf3, 0x4f, 0x11, 0x4f, 0x92, 0x2e, 0x86, 0x47, 0x29, 0xa4,
+         0x5d, 0x2e, 0x7c, 0x59, 0x51, 0x17, 0x40, 0xa4, 0xad, 0x7c, 0x2b, 0x8b, 0x7d, 0x3b, 0xc8, 0xcf,
+         0xa5, 0x1c, 0x29, 0x74, 0x60, 0x68, 0x02, 0xea, 0xad, 0xb5, 0x8e, 0xec, 0xa1, 0x7a, 0x29, 0x1d},
+        {0x56, 0x6d, 0xcd, 0x76, 0x67, 0x40, 0xcb, 0x27, 0xbc, 0xcf, 0xf7, 0x52, 0xad, 0x6b, 0x8f, 0xd3,
+         0xc2, 0xf7, 0xbf, 0x38, 0x49, 0xc1, 0x13, 0x1a, 0x4a, 0xe7, 0x32, 0x3e, 0xbc, 0x4f, 0x6c, 0x0a,
+         0x51, 0xe9, 0xf1, 0x9f, 0xc0, 0x0f, 0x3d, 0x39, 0x8f, 0x75, 0x39, 0x19, 0x6f, 0x45, 0x9e, 0xf3,
+         0x7e, 0x0a, 0xb7, 0x95, 0x23, 0x3a, 0xde, 0x63, 0xb5, 0xf2, 0x9b, 0xbe, 0xad, 0x27, 0xb0, 0xe5},
+        {0x0f, 0xe1, 0xbd, 0xe1, 0x0f, 0x99, 0x4a, 0xaa, 0x40, 0x78, 0x44, 0xa9, 0xd7, 0xd2, 0xed, 0x60,
+         0x9e, 0x03, 0xb4, 0xfa, 0xcb, 0xf4, 0x52, 0x7d, 0x3f, 0xb9, 0x4a, 0x66, 0x1a, 0x49, 0x8f, 0xb2,
+         0x3d, 0x16, 0x2f, 0x25, 0xf4, 0x1c, 0x04, 0xe4, 0x5a, 0xb4, 0x99, 0x86, 0x0d, 0xa5, 0xde, 0xbb,
+         0x12, 0xef, 0xf0, 0x5d, 0x2f, 0x8d, 0x64, 0xb4, 0xe4, 0xfa, 0x7e, 0x21, 0xac, 0xc1, 0x31, 0xac},
+        {0x5b, 0xe3, 0x37, 0x84, 0x16, 0x60, 0x5f, 0x1a, 0xb0, 0x09, 0xa3, 0x96, 0x0c, 0x79, 0x73, 0x81,
+         0xd0, 0x94, 0xfd, 0x86, 0x2e, 0x3b, 0xeb, 0xd4, 0x9e, 0xcc, 0x2e, 0x08, 0xcb, 0x1e, 0x63, 0xbd,
+         0x3d, 0x72, 0x4f, 0xda, 0x9e, 0x6c, 0xee, 0x9d, 0x8b, 0xf3, 0x98, 0xb8, 0xf4, 0x9d, 0x3f, 0x02,
+         0x13, 0x2f, 0x73, 0x94, 0xa5, 0x8c, 0x86, 0x90, 0x79, 0x67, 0x99, 0x6b, 0x16, 0x71, 0x82, 0xf0},
+        {0x61, 0x58, 0xe3, 0xc0, 0xda, 0x57, 0x3e, 0x2c, 0x5a, 0xfb, 0x10, 0x09, 0xdc, 0x22, 0xf6, 0xbe,
+         0x39, 0x2d, 0x1a, 0xf4, 0x64, 0x29, 0x8c, 0xfc, 0x9a, 0x37, 0x22, 0x37, 0xb0, 0x2c, 0xd3, 0xd0,
+         0x0a, 0x50, 0x4c, 0x28, 0x88, 0x81, 0xd0, 0xad, 0xd3, 0x89, 0xd4, 0xc2, 0x15, 0xfd, 0xb9, 0x62,
+         0xba, 0x3b, 0x46, 0x39, 0x75, 0x62, 0x80, 0xbf, 0x20, 0x62, 0xed, 0x43, 0xe2, 0x19, 0x0e, 0x45},
+        {0x21, 0x51, 0xb3, 0x30, 0x94, 0x7c, 0x9f, 0x7b, 0x22, 0xfb, 0x8d, 0x72, 0x58, 0xba, 0x6d, 0x9c,
+         0xd5, 0x9c, 0xe0, 0xbb, 0xcc, 0xb5, 0x1a, 0x3e, 0x12, 0x11, 0x94, 0x86, 0x24, 0x14, 0xaa, 0x88,
+         0x2a, 0x01, 0x50, 0x7e, 0xe4, 0x6f, 0x38, 0x35, 0x0a, 0x3d, 0xfc, 0x49, 0xfb, 0xa4, 0x9a, 0xdc,
+         0x90, 0x70, 0x25, 0xfc, 0xc9, 0x6b, 0x23, 0x7c, 0x03, 0x1e, 0xd0, 0xaf, 0xf2, 0x3d, 0x74, 0xf6}
+    },
+    {
+        {0x7b, 0x8d, 0x2c, 0x82, 0x3b, 0xaa, 0xfe, 0x0d, 0x87, 0x8a, 0x55, 0xe8, 0xaf, 0x1d, 0xb1, 0x50,
+         0xde, 0xc8, 0x5b, 0x14, 0x24, 0xa4, 0x90, 0x1f, 0x9b, 0xef, 0xfd, 0x3a, 0x61, 0x96, 0xe3, 0xd6,
+         0x1c, 0x45, 0xa5, 0x57, 0xb3, 0x62, 0x4f, 0x9b, 0x89, 0xed, 0x15, 0xb3, 0xc3, 0xe1, 0xa0, 0x65,
+         0xf1, 0xb4, 0x53, 0xd9, 0x48, 0xf7, 0xcf, 0x45, 0xd9, 0x49, 0x44, 0x83, 0xf8, 0xaf, 0x0c, 0x85},
+        {0x5f, 0xa2, 0xb1, 0xdf, 0xec, 0x51, 0xbc, 0xf3, 0x8d, 0xe2, 0x51, 0x0a, 0xde, 0xdc, 0xc6, 0x95,
+         0x95, 0x2f, 0x36, 0xb9, 0x90, 0x0f, 0x13, 0xef, 0xb4, 0x5d, 0x1c, 0x3c, 0xd0, 0x99, 0xc1, 0x88,
+         0x3f, 0x81, 0xfa, 0xa5, 0x6d, 0xc3, 0x88, 0xbd, 0x64, 0xde, 0x21, 0xb2, 0x52, 0x52, 0xd7, 0x2f,
+         0x40, 0xd6, 0x4b, 0x90, 0xbf, 0x42, 0x7b, 0x85, 0x69, 0x40, 0x9b, 0x7d, 0x23, 0xa1, 0x68, 0x2e},
+        {0x37, 0x80, 0xa1, 0xd4, 0xb6, 0xb5, 0xac, 0x99, 0xa5, 0xa2, 0x63, 0xd5, 0x96, 0x5a, 0x5a, 0x96,
+         0xa8, 0x23, 0x61, 0x03, 0x1f, 0x6a, 0x4c, 0x8e, 0x2a, 0x8a, 0xc7, 0x0b, 0xc7, 0x00, 0x95, 0x28,
+         0x3a, 0xa8, 0xdc, 0x13, 0x1e, 0x63, 0x25, 0x8c, 0xb6, 0xfc, 0x9f, 0x36, 0x90, 0x0e, 0xf3, 0xb9,
+         0x8d, 0xe3, 0x18, 0xd6, 0x65, 0x2c, 0xef, 0x6d, 0x83, 0xb9, 0x5f, 0xea, 0x23, 0x88, 0x25, 0xfe},
+        {0x1f, 0x87, 0x8c, 0x9b, 0xb7, 0x77, 0xa0, 0x58, 0x6a, 0x03, 0xdd, 0x7c, 0x31, 0x09, 0x86, 0xd8,
+         0xf6, 0xec, 0x21, 0xf7, 0xef, 0x82, 0x64, 0x2e, 0x79, 0x9e, 0x66, 0x8a, 0x7b, 0x47, 0xfd, 0xfb,
+         0x59, 0x47, 0x99, 0x37, 0xca, 0xe1, 0x2d, 0xf4, 0x1a, 0x31, 0x89, 0x2a, 0xc4, 0xbf, 0x58, 0xb9,
+         0xc5, 0xdb, 0xea, 0xf4, 0xe0, 0xae, 0x1d, 0xab, 0x34, 0x21, 0x55, 0x3d, 0xa8, 0xe4, 0x47, 0x55},
+        {0x58, 0x45, 0x83, 0x08, 0xef, 0x6c, 0x0a, 0x56, 0x3e, 0x6a, 0x18, 0xfd, 0x5d, 0xd1, 0x9e, 0x38,
+         0xbe, 0xc3, 0x09, 0x19, 0xd5, 0x8b, 0xd5, 0xa3, 0xe5, 0xf5, 0x57, 0x1a, 0x8e, 0x1c, 0x47, 0xff,
+         0x25, 0x9d, 0x66, 0x4d, 0x2b, 0x33, 0x6b, 0x78, 0x96, 0x49, 0x52, 0xd0, 0xce, 0x23, 0x09, 0x72,
+         0x75, 0x44, 0xe8, 0x32, 0x6b, 0xee, 0xe6, 0x86, 0x0f, 0xd6, 0x26, 0xfc, 0x2b, 0xb1, 0xc0, 0x2e},
+        {0x33, 0x3f, 0x8e, 0xef, 0x2b, 0x1f, 0x71, 0x5f, 0x8f, 0x71, 0x9c, 0x57, 0x33, 0x00, 0x51, 0x03,
+         0x40, 0x7d, 0x79, 0x94, 0xa7, 0xbc, 0xd3, 0xe5, 0x07, 0x63, 0xff, 0x13, 0xe0, 0x66, 0x5c, 0xb0,
+         0x13, 0x18, 0x83, 0xd8, 0xfc, 0x4c, 0xaf, 0xaa, 0x36, 0xd6, 0x4a, 0x9b, 0x19, 0xee, 0x22, 0x30,
+         0x97, 0xb2, 0xa1, 0xb2, 0x87, 0xfc, 0x33, 0xb6, 0x70, 0x87, 0xf4, 0x10, 0x7b, 0x4c, 0x7b, 0x5a},
+        {0x7b, 0x10, 0xe1, 0xd2, 0x6d, 0x95, 0xf4, 0xa3, 0xed, 0x81, 0xd6, 0x8d, 0x5b, 0x08, 0xe5, 0x1d,
+         0xc8, 0x22, 0x86, 0xe1, 0x1e, 0xaa, 0x02, 0x24, 0x97, 0x9e, 0x22, 0xaf, 0xd4, 0x43, 0xec, 0x39,
+         0x36, 0x66, 0x38, 0x75, 0xe8, 0xdd, 0x13, 0x3d, 0xc9, 0x40, 0xc6, 0x7f, 0xd9, 0x02, 0xb2, 0x7f,
+         0x69, 0xf1, 0xa1, 0x8d, 0x24, 0x89, 0xf1, 0xa8, 0x60, 0x5e, 0x81, 0x7c, 0xa6, 0x91, 0x95, 0x49},
+        {0x08, 0xe6, 0x04, 0x79, 0xf7, 0xf5, 0x1f, 0x3a, 0xb2, 0x11, 0x9b, 0x58, 0x75, 0xde, 0xac, 0x32,
+         0xf7, 0x50, 0x07, 0x32, 0x64, 0xda, 0x7e, 0x55, 0x45, 0x35, 0xa9, 0x49, 0xc1, 0x63, 0xca, 0xc7,
+         0x1b, 0x2b, 0x6c, 0x48, 0xc2, 0xee, 0xad, 0xcd, 0xb2, 0x11, 0x5b, 0xf4, 0xee, 0x5f, 0x90, 0x86,
+         0x1b, 0xe7, 0xc4, 0x97, 0x67, 0xba, 0x67, 0xfc, 0x96, 0xfe, 0xe1, 0xfa, 0x4b, 0x22, 0xfa, 0x46}
+    },
+    {
+        {0x78, 0x87, 0x7b, 0x5d, 0x87, 0x77, 0x41, 0x09, 0x97, 0xda, 0xca, 0xee, 0xa5, 0x94, 0x00, 0xfc,
+         0x9d, 0xb4, 0x42, 0x1f, 0xac, 0x02, 0xc4, 0x28, 0x23, 0x01, 0xc6, 0x7d, 0x35, 0xfb, 0x7f, 0xfe,
+         0x03, 0x41, 0xb4, 0x6c, 0x32, 0x83, 0x33, 0xe4, 0x48, 0x4c, 0xe8, 0x60, 0x76, 0x19, 0x01, 0x4d,
+         0x41, 0x77, 0x5c, 0x40, 0x8c, 0x88, 0x85, 0x6d, 0x2f, 0x9e, 0x19, 0x81, 0x2d, 0x90, 0xfb, 0xf5},
+        {0x17, 0x87, 0xc1, 0x29, 0xa6, 0x05, 0x20, 0x11, 0x4b, 0x36, 0x87, 0xd4, 0x33, 0x67, 0xda, 0xb6,
+         0xa3, 0xba, 0x1d, 0x1c, 0x7b, 0xca, 0x7e, 0xdf, 0xd2, 0xf4, 0x6e, 0x4f, 0x09, 0xc2, 0x10, 0xff,
+         0x0b, 0xa4, 0xe0, 0xf5, 0x51, 0x31, 0xc2, 0xb6, 0xde, 0xb4, 0xa1, 0xfa, 0x4b, 0x5d, 0x6a, 0x2b,
+         0x47, 0xe2, 0x89, 0x08, 0xfe, 0x7d, 0xca, 0xfc, 0x1b, 0xa7, 0x38, 0xda, 0x2f, 0xca, 0x96, 0xf6},
+        {0x52, 0xf8, 0xc9, 0xee, 0xc8, 0x53, 0xab, 0x7c, 0x38, 0x72, 0x5d, 0x0a, 0xf6, 0xd1, 0x32, 0x5e,
+         0xee, 0xe1, 0xd7, 0x36, 0xb3, 0xdc, 0xc7, 0x24, 0xc1, 0x96, 0xcf, 0xcd, 0xf3, 0x06, 0x5a, 0xcc,
+         0x5f, 0x8a, 0x40, 0xd8, 0x4d, 0x2b, 0x02, 0x77, 0xa7, 0x24, 0xb6, 0xe0, 0xdf, 0xa9, 0x5f, 0x68,
+         0x25, 0x85, 0xae, 0x0e, 0x78, 0xb0, 0x5e, 0x3b, 0x6d, 0x64, 0xd4, 0x44, 0xad, 0x68, 0x20, 0x27},
+        {0x01, 0xf5, 0x43, 0x18, 0x88, 0x4a, 0x9a, 0x29, 0x93, 0x2e, 0xb2, 0xd5, 0xaa, 0x12, 0x6e, 0xd3,
+         0xa9, 0x4f, 0xbe, 0xb7, 0xcb, 0x23, 0x85, 0x38, 0xbe, 0x57, 0x2b, 0x8e, 0x04, 0xc6, 0xe5, 0x5c,
+         0x0b, 0x70, 0x4f, 0x0a, 0xa8, 0xdd, 0x40, 0xec, 0x84, 0x05, 0xef, 0x01, 0x63, 0x4d, 0x0d, 0xc7,
+         0x97, 0xd0, 0x1a, 0x87, 0x2f, 0xae, 0x33, 0x7e, 0xbd, 0x8d, 0x21, 0x59, 0xa2, 0xdb, 0xfc, 0x50},
+        {0x43, 0xa8, 0x47, 0x8c, 0x17, 0x26, 0xd1, 0x49, 0xca, 0xcd, 0x20, 0x6f, 0x3f, 0x84, 0x0b, 0x08,
+         0xbd, 0x62, 0x31, 0x05, 0x8c, 0x01, 0x5a, 0x2d, 0x60, 0x8f, 0x76, 0x5b, 0xbe, 0x90, 0x2c, 0x82,
+         0x29, 0x41, 0x36, 0x1f, 0xe0, 0xb2, 0x28, 0xc8, 0x0b, 0x76, 0x72, 0x12, 0x3d, 0x4b, 0x21, 0x71,
+         0xd7, 0xf1, 0x60, 0x63, 0xc7, 0x26, 0xe6, 0x21, 0x64, 0x98, 0x68, 0x59, 0xdd, 0xec, 0x85, 0xbb},
+        {0x06, 0x58, 0x97, 0x63, 0xfb, 0x5c, 0xe7, 0xc2, 0xb6, 0x26, 0x96, 0x56, 0x81, 0xcb, 0xb5, 0x39,
+         0x01, 0x3e, 0x67, 0xd1, 0x57, 0xd1, 0x3f, 0xcf, 0xc5, 0x8a, 0xd3, 0x5c, 0x67, 0x01, 0x69, 0x41,
+         0x36, 0x7e, 0x10, 0xee, 0x9a, 0x05, 0x2a, 0x4f, 0xb0, 0xf1, 0xc1, 0x69, 0xba, 0x8a, 0x9c, 0xf2,
+         0xbe, 0x24, 0x89, 0x9b, 0x20, 0xc6, 0x77, 0x57, 0xb2, 0xba, 0xe5, 0xf0, 0xba, 0xf3, 0x0e, 0x0c},
+        {0x52, 0x88, 0x6c, 0x08, 0x79, 0x39, 0x34, 0x88, 0x2b, 0x9c, 0xcf, 0xe2, 0xd0, 0xad, 0xe3, 0x5d,
+         0x42, 0x14, 0x04, 0x61, 0x57, 0xa9, 0xd1, 0x4c, 0xc9, 0x37, 0x0d, 0x85, 0xe2, 0x58, 0x62, 0x6d,
+         0x33, 0x48, 0x7c, 0x54, 0x1f, 0xcf, 0xe0, 0xe1, 0x36, 0xf8, 0x79, 0xc8, 0x46, 0x30, 0xc1, 0x4e,
+         0x6a, 0x76, 0x4b, 0xb6, 0x52, 0x29, 0x25, 0x24, 0xc9, 0x21, 0xb2, 0x14, 0x0c, 0x6b, 0xb4, 0x46},
+        {0x2f, 0xcd, 0x57, 0xc0, 0x67, 0xc3, 0x48, 0xae, 0xe6, 0xea, 0xbd, 0x76, 0xe6, 0x6d, 0x27, 0xde,
+         0x79, 0x84, 0x60, 0x89, 0xd1, 0xe0, 0x91, 0x69, 0x06, 0xad, 0x03, 0xe9, 0x40, 0xe9, 0x26, 0x3f,
+         0x1a, 0x3d, 0xa7, 0xac, 0xfa, 0xbf, 0x17, 0x1a, 0x0b, 0x07, 0x8f, 0x4d, 0x60, 0x2a, 0x67, 0xbc,
+         0xf8, 0xc7, 0x4d, 0xfb, 0x7a, 0x28, 0x4b, 0x55, 0x3d, 0x86, 0xbc, 0xc7, 0xb9, 0xdc, 0xc1, 0x7f}
+    },
+    {
+        {0x2b, 0x55, 0x6b, 0xbc, 0x07, 0x0b, 0x5c, 0x4b, 0xae, 0x9e, 0x57, 0x58, 0x36, 0xd1, 0xd6, 0x8e,
+         0xe9, 0xfb, 0xe8, 0x00, 0x44, 0x8c, 0x0d, 0x2c, 0x23, 0x3f, 0x78, 0x18, 0x5e, 0xed, 0x3f, 0x91,
+         0x7b, 0xa0, 0x13, 0x32, 0x80, 0x7e, 0xbd, 0x89, 0x2e, 0x00, 0xdd, 0xb3, 0x68, 0xc0, 0xfa, 0x1b,
+         0x3f, 0x19, 0xb5, 0xb3, 0x2e, 0xfd, 0x90, 0xb1, 0x78, 0xd9, 0x84, 0xe1, 0xd7, 0x17, 0x4d, 0x6f},
+        {0x3f, 0x5c, 0x47, 0xb4, 0x90, 0xbe, 0x4e, 0x04, 0xf8, 0x91, 0x5c, 0xc5, 0xf3, 0xc1, 0xfe, 0x8e,
+         0x5d, 0x19, 0x0b, 0xc4, 0x1e, 0xd0, 0x0d, 0x8f, 0x43, 0xb0, 0x44, 0x44, 0xaf, 0x40, 0x6f, 0x1a,
+         0x53, 0x7c, 0xe9, 0x8e, 0x07, 0x42, 0x82, 0x14, 0xd2, 0x8b, 0xf2, 0xb4, 0x10, 0x39, 0xcb, 0x54,
+         0xea, 0x8d, 0xa8, 0x60, 0x45, 0xba, 0xaa, 0x3f, 0x07, 0x71, 0x32, 0xfe, 0xf3, 0x2c, 0x3b, 0xb0},
+        {0x1e, 0x2b, 0x1d, 0x55, 0x78, 0x43, 0x7b, 0x24, 0x45, 0x4b, 0xe3, 0x00, 0x5d, 0x3f, 0xe2, 0x6a,
+         0xf5, 0xa8, 0x3c, 0xa0, 0x79, 0xba, 0xef, 0x77, 0x7a, 0xb9, 0x8f, 0xc9, 0x8d, 0xc1, 0xae, 0xb0,
+         0x41, 0xc6, 0x74, 0x7f, 0xf7, 0x56, 0xa8, 0xd2, 0x66, 0x36, 0xc7, 0x3f, 0xf4, 0x9f, 0x12, 0x8b,
+         0x2f, 0x77, 0x37, 0x31, 0xa7, 0xa4, 0x58, 0xe1, 0xb9, 0x15, 0xa0, 0x67, 0x16, 0xd6, 0xb8, 0x01},
+        {0x61, 0x41, 0x18, 0xe2, 0x20, 0x68, 0xc6, 0x4a, 0x82, 0x3b, 0x4a, 0x57, 0x05, 0x72, 0xd4, 0x91,
+         0x31, 0xb2, 0xf8, 0xd1, 0xd8, 0xca, 0xd3, 0xa5, 0x38, 0xcc, 0xdd, 0x30, 0xa8, 0xb4, 0xf8, 0x5d,
+         0x63, 0xeb, 0xe5, 0x28, 0x35, 0x99, 0xfe, 0xc2, 0x2b, 0x8d, 0x97, 0x33, 0xa9, 0x54, 0x85, 0x05,
+         0xfa, 0xa5, 0xa3, 0xcb, 0xb5, 0x47, 0x78, 0x11, 0xb0, 0x65, 0x12, 0x29, 0x47, 0x8d, 0xd4, 0x19},
+        {0x23, 0x34, 0x75, 0x48, 0x85, 0x22, 0xf3, 0xb0, 0x85, 0x40, 0x0f, 0x10, 0x56, 0xf3, 0x12, 0x18,
+         0x6b, 0x54, 0x1c, 0x4c, 0x21, 0x76, 0x1e, 0x46, 0xb7, 0xe9, 0x2e, 0x2a, 0xef, 0x77, 0x3c, 0x8a,
+         0x37, 0xe8, 0xd7, 0x73, 0xbe, 0x2a, 0x47, 0x15, 0x3e, 0x03, 0xb9, 0x47, 0x95, 0xd6, 0x5e, 0xb7,
+         0xc0, 0x1a, 0xb1, 0x25, 0xbd, 0xe0, 0xfa, 0xc7, 0x2a, 0x9d, 0x6b, 0x97, 0xa8, 0x12, 0xb2, 0x88},
+        {0x31, 0x8a, 0xc0, 0x50, 0x07, 0xad, 0x4d, 0x2d, 0x9a, 0x4a, 0x5e, 0x75, 0xf9, 0xa9, 0xa7, 0x3c,
+         0xd0, 0xef, 0x25, 0x23, 0x8d, 0x9e, 0xe2, 0x5f, 0x10, 0xbf, 0x03, 0x7b, 0xcd, 0x22, 0x84, 0x4c,
+         0x6b, 0xf5, 0xa2, 0x99, 0xdf, 0xb3, 0xf8, 0x27, 0x34, 0x75, 0x2a, 0x97, 0x7b, 0xd9, 0xb6, 0xa4,
+         0x2c, 0x0f, 0x19, 0xcd, 0x1c, 0x2c, 0xf5, 0x7f, 0x1d, 0x53, 0xaa, 0xc8, 0x82, 0x32, 0x22, 0xa2},
+        {0x1b, 0x76, 0xbf, 0x6b, 0xdb, 0x25, 0x79, 0xab, 0x5e, 0xfe, 0xf8, 0xa6, 0xa3, 0x48, 0x6f, 0x82,
+         0xfa, 0x10, 0x9f, 0x44, 0xc9, 0x5d, 0x04, 0xc0, 0x2c, 0x73, 0xfc, 0xcb, 0x0d, 0x15, 0x2c, 0x96,
+         0x50, 0x2f, 0x67, 0xac, 0x28, 0x82, 0x5e, 0x30, 0xf3, 0x17, 0x3e, 0x20, 0xd3, 0xf0, 0x3e, 0xed,
+         0x45, 0x9a, 0x68, 0x6f, 0x42, 0x72, 0x75, 0x36, 0x57, 0x06, 0x76, 0x1e, 0xfd, 0x0c, 0x39, 0x48},
+        {0x13, 0xae, 0xa1, 0x84, 0x99, 0x89, 0xff, 0xcc, 0x18, 0x79, 0x5f, 0xf8, 0x24, 0x24, 0x0b, 0x15,
+         0x70, 0x52, 0x29, 0x2b, 0x06, 0x50, 0x60, 0xa0, 0xb3, 0xfc, 0xf4, 0xd8, 0xef, 0x3f, 0x3f, 0xb1,
+         0x08, 0x84, 0x94, 0x9c, 0x8c, 0xa1, 0x2b, 0x70, 0xfb, 0xdd, 0xbf, 0xf2, 0x1b, 0x25, 0xe5, 0x70,
+         0x67, 0x2d, 0x6c, 0xa4, 0x10, 0x60, 0x05, 0x55, 0x19, 0x30, 0xc1, 0x01, 0xc2, 0xb8, 0x1f, 0x44}
+    },
+    {
+        {0x0f, 0x72, 0x55, 0x69, 0x98, 0xb0, 0x04, 0x47, 0x99, 0xf0, 0xfd, 0x03, 0x21, 0x0d, 0xed, 0x3d,
+         0x98, 0x4e, 0x38, 0x43, 0xbb, 0xaf, 0x3c, 0x1d, 0x5d, 0x69, 0x2b, 0xc9, 0x4d, 0x43, 0xc4, 0xe7,
+         0x16, 0xc1, 0x9c, 0x50, 0x37, 0xc1, 0x03, 0xd4, 0x47, 0xca, 0xef, 0x4e, 0xfe, 0x6b, 0xd8, 0x1a,
+         0x49, 0x0e, 0x7c, 0x66, 0x8f, 0x68, 0x70, 0xf1, 0xb0, 0x80, 0x86, 0x3b, 0x53, 0x15, 0xdf, 0x5e},
+        {0x25, 0xae, 0xa0, 0xbc, 0x08, 0x27, 0x81, 0x5b, 0x53, 0x5d, 0x8c, 0x11, 0x0e, 0x69, 0x4b, 0x92,
+         0x47, 0x81, 0x1f, 0xf4, 0x36, 0x82, 0xe7, 0x2a, 0x2c, 0xea, 0x9e, 0xf5, 0xe3, 0x47, 0x37, 0x1b,
+         0x5d, 0xdc, 0xc7, 0xdc, 0xcc, 0x9e, 0x41, 0x75, 0x41, 0x12, 0xbb, 0xfd, 0x9b, 0x9d, 0xa0, 0x5d,
+         0x50, 0xe2, 0x13, 0x8b, 0x62, 0x4d, 0xac, 0x59, 0xd2, 0x00, 0x42, 0x11, 0x05, 0xa1, 0x32, 0x69},
+        {0x3c, 0x56, 0xae, 0xe6, 0x9c, 0xb8, 0x88, 0x40, 0x06, 0x8e, 0x9f, 0x63, 0xda, 0x0c, 0x61, 0xef,
+         0x08, 0x00, 0x97, 0x17, 0xcb, 0xba, 0x66, 0x46, 0x97, 0x49, 0xfd, 0x66, 0x10, 0x64, 0x14, 0xf0,
+         0x4d, 0xe5, 0x67, 0xdf, 0x25, 0xc3, 0x90, 0xad, 0x64, 0x64, 0x64, 0x7a, 0xda, 0x13, 0x06, 0x71,
+         0x44, 0x45, 0x81, 0x62, 0x0e, 0xc2, 0xf1, 0x3d, 0xbc, 0x3b, 0x38, 0x9a, 0xdf, 0xa4, 0x6a, 0x20},
+        {0x4e, 0xec, 0xfc, 0xa3, 0x91, 0x70, 0xc0, 0x7d, 0xe4, 0x66, 0x9b, 0xae, 0x23, 0xb0, 0x06, 0x8d,
+         0x29, 0x4e, 0xd2, 0x25, 0xff, 0x79, 0x49, 0x28, 0x5e, 0x82, 0x70, 0x46, 0x06, 0x38, 0xe3, 0xd9,
+         0x5e, 0x9e, 0x7c, 0x43, 0x81, 0x07, 0x4b, 0xea, 0x73, 0xe2, 0x46, 0x38, 0xaa, 0xac, 0x05, 0x08,
+         0xe7, 0x6a, 0x81, 0xb7, 0x0e, 0x0d, 0x5c, 0x14, 0xfb, 0x1e, 0xf6, 0x30, 0x6a, 0x37, 0x12, 0x62},
+        {0x7c, 0xab, 0x69, 0xa1, 0x81, 0x86, 0x9f, 0x75, 0x08, 0x30, 0x88, 0xb3, 0x46, 0x21, 0x97, 0x12,
+         0x5a, 0x80, 0x06, 0x5c, 0x71, 0x26, 0xd4, 0xc8, 0xaa, 0xa0, 0xbb, 0x3b, 0xaf, 0x72, 0xd4, 0xb7,
+         0x6a, 0x47, 0xf4, 0x3c, 0x5c, 0x1e, 0x9a, 0x21, 0xa0, 0x54, 0xe3, 0x0c, 0xf1, 0x1c, 0x51, 0xfd,
+         0x8f, 0x2c, 0xe6, 0xbf, 0x71, 0x50, 0xb6, 0x5b, 0x66, 0x0a, 0xd4, 0x65, 0xfd, 0xbf, 0xdd, 0x06},
+        {0x00, 0x56, 0xcb, 0xd3, 0x12, 0xf9, 0x60, 0x72, 0xb3, 0xbe, 0xb2, 0xe9, 0xcb, 0x87, 0x7c, 0xb5,
+         0x28, 0x47, 0x06, 0xd2, 0x78, 0x5c, 0x8e, 0xfd, 0xd5, 0x34, 0x15, 0xaf, 0xc8, 0x30, 0x4b, 0x4f,
+         0x38, 0xd4, 0x97, 0xd2, 0x78, 0x62, 0xd5, 0x85, 0x1c, 0x5b, 0x26, 0x9e, 0x44, 0x82, 0xa6, 0xfb,
+         0x17, 0x2e, 0x6c, 0xe3, 0x35, 0x20, 0xa0, 0x67, 0xd9, 0xd5, 0x9c, 0x65, 0x1e, 0x83, 0x91, 0x1c},
+        {0x4e, 0x02, 0xcc, 0xb9, 0x47, 0xe5, 0x65, 0x17, 0x8b, 0x32, 0x10, 0x01, 0x06, 0xba, 0x89, 0x79,
+         0x69, 0xb6, 0xc4, 0x85, 0xde, 0x37, 0xf3, 0x30, 0x6b, 0x4e, 0xe7, 0xab, 0x4a, 0x86, 0xe3, 0x3d,
+         0x07, 0x66, 0x05, 0xfe, 0x12, 0x21, 0x79, 0x41, 0x7d, 0x35, 0xfb, 0x69, 0x10, 0x22, 0x50, 0xa5,
+         0xbf, 0x59, 0x2b, 0x80, 0xfb, 0x0c, 0x56, 0x39, 0x6b, 0x61, 0x92, 0xaa, 0x37, 0x44, 0x2a, 0xff},
+        {0x28, 0x84, 0x18, 0x7f, 0xa6, 0x11, 0x40, 0x98, 0x30, 0x62, 0x66, 0x92, 0x18, 0xc6, 0x2a, 0x30,
+         0x17, 0xbe, 0x9d, 0x32, 0x43, 0x77, 0x60, 0x28, 0x1f, 0x9b, 0x76, 0x2e, 0x4f, 0x21, 0xf9, 0xfc,
+         0x32, 0x00, 0x42, 0x68, 0x67, 0xdf, 0x5f, 0x3d, 0x9f, 0x57, 0xfd, 0x08, 0x6c, 0xc3, 0x2a, 0x17,
+         0x85, 0x0b, 0x08, 0xea, 0xc3, 0x49, 0x2d, 0xca, 0x3c, 0xa1, 0x76, 0x8a, 0xf4, 0xd3, 0xab, 0x3f}
+    },
+    {
+        {0x1c, 0xd9, 0x6e, 0xf2, 0x37, 0xb2, 0x13, 0xcd, 0x44, 0x6f, 0x13, 0xb3, 0xec, 0x40, 0xd3, 0x2e,
+         0xcc, 0x59, 0x3b, 0xc6, 0xea, 0x71, 0xe7, 0x7e, 0xfc, 0x28, 0x43, 0x41, 0xa5, 0xf3, 0xda, 0x1a,
+         0x7a, 0x62, 0x6a, 0xeb, 0x91, 0xef, 0xcb, 0x5f, 0x97, 0x77, 0x26, 0x4f, 0x5e, 0x17, 0xce, 0xd8,
+         0xb4, 0x11, 0xf6, 0x8c, 0x71, 0x36, 0x73, 0xef, 0x0f, 0x18, 0x4a, 0x5c, 0xcd, 0x60, 0xdb, 0xe3},
+        {0x27, 0x5d, 0x04, 0xf2, 0xb3, 0x51, 0x0c, 0x56, 0x66, 0x4a, 0x80, 0x98, 0xfa, 0xfb, 0x5b, 0x4c,
+         0x95, 0x0d, 0xec, 0x7e, 0x83, 0xf0, 0xcc, 0xc4, 0x83, 0x2d, 0x81, 0x08, 0x97, 0xa2, 0x4a, 0x18,
+         0x57, 0xdd, 0x65, 0x27, 0xda, 0x32, 0x6e, 0xbc, 0xa6, 0x2d, 0xde, 0xad, 0x9b, 0x48, 0x63, 0xda,
+         0xa6, 0x9c, 0x1f, 0x11, 0xa3, 0x9c, 0x37, 0x82, 0xc3, 0xfe, 0x2e, 0x5a, 0x06, 0xb8, 0xb9, 0x3b},
+        {0x5d, 0xc1, 0x7a, 0x11, 0x92, 0xdd, 0xf8, 0xb8, 0x79, 0x94, 0x67, 0x53, 0x71, 0xd8, 0x53, 0x5a,
+         0x42, 0x5c, 0xc5, 0x4d, 0x3a, 0xcc, 0x37, 0x19, 0x5e, 0x2d, 0xa5, 0x01, 0xbb, 0x53, 0x09, 0xc5,
+         0x68, 0x53, 0x8e, 0x31, 0xbe, 0xe7, 0x91, 0x20, 0xe2, 0xf9, 0x7f, 0xd3, 0x01, 0x21, 0xed, 0xd1,
+         0x5e, 0x38, 0xac, 0xdc, 0x2b, 0x98, 0x84, 0xb6, 0x3e, 0x86, 0xf2, 0x1c, 0xad, 0x65, 0x3d, 0x78},
+        {0x3c, 0x3b, 0x6a, 0x92, 0xef, 0xb1, 0xb7, 0x3a, 0x19, 0x0a, 0xab, 0xde, 0xa6, 0x35, 0x75, 0x4e,
+         0xeb, 0x5f, 0xfc, 0x37, 0x6b, 0x2a, 0x07, 0x87, 0xad, 0xbc, 0x2e, 0x7d, 0x31, 0x37, 0x4f, 0x84,
+         0x12, 0x6d, 0x49, 0x70, 0x9e, 0x40, 0xcb, 0x07, 0xb1, 0x22, 0xe9, 0x80, 0xb9, 0x45, 0x2a, 0x94,
+         0x05, 0x5c, 0x87, 0x76, 0x3b, 0x1a, 0x81, 0xe7, 0xee, 0xac, 0x60, 0x39, 0x6d, 0x94, 0xb2, 0x3b},
+        {0x49, 0x62, 0x22, 0x72, 0x54, 0x24, 0x35, 0x9a, 0x98, 0x34, 0x2d, 0xef, 0xfb, 0x03, 0x24, 0x83,
+         0x0e, 0x99, 0x57, 0x2c, 0x6c, 0x57, 0x8e, 0xd9, 0x0f, 0xf3, 0x88, 0x30, 0x00, 0x76, 0x25, 0x36,
+         0x0b, 0x37, 0x06, 0x34, 0xde, 0x2b, 0x0c, 0xe6, 0x1a, 0xac, 0x36, 0xee, 0x69, 0x8f, 0xd3, 0xc1,
+         0xc4, 0x5d, 0xbf, 0x61, 0xc9, 0xdf, 0x9f, 0xcb, 0x2f, 0xdc, 0x19, 0x25, 0xfd, 0x7c, 0xe6, 0x4f},
+        {0x22, 0x01, 0xbf, 0xef, 0xf7, 0x51, 0x53, 0x5d, 0x6b, 0x14, 0xf2, 0x13, 0x29, 0xc1, 0x51, 0x2e,
+         0x84, 0xa6, 0x19, 0xf1, 0x74, 0xe5, 0xa6, 0x59, 0x6e, 0x7d, 0x4c, 0xa8, 0x84, 0x78, 0x18, 0xfd,
+         0x2a, 0xf4, 0xf8, 0xc0, 0xbf, 0xb0, 0x38, 0x0a, 0x17, 0x1f, 0xb1, 0x65, 0xf5, 0xba, 0x2a, 0x76,
+         0x68, 0x7c, 0x12, 0xbd, 0xf2, 0xfc, 0x81, 0xf2, 0x07, 0x72, 0xfd, 0xe6, 0x4c, 0x62, 0x4b, 0xa4},
+        {0x13, 0xe4, 0xb9, 0x50, 0x7e, 0x54, 0x26, 0x50, 0xb2, 0x32, 0x68, 0x77, 0x7e, 0x25, 0x5c, 0x62,
+         0x53, 0xa9, 0x1d, 0x6a, 0xde, 0x2a, 0xaa, 0x93, 0x36, 0x8e, 0x9e, 0x8a, 0x45, 0x50, 0xbb, 0xb3,
+         0x79, 0xcf, 0x2e, 0x8f, 0x8e, 0x6b, 0x97, 0x0a, 0x79, 0x7a, 0x8b, 0x9b, 0x4a, 0xaa, 0x5b, 0xed,
+         0xd1, 0xd6, 0x95, 0x91, 0x6a, 0xd5, 0xfd, 0xed, 0x36, 0xda, 0xd4, 0xbb, 0x27, 0x4a, 0x03, 0xd8},
+        {0x3c, 0xde, 0x77, 0x86, 0x6c, 0xc7, 0x3b, 0x07, 0xa5, 0x2a, 0x9e, 0xce, 0x48, 0x32, 0xe2, 0xa0,
+         0x2c, 0x9a, 0x85, 0xa6, 0x70, 0x9f, 0x5b, 0x9d, 0x4c, 0x71, 0x1d, 0xe4, 0x5b, 0x55, 0x60, 0x55,
+         0x79, 0xf2, 0xb3, 0xd7, 0x7f, 0x3f, 0x44, 0xc7, 0x71, 0xf6, 0x85, 0xb6, 0xd3, 0xd3, 0x52, 0xd7,
+         0xe4, 0xf2, 0x00, 0x72, 0xb6, 0x4e, 0xfc, 0x55, 0xa9, 0x57, 0x43, 0x7e, 0x96, 0x7a, 0x18, 0xf7}
+    },
+    {
+        {0x31, 0xa7, 0x5b, 0x21, 0xcb, 0x53, 0x26, 0x22, 0xa7, 0xca, 0xf9, 0xe2, 0x9e, 0x65, 0x2a, 0xc4,
+         0xe4, 0x7b, 0x14, 0x50, 0xed, 0xf6, 0x65, 0x5a, 0xca, 0xf3, 0x79, 0x7b, 0x55, 0xa7, 0xca, 0x46,
+         0x77, 0x00, 0x6e, 0x7c, 0xf1, 0x04, 0x98, 0x2f, 0x88, 0x65, 0x08, 0x1a, 0x2f, 0xf8, 0xa6, 0x91,
+         0x15, 0x46, 0x75, 0x5e, 0x31, 0xc3, 0x58, 0x63, 0x53, 0xb0, 0xbd, 0x08, 0x26, 0xc5, 0xd7, 0x90},
+        {0x50, 0x7f, 0xdd, 0xb8, 0x28, 0x99, 0x37, 0x75, 0x91, 0x7e, 0xb8, 0xd1, 0x47, 0xc9, 0x4b, 0x42,
+         0x0e, 0x54, 0xc7, 0x87, 0x73, 0x61, 0x63, 0xee, 0x92, 0xf1, 0x4e, 0xf6, 0x09, 0x61, 0x21, 0x81,
+         0x5f, 0xfa, 0x5d, 0x89, 0x98, 0xf8, 0xdf, 0x19, 0x74, 0xf1, 0x13, 0x3f, 0xc8, 0x78, 0xd7, 0xbb,
+         0x58, 0x98, 0x7b, 0x3a, 0xce, 0x81, 0x9d, 0xf0, 0xa0, 0x9f, 0xd6, 0x5d, 0xbe, 0xc0, 0x8f, 0x89},
+        {0x1f, 0xfd, 0x35, 0x20, 0x7e, 0x22, 0xc0, 0x9c, 0xdc, 0x58, 0x75, 0xf4, 0xd7, 0x27, 0x86, 0x42,
+         0x63, 0xf7, 0x80, 0x8a, 0xed, 0x84, 0xd0, 0x26, 0x15, 0x90, 0x1f, 0x47, 0x94, 0x85, 0x35, 0x9e,
+         0x0f, 0x48, 0x76, 0xba, 0x44, 0x0f, 0x6e, 0x46, 0x99, 0xa8, 0x33, 0x6c, 0x23, 0xd0, 0xe6, 0xf8,
+         0x47, 0xdc, 0xa2, 0xf4, 0x12, 0x0b, 0xe5, 0x0e, 0xa3, 0xbb, 0x70, 0xba, 0x97, 0x6f, 0x0e, 0x68},
+        {0x24, 0x7a, 0xb5, 0x33, 0x68, 0xa2, 0xd4, 0xaf, 0xf8, 0xeb, 0x15, 0x8b, 0x29, 0x1e, 0xa4, 0x79,
+         0x69, 0x42, 0xc0, 0xae, 0x43, 0x64, 0xba, 0x27, 0x0e, 0x12, 0x59, 0xe2, 0x37, 0x61, 0x2a, 0xa3,
+         0x33, 0xcb, 0xed, 0x49, 0x44, 0x2e, 0x2e, 0xed, 0x38, 0x4d, 0x45, 0x78, 0x2a, 0x00, 0x2d, 0x3d,
+         0xea, 0x88, 0x06, 0x2b, 0x42, 0xf8, 0x23, 0xb0, 0x01, 0xec, 0xab, 0x1b, 0xdd, 0x33, 0x19, 0x2c},
+        {0x74, 0x48, 0x2e, 0xec, 0xc0, 0x0c, 0xe0, 0x92, 0x11, 0x46, 0x89, 0xb2, 0xb1, 0xbc, 0x16, 0x84,
+         0x1f, 0x5d, 0x76, 0x8e, 0x8c, 0xe2, 0x30, 0x5b, 0x58, 0xe8, 0xf4, 0x16, 0x16, 0x1e, 0x29, 0xe6,
+         0x5c, 0xa3, 0x60, 0xee, 0x53, 0x3e, 0xe3, 0x6f, 0x83, 0x89, 0x32, 0x91, 0x51, 0xb5, 0x42, 0xff,
+         0x03, 0xb8, 0xb4, 0xb7, 0x48, 0x73, 0x17, 0x63, 0x28, 0x9f, 0x76, 0x7c, 0x13, 0x2c, 0x9f, 0xef},
+        {0x1c, 0xbd, 0x55, 0x94, 0xba, 0xa9, 0x03, 0x75, 0xcb, 0x56, 0xec, 0xd5, 0x09, 0x65, 0x35, 0x3a,
+         0x6d, 0x6a, 0xf4, 0xb5, 0x7d, 0xd5, 0xa9, 0x67, 0xc2, 0x4a, 0xdd, 0x3f, 0x90, 0x94, 0x7a, 0xe0,
+         0x5b, 0xf3, 0xa5, 0x3f, 0x63, 0xf1, 0xa0, 0xc2, 0xdc, 0xa5, 0xf9, 0x3f, 0xd3, 0xe1, 0x4b, 0x1e,
+         0x24, 0xf1, 0xfa, 0xa1, 0xcb, 0x16, 0x7d, 0x79, 0x71, 0x86, 0x23, 0xff, 0x0a, 0xdf, 0x2a, 0x82},
+        {0x42, 0xdb, 0x47, 0xab, 0x34, 0xfa, 0xa7, 0xa1, 0xf5, 0x00, 0x7f, 0x7c, 0x9f, 0x2f, 0x09, 0x1f,
+         0x50, 0x84, 0x56, 0x5e, 0xe6, 0x75, 0xc5, 0xff, 0x2c, 0xc2, 0x4a, 0x3f, 0x95, 0xdf, 0x47, 0x05,
+         0x0a, 0x4c, 0xfe, 0x00, 0x6d, 0xde, 0xfa, 0x3e, 0xb7, 0xe7, 0x50, 0x41, 0xe6, 0x41, 0x79, 0xd8,
+         0x2b, 0xe8, 0x85, 0x61, 0xcc, 0x1b, 0xb4, 0xb6, 0xfb, 0x72, 0xc2, 0x3e, 0x39, 0x59, 0xa2, 0xfc},
+        {0x73, 0x00, 0xf9, 0x56, 0xc8, 0x62, 0xbb, 0x5c, 0x5b, 0xce, 0xdb, 0xef, 0x88, 0x00, 0x61, 0xa0,
+         0xad, 0xef, 0x30, 0xab, 0xa7, 0x2e, 0x90, 0x13, 0x11, 0xf8, 0x91, 0x8f, 0x41, 0xe8, 0x68, 0xa0,
+         0x11, 0x6d, 0x41, 0x0a, 0xa3, 0x65, 0xe0, 0x41, 0xa4, 0x3c, 0x07, 0x15, 0x11, 0x11, 0x3f, 0x1a,
+         0x4e, 0x09, 0xcc, 0x70, 0xe3, 0x9f, 0x9e, 0x24, 0x58, 0x28, 0xa3, 0x2d, 0x82, 0xc1, 0x60, 0x3f}
+    },
+    {
+        {0x54, 0x3d, 0x84, 0xcb, 0x04, 0xfb, 0x2b, 0xf7, 0x87, 0xb7, 0xaa, 0x38, 0x2e, 0xaa, 0xb5, 0xcd,
+         0x8d, 0x05, 0x0a, 0xd8, 0xee, 0x52, 0xaa, 0x8a, 0x28, 0x5b, 0x94, 0x56, 0x52, 0x01, 0x40, 0x31,
+         0x03, 0x58, 0xfd, 0xc5, 0xb6, 0x3e, 0xd4, 0x9e, 0x69, 0x3d, 0x83, 0x8f, 0x18, 0x2b, 0x27, 0x58,
+         0x46, 0xf4, 0x2d, 0xd4, 0x9a, 0x42, 0xec, 0x2e, 0x6e, 0x93, 0x2b, 0xa4, 0xde, 0x59, 0xef, 0x20},
+        {0x02, 0xac, 0x4c, 0x03, 0x86, 0xa4, 0x24, 0xb4, 0xa4, 0x27, 0x25, 0x06, 0x18, 0x01, 0x81, 0xc6,
+         0x36, 0x33, 0x95, 0xb4, 0x09, 0x4f, 0x55, 0x1f, 0x6a, 0x70, 0xe1, 0xfb, 0x4f, 0x60, 0x5e, 0xa1,
+         0x01, 0xa3, 0x6c, 0x19, 0xfc, 0x30, 0xe5, 0xe4, 0x6b, 0x07, 0xb2, 0xff, 0x07, 0x21, 0xfb, 0x77,
+         0xff, 0x43, 0x30, 0xe5, 0x54, 0xff, 0xa8, 0x74, 0xf0, 0x07, 0x48, 0x60, 0xd7, 0xde, 0x38, 0x77},
+        {0x2d, 0x2d, 0xd6, 0x67, 0xa2, 0x40, 0xfe, 0x9e, 0x15, 0x05, 0x2c, 0x0f, 0x44, 0x2e, 0x4f, 0x59,
+         0xa3, 0x78, 0x8c, 0x3c, 0xa3, 0x98, 0x90, 0x02, 0xf3, 0xb3, 0xa6, 0xdb, 0x62, 0xa0, 0x39, 0xe9,
+         0x37, 0x7b, 0xd9, 0xdb, 0x79, 0xc5, 0xd8, 0x52, 0x27, 0xba, 0x6d, 0x46, 0x39, 0xbf, 0x0c, 0x8d,
+         0x64, 0xae, 0xfd, 0x11, 0x5c, 0xb8, 0x38, 0xdb, 0x76, 0xe8, 0x79, 0x15, 0x06, 0x55, 0x4d, 0xd1},
+        {0x28, 0x16, 0xf8, 0x43, 0x0d, 0x46, 0x6b, 0x9b, 0x65, 0xd0, 0x99, 0x0c, 0x2f, 0xd6, 0xf4, 0x55,
+         0x86, 0x1f, 0xb6, 0x00, 0xa5, 0x05, 0xf7, 0x29, 0x7c, 0x82, 0x83, 0xd3, 0xac, 0x2c, 0xc5, 0x13,
+         0x54, 0x52, 0xc4, 0xb4, 0x54, 0x30, 0xea, 0x38, 0x35, 0x24, 0xc9, 0x0e, 0xf0, 0xc6, 0x6a, 0xe0,
+         0x87, 0x45, 0xdf, 0x06, 0x64, 0xab, 0x5a, 0x18, 0x4f, 0x89, 0xb1, 0x7e, 0x74, 0xb4, 0x7f, 0x1e},
+        {0x1c, 0xae, 0xba, 0x6f, 0x06, 0xa2, 0xc5, 0xac, 0xfb, 0x15, 0x87, 0x85, 0x05, 0x60, 0xbf, 0xb1,
+         0xe4, 0x7f, 0x47, 0xbf, 0xb9, 0xbc, 0xda, 0x01, 0xad, 0xc4, 0x6a, 0x6f, 0xba, 0x4b, 0xbe, 0xf3,
+         0x65, 0xfc, 0xdc, 0x11, 0xe7, 0xea, 0x75, 0x77, 0x4a, 0x0f, 0xce, 0xf5, 0x42, 0x25, 0xdc, 0x51,
+         0xa9, 0x1e, 0xc1, 0x80, 0xc6, 0xbb, 0xd5, 0x9d, 0x39, 0x65, 0x6a, 0x7b, 0xe9, 0x8d, 0x85, 0xb8},
+        {0x06, 0x0c, 0x29, 0x52, 0xbf, 0x5a, 0xde, 0xf4, 0xc8, 0xc4, 0xea, 0xc7, 0x20, 0xdd, 0x09, 0x67,
+         0xc6, 0xb9, 0xe9, 0x02, 0x53, 0x4c, 0x8c, 0x8c, 0xac, 0x50, 0xf5, 0xd5, 0x19, 0x35, 0xa5, 0xc7,
+         0x10, 0xef, 0x5d, 0x49, 0x44, 0x82, 0x52, 0x49, 0x77, 0xc6, 0x53, 0xdb, 0xb0, 0x1f, 0xbd, 0xdf,
+         0x2b, 0x2c, 0xc5, 0x71, 0xb0, 0x1c, 0xaa, 0x47, 0x34, 0xa8, 0x4b, 0x42, 0x05, 0x42, 0x7f, 0x5b},
+        {0x5d, 0x41, 0x69, 0x89, 0x23, 0xf4, 0xe9, 0x55, 0x16, 0xa1, 0x5f, 0xdc, 0xc0, 0x76, 0x51, 0xf9,
+         0x90, 0x2e, 0x35, 0x91, 0x59, 0x6e, 0x89, 0x2c, 0x45, 0xa5, 0x37, 0xb4, 0x70, 0x1f, 0x0c, 0x00,
+         0x2d, 0x92, 0x79, 0x4a, 0x28, 0xe9, 0xf2, 0xe8, 0xbe, 0xda, 0xde, 0xaf, 0x0b, 0x82, 0x98, 0xfd,
+         0xe4, 0x8a, 0xee, 0x32, 0x7d, 0xd4, 0x10, 0x77, 0xc5, 0x36, 0x47, 0x80, 0xee, 0xf8, 0xbc, 0x11},
+        {0x0c, 0xc4, 0x95, 0xfe, 0x64, 0xbc, 0x48, 0x16, 0x63, 0x7f, 0x94, 0x25, 0x1d, 0xf4, 0xcd, 0xee,
+         0x3c, 0xa7, 0x4a, 0xff, 0x90, 0xc1, 0xe4, 0x27, 0x74, 0x44, 0x89, 0xc1, 0x3f, 0xdc, 0x9f, 0xe9,
+         0x42, 0x13, 0x8e, 0x7b, 0x6c, 0xab, 0x97, 0x7e, 0xfe, 0xc0, 0xd3, 0xe6, 0x69, 0x43, 0x7a, 0xb9,
+         0xe0, 0xf2, 0x28, 0xd3, 0xe3, 0x8c, 0x1a, 0x6f, 0x6a, 0x5e, 0x06, 0x03, 0x6e, 0x75, 0x19, 0x8b}
+    },
+    {
+        {0x0a, 0x28, 0x18, 0xf5, 0xf5, 0xd8, 0x93, 0x78, 0x00, 0xc3, 0x0a, 0xc6, 0xb8, 0x47, 0xdb, 0x2c,
+         0xde, 0xf6, 0x55, 0xb8, 0x64, 0x12, 0x63, 0x02, 0x24, 0x91, 0x44, 0xa5, 0xa1, 0x5b, 0x20, 0x5a,
+         0x18, 0x7c, 0x76, 0xa4, 0x9a, 0xf1, 0x08, 0x51, 0xbb, 0x04, 0x9b, 0xa9, 0x7c, 0x0f, 0xbb, 0xb1,
+         0x4b, 0x26, 0x21, 0x52, 0x2a, 0x4e, 0x8d, 0x96, 0x70, 0xea, 0x46, 0xe5, 0x6c, 0x9a, 0x1b, 0xd6},
+        {0x38, 0x99, 0x73, 0xbe, 0x36, 0x32, 0xbb, 0xbd, 0xac, 0x59, 0xf5, 0x37, 0xaa, 0x63, 0xf2, 0x8a,
+         0xbf, 0x7a, 0x33, 0xb9, 0x15, 0xd5, 0x36, 0x82, 0xa9, 0xeb, 0xd7, 0xd0, 0x40, 0xf7, 0x94, 0xfa,
+         0x4d, 0x6b, 0xb1, 0x93, 0x04, 0xa4, 0x75, 0x33, 0xa4, 0x60, 0x35, 0x8e, 0x9f, 0x3e, 0xae, 0xf4,
+         0xb7, 0x98, 0x4f, 0x8e, 0x99, 0xda, 0xf4, 0xd2, 0xca, 0x99, 0x3d, 0xd8, 0x7a, 0xda, 0xb3, 0x2c},
+        {0x55, 0x74, 0x2e, 0x80, 0x78, 0x7a, 0x6c, 0xe5, 0x86, 0xfc, 0x89, 0x35, 0xd8, 0x01, 0xaf, 0x09,
+         0x99, 0x30, 0x3f, 0xfe, 0xd8, 0xea, 0x50, 0x73, 0xc1, 0x9e, 0x58, 0x91, 0xda, 0x49, 0xcb, 0x23,
+         0x0a, 0xea, 0xbe, 0x3f, 0x0a, 0xbb, 0x88, 0x08, 0x43, 0x9e, 0xde, 0x79, 0x26, 0x04, 0xd7, 0xe3,
+         0xaa, 0x82, 0x33, 0xeb, 0x32, 0x59, 0x73, 0x1d, 0xef, 0x6a, 0x31, 0x75, 0x28, 0x36, 0xce, 0x32},
+        {0x68, 0xc0, 0xbf, 0xb0, 0x03, 0xee, 0xb9, 0x45, 0xd2, 0x9e, 0xc9, 0x1b, 0xa5, 0x7d, 0x64, 0x62,
+         0xc3, 0x6b, 0x42, 0xa8, 0xfd, 0xef, 0xa5, 0xe7, 0xb9, 0x9d, 0x7b, 0x97, 0xcd, 0xa8, 0x9d, 0x97,
+         0x4b, 0x0a, 0xd6, 0xbe, 0x2f, 0xcc, 0xb3, 0x04, 0x2e, 0x21, 0x89, 0xc9, 0xf3, 0xed, 0xac, 0x9f,
+         0x62, 0x79, 0x59, 0x97, 0x56, 0x87, 0x6d, 0x24, 0x6b, 0xa1, 0xd3, 0xf6, 0x2c, 0x84, 0xb7, 0xed},
+        {0x2b, 0xe5, 0x1a, 0x50, 0xea, 0x19, 0x3c, 0xad, 0x93, 0x41, 0x08, 0x0c, 0x3f, 0x2b, 0x07, 0x58,
+         0x61, 0x46, 0x1d, 0x7b, 0xf8, 0x4e, 0x7b, 0x8a, 0x32, 0xb0, 0x2d, 0xfc, 0x5c, 0xea, 0x40, 0x9d,
+         0x78, 0x79, 0x87, 0x48, 0xd1, 0x68, 0xdc, 0x54, 0xcd, 0xe7, 0x92, 0x11, 0xb0, 0x2c, 0xc3, 0x1c,
+         0x90, 0x5a, 0x40, 0x2b, 0xbd, 0x81, 0x2c, 0xba, 0xca, 0x80, 0x69, 0xbf, 0xe4, 0x20, 0xee, 0x72},
+        {0x0b, 0x46, 0x67, 0xcc, 0x7a, 0x19, 0xcc, 0xdb, 0x76, 0x5a, 0xc8, 0x83, 0xc6, 0x1e, 0xe8, 0x46,
+         0x8a, 0x00, 0x6a, 0xf4, 0x55, 0x0c, 0xcb, 0x1b, 0x5d, 0x8b, 0x89, 0x25, 0xed, 0x05, 0x61, 0x39,
+         0x01, 0x6f, 0xe4, 0xeb, 0xb7, 0x8f, 0x74, 0x66, 0x0a, 0x21, 0x72, 0xb2, 0xfe, 0xe7, 0x42, 0x76,
+         0xf8, 0x8f, 0x6c, 0xf8, 0x1c, 0xde, 0xc9, 0x8f, 0xcd, 0xf3, 0x6a, 0xad, 0xa1, 0xc2, 0xcf, 0x53},
+        {0x43, 0x7e, 0x75, 0xb0, 0xc2, 0xe7, 0xb4, 0xdd, 0x6d, 0x7a, 0x99, 0xda, 0x1f, 0xf6, 0x7d, 0x66,
+         0x37, 0x53, 0x66, 0xd3, 0xe5, 0xea, 0xbf, 0x1f, 0x0c, 0x52, 0xf6, 0x81, 0xc7, 0x6f, 0x94, 0x27,
+         0x26, 0x09, 0x89, 0xbe, 0x91, 0x46, 0x30, 0x2f, 0x61, 0x38, 0xab, 0xb9, 0xfa, 0xe8, 0xcf, 0xfc,
+         0x18, 0x83, 0x4c, 0x01, 0xbb, 0x38, 0x73, 0x74, 0x6e, 0xe6, 0x8f, 0x7c, 0x55, 0x2f, 0x90, 0x74},
+        {0x37, 0x10, 0x53, 0x8d, 0x7c, 0xd7, 0x97, 0x1d, 0x68, 0xf1, 0x92, 0x72, 0xdc, 0xfe, 0x0d, 0x7a,
+         0x57, 0x7b, 0x7e, 0x88, 0x99, 0x77, 0x52, 0x6e, 0x62, 0x70, 0x4d, 0xfc, 0xbe, 0x6b, 0x8c, 0x22,
+         0x7d, 0x10, 0x82, 0x7d, 0xb7, 0x4a, 0xe0, 0xdc, 0x09, 0x32, 0x37, 0x17, 0x54, 0x2a, 0x2d, 0xea,
+         0xca, 0x18, 0xab, 0x2a, 0x48, 0xa8, 0xe2, 0x45, 0xe5, 0xa8, 0x27, 0xca, 0x02, 0x77, 0x88, 0x53}
+    },
+    {
+        {0x7e, 0xfb, 0x45, 0xd3, 0xa2, 0x85, 0x11, 0x09, 0xd7, 0xa8, 0xd5, 0x0d, 0xdb, 0x08, 0xfe, 0x30,
+         0x8b, 0xbf, 0x67, 0x4c, 0x01, 0x9b, 0x96, 0x5c, 0xda, 0xd4, 0x57, 0x0a, 0x14, 0x1e, 0x64, 0x8a,
+         0x0f, 0xe1, 0x19, 0x8b, 0x11, 0xa1, 0xbf, 0x56, 0x86, 0x70, 0x91, 0xc6, 0x9d, 0x71, 0xf8, 0xb7,
+         0x79, 0x22, 0x57, 0xdd, 0xa3, 0x21, 0xd4, 0x36, 0x52, 0xe8, 0x18, 0xac, 0xd0, 0xc2, 0x8c, 0xda},
+        {0x5d, 0x52, 0x25, 0xa5, 0xe2, 0x23, 0x5c, 0x52, 0x16, 0xce, 0xbd, 0x18, 0x47, 0xb2, 0xed, 0x69,
+         0xe4, 0x5d, 0xb9, 0x3c, 0xf3, 0xea, 0x8c, 0xf0, 0x12, 0xae, 0x91, 0x8f, 0x2c, 0x98, 0x32, 0x18,
+         0x7e, 0xc9, 0xe5, 0x49, 0x4f, 0xee, 0xcd, 0x8d, 0x34, 0x8a, 0x92, 0x63, 0x6b, 0x5b, 0xab, 0xee,
+         0xc6, 0xb5, 0xab, 0x19, 0x82, 0x77, 0x81, 0x40, 0xbb, 0xee, 0xbc, 0x4e, 0x5d, 0xe7, 0xb1, 0xb9},
+        {0x6d, 0xb3, 0xc0, 0xd1, 0xa1, 0xf2, 0x7f, 0xb0, 0x92, 0x7d, 0xa4, 0x58, 0xc5, 0x09, 0x41, 0x75,
+         0xbf, 0xab, 0xad, 0xba, 0xde, 0xbd, 0x78, 0x5e, 0xe9, 0x9a, 0xc3, 0xcd, 0x22, 0x8b, 0xac, 0x21,
+         0x07, 0xb4, 0x99, 0xec, 0xb9, 0xb1, 0xbd, 0xb3, 0xf1, 0x2e, 0x8f, 0xf0, 0x0f, 0x1c, 0x4e, 0xd6,
+         0x3d, 0x34, 0x98, 0x6f, 0x92, 0xd8, 0xb8, 0xd7, 0x77, 0x76, 0xba, 0x77, 0x75, 0xd0, 0x4f, 0x62},
+        {0x6f, 0xde, 0x98, 0xf5, 0x57, 0xe3, 0x36, 0x09, 0x32, 0xb5, 0x62, 0x23, 0x51, 0x88, 0x6a, 0x89,
+         0x8e, 0x46, 0x39, 0x48, 0x8c, 0x24, 0x33, 0x58, 0x6e, 0x6b, 0x1d, 0x72, 0x9a, 0x2e, 0x57, 0x60,
+         0x69, 0x94, 0x51, 0x0f, 0xbd, 0xad, 0x70, 0x0a, 0xb9, 0xe8, 0x44, 0x13, 0xc2, 0x9c, 0xe0, 0x25,
+         0x25, 0xe5, 0xb1, 0xd1, 0x5b, 0xe5, 0x52, 0x69, 0x87, 0x5b, 0xf9, 0x4a, 0x48, 0x00, 0x2c, 0x8b},
+        {0x73, 0xd4, 0xd9, 0xf5, 0xb9, 0x70, 0x8f, 0xbd, 0xfa, 0x34, 0x57, 0xf8, 0x4e, 0xd4, 0x5d, 0x4f,
+         0xd9, 0xbd, 0x95, 0xf1, 0xa9, 0x1f, 0x07, 0x64, 0x07, 0xb0, 0x7c, 0x40, 0x6e, 0xe8, 0xb4, 0xd5,
+         0x25, 0x6e, 0x14, 0xce, 0xe7, 0xd4, 0x1e, 0x0a, 0x86, 0x5d, 0xf1, 0xa6, 0xa2, 0xd0, 0x37, 0x16,
+         0xb2, 0x0f, 0xa5, 0x2b, 0x32, 0xcc, 0xe3, 0x73, 0x6a, 0x17, 0xc7, 0xfc, 0xc6, 0x69, 0xe5, 0x16},
+        {0x5c, 0x33, 0x70, 0xc1, 0x84, 0xb6, 0xf6, 0x13, 0x03, 0xb2, 0xb6, 0xa3, 0xcb, 0xbb, 0xfb, 0x9a,
+         0x2a, 0x15, 0x4e, 0xd3, 0x21, 0x32, 0x8b, 0x03, 0x50, 0xbf, 0x43, 0xa6, 0xa2, 0x11, 0xa8, 0xa9,
+         0x29, 0x2a, 0x52, 0xd9, 0xe9, 0x33, 0x24, 0x00, 0x5d, 0x35, 0xaa, 0x45, 0xdd, 0x11, 0xab, 0x11,
+         0x05, 0x89, 0x6d, 0xd9, 0x39, 0x03, 0x31, 0x38, 0x7e, 0x76, 0xd7, 0x26, 0x9a, 0x0a, 0xd0, 0x7e},
+        {0x0f, 0x9d, 0xf8, 0xee, 0xf9, 0x56, 0x2a, 0xb6, 0xf1, 0x4c, 0x70, 0xc8, 0xbd, 0xa2, 0xf4, 0x90,
+         0xd3, 0xb5, 0xf2, 0x37, 0x43, 0xfb, 0x6d, 0x40, 0xf8, 0xbf, 0x09, 0xf0, 0x14, 0x38, 0x9c, 0x99,
+         0x42, 0xdd, 0xc0, 0x5b, 0x73, 0x97, 0x0f, 0xe4, 0x37, 0x51, 0xb7, 0x5a, 0x52, 0xf4, 0xc8, 0x42,
+         0xb5, 0x09, 0xee, 0x40, 0x74, 0x30, 0x29, 0x6e, 0xdd, 0x9a, 0x67, 0x4e, 0xb3, 0x3b, 0xe7, 0x30},
+        {0x70, 0x5b, 0xd9, 0x02, 0x7e, 0x77, 0xd8, 0x2d, 0x95, 0x1c, 0x82, 0x05, 0xd3, 0x3a, 0x5b, 0x3c,
+         0x36, 0x95, 0xfe, 0x7e, 0xe7, 0x08, 0x33, 0x03, 0x5f, 0xac, 0x2d, 0x25, 0xa9, 0xab, 0xdc, 0xa2,
+         0x14, 0x17, 0xfa, 0x06, 0x28, 0xeb, 0xc3, 0xa1, 0x94, 0xca, 0x46, 0xd4, 0x23, 0xad, 0x4a, 0x41,
+         0xcf, 0xf0, 0x88, 0x79, 0xe0, 0x2c, 0x8e, 0x51, 0xe0, 0xd6, 0xcd, 0x67, 0x0c, 0x1b, 0xfe, 0xc2}
+    },
+    {
+        {0x47, 0x2e, 0x96, 0x0d, 0xd1, 0x22, 0xa5, 0x34, 0xf5, 0x23, 0x77, 0x23, 0x53, 0x50, 0x54, 0x9d,
+         0xf4, 0xa1, 0xdd, 0x7a, 0x08, 0xcf, 0xc5, 0x80, 0xbf, 0xf5, 0xfb, 0x4b, 0x0a, 0x70, 0xaa, 0x7b,
+         0x10, 0x58, 0x5d, 0x04, 0xfc, 0x52, 0x9f, 0xef, 0x4c, 0x0c, 0x07, 0x76, 0x15, 0x4f, 0xc7, 0xeb,
+         0xba, 0xed, 0xba, 0xe8, 0xa9, 0x99, 0x37, 0xe4, 0x75, 0x98, 0xd0, 0x57, 0x89, 0x32, 0xb7, 0xcc},
+        {0x37, 0x34, 0xc7, 0xd5, 0x0a, 0xa7, 0x34, 0x03, 0xb9, 0x27, 0x23, 0xa9, 0x44, 0xd6, 0xc9, 0x0c,
+         0xec, 0x86, 0xc7, 0x37, 0x77, 0x4d, 0xbc, 0x44, 0x18, 0xa1, 0xa6, 0x69, 0x3d, 0xcc, 0xc5, 0x8b,
+         0x41, 0x6c, 0x8b, 0x45, 0x80, 0x5e, 0xa8, 0x4f, 0xa8, 0x24, 0x7c, 0xfc, 0x6a, 0x0b, 0x0d, 0x0f,
+         0xcd, 0xc5, 0x66, 0xe2, 0xd8, 0x11, 0xad, 0xff, 0x28, 0x99, 0xf9, 0xee, 0x66, 0x3e, 0x7e, 0xf9},
+        {0x37, 0x95, 0x77, 0x8e, 0x98, 0x03, 0x8e, 0xab, 0xc8, 0x1d, 0x0f, 0x53, 0xab, 0xb4, 0x53, 0xac,
+         0xaa, 0x49, 0x99, 0x52, 0x2b, 0x6e, 0xce, 0x1c, 0xc1, 0xe5, 0x02, 0xad, 0xd6, 0x03, 0x72, 0xdd,
+         0x4e, 0xc9, 0xef, 0x10, 0x0b, 0xb1, 0x3d, 0x19, 0x34, 0xd5, 0xdc, 0xe9, 0x38, 0xaa, 0xf7, 0x7c,
+         0xe4, 0x20, 0x38, 0x1b, 0x1d, 0xe1, 0x61, 0xbe, 0x01, 0x83, 0x90, 0xe3, 0x90, 0xfe, 0xd8, 0xd3},
+        {0x3c, 0x3c, 0x51, 0xd3, 0xa3, 0x01, 0xc6, 0x38, 0x68, 0xa0, 0x41, 0xb4, 0x21, 0x0b, 0x71, 0xc3,
+         0x67, 0x5e, 0xff, 0xc0, 0x21, 0x03, 0x60, 0xdb, 0xea, 0xf2, 0x77, 0x8d, 0xf7, 0xec, 0x1e, 0xef,
+         0x6c, 0x16, 0x1e, 0xc4, 0xde, 0x54, 0xd5, 0x1b, 0x1a, 0x83, 0x9d, 0x13, 0xf5, 0x0e, 0x02, 0x74,
+         0xbd, 0x11, 0xc9, 0x3f, 0x72, 0x2e, 0xc4, 0x4a, 0xb2, 0x13, 0x42, 0xef, 0x4b, 0xd6, 0xf8, 0x92},
+        {0x48, 0xcf, 0xac, 0x0a, 0xdf, 0x54, 0xf4, 0xed, 0xdb, 0xac, 0xd9, 0x74, 0x67, 0xd3, 0xa3, 0x42,
+         0xe2, 0x40, 0x99, 0xa8, 0x2f, 0x2d, 0x85, 0x1c, 0x91, 0xad, 0xc9, 0x1a, 0x26, 0x95, 0x83, 0x8d,
+         0x0d, 0x80, 0xcf, 0xfe, 0x71, 0x64, 0x6d, 0x4d, 0x33, 0xd9, 0xf4, 0xcf, 0xbd, 0xff, 0x73, 0x2b,
+         0xd9, 0x37, 0x09, 0x94, 0xe1, 0xd1, 0xdf, 0x44, 0xd6, 0xf4, 0x83, 0xc9, 0x7b, 0x40, 0x46, 0x1f},
+        {0x26, 0xec, 0x59, 0x92, 0xdb, 0xb0, 0x2b, 0x27, 0x65, 0xe4, 0xbf, 0xc1, 0x7d, 0x1f, 0x73, 0x4f,
+         0xb7, 0x36, 0x51, 0xed, 0x94, 0xc9, 0xf4, 0x2c, 0x3b, 0x11, 0x12, 0xf3, 0x49, 0x1a, 0xd2, 0x90,
+         0x47, 0xdb, 0x6a, 0xdc, 0x7e, 0x17, 0x6b, 0xea, 0x3a, 0x9b, 0xec, 0x06, 0xc6, 0x47, 0x7b, 0xd8,
+         0x16, 0x34, 0xe3, 0xbc, 0x23, 0x13, 0x32, 0x52, 0x01, 0xc6, 0xa9, 0x6e, 0x9e, 0xb3, 0x73, 0x04},
+        {0x6a, 0x4f, 0xbb, 0xed, 0x3e, 0x29, 0xc2, 0x84, 0xcc, 0xdd, 0xbe, 0x46, 0xe7, 0xe0, 0x38, 0x73,
+         0x6b, 0x51, 0x25, 0xb7, 0xeb, 0x04, 0x5c, 0x0c, 0x94, 0x15, 0xfe, 0xdc, 0x27, 0xb9, 0x1f, 0x2b,
+         0x6c, 0x63, 0x10, 0xa5, 0xd0, 0x2b, 0xe1, 0xbe, 0x94, 0x52, 0x9f, 0x7b, 0x15, 0xa5, 0xfb, 0x9a,
+         0xd7, 0x8a, 0xe7, 0x37, 0xa9, 0x17, 0xaa, 0xf3, 0xb9, 0xbb, 0xee, 0x59, 0x33, 0xf7, 0x42, 0x86},
+        {0x2a, 0x4e, 0xbd, 0x10, 0x72, 0x84, 0x2b, 0x78, 0x8e, 0xa2, 0x27, 0x27, 0xc6, 0x76, 0xcc, 0xe2,
+         0xbd, 0xb6, 0xfa, 0xac, 0x56, 0xc6, 0x9c, 0x28, 0xc3, 0xe6, 0x94, 0xaa, 0x63, 0xe4, 0x52, 0x27,
+         0x49, 0xb8, 0x57, 0x65, 0x4a, 0x0e, 0x51, 0x92, 0x7b, 0xcb, 0xbd, 0x26, 0xfd, 0x2d, 0xd7, 0x18,
+         0xc3, 0xc8, 0xd1, 0xd1, 0x96, 0xa5, 0x6e, 0xc9, 0x50, 0x80, 0x61, 0x04, 0xef, 0x23, 0xa7, 0xea}
+    },
+    {
+        {0x04, 0x89, 0x2c, 0xff, 0xf7, 0xf9, 0x4f, 0xf7, 0xf0, 0x7c, 0x12, 0x41, 0xe3, 0xac, 0x49, 0x45,
+         0xbc, 0x46, 0xea, 0x9d, 0x6a, 0x3c, 0x1c, 0x3a, 0xdb, 0xce, 0x10, 0x9a, 0x9a, 0xfc, 0xeb, 0x6a,
+         0x3a, 0xe2, 0xaa, 0x25, 0xe2, 0x55, 0x51, 0x35, 0xa7, 0xa3, 0x25, 0x1c, 0x11, 0xa3, 0xf8, 0xee,
+         0xbe, 0x81, 0x75, 0x8b, 0xc1, 0xc3, 0xe2, 0xcb, 0xc6, 0xe6, 0xca, 0x46, 0x1a, 0x54, 0x31, 0x30},
+        {0x60, 0xc4, 0x97, 0x78, 0x0d, 0x40, 0xc8, 0xb1, 0xba, 0x4f, 0x5d, 0xc4, 0xa2, 0x26, 0x2b, 0x84,
+         0x52, 0x80, 0x83, 0xf7, 0x70, 0xb0, 0x7a, 0xf0, 0xfa, 0x76, 0x09, 0x8a, 0x9f, 0x10, 0x48, 0xb4,
+         0x22, 0xfa, 0x44, 0xee, 0x0e, 0xb5, 0x02, 0x08, 0x4f, 0x6c, 0xa2, 0x08, 0xed, 0x07, 0x57, 0x57,
+         0x2f, 0xa5, 0xb2, 0x5d, 0x76, 0xf3, 0x0b, 0x5f, 0x73, 0x38, 0x40, 0xc7, 0x08, 0x6c, 0xb1, 0xd4},
+        {0x7d, 0x72, 0x25, 0xda, 0xfd, 0x9c, 0x43, 0xb5, 0x9f, 0x53, 0xde, 0x50, 0xa2, 0x23, 0x2f, 0x20,
+         0x79, 0xfd, 0x51, 0x2e, 0xc2, 0xcd, 0xc0, 0x40, 0x1d, 0x09, 0x4d, 0x52, 0x8a, 0x5f, 0x75, 0x98,
+         0x63, 0xe0, 0x30, 0x38, 0x8d, 0x50, 0xaa, 0xff, 0xa9, 0x2e, 0xf6, 0x2d, 0xdd, 0x0c, 0x7c, 0x69,
+         0x77, 0x33, 0x6f, 0x22, 0xff, 0x2e, 0xf9, 0xed, 0xe1, 0x9d, 0xb1, 0x8d, 0x4e, 0xeb, 0xfb, 0x4e},
+        {0x48, 0x0d, 0x81, 0x60, 0x72, 0xeb, 0x67, 0xbf, 0xb2, 0xaa, 0xa7, 0x81, 0xfa, 0x53, 0x16, 0x97,
+         0x89, 0x47, 0xe1, 0x0d, 0xeb, 0x8b, 0x7f, 0x31, 0x65, 0x56, 0x19, 0x04, 0xa6, 0x3f, 0x00, 0x0f,
+         0x55, 0x2d, 0x0f, 0x1d, 0x6b, 0xda, 0x43, 0xb5, 0x7e, 0x73, 0x87, 0x5b, 0x49, 0x99, 0x52, 0xc0,
+         0x16, 0xaf, 0x17, 0xac, 0x43, 0x6b, 0xaf, 0x67, 0x1e, 0x56, 0x84, 0xa8, 0xcd, 0x33, 0x13, 0x7e},
+        {0x14, 0x8a, 0x7d, 0x88, 0xb2, 0x00, 0xdc, 0x22, 0x4b, 0x62, 0xa9, 0x23, 0xb9, 0xf5, 0x8c, 0x9e,
+         0x32, 0x3f, 0x47, 0x67, 0x05, 0x3e, 0x57, 0xcb, 0xeb, 0x3b, 0x3f, 0x7e, 0x95, 0x22, 0x1d, 0xa8,
+         0x4f, 0x4f, 0x0b, 0x1a, 0x20, 0x84, 0x34, 0x03, 0xc6, 0x46, 0x34, 0x5b, 0xe0, 0x83, 0xda, 0x0f,
+         0x8f, 0x80, 0x2a, 0xf5, 0x53, 0x14, 0x65, 0x9e, 0x2b, 0x1a, 0xdf, 0xea, 0xd4, 0xe8, 0x89, 0xb4},
+        {0x13, 0x01, 0x30, 0xd1, 0x8b, 0x59, 0xca, 0x9d, 0x78, 0xa8, 0xdd, 0x09, 0xfc, 0xf8, 0x5f, 0x14,
+         0x7e, 0x19, 0x75, 0xa5, 0x69, 0x30, 0xe1, 0xcb, 0x1c, 0x93, 0x3f, 0x84, 0xff, 0x1f, 0x58, 0xe9,
+         0x29, 0xc2, 0x24, 0xfb, 0x2d, 0xb0, 0xa7, 0x45, 0x2b, 0x55, 0xd9, 0xdc, 0xef, 0xfe, 0x46, 0x5a,
+         0x89, 0x11, 0xd9, 0xd5, 0x9c, 0x70, 0x59, 0x00, 0x70, 0x99, 0x89, 0x4b, 0xc5, 0x03, 0x76, 0xff},
+        {0x36, 0xc2, 0xe3, 0xfa, 0x23, 0xdb, 0x33, 0x7f, 0xcb, 0x93, 0xfb, 0xe3, 0x09, 0xf5, 0x4f, 0x2e,
+         0xf6, 0x51, 0xbd, 0x54, 0xbb, 0x70, 0x8f, 0xd5, 0xc9, 0xf8, 0x38, 0xd4, 0x64, 0x84, 0x87, 0x9b,
+         0x0c, 0x5c, 0x48, 0x85, 0x42, 0x84, 0x4d, 0x35, 0x87, 0xd1, 0x93, 0x44, 0x28, 0xef, 0x0e, 0xb2,
+         0x7c, 0x2f, 0x08, 0xa7, 0x27, 0x87, 0x75, 0x7c, 0x7d, 0xe1, 0x3c, 0xe5, 0x3e, 0xeb, 0x86, 0x4d},
+        {0x37, 0x8e, 0x98, 0x82, 0x4a, 0x6b, 0xc4, 0xf1, 0xf8, 0x2d, 0x26, 0xf7, 0x46, 0x90, 0x66, 0x80,
+         0x08, 0x6c, 0xab, 0xa8, 0xf7, 0xe0, 0x90, 0x2b, 0x97, 0xc4, 0x82, 0xac, 0x0b, 0xf8, 0x06, 0x38,
+         0x11, 0x42, 0x14, 0x78, 0x0d, 0x62, 0x1d, 0x31, 0xb8, 0x6d, 0x6e, 0x60, 0xfe, 0x7b, 0x92, 0xc4,
+         0x8e, 0xa2, 0x28, 0x34, 0x75, 0x3d, 0x0a, 0xe0, 0x1b, 0xb2, 0x3f, 0xd4, 0xb8, 0xee, 0xb4, 0x8e}
+    },
+    {
+        {0x24, 0x01, 0xd3, 0x11, 0xa3, 0xab, 0xfd, 0x25, 0x83, 0xf1, 0xc6, 0xaa, 0x51, 0x9c, 0x1f, 0x18,
+         0xff, 0x73, 0x0a, 0x0a, 0xbf, 0x73, 0x0d, 0xdc, 0xc9, 0xc9, 0x73, 0x9b, 0x04, 0xd8, 0xa8, 0x5e,
+         0x65, 0x32, 0x24, 0xf3, 0x48, 0x8c, 0xae, 0x1a, 0xe1, 0x9a, 0x41, 0x4a, 0x99, 0x32, 0x03, 0x5a,
+         0x2b, 0xf2, 0xc4, 0x68, 0x03, 0xb5, 0x53, 0x2b, 0xbb, 0x64, 0x5e, 0x62, 0x38, 0x7e, 0xe3, 0x4d},
+        {0x72, 0x96, 0x4d, 0x27, 0x8e, 0x03, 0x26, 0xe8, 0x48, 0x01, 0xf1, 0x2b, 0xfb, 0x0c, 0x0c, 0xb1,
+         0xed, 0xbf, 0x8b, 0xed, 0xf2, 0x73, 0xe5, 0xb2, 0xb3, 0xf4, 0xea, 0x8c, 0x3a, 0xad, 0xdd, 0xe8,
+         0x0e, 0xb4, 0xac, 0xe1, 0xc6, 0xb7, 0x22, 0x0c, 0x42, 0x11, 0xbb, 0x02, 0x3c, 0x76, 0x44, 0x33,
+         0x04, 0xc2, 0x26, 0x3b, 0xa1, 0xd4, 0x9c, 0xf2, 0x7c, 0x4d, 0x26, 0xc9, 0x60, 0x3b, 0x09, 0xc8},
+        {0x4d, 0x43, 0x2d, 0xef, 0xb5, 0x96, 0xb9, 0x61, 0xec, 0x88, 0x16, 0xf8, 0xa1, 0x85, 0x62, 0x5d,
+         0x6b, 0x54, 0x2a, 0x7a, 0x7b, 0xe0, 0x5a, 0xbf, 0xfc, 0x30, 0x67, 0xde, 0xef, 0xe7, 0x85, 0x6f,
+         0x0c, 0x21, 0xc6, 0x40, 0x57, 0x35, 0xc8, 0x27, 0x08, 0x4f, 0x1d, 0x1d, 0x57, 0x20, 0x7f, 0x98,
+         0x97, 0x69, 0xe9, 0xd8, 0xd1, 0x77, 0x47, 0x80, 0xff, 0x6c, 0xcf, 0xe4, 0xcc, 0x33, 0x31, 0x7c},
+        {0x5a, 0xa0, 0x6a, 0x8b, 0x5d, 0xdb, 0x35, 0x0d, 0x8c, 0x58, 0x30, 0x62, 0x57, 0xec, 0xbf, 0x21,
+         0x9d, 0x00, 0x70, 0xca, 0xa4, 0xf9, 0x86, 0xc7, 0x8f, 0xdf, 0x8e, 0x42, 0xfa, 0x9b, 0x8e, 0xd2,
+         0x79, 0x20, 0x27, 0x7c, 0xec, 0x6d, 0x1e, 0x37, 0xa5, 0xf2, 0x67, 0xd8, 0xfc, 0xe2, 0x32, 0xdf,
+         0xe3, 0x8b, 0xf8, 0x58, 0x97, 0x3b, 0x89, 0x5f, 0x26, 0x11, 0xdd, 0x20, 0x0d, 0x7c, 0x58, 0xc1},
+        {0x28, 0x93, 0x9b, 0x07, 0x2b, 0xd7, 0x97, 0x55, 0x3a, 0x71, 0x4e, 0x57, 0x46, 0xf1, 0x5d, 0xf6,
+         0x5f, 0x1f, 0x4b, 0x9d, 0x90, 0xa3, 0x54, 0x4d, 0x63, 0x55, 0x50, 0x48, 0x91, 0x74, 0xf3, 0x06,
+         0x3c, 0xb9, 0xe3, 0x8e, 0xfb, 0x1c, 0x2d, 0x4a, 0x7b, 0x6d, 0x20, 0x74, 0xf1, 0xcf, 0xc1, 0x7e,
+         0x2f, 0x94, 0xb4, 0xc7, 0x9e, 0x15, 0xc4, 0xf1, 0x47, 0xe4, 0xa3, 0xa6, 0xd0, 0x46, 0x47, 0x39},
+        {0x01, 0x90, 0x16, 0xd6, 0x85, 0xce, 0xf7, 0x88, 0xdf, 0x02, 0x38, 0x44, 0xb8, 0x2b, 0x58, 0x2a,
+         0xbb, 0x45, 0x00, 0xbe, 0x85, 0xdf, 0x80, 0xe1, 0xd2, 0xb2, 0x47, 0x85, 0x58, 0x6e, 0xd5, 0x48,
+         0x7e, 0xb9, 0x56, 0xee, 0x0a, 0xb3, 0x0c, 0x89, 0xf9, 0x5c, 0xcb, 0x01, 0xab, 0x0f, 0x5e, 0xdf,
+         0x02, 0xbb, 0x23, 0x15, 0x54, 0x98, 0x12, 0x91, 0x4d, 0x98, 0x73, 0x50, 0xde, 0x91, 0xd3, 0xe0},
+        {0x35, 0xc5, 0x7d, 0xaf, 0x7d, 0x76, 0x95, 0x92, 0x25, 0x42, 0x7d, 0xd6, 0xba, 0x19, 0x32, 0x5a,
+         0x01, 0xc0, 0xba, 0xaf, 0xee, 0x18, 0x26, 0x54, 0x07, 0xbb, 0x31, 0x6c, 0x55, 0xe0, 0xf8, 0xdf,
+         0x47, 0x1c, 0xc9, 0x1d, 0xcf, 0xe0, 0x2c, 0x56, 0xb8, 0x38, 0xdb, 0x27, 0xd7, 0x4f, 0x9d, 0x93,
+         0xd0, 0x19, 0xd0, 0x3d, 0xc5, 0x7c, 0x83, 0x2d, 0xcd, 0xb4, 0x35, 0xc1, 0x8d, 0x43, 0x6f, 0xbc},
+        {0x0e, 0xbb, 0x89, 0xef, 0xa7, 0x9e, 0x3b, 0x56, 0xb7, 0x56, 0x63, 0xd9, 0x50, 0x36, 0x2c, 0x44,
+         0x14, 0x40, 0xce, 0x14, 0x25, 0x79, 0x2c, 0xf1, 0x96, 0x23, 0x45, 0x95, 0xfa, 0xc0, 0xe9, 0xd0,
+         0x0e, 0x5f, 0x7b, 0x80, 0x00, 0x52, 0x48, 0xf8, 0x0d, 0xa7, 0xd7, 0x38, 0xdf, 0x4c, 0x11, 0xa7,
+         0x0f, 0x30, 0x01, 0x8d, 0x74, 0xe8, 0x71, 0x78, 0x0a, 0x1c, 0x82, 0xcc, 0x0a, 0xdc, 0x7f, 0xce}
+    },
+    {
+        {0x0e, 0xa2, 0xc8, 0x46, 0xa5, 0x35, 0xa1, 0x15, 0x97, 0x21, 0x61, 0x61, 0x2a, 0x19, 0x25, 0x88,
+         0xd9, 0x2d, 0x68, 0xa3, 0xc9, 0x05, 0x0e, 0xae, 0x91, 0xb2, 0x81, 0x7b, 0x94, 0xe6, 0x83, 0x25,
+         0x3b, 0x82, 0xa8, 0x33, 0x7b, 0x05, 0xf1, 0x1b, 0xba, 0xc1, 0x76, 0xa1, 0x13, 0xbe, 0x18, 0x3a,
+         0x50, 0xa0, 0x33, 0x1f, 0x3d, 0x31, 0x16, 0xf2, 0x4b, 0x97, 0x1b, 0x5a, 0x8b, 0x0d, 0x03, 0x1b},
+        {0x56, 0x1d, 0x2c, 0x1d, 0x67, 0x3a, 0x0e, 0x91, 0x87, 0x6d, 0xad, 0x49, 0xd7, 0xc6, 0xa6, 0xc6,
+         0xdd, 0xc4, 0x06, 0x84, 0x45, 0x22, 0x6d, 0x2a, 0x0e, 0x77, 0x7d, 0xbc, 0xd2, 0x5c, 0x5f, 0x3d,
+         0x2d, 0xac, 0x09, 0x92, 0x5d, 0x76, 0x22, 0x6b, 0xdc, 0x77, 0x6a, 0x33, 0x09, 0xcc, 0xec, 0xec,
+         0x6d, 0xe6, 0x69, 0x23, 0x70, 0xdb, 0xd0, 0xde, 0x19, 0xe5, 0xd2, 0xd4, 0xcf, 0x74, 0x7a, 0xfe},
+        {0x70, 0x23, 0x1a, 0x09, 0x25, 0x65, 0xf0, 0xc7, 0xb9, 0x06, 0xe3, 0x7b, 0x3a, 0x29, 0x87, 0xd2,
+         0xb2, 0xd0, 0x1c, 0xf9, 0xef, 0xde, 0x53, 0xf4, 0x02, 0xc0, 0x33, 0xc6, 0xe4, 0xad, 0x2a, 0xf6,
+         0x1d, 0xf8, 0xdc, 0x63, 0x45, 0x75, 0xbb, 0x96, 0x52, 0xa7, 0xc1, 0x4b, 0xad, 0xf5, 0x23, 0x56,
+         0x5c, 0x5b, 0x6a, 0xe5, 0x51, 0x17, 0x6e, 0xe1, 0xa4, 0x61, 0x06, 0x42, 0xc9, 0x85, 0xa6, 0xc2},
+        {0x14, 0x0b, 0x6f, 0x1e, 0x4b, 0xad, 0x46, 0x89, 0x66, 0x17, 0xdb, 0xbc, 0x2d, 0x4b, 0x1b, 0xed,
+         0xac, 0xce, 0x41, 0x2c, 0xab, 0x91, 0xf0, 0x01, 0x5e, 0x12, 0xdb, 0xd3, 0xeb, 0x17, 0x15, 0x23,
+         0x44, 0x4e, 0xb3, 0x59, 0x8c, 0xca, 0xff, 0x53, 0xdc, 0x27, 0x2b, 0x0e, 0xd8, 0xd7, 0x54, 0x3e,
+         0x12, 0x70, 0xb0, 0x4a, 0x5d, 0xa3, 0x4f, 0x18, 0x22, 0x48, 0x2d, 0x77, 0xb6, 0xbf, 0xce, 0x11},
+        {0x34, 0xbd, 0x49, 0xed, 0xfa, 0x2d, 0xd7, 0xb8, 0x10, 0xca, 0x6b, 0xae, 0x43, 0x16, 0x3d, 0xff,
+         0x4f, 0x4f, 0x94, 0x5d, 0x01, 0x07, 0x54, 0x75, 0x54, 0x56, 0x52, 0x25, 0x0a, 0xb3, 0x83, 0x65,
+         0x73, 0xfe, 0xaa, 0x96, 0xbb, 0xe6, 0x1e, 0x5e, 0x37, 0x89, 0x7c, 0x4d, 0xee, 0x6d, 0x4c, 0x8e,
+         0xeb, 0x3d, 0x67, 0x5a, 0x06, 0x0e, 0x0b, 0x67, 0x8d, 0x1a, 0x21, 0x7e, 0xdf, 0xd3, 0x4c, 0x25},
+        {0x70, 0xd9, 0x90, 0x08, 0xff, 0xcb, 0x5d, 0x61, 0xae, 0x39, 0x92, 0x13, 0x64, 0xa5, 0xa3, 0x74,
+         0x81, 0x0c, 0xd0, 0xe2, 0x15, 0x7f, 0xe6, 0xf0, 0xbb, 0x5a, 0x8e, 0x8a, 0x83, 0x74, 0x4e, 0xb5,
+         0x56, 0xb1, 0x25, 0x24, 0x3a, 0x06, 0x95, 0x93, 0x2e, 0x32, 0x9a, 0xf9, 0x21, 0x9f, 0x82, 0x71,
+         0x03, 0x98, 0x3b, 0x62, 0x14, 0x1d, 0xf7, 0xe8, 0xbc, 0x8e, 0xc5, 0x4e, 0x72, 0x6c, 0x32, 0xb9},
+        {0x7b, 0x50, 0x47, 0x6b, 0x0a, 0x33, 0x70, 0x9b, 0xf8, 0xdd, 0x32, 0x60, 0xcb, 0xf7, 0xf1, 0x6c,
+         0x2d, 0x41, 0xe6, 0x05, 0x11, 0x31, 0xba, 0x9c, 0xa3, 0xf3, 0xab, 0xc4, 0x49, 0xa3, 0xd1, 0xa4,
+         0x24, 0x48, 0xc3, 0xec, 0x70, 0x26, 0xfd, 0x42, 0x50, 0x9d, 0x90, 0x12, 0xa2, 0xf1, 0x86, 0x23,
+         0xb4, 0xdd, 0xc9, 0xd2, 0x1d, 0x8b, 0xdf, 0x5e, 0x57, 0xb1, 0x2a, 0x1e, 0x8b, 0xaa, 0x33, 0xcc},
+        {0x0a, 0x9f, 0xcf, 0x41, 0xf6, 0xef, 0x7c, 0xcb, 0x54, 0x5e, 0x61, 0x5e, 0x13, 0x35, 0x44, 0x32,
+         0x29, 0xa1, 0x82, 0x28, 0x45, 0xec, 0xc0, 0x7e, 0x39, 0x21, 0xb2, 0x66, 0x0f, 0x61, 0x76, 0x07,
+         0x73, 0x2f, 0xb4, 0xfa, 0xed, 0x16, 0x73, 0xa8, 0xd2, 0x3b, 0x79, 0xb5, 0xab, 0x93, 0x56, 0xc1,
+         0x8c, 0x58, 0x6f, 0x39, 0x5d, 0x96, 0xd2, 0x24, 0x9f, 0x8a, 0xe6, 0xc3, 0x84, 0xda, 0xf9, 0xdd}
+    },
+    {
+        {0x0f, 0xb3, 0xf8, 0x7c, 0x2c, 0x6c, 0x89, 0xc6, 0x5b, 0x74, 0x29, 0x9b, 0x77, 0xf3, 0x73, 0x65,
+         0x46, 0xa8, 0xb9, 0xe4, 0x1b, 0x19, 0x19, 0x74, 0x76, 0xbf, 0xf2, 0x73, 0x54, 0xe1, 0xc1, 0x28,
+         0x10, 0x34, 0xd4, 0x2c, 0x15, 0xa2, 0xbf, 0xe3, 0xe6, 0x82, 0xfa, 0xd4, 0x9d, 0xbc, 0x28, 0x12,
+         0xca, 0xad, 0xf0, 0xc5, 0x84, 0xbc, 0x30, 0xb5, 0x16, 0x25, 0xb8, 0x5d, 0x74, 0xe9, 0xd5, 0xf7},
+        {0x7b, 0x6a, 0x55, 0x65, 0x77, 0x86, 0x38, 0x3d, 0x35, 0x9c, 0x5b, 0x5f, 0x2f, 0x6c, 0xc8, 0x14,
+         0x79, 0x0f, 0x85, 0x27, 0xd9, 0xd6, 0x7f, 0x6c, 0x67, 0xa5, 0x31, 0x0e, 0xba, 0x46, 0xb1, 0x61,
+         0x0c, 0xb7, 0xac, 0xea, 0x0e, 0xac, 0x73, 0x9a, 0x61, 0xd5, 0x26, 0xf6, 0xed, 0xdb, 0x85, 0x71,
+         0x14, 0xa3, 0x2d, 0x8f, 0x09, 0x99, 0x58, 0x26, 0xf1, 0x43, 0x1b, 0x60, 0x66, 0x3a, 0xb0, 0xd3},
+        {0x05, 0xff, 0x83, 0x4d, 0x7f, 0x1a, 0x77, 0x0a, 0x34, 0xfb, 0xeb, 0xb2, 0x70, 0x8e, 0xfd, 0x73,
+         0x7a, 0x71, 0xca, 0xca, 0xc0, 0xf0, 0x20, 0xf5, 0x69, 0x8a, 0xb4, 0x66, 0x6b, 0xa7, 0xda, 0xeb,
+         0x3b, 0xce, 0xd5, 0x29, 0x48, 0x98, 0x8b, 0x4d, 0xfb, 0xd5, 0x61, 0xcd, 0x9d, 0x6a, 0x8b, 0xe0,
+         0x2e, 0x01, 0x6f, 0x75, 0x5b, 0x68, 0x58, 0x14, 0x36, 0xe5, 0x32, 0x06, 0xa4, 0x42, 0x23, 0xe8},
+        {0x5a, 0xd2, 0x58, 0x70, 0xb2, 0xc1, 0x61, 0xc6, 0x71, 0xb0, 0x14, 0xf5, 0x48, 0xbf, 0xd2, 0x41,
+         0x14, 0xe5, 0x4b, 0xac, 0x5c, 0x67, 0x5f, 0x43, 0xe7, 0x9f, 0x10, 0x0e, 0x17, 0xe5, 0xf4, 0x5e,
+         0x65, 0xc7, 0x75, 0xed, 0xcb, 0x82, 0xb0, 0xb2, 0x60, 0x40, 0xf9, 0xf5, 0xed, 0x43, 0xf8, 0xed,
+         0x61, 0xba, 0x00, 0x42, 0x7f, 0xc9, 0x2b, 0x50, 0xbd, 0xdc, 0x94, 0x92, 0x07, 0x16, 0xba, 0x2d},
+        {0x32, 0x35, 0x42, 0x20, 0xdb, 0x57, 0x26, 0xd3, 0x3e, 0x67, 0x52, 0x1a, 0x73, 0x97, 0xc3, 0x17,
+         0x33, 0x60, 0x34, 0xae, 0x12, 0x13, 0x65, 0x66, 0x93, 0x31, 0x4a, 0x75, 0xa8, 0x6d, 0x88, 0xbc,
+         0x4c, 0xea, 0x7e, 0x04, 0xf5, 0x10, 0x34, 0x0c, 0x45, 0xe1, 0x76, 0x3f, 0xf3, 0x45, 0x85, 0x43,
+         0xe8, 0xac, 0xb0, 0x6c, 0x69, 0x11, 0xd5, 0x51, 0x1a, 0x77, 0x6c, 0x6a, 0x80, 0xd9, 0x52, 0x67},
+        {0x53, 0x58, 0x64, 0xa2, 0xce, 0x9f, 0xe8, 0xce, 0x7f, 0x6c, 0x68, 0xed, 0xe8, 0x46, 0xc4, 0x78,
+         0x53, 0xfb, 0x56, 0xbe, 0x66, 0x7e, 0x34, 0x67, 0xa6, 0x39, 0xa7, 0x40, 0x09, 0x0d, 0xba, 0x80,
+         0x09, 0x88, 0xc3, 0xb9, 0xb7, 0x33, 0x36, 0x6f, 0xfd, 0x8a, 0x97, 0xc0, 0xd5, 0xe2, 0x15, 0x3b,
+         0x89, 0xc1, 0x2d, 0xac, 0x2b, 0x73, 0x43, 0xe2, 0x33, 0x21, 0x59, 0x7b, 0xc2, 0xa9, 0xc1, 0xe8},
+        {0x10, 0x42, 0x12, 0x96, 0xcc, 0x4b, 0x00, 0xdf, 0x0b, 0xb5, 0x99, 0x88, 0x58, 0x4e, 0xd1, 0xbd,
+         0x31, 0xe3, 0x71, 0x9e, 0xa2, 0x03, 0x66, 0x8d, 0x1a, 0xc3, 0xb9, 0x49, 0xcd, 0xb6, 0x1d, 0x31,
+         0x59, 0xe6, 0xc0, 0xc2, 0x78, 0xa9, 0x35, 0x83, 0xb4, 0x4c, 0x31, 0xa8, 0x52, 0x3f, 0x83, 0x60,
+         0x1f, 0xcf, 0x76, 0xab, 0x7d, 0x07, 0x4e, 0x50, 0x0e, 0x97, 0x63, 0x3d, 0x29, 0x3e, 0x2c, 0x8b},
+        {0x3f, 0x18, 0x36, 0x2f, 0xf2, 0x2f, 0x58, 0x3b, 0x16, 0xd4, 0x0d, 0xa2, 0xf5, 0xe6, 0x76, 0x45,
+         0xef, 0x65, 0x01, 0x6e, 0x51, 0x83, 0xa4, 0x44, 0x75, 0xb3, 0xae, 0x5c, 0x30, 0x56, 0xb6, 0xd0,
+         0x5c, 0xfc, 0x7a, 0x0f, 0x0d, 0x2f, 0xec, 0x43, 0x23, 0x7b, 0x88, 0xef, 0xc4, 0xfb, 0x7e, 0x9f,
+         0x0a, 0x95, 0xb6, 0x35, 0x2b, 0xd4, 0xca, 0xa9, 0x18, 0xc5, 0x8c, 0x1e, 0x9b, 0xe0, 0x2f, 0xfd}
+    },
+    {
+        {0x1b, 0xc7, 0xaf, 0x1e, 0x38, 0x18, 0x5e, 0x7c, 0x2d, 0x8d, 0x04, 0x37, 0x1c, 0x7e, 0x17, 0x7d,
+         0x7a, 0x9d, 0xde, 0xe1, 0xb8, 0x1d, 0x7d, 0x26, 0xdb, 0x7a, 0xd6, 0x44, 0xc7, 0xda, 0xd2, 0x8d,
+         0x61, 0xd9, 0x09, 0xd8, 0x55, 0x66, 0x1f, 0x2f, 0x7a, 0x5e, 0xef, 0x87, 0x79, 0x5d, 0xc0, 0x49,
+         0x1d, 0x02, 0x7e, 0x12, 0x63, 0x1b, 0x27, 0x0f, 0xca, 0xf2, 0xf6, 0x59, 0x00, 0x31, 0x48, 0x33},
+        {0x06, 0xbc, 0xe2, 0x45, 0xf8, 0xc2, 0x59, 0x6b, 0xd2, 0x28, 0x35, 0x5a, 0x6b, 0xb8, 0xa3, 0xd9,
+         0xf2, 0xfa, 0x89, 0x75, 0xd8, 0xda, 0xa7, 0xd0, 0x07, 0x99, 0x93, 0x82, 0x18, 0x02, 0x83, 0x54,
+         0x3d, 0x26, 0x98, 0x9c, 0xdd, 0x0f, 0x6d, 0xa0, 0xc9, 0x2a, 0xcd, 0x2f, 0x10, 0x75, 0x48, 0x58,
+         0xc2, 0xc9, 0x41, 0x8b, 0x0d, 0xe8, 0x78, 0x94, 0x96, 0xfc, 0x95, 0x51, 0x88, 0xa3, 0xc0, 0x65},
+        {0x76, 0x65, 0x90, 0x8a, 0xaf, 0x44, 0x45, 0xef, 0x64, 0x3c, 0x3a, 0xc9, 0xc2, 0x7f, 0xfc, 0xb4,
+         0x0c, 0xb0, 0xef, 0x0e, 0xb7, 0xdd, 0x6e, 0xee, 0x7e, 0xbd, 0x89, 0x04, 0x1b, 0x29, 0x66, 0x2f,
+         0x4e, 0xd1, 0x8a, 0x7c, 0x50, 0xda, 0x45, 0x46, 0xce, 0x17, 0xf8, 0x06, 0x4f, 0x02, 0xb4, 0x09,
+         0x65, 0x22, 0x19, 0x38, 0xb8, 0xaf, 0xa4, 0x13, 0x70, 0x83, 0xa0, 0x0e, 0x4b, 0x70, 0x4c, 0xa1},
+        {0x0a, 0x09, 0xb3, 0x6e, 0xb5, 0xa0, 0x4a, 0xa9, 0x08, 0x34, 0xf3, 0xf3, 0x3b, 0xa4, 0xe6, 0x30,
+         0xe5, 0x34, 0x5c, 0xfe, 0x52, 0x2b, 0x91, 0x0f, 0x5d, 0x9d, 0x95, 0x4e, 0x6c, 0x16, 0xd4, 0xf7,
+         0x3a, 0xa4, 0x7f, 0xd6, 0x0f, 0xa3, 0x11, 0x0a, 0x24, 0xb6, 0xeb, 0x2b, 0xae, 0xed, 0x53, 0x3d,
+         0x06, 0xce, 0x9e, 0xe4, 0xd4, 0x37, 0x3b, 0x20, 0xf3, 0xa2, 0xeb, 0x0f, 0xa3, 0x5e, 0xd9, 0x26},
+        {0x1c, 0x71, 0xce, 0x37, 0x63, 0x8e, 0x6d, 0x6a, 0x80, 0xc8, 0xb5, 0xa8, 0xbf, 0x56, 0x49, 0x86,
+         0x0b, 0xa1, 0x62, 0xd2, 0xba, 0x6e, 0x7d, 0x20, 0x91, 0x9c, 0xd5, 0x45, 0x11, 0x13, 0x73, 0x5e,
+         0x78, 0x80, 0xcc, 0x1c, 0x20, 0x03, 0xb2, 0xcd, 0x24, 0x3d, 0xba, 0xd7, 0x9a, 0xa0, 0xcf, 0xb7,
+         0xd4, 0x0d, 0x18, 0x3f, 0x44, 0x7a, 0x97, 0x2c, 0xe3, 0xe8, 0xfe, 0xe1, 0x29, 0xe4, 0x06, 0xcb},
+        {0x3c, 0x60, 0x7a, 0x84, 0xc1, 0xdf, 0x2f, 0x7d, 0x89, 0x7a, 0x82, 0xf8, 0x95, 0xc2, 0xcf, 0xe5,
+         0x12, 0x0e, 0x79, 0x44, 0x6c, 0x85, 0x2c, 0xb1, 0x93, 0x1b, 0x9e, 0x7f, 0x74, 0xcb, 0xc8, 0xd6,
+         0x34, 0x51, 0x8a, 0xd1, 0x09, 0x94, 0x1a, 0x3a, 0x23, 0x84, 0xba, 0xb4, 0x89, 0xdb, 0xee, 0x18,
+         0x49, 0x87, 0xe0, 0xa1, 0x73, 0x1a, 0x06, 0x0c, 0xea, 0x77, 0x9a, 0x86, 0xba, 0x3c, 0xea, 0x68},
+        {0x08, 0x9b, 0x6c, 0xd0, 0x20, 0x00, 0xbc, 0x66, 0x3f, 0xf9, 0x38, 0xdd, 0x61, 0x6e, 0xf7, 0xf1,
+         0x3a, 0x17, 0xfc, 0x66, 0xa6, 0x38, 0xe3, 0x9c, 0x31, 0x0a, 0xf4, 0x17, 0xff, 0xbe, 0x2d, 0xa0,
+         0x66, 0xef, 0x72, 0x06, 0xaa, 0x36, 0xdf, 0xd8, 0xb4, 0x38, 0xde, 0xfd, 0x11, 0xca, 0x65, 0x7e,
+         0x43, 0xcb, 0xe4, 0xa7, 0xcd, 0xbb, 0x12, 0xa3, 0xe7, 0x88, 0x16, 0xf1, 0x3e, 0x8c, 0xeb, 0x88},
+        {0x07, 0x9e, 0x9d, 0x5b, 0x60, 0x91, 0x7d, 0x60, 0xf8, 0x7a, 0xb5, 0x43, 0x46, 0x77, 0x90, 0x6d,
+         0x2b, 0x72, 0x86, 0x2d, 0x87, 0x06, 0x7a, 0x52, 0x2e, 0x1e, 0xb2, 0xd6, 0xfc, 0x2c, 0x9f, 0xdb,
+         0x16, 0x51, 0x29, 0x51, 0xd2, 0x24, 0x0a, 0x45, 0x31, 0x26, 0xca, 0x94, 0x50, 0xbf, 0xa2, 0x25,
+         0x64, 0x00, 0x64, 0xfc, 0xa3, 0x85, 0xc7, 0x58, 0x39, 0x01, 0x38, 0x1c, 0x04, 0xc7, 0x87, 0x97}
+    },
+    {
+        {0x46, 0x9d, 0x09, 0x60, 0xdb, 0xd0, 0xef, 0x9c, 0x91, 0xc4, 0x59, 0x7c, 0xcf, 0x7c, 0x20, 0x95,
+         0x49, 0xb1, 0x87, 0xff, 0x63, 0xbd, 0x37, 0x8b, 0x7d, 0xac, 0x57, 0x71, 0x98, 0xd7, 0x4a, 0x4d,
+         0x0b, 0x5f, 0x21, 0xc7, 0xf8, 0x68, 0x32, 0x24, 0x1f, 0x21, 0x57, 0xc2, 0x88, 0xbd, 0xc9, 0x39,
+         0x4f, 0x83, 0xf8, 0xd5, 0x74, 0x57, 0xf6, 0xd9, 0xf6, 0xb3, 0x45, 0xe4, 0x90, 0x94, 0x78, 0xcb},
+        {0x59, 0x11, 0xad, 0xe9, 0x99, 0x89, 0x30, 0xa4, 0xce, 0xb0, 0xb6, 0x6e, 0xb9, 0x3d, 0x7e, 0x9e,
+         0x4d, 0x94, 0xca, 0x0a, 0x3a, 0xe3, 0xf0, 0x95, 0xc5, 0xc4, 0xff, 0xa1, 0x56, 0x77, 0x67, 0x92,
+         0x06, 0x3a, 0xd2, 0x43, 0x2a, 0x17, 0x3e, 0x9d, 0xf4, 0x05, 0x6a, 0x37, 0x0d, 0xb2, 0x1b, 0x26,
+         0x25, 0xd6, 0x8a, 0xd2, 0x1c, 0x00, 0x30, 0xbb, 0xa5, 0xb7, 0x5f, 0x6f, 0xa1, 0x95, 0x48, 0xf6},
+        {0x78, 0x3b, 0x54, 0x05, 0xbd, 0x8f, 0xc2, 0xb6, 0x05, 0x99, 0x82, 0xd0, 0x6b, 0xed, 0xc6, 0x40,
+         0x00, 0xa0, 0x3e, 0xf5, 0x2e, 0xc4, 0x2d, 0xac, 0xb9, 0xba, 0xa9, 0x03, 0xe0, 0x0b, 0xfd, 0xdd,
+         0x26, 0xe8, 0x4c, 0xc1, 0xc0, 0x90, 0x41, 0xd6, 0xca, 0x40, 0x8e, 0x5c, 0xd8, 0x85, 0x99, 0x53,
+         0x81, 0x23, 0x73, 0xd6, 0xc5, 0x91, 0x01, 0xbf, 0x36, 0xf3, 0x4a, 0xc5, 0xeb, 0xbe, 0x06, 0x8d},
+        {0x10, 0xb3, 0x04, 0xff, 0x67, 0x57, 0x7e, 0xcb, 0x1c, 0x73, 0xa3, 0xe4, 0x05, 0xd3, 0x9a, 0x64,
+         0xb2, 0xd4, 0xf9, 0xdd, 0x4c, 0xb4, 0xbd, 0x16, 0xa9, 0xf3, 0x72, 0x9a, 0xd1, 0x93, 0x99, 0x32,
+         0x13, 0xb7, 0xfa, 0xa0, 0xf9, 0x1c, 0xc1, 0x41, 0x9b, 0xb0, 0xe7, 0xcc, 0xcd, 0x85, 0xe3, 0x69,
+         0xd9, 0xec, 0x65, 0xaa, 0xa9, 0x34, 0xaf, 0xb4, 0x23, 0x61, 0x6d, 0xd0, 0xad, 0xa4, 0x4b, 0xb9},
+        {0x44, 0xf7, 0x35, 0xaa, 0xfd, 0x47, 0x5d, 0x4c, 0xf0, 0x98, 0x64, 0x91, 0x09, 0xf4, 0x0a, 0xf5,
+         0xe8, 0xcd, 0xce, 0x75, 0x5e, 0xd4, 0x2b, 0xa0, 0xc7, 0x76, 0x9b, 0x70, 0x25, 0x3d, 0x50, 0x2f,
+         0x41, 0xc6, 0xdb, 0x4a, 0xc7, 0xbf, 0x83, 0x7d, 0x0e, 0xac, 0xc0, 0x9a, 0xcc, 0x15, 0xf3, 0xe6,
+         0x4b, 0x0d, 0x8f, 0x98, 0xaa, 0x5f, 0xfa, 0xda, 0xd7, 0x98, 0xca, 0xb9, 0x14, 0x15, 0x66, 0xa0},
+        {0x11, 0x7d, 0x24, 0x78, 0x92, 0x6a, 0x8a, 0x76, 0x04, 0x0f, 0xb5, 0x5f, 0xc4, 0xce, 0x96, 0xa4,
+         0xa5, 0xd8, 0x0b, 0x35, 0x60, 0x39, 0x53, 0xf7, 0xd9, 0x60, 0x4b, 0x43, 0x4a, 0x55, 0x19, 0x0c,
+         0x1b, 0x4d, 0x73, 0xb3, 0xcd, 0xf1, 0x3b, 0x78, 0x30, 0x76, 0xa7, 0xbf, 0x57, 0x71, 0xf6, 0x09,
+         0x8e, 0x3f, 0x46, 0x31, 0x47, 0xc6, 0xa6, 0xee, 0x0e, 0xa2, 0x9c, 0xc6, 0xf7, 0xde, 0x83, 0x68},
+        {0x6e, 0x86, 0x41, 0xbc, 0x34, 0xbb, 0xf6, 0x71, 0xe2, 0x1c, 0xa8, 0xc4, 0xf4, 0xd0, 0x86, 0xbf,
+         0x1a, 0xc1, 0x88, 0xa3, 0xa8, 0xcf, 0x50, 0x9a, 0x8e, 0x4d, 0xe1, 0xa2, 0xd6, 0x5e, 0x04, 0xb1,
+         0x3b, 0xc1, 0x5c, 0x35, 0x46, 0xf5, 0xb7, 0xf2, 0x70, 0x89, 0x72, 0x2b, 0x9c, 0xc1, 0xad, 0x26,
+         0xbc, 0xc6, 0xdf, 0xfb, 0x6d, 0x66, 0xf8, 0xc4, 0x5e, 0x84, 0x9b, 0x5e, 0xa7, 0xcc, 0x02, 0xa6},
+        {0x1b, 0x79, 0x5d, 0x9b, 0xe8, 0xde, 0xc6, 0xdd, 0x36, 0x17, 0xf3, 0xf9, 0xbc, 0x33, 0xc5, 0x80,
+         0xde, 0xbb, 0xc3, 0xcc, 0x19, 0x06, 0x4f, 0x51, 0x52, 0x09, 0xd0, 0x0c, 0x3c, 0x88, 0xfd, 0x04,
+         0x6c, 0x87, 0xf6, 0x1b, 0x67, 0x5c, 0x50, 0xc0, 0x1e, 0x86, 0x2a, 0x53, 0xcf, 0xba, 0x38, 0x4b,
+         0xae, 0xfb, 0x8f, 0x95, 0x07, 0x9b, 0x71, 0x08, 0x79, 0x50, 0xad, 0x57, 0x51, 0xbe, 0x0a, 0x65}
+    },
+    {
+        {0x5e, 0x9a, 0xc4, 0xab, 0x2f, 0x4a, 0x3c, 0x35, 0x26, 0xe1, 0x31, 0x7f, 0x91, 0x3d, 0x69, 0xe3,
+         0x82, 0x6f, 0xe8, 0x62, 0xef, 0xd0, 0xc8, 0x0d, 0x93, 0x10, 0x31, 0x91, 0x70, 0xc5, 0xcb, 0xeb,
+         0x50, 0x5f, 0x00, 0xfa, 0x8a, 0xee, 0x03, 0xcc, 0xbd, 0x2f, 0x33, 0x52, 0x9a, 0xe1, 0xe4, 0xe4,
+         0xbc, 0xf2, 0x64, 0x4f, 0xe6, 0x73, 0xd0, 0xb0, 0x29, 0x0e, 0xc3, 0x2b, 0xe5, 0xb5, 0x1b, 0xab},
+        {0x2e, 0x5c, 0x4e, 0xf1, 0xa1, 0x27, 0x30, 0xa9, 0x78, 0x89, 0x53, 0xb5, 0x07, 0x9a, 0x11, 0x84,
+         0xa9, 0xa2, 0x37, 0xb9, 0xe2, 0x81, 0xf0, 0x31, 0x75, 0x14, 0xb5, 0x3d, 0x22, 0x0d, 0xdb, 0xf6,
+         0x5c, 0x17, 0x31, 0x36, 0x55, 0x12, 0xa3, 0x96, 0x5c, 0x5d, 0x54, 0x74, 0xa8, 0x4e, 0x99, 0x4e,
+         0xe4, 0x4a, 0xfe, 0x8c, 0xb7, 0xff, 0x40, 0x35, 0x17, 0xcb, 0xdc, 0x4d, 0xfb, 0x54, 0x00, 0x8b},
+        {0x0e, 0x26, 0x06, 0xa0, 0x00, 0x97, 0xa4, 0x15, 0xaa, 0xe7, 0x91, 0xb2, 0x31, 0x12, 0x44, 0xcf,
+         0x33, 0x13, 0x6b, 0x90, 0xa9, 0x3a, 0xa9, 0xfd, 0x23, 0x6c, 0x1f, 0x53, 0x95, 0xc6, 0x8f, 0x4b,
+         0x2d, 0xda, 0x44, 0x6c, 0x4a, 0x62, 0x8f, 0x1c, 0xb3, 0x8f, 0xad, 0x43, 0xd1, 0x3b, 0x64, 0x9b,
+         0x6b, 0x2b, 0x9d, 0x88, 0x3b, 0x97, 0xa9, 0x89, 0x0a, 0xd1, 0x50, 0xdb, 0xc8, 0x77, 0x49, 0xc3},
+        {0x4c, 0x6c, 0x9a, 0x0e, 0x8a, 0x4e, 0xf1, 0x6e, 0x4b, 0x55, 0xb6, 0xeb, 0x2e, 0x72, 0x8c, 0xf2,
+         0xaf, 0xef, 0x2d, 0x38, 0x87, 0x7d, 0x5c, 0xe8, 0x77, 0x0f, 0xf2, 0x86, 0x7b, 0xef, 0x24, 0xce,
+         0x26, 0xd5, 0x71, 0x1e, 0xe5, 0xa1, 0xe8, 0x82, 0x73, 0xbe, 0x70, 0xd6, 0xd8, 0xb9, 0x05, 0x4c,
+         0xc5, 0xed, 0x25, 0x81, 0x66, 0x8d, 0x5c, 0xa8, 0x3e, 0xb7, 0x4f, 0xd1, 0xc2, 0x86, 0xea, 0x25},
+        {0x6a, 0x73, 0xb1, 0xe2, 0xa6, 0x03, 0xe5, 0xfd, 0xe9, 0x7e, 0xb6, 0x04, 0x01, 0x68, 0xec, 0x42,
+         0xf0, 0x69, 0x9c, 0xc8, 0x82, 0x99, 0x97, 0xf5, 0x9c, 0xed, 0x51, 0x42, 0xc5, 0x9d, 0x25, 0xf5,
+         0x6e, 0xa5, 0xcc, 0xc1, 0xef, 0xdb, 0x45, 0x11, 0x05, 0x71, 0x87, 0x35, 0x4b, 0x07, 0x5e, 0xb5,
+         0xfd, 0x81, 0x4e, 0xbe, 0xbc, 0x00, 0xf1, 0x9b, 0x91, 0x5c, 0x3f, 0x6e, 0xbc, 0xfa, 0xff, 0xcd},
+        {0x72, 0x8a, 0x71, 0x91, 0x2c, 0xf9, 0xff, 0x30, 0xce, 0xc3, 0x33, 0x5c, 0x38, 0x71, 0x2a, 0x01,
+         0x86, 0xdc, 0x63, 0xf7, 0xf7, 0x16, 0x7e, 0xa2, 0x26, 0x45, 0x22, 0x4f, 0xa7, 0xc3, 0x6d, 0x4e,
+         0x4c, 0xe9, 0x5d, 0x59, 0x30, 0x5c, 0xda, 0x0f, 0x62, 0xdd, 0x69, 0xc1, 0xa3, 0x93, 0x57, 0xc7,
+         0xd2, 0xff, 0x5e, 0x9a, 0xc6, 0x45, 0x84, 0xf3, 0x8f, 0xc9, 0x23, 0xd5, 0x28, 0x09, 0x44, 0x8c},
+        {0x5c, 0xa0, 0x76, 0xf1, 0x31, 0xf1, 0x73, 0x30, 0xb4, 0x76, 0x51, 0x2b, 0xd0, 0xc5, 0xb4, 0xdb,
+         0x4d, 0x34, 0x76, 0x5a, 0x46, 0xb6, 0x72, 0xdc, 0x79, 0x45, 0x44, 0xcb, 0x21, 0x8a, 0xf3, 0x0c,
+         0x31, 0x4d, 0x83, 0x1f, 0x80, 0x52, 0xd0, 0x88, 0x37, 0x91, 0x7b, 0x9e, 0xe3, 0x4c, 0xea, 0x2d,
+         0x11, 0x0d, 0xb6, 0x38, 0xbd, 0x18, 0x59, 0xd0, 0xd3, 0x3c, 0x49, 0x71, 0xa4, 0xeb, 0xf2, 0x23},
+        {0x59, 0x9b, 0xa2, 0x1b, 0x65, 0xff, 0xb3, 0x6c, 0xf3, 0x15, 0x1c, 0x6e, 0x86, 0x62, 0xaa, 0x6c,
+         0x8b, 0x35, 0x94, 0x84, 0x35, 0x81, 0x96, 0x69, 0xd6, 0x0c, 0xd7, 0x72, 0x27, 0x50, 0x7e, 0x92,
+         0x07, 0xf5, 0x9b, 0x35, 0x0f, 0x66, 0x8c, 0x2b, 0x67, 0x97, 0xe5, 0x3f, 0x3f, 0xcd, 0xf6, 0xdd,
+         0xd4, 0x97, 0xca, 0x01, 0x44, 0x5f, 0x6e, 0x3b, 0xbb, 0xfa, 0x50, 0xc4, 0x88, 0x65, 0xa9, 0xe2}
+    },
+    {
+        {0x11, 0xcd, 0x80, 0xe1, 0xfd, 0xcb, 0xc5, 0x65, 0xef, 0xed, 0x81, 0xd1, 0x7f, 0x3f, 0x54, 0x64,
+         0x3f, 0xfe, 0xed, 0x1c, 0xff, 0x38, 0xf3, 0x82, 0x5e, 0x11, 0x5a, 0xdb, 0xd8, 0x27, 0x59, 0xf1,
+         0x43, 0xf1, 0x19, 0x43, 0xf7, 0xef, 0x3f, 0xa6, 0x8b, 0x98, 0x0f, 0xee, 0x45, 0xe9, 0x81, 0x34,
+         0xf1, 0xdf, 0x22, 0x26, 0x3b, 0x2d, 0x14, 0x41, 0x9d, 0x61, 0xff, 0xe6, 0x28, 0x22, 0xdb, 0xe0},
+        {0x06, 0x8c, 0x33, 0xd8, 0xf3, 0x32, 0x19, 0xa9, 0x80, 0xef, 0x7a, 0x4a, 0x10, 0xed, 0xcd, 0x58,
+         0xb0, 0xd2, 0x31, 0x4d, 0x3c, 0x8c, 0xe3, 0x01, 0xb6, 0xc0, 0xde, 0x50, 0xa1, 0x00, 0xf3, 0xee,
+         0x10, 0x32, 0xa9, 0x35, 0x93, 0x88, 0x1d, 0xa4, 0xde, 0x11, 0xee, 0xdf, 0x67, 0x94, 0x16, 0xb5,
+         0x71, 0x35, 0x34, 0x4c, 0xf9, 0x06, 0x1c, 0x39, 0x3b, 0x12, 0xd8, 0x30, 0xff, 0x4f, 0x7d, 0xcb},
+        {0x48, 0x47, 0xba, 0xbb, 0xf5, 0xa0, 0x3d, 0x4d, 0xec, 0x64, 0xda, 0x93, 0x4b, 0x5b, 0x6f, 0x38,
+         0x64, 0xab, 0x0b, 0x3a, 0xba, 0xe5, 0x2f, 0xc9, 0xf9, 0xb2, 0xfc, 0x5c, 0x7b, 0xbc, 0xc3, 0xe9,
+         0x7e, 0x6f, 0xfe, 0x11, 0x4a, 0x42, 0x2c, 0x24, 0x51, 0x2e, 0xcd, 0xd6, 0x66, 0xe7, 0x9a, 0x30,
+         0x67, 0x54, 0x77, 0x4f, 0x99, 0x97, 0xe6, 0x76, 0x70, 0x3b, 0xa2, 0x23, 0x1f, 0x45, 0xbc, 0x60},
+        {0x1e, 0xac, 0x17, 0xc8, 0x3e, 0xc7, 0x97, 0x2f, 0xe8, 0x23, 0x21, 0xbf, 0x2c, 0x4e, 0x6a, 0xa7,
+         0x35, 0x65, 0xbe, 0x5c, 0xef, 0x72, 0x0a, 0xa9, 0x93, 0x0c, 0x6f, 0xa3, 0xf0, 0xb1, 0xc0, 0x87,
+         0x04, 0x19, 0xa1, 0x60, 0x07, 0x9a, 0x82, 0x5b, 0x1b, 0x3c, 0x51, 0xe5, 0x7c, 0x6e, 0x5a, 0x25,
+         0x7a, 0x86, 0x75, 0x7c, 0x7a, 0x97, 0xbd, 0xd6, 0xdc, 0x1e, 0xcc, 0x40, 0xe5, 0x21, 0xef, 0x7b},
+        {0x7d, 0xda, 0xf4, 0x0a, 0xda, 0x2c, 0x85, 0x05, 0x3c, 0x65, 0x37, 0x32, 0x42, 0x29, 0x99, 0xad,
+         0x71, 0x07, 0x9b, 0x81, 0x53, 0x65, 0x4a, 0xc2, 0x37, 0xf0, 0x85, 0xb7, 0xd9, 0xbd, 0x4f, 0x36,
+         0x44, 0xf5, 0x94, 0xd1, 0xcd, 0xef, 0x9c, 0x8d, 0x70, 0x2c, 0xe7, 0xc5, 0x78, 0xa9, 0xbf, 0x67,
+         0xd4, 0x9e, 0x0d, 0xef, 0x9e, 0x3f, 0x6c, 0xaf, 0x57, 0xef, 0x3d, 0xc2, 0x22, 0x37, 0x05, 0x68},
+        {0x39, 0xd5, 0xa0, 0x45, 0x86, 0xd7, 0x39, 0x86, 0x42, 0x56, 0x56, 0x62, 0xf0, 0x53, 0xcc, 0xf6,
+         0x7f, 0x2a, 0x27, 0x3d, 0x04, 0x3b, 0x37, 0x2c, 0x6a, 0xa7, 0xbe, 0x1d, 0xa7, 0xaf, 0x1f, 0x38,
+         0x2e, 0x98, 0x6c, 0x4a, 0x9a, 0x93, 0x82, 0xdf, 0xbf, 0x6c, 0x9f, 0x59, 0xec, 0x5d, 0xbe, 0xca,
+         0x11, 0xd0, 0x25, 0x46, 0xd7, 0x1d, 0xb1, 0xd2, 0x2d, 0x85, 0xaf, 0xfc, 0x5b, 0x11, 0x21, 0xf7},
+        {0x1b, 0x59, 0x5d, 0x72, 0x92, 0x01, 0x71, 0x31, 0x06, 0x8b, 0x5b, 0x4f, 0x2a, 0xc4, 0x0c, 0xcc,
+         0x53, 0xbb, 0x43, 0xce, 0x37, 0x79, 0x35, 0x3a, 0x40, 0x30, 0x79, 0xb0, 0x70, 0x6d, 0x2a, 0xc3,
+         0x2d, 0x51, 0x5b, 0x16, 0x6a, 0x90, 0x7d, 0xe8, 0xe2, 0x18, 0x18, 0x53, 0xf4, 0x5d, 0x29, 0xe7,
+         0xac, 0xe7, 0x5c, 0xdc, 0x89, 0xd8, 0x53, 0x37, 0x39, 0x0b, 0x63, 0xcf, 0xaa, 0x41, 0xc0, 0x9c},
+        {0x4e, 0xe4, 0x5a, 0xd6, 0x67, 0x2f, 0x7b, 0x5d, 0xce, 0x99, 0xd4, 0xf6, 0x4c, 0x57, 0x74, 0x26,
+         0x40, 0xfe, 0xb2, 0x6a, 0xe7, 0x34, 0xfe, 0xf8, 0x49, 0x3a, 0xe3, 0x8f, 0xab, 0xa6, 0x88, 0x96,
+         0x70, 0x41, 0xa7, 0xfe, 0x4f, 0xac, 0xb6, 0xc6, 0x90, 0x41, 0x01, 0xf8, 0x56, 0xfb, 0xff, 0x5b,
+         0x2b, 0xb1, 0x5c, 0x7d, 0xc6, 0x02, 0xa4, 0x93, 0x6a, 0xf6, 0x25, 0x55, 0xbd, 0xb3, 0x82, 0x5c}
+    },
+    {
+        {0x33, 0x28, 0xbc, 0x12, 0x16, 0x16, 0xa9, 0x47, 0x71, 0x65, 0xed, 0x28, 0x20, 0x53, 0xd2, 0x03,
+         0xc2, 0x4f, 0x48, 0x26, 0x07, 0x6c, 0x63, 0x8a, 0x2c, 0x67, 0x23, 0xd4, 0x2c, 0x9b, 0xfa, 0xdb,
+         0x2b, 0xbf, 0x3f, 0x26, 0xc2, 0x1b, 0x5c, 0xb2, 0x73, 0xe5, 0xf4, 0xf0, 0x11, 0x4c, 0x67, 0x18,
+         0xc5, 0xeb, 0x72, 0x91, 0x93, 0x9b, 0x76, 0x97, 0xc7, 0x43, 0x33, 0xcd, 0xfa, 0xfa, 0xc0, 0x39},
+        {0x36, 0x46, 0xa6, 0x2a, 0xd8, 0x2b, 0xd1, 0xf3, 0x7a, 0x32, 0x41, 0x2d, 0x71, 0xc1, 0xde, 0x83,
+         0x14, 0x63, 0x7e, 0xea, 0x17, 0x72, 0x67, 0xa0, 0xa5, 0x17, 0x6f, 0xc3, 0x7c, 0x90, 0xa7, 0x33,
+         0x24, 0xdd, 0x06, 0x03, 0x1f, 0xda, 0xa9, 0xe8, 0xe9, 0x4d, 0x73, 0xad, 0xc7, 0x00, 0xca, 0x86,
+         0xda, 0x20, 0xea, 0x73, 0x8f, 0x7d, 0xd0, 0x5c, 0x08, 0x8b, 0xb8, 0xf9, 0x7c, 0x6b, 0xcc, 0xac},
+        {0x65, 0xa1, 0x0f, 0xf6, 0xa0, 0x67, 0xcb, 0x76, 0xb0, 0xb0, 0x2a, 0xf4, 0x43, 0xc5, 0x72, 0x43,
+         0xe6, 0xe7, 0x8f, 0xa8, 0x33, 0x79, 0x22, 0x41, 0x72, 0xf3, 0x14, 0x37, 0x12, 0x37, 0x26, 0x46,
+         0x36, 0x07, 0x01, 0x4f, 0x6a, 0x64, 0xec, 0xbe, 0x1c, 0xbc, 0x8f, 0x1e, 0x29, 0x7e, 0xec, 0xc6,
+         0xb9, 0x4b, 0x13, 0x50, 0x9c, 0x41, 0xe5, 0xd5, 0x5e, 0xa6, 0x69, 0x77, 0x7c, 0x68, 0x4d, 0x1b},
+        {0x3c, 0x0c, 0x1e, 0x7b, 0xeb, 0x87, 0xa5, 0x34, 0x57, 0xa6, 0x9c, 0x0f, 0x59, 0x85, 0xdc, 0xbe,
+         0xe2, 0x1e, 0x0a, 0xcb, 0x65, 0xac, 0xa9, 0xee, 0xd7, 0xa5, 0x2a, 0x98, 0x0a, 0x61, 0xb2, 0x9c,
+         0x74, 0xe8, 0x26, 0xb2, 0xf1, 0x34, 0x76, 0x31, 0x92, 0x2c, 0x45, 0x54, 0x6e, 0x2f, 0x19, 0x73,
+         0xff, 0x34, 0x9a, 0x34, 0xc6, 0x93, 0x9e, 0x4b, 0xf0, 0xa0, 0xb5, 0x0d, 0x63, 0x84, 0xbd, 0x2f},
+        {0x57, 0x9a, 0xc4, 0xb5, 0x21, 0x84, 0x80, 0xa5, 0x33, 0x39, 0x7a, 0x94, 0xf4, 0xd3, 0x10, 0x37,
+         0x25, 0xe6, 0x54, 0xd0, 0xa8, 0xa5, 0x3c, 0x31, 0x64, 0x27, 0x48, 0xfe, 0x1a, 0x82, 0x5c, 0x77,
+         0x62, 0xbf, 0xb9, 0x3d, 0x69, 0x71, 0xca, 0xfc, 0xee, 0x57, 0x11, 0x98, 0x62, 0xfc, 0x77, 0x42,
+         0x3e, 0x0a, 0x1c, 0xb0, 0x64, 0xfa, 0x2d, 0x09, 0x5a, 0xe2, 0xb4, 0x13, 0xd2, 0x8a, 0x28, 0x1d},
+        {0x61, 0xee, 0xe3, 0x76, 0xf0, 0xdc, 0x88, 0x5c, 0x9e, 0x95, 0xa0, 0x47, 0x43, 0x4c, 0x80, 0x72,
+         0xd2, 0x3e, 0x2a, 0x4d, 0xf0, 0x19, 0x16, 0x3a, 0x72, 0x11, 0x9e, 0xaf, 0x80, 0x1c, 0x21, 0x54,
+         0x1f, 0x2a, 0xbf, 0x8d, 0x3e, 0xd6, 0xec, 0x53, 0xf4, 0x74, 0x28, 0xc9, 0xc7, 0x45, 0xe0, 0x1b,
+         0x8a, 0xaf, 0x78, 0x19, 0x28, 0xf2, 0x5c, 0xb8, 0x33, 0xa9, 0x7e, 0xfb, 0xf8, 0xb3, 0x89, 0x31},
+        {0x3d, 0x12, 0x19, 0x1c, 0x75, 0x24, 0x3c, 0x03, 0xd0, 0x86, 0x1a, 0xc6, 0x32, 0xe4, 0x34, 0xb3,
+         0xe8, 0x8c, 0x30, 0xe6, 0x57, 0xb6, 0xac, 0xe1, 0x92, 0x57, 0x11, 0x4d, 0x8a, 0x25, 0x90, 0x6c,
+         0x46, 0x79, 0x65, 0x88, 0x0e, 0x34, 0xc7, 0x8b, 0xc9, 0x9b, 0x4e, 0x3c, 0x57, 0xeb, 0x5e, 0x3c,
+         0xc0, 0x7f, 0xb9, 0x18, 0x63, 0x2c, 0x5f, 0xdb, 0xc5, 0xc4, 0x4e, 0x5e, 0x9a, 0xcd, 0xfe, 0x83},
+        {0x53, 0xb1, 0xcd, 0xfe, 0x23, 0xed, 0x55, 0x3c, 0x04, 0x43, 0xb1, 0x4b, 0xbb, 0xa2, 0x11, 0x9b,
+         0x58, 0xcd, 0x8c, 0x55, 0x5e, 0xa7, 0xbd, 0xe6, 0xc0, 0xcc, 0x4c, 0x0c, 0x6d, 0x90, 0x67, 0x0a,
+         0x5c, 0xa6, 0xdf, 0x45, 0xad, 0x96, 0x30, 0xe4, 0xb8, 0xd5, 0x73, 0x2b, 0xd0, 0x6e, 0x50, 0x08,
+         0xa2, 0x67, 0x7a, 0x34, 0x29, 0x04, 0xfc, 0x58, 0x72, 0x38, 0xaf, 0x01, 0xf5, 0x75, 0xfb, 0x05}
+    },
+    {
+        {0x0b, 0xa7, 0x74, 0xbb, 0x60, 0x5d, 0xd8, 0x04, 0xca, 0xe6, 0x88, 0x7e, 0x81, 0xf6, 0xbd, 0x2c,
+         0x59, 0xe0, 0x24, 0xfa, 0xc8, 0xbf, 0x5f, 0x5c, 0x48, 0xa8, 0x41, 0xa0, 0x37, 0xc2, 0x83, 0x98,
+         0x54, 0xba, 0x01, 0x3a, 0xd2, 0xd0, 0x4d, 0xcd, 0xfb, 0x5a, 0x15, 0x1b, 0x73, 0x47, 0xee, 0x9a,
+         0x10, 0x06, 0x7d, 0xdd, 0x0a, 0x39, 0x07, 0xe9, 0xbc, 0x33, 0x7a, 0x77, 0xbf, 0x91, 0x13, 0x21},
+        {0x6e, 0x6b, 0x14, 0xdf, 0x76, 0x45, 0x8c, 0x45, 0x46, 0x6b, 0xef, 0x23, 0xb9, 0x37, 0x7c, 0xf1,
+         0x47, 0xc9, 0x7c, 0x49, 0x5e, 0x82, 0x07, 0xa0, 0x43, 0x6a, 0x20, 0x0b, 0x4a, 0x39, 0xd5, 0x48,
+         0x30, 0xf3, 0xb3, 0x5d, 0xc9, 0x52, 0xba, 0x9d, 0x6b, 0x5f, 0xde, 0x2d, 0x13, 0x1a, 0xb9, 0xb5,
+         0xb4, 0x03, 0xf2, 0x58, 0x3a, 0x7c, 0x2d, 0x8a, 0xda, 0x37, 0x76, 0x4c, 0x29, 0xca, 0xc9, 0x42},
+        {0x68, 0x01, 0xc7, 0x5b, 0x1a, 0x97, 0xe1, 0xab, 0x79, 0x66, 0xdd, 0x46, 0x3b, 0x6e, 0xe8, 0xea,
+         0x6b, 0x0a, 0x57, 0x25, 0x74, 0x5e, 0xdb, 0xd2, 0x2a, 0x62, 0x37, 0x21, 0x5a, 0x89, 0x11, 0x4e,
+         0x43, 0xc4, 0x8e, 0xda, 0xce, 0x25, 0x72, 0x42, 0xb8, 0x67, 0x63, 0x74, 0xe0, 0x8d, 0xa4, 0x35,
+         0xb7, 0x9c, 0xb7, 0xed, 0x7f, 0xa4, 0xfc, 0x37, 0x54, 0x48, 0xc5, 0x79, 0x07, 0xf7, 0xaa, 0x57},
+        {0x49, 0x64, 0x90, 0xaf, 0x40, 0x80, 0xfe, 0xeb, 0x8e, 0x38, 0xf7, 0x8e, 0x76, 0x93, 0x08, 0xb1,
+         0x24, 0xed, 0xc0, 0x79, 0x85, 0xb1, 0xef, 0x71, 0x48, 0xd7, 0x62, 0x0c, 0x6b, 0xfe, 0x6f, 0x4c,
+         0x7f, 0x64, 0x10, 0x72, 0x7b, 0x65, 0xca, 0xfa, 0x07, 0xe5, 0x3a, 0xb1, 0xe7, 0x75, 0xef, 0x04,
+         0x08, 0xcd, 0x5f, 0x12, 0xb9, 0x4b, 0xdb, 0x4e, 0x53, 0x3c, 0x44, 0x98, 0xc1, 0xda, 0x88, 0x4a},
+        {0x2a, 0xa4, 0xbc, 0x7d, 0x1d, 0x25, 0xfe, 0x0a, 0x4b, 0xc2, 0x01, 0x90, 0xd2, 0x98, 0x51, 0xc0,
+         0x71, 0x61, 0xfc, 0xfa, 0x3f, 0x9e, 0x52, 0x82, 0xad, 0xa1, 0x3a, 0xb1, 0xd4, 0x23, 0x3b, 0x6b,
+         0x1a, 0x91, 0xd6, 0x5a, 0x2e, 0x22, 0xb3, 0x3d, 0x4b, 0x16, 0x7e, 0x6f, 0x41, 0x4d, 0x5a, 0x8b,
+         0xd8, 0xf6, 0x95, 0x14, 0x83, 0x4b, 0x27, 0x69, 0xfc, 0x03, 0x4e, 0x95, 0xbf, 0x1a, 0x6a, 0x51},
+        {0x46, 0xb5, 0xf1, 0xc5, 0x1f, 0x08, 0xe1, 0x85, 0x99, 0x8e, 0xe9, 0x45, 0x6d, 0x33, 0xbb, 0x90,
+         0xee, 0x8a, 0x2c, 0x20, 0xfb, 0x1a, 0x7c, 0x8d, 0x33, 0x58, 0xfd, 0x16, 0xeb, 0xf0, 0x81, 0x3d,
+         0x20, 0xcb, 0x1d, 0xc9, 0x4e, 0x7a, 0x0e, 0xe3, 0x31, 0xfe, 0x96, 0xec, 0x35, 0x11, 0x74, 0xed,
+         0xb8, 0xbd, 0xce, 0xe6, 0x3d, 0xae, 0x17, 0xba, 0x06, 0x2b, 0x3f, 0xa0, 0x4b, 0x43, 0xe7, 0xe4},
+        {0x6a, 0x39, 0xb7, 0x51, 0xf1, 0x56, 0x2d, 0xae, 0xbf, 0x6b, 0x1e, 0x91, 0x08, 0xa8, 0xfb, 0x08,
+         0xe3, 0xc7, 0x75, 0xbc, 0xb7, 0x93, 0x2d, 0x13, 0x93, 0xd5, 0x59, 0xf3, 0x3d, 0xf3, 0x4b, 0x15,
+         0x72, 0x72, 0x98, 0xb3, 0xe0, 0x4d, 0x03, 0x80, 0xdb, 0xf9, 0xf7, 0xa5, 0xda, 0xe5, 0x3c, 0xc8,
+         0x85, 0x9a, 0xda, 0x6d, 0xfe, 0xc3, 0xed, 0x5a, 0x19, 0x4e, 0x9c, 0xe7, 0xaa, 0x30, 0x09, 0xa3},
+        {0x07, 0x5b, 0xf0, 0xea, 0x1f, 0xb6, 0x06, 0xd0, 0x5d, 0xd6, 0x7e, 0x0f, 0x31, 0x38, 0x09, 0xac,
+         0x97, 0x92, 0xdc, 0x90, 0x31, 0x59, 0xd0, 0x32, 0xb0, 0x5c, 0x96, 0xdb, 0x7b, 0xe9, 0x67, 0xe0,
+         0x43, 0xba, 0x37, 0x34, 0x88, 0xc3, 0x17, 0xaa, 0xd6, 0x59, 0x04, 0x3f, 0x9b, 0xca, 0x4c, 0x85,
+         0xd9, 0xb0, 0x81, 0x90, 0x3e, 0x77, 0x67, 0x14, 0x35, 0x22, 0x41, 0x6b, 0xde, 0xc7, 0x9f, 0x81}
+    },
+    {
+        {0x10, 0x74, 0xff, 0x02, 0x67, 0x66, 0x2d, 0xc2, 0xb4, 0xce, 0x65, 0xaa, 0xa0, 0x22, 0x9c, 0x37,
+         0x5a, 0x3d, 0x0d, 0x84, 0x3c, 0xe9, 0x34, 0x92, 0x33, 0x94, 0x95, 0x81, 0xc8, 0x69, 0xb6, 0x4c,
+         0x29, 0x9b, 0xe0, 0xde, 0xcb, 0x68, 0x0e, 0xc2, 0x89, 0x23, 0xda, 0x4d, 0x04, 0x97, 0x70, 0x10,
+         0x7d, 0x42, 0xc1, 0x80, 0xb4, 0x60, 0xda, 0x13, 0xa7, 0xb1, 0xef, 0xc7, 0xe6, 0xd5, 0xb0, 0x22},
+        {0x3e, 0x63, 0xc4, 0xae, 0x42, 0x12, 0x19, 0x58, 0xf2, 0x8e, 0x78, 0xe5, 0x57, 0xe8, 0x27, 0xa1,
+         0x08, 0x15, 0x6a, 0x81, 0xcc, 0x8b, 0x5c, 0x64, 0x36, 0x2e, 0x2b, 0x36, 0x2a, 0x42, 0xfe, 0x33,
+         0x35, 0x99, 0x28, 0x6a, 0xac, 0x87, 0xe8, 0x8c, 0x8c, 0x85, 0x70, 0x59, 0xa5, 0xed, 0xba, 0xc1,
+         0x26, 0x5b, 0xc1, 0x5c, 0x04, 0x7c, 0xb1, 0x85, 0x02, 0xae, 0x80, 0xca, 0xa7, 0x9c, 0x96, 0x78},
+        {0x1e, 0xad, 0xe2, 0xfa, 0x11, 0x3b, 0x19, 0xd4, 0x51, 0x06, 0xb3, 0x01, 0x8d, 0x46, 0x2e, 0xfb,
+         0x62, 0xe3, 0xe4, 0xcd, 0x9f, 0xde, 0x38, 0x28, 0x80, 0xda, 0x87, 0xbe, 0x28, 0x08, 0x04, 0x9f,
+         0x6c, 0xc8, 0xd8, 0x21, 0x2e, 0x6c, 0xca, 0x64, 0xa9, 0x7c, 0x8d, 0x6d, 0x80, 0x55, 0x43, 0x43,
+         0x54, 0x87, 0x9c, 0x85, 0xb7, 0x80, 0x64, 0x4e, 0x70, 0xa3, 0xae, 0x0a, 0x69, 0x99, 0x20, 0xa0},
+        {0x31, 0xdd, 0xff, 0xcb, 0x76, 0x71, 0x1d, 0xd7, 0x6c, 0x6b, 0x48, 0x54, 0x09, 0x67, 0xab, 0x52,
+         0xce, 0xb1, 0x3e, 0x46, 0x6f, 0xc3, 0xb2, 0xa4, 0x4f, 0xc1, 0x75, 0x08, 0xad, 0x07, 0x4a, 0x91,
+         0x22, 0x1c, 0x9b, 0x9a, 0x25, 0x8e, 0x4d, 0x27, 0x1a, 0x01, 0x76, 0x11, 0x97, 0x64, 0x07, 0x2e,
+         0x48, 0x4a, 0x38, 0x95, 0xd0, 0x50, 0x88, 0x74, 0x07, 0x6f, 0x36, 0xf0, 0xfd, 0xfa, 0x88, 0x36},
+        {0x4a, 0xf6, 0x00, 0x99, 0x11, 0xd4, 0xf5, 0x31, 0xa9, 0xff, 0x4c, 0xfb, 0x69, 0x49, 0xf6, 0xe0,
+         0xbe, 0xcb, 0x4c, 0x0c, 0x8d, 0x61, 0xc0, 0xa9, 0x53, 0x9d, 0xd5, 0x7c, 0xcf, 0x82, 0xcd, 0x76,
+         0x1e, 0xa6, 0x9b, 0xf6, 0xf0, 0xee, 0x10, 0x45, 0x7e, 0x3e, 0xd9, 0xec, 0x0a, 0x54, 0xfa, 0x57,
+         0x7c, 0x69, 0x5e, 0x93, 0xa3, 0x20, 0xcb, 0x08, 0x6f, 0xe9, 0xa6, 0xe4, 0x03, 0x65, 0x16, 0x7c},
+        {0x1e, 0xd4, 0xbf, 0xcc, 0x33, 0x3a, 0x75, 0xf7, 0xfa, 0x18, 0xb2, 0xfa, 0xbe, 0xd6, 0xf3, 0xfd,
+         0x96, 0x92, 0x79, 0xb6, 0x11, 0xd1, 0x1b, 0x8d, 0xe6, 0xb7, 0xa9, 0x2b, 0xd1, 0x1b, 0xba, 0x55,
+         0x73, 0xd9, 0x69, 0xf5, 0x56, 0xbe, 0x73, 0xa2, 0x31, 0x71, 0x09, 0x38, 0x8e, 0x0a, 0x18, 0xc9,
+         0xf9, 0xa0, 0xff, 0x26, 0xb3, 0x4b, 0x97, 0x81, 0x8c, 0xc3, 0x50, 0x6e, 0x47, 0x90, 0x9a, 0x5f},
+        {0x3a, 0x4b, 0xa6, 0x93, 0xd7, 0x60, 0xae, 0x2b, 0xc9, 0xa2, 0xc8, 0xe4, 0x24, 0x1f, 0x9e, 0xd1,
+         0x5c, 0x25, 0x8b, 0x50, 0x16, 0x2a, 0x36, 0x65, 0xc3, 0x33, 0x68, 0x3f, 0xcb, 0xa7, 0x10, 0x31,
+         0x43, 0x8b, 0x99, 0x02, 0x2f, 0xc5, 0x22, 0xfd, 0x17, 0x4d, 0xbc, 0xba, 0x64, 0x22, 0x82, 0x17,
+         0x62, 0xba, 0x1d, 0x01, 0x20, 0xaa, 0x1f, 0xf9, 0x79, 0x0f, 0x96, 0x1e, 0xf3, 0xec, 0xbb, 0x5d},
+        {0x6b, 0x26, 0x55, 0x07, 0x69, 0x5b, 0x3c, 0xb3, 0x4c, 0x25, 0xcc, 0x44, 0xa9, 0x5d, 0xd5, 0x59,
+         0xec, 0x02, 0x45, 0x10, 0x2b, 0xad, 0x71, 0xa3, 0x76, 0x5e, 0xac, 0x0f, 0x0e, 0xbd, 0x57, 0xbe,
+         0x3f, 0x7f, 0x09, 0x35, 0x97, 0xac, 0xeb, 0xfd, 0xca, 0x9d, 0x15, 0x1e, 0x67, 0xd5, 0x80, 0x2b,
+         0x99, 0x1d, 0xd6, 0x2f, 0x82, 0x2a, 0x75, 0x7a, 0xf9, 0xe3, 0x29, 0x51, 0xa7, 0xd4, 0x6b, 0x30}
+    },
+    {
+        {0x25, 0xed, 0x76, 0xd7, 0x8c, 0x87, 0xc3, 0xbd, 0x64, 0xb4, 0x33, 0x19, 0x02, 0xc5, 0xa8, 0x53,
+         0x73, 0x42, 0x83, 0xe2, 0x5f, 0x19, 0xf3, 0x20, 0x29, 0x56, 0x67, 0xb8, 0x0a, 0x34, 0x0d, 0x35,
+         0x17, 0x9b, 0x5f, 0x92, 0xf5, 0x45, 0xc7, 0xb3, 0x26, 0xb3, 0xa6, 0x3f, 0xb0, 0xb3, 0x2a, 0x0f,
+         0x52, 0xb4, 0x15, 0x99, 0x88, 0x43, 0x6d, 0x5a, 0xf5, 0x0c, 0x1d, 0x0d, 0x76, 0x37, 0x39, 0x47},
+        {0x71, 0x88, 0x04, 0x63, 0x41, 0x7e, 0x76, 0x0e, 0xcb, 0x72, 0xe3, 0x17, 0x89, 0xbd, 0xb0, 0x17,
+         0x13, 0x9a, 0xaf, 0x83, 0xea, 0xf2, 0x0f, 0xc2, 0x0e, 0x42, 0x3b, 0xaf, 0xa4, 0x42, 0xb9, 0x2c,
+         0x7b, 0xe5, 0x98, 0xf9, 0xde, 0x5b, 0xd5, 0xdc, 0x43, 0x4f, 0x93, 0x8e, 0xfd, 0x89, 0xe3, 0x0d,
+         0x39, 0xe0, 0x2c, 0xf1, 0xbf, 0x65, 0x70, 0x54, 0xee, 0x9f, 0xdd, 0x57, 0x86, 0x38, 0x78, 0x75},
+        {0x5a, 0x74, 0xca, 0x17, 0x51, 0x53, 0xc9, 0xe7, 0xd4, 0x82, 0xbe, 0x47, 0x61, 0x86, 0x64, 0x04,
+         0x67, 0x98, 0x18, 0x0d, 0xab, 0xf8, 0xde, 0x43, 0x7b, 0xa6, 0x60, 0x09, 0x0c, 0xbf, 0x61, 0xd9,
+         0x2c, 0xed, 0x7d, 0xa6, 0xbc, 0xdb, 0x66, 0x71, 0xbf, 0xd5, 0xf2, 0xe3, 0xb5, 0xb8, 0x3a, 0xe2,
+         0x82, 0xe8, 0x9a, 0x12, 0x1b, 0xaf, 0x2e, 0x1d, 0xb8, 0x16, 0x02, 0x71, 0x19, 0x62, 0x29, 0xa1},
+        {0x76, 0xdb, 0x1d, 0x03, 0xf2, 0x6f, 0xe3, 0xe7, 0xdd, 0x73, 0x95, 0x1d, 0x7a, 0x58, 0xab, 0xd8,
+         0xb6, 0xc1, 0x77, 0x9e, 0x5c, 0x6f, 0x12, 0x94, 0x63, 0xf2, 0xb2, 0xdf, 0x11, 0x65, 0x3b, 0xe7,
+         0x24, 0xb9, 0x1b, 0xa6, 0x5c, 0x06, 0xf1, 0xdf, 0x0b, 0x18, 0xd1, 0x03, 0x07, 0x26, 0x68, 0x17,
+         0x14, 0xe1, 0xeb, 0xbd, 0x27, 0xbe, 0xa5, 0x5a, 0x5a, 0xbc, 0x1b, 0x52, 0x2c, 0x4e, 0x06, 0xae},
+        {0x18, 0xc4, 0x29, 0x8e, 0xfd, 0xa7, 0xa7, 0xcd, 0xcb, 0xf6, 0xf7, 0xde, 0xda, 0x80, 0xfe, 0x04,
+         0x6d, 0x7b, 0x5a, 0xd2, 0xb8, 0xfa, 0x90, 0x53, 0x55, 0x0f, 0x55, 0x19, 0x10, 0x6a, 0x10, 0x39,
+         0x2e, 0x5a, 0x2e, 0x07, 0x02, 0x93, 0xb7, 0x5b, 0xa8, 0x13, 0x52, 0x45, 0x66, 0x1f, 0x1d, 0x65,
+         0xfd, 0x0c, 0xec, 0x4c, 0xf9, 0x37, 0xf2, 0x1d, 0x97, 0xd0, 0x6e, 0x42, 0x38, 0x60, 0xce, 0x08},
+        {0x2d, 0x45, 0x6c, 0x2a, 0x45, 0xf5, 0xcb, 0x27, 0xa9, 0x87, 0xd8, 0xcb, 0x87, 0x36, 0xfa, 0xf1,
+         0x82, 0xe6, 0x51, 0xba, 0x04, 0xc6, 0x7e, 0x92, 0xe3, 0x08, 0x6e, 0xcd, 0xec, 0xb7, 0x5b, 0x26,
+         0x4b, 0x04, 0xe7, 0xb3, 0x4d, 0x35, 0x00, 0xd8, 0x6b, 0x01, 0x99, 0x9a, 0x63, 0x55, 0x24, 0x93,
+         0x71, 0xa0, 0x57, 0xcb, 0x87, 0xde, 0x9c, 0x60, 0xec, 0xe5, 0x2e, 0x11, 0x2e, 0x7a, 0x5e, 0x3e},
+        {0x19, 0x18, 0x18, 0x6a, 0x5f, 0x3d, 0x76, 0x32, 0x4e, 0xb2, 0x2f, 0x2a, 0x4f, 0xed, 0x70, 0x3d,
+         0xcc, 0x01, 0x44, 0x6a, 0xdb, 0xd2, 0xd6, 0x0e, 0xb4, 0x94, 0x15, 0xb4, 0x6d, 0xee, 0x3d, 0x70,
+         0x76, 0xbb, 0x69, 0x3d, 0xb2, 0x68, 0x7f, 0xcc, 0xfc, 0x44, 0x34, 0xb9, 0xb6, 0x76, 0x5d, 0xea,
+         0x33, 0x90, 0xfb, 0x88, 0xe0, 0x19, 0x29, 0x50, 0x36, 0x17, 0xfd, 0x1d, 0x0b, 0xf3, 0x0b, 0xf5},
+        {0x3d, 0x09, 0xf1, 0x1b, 0x74, 0x38, 0x1d, 0x32, 0xb6, 0x40, 0x7d, 0x2f, 0x5f, 0x33, 0x05, 0xc5,
+         0xb6, 0xec, 0xc5, 0xed, 0x60, 0xb4, 0x84, 0x31, 0x87, 0x8c, 0x48, 0x0e, 0x13, 0x80, 0x66, 0xc5,
+         0x45, 0xf4, 0xa2, 0x2f, 0xf6, 0x9f, 0xc1, 0xda, 0xcb, 0xf1, 0x00, 0x95, 0x9b, 0xab, 0x80, 0x26,
+         0xaf, 0x79, 0x3c, 0x58, 0x55, 0x18, 0x55, 0x75, 0x36, 0x34, 0xf8, 0x8d, 0xbc, 0x82, 0x69, 0xd4}
+    },
+    {
+        {0x75, 0xd9, 0x42, 0xc0, 0x42, 0x10, 0xdc, 0xde, 0x5d, 0x1b, 0xd4, 0xfa, 0xbf, 0xc7, 0x32, 0xd3,
+         0xf9, 0x55, 0x68, 0xe3, 0x99, 0x38, 0x2c, 0x04, 0x23, 0xc8, 0x3c, 0x41, 0xcb, 0x05, 0xdc, 0x3f,
+         0x69, 0x6c, 0xc1, 0x48, 0x56, 0xcd, 0xc1, 0x3c, 0x8f, 0xd7, 0xe2, 0xc5, 0x77, 0x17, 0x31, 0xcb,
+         0xf3, 0x8e, 0x3f, 0xad, 0x47, 0xa4, 0x24, 0x67, 0x97, 0x65, 0xc4, 0x87, 0x4e, 0x35, 0xab, 0x2d},
+        {0x6d, 0x12, 0xe0, 0xdd, 0x1c, 0xd8, 0xbd, 0x76, 0xad, 0x5a, 0x19, 0x1a, 0x61, 0x92, 0x0f, 0xd4,
+         0xa3, 0xc3, 0x17, 0x24, 0x5e, 0x8b, 0xb2, 0x10, 0xdf, 0x90, 0xa5, 0x7b, 0x88, 0x5f, 0xae, 0x14,
+         0x0d, 0x5c, 0x9e, 0x4b, 0x74, 0xfd, 0xe7, 0x80, 0x2a, 0x0b, 0x83, 0x67, 0x24, 0x05, 0x7a, 0x5b,
+         0x81, 0x0f, 0x20, 0xf7, 0xda, 0xc4, 0x67, 0x5a, 0x4d, 0x24, 0xa3, 0x02, 0x8f, 0x70, 0xbd, 0x8e},
+        {0x7d, 0x04, 0x26, 0x4e, 0x36, 0xe8, 0x88, 0x9e, 0xc5, 0xd5, 0x91, 0x85, 0x10, 0x13, 0xb9, 0x9f,
+         0x3f, 0xa9, 0x09, 0xb4, 0x4e, 0x6b, 0x6d, 0x1c, 0x82, 0x3b, 0x9f, 0x2d, 0x19, 0x9b, 0x00, 0x17,
+         0x6c, 0xc9, 0xf2, 0x69, 0x42, 0x4b, 0x82, 0x7f, 0x9c, 0x77, 0x79, 0x78, 0xa9, 0xa3, 0x33, 0xfa,
+         0xbc, 0x27, 0x8f, 0x15, 0xbf, 0x93, 0xfd, 0x8d, 0xe1, 0xa3, 0x31, 0x9a, 0xe9, 0x30, 0xf8, 0x66},
+        {0x16, 0xc1, 0x55, 0x6c, 0x9a, 0x2b, 0xc1, 0xaf, 0x0b, 0x11, 0xcf, 0x36, 0x95, 0x81, 0xa1, 0x2d,
+         0x06, 0x30, 0x81, 0xad, 0x20, 0xf8, 0x34, 0x07, 0xe1, 0xeb, 0xfb, 0xa2, 0x1f, 0x5f, 0xd5, 0x94,
+         0x23, 0xe3, 0x8c, 0xd5, 0x15, 0x8b, 0x0f, 0x89, 0x1e, 0x19, 0xad, 0xeb, 0xe9, 0x73, 0xb5, 0xb8,
+         0x05, 0xb3, 0x93, 0xde, 0xb8, 0xcf, 0x11, 0xd7, 0x28, 0x13, 0x35, 0x74, 0x5e, 0xf1, 0x4f, 0x36},
+        {0x17, 0x23, 0xbc, 0xb3, 0xe1, 0xd1, 0x50, 0xc6, 0x95, 0x79, 0x6b, 0xfc, 0xe9, 0x8e, 0xd8, 0xd5,
+         0x6c, 0xeb, 0xa3, 0x0d, 0xaa, 0x11, 0x93, 0x02, 0xdb, 0x21, 0x1a, 0xf2, 0xb1, 0x05, 0x18, 0xf5,
+         0x5d, 0x4b, 0xa6, 0x82, 0xe0, 0x8e, 0xbb, 0x23, 0x40, 0x39, 0x80, 0xdb, 0x0c, 0x7e, 0xbd, 0x78,
+         0xaa, 0xf7, 0x75, 0xfb, 0x48, 0x02, 0x50, 0xf5, 0x56, 0xe6, 0x89, 0x80, 0x76, 0x82, 0xb3, 0xea},
+        {0x45, 0x6b, 0xdf, 0x4c, 0x74, 0x23, 0xeb, 0x00, 0xe4, 0x45, 0x5b, 0x4a, 0x69, 0x5e, 0x95, 0x74,
+         0x30, 0x4f, 0xbf, 0xc4, 0xaa, 0xa7, 0xa0, 0x15, 0x93, 0x57, 0x0f, 0xe6, 0x18, 0xe7, 0x79, 0x33,
+         0x57, 0x97, 0x82, 0xc3, 0x6c, 0x68, 0xe8, 0x7c, 0x2b, 0xb0, 0x37, 0x8e, 0xe4, 0x74, 0x63, 0x80,
+         0x79, 0xc7, 0xd0, 0x97, 0x34, 0x9b, 0x5c, 0x29, 0xc0, 0xdd, 0x0b, 0x42, 0xc4, 0x6c, 0x29, 0x97},
+        {0x22, 0x69, 0xa4, 0x6c, 0xdf, 0x0a, 0xa2, 0x11, 0x3b, 0x45, 0x6b, 0xbb, 0x16, 0x5d, 0x9e, 0x45,
+         0x8d, 0x45, 0x88, 0xa8, 0x3a, 0xb7, 0x5c, 0xf5, 0x85, 0x2e, 0xa3, 0x39, 0xf4, 0x41, 0x21, 0x93,
+         0x48, 0x9c, 0xf3, 0x77, 0x1f, 0xa9, 0x97, 0xf2, 0x1b, 0x8a, 0x11, 0xd9, 0xd8, 0x2e, 0x1f, 0xa1,
+         0xce, 0xa1, 0xe0, 0x38, 0x41, 0xff, 0xdf, 0xc0, 0x27, 0xb6, 0x8f, 0x85, 0x51, 0x4c, 0x51, 0x4e},
+        {0x66, 0xe6, 0x32, 0xdb, 0x15, 0xcc, 0x9b, 0x76, 0x95, 0xe7, 0x3e, 0x2b, 0x94, 0x03, 0x3b, 0x8d,
+         0x25, 0xfc, 0xa8, 0x9b, 0x99, 0xef, 0x5e, 0x24, 0x43, 0x6b, 0x80, 0x4b, 0xb6, 0x83, 0xbe, 0x22,
+         0x53, 0x4e, 0x3c, 0x9c, 0x19, 0x4c, 0xcc, 0xc1, 0x90, 0xff, 0xea, 0x06, 0xf0, 0x48, 0xe7, 0xa6,
+         0xf6, 0x5e, 0x6d, 0x5c, 0x7e, 0xf6, 0x07, 0x46, 0x93, 0xfa, 0xd6, 0xa6, 0x13, 0x4a, 0xf0, 0x84}
+    },
+    {
+        {0x5d, 0x93, 0x24, 0xf5, 0x69, 0x75, 0x47, 0x7d, 0x59, 0x45, 0x59, 0x9e, 0xee, 0xcc, 0xec, 0x67,
+         0x70, 0x8c, 0x99, 0x6c, 0xd3, 0xf3, 0xf2, 0x81, 0x8b, 0xf2, 0x59, 0x15, 0x07, 0xe3, 0x50, 0x2a,
+         0x10, 0x98, 0x5a, 0x3c, 0xfd, 0x57, 0x32, 0x05, 0x28, 0x1a, 0xec, 0x24, 0xe2, 0xc8, 0xb4, 0x1f,
+         0x5c, 0xd8, 0xcd, 0xfc, 0x9d, 0x7b, 0xe3, 0x46, 0x75, 0xcf, 0x30, 0x6b, 0xbe, 0x1b, 0x4f, 0x6a},
+        {0x3c, 0x08, 0xb0, 0x99, 0x76, 0xfa, 0x5b, 0x99, 0x27, 0x0e, 0x86, 0x1a, 0x71, 0xc0, 0xab, 0x1f,
+         0xe4, 0xd9, 0x1e, 0x80, 0xe5, 0x22, 0xce, 0xd3, 0xe1, 0x9a, 0xc2, 0xd8, 0x30, 0xf7, 0xdb, 0xa3,
+         0x30, 0xa2, 0xba, 0x28, 0xdf, 0xd7, 0x40, 0x83, 0xde, 0x7a, 0xa9, 0xec, 0xb4, 0x44, 0x3a, 0x37,
+         0x73, 0x36, 0x6a, 0xbd, 0x33, 0xd1, 0xd1, 0xee, 0xa6, 0x5d, 0x6a, 0x1b, 0x85, 0xd2, 0x93, 0x2a},
+        {0x43, 0xa3, 0x76, 0xde, 0x43, 0x57, 0xd8, 0x93, 0x1f, 0x91, 0xd1, 0x78, 0x9b, 0x36, 0x63, 0xb0,
+         0x94, 0x7c, 0x8a, 0xfc, 0xc9, 0xca, 0x7c, 0x8d, 0x15, 0xf3, 0x9f, 0x3f, 0x05, 0x6d, 0xb5, 0xd3,
+         0x11, 0x1b, 0x64, 0xac, 0xd8, 0x6a, 0xa4, 0xe1, 0xf7, 0xbf, 0x7a, 0xc4, 0x53, 0x7e, 0x08, 0x7f,
+         0x70, 0x8f, 0x2f, 0x45, 0xe9, 0x70, 0x28, 0x16, 0xbb, 0x1e, 0x32, 0x3d, 0xa9, 0xe2, 0x35, 0x9b},
+        {0x27, 0xd8, 0x3b, 0x61, 0x33, 0x98, 0x90, 0xb9, 0xc8, 0xfb, 0xd0, 0x0c, 0xb8, 0x65, 0x7e, 0x01,
+         0xe0, 0x8f, 0xe7, 0xe0, 0x2c, 0xf1, 0xcc, 0x0c, 0x99, 0x1f, 0x3e, 0x18, 0x46, 0x47, 0xeb, 0xb2,
+         0x2a, 0xa0, 0x89, 0xaf, 0x71, 0xe2, 0x1d, 0xc6, 0x26, 0x4e, 0xd7, 0x8e, 0xeb, 0xee, 0xca, 0xb4,
+         0x6c, 0x08, 0xc7, 0xe4, 0xc5, 0x93, 0xc8, 0x01, 0xab, 0x74, 0x4b, 0x50, 0x3a, 0x72, 0xbe, 0xa0},
+        {0x21, 0x8b, 0xab, 0xbf, 0x36, 0x0a, 0x8a, 0xe4, 0xeb, 0x37, 0xa0, 0x4a, 0xfb, 0xb6, 0x26, 0x7d,
+         0xb4, 0x29, 0xcb, 0xd6, 0xd9, 0xf1, 0x60, 0xe7, 0x75, 0x70, 0x91, 0x5f, 0x91, 0x79, 0x75, 0xd6,
+         0x45, 0xd5, 0x41, 0x5a, 0xc1, 0x67, 0xb4, 0xae, 0x65, 0xcd, 0x81, 0xcf, 0x98, 0xcb, 0xc2, 0x15,
+         0x04, 0x5d, 0xfc, 0xd7, 0xfc, 0x8f, 0xf3, 0xaf, 0x49, 0xe7, 0xa3, 0x90, 0xac, 0x68, 0xe6, 0xed},
+        {0x50, 0x04, 0xcc, 0x1a, 0x51, 0x2b, 0x71, 0xb7, 0x0f, 0xb3, 0xb4, 0x2c, 0x1d, 0x75, 0xc2, 0x85,
+         0xf3, 0x0a, 0xcd, 0xbf, 0x60, 0xf9, 0x53, 0xe7, 0xbf, 0x5e, 0x3b, 0x1c, 0xab, 0x57, 0xec, 0x26,
+         0x0b, 0xf9, 0x9d, 0x9e, 0xd2, 0x4e, 0x9a, 0x41, 0xbb, 0x82, 0xf1, 0x53, 0xe9, 0xed, 0x00, 0x17,
+         0x3f, 0xc2, 0x32, 0x74, 0xb5, 0xc9, 0xfe, 0xa0, 0xf2, 0x76, 0xf9, 0x94, 0x21, 0x1d, 0x19, 0xbb},
+        {0x43, 0x42, 0xc4, 0x3b, 0x3c, 0xc0, 0x6b, 0x85, 0x04, 0xd1, 0xfb, 0x5e, 0x4d, 0x23, 0x31, 0x73,
+         0x05, 0xa6, 0xbe, 0x2c, 0x10, 0xd1, 0x28, 0xcc, 0xcb, 0x3f, 0x29, 0x0d, 0x43, 0x0c, 0xa9, 0x02,
+         0x76, 0xf4, 0x9a, 0x3d, 0x9f, 0x6c, 0xe7, 0xa6, 0xad, 0x8f, 0x6a, 0xdb, 0xe4, 0x54, 0x88, 0xd3,
+         0x26, 0x91, 0x3f, 0xd0, 0x3e, 0x8a, 0x1d, 0xb1, 0x8c, 0x35, 0xe0, 0x5a, 0xa4, 0x9d, 0x4f, 0xed},
+        {0x46, 0x76, 0xd3, 0x81, 0x2c, 0xc6, 0xb6, 0x6e, 0x1f, 0x8c, 0x51, 0x0f, 0x44, 0x6a, 0xc5, 0x62,
+         0xff, 0x8a, 0x52, 0x08, 0x6d, 0x52, 0x06, 0x74, 0x82, 0xfa, 0xa8, 0xdb, 0xde, 0xe4, 0x0b, 0x98,
+         0x7d, 0x89, 0xe2, 0xb7, 0x74, 0x4c, 0x57, 0xb1, 0x05, 0x14, 0x50, 0xa0, 0x45, 0x7f, 0xa0, 0xeb,
+         0x2a, 0x95, 0xc1, 0xbf, 0x8e, 0xd6, 0xbd, 0xf6, 0x8f, 0x1a, 0xa7, 0x80, 0x2e, 0x74, 0x29, 0xf4}
+    },
+    {
+        {0x75, 0x11, 0x06, 0x6c, 0x0e, 0x12, 0x10, 0x5a, 0x7b, 0x93, 0x7c, 0x7e, 0xce, 0xf3, 0x67, 0xd5,
+         0xaf, 0xe6, 0xe6, 0x21, 0xe5, 0xca, 0xbf, 0x4e, 0x49, 0x0b, 0x09, 0xb7, 0xad, 0xa7, 0xee, 0x07,
+         0x60, 0x4d, 0xf3, 0x65, 0xb8, 0x39, 0x1c, 0xbc, 0xa8, 0x84, 0x8f, 0x88, 0xda, 0xa7, 0x00, 0xb7,
+         0x70, 0xda, 0x5b, 0xb1, 0x36, 0xf7, 0x0b, 0xfb, 0x0a, 0x3e, 0xa3, 0x3b, 0xa3, 0x86, 0xfc, 0xd5},
+        {0x66, 0x8d, 0x59, 0x60, 0xc0, 0xb4, 0x3b, 0x91, 0x18, 0x5f, 0xc9, 0x0d, 0x18, 0xad, 0x46, 0xa4,
+         0x51, 0x52, 0x35, 0xc7, 0x18, 0x5b, 0xd5, 0x25, 0x49, 0x81, 0xd2, 0x6a, 0xe8, 0x61, 0x98, 0x07,
+         0x7a, 0x66, 0xf7, 0x57, 0xc2, 0x19, 0x00, 0xb1, 0xe9, 0x3c, 0x86, 0xe6, 0x82, 0x11, 0x4d, 0xe2,
+         0xb5, 0xd3, 0xa2, 0x48, 0x85, 0x09, 0x58, 0xd9, 0x57, 0xae, 0x24, 0x6e, 0x53, 0x79, 0x1b, 0x03},
+        {0x15, 0x8a, 0xf2, 0xb7, 0x48, 0x82, 0x82, 0x0f, 0xe0, 0xd4, 0x8c, 0x35, 0x20, 0x12, 0xa9, 0xc0,
+         0xe7, 0x25, 0x08, 0xf0, 0x0f, 0x08, 0xb4, 0x96, 0xb3, 0x62, 0xd8, 0x35, 0x2e, 0x17, 0x52, 0x64,
+         0x62, 0x7e, 0x7c, 0xd7, 0x34, 0xb0, 0x38, 0x1d, 0x7d, 0x75, 0xcf, 0xfa, 0x83, 0x3a, 0xee, 0xd6,
+         0x4d, 0x2e, 0x02, 0x28, 0xcd, 0x37, 0x95, 0x25, 0x4c, 0x72, 0x53, 0x0b, 0xd1, 0x56, 0x17, 0x46},
+        {0x50, 0x89, 0xc5, 0x80, 0x85, 0xe7, 0x46, 0x44, 0xf8, 0x5e, 0x2d, 0x03, 0xef, 0x07, 0x59, 0x21,
+         0x8d, 0xff, 0x97, 0x6d, 0x9e, 0x8d, 0xb4, 0xca, 0x9f, 0x95, 0x22, 0xd7, 0x03, 0x89, 0xe3, 0x0f,
+         0x50, 0xca, 0xb9, 0x59, 0xcb, 0x2b, 0x60, 0x41, 0x96, 0xfa, 0x7a, 0xb7, 0x30, 0x94, 0x34, 0x7b,
+         0xad, 0xcb, 0x95, 0x4e, 0xc3, 0x20, 0xfa, 0x01, 0x52, 0x29, 0x86, 0x24, 0x86, 0x53, 0xd8, 0x8b},
+        {0x7d, 0x5f, 0x64, 0x73, 0xe7, 0xc2, 0xf3, 0x94, 0x3b, 0x36, 0x7c, 0xec, 0x6d, 0xe4, 0x8d, 0x98,
+         0x6d, 0xc0, 0xce, 0xa5, 0x6b, 0x0f, 0x6c, 0xff, 0x9b, 0x59, 0x40, 0xab, 0xde, 0x75, 0x55, 0xf6,
+         0x3c, 0x49, 0xc7, 0x3b, 0xc2, 0xba, 0x82, 0xe6, 0x25, 0xb2, 0x7d, 0x7d, 0x59, 0x50, 0x63, 0xf5,
+         0x85, 0x44, 0xf8, 0x55, 0x77, 0xb4, 0x9b, 0xe1, 0x00, 0x61, 0x17, 0x99, 0x93, 0xdf, 0x25, 0x40},
+        {0x5d, 0xde, 0x3f, 0x53, 0x03, 0x54, 0xc5, 0x3c, 0x98, 0x1d, 0xdb, 0xf8, 0x47, 0x41, 0xec, 0x31,
+         0xfe, 0xe5, 0x33, 0xb1, 0x0f, 0x88, 0xb9, 0xda, 0x31, 0x2a, 0x4e, 0x97, 0xe3, 0xf8, 0x68, 0xa1,
+         0x75, 0x95, 0x27, 0x49, 0x8e, 0x0c, 0x4f, 0x36, 0x29, 0xc2, 0xc5, 0xcd, 0xea, 0xce, 0x10, 0x48,
+         0xc6, 0x41, 0x34, 0x93, 0x74, 0x82, 0x2f, 0x8a, 0xed, 0x2c, 0x84, 0x80, 0x04, 0x27, 0xa7, 0xc8},
+        {0x3d, 0x5a, 0x99, 0x5a, 0x52, 0x3d, 0x9d, 0x05, 0x03, 0xbd, 0x70, 0x90, 0xda, 0x20, 0x84, 0xf7,
+         0xf3, 0x44, 0x81, 0x46, 0x2b, 0xcb, 0xb3, 0xff, 0xda, 0x87, 0xf4, 0xfb, 0xb4, 0xaa, 0x85, 0xb4,
+         0x70, 0x66, 0x63, 0xd3, 0x30, 0xb1, 0xd1, 0xa7, 0x53, 0x4a, 0x73, 0xa7, 0x25, 0xeb, 0x5d, 0x2b,
+         0xff, 0xcd, 0x5f, 0x6a, 0xc4, 0xa6, 0x13, 0xb1, 0x90, 0xec, 0xb5, 0x66, 0xed, 0xf5, 0x82, 0x20},
+        {0x07, 0x61, 0xaf, 0xfb, 0x1e, 0x0d, 0x40, 0x80, 0x02, 0xcc, 0x42, 0x7d, 0xc6, 0xff, 0xf6, 0x11,
+         0x53, 0x6e, 0x2b, 0x98, 0x9b, 0x0a, 0x5f, 0x94, 0x88, 0x3a, 0x1b, 0x23, 0x78, 0x9b, 0x5b, 0xc2,
+         0x3a, 0x6d, 0x11, 0x0e, 0x60, 0x70, 0x15, 0x3b, 0x7c, 0x42, 0x10, 0x2c, 0x6d, 0xac, 0x97, 0x69,
+         0x5b, 0x4a, 0x45, 0x87, 0x2c, 0xc4, 0x7c, 0x04, 0x39, 0x2e, 0xa1, 0x70, 0x81, 0x2f, 0xe6, 0xb0}
+    },
+    {
+        {0x25, 0x96, 0xe5, 0xb3, 0xcf, 0x54, 0x94, 0xe6, 0x0d, 0x2a, 0x75, 0x0d, 0x03, 0xc6, 0x6a, 0xbc,
+         0x2e, 0x01, 0x83, 0xaf, 0x53, 0x62, 0x0b, 0x89, 0x3f, 0x9c, 0xf9, 0xfc, 0x3b, 0x76, 0xdc, 0x26,
+         0x68, 0xa0, 0xa7, 0xac, 0x9a, 0x0c, 0xc0, 0x93, 0x88, 0x4a, 0x6b, 0x84, 0xf4, 0x5a, 0x2c, 0xde,
+         0x59, 0x51, 0x94, 0xe0, 0xf4, 0x8d, 0xbd, 0x56, 0x6f, 0xa7, 0x8a, 0x31, 0x74, 0xb1, 0x82, 0xfe},
+        {0x24, 0x96, 0x51, 0xcc, 0x14, 0x32, 0x49, 0xf8, 0x75, 0xc5, 0x3d, 0x5a, 0xac, 0x9c, 0xd3, 0xb8,
+         0x18, 0x98, 0x93, 0x87, 0x87, 0x5c, 0x08, 0xc7, 0xad, 0x10, 0x47, 0x23, 0xc7, 0xd6, 0x0d, 0x25,
+         0x02, 0x8f, 0xdf, 0x17, 0xc1, 0x5b, 0xb6, 0xb0, 0xc4, 0xdd, 0x06, 0xab, 0xd2, 0x10, 0x15, 0x5b,
+         0x2b, 0xde, 0xca, 0x64, 0xa5, 0xf0, 0x2a, 0x69, 0x34, 0xf0, 0x04, 0x37, 0xf0, 0x5d, 0x9c, 0x65},
+        {0x0a, 0x12, 0xde, 0xab, 0x65, 0x21, 0x9d, 0x72, 0xf6, 0x9c, 0x4e, 0x6c, 0x7d, 0xbd, 0xd4, 0x66,
+         0x62, 0x89, 0x5f, 0x17, 0xae, 0x3f, 0x61, 0x98, 0xc3, 0xd3, 0x4d, 0xd5, 0xc6, 0x16, 0xe0, 0x85,
+         0x53, 0x79, 0x8a, 0x24, 0xde, 0x90, 0x16, 0xba, 0x3e, 0x99, 0x7b, 0xb2, 0xd8, 0xf5, 0x02, 0x14,
+         0xc7, 0xc0, 0xbd, 0xb7, 0x2f, 0x1b, 0x5a, 0x5c, 0x29, 0x51, 0x14, 0xc5, 0x09, 0x53, 0x15, 0x18},
+        {0x05, 0x55, 0x43, 0x9a, 0x08, 0x91, 0x50, 0x0e, 0x49, 0xa2, 0x5c, 0xcc, 0x1d, 0xc9, 0x8f, 0xb6,
+         0x00, 0xad, 0x0f, 0x84, 0x60, 0x04, 0x94, 0x32, 0x2c, 0x44, 0x31, 0x5c, 0xbf, 0x3d, 0x59, 0xbd,
+         0x58, 0x35, 0xc9, 0x95, 0x33, 0xf4, 0x4b, 0xce, 0xff, 0xfd, 0x61, 0xbc, 0x89, 0x26, 0xaf, 0x99,
+         0xaf, 0x9d, 0x0f, 0x66, 0x9e, 0x42, 0x85, 0x93, 0xec, 0x19, 0x12, 0x9b, 0xdf, 0x55, 0x93, 0x5d},
+        {0x60, 0x47, 0x67, 0x08, 0x68, 0x76, 0x59, 0x22, 0x14, 0xd0, 0xcc, 0xf3, 0x09, 0x61, 0x64, 0x33,
+         0xdb, 0x61, 0x24, 0x07, 0x56, 0x6a, 0xb9, 0xf0, 0xdf, 0x85, 0xbf, 0x77, 0x5b, 0x97, 0x2b, 0x6b,
+         0x3a, 0x19, 0xa9, 0xaa, 0x7f, 0x5e, 0x53, 0x67, 0xae, 0x75, 0x45, 0x37, 0x5f, 0xd6, 0xdd, 0xff,
+         0x48, 0x4d, 0x59, 0x21, 0x5f, 0x8a, 0xbf, 0xdf, 0xdc, 0x93, 0x1d, 0x36, 0x3f, 0xeb, 0x73, 0x2e},
+        {0x67, 0xaf, 0x87, 0x2c, 0xb0, 0x8f, 0x8b, 0xaa, 0x6e, 0x56, 0x84, 0x9b, 0xa5, 0x39, 0xa7, 0x54,
+         0x60, 0x23, 0x07, 0xe6, 0x9a, 0xf9, 0xe2, 0x57, 0xdc, 0xa7, 0x44, 0xcb, 0xda, 0xf9, 0x55, 0x12,
+         0x0e, 0x93, 0x42, 0x12, 0xa5, 0x87, 0x57, 0x08, 0x39, 0xfb, 0x11, 0xdc, 0x7a, 0x44, 0x8e, 0x44,
+         0x5d, 0x1f, 0xba, 0x32, 0x49, 0x4b, 0x00, 0x7a, 0xa8, 0x32, 0xf8, 0x12, 0xb2, 0x4c, 0xa9, 0x00},
+        {0x2f, 0xc8, 0x18, 0x59, 0xc8, 0xe7, 0xf2, 0x7a, 0x79, 0x24, 0xd6, 0xa1, 0x61, 0x12, 0x0e, 0xad,
+         0x48, 0xe2, 0x9e, 0x70, 0xa8, 0xb0, 0x5f, 0x13, 0x9b, 0xc2, 0x3d, 0xc3, 0x5c, 0x20, 0x75, 0x0e,
+         0x51, 0x96, 0x50, 0x67, 0x7e, 0x82, 0x58, 0x7d, 0x5c, 0xa0, 0x7b, 0xa4, 0x7a, 0x2b, 0xd4, 0xf1,
+         0xe7, 0x95, 0x10, 0x94, 0xa4, 0x0a, 0xfb, 0xbb, 0x72, 0x7d, 0x81, 0xec, 0x1d, 0x9f, 0xc5, 0x34},
+        {0x0d, 0xec, 0x36, 0x76, 0x05, 0x5d, 0x5d, 0xaf, 0xe7, 0x54, 0x4e, 0xdd, 0x68, 0xb7, 0xa8, 0x0c,
+         0xda, 0x04, 0x43, 0xb3, 0x11, 0x63, 0x8b, 0x16, 0xa8, 0xaa, 0xd0, 0x59, 0x72, 0xae, 0xb4, 0x17,
+         0x48, 0xfa, 0x8d, 0xc3, 0xa8, 0x20, 0x49, 0x98, 0x9f, 0x4c, 0xdc, 0xa7, 0xc6, 0x54, 0x55, 0x13,
+         0xf0, 0x29, 0x06, 0xfb, 0xc4, 0xc3, 0x7d, 0x5b, 0x74, 0x57, 0x55, 0x38, 0x32, 0x82, 0x7c, 0x6d}
+    },
+    {
+        {0x28, 0xbd, 0x38, 0xd4, 0x40, 0x30, 0xdd, 0x9c, 0xa0, 0x28, 0xb2, 0xa2, 0xf3, 0x1a, 0x79, 0x5f,
+         0x4c, 0x7a, 0x5e, 0x85, 0xa7, 0x85, 0xdf, 0x78, 0x47, 0xe3, 0xd5, 0x25, 0xe9, 0x9d, 0x47, 0x87,
+         0x55, 0x2d, 0xd7, 0x40, 0x5c, 0x41, 0x83, 0x73, 0x3a, 0xd3, 0xc4, 0xe7, 0xcc, 0xb9, 0x99, 0xb4,
+         0xfe, 0xd8, 0x1b, 0x7a, 0x44, 0x44, 0xaa, 0xb4, 0x99, 0xd4, 0x1d, 0x6d, 0x78, 0xd5, 0xbb, 0xfc},
+        {0x0e, 0xc8, 0xfe, 0x27, 0xa5, 0x1e, 0x6f, 0x75, 0xd4, 0x19, 0x7b, 0x47, 0x11, 0xb5, 0xf1, 0x7d,
+         0x8f, 0xc0, 0x23, 0x22, 0x44, 0x26, 0xa7, 0xa1, 0x7d, 0x3f, 0xdc, 0xe5, 0x5f, 0x7b, 0xe1, 0x26,
+         0x3d, 0xe8, 0x3d, 0xaf, 0x93, 0xd8, 0xaa, 0x7f, 0x76, 0x75, 0xb8, 0xdf, 0x61, 0xc0, 0x7b, 0x3c,
+         0x1c, 0xf8, 0xfe, 0x6b, 0x81, 0x32, 0x7c, 0x3d, 0xb1, 0xed, 0x2c, 0xef, 0xab, 0x3d, 0x11, 0xd3},
+        {0x19, 0x0b, 0xb4, 0x43, 0xa0, 0x2d, 0x3c, 0xd6, 0xde, 0x2f, 0x5e, 0x17, 0x79, 0xb5, 0x52, 0xa0,
+         0xef, 0xff, 0x52, 0x51, 0x69, 0x04, 0xce, 0xef, 0x9b, 0x82, 0x7e, 0xb6, 0x8d, 0x4e, 0x5b, 0xfd,
+         0x5a, 0x60, 0x1f, 0x55, 0x62, 0x39, 0x71, 0x5d, 0xc1, 0x81, 0xf5, 0x30, 0x3a, 0x8b, 0xb7, 0x14,
+         0xa3, 0xe0, 0xf2, 0xf2, 0x2f, 0xea, 0x2d, 0x51, 0x18, 0x9e, 0xf4, 0x17, 0x48, 0x48, 0x61, 0xc0},
+        {0x39, 0x3f, 0xb3, 0xd0, 0xb2, 0x16, 0xd7, 0xa5, 0xf4, 0x8d, 0xa1, 0xdb, 0xe2, 0xfa, 0xe3, 0x7c,
+         0x18, 0x63, 0x63, 0x6e, 0x59, 0x9d, 0x72, 0x5b, 0x0a, 0x4d, 0xdb, 0x6c, 0x76, 0x8a, 0x89, 0xe5,
+         0x4e, 0x21, 0x07, 0xbc, 0x67, 0x44, 0x05, 0xda, 0x51, 0x7b, 0xd3, 0xef, 0x96, 0x05, 0xb5, 0xef,
+         0x6b, 0xf7, 0x2e, 0x94, 0xc7, 0x96, 0x3a, 0x80, 0x24, 0x17, 0x76, 0xf5, 0x6c, 0x09, 0x60, 0xce},
+        {0x30, 0xd3, 0x83, 0x13, 0x92, 0xa5, 0x7a, 0xee, 0xfb, 0x5e, 0xe5, 0xa2, 0x45, 0x9e, 0x4d, 0x49,
+         0x3d, 0x45, 0xa8, 0x93, 0x30, 0x70, 0x38, 0x7e, 0x8f, 0x0e, 0x9d, 0x00, 0x95, 0x7c, 0x99, 0x07,
+         0x50, 0xe6, 0x44, 0xa2, 0x9b, 0xc8, 0x58, 0x1c, 0xe7, 0xdc, 0x02, 0x00, 0x8f, 0x60, 0x02, 0xec,
+         0x89, 0x84, 0x3f, 0xb2, 0x22, 0x9e, 0x3a, 0xfb, 0x82, 0xed, 0xcc, 0x64, 0xcf, 0xf5, 0x59, 0xb9},
+        {0x18, 0xb6, 0x12, 0x32, 0x4c, 0xcf, 0xb5, 0xf0, 0x47, 0xad, 0x25, 0x6d, 0xc9, 0x7f, 0x91, 0x6c,
+         0xd7, 0x6f, 0xcb, 0x9b, 0x95, 0x79, 0xf9, 0xeb, 0xdd, 0x1f, 0x3d, 0x7b, 0x00, 0xd6, 0x83, 0x8c,
+         0x4b, 0x6d, 0xaf, 0xa3, 0x63, 0x09, 0xcc, 0x7d, 0xd1, 0x28, 0x03, 0x69, 0x30, 0xb3, 0xd3, 0x61,
+         0x74, 0x74, 0xf1, 0x76, 0x0d, 0x0d, 0x1d, 0xa2, 0x05, 0x53, 0xd7, 0x57, 0x88, 0xf5, 0xa8, 0xbf},
+        {0x6e, 0x84, 0x7a, 0xf3, 0xae, 0x32, 0x67, 0x6a, 0x9c, 0xea, 0x02, 0x21, 0x76, 0x61, 0x09, 0x1b,
+         0x33, 0xb2, 0x4b, 0xfe, 0x60, 0x73, 0xc4, 0xb1, 0xd5, 0x87, 0xb2, 0xec, 0xa0, 0xb6, 0x00, 0xc4,
+         0x36, 0x2e, 0xa2, 0x53, 0xba, 0xea, 0x26, 0x9b, 0xc9, 0x55, 0xb2, 0x83, 0x65, 0xbb, 0xb4, 0xe8,
+         0x3a, 0x67, 0x51, 0xcd, 0xeb, 0x91, 0x74, 0x76, 0xe0, 0xd9, 0x99, 0xf7, 0xa2, 0x18, 0x21, 0x48},
+        {0x1e, 0xdf, 0xf1, 0x3d, 0x99, 0x07, 0x3e, 0x0e, 0x64, 0x41, 0xde, 0x58, 0x43, 0x8f, 0xeb, 0x37,
+         0xc6, 0xe1, 0xea, 0xa3, 0x10, 0x31, 0x97, 0xeb, 0x7d, 0x22, 0xde, 0xb9, 0x21, 0x6f, 0x73, 0xe9,
+         0x2e, 0x42, 0xeb, 0x00, 0xcb, 0xc1, 0x92, 0x62, 0xa6, 0xca, 0xf1, 0xa5, 0x18, 0x09, 0xd2, 0x66,
+         0x74, 0xc8, 0x78, 0xd7, 0x18, 0xcd, 0x86, 0xa9, 0xe4, 0xe2, 0x06, 0x17, 0xc2, 0x43, 0xad, 0xf8}
+    },
+    {
+        {0x59, 0x23, 0x3a, 0x33, 0x46, 0xf6, 0x11, 0x35, 0xf4, 0x31, 0xf9, 0x6c, 0xf0, 0x19, 0x7e, 0x24,
+         0xad, 0x38, 0x24, 0x0b, 0x22, 0x2c, 0x01, 0x0a, 0x6c, 0xe5, 0x38, 0xcf, 0x4c, 0x24, 0x34, 0x7b,
+         0x3c, 0xce, 0x55, 0x90, 0x86, 0x11, 0xd2, 0xb9, 0x3f, 0x22, 0x16, 0x13, 0xf0, 0x9c, 0xfc, 0x4d,
+         0xbc, 0xd2, 0xe2, 0xb6, 0x09, 0x23, 0x3e, 0xea, 0x54, 0x39, 0xad, 0x19, 0x08, 0xa1, 0x0b, 0x20},
+        {0x4b, 0x82, 0xeb, 0xa7, 0x8a, 0xf0, 0x8d, 0xa3, 0x95, 0xd2, 0xb4, 0x8b, 0xf1, 0x7f, 0x55, 0xf9,
+         0x84, 0xd7, 0x99, 0x12, 0x77, 0x77, 0x7e, 0x29, 0xec, 0x8e, 0x3c, 0x4a, 0xfd, 0xbf, 0xea, 0x1a,
+         0x14, 0x37, 0x57, 0x96, 0x45, 0x92, 0x5f, 0x5d, 0x24, 0x1c, 0x94, 0xc1, 0xc6, 0x4c, 0x55, 0xc3,
+         0x9f, 0x64, 0x03, 0x3f, 0xf8, 0x23, 0x44, 0x41, 0xe0, 0x0a, 0xde, 0xf6, 0x3a, 0xf4, 0x28, 0x2c},
+        {0x21, 0xeb, 0xcd, 0xaf, 0xfd, 0x7c, 0x51, 0xda, 0x7e, 0xd1, 0x1d, 0x8c, 0xfe, 0x1b, 0x90, 0x42,
+         0xa0, 0xb7, 0xe0, 0xa9, 0x74, 0xe6, 0xb4, 0xe0, 0x7f, 0x06, 0x32, 0x62, 0x26, 0x35, 0xe3, 0x3b,
+         0x19, 0x75, 0xaa, 0xdd, 0xb5, 0x08, 0xa2, 0x5a, 0x97, 0x69, 0x47, 0x09, 0x57, 0xc9, 0x3d, 0xa1,
+         0x56, 0xe2, 0xad, 0x45, 0x19, 0x16, 0x14, 0xe8, 0xf5, 0x49, 0x42, 0x01, 0xc3, 0x0a, 0x54, 0x27},
+        {0x1a, 0x2c, 0xd9, 0x9d, 0x3d, 0x94, 0xed, 0x5a, 0x18, 0x6f, 0x69, 0xc4, 0xeb, 0xb1, 0x6f, 0xb2,
+         0x82, 0xa5, 0x89, 0xf9, 0x23, 0x75, 0x85, 0xa5, 0x5b, 0xa0, 0x76, 0xb9, 0x66, 0x90, 0xcd, 0xc1,
+         0x40, 0x44, 0xba, 0xbe, 0x0b, 0x4d, 0xe4, 0x97, 0x04, 0x9f, 0x1a, 0x9e, 0x99, 0x5a, 0xc6, 0xe6,
+         0xef, 0x0b, 0xed, 0xd2, 0xe8, 0x22, 0xb0, 0xf8, 0xe0, 0x37, 0xb7, 0x06, 0x73, 0xe6, 0xb0, 0x35},
+        {0x0e, 0xa2, 0x1d, 0x01, 0x5e, 0x54, 0x7d, 0x73, 0x33, 0xce, 0x83, 0xb5, 0xd9, 0x7b, 0x5a, 0x65,
+         0x1c, 0x68, 0x71, 0x35, 0x09, 0x4b, 0xd5, 0x36, 0xe9, 0x58, 0xdd, 0xe3, 0x34, 0x8b, 0xad, 0x11,
+         0x48, 0xbc, 0x49, 0xf2, 0x4f, 0x32, 0xfb, 0x1f, 0x95, 0x91, 0x3c, 0x0a, 0xd8, 0x9a, 0xb4, 0x41,
+         0x70, 0x36, 0x3d, 0xde, 0xe1, 0x4a, 0x66, 0x63, 0x9a, 0x05, 0x35, 0xac, 0xb8, 0x43, 0x25, 0xb9},
+        {0x73, 0x1c, 0x29, 0x5b, 0xf3, 0x89, 0xb0, 0xdd, 0xbe, 0xa0, 0x3b, 0x9b, 0xbb, 0x6c, 0x55, 0xe7,
+         0x64, 0x03, 0x6e, 0x0c, 0x1c, 0xe4, 0xa4, 0xdd, 0x32, 0x93, 0xa3, 0x5f, 0x87, 0xc5, 0x7e, 0xeb,
+         0x42, 0x0a, 0xf8, 0x66, 0xc9, 0x50, 0xeb, 0x73, 0x83, 0x08, 0x23, 0x96, 0x3b, 0x5e, 0xc9, 0x60,
+         0x78, 0x94, 0xb3, 0xd5, 0x57, 0xf2, 0xe5, 0x94, 0x3a, 0xee, 0x86, 0x26, 0xe1, 0xc4, 0x9a, 0xe2},
+        {0x7d, 0xca, 0x83, 0x00, 0x10, 0x79, 0x5b, 0x15, 0x35, 0xe6, 0xeb, 0xf4, 0x3f, 0x62, 0x86, 0x36,
+         0x31, 0x8b, 0x89, 0xba, 0xd1, 0x3f, 0x52, 0x5b, 0xad, 0xf3, 0xf2, 0xb1, 0x96, 0xcb, 0x73, 0x1e,
+         0x54, 0x5c, 0x39, 0xf9, 0xb3, 0xc8, 0x51, 0xd7, 0xab, 0x5d, 0xe4, 0x08, 0x3d, 0x93, 0x27, 0xee,
+         0x05, 0xe6, 0xab, 0x32, 0x0a, 0x41, 0x6b, 0xcf, 0xb0, 0xc3, 0xde, 0x8b, 0x82, 0x9f, 0x52, 0x02},
+        {0x24, 0x49, 0x7c, 0x51, 0xa6, 0x39, 0x67, 0x0f, 0x65, 0x30, 0x76, 0xaa, 0x14, 0xee, 0x82, 0x6a,
+         0x42, 0x41, 0xd6, 0xb2, 0x0a, 0x89, 0x88, 0x6f, 0x54, 0xbb, 0x1f, 0x5f, 0x91, 0x96, 0x56, 0xc1,
+         0x3b, 0x80, 0xf8, 0x29, 0x01, 0xf1, 0x78, 0x08, 0xa3, 0xd7, 0xa9, 0x86, 0x36, 0x74, 0x10, 0x54,
+         0x80, 0x92, 0xcb, 0x51, 0x20, 0xdb, 0x46, 0x70, 0xd3, 0x75, 0x0f, 0x11, 0xd1, 0x78, 0xa3, 0x35}
+    },
+    {
+        {0x58, 0x30, 0xf0, 0x25, 0xf1, 0x07, 0x8d, 0x40, 0x89, 0x48, 0xf7, 0x30, 0x96, 0xaf, 0x97, 0xde,
+         0x1e, 0x9e, 0x70, 0xb3, 0xbe, 0x85, 0x89, 0x0a, 0xcb, 0x21, 0x13, 0x2c, 0x34, 0xff, 0x96, 0x1f,
+         0x67, 0xd4, 0x51, 0x75, 0x2c, 0x24, 0x33, 0xff, 0xe6, 0x6e, 0x47, 0x24, 0x2e, 0x30, 0x1e, 0x56,
+         0xdb, 0x2b, 0x2f, 0x82, 0x03, 0x55, 0x3c, 0xab, 0x9d, 0xe7, 0x17, 0xe2, 0x57, 0x93, 0xd4, 0x1e},
+        {0x19, 0x92, 0x91, 0x24, 0xab, 0x57, 0x79, 0xc9, 0xa9, 0x9e, 0x2d, 0x17, 0x16, 0xd8, 0xc0, 0x78,
+         0x13, 0x13, 0x2b, 0x29, 0xc6, 0x9a, 0x3c, 0x1e, 0xd1, 0xf4, 0xe1, 0x5d, 0xa1, 0xd9, 0x06, 0x2b,
+         0x52, 0xc0, 0xcb, 0xef, 0x54, 0x1f, 0xe8, 0x0c, 0x1e, 0x9b, 0x99, 0x94, 0x83, 0x04, 0x1e, 0x79,
+         0x95, 0x0a, 0x13, 0xc4, 0x42, 0x40, 0x73, 0x60, 0x7d, 0x49, 0x75, 0xa6, 0x9c, 0xa1, 0xfb, 0x69},
+        {0x63, 0x31, 0x98, 0xa5, 0xaf, 0x64, 0xeb, 0x25, 0x3d, 0x99, 0xab, 0x97, 0x0c, 0x59, 0x62, 0xbd,
+         0xd1, 0x5e, 0x0a, 0xea, 0x2c, 0xc5, 0xbc, 0x27, 0x43, 0x9b, 0x72, 0x0f, 0x2c, 0x76, 0x15, 0x8f,
+         0x08, 0x88, 0xe9, 0xe9, 0xda, 0x04, 0x9e, 0x76, 0x8f, 0x20, 0x84, 0x47, 0x40, 0xc2, 0x82, 0x68,
+         0xf1, 0xec, 0x27, 0x3d, 0x03, 0x07, 0xcb, 0xbc, 0x4d, 0xc4, 0x0d, 0xe6, 0x4a, 0x7b, 0x0c, 0x18},
+        {0x08, 0x49, 0xc9, 0xe6, 0xda, 0x66, 0xd1, 0x7b, 0xbf, 0x08, 0xdf, 0xdd, 0x33, 0x9c, 0xf0, 0xc0,
+         0x74, 0xed, 0x67, 0x1a, 0x2e, 0xd9, 0x1d, 0xcf, 0x7a, 0x6a, 0x87, 0x37, 0xa1, 0x73, 0x89, 0x14,
+         0x09, 0xf4, 0xdc, 0xbc, 0x5a, 0xe5, 0x03, 0x92, 0xc9, 0x2f, 0xaf, 0x40, 0x2c, 0xc4, 0xf1, 0x7a,
+         0x92, 0x57, 0x3a, 0x80, 0xd4, 0x2e, 0x5a, 0x4c, 0x21, 0xde, 0x0a, 0xb0, 0x55, 0x5e, 0xdd, 0xe9},
+        {0x1d, 0xeb, 0x18, 0xe4, 0xd0, 0x5b, 0x2c, 0xdd, 0xed, 0x11, 0xb2, 0x5b, 0x88, 0xd0, 0x39, 0x07,
+         0x39, 0x65, 0x96, 0xec, 0xda, 0xfe, 0x86, 0x85, 0xc8, 0xa5, 0xcd, 0x31, 0xfd, 0x1e, 0x41, 0xbf,
+         0x4a, 0xc1, 0xd5, 0xc8, 0xcb, 0x78, 0xe4, 0x41, 0x96, 0xa3, 0xf4, 0xbb, 0x6a, 0x0a, 0x80, 0x72,
+         0x10, 0x34, 0x8f, 0x21, 0x59, 0xfe, 0x69, 0x90, 0x3a, 0x82, 0x09, 0x12, 0xf6, 0x04, 0xfd, 0x5f},
+        {0x1e, 0x09, 0x90, 0xd0, 0x3b, 0xcf, 0x64, 0x41, 0x13, 0x34, 0x69, 0x2c, 0xff, 0xd1, 0xef, 0xcd,
+         0xfd, 0x0c, 0x99, 0x7e, 0x8f, 0xb4, 0xad, 0x4a, 0x93, 0x80, 0x86, 0x05, 0x7c, 0x2b, 0xe1, 0xf3,
+         0x0e, 0xa9, 0x35, 0x0f, 0x18, 0x81, 0xf5, 0xea, 0x52, 0xc0, 0x29, 0xb6, 0x7d, 0x62, 0x84, 0x26,
+         0x8c, 0xa2, 0x99, 0x87, 0x34, 0x5c, 0xaa, 0x15, 0xf4, 0xaa, 0x45, 0xe6, 0x80, 0xd6, 0x45, 0x9d},
+        {0x1c, 0xb7, 0xa4, 0x0c, 0x1d, 0x8d, 0x48, 0xc4, 0x56, 0xfd, 0x58, 0xd2, 0x48, 0x6d, 0xe9, 0x5c,
+         0x65, 0x76, 0x3a, 0x1e, 0xa5, 0x57, 0x4c, 0x60, 0xf2, 0x2b, 0xd3, 0xfb, 0x97, 0x91, 0xb9, 0x43,
+         0x28, 0x35, 0x01, 0x96, 0x89, 0xbe, 0x91, 0x1d, 0x20, 0x41, 0xa2, 0xa5, 0x61, 0xcc, 0xec, 0xc3,
+         0x13, 0x7a, 0x69, 0x52, 0x49, 0xac, 0xce, 0x48, 0x38, 0x3e, 0xdb, 0xae, 0xc6, 0x7e, 0xf7, 0x76},
+        {0x03, 0xde, 0xc0, 0x5f, 0xa9, 0x37, 0xad, 0xb1, 0x79, 0x6e, 0x9d, 0x70, 0xe8, 0x92, 0xae, 0x0f,
+         0x46, 0x36, 0xb0, 0xb2, 0xf1, 0xe3, 0x54, 0x44, 0x52, 0x5f, 0x94, 0x6d, 0x7c, 0x72, 0x20, 0xe7,
+         0x15, 0x94, 0x9f, 0x78, 0x4d, 0x84, 0x72, 0xf5, 0x69, 0x11, 0x29, 0xfe, 0xe5, 0x5a, 0xfc, 0x39,
+         0x46, 0x25, 0x88, 0xc4, 0xa4, 0xca, 0x4f, 0x14, 0x6d, 0x1c, 0x27, 0x1c, 0xc6, 0x37, 0x55, 0x15}
+    },
+    {
+        {0x6a, 0x0c, 0x8b, 0x19, 0x45, 0x71, 0xe8, 0x74, 0xb8, 0x2d, 0x90, 0x4d, 0xa3, 0x6d, 0x43, 0x09,
+         0x6b, 0xbe, 0x36, 0xd5, 0x12, 0xe2, 0x4f, 0xf8, 0xdc, 0xb2, 0xb0, 0x0b, 0x57, 0xff, 0xd3, 0xec,
+         0x5f, 0x85, 0xad, 0xb7, 0x74, 0x9c, 0xc7, 0x35, 0xec, 0x83, 0x8b, 0xcc, 0xcf, 0xe7, 0xd4, 0xb5,
+         0x29, 0x02, 0xc6, 0x13, 0x29, 0x98, 0xd7, 0xac, 0x8e, 0x03, 0x2c, 0xad, 0x03, 0x1c, 0x42, 0xb8},
+        {0x34, 0x91, 0xb2, 0xf2, 0x56, 0x03, 0xbb, 0x1a, 0x98, 0x41, 0xe6, 0xe6, 0x25, 0x96, 0xcb, 0xb7,
+         0x31, 0x03, 0x33, 0xff, 0x29, 0xb1, 0xb8, 0x4f, 0x5a, 0x68, 0x69, 0x45, 0x56, 0xe1, 0x84, 0x78,
+         0x09, 0x88, 0xbe, 0xda, 0x39, 0x3e, 0xb3, 0xe3, 0xe5, 0x7b, 0xf5, 0x87, 0x59, 0x80, 0xdc, 0xbe,
+         0xaa, 0x11, 0xf8, 0x1c, 0xd3, 0x65, 0xba, 0xb3, 0x39, 0x6b, 0x62, 0xa4, 0x66, 0xf7, 0x6c, 0x2c},
+        {0x06, 0x95, 0x12, 0x22, 0xe8, 0xf2, 0xea, 0x24, 0x7c, 0x7d, 0x7e, 0xea, 0x22, 0xd4, 0xbb, 0xd4,
+         0x51, 0x17, 0x89, 0xd0, 0x00, 0x7a, 0xc6, 0x07, 0xe2, 0xb4, 0x29, 0xdc, 0xf5, 0xa0, 0xf1, 0x8b,
+         0x6f, 0x44, 0xc0, 0x9d, 0x0c, 0xcf, 0x25, 0xea, 0x99, 0x15, 0x63, 0xd1, 0x7f, 0xe2, 0x44, 0x09,
+         0x36, 0x29, 0xc0, 0xf1, 0xca, 0x59, 0xb5, 0x89, 0xe1, 0x6e, 0xba, 0xf4, 0x0c, 0xa4, 0x7c, 0xda},
+        {0x05, 0x5f, 0x07, 0x0d, 0x6c, 0x15, 0xfb, 0x0d, 0x96, 0xc0, 0x33, 0xb1, 0x75, 0xf5, 0xe2, 0xc8,
+         0x10, 0xed, 0xe0, 0xfb, 0x19, 0xfb, 0x12, 0x8f, 0x25, 0x10, 0x37, 0xf7, 0xcf, 0x4e, 0x86, 0x1d,
+         0x51, 0x11, 0x44, 0xa0, 0x3a, 0x99, 0xb8, 0x55, 0x99, 0x91, 0xe1, 0xb0, 0x2a, 0xdb, 0x47, 0x6f,
+         0x02, 0x2f, 0x82, 0x39, 0x1b, 0xad, 0x83, 0x78, 0x7c, 0x52, 0xaf, 0x2c, 0x97, 0x47, 0x3e, 0x69},
+        {0x1c, 0x1d, 0x4a, 0xfd, 0xd9, 0x00, 0x04, 0x9d, 0x85, 0x3a, 0x5e, 0x4d, 0xb1, 0xef, 0xa4, 0x12,
+         0x91, 0x5f, 0x38, 0xd4, 0x16, 0x39, 0x36, 0x41, 0xb7, 0xc0, 0x45, 0x55, 0xf7, 0x1f, 0x1c, 0xcc,
+         0x75, 0xb1, 0x53, 0x73, 0x76, 0x96, 0x01, 0x7d, 0xb8, 0x26, 0x88, 0x23, 0x30, 0x59, 0x7e, 0xc2,
+         0x1e, 0x6f, 0x59, 0x8a, 0xd0, 0xfd, 0xc9, 0x3a, 0x7b, 0xc0, 0xc4, 0xcd, 0xc7, 0xe0, 0xeb, 0x8f},
+        {0x53, 0x13, 0x5b, 0x15, 0xe3, 0x8b, 0x5b, 0xc4, 0x70, 0x06, 0xbf, 0x79, 0x28, 0x07, 0x08, 0x19,
+         0x64, 0xf1, 0x0d, 0x3b, 0x96, 0x7c, 0x6e, 0xfa, 0x44, 0x8b, 0x90, 0x8d, 0xcb, 0xc7, 0x16, 0x30,
+         0x1c, 0x90, 0xd3, 0x97, 0x23, 0x4d, 0x85, 0xe9, 0x1f, 0xcb, 0x8f, 0x55, 0xdf, 0x31, 0x24, 0x72,
+         0xf7, 0xcb, 0xb4, 0x66, 0x78, 0x54, 0x7f, 0xdb, 0xfa, 0x6a, 0x43, 0x87, 0xc8, 0x22, 0xeb, 0xfe},
+        {0x1f, 0x5e, 0x67, 0x57, 0x46, 0x86, 0xec, 0xcd, 0xd2, 0xb9, 0x56, 0x2d, 0x9e, 0x27, 0x8c, 0xb9,
+         0x51, 0x3d, 0x90, 0x15, 0xa0, 0xde, 0xef, 0x76, 0x42, 0x52, 0x42, 0x4d, 0x7d, 0x28, 0x17, 0x4c,
+         0x32, 0x09, 0x88, 0xa3, 0x9e, 0x8b, 0x79, 0x5d, 0x2d, 0xe9, 0x23, 0x55, 0xfa, 0x32, 0xea, 0xaa,
+         0x19, 0x8f, 0xc6, 0xb2, 0x0d, 0x86, 0x47, 0x01, 0xc4, 0xb2, 0x00, 0x4a, 0xe0, 0x29, 0x64, 0x77},
+        {0x11, 0xf5, 0x40, 0x17, 0x14, 0x99, 0xd7, 0xd1, 0xdd, 0xad, 0xe0, 0x6b, 0x6b, 0x7b, 0x56, 0x64,
+         0xe1, 0xa0, 0x39, 0x17, 0x29, 0x61, 0x51, 0x3b, 0xee, 0xeb, 0xb3, 0x83, 0x7c, 0xfa, 0xdf, 0x6c,
+         0x41, 0x8b, 0x82, 0x7f, 0xe0, 0x25, 0x16, 0x82, 0xfd, 0x2c, 0x69, 0x01, 0xeb, 0x4b, 0x82, 0xa2,
+         0xee, 0x53, 0xe9, 0x70, 0x09, 0xae, 0x68, 0x8e, 0x8c, 0xbd, 0xa8, 0x1c, 0xa4, 0x94, 0x4b, 0x6e}
+    }
+};
+
+#endif // HW_CRYPTO_TABLES_H
@@ -0,0 +1,96 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "idle.h"
+
+typedef struct idle_item_s
+{
+    idle_work_t work; // 4-bytes
+
+    unsigned char argument[KEY_SIZE]; // 32-bytes
+} idle_item_t;
+
+static idle_item_t L_idle_queue[IDLE_QUEUE_SIZE];
+
+// the oldest step and the number of steps waiting from there on
+static uint8_t L_idle_head = 0;
+
+static uint8_t L_idle_count = 0;
+
+bool idle_post(const idle_work_t work, const unsigned char *argument)
+{
+    if (L_idle_count == IDLE_QUEUE_SIZE)
+    {
+        return false;
+    }
+
+    idle_item_t *item = &L_idle_queue[(L_idle_head + L_idle_count) % IDLE_QUEUE_SIZE];
+
+    item->work = work;
+
+    os_memmove(item->argument, argument, KEY_SIZE);
+
+    L_idle_count++;
+
+    return true;
+}
+
+void idle_tick()
+{
+    if (L_idle_count == 0)
+    {
+        return;
+    }
+
+    // taken off the queue before it runs so that a step that throws is not run again
+    idle_item_t item;
+
+    os_memmove(&item, &L_idle_queue[L_idle_head], sizeof(idle_item_t));
+
+    explicit_bzero(&L_idle_queue[L_idle_head], sizeof(idle_item_t));
+
+    L_idle_head = (L_idle_head + 1) % IDLE_QUEUE_SIZE;
+
+    L_idle_count--;
+
+    BEGIN_TRY
+    {
+        TRY
+        {
+            const idle_work_t work = (idle_work_t)PIC(item.work);
+
+            work(item.argument);
+        }
+        CATCH_OTHER(e)
+        {
+            // the request that needed the work does it instead
+        }
+        FINALLY
+        {
+            explicit_bzero(&item, sizeof(item));
+        }
+    }
+    END_TRY;
+}
+
+void idle_cancel()
+{
+    explicit_bzero(L_idle_queue, sizeof(L_idle_queue));
+
+    L_idle_head = 0;
+
+    L_idle_count = 0;
+}
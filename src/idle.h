@@ -0,0 +1,60 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef IDLE_H
+#define IDLE_H
+
+#include <common.h>
+#include <stdbool.h>
+
+// one ring of the size that the ring point cache is made for, which is what the work warms up
+#ifdef TARGET_NANOX
+#define IDLE_QUEUE_SIZE 12
+#else
+#define IDLE_QUEUE_SIZE RING_PARTICIPANTS
+#endif
+
+/**
+ * A small step of work that does not depend on the next request, it runs between requests
+ * while the app waits on the host. A step has to be small enough to run within a single
+ * ticker event (the SDK gives an app no clock so the limit is in the size of the step) and
+ * only warms up state that the request that needs it would otherwise compute itself, so
+ * work that never runs or is cancelled costs nothing but the time it would have saved
+ * @param argument the argument that the work was posted with
+ * @returns the status of the step, the work is dropped either way
+ */
+typedef uint16_t (*idle_work_t)(const unsigned char *argument);
+
+/**
+ * Queues a step of work to run between requests
+ * @param work the step to run
+ * @param argument its argument, KEY_SIZE bytes that are copied into the queue
+ * @returns whether there was room for the step in the queue
+ */
+bool idle_post(const idle_work_t work, const unsigned char *argument);
+
+/**
+ * Runs the oldest step in the queue, if any. This is called on every ticker event so at
+ * most one step runs per event. Exceptions that the step raises are caught and the step dropped
+ */
+void idle_tick();
+
+/**
+ * Drops every step that has not run yet
+ */
+void idle_cancel();
+
+#endif // IDLE_H
@@ -0,0 +1,293 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "keccak.h"
+
+#define KECCAK_ROUNDS 24
+
+#define ROL32(x, n) (((x) << (n)) | ((x) >> ((32 - (n)) & 31)))
+
+#define EVEN(lane) (2 * (lane))
+#define ODD(lane) (2 * (lane) + 1)
+
+// the round constants of iota, interleaved as the lanes are
+static const uint32_t C_keccak_round_constants[KECCAK_ROUNDS][2] = {
+    {0x00000001, 0x00000000}, {0x00000000, 0x00000089}, {0x00000000, 0x8000008b}, {0x00000000, 0x80008080},
+    {0x00000001, 0x0000008b}, {0x00000001, 0x00008000}, {0x00000001, 0x80008088}, {0x00000001, 0x80000082},
+    {0x00000000, 0x0000000b}, {0x00000000, 0x0000000a}, {0x00000001, 0x00008082}, {0x00000000, 0x00008003},
+    {0x00000001, 0x0000808b}, {0x00000001, 0x8000000b}, {0x00000001, 0x8000008a}, {0x00000001, 0x80000081},
+    {0x00000000, 0x80000081}, {0x00000000, 0x80000008}, {0x00000000, 0x00000083}, {0x00000000, 0x80008003},
+    {0x00000001, 0x80008088}, {0x00000000, 0x80000088}, {0x00000001, 0x00008000}, {0x00000000, 0x80008082}};
+
+// rho and pi as a single walk: the lane that is visited next and the rotation of the lane carried into it
+static const uint8_t C_keccak_pi_lanes[KECCAK_LANES - 1] = {10, 7,  11, 17, 18, 3, 5,  16, 8,  21, 24, 4,
+                                                           15, 23, 19, 13, 12, 2, 20, 14, 22, 9,  6,  1};
+
+static const uint8_t C_keccak_rho_rotations[KECCAK_LANES - 1] = {1,  3,  6,  10, 15, 21, 28, 36, 45, 55, 2,  14,
+                                                                27, 41, 56, 8,  25, 43, 62, 18, 39, 61, 20, 44};
+
+/**
+ * Rotates an interleaved lane left by n bits, the even and odd words swap when n is odd
+ * @param out the resulting lane (even || odd)
+ * @param even the even bits of the lane
+ * @param odd the odd bits of the lane
+ * @param n the rotation
+ */
+static void keccak_rotate(uint32_t *out, const uint32_t even, const uint32_t odd, const unsigned int n)
+{
+    if (n % 2 == 0)
+    {
+        out[0] = ROL32(even, n / 2);
+
+        out[1] = ROL32(odd, n / 2);
+    }
+    else
+    {
+        out[0] = ROL32(odd, (n + 1) / 2);
+
+        out[1] = ROL32(even, (n - 1) / 2);
+    }
+}
+
+static void keccak_permute(uint32_t *lanes)
+{
+    uint32_t c[2 * 5], d[2], carry[2], t[2];
+
+    for (unsigned int round = 0; round < KECCAK_ROUNDS; round++)
+    {
+        // theta
+        for (unsigned int x = 0; x < 5; x++)
+        {
+            c[EVEN(x)] = lanes[EVEN(x)] ^ lanes[EVEN(x + 5)] ^ lanes[EVEN(x + 10)] ^ lanes[EVEN(x + 15)]
+                         ^ lanes[EVEN(x + 20)];
+
+            c[ODD(x)] = lanes[ODD(x)] ^ lanes[ODD(x + 5)] ^ lanes[ODD(x + 10)] ^ lanes[ODD(x + 15)]
+                        ^ lanes[ODD(x + 20)];
+        }
+
+        for (unsigned int x = 0; x < 5; x++)
+        {
+            const unsigned int next = (x + 1) % 5;
+
+            const unsigned int previous = (x + 4) % 5;
+
+            // C[x - 1] ^ ROL(C[x + 1], 1)
+            d[0] = c[EVEN(previous)] ^ ROL32(c[ODD(next)], 1);
+
+            d[1] = c[ODD(previous)] ^ c[EVEN(next)];
+
+            for (unsigned int y = 0; y < KECCAK_LANES; y += 5)
+            {
+                lanes[EVEN(x + y)] ^= d[0];
+
+                lanes[ODD(x + y)] ^= d[1];
+            }
+        }
+
+        // rho and pi
+        carry[0] = lanes[EVEN(1)];
+
+        carry[1] = lanes[ODD(1)];
+
+        for (unsigned int i = 0; i < KECCAK_LANES - 1; i++)
+        {
+            const unsigned int lane = C_keccak_pi_lanes[i];
+
+            t[0] = lanes[EVEN(lane)];
+
+            t[1] = lanes[ODD(lane)];
+
+            keccak_rotate(&lanes[EVEN(lane)], carry[0], carry[1], C_keccak_rho_rotations[i]);
+
+            carry[0] = t[0];
+
+            carry[1] = t[1];
+        }
+
+        // chi
+        for (unsigned int y = 0; y < KECCAK_LANES; y += 5)
+        {
+            for (unsigned int x = 0; x < 5; x++)
+            {
+                c[EVEN(x)] = lanes[EVEN(x + y)];
+
+                c[ODD(x)] = lanes[ODD(x + y)];
+            }
+
+            for (unsigned int x = 0; x < 5; x++)
+            {
+                lanes[EVEN(x + y)] ^= (~c[EVEN((x + 1) % 5)]) & c[EVEN((x + 2) % 5)];
+
+                lanes[ODD(x + y)] ^= (~c[ODD((x + 1) % 5)]) & c[ODD((x + 2) % 5)];
+            }
+        }
+
+        // iota
+        lanes[EVEN(0)] ^= C_keccak_round_constants[round][0];
+
+        lanes[ODD(0)] ^= C_keccak_round_constants[round][1];
+    }
+}
+
+/**
+ * Moves the even bits of a word into its low half and the odd bits into its high half
+ */
+static uint32_t keccak_unshuffle(uint32_t x)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 1)) & 0x22222222;
+    x = x ^ t ^ (t << 1);
+
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C;
+    x = x ^ t ^ (t << 2);
+
+    t = (x ^ (x >> 4)) & 0x00F000F0;
+    x = x ^ t ^ (t << 4);
+
+    t = (x ^ (x >> 8)) & 0x0000FF00;
+    x = x ^ t ^ (t << 8);
+
+    return x;
+}
+
+/**
+ * The inverse of keccak_unshuffle
+ */
+static uint32_t keccak_shuffle(uint32_t x)
+{
+    uint32_t t;
+
+    t = (x ^ (x >> 8)) & 0x0000FF00;
+    x = x ^ t ^ (t << 8);
+
+    t = (x ^ (x >> 4)) & 0x00F000F0;
+    x = x ^ t ^ (t << 4);
+
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C;
+    x = x ^ t ^ (t << 2);
+
+    t = (x ^ (x >> 1)) & 0x22222222;
+    x = x ^ t ^ (t << 1);
+
+    return x;
+}
+
+// the even bits of a byte packed into a nibble
+static uint32_t keccak_even_nibble(uint32_t x)
+{
+    x &= 0x55;
+
+    x = (x | (x >> 1)) & 0x33;
+
+    return (x | (x >> 2)) & 0x0F;
+}
+
+static uint32_t keccak_read32(const unsigned char *in)
+{
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+// a whole lane of the message, as little endian bytes
+static void keccak_absorb_lane(uint32_t *lane, const unsigned char *in)
+{
+    const uint32_t low = keccak_unshuffle(keccak_read32(in));
+
+    const uint32_t high = keccak_unshuffle(keccak_read32(in + 4));
+
+    lane[0] ^= (low & 0x0000FFFF) | (high << 16);
+
+    lane[1] ^= (low >> 16) | (high & 0xFFFF0000);
+}
+
+// a single byte of the message, byte k of a lane holds its bits 4k to 4k + 3 of each word
+static void keccak_absorb_byte(uint32_t *lanes, const uint8_t offset, const uint8_t byte)
+{
+    const unsigned int shift = 4 * (offset % 8);
+
+    lanes[EVEN(offset / 8)] ^= keccak_even_nibble(byte) << shift;
+
+    lanes[ODD(offset / 8)] ^= keccak_even_nibble(byte >> 1) << shift;
+}
+
+void keccak_init(keccak_t *context, const unsigned int bits)
+{
+    explicit_bzero(context->lanes, sizeof(context->lanes));
+
+    context->rate = KECCAK_STATE_SIZE - (2 * (bits / 8));
+
+    context->offset = 0;
+}
+
+void keccak_update(keccak_t *context, const unsigned char *in, size_t length)
+{
+    while (length > 0)
+    {
+        if (context->offset % 8 == 0 && length >= 8)
+        {
+            keccak_absorb_lane(&context->lanes[EVEN(context->offset / 8)], in);
+
+            context->offset += 8;
+
+            in += 8;
+
+            length -= 8;
+        }
+        else
+        {
+            keccak_absorb_byte(context->lanes, context->offset, *in);
+
+            context->offset++;
+
+            in++;
+
+            length--;
+        }
+
+        if (context->offset == context->rate)
+        {
+            keccak_permute(context->lanes);
+
+            context->offset = 0;
+        }
+    }
+}
+
+void keccak_final(keccak_t *context, unsigned char *out, const size_t size)
+{
+    keccak_absorb_byte(context->lanes, context->offset, 0x01);
+
+    keccak_absorb_byte(context->lanes, context->rate - 1, 0x80);
+
+    keccak_permute(context->lanes);
+
+    for (size_t i = 0; i < size; i += 8)
+    {
+        const uint32_t even = context->lanes[EVEN(i / 8)];
+
+        const uint32_t odd = context->lanes[ODD(i / 8)];
+
+        const uint32_t words[2] = {keccak_shuffle((even & 0x0000FFFF) | (odd << 16)),
+                                   keccak_shuffle((even >> 16) | (odd & 0xFFFF0000))};
+
+        for (size_t j = 0; j < 8 && i + j < size; j++)
+        {
+            out[i + j] = (unsigned char)(words[j / 4] >> (8 * (j % 4)));
+        }
+    }
+
+    explicit_bzero(context, sizeof(keccak_t));
+}
\ No newline at end of file
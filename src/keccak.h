@@ -0,0 +1,64 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef KECCAK_H
+#define KECCAK_H
+
+#include <common.h>
+
+#define KECCAK_LANES 25
+#define KECCAK_STATE_SIZE 200 // bytes
+
+/**
+ * Keccak with the original padding (that of cn_fast_hash, not that of SHA-3) computed by the app
+ * itself instead of by cx_keccak_init and cx_hash, so that a hash costs no syscalls. Every 64-bit
+ * lane of the state is kept as two 32-bit words, one of its even bits and one of its odd bits
+ * (bit interleaving), which turns every rotation of Keccak-f[1600] into two 32-bit rotations on
+ * the 32-bit cores of the devices. It is only used when built with KECCAK_IN_APP=1 (see hw_keccak_t)
+ */
+typedef struct keccak_s
+{
+    uint32_t lanes[2 * KECCAK_LANES]; // 200-bytes, the even then the odd bits of every lane
+
+    uint8_t rate; // 1-byte, the bytes absorbed per permutation
+
+    uint8_t offset; // 1-byte, where the next byte is absorbed
+} keccak_t;
+
+/**
+ * Starts a hash
+ * @param context the hash
+ * @param bits the size of the digest, which sets the rate
+ */
+void keccak_init(keccak_t *context, const unsigned int bits);
+
+/**
+ * Absorbs more of the message
+ * @param context the hash
+ * @param in the message
+ * @param length the length of the message
+ */
+void keccak_update(keccak_t *context, const unsigned char *in, size_t length);
+
+/**
+ * Pads the message and squeezes the digest out, the context has to be started again after
+ * @param context the hash
+ * @param out the digest
+ * @param size the size of the digest, no more than the rate
+ */
+void keccak_final(keccak_t *context, unsigned char *out, const size_t size);
+
+#endif // KECCAK_H
\ No newline at end of file
@@ -16,6 +16,9 @@
 
 #include "keys.h"
 
+#include <cache.h>
+#include <nvram.h>
+
 static const unsigned char W_MAGIC[KEY_SIZE] = {0x54, 0x75, 0x72, 0x74, 0x6c, 0x65, 0x43, 0x6f, 0x69, 0x6e, 0x20,
                                                 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x4d, 0x6f,
                                                 0x6e, 0x65, 0x72, 0x6f, 0x20, 0x66, 0x6f, 0x72, 0x6b, 0x21};
@@ -23,11 +26,40 @@ static const unsigned char W_MAGIC[KEY_SIZE] = {0x54, 0x75, 0x72, 0x74, 0x6c, 0x
 static const uint8_t prefix[4] = {157, 246, 238, 1};
 
 #ifdef TARGET_NANOX
-const wallet_t N_state_pic;
+const wallet_t N_state_pic[ACCOUNT_SLOTS];
 #else
-wallet_t N_state_pic;
+wallet_t N_state_pic[ACCOUNT_SLOTS];
 #endif
 
+// the account whose keys are in use, the first one until another is selected
+static uint8_t L_account = 0;
+
+uint8_t selected_account()
+{
+    return L_account;
+}
+
+uint16_t select_account(const uint8_t account)
+{
+    if (account >= ACCOUNT_SLOTS)
+    {
+        return ERR_OUT_OF_RANGE;
+    }
+
+    const uint8_t previous = L_account;
+
+    L_account = account;
+
+    const uint16_t status = init_keys();
+
+    if (status != OP_OK)
+    {
+        L_account = previous;
+    }
+
+    return status;
+}
+
 uint16_t reset_keys()
 {
     BEGIN_TRY
@@ -36,8 +68,13 @@ uint16_t reset_keys()
         {
             PRINTF("Resetting keys...\n");
 
-            // Zero out the wallet structure in NVRAM
-            nvm_write((void *)N_turtlecoin_wallet, NULL, sizeof(wallet_t));
+            // Zero out the wallet structures of every account in NVRAM
+            nvram_write((void *)PIC(N_state_pic), NULL, sizeof(N_state_pic));
+
+            // Drop anything that was cached for the old keys
+            cache_reset();
+
+            cache_key_image_reset();
 
             // Then reinitialize the keys
             uint16_t status = init_keys();
@@ -65,9 +102,9 @@ uint16_t init_keys()
     /**
      * Check to see if our wallet information already exists in the secure NVRAM
      * of the ledger hardware device, if not, then we need to initialize the
-     * wallet This limits writes to NVRAM to on first boot OR on key reset only 7
-     * writes to NVRAM each time it is used: wipe, private spend, public spend,
-     * private view, public view, address, magic
+     * wallet This limits writes to NVRAM to on first boot OR on key reset only 2
+     * writes to NVRAM each time it is used: wipe, then the whole wallet (keys,
+     * address, curve constants and magic)
      */
     if (os_memcmp((void *)N_turtlecoin_wallet->magic, (void *)W_MAGIC, sizeof(W_MAGIC)) != 0)
     {
@@ -78,10 +115,10 @@ uint16_t init_keys()
             TRY
             {
                 // Zero out enough space in NVRAM for the size of our wallet structure
-                nvm_write((void *)N_turtlecoin_wallet, NULL, sizeof(wallet_t));
+                nvram_write((void *)N_turtlecoin_wallet, NULL, sizeof(wallet_t));
 
                 // Retrieve the private spend key for which all things are made
-                if (hw_retrieve_private_spend_key(wallet.spend.private) != 0)
+                if (hw_retrieve_private_spend_key(wallet.spend.private, L_account) != 0)
                 {
                     THROW(ERR_PRIVATE_SPEND);
                 }
@@ -104,6 +141,22 @@ uint16_t init_keys()
                     THROW(ERR_SECKEY_TO_PUBKEY);
                 }
 
+                // Encode the wallet address so that it does not have to be encoded for every request
+                const uint16_t status =
+                    generate_public_address(wallet.spend.public, wallet.view.public, wallet.address);
+
+                if (status != OP_OK)
+                {
+                    THROW(status);
+                }
+
+                // Precompute B as a point and 8 * a so that no output has to redo them
+                if (hw_wallet_constants(wallet.spend_point, wallet.view8, wallet.spend.public, wallet.view.private)
+                    != OP_OK)
+                {
+                    THROW(ERR_GE_FROMBYTES_VARTIME);
+                }
+
                 /**
                  * Write the magic bytes to the structure in RAM so that upon
                  * the next application load we do not have to perform these
@@ -112,7 +165,7 @@ uint16_t init_keys()
                 os_memmove(wallet.magic, W_MAGIC, sizeof(W_MAGIC));
 
                 // write the wallet structure to NVRAM
-                nvm_write((void *)N_turtlecoin_wallet, (void *)&wallet, sizeof(wallet_t));
+                nvram_write((void *)N_turtlecoin_wallet, (void *)&wallet, sizeof(wallet_t));
 
                 CLOSE_TRY;
 
@@ -34,24 +34,48 @@ typedef struct wallet_s
 
     key_pair_t view; // 64-bytes
 
+    unsigned char address[BASE58_ADDRESS_SIZE]; // 99-bytes, encoded once as it only changes with the keys
+
+    unsigned char spend_point[SIG_STR_SIZE]; // 65-bytes, B decompressed for deriving output keys
+
+    unsigned char view8[SCALAR8_LOADED_SIZE]; // 33 or 90-bytes, 8 * a loaded for key derivations (see hw_sc_load8)
+
     unsigned char magic[KEY_SIZE]; // 32-bytes
 } wallet_t;
 
+#define ACCOUNT_SLOTS 4 // accounts whose keys are kept in NVRAM, each is only derived once
+
+// the wallet of the selected account (see select_account)
 #ifdef TARGET_NANOX
-extern const wallet_t N_state_pic;
-#define N_turtlecoin_wallet ((volatile wallet_t *)PIC(&N_state_pic))
+extern const wallet_t N_state_pic[ACCOUNT_SLOTS];
+#define N_turtlecoin_wallet ((volatile wallet_t *)PIC(&N_state_pic[selected_account()]))
 #else
-extern wallet_t N_state_pic;
-#define N_turtlecoin_wallet ((WIDE wallet_t *)PIC(&N_state_pic))
+extern wallet_t N_state_pic[ACCOUNT_SLOTS];
+#define N_turtlecoin_wallet ((WIDE wallet_t *)PIC(&N_state_pic[selected_account()]))
 #endif
 
 #define PTR_SPEND_PUBLIC ((unsigned char *)N_turtlecoin_wallet->spend.public)
 #define PTR_SPEND_PRIVATE ((unsigned char *)N_turtlecoin_wallet->spend.private)
 #define PTR_VIEW_PUBLIC ((unsigned char *)N_turtlecoin_wallet->view.public)
 #define PTR_VIEW_PRIVATE ((unsigned char *)N_turtlecoin_wallet->view.private)
+#define PTR_SPEND_POINT ((unsigned char *)N_turtlecoin_wallet->spend_point)
+#define PTR_VIEW_PRIVATE8 ((unsigned char *)N_turtlecoin_wallet->view8)
 
+/**
+ * Makes sure that the keys of the selected account are in NVRAM, deriving them on first use
+ */
 uint16_t init_keys();
 
+/**
+ * Switches the keys that every command uses to those of another account, the keys of an account
+ * are derived the first time that it is selected and are read from NVRAM from then on
+ * @param account the BIP-32 account (less than ACCOUNT_SLOTS)
+ * @returns OP_OK or the error
+ */
+uint16_t select_account(const uint8_t account);
+
+uint8_t selected_account();
+
 uint16_t reset_keys();
 
 uint16_t
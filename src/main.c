@@ -17,7 +17,12 @@
  ********************************************************************************/
 
 #include "apdu.h"
+#include "arena.h"
+#include "idle.h"
 #include "menu.h"
+#include "profile.h"
+#include "session.h"
+#include "transaction.h"
 
 unsigned char G_io_seproxyhal_spi_buffer[IO_SEPROXYHAL_BUFFER_SIZE_B];
 
@@ -28,269 +33,297 @@ unsigned char G_io_seproxyhal_spi_buffer[IO_SEPROXYHAL_BUFFER_SIZE_B];
 #define OFFSET_P1 2
 #define OFFSET_P2 3
 #define OFFSET_LC 4
-#define OFFSET_CDATA 6
 
-void handleApdu(volatile unsigned int *flags, volatile unsigned int *tx)
+// the fragments of a chained request are put together in the working memory
+static uint16_t L_chain_length = 0;
+
+static uint8_t L_chain_ins = 0;
+
+/**
+ * Puts the fragments of a chained request back together
+ * @param data_length the length of the data of the request, that of the whole payload once done
+ * @param tx where the response to a fragment goes
+ * @returns whether there is a whole command to handle
+ */
+static bool chain_request(uint16_t *data_length, volatile unsigned int *tx)
 {
-    unsigned short sw = 0;
+    const uint8_t ins = G_io_apdu_buffer[OFFSET_INS];
 
-    BEGIN_TRY
+    // a fragment always carries data, P1_MORE without any is a P1 of the command itself
+    const bool more = (G_io_apdu_buffer[OFFSET_P1] & P1_MORE) != 0 && *data_length != 0;
+
+    chain_responses(false);
+
+    if (L_chain_length == 0 && !more)
     {
-        TRY
-        {
-            // Explicitly clear the working memory
-            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+        return true;
+    }
 
-            // Explicitly clear any display information
-            explicit_bzero(DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
+    if ((L_chain_length != 0 && ins != L_chain_ins) || *data_length > CHAIN_MAX_SIZE - L_chain_length)
+    {
+        L_chain_length = 0;
 
-            if (G_io_apdu_buffer[OFFSET_CLA] != CLA)
-            {
-                THROW(0x6E00);
-            }
+        explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
 
-            uint16_t data_length = data_length = readUint16BE((uint8_t *)&G_io_apdu_buffer[OFFSET_LC]);
+        sendError(ERR_APDU_CHAIN);
 
-            switch (G_io_apdu_buffer[OFFSET_INS])
-            {
-                case APDU_VERSION:
-                    handle_version();
-                    break;
+        return false;
+    }
 
-                case APDU_DEBUG:
-                    handle_debug();
-                    break;
+    L_chain_ins = ins;
 
-                case APDU_IDENT:
-                    handle_ident();
-                    break;
+    os_memmove(WORKING_SET + L_chain_length, G_io_apdu_buffer + OFFSET_CDATA, *data_length);
 
-                case APDU_PUBLIC_KEYS:
-                    handle_public_keys(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+    L_chain_length += *data_length;
 
-                case APDU_VIEW_SECRET_KEY:
-                    handle_view_secret_key(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+    if (more)
+    {
+        G_io_apdu_buffer[0] = 0x90;
 
-                case APDU_SPEND_SECRET_KEY:
-                    handle_spend_secret_key(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+        G_io_apdu_buffer[1] = 0x00;
 
-                case APDU_VIEW_WALLET_KEYS:
-                    handle_view_wallet_keys(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+        *tx = 2;
 
-                case APDU_PRIVATE_TO_PUBLIC:
-                    handle_private_to_public(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+        return false;
+    }
 
-                case APDU_RANDOM_KEY_PAIR:
-                    handle_generate_random_key_pair(flags);
-                    break;
+    // the command sees the payload as if it had arrived in one piece
+    os_memmove(G_io_apdu_buffer + OFFSET_CDATA, WORKING_SET, L_chain_length);
 
-                case APDU_CHECK_KEY:
-                    handle_check_key(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+    uint16ToChar(G_io_apdu_buffer + OFFSET_LC, L_chain_length);
 
-                case APDU_CHECK_SCALAR:
-                    handle_check_scalar(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+    *data_length = L_chain_length;
 
-                case APDU_ADDRESS:
-                    handle_address(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+    L_chain_length = 0;
 
-                case APDU_GENERATE_KEYIMAGE:
-                    handle_generate_keyimage(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+    chain_responses(true);
 
-                case APDU_GENERATE_KEYIMAGE_PRIMITIVE:
-                    handle_generate_keyimage_primitive(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+    return true;
+}
 
-                case APDU_GENERATE_RING_SIGNATURES:
-                    handle_generate_ring_signatures(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+// commands that are not in here are answered with 0x6D00
+static const apdu_command_t C_apdu_commands[] = {
+    {APDU_VERSION, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_version},
+    {APDU_DEBUG, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_debug},
+    {APDU_IDENT, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_ident},
+    {APDU_NVRAM_STATS, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_nvram_stats},
+    {APDU_RESOURCES, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_resources},
+    {APDU_CAPABILITIES, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_capabilities},
+    {APDU_PUBLIC_KEYS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_public_keys},
+    {APDU_VIEW_SECRET_KEY, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_view_secret_key},
+    {APDU_SPEND_SECRET_KEY, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_spend_secret_key},
+    {APDU_VIEW_WALLET_KEYS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_view_wallet_keys},
+    {APDU_SELECT_ACCOUNT, APDU_IN_STATE(TX_UNUSED), APDU_SELECT_ACCOUNT_SIZE, APDU_POLICY_NONE, handle_select_account},
+    {APDU_PRIVATE_TO_PUBLIC, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_private_to_public},
+    {APDU_RANDOM_KEY_PAIR,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_generate_random_key_pair},
+    {APDU_CHECK_KEY, APDU_IN_STATE(TX_UNUSED), KEY_SIZE, APDU_POLICY_NONE, handle_check_key},
+    {APDU_CHECK_SCALAR, APDU_IN_STATE(TX_UNUSED), KEY_SIZE, APDU_POLICY_NONE, handle_check_scalar},
+    {APDU_CHECK_KEYS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_check_keys},
+    {APDU_ADDRESS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_address},
+    {APDU_GENERATE_KEYIMAGE, APDU_IN_STATE(TX_UNUSED), APDU_GKI_SIZE, APDU_POLICY_NONE, handle_generate_keyimage},
+    {APDU_GENERATE_KEYIMAGE_PRIMITIVE,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_GKIP_SIZE,
+     APDU_POLICY_NONE,
+     handle_generate_keyimage_primitive},
+    {APDU_GENERATE_KEYIMAGES, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_generate_keyimages},
+    {APDU_GENERATE_RING_SIGNATURES,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_GRS_SIZE,
+     APDU_POLICY_CONFIRM,
+     handle_generate_ring_signatures},
+    {APDU_COMPLETE_RING_SIGUATURE,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_CRS_SIZE,
+     APDU_POLICY_CONFIRM,
+     handle_complete_ring_signature},
+    {APDU_CHECK_RING_SIGNATURES,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_CHRS_SIZE,
+     APDU_POLICY_NONE,
+     handle_check_ring_signatures},
+    {APDU_GENERATE_SIGNATURE, APDU_IN_STATE(TX_UNUSED), APDU_GS_SIZE, APDU_POLICY_CONFIRM, handle_generate_signature},
+    {APDU_CHECK_SIGNATURE, APDU_IN_STATE(TX_UNUSED), APDU_CS_SIZE, APDU_POLICY_NONE, handle_check_signature},
+    {APDU_GENERATE_SIGNATURES,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_CONFIRM,
+     handle_generate_signatures},
+    {APDU_CHECK_SIGNATURES, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_check_signatures},
+    {APDU_APPROVE_SESSION, APDU_ANY_STATE, APDU_APPROVE_SESSION_SIZE, APDU_POLICY_CONFIRM, handle_approve_session},
+    {APDU_CHECK_TX_RING_SIGNATURES,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_check_tx_ring_signatures},
+    {APDU_GENERATE_TX_RING_SIGNATURES,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_generate_tx_ring_signatures},
+    {APDU_GENERATE_KEY_DERIVATION,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_GKD_SIZE,
+     APDU_POLICY_NONE,
+     handle_generate_key_derivation},
+    {APDU_DERIVE_PUBLIC_KEY, APDU_IN_STATE(TX_UNUSED), APDU_DPK_SIZE, APDU_POLICY_NONE, handle_derive_public_key},
+    {APDU_DERIVE_SECRET_KEY, APDU_IN_STATE(TX_UNUSED), APDU_DSK_SIZE, APDU_POLICY_CONFIRM, handle_derive_secret_key},
+    {APDU_SCAN_OUTPUTS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_scan_outputs},
+    {APDU_GENERATE_KEY_DERIVATIONS,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_generate_key_derivations},
+    {APDU_CHECK_INPUTS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_check_inputs},
+    {APDU_TX_STATE, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_state},
+    {APDU_TX_START,
+     APDU_IN_STATE(TX_UNUSED) | APDU_IN_STATE(TX_COMPLETE),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_start},
+    {APDU_TX_START_INPUT_LOAD, APDU_IN_STATE(TX_READY), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_start_input_load},
+    {APDU_TX_LOAD_INPUT,
+     APDU_IN_STATE(TX_READY) | APDU_IN_STATE(TX_RECEIVING_INPUTS),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_input_load},
+    {APDU_TX_START_OUTPUT_LOAD,
+     APDU_IN_STATE(TX_INPUTS_RECEIVED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_start_output_load},
+    {APDU_TX_LOAD_OUTPUT,
+     APDU_IN_STATE(TX_INPUTS_RECEIVED) | APDU_IN_STATE(TX_RECEIVING_OUTPUTS),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_output_load},
+    {APDU_TX_FINALIZE_PREFIX,
+     APDU_IN_STATE(TX_OUTPUTS_RECEIVED),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_finalize_prefix},
+    {APDU_TX_SIGN, APDU_IN_STATE(TX_PREFIX_READY), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_tx_sign},
+    {APDU_TX_DUMP, APDU_IN_STATE(TX_COMPLETE), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_dump},
+    {APDU_TX_RESET, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_reset},
+    {APDU_TX_SIGN_INPUT, APDU_IN_STATE(TX_SIGNING), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_sign_input},
+    {APDU_TX_RESUME, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_resume},
+    {APDU_TX_SELECT_SLOT, APDU_ANY_STATE, APDU_ANY_LENGTH, APDU_POLICY_NONE, handle_tx_select_slot},
+    {APDU_TX_LOAD_PREFIX,
+     APDU_IN_STATE(TX_READY) | APDU_IN_STATE(TX_RECEIVING_INPUTS) | APDU_IN_STATE(TX_INPUTS_RECEIVED)
+         | APDU_IN_STATE(TX_RECEIVING_OUTPUTS),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_load_prefix},
+    {APDU_TX_APPROVE_BATCH,
+     APDU_IN_STATE(TX_UNUSED),
+     APDU_TX_APPROVE_BATCH_SIZE,
+     APDU_POLICY_CONFIRM,
+     handle_tx_approve_batch},
+    {APDU_TX_PREFLIGHT, APDU_ANY_STATE, APDU_TX_PREFLIGHT_SIZE, APDU_POLICY_NONE, handle_tx_preflight},
+    {APDU_TX_RELOAD_OUTPUTS,
+     APDU_IN_STATE(TX_INPUTS_RECEIVED) | APDU_IN_STATE(TX_RECEIVING_OUTPUTS) | APDU_IN_STATE(TX_OUTPUTS_RECEIVED)
+         | APDU_IN_STATE(TX_PREFIX_READY),
+     APDU_ANY_LENGTH,
+     APDU_POLICY_NONE,
+     handle_tx_reload_outputs},
+    {APDU_RESET_KEYS, APDU_IN_STATE(TX_UNUSED), APDU_ANY_LENGTH, APDU_POLICY_CONFIRM, handle_reset},
+};
+
+/**
+ * Checks a request against its entry in C_apdu_commands before its handler sees it
+ * @param data_length the length of the data of the request
+ */
+static void dispatch(const uint16_t data_length, volatile unsigned int *flags, volatile unsigned int *tx)
+{
+    const uint8_t p1 = G_io_apdu_buffer[OFFSET_P1];
 
-                case APDU_COMPLETE_RING_SIGUATURE:
-                    handle_complete_ring_signature(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+    size_t i;
 
-                case APDU_CHECK_RING_SIGNATURES:
-                    handle_check_ring_signatures(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+    for (i = 0; i < sizeof(C_apdu_commands) / sizeof(apdu_command_t); i++)
+    {
+        const apdu_command_t *command = (const apdu_command_t *)PIC(&C_apdu_commands[i]);
 
-                case APDU_GENERATE_SIGNATURE:
-                    handle_generate_signature(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+        if (command->ins != G_io_apdu_buffer[OFFSET_INS])
+        {
+            continue;
+        }
 
-                case APDU_CHECK_SIGNATURE:
-                    handle_check_signature(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+        if ((command->states & APDU_IN_STATE(tx_state())) == 0)
+        {
+            return sendError(ERR_TRANSACTION_STATE);
+        }
+        else if (command->length != APDU_ANY_LENGTH && data_length != command->length)
+        {
+            return sendError(ERR_WRONG_INPUT_LENGTH);
+        }
+        else if (
+            command->policy == APDU_POLICY_CONFIRM && p1 != P1_CONFIRM && !(p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1))
+        {
+            return sendError(ERR_OP_USER_REQUIRED);
+        }
 
-                case APDU_GENERATE_KEY_DERIVATION:
-                    handle_generate_key_derivation(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+        profile_command(command->ins);
 
-                case APDU_DERIVE_PUBLIC_KEY:
-                    handle_derive_public_key(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+        const apdu_handler_t handler = (apdu_handler_t)PIC(command->handler);
 
-                case APDU_DERIVE_SECRET_KEY:
-                    handle_derive_secret_key(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+        return handler(p1, G_io_apdu_buffer[OFFSET_P2], APDU_DATA, data_length, flags, tx);
+    }
 
-                case APDU_TX_STATE:
-                    handle_tx_state();
-                    break;
+    THROW(0x6D00);
+}
 
-                case APDU_TX_START:
-                    handle_tx_start(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+void handleApdu(volatile unsigned int *flags, volatile unsigned int *tx)
+{
+    unsigned short sw = 0;
 
-                case APDU_TX_START_INPUT_LOAD:
-                    handle_tx_start_input_load(flags);
-                    break;
+    BEGIN_TRY
+    {
+        TRY
+        {
+            if (G_io_apdu_buffer[OFFSET_CLA] != CLA)
+            {
+                THROW(0x6E00);
+            }
 
-                case APDU_TX_LOAD_INPUT:
-                    handle_tx_input_load(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+            // a transaction signed ahead of its approval holds the working set until the review ends
+            if (tx_speculating())
+            {
+                sendError(ERR_TRANSACTION_STATE);
 
-                case APDU_TX_START_OUTPUT_LOAD:
-                    handle_tx_start_output_load(flags);
-                    break;
+                CLOSE_TRY;
 
-                case APDU_TX_LOAD_OUTPUT:
-                    handle_tx_output_load(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+                return;
+            }
 
-                case APDU_TX_FINALIZE_PREFIX:
-                    handle_tx_finalize_prefix(flags);
-                    break;
+            uint16_t data_length = data_length = readUint16BE((uint8_t *)&G_io_apdu_buffer[OFFSET_LC]);
 
-                case APDU_TX_SIGN:
-                    handle_tx_sign(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+            if (G_io_apdu_buffer[OFFSET_INS] == APDU_GET_RESPONSE)
+            {
+                *tx = next_response_chunk();
 
-                case APDU_TX_DUMP:
-                    handle_tx_dump(
-                        G_io_apdu_buffer[OFFSET_P1],
-                        G_io_apdu_buffer[OFFSET_P2],
-                        G_io_apdu_buffer + OFFSET_CDATA,
-                        data_length,
-                        flags,
-                        tx);
-                    break;
+                CLOSE_TRY;
 
-                case APDU_TX_RESET:
-                    handle_tx_reset(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+                return;
+            }
 
-                case APDU_RESET_KEYS:
-                    handle_reset(G_io_apdu_buffer[OFFSET_P1], G_io_apdu_buffer[OFFSET_P2], flags, tx);
-                    break;
+            if (!chain_request(&data_length, tx))
+            {
+                CLOSE_TRY;
 
-                default:
-                    THROW(0x6D00);
-                    break;
+                return;
             }
+
+            // Explicitly clear the working memory and hand all of it back to the arena
+            arena_reset();
+
+            // Explicitly clear any display information
+            explicit_bzero(DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
+
+            dispatch(data_length, flags, tx);
         }
         CATCH(EXCEPTION_IO_RESET)
         {
@@ -444,6 +477,10 @@ unsigned char io_event(unsigned char channel)
             break;
 
         case SEPROXYHAL_TAG_TICKER_EVENT:
+            session_tick();
+
+            idle_tick();
+
             UX_TICKER_EVENT(G_io_seproxyhal_spi_buffer, {
 #ifndef TARGET_NANOX
                 if (UX_ALLOWED)
@@ -526,6 +563,9 @@ __attribute__((section(".boot"))) int main(void)
     // ensure exception will work as planned
     os_boot();
 
+    // mark the stack so that its high-water mark can be read back in debug builds
+    debug_stack_paint();
+
     // Explicitly clear the working memory
     explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
 
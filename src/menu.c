@@ -60,6 +60,11 @@ UX_STEP_SPLASH(ux_boot_splash_step_1, pnn, init_boot(), {&C_icon_turtlecoin, "Sa
 
 UX_FLOW(ux_boot_splash_flow, &ux_boot_splash_step_1);
 
+// either button takes the busy screen down, the next command that has something to show does as well
+UX_STEP_CB(ux_busy_flow_1_step, pnn, ui_idle(), {&C_icon_turtlecoin, "Working", "Please Wait..."});
+
+UX_FLOW(ux_busy_flow, &ux_busy_flow_1_step);
+
 void ui_idle()
 {
     // reserve a display stack slot if none yet
@@ -71,6 +76,16 @@ void ui_idle()
     ux_flow_init(0, ux_idle_flow, NULL);
 }
 
+void ui_busy()
+{
+    if (G_ux.stack_count == 0)
+    {
+        ux_stack_push();
+    }
+
+    ux_flow_init(0, ux_busy_flow, NULL);
+}
+
 void ui_splash()
 {
     if (G_ux.stack_count == 0)
@@ -22,6 +22,8 @@
 #include <keys.h>
 #include <utils.h>
 
+void ui_busy();
+
 void ui_idle();
 
 void ui_splash();
@@ -0,0 +1,106 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "nvram.h"
+
+#include <profile.h>
+#include <utils.h>
+
+// the lifetime totals, zero when the app is installed
+#ifdef TARGET_NANOX
+const nvram_stats_t N_state_wear_pic;
+#else
+nvram_stats_t N_state_wear_pic;
+#endif
+
+#define N_wear ((volatile nvram_stats_t *)PIC(&N_state_wear_pic))
+
+// since tx_start, since the app started and since the lifetime totals were last folded
+static nvram_stats_t L_transaction;
+
+static nvram_stats_t L_boot;
+
+static nvram_stats_t L_unfolded;
+
+static void nvram_stats_add(nvram_stats_t *stats, const uint32_t bytes, const uint32_t pages)
+{
+    stats->writes++;
+
+    stats->bytes += bytes;
+
+    stats->pages += pages;
+}
+
+static void nvram_stats_write(unsigned char *output, const nvram_stats_t *stats)
+{
+    uint32ToChar(output, stats->writes);
+
+    uint32ToChar(output + sizeof(uint32_t), stats->bytes);
+
+    uint32ToChar(output + (2 * sizeof(uint32_t)), stats->pages);
+}
+
+void nvram_write(void *destination, void *source, const size_t size)
+{
+    profile_count(PROFILE_NVM_WRITE);
+
+    const uintptr_t first = (uintptr_t)destination / NVRAM_PAGE_SIZE;
+
+    const uintptr_t last = (size == 0) ? first : ((uintptr_t)destination + size - 1) / NVRAM_PAGE_SIZE;
+
+    const uint32_t pages = (size == 0) ? 0 : (uint32_t)(last - first + 1);
+
+    nvram_stats_add(&L_transaction, size, pages);
+
+    nvram_stats_add(&L_boot, size, pages);
+
+    nvram_stats_add(&L_unfolded, size, pages);
+
+    nvm_write(destination, source, size);
+}
+
+void nvram_stats_transaction_start()
+{
+    nvram_stats_t wear = {N_wear->writes, N_wear->bytes, N_wear->pages};
+
+    wear.writes += L_unfolded.writes;
+
+    wear.bytes += L_unfolded.bytes;
+
+    wear.pages += L_unfolded.pages;
+
+    explicit_bzero(&L_unfolded, sizeof(L_unfolded));
+
+    // the fold itself is the first write of the transaction
+    explicit_bzero(&L_transaction, sizeof(L_transaction));
+
+    nvram_write((void *)PIC(&N_state_wear_pic), &wear, sizeof(wear));
+}
+
+uint16_t nvram_stats_dump(unsigned char *output)
+{
+    const nvram_stats_t lifetime = {N_wear->writes + L_unfolded.writes,
+                                    N_wear->bytes + L_unfolded.bytes,
+                                    N_wear->pages + L_unfolded.pages};
+
+    nvram_stats_write(output, &L_transaction);
+
+    nvram_stats_write(output + sizeof(nvram_stats_t), &L_boot);
+
+    nvram_stats_write(output + (2 * sizeof(nvram_stats_t)), &lifetime);
+
+    return NVRAM_STATS_DUMP_SIZE;
+}
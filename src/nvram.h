@@ -0,0 +1,69 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef NVRAM_H
+#define NVRAM_H
+
+#include <common.h>
+
+/**
+ * The size of the pages that NVRAM is erased and programmed in. A write counts once for
+ * every page that it touches, which is an estimate of the wear that it causes as the SDK
+ * may combine writes to the same page or rewrite a page that it has already erased
+ */
+#ifndef NVRAM_PAGE_SIZE
+#define NVRAM_PAGE_SIZE 64
+#endif
+
+// starts an NVRAM area on a page boundary so that the records in it line up with the pages
+#define NVRAM_ALIGNED __attribute__((aligned(NVRAM_PAGE_SIZE)))
+
+typedef struct nvram_stats_s
+{
+    uint32_t writes; // 4-bytes, the calls to nvm_write
+
+    uint32_t bytes; // 4-bytes
+
+    uint32_t pages; // 4-bytes, estimated, see NVRAM_PAGE_SIZE
+} nvram_stats_t;
+
+// transaction || boot || lifetime, each writes || bytes || pages, big endian
+#define NVRAM_STATS_DUMP_SIZE (3 * sizeof(nvram_stats_t))
+
+/**
+ * Starts counting the writes of a new transaction and folds everything that was written
+ * since the last time this was called into the lifetime totals kept in NVRAM. Folding takes
+ * a write of its own, which is why it only happens once per transaction
+ */
+void nvram_stats_transaction_start();
+
+/**
+ * Dumps the counters as described by NVRAM_STATS_DUMP_SIZE. The lifetime totals include
+ * what has been written since they were last folded
+ * @param output where to write the counters, NVRAM_STATS_DUMP_SIZE bytes
+ * @return the number of bytes written
+ */
+uint16_t nvram_stats_dump(unsigned char *output);
+
+/**
+ * Writes to NVRAM, every write of the app goes through here so that it can be counted
+ * @param destination the NVRAM to write to
+ * @param source what to write, NULL to write zeros
+ * @param size the number of bytes to write
+ */
+void nvram_write(void *destination, void *source, const size_t size);
+
+#endif // NVRAM_H
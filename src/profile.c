@@ -0,0 +1,111 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "profile.h"
+
+#include <utils.h>
+
+typedef struct profile_command_s
+{
+    uint8_t ins; // 1-byte
+
+    uint32_t calls; // 4-bytes, 0 = unused
+} profile_command_t;
+
+static uint32_t L_counters[PROFILE_COUNTERS];
+
+static profile_command_t L_commands[PROFILE_COMMAND_SLOTS];
+
+static void profile_trace(const char direction, const char *name)
+{
+    PRINTF(
+        "%c%s %u %u %u\n",
+        direction,
+        name,
+        (unsigned int)L_counters[PROFILE_GE_ADD],
+        (unsigned int)L_counters[PROFILE_KECCAK],
+        (unsigned int)L_counters[PROFILE_NVM_WRITE]);
+}
+
+void profile_count(const profile_counter_t counter)
+{
+    if (DEBUG_BUILD != 1 && PROFILE_TRACE != 1)
+    {
+        return;
+    }
+
+    L_counters[counter]++;
+}
+
+void profile_command(const uint8_t ins)
+{
+    if (DEBUG_BUILD != 1 && PROFILE_TRACE != 1)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < PROFILE_COMMAND_SLOTS; i++)
+    {
+        if (L_commands[i].calls == 0 || L_commands[i].ins == ins)
+        {
+            L_commands[i].ins = ins;
+
+            L_commands[i].calls++;
+
+            return;
+        }
+    }
+}
+
+const char *profile_enter(const char *name)
+{
+    profile_trace('>', name);
+
+    return name;
+}
+
+void profile_exit(const char **name)
+{
+    profile_trace('<', *name);
+}
+
+uint16_t profile_dump(unsigned char *output)
+{
+    uint16_t offset = 0;
+
+    for (size_t i = 0; i < PROFILE_COUNTERS; i++, offset += sizeof(uint32_t))
+    {
+        uint32ToChar(output + offset, L_counters[i]);
+    }
+
+    for (size_t i = 0; i < PROFILE_COMMAND_SLOTS && L_commands[i].calls != 0; i++)
+    {
+        output[offset++] = L_commands[i].ins;
+
+        uint32ToChar(output + offset, L_commands[i].calls);
+
+        offset += sizeof(uint32_t);
+    }
+
+    return offset;
+}
+
+void profile_reset()
+{
+    explicit_bzero(L_counters, sizeof(L_counters));
+
+    explicit_bzero(L_commands, sizeof(L_commands));
+}
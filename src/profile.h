@@ -0,0 +1,102 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <common.h>
+
+/**
+ * Counts how often the costly primitives, NVRAM writes and commands run so that the work an
+ * optimization saves can be measured on a device (see APDU_DEBUG_P1_PROFILE). The counting
+ * only happens in debug and profiling builds. The SDK gives an app no clock that runs while it computes,
+ * so point additions (PROFILE_GE_ADD) stand in for elapsed cycles as they dominate the cost
+ * of everything else on the curve
+ *
+ * Profiling builds (PROFILE=1) also trace the functions that carry PROFILE_SCOPE(). Every
+ * call writes one record through PRINTF as it is entered and one as it returns, each being
+ *
+ *     {'>' or '<'}{function} {point additions} {keccak runs} {NVRAM writes}\n
+ *
+ * where the numbers are the running counters at that moment. scripts/profile.js turns the
+ * records into per-function totals. A THROW unwinds past the exit record of every function
+ * between it and the CATCH, which the script takes care of when the parent returns
+ */
+
+typedef enum profile_counter_e
+{
+    PROFILE_GE_FROMBYTES = 0,
+    PROFILE_GE_ADD,
+    PROFILE_GE_SCALARMULT,
+    PROFILE_GE_SCALARMULT_BASE,
+    PROFILE_HASH_TO_EC,
+    PROFILE_KECCAK,
+    PROFILE_RANDOM_SCALAR,
+    PROFILE_NVM_WRITE,
+    PROFILE_COUNTERS
+} profile_counter_t;
+
+#define PROFILE_COMMAND_SLOTS 16 // the commands that are counted, by the first time that they are seen
+
+/**
+ * Counts one more run of a primitive
+ * @param counter the primitive
+ */
+void profile_count(const profile_counter_t counter);
+
+/**
+ * Counts one more request for a command
+ * @param ins the instruction of the command
+ */
+void profile_command(const uint8_t ins);
+
+/**
+ * Writes out the counters, each counter as 4 bytes (BE) in the order of profile_counter_t
+ * followed by ins {1 byte} || calls {4 bytes} for every command that was counted
+ * @param output where to write the counters
+ * @returns the number of bytes written
+ */
+uint16_t profile_dump(unsigned char *output);
+
+/**
+ * Sets every counter back to zero
+ */
+void profile_reset();
+
+/**
+ * Writes the record for entering a traced function
+ * @param name the name of the function
+ * @returns the name to hand to profile_exit
+ */
+const char *profile_enter(const char *name);
+
+/**
+ * Writes the record for returning from a traced function
+ * @param name the name of the function, as returned by profile_enter
+ */
+void profile_exit(const char **name);
+
+#if PROFILE_TRACE == 1
+// the exit record is written by the cleanup of the variable so that every return is covered
+#define PROFILE_SCOPE() \
+    __attribute__((cleanup(profile_exit))) __attribute__((unused)) const char *profile_scope = profile_enter(__func__)
+#else
+#define PROFILE_SCOPE()
+#endif
+
+#define PROFILE_DUMP_MAX_SIZE ((PROFILE_COUNTERS * sizeof(uint32_t)) + (PROFILE_COMMAND_SLOTS * (1 + sizeof(uint32_t))))
+
+#endif // PROFILE_H
@@ -0,0 +1,175 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "review.h"
+
+#include <session.h>
+#include <utils.h>
+
+// the command under review, already relocated (see PIC)
+static const review_t *L_review = NULL;
+
+// the size of the result of the command under review
+static uint16_t L_output_size = 0;
+
+// whether the user approved the command for the rest of the session
+static unsigned int L_approve_all = 0;
+
+// the screens only ever show one command so they share their text
+static char L_line1[REVIEW_LINE_SIZE];
+
+static char L_line2[REVIEW_LINE_SIZE];
+
+static char L_title[REVIEW_LINE_SIZE];
+
+static void review_text(char *line, const char *text)
+{
+    const char *source = (const char *)PIC(text);
+
+    const size_t length = MIN(strlen(source), REVIEW_LINE_SIZE - 1);
+
+    os_memmove(line, source, length);
+
+    line[length] = '\0';
+}
+
+static void review_run()
+{
+    const review_t *review = L_review;
+
+    BEGIN_TRY
+    {
+        TRY
+        {
+            uint16_t (*run)() = (uint16_t(*)())PIC(review->run);
+
+            const uint16_t status = run();
+
+            if (status != OP_OK)
+            {
+                THROW(status);
+            }
+
+            if (review->pre_approved != NULL)
+            {
+                *(review->pre_approved) = L_approve_all;
+            }
+
+            CLOSE_TRY;
+
+            sendResponse(
+                write_io_hybrid(
+                    review->output, L_output_size, (const unsigned char *)PIC(review->name), true),
+                true);
+        }
+        CATCH_OTHER(e)
+        {
+            sendError(e);
+        }
+        FINALLY
+        {
+            // Explicitly clear the working memory
+            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
+
+            // Explicitly clear any display information
+            explicit_bzero(DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
+        };
+    }
+    END_TRY;
+}
+
+UX_STEP_SPLASH(ux_review_splash_1_step, pnn, review_run(), {&C_icon_turtlecoin, L_line1, L_line2});
+
+UX_FLOW(ux_review_splash, &ux_review_splash_1_step);
+
+static void review_splash(const unsigned int approve_all)
+{
+    L_approve_all = approve_all;
+
+    review_text(L_line1, L_review->busy[0]);
+
+    review_text(L_line2, L_review->busy[1]);
+
+    ux_flow_init(0, ux_review_splash, NULL);
+}
+
+UX_STEP_NOCB(ux_review_flow_1_step, pnn, {&C_icon_turtlecoin, L_line1, L_line2});
+
+UX_STEP_NOCB(ux_review_flow_2_step, bnnn_paging, {.title = L_title, .text = (char *)DISPLAY_KEY_HEX});
+
+UX_STEP_VALID(ux_review_flow_3_step, pb, review_splash(1), {&C_icon_validate_14, "Approve All"});
+
+UX_STEP_VALID(ux_review_flow_4_step, pb, review_splash(0), {&C_icon_validate_14, "Approve"});
+
+UX_STEP_VALID(ux_review_flow_5_step, pb, do_deny(), {&C_icon_crossmark, "Reject"});
+
+UX_FLOW(
+    ux_review_flow,
+    &ux_review_flow_1_step,
+    &ux_review_flow_2_step,
+    &ux_review_flow_4_step,
+    &ux_review_flow_5_step);
+
+UX_FLOW(
+    ux_review_approve_all_flow,
+    &ux_review_flow_1_step,
+    &ux_review_flow_2_step,
+    &ux_review_flow_3_step,
+    &ux_review_flow_4_step,
+    &ux_review_flow_5_step);
+
+void review_output_size(const uint16_t size)
+{
+    L_output_size = size;
+}
+
+void review_start(const review_t *review, const unsigned char *key, const uint8_t p1, volatile unsigned int *flags)
+{
+    L_review = (const review_t *)PIC(review);
+
+    L_output_size = L_review->output_size;
+
+    toHexString(key, KEY_SIZE, DISPLAY_KEY_HEX, KEY_HEXSTR_SIZE);
+
+    if (L_review->pre_approved != NULL && *(L_review->pre_approved) == 1)
+    {
+        review_splash(1);
+    }
+    else if (L_review->in_session && session_take())
+    {
+        review_splash(0);
+    }
+    else if (p1 == P1_CONFIRM)
+    {
+        review_text(L_line1, L_review->prompt[0]);
+
+        review_text(L_line2, L_review->prompt[1]);
+
+        review_text(L_title, L_review->title);
+
+        ux_flow_init(0, (L_review->pre_approved != NULL) ? ux_review_approve_all_flow : ux_review_flow, NULL);
+    }
+    else if (p1 == P1_NON_CONFIRM && DEBUG_BUILD == 1)
+    {
+        review_splash(1);
+    }
+    else
+    {
+        return sendError(ERR_OP_USER_REQUIRED);
+    }
+
+    *flags |= IO_ASYNCH_REPLY;
+}
@@ -0,0 +1,68 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef REVIEW_H
+#define REVIEW_H
+
+#include <common.h>
+#include <stdbool.h>
+
+#define REVIEW_LINE_SIZE 20 // bytes, of a line of text on the review and splash screens
+
+/**
+ * A command that shows a single key for the user to review, computes its result in the working set
+ * once approved and sends that back. All of the screens, the approval and the exception handling
+ * are shared (see review_start) so that a command only has to describe itself
+ */
+typedef struct review_s
+{
+    const char *prompt[2]; // the question on the first screen
+
+    const char *title; // over the key that is reviewed
+
+    const char *busy[2]; // on the splash screen while the result is computed
+
+    uint16_t (*run)(); // computes the result, OP_OK or the error to send back
+
+    const unsigned char *output; // the result, in the working set
+
+    uint16_t output_size; // 2-bytes, unless the run function says otherwise (see review_output_size)
+
+    const unsigned char *name; // of the result in debug output
+
+    unsigned int *pre_approved; // the approval for the rest of the session, NULL if it can not be given
+
+    bool in_session; // whether a session approval covers the command (see session_take)
+} review_t;
+
+/**
+ * Shows the review screens of a command, or goes straight to computing its result when the user
+ * already approved it for the session or, on debug builds, when no confirmation was asked for
+ * @param review the description of the command
+ * @param key the key that the user reviews (KEY_SIZE bytes)
+ * @param p1 P1 of the request
+ * @param flags the flags of the exchange
+ */
+void review_start(const review_t *review, const unsigned char *key, const uint8_t p1, volatile unsigned int *flags);
+
+/**
+ * Changes the size of the result of the command under review, for the run function of a
+ * command whose result depends on how much it was given
+ * @param size the size of the result
+ */
+void review_output_size(const uint16_t size);
+
+#endif // REVIEW_H
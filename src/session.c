@@ -0,0 +1,64 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include "session.h"
+
+// the commands that the session approval still covers, 0 = no session
+static uint8_t L_session_operations = 0;
+
+// the ticker events left before the session approval runs out
+static uint16_t L_session_ticks = 0;
+
+void session_start(const uint8_t operations, const uint16_t seconds)
+{
+    L_session_operations = operations;
+
+    L_session_ticks = (seconds * 1000) / SESSION_TICK_MS;
+}
+
+bool session_take()
+{
+    if (L_session_operations == 0)
+    {
+        return false;
+    }
+
+    L_session_operations--;
+
+    return true;
+}
+
+void session_tick()
+{
+    if (L_session_operations == 0)
+    {
+        return;
+    }
+
+    if (L_session_ticks <= 1)
+    {
+        return session_end();
+    }
+
+    L_session_ticks--;
+}
+
+void session_end()
+{
+    L_session_operations = 0;
+
+    L_session_ticks = 0;
+}
@@ -0,0 +1,57 @@
+/*****************************************************************************
+ *   (c) 2020 The TurtleCoin Developers
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <common.h>
+#include <stdbool.h>
+
+#define SESSION_TICK_MS 100 // the interval of the ticker events that the session time is counted in
+#define SESSION_MAX_SECONDS 900 // the longest that a session approval may last
+
+/**
+ * A session approval lets the user approve a number of the commands that produce signatures or
+ * key images (see review_t) at once for a limited time, the commands that it covers then run
+ * without prompting until the number is used up, the time runs out, the transaction state is
+ * reset or the app exits. The time is counted in ticker events so it does not move while a
+ * command is being computed
+ */
+
+/**
+ * Starts a session approval, replacing any that is already running
+ * @param operations the number of commands that the session covers
+ * @param seconds how long the session lasts
+ */
+void session_start(const uint8_t operations, const uint16_t seconds);
+
+/**
+ * Uses up one of the commands of the session approval
+ * @returns whether a session approval covered the command
+ */
+bool session_take();
+
+/**
+ * Moves the time of the session approval on by one ticker event and ends it once it runs out
+ */
+void session_tick();
+
+/**
+ * Ends the session approval, if any
+ */
+void session_end();
+
+#endif // SESSION_H
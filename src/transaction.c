@@ -16,638 +16,2549 @@
 
 #include "transaction.h"
 
+#include <arena.h>
+#include <batch.h>
+#include <cache.h>
+#include <idle.h>
 #include <keys.h>
+#include <nvram.h>
+#include <profile.h>
+#include <utils.h>
 #include <varint.h>
 
 #ifdef TARGET_NANOX
-const raw_transaction_t N_state_raw_transaction_pic;
-const tx_pre_signatures_t N_state_pre_signatures_pic;
-const transaction_info_t N_state_transaction_info_pic;
+const tx_pool_t N_state_pool_pic[TX_SLOTS] NVRAM_ALIGNED;
+const transaction_info_t N_state_transaction_info_pic[TX_SLOTS] NVRAM_ALIGNED;
+const tx_checkpoint_t N_state_checkpoint_pic[TX_SLOTS] NVRAM_ALIGNED;
+const tx_parking_t N_state_parking_pic[TX_SLOTS] NVRAM_ALIGNED;
 #else
-raw_transaction_t N_state_raw_transaction_pic;
-tx_pre_signatures_t N_state_pre_signatures_pic;
-transaction_info_t N_state_transaction_info_pic;
+tx_pool_t N_state_pool_pic[TX_SLOTS] NVRAM_ALIGNED;
+transaction_info_t N_state_transaction_info_pic[TX_SLOTS] NVRAM_ALIGNED;
+tx_checkpoint_t N_state_checkpoint_pic[TX_SLOTS] NVRAM_ALIGNED;
+tx_parking_t N_state_parking_pic[TX_SLOTS] NVRAM_ALIGNED;
 #endif
 
+// the pool of every slot, the pre-signatures behind the raw transaction and the staged pages all line up with the pages
+_Static_assert(TX_PAGE_SIZE == NVRAM_PAGE_SIZE, "the staged page of the raw transaction is not an NVRAM page");
+_Static_assert(TX_POOL_SIZE % NVRAM_PAGE_SIZE == 0, "the pool is not a whole number of NVRAM pages");
+_Static_assert(TX_PRE_SIGNATURE_SIZE % NVRAM_PAGE_SIZE == 0, "a pre-signature is not a whole number of NVRAM pages");
+_Static_assert(sizeof(transaction_input_t) <= TX_PRE_SIGNATURE_SIZE, "a pre-signature does not fit its record");
+_Static_assert((SIG_SIZE % NVRAM_PAGE_SIZE) == 0, "the precomputed terms do not line up with the NVRAM pages");
+
 // locally stored meta data about the current transaction construction
 static transaction_t L_transaction;
 
-#define TX_RESET()                                           \
-    nvm_write((void *)N_raw_transaction, NULL, TX_MAX_SIZE); \
-    L_transaction.current_position = 0;
+// the transaction prefix is hashed as it is written so that it never has to be read back
+static hw_keccak_t L_prefix_context;
 
-#define TX_WRITE(payload, length)                                                                    \
-    nvm_write((void *)N_raw_transaction + L_transaction.current_position, (void *)&payload, length); \
-    L_transaction.current_position += length
+static unsigned char L_prefix_hash[KEY_SIZE];
 
-#define TX_WRITE_PTR(payload, length)                                                               \
-    nvm_write((void *)N_raw_transaction + L_transaction.current_position, (void *)payload, length); \
-    L_transaction.current_position += length
+// where the prefix ends and the signatures start in the raw transaction
+static uint16_t L_tx_prefix_size;
+
+// when the signatures are streamed to the host the whole transaction is hashed as they are produced
+static hw_keccak_t L_tx_context;
 
-#define PRE_SIG_RESET() nvm_write((void *)N_tx_pre_signatures, NULL, sizeof(tx_pre_signatures_t))
+static unsigned char L_tx_hash[KEY_SIZE];
 
-#define PRE_SIG_WRITE(payload)                                           \
-    nvm_write(                                                           \
-        (void *)N_tx_pre_signatures[L_transaction.received_input_count], \
-        (void *)&payload,                                                \
-        sizeof(transaction_input_t))
+// the pre-signature state of every input is sealed under this key when the host holds it for us
+static unsigned char L_seal_key[KEY_SIZE];
 
-#define TX_INFO_RESET() nvm_write((void *)N_tx_info, NULL, sizeof(transaction_info_t))
+// appends to the raw transaction are gathered here and committed to NVRAM a whole page at a time
+static unsigned char L_tx_page[TX_PAGE_SIZE];
 
-#define TX_INFO_WRITE(payload) nvm_write((void *)N_tx_info, (void *)&payload, sizeof(transaction_info_t))
+// the (page aligned) offset in the raw transaction that the staged page belongs at
+static uint16_t L_tx_page_start;
+
+// the slot whose NVRAM areas the transaction in RAM belongs to, the others are parked (see tx_select_slot)
+static uint8_t L_tx_slot = 0;
 
 /**
- * Initializes our internal transaction structure that holds
- * some basic values that are used to navigate our transaction
- * state while it is in memory somewhere
- * @return
+ * How much of each NVRAM area of every slot has been written since it was last wiped so that
+ * a reset only costs as much as the transaction before it. What is left behind from before the
+ * device was powered on is unknown so the first reset of each slot wipes everything
  */
-uint16_t init_tx()
+static struct
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            L_transaction.total_input_amount = 0;
+    uint16_t size;
 
-            L_transaction.total_output_amount = 0;
+    // the lowest offset written at the end of the pool by the precomputed terms and the pre-signatures
+    uint16_t back;
 
-            L_transaction.has_payment_id = 0;
+    // whether the info and the checkpoint have been written
+    bool state;
+} L_tx_written[TX_SLOTS] = {[0 ... TX_SLOTS - 1] = {TX_POOL_SIZE, TX_POOL_SIZE, true}};
 
-            L_transaction.input_count = 0;
+#define TX_WRITTEN L_tx_written[L_tx_slot]
 
-            L_transaction.received_input_count = 0;
+/**
+ * Transactions small enough to fit are built here instead (see tx_start) with their pre-signatures
+ * and info stored behind the raw transaction so that they never touch NVRAM at all
+ */
+static unsigned char L_tx_ram[TX_RAM_SIZE];
 
-            L_transaction.output_count = 0;
+// how much room the raw transaction, with the precomputed terms at its very end, has where it is built
+static uint16_t L_tx_capacity = TX_POOL_SIZE;
+
+/**
+ * The signing that goes ahead while the user reviews the transaction (see tx_speculate_begin)
+ * along with what it takes to undo it when the transaction is rejected
+ */
+static struct
+{
+    bool active;
 
-            L_transaction.received_output_count = 0;
+    bool stepping; // set while a step runs, so a step unwound by an exception is found out
 
-            L_transaction.state = TX_UNUSED;
+    uint16_t start_position; // where the signatures start in the raw transaction
 
-            CLOSE_TRY;
+    uint16_t page_start; // L_tx_page_start when it began
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return ERR_TX_INIT;
-        }
-        FINALLY {}
-    }
-    END_TRY;
-}
+    unsigned char page[TX_PAGE_SIZE]; // L_tx_page when it began
+} L_tx_speculation;
 
 /**
- * Dumps the raw transaction to the given unsigned character array
- * @param out the pointer to dump to
- * @param start_offset the starting offset
+ * The totals of the transaction as they are shown for review, formatted as the inputs and the
+ * outputs are loaded so that nothing is left to format once the user is asked to sign
  */
-uint16_t tx_dump(unsigned char *out, const uint16_t start_offset, const uint16_t length)
+static struct
 {
-    BEGIN_TRY
-    {
-        TRY
-        {
-            os_memmove(out, (unsigned char *)N_raw_transaction + start_offset, length);
+    unsigned char amount[TX_REVIEW_TEXT_SIZE];
 
-            CLOSE_TRY;
+    unsigned char fee[TX_REVIEW_TEXT_SIZE];
+} L_tx_review;
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return ERR_TX_DUMP;
-        }
-        FINALLY {}
+#define TX_RAW ((L_transaction.in_ram == 1) ? L_tx_ram : (unsigned char *)N_tx_pool)
+
+// in RAM and in the pool alike the pre-signatures follow the room that the raw transaction has
+#define TX_PRE_SIGNATURE(input_index) \
+    ((transaction_input_t *)(TX_RAW + L_tx_capacity + ((input_index) * TX_PRE_SIGNATURE_SIZE)))
+
+#define TX_INFO                                                                                                \
+    ((L_transaction.in_ram == 1) ? (transaction_info_t *)(L_tx_ram + TX_RAM_SIZE - sizeof(transaction_info_t)) \
+                                 : (transaction_info_t *)N_tx_info)
+
+/**
+ * The precomputed ring signature terms of every input sit at the very end of the raw transaction,
+ * the signatures of an input are never larger than its terms so writing them can only ever
+ * overwrite the terms of inputs that were already signed
+ */
+#define TX_TERMS_POSITION(input_index) \
+    (L_tx_capacity - ((L_transaction.input_count - (input_index)) * L_transaction.ring_size * SIG_SIZE))
+
+// what is kept of the transaction in RAM
+#define TX_RAM_RESET()                                    \
+    explicit_bzero(L_tx_ram, sizeof(L_tx_ram));           \
+    L_tx_capacity = TX_POOL_SIZE;                         \
+    L_transaction.current_position = 0;                   \
+    explicit_bzero(L_tx_page, sizeof(L_tx_page));         \
+    L_tx_page_start = 0;                                  \
+    explicit_bzero(L_prefix_hash, sizeof(L_prefix_hash)); \
+    explicit_bzero(L_tx_hash, sizeof(L_tx_hash));         \
+    L_tx_prefix_size = 0;                                 \
+    hw_keccak_init(&L_prefix_context);
+
+#define TX_RESET()                                                                           \
+    nvram_write((void *)N_tx_pool, NULL, TX_WRITTEN.size);                                   \
+    TX_WRITTEN.size = 0;                                                                     \
+    nvram_write((void *)N_tx_pool + TX_WRITTEN.back, NULL, TX_POOL_SIZE - TX_WRITTEN.back); \
+    TX_WRITTEN.back = TX_POOL_SIZE;                                                          \
+    TX_RAM_RESET();
+
+#define TX_WRITE(payload, length)                                           \
+    tx_append((unsigned char *)&payload, length);                           \
+    hw_keccak_update(&L_prefix_context, (unsigned char *)&payload, length); \
+    L_transaction.current_position += length
+
+#define TX_WRITE_PTR(payload, length)                                      \
+    tx_append((unsigned char *)payload, length);                           \
+    hw_keccak_update(&L_prefix_context, (unsigned char *)payload, length); \
+    L_transaction.current_position += length
+
+// the signatures follow the prefix and are not part of the prefix hash
+#define TX_SIGNATURES_WRITE(payload, length)     \
+    tx_append((unsigned char *)payload, length); \
+    L_transaction.current_position += length
+
+// the signatures are handed to the host instead so only the hash of the whole transaction keeps them
+#define TX_SIGNATURES_STREAM(payload, length) hw_keccak_update(&L_tx_context, (unsigned char *)payload, length)
+
+#define PRE_SIG_WRITE(payload)                                                                             \
+    tx_back_written(L_tx_capacity);                                                                        \
+    nvram_write(                                                                                           \
+        (void *)TX_PRE_SIGNATURE(L_transaction.received_input_count), (void *)&payload, sizeof(transaction_input_t))
+
+/**
+ * When the host resends the ring of an input it sits at the end of the working set so
+ * the signatures are staged in what is left in front of it
+ */
+#define TX_RESENT_RING_CAPACITY ((WORKING_SET_SIZE - (L_transaction.ring_size * KEY_SIZE)) / SIG_SIZE)
+
+#define TX_INFO_RESET() nvram_write((void *)N_tx_info, NULL, sizeof(transaction_info_t))
+
+#define TX_INFO_WRITE(payload) nvram_write((void *)N_tx_info, (void *)&payload, sizeof(transaction_info_t))
+
+#define TX_CHECKPOINT_RESET() nvram_write((void *)N_tx_checkpoint, NULL, sizeof(tx_checkpoint_t))
+
+#define TX_CHECKPOINT_WRITE(payload) nvram_write((void *)N_tx_checkpoint, (void *)&payload, sizeof(tx_checkpoint_t))
+
+/**
+ * None of the methods below open their own exception frames so any SDK
+ * exception is handled by the APDU handler that called into us. This wipes the given
+ * memory while passing the status through for the early return paths
+ * @param buffer the memory to wipe
+ * @param length the length of the memory to wipe
+ * @param status the status to return
+ * @return the status provided
+ */
+static uint16_t tx_wipe(void *buffer, const size_t length, const uint16_t status)
+{
+    explicit_bzero(buffer, length);
+
+    return status;
+}
+
+/**
+ * Notes that the end of the pool has been written from the given offset on so that the next reset
+ * wipes it, the precomputed terms and the pre-signatures are all written there
+ * @param position the offset in the pool
+ */
+static void tx_back_written(const uint16_t position)
+{
+    if (position < TX_WRITTEN.back)
+    {
+        TX_WRITTEN.back = position;
     }
-    END_TRY;
 }
 
 /**
- * Returns the transaction network fee
+ * Where the raw transaction of the active slot has to end in its pool for the pre-signatures of
+ * every input to fit behind it, the host holds those of sealed inputs so they take none of it
  */
-uint64_t tx_fee()
+static uint16_t tx_pool_capacity()
 {
-    return (tx_input_amount() - tx_output_amount());
+    if (L_transaction.seal_inputs == 1)
+    {
+        return TX_POOL_SIZE;
+    }
+
+    return TX_POOL_SIZE - (L_transaction.input_count * TX_PRE_SIGNATURE_SIZE);
 }
 
 /**
- * Finalizes a transaction prefix by constructing the TX_EXTRA field
+ * Writes to the raw transaction wherever it is built while keeping track of how much
+ * of it in NVRAM will need to be wiped by the next reset
+ * @param position the offset in the raw transaction
+ * @param data the data to write
+ * @param length the length of the data
  */
-uint16_t tx_finalize_prefix()
+static void tx_raw_write(const uint16_t position, const unsigned char *data, const size_t length)
 {
-    // check to make sure we are in the correct state
-    if (tx_state() != TX_OUTPUTS_RECEIVED)
+    if (L_transaction.in_ram == 1)
     {
-        return ERR_TRANSACTION_STATE;
+        os_memmove(L_tx_ram + position, data, length);
+
+        return;
     }
 
-    // Are we trying to create more in outputs than we supplied in inputs?
-    if (tx_output_amount() > tx_input_amount())
+    if (position + length > TX_WRITTEN.size)
     {
-        return ERR_TX_AMOUNT;
+        TX_WRITTEN.size = position + length;
     }
 
-    unsigned char extra[TX_EXTRA_MAX_SIZE] = {0};
+    nvram_write((void *)N_tx_pool + position, (void *)data, length);
+}
+
+/**
+ * Appends data to the end of the raw transaction through the staged page, every page
+ * that is completed is committed to NVRAM in one write and whole pages of the data that
+ * line up with the page boundaries are written straight through
+ * @param data the data to append
+ * @param length the length of the data
+ */
+static void tx_append(const unsigned char *data, size_t length)
+{
+    size_t staged = L_transaction.current_position - L_tx_page_start;
 
-    BEGIN_TRY
+    while (length != 0)
     {
-        TRY
+        if (staged == 0 && length >= TX_PAGE_SIZE)
         {
-            unsigned int pos = 0;
-
-            // figure out how long the extra field will be
-            {
-                unsigned int extra_size = TX_EXTRA_TAG_SIZE + KEY_SIZE; // include the public key at minimum
-
-                if (L_transaction.has_payment_id == 1)
-                {
-                    // nonce_tag + size + paymentid_tag + key
-                    extra_size += TX_EXTRA_TAG_SIZE + TX_EXTRA_TAG_SIZE + TX_EXTRA_TAG_SIZE + KEY_SIZE;
-                }
+            const size_t pages = length - (length % TX_PAGE_SIZE);
 
-                pos = encode_varint(extra, extra_size, sizeof(extra));
-            }
+            tx_raw_write(L_tx_page_start, data, pages);
 
-            // write the tx public key to extra
-            {
-                unsigned char tag = TX_EXTRA_PUBKEY_TAG;
+            L_tx_page_start += pages;
 
-                os_memmove(extra + pos, &tag, TX_EXTRA_TAG_SIZE);
+            data += pages;
 
-                pos += TX_EXTRA_TAG_SIZE;
+            length -= pages;
 
-                os_memmove(extra + pos, N_tx_info->tx_public_key, KEY_SIZE);
+            continue;
+        }
 
-                pos += KEY_SIZE;
-            }
+        size_t count = TX_PAGE_SIZE - staged;
 
-            if (L_transaction.has_payment_id == 1)
-            {
-                // write the nonce tag to extra
-                {
-                    unsigned char tag = TX_EXTRA_NONCE_TAG;
+        if (count > length)
+        {
+            count = length;
+        }
 
-                    os_memmove(extra + pos, &tag, TX_EXTRA_TAG_SIZE);
+        os_memmove(L_tx_page + staged, data, count);
 
-                    pos += TX_EXTRA_TAG_SIZE;
-                }
+        staged += count;
 
-                // write the size of the nonce field in extra
-                {
-                    pos += encode_varint(extra + pos, TX_EXTRA_TAG_SIZE + KEY_SIZE, TX_EXTRA_TAG_SIZE);
-                }
+        data += count;
 
-                // write the payment id key to extra
-                {
-                    unsigned char tag = TX_EXTRA_NONCE_PAYMENT_ID_TAG;
+        length -= count;
 
-                    os_memmove(extra + pos, &tag, TX_EXTRA_TAG_SIZE);
+        if (staged == TX_PAGE_SIZE)
+        {
+            tx_raw_write(L_tx_page_start, L_tx_page, TX_PAGE_SIZE);
 
-                    pos += TX_EXTRA_TAG_SIZE;
+            L_tx_page_start += TX_PAGE_SIZE;
 
-                    os_memmove(extra + pos, N_tx_info->payment_id, KEY_SIZE);
+            staged = 0;
+        }
+    }
+}
 
-                    pos += KEY_SIZE;
-                }
-            }
+/**
+ * Commits the partially filled page to NVRAM so that the raw transaction can be read back,
+ * the page stays staged so that the next append completes it in place
+ */
+static void tx_flush()
+{
+    const size_t staged = L_transaction.current_position - L_tx_page_start;
 
-            // batch write to NVRAM
-            TX_WRITE(extra, pos);
+    if (staged != 0)
+    {
+        tx_raw_write(L_tx_page_start, L_tx_page, staged);
+    }
+}
 
-            L_transaction.state = TX_PREFIX_READY;
+/**
+ * Overwrites data that was already appended to the raw transaction wherever it
+ * currently lives: in NVRAM or in the staged page
+ * @param position the offset in the raw transaction
+ * @param data the replacement data
+ * @param length the length of the data
+ */
+static void tx_patch(const uint16_t position, const unsigned char *data, const size_t length)
+{
+    size_t committed = 0;
 
-            CLOSE_TRY;
+    if (position < L_tx_page_start)
+    {
+        committed = L_tx_page_start - position;
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return ERR_TX_FINALIZE_PREFIX;
-        }
-        FINALLY
+        if (committed > length)
         {
-            explicit_bzero(extra, sizeof(extra));
+            committed = length;
         }
+
+        tx_raw_write(position, data, committed);
+    }
+
+    if (committed < length)
+    {
+        os_memmove(L_tx_page + (position + committed - L_tx_page_start), data + committed, length - committed);
     }
-    END_TRY;
 }
 
 /**
- * Returns if the transaction uses a payment id
+ * Checkpoints what we know about the transaction to NVRAM, along with what of it lives
+ * only in RAM and cannot be rebuilt from the raw transaction, so that the session can be
+ * resumed by tx_resume if the device is reset or the app is restarted. The staged page is
+ * committed first so that the raw transaction is complete up to the current position
  */
-unsigned int tx_has_payment_id()
+static void tx_checkpoint()
 {
-    return (unsigned int)L_transaction.has_payment_id;
+    tx_flush();
+
+    // a transaction built in RAM does not outlive a reset so there is nothing to resume it from
+    if (L_transaction.in_ram == 1)
+    {
+        return;
+    }
+
+    tx_checkpoint_t checkpoint;
+
+    os_memmove(&checkpoint.transaction, &L_transaction, sizeof(transaction_t));
+
+    checkpoint.prefix_size = L_tx_prefix_size;
+
+    // there is no seed before the transaction is started or after it is complete
+    hw_nonce_drbg_save(checkpoint.nonce_seed);
+
+    os_memmove(checkpoint.seal_key, L_seal_key, KEY_SIZE);
+
+    os_memmove(checkpoint.tx_hash, L_tx_hash, KEY_SIZE);
+
+    checkpoint.parked = 0;
+
+    TX_CHECKPOINT_WRITE(checkpoint);
+
+    TX_WRITTEN.state = true;
+
+    explicit_bzero(&checkpoint, sizeof(checkpoint));
 }
 
 /**
- * Returns the transaction hash
- * @param hash the pointer to put the hash into
+ * Moves a transaction that is built in RAM over to the NVRAM areas of its slot so that the RAM is
+ * free for the transaction of the next slot, the precomputed terms move to the end of the raw
+ * transaction in NVRAM where TX_TERMS_POSITION expects them to be once it is no longer in RAM
  */
-uint16_t tx_hash(unsigned char *hash)
+static void tx_spill()
 {
-    BEGIN_TRY
+    tx_flush();
+
+    const uint16_t terms_size = L_transaction.input_count * L_transaction.ring_size * SIG_SIZE;
+
+    const unsigned char *terms = L_tx_ram + TX_TERMS_POSITION(0);
+
+    const unsigned char *pre_signatures = (unsigned char *)TX_PRE_SIGNATURE(0);
+
+    const unsigned char *info = (unsigned char *)TX_INFO;
+
+    const uint16_t capacity = tx_pool_capacity();
+
+    L_transaction.in_ram = 0;
+
+    tx_raw_write(0, L_tx_ram, L_transaction.current_position);
+
+    if (NONCE_DRBG == 1)
     {
-        TRY
-        {
-            const uint16_t status = hw_keccak((unsigned char *)N_raw_transaction, L_transaction.current_position, hash);
+        tx_back_written(capacity - terms_size);
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+        nvram_write((void *)N_tx_pool + capacity - terms_size, (void *)terms, terms_size);
+    }
 
-            CLOSE_TRY;
+    if (L_transaction.seal_inputs != 1)
+    {
+        tx_back_written(capacity);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY {}
+        nvram_write(
+            (void *)N_tx_pool + capacity,
+            (void *)pre_signatures,
+            L_transaction.received_input_count * TX_PRE_SIGNATURE_SIZE);
     }
-    END_TRY;
+
+    nvram_write((void *)N_tx_info, (void *)info, sizeof(transaction_info_t));
+
+    TX_WRITTEN.state = true;
+
+    explicit_bzero(L_tx_ram, sizeof(L_tx_ram));
+
+    L_tx_capacity = capacity;
 }
 
 /**
- * Returns the total amount of the inputs
+ * Parks the transaction of the active slot in its NVRAM areas so that another slot can be used in
+ * the meantime, unlike a checkpoint this keeps the running hashes so that the transaction picks up
+ * exactly where it was when the slot is selected again, part of the way through signing included
  */
-uint64_t tx_input_amount()
+static void tx_park()
 {
-    return L_transaction.total_input_amount;
+    if (L_transaction.in_ram == 1)
+    {
+        tx_spill();
+    }
+
+    tx_checkpoint();
+
+    nvram_write((void *)N_tx_parking->prefix_hash, (void *)L_prefix_hash, KEY_SIZE);
+
+    nvram_write((void *)&N_tx_parking->prefix_context, (void *)&L_prefix_context, sizeof(hw_keccak_t));
+
+    nvram_write((void *)&N_tx_parking->tx_context, (void *)&L_tx_context, sizeof(hw_keccak_t));
+
+    // the flag goes last so that the slot is only ever resumed from a complete parking
+    const uint8_t parked = 1;
+
+    nvram_write((void *)&N_tx_checkpoint->parked, (void *)&parked, sizeof(uint8_t));
 }
 
 /**
- * Loads a transaction input
- * @param tx_public_key
- * @param output_index
+ * Writes an amount followed by the ticker
+ * @param text where the text goes (TX_REVIEW_TEXT_SIZE)
  * @param amount
- * @param public_keys
- * @param offsets
- * @param real_output_index
  */
-uint16_t tx_load_input(
-    const unsigned char *tx_public_key,
-    const uint8_t output_index,
-    const uint64_t amount,
-    const unsigned char *public_keys,
-    const uint32_t *offsets,
-    const uint8_t real_output_index)
+static void tx_review_format(unsigned char *text, const uint64_t amount)
 {
-    // return an error if we are not in the correct state
-    if (tx_state() != TX_RECEIVING_INPUTS)
+    const unsigned int offset = amountToString(text, amount, TX_REVIEW_TEXT_SIZE);
+
+    // copy the ticker on to the end of the amount
+    os_memmove(text + offset - 1, TICKER, TICKER_SIZE);
+}
+
+/**
+ * Formats the totals again after they have changed, the fee is only shown once the outputs do
+ * not spend more than the inputs (see tx_finalize_prefix)
+ */
+static void tx_review_update()
+{
+    tx_review_format(L_tx_review.amount, L_transaction.total_input_amount);
+
+    if (L_transaction.total_output_amount <= L_transaction.total_input_amount)
     {
-        return ERR_TRANSACTION_STATE;
+        tx_review_format(L_tx_review.fee, tx_fee());
     }
+}
 
-    unsigned char tx[TX_EXTRA_MAX_SIZE] = {0}; // 80-bytes
+/**
+ * Initializes our internal transaction structure that holds
+ * some basic values that are used to navigate our transaction
+ * state while it is in memory somewhere
+ * @return
+ */
+uint16_t init_tx()
+{
+    PROFILE_SCOPE();
 
-    transaction_input_t tx_input; // 193-bytes
+    L_transaction.total_input_amount = 0;
 
-// we are shadowing these into the tx_input structure to save memory
-#define DERIVATION (unsigned char *)&tx_input.public_keys
-#define PUBLIC_EPHEMERAL DERIVATION + KEY_SIZE
-#define PUBLIC_EPHEMERAL2 PUBLIC_EPHEMERAL + KEY_SIZE
+    L_transaction.total_output_amount = 0;
 
-    BEGIN_TRY
-    {
-        TRY
-        {
-            unsigned int pos = 0;
+    L_transaction.has_payment_id = 0;
 
-            // generate the key derivation using our private view key and the transaction public key
-            uint16_t status = hw_generate_key_derivation(DERIVATION, tx_public_key, PTR_VIEW_PRIVATE);
+    L_transaction.input_count = 0;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    L_transaction.received_input_count = 0;
 
-            // derive the public ephemeral
-            status = hw_derive_public_key(PUBLIC_EPHEMERAL, DERIVATION, output_index, PTR_SPEND_PUBLIC);
+    L_transaction.output_count = 0;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    L_transaction.received_output_count = 0;
 
-            // check to make sure that the calculated output key is in the position specified
-            status = os_memcmp(PUBLIC_EPHEMERAL, public_keys + (real_output_index * KEY_SIZE), KEY_SIZE);
+    L_transaction.ring_size = RING_PARTICIPANTS;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    L_transaction.offset_size = TX_OFFSET_MAX_SIZE;
 
-            // derive the private ephemeral
-            status = hw_derive_secret_key(tx_input.private_ephemeral, DERIVATION, output_index, PTR_SPEND_PRIVATE);
+    L_transaction.signed_input_count = 0;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    L_transaction.stream_signatures = 0;
 
-            // calculate the public key of the private ephemeral for matching down below
-            status = hw_private_key_to_public_key(PUBLIC_EPHEMERAL2, tx_input.private_ephemeral);
+    L_transaction.signing_started = 0;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    L_transaction.seal_inputs = 0;
 
-            // compare the derived public ephemeral against the one calculated by the private ephemeral
-            status = os_memcmp(PUBLIC_EPHEMERAL, PUBLIC_EPHEMERAL2, KEY_SIZE);
+    L_transaction.in_ram = 0;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    L_transaction.auto_advance = 0;
 
-            // generate the input key image using the public ephemeral and private ephemeral
-            status = hw__generate_key_image(tx_input.key_image, PUBLIC_EPHEMERAL, tx_input.private_ephemeral);
+    L_transaction.state = TX_UNUSED;
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    tx_review_update();
 
-            // write the input type to the transaction prefix
-            {
-                unsigned char type = 0x02;
+    return OP_OK;
+}
 
-                os_memmove(tx, &type, TX_EXTRA_TAG_SIZE);
+/**
+ * Returns if the transaction moves on to loading its inputs, to loading its outputs and to
+ * its finalized prefix by itself instead of being told to at every step
+ */
+unsigned int tx_auto_advances()
+{
+    return (unsigned int)L_transaction.auto_advance;
+}
 
-                pos += TX_EXTRA_TAG_SIZE;
-            }
+/**
+ * Dumps the raw transaction to the given unsigned character array
+ * @param out the pointer to dump to
+ * @param start_offset the starting offset
+ */
+uint16_t tx_dump(unsigned char *out, const uint16_t start_offset, const uint16_t length)
+{
+    PROFILE_SCOPE();
 
-            // write the input amount to the transaction prefix
-            {
-                pos += encode_varint(tx + pos, amount, sizeof(tx));
-            }
+    os_memmove(out, TX_RAW + start_offset, length);
 
-            L_transaction.total_input_amount += amount;
+    return OP_OK;
+}
 
-            // write number of global index offsets to the transaction prefix
-            {
-                unsigned char offset_length = RING_PARTICIPANTS;
+/**
+ * Returns how many bytes the raw transaction may take in the slot that the transaction methods
+ * work on, what is left of the area once the pre-signatures of its inputs have been set aside
+ */
+uint16_t tx_capacity()
+{
+    return L_tx_capacity;
+}
 
-                os_memmove(tx + pos, &offset_length, sizeof(tx));
+/**
+ * The exact size of an input in the prefix, type || amount || ring_size || offsets || key_image,
+ * the serializers size their inputs with it before writing them and tx_footprint with the largest
+ * that the amount and the offsets may take
+ * @param amount_size the size of the varint of the amount
+ * @param ring_size
+ * @param offsets_size the size of the varints of the offsets
+ */
+static uint32_t tx_input_size(const unsigned int amount_size, const uint8_t ring_size, const unsigned int offsets_size)
+{
+    return TX_EXTRA_TAG_SIZE + amount_size + varint_size(ring_size) + offsets_size + KEY_SIZE;
+}
 
-                pos += TX_EXTRA_TAG_SIZE;
-            }
+/**
+ * The exact size of an output in the prefix, amount || type || key
+ * @param amount_size the size of the varint of the amount
+ */
+static uint32_t tx_output_size(const unsigned int amount_size)
+{
+    return amount_size + TX_EXTRA_TAG_SIZE + KEY_SIZE;
+}
 
-            // write the input offsets to the transaction prefix
-            {
-                int i;
-                for (i = 0; i < RING_PARTICIPANTS; i++)
-                {
-                    pos += encode_varint(tx + pos, offsets[i], sizeof(tx));
-                }
-            }
+/**
+ * Works out the most that a transaction of the given shape can ever store: every input takes its
+ * type, amount, offsets and key image in the prefix and a signature per ring member, every output
+ * takes no more than TX_OUTPUT_MAX_SIZE and the header and extra each take no more than
+ * TX_EXTRA_MAX_SIZE. This, and not a fixed number of inputs or outputs, is what limits the transaction
+ * @param footprint where the result goes
+ * @param input_count
+ * @param output_count
+ * @param ring_size
+ * @param offset_size the largest varint that a ring offset may take
+ * @param seal_inputs whether the pre-signature state of the inputs is sealed and held by the host
+ */
+void tx_footprint(
+    tx_footprint_t *footprint,
+    const uint8_t input_count,
+    const uint8_t output_count,
+    const uint8_t ring_size,
+    const uint8_t offset_size,
+    const uint8_t seal_inputs)
+{
+    const uint32_t input_size = tx_input_size(VARINT_MAX_SIZE, ring_size, ring_size * offset_size);
+
+    const uint32_t output_size = tx_output_size(VARINT_MAX_SIZE);
+
+    const uint32_t signatures_size = input_count * ring_size * SIG_SIZE;
+
+    // sealed inputs are not kept in the pool so only the size of the transaction limits them
+    const uint32_t pre_signature_size = (seal_inputs == 1) ? 0 : TX_PRE_SIGNATURE_SIZE;
+
+    const uint32_t input_footprint = input_size + (ring_size * SIG_SIZE) + pre_signature_size;
+
+    const uint32_t fixed_size = (output_count * output_size) + TX_EXTRA_MAX_SIZE + TX_EXTRA_MAX_SIZE;
+
+    footprint->pool_size = (input_count * input_footprint) + fixed_size;
+
+    footprint->fits = footprint->pool_size <= TX_POOL_SIZE;
+
+    footprint->max_inputs = 0;
+
+    if (fixed_size < TX_POOL_SIZE)
+    {
+        const uint32_t max_inputs = (TX_POOL_SIZE - fixed_size) / input_footprint;
+
+        footprint->max_inputs = (max_inputs < TX_MAX_INPUTS) ? max_inputs : TX_MAX_INPUTS;
+    }
+
+    /**
+     * The transaction is built in RAM if everything it would ever store fits there: the largest the prefix
+     * could be, its signatures and the precomputed terms at its end, then the pre-signatures and the info
+     * that sit behind it
+     */
+    footprint->ram_size = TX_EXTRA_TAG_SIZE + 10 + 2 + 1 + (input_count * input_size)
+                          + (output_count * output_size) + TX_EXTRA_MAX_SIZE + signatures_size
+                          + sizeof(transaction_info_t) + (input_count * pre_signature_size);
+
+    if (NONCE_DRBG == 1)
+    {
+        footprint->ram_size += signatures_size;
+    }
+
+    footprint->in_ram = footprint->ram_size <= TX_RAM_SIZE;
+}
+
+/**
+ * Returns the transaction network fee
+ */
+uint64_t tx_fee()
+{
+    return (tx_input_amount() - tx_output_amount());
+}
+
+/**
+ * Finalizes a transaction prefix by constructing the TX_EXTRA field
+ */
+uint16_t tx_finalize_prefix()
+{
+    PROFILE_SCOPE();
+
+    // check to make sure we are in the correct state
+    if (tx_state() != TX_OUTPUTS_RECEIVED)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    // Are we trying to create more in outputs than we supplied in inputs?
+    if (tx_output_amount() > tx_input_amount())
+    {
+        return ERR_TX_AMOUNT;
+    }
+
+    unsigned char extra[TX_EXTRA_MAX_SIZE] = {0};
+
+    unsigned int pos = 0;
+
+    // figure out how long the extra field will be
+    {
+        unsigned int extra_size = TX_EXTRA_TAG_SIZE + KEY_SIZE; // include the public key at minimum
+
+        if (L_transaction.has_payment_id == 1)
+        {
+            // nonce_tag + size + paymentid_tag + key
+            extra_size += TX_EXTRA_TAG_SIZE + TX_EXTRA_TAG_SIZE + TX_EXTRA_TAG_SIZE + KEY_SIZE;
+        }
+
+        pos = encode_varint(extra, extra_size, sizeof(extra));
+    }
+
+    // write the tx public key to extra
+    {
+        unsigned char tag = TX_EXTRA_PUBKEY_TAG;
+
+        os_memmove(extra + pos, &tag, TX_EXTRA_TAG_SIZE);
+
+        pos += TX_EXTRA_TAG_SIZE;
+
+        os_memmove(extra + pos, TX_INFO->tx_public_key, KEY_SIZE);
+
+        pos += KEY_SIZE;
+    }
+
+    if (L_transaction.has_payment_id == 1)
+    {
+        // write the nonce tag to extra
+        {
+            unsigned char tag = TX_EXTRA_NONCE_TAG;
+
+            os_memmove(extra + pos, &tag, TX_EXTRA_TAG_SIZE);
+
+            pos += TX_EXTRA_TAG_SIZE;
+        }
+
+        // write the size of the nonce field in extra
+        {
+            pos += encode_varint(extra + pos, TX_EXTRA_TAG_SIZE + KEY_SIZE, TX_EXTRA_TAG_SIZE);
+        }
+
+        // write the payment id key to extra
+        {
+            unsigned char tag = TX_EXTRA_NONCE_PAYMENT_ID_TAG;
+
+            os_memmove(extra + pos, &tag, TX_EXTRA_TAG_SIZE);
+
+            pos += TX_EXTRA_TAG_SIZE;
+
+            os_memmove(extra + pos, TX_INFO->payment_id, KEY_SIZE);
+
+            pos += KEY_SIZE;
+        }
+    }
+
+    // batch write to NVRAM
+    TX_WRITE(extra, pos);
+
+    // the hash of the whole transaction carries on from the prefix if the signatures are streamed
+    os_memmove(&L_tx_context, &L_prefix_context, sizeof(L_tx_context));
+
+    // the prefix is complete so its hash is ready before we are asked to sign
+    hw_keccak_final(&L_prefix_context, L_prefix_hash);
+
+    L_tx_prefix_size = L_transaction.current_position;
+
+    L_transaction.state = TX_PREFIX_READY;
+
+    tx_checkpoint();
+
+    explicit_bzero(extra, sizeof(extra));
+
+
+    return OP_OK;
+}
+
+/**
+ * Returns if the transaction uses a payment id
+ */
+unsigned int tx_has_payment_id()
+{
+    return (unsigned int)L_transaction.has_payment_id;
+}
+
+/**
+ * Returns the transaction hash
+ * @param hash the pointer to put the hash into
+ */
+uint16_t tx_hash(unsigned char *hash)
+{
+    PROFILE_SCOPE();
+
+    if (L_transaction.stream_signatures == 1)
+    {
+        // the signatures were never stored so the hash was taken as they were produced
+        os_memmove(hash, L_tx_hash, KEY_SIZE);
+
+        return OP_OK;
+    }
+
+    return hw_keccak(TX_RAW, L_transaction.current_position, hash);
+}
+
+/**
+ * Returns the number of inputs in the transaction
+ */
+uint8_t tx_input_count()
+{
+    return L_transaction.input_count;
+}
+
+/**
+ * Returns the total amount of the inputs
+ */
+uint64_t tx_input_amount()
+{
+    return L_transaction.total_input_amount;
+}
+
+/**
+ * Computes the terms (L and R) of every member of the ring of the input being loaded and
+ * stores them at the end of the raw transaction. None of them depend on the prefix hash so
+ * this moves the point arithmetic out of tx_sign, which only has to expand the same mixin
+ * scalars from the nonce source again and hash the stored terms
+ * @param input_index the input being loaded
+ * @param public_keys the public keys of the ring
+ * @param key_image the key image of the input
+ * @param real_output_index the index of the real output in the public_keys
+ */
+static uint16_t tx_precompute_input(
+    const uint8_t input_index,
+    const unsigned char *public_keys,
+    const unsigned char *key_image,
+    const uint8_t real_output_index)
+{
+    // the nonces are expanded again from the same seed by tx_sign
+    if (hw_nonce_drbg_domain(input_index) != OP_OK)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    hw_ring_signer_t signer;
+
+    unsigned char signature[SIG_SIZE];
+
+    unsigned char terms[SIG_SIZE];
+
+    const uint16_t position = TX_TERMS_POSITION(input_index);
+
+    uint16_t status = hw__ring_signer_init(&signer, NULL, key_image);
+
+    uint8_t i;
+    for (i = 0; i < L_transaction.ring_size && status == OP_OK; i++)
+    {
+        status = hw__ring_signer_terms(
+            &signer, signature, terms, public_keys + (i * KEY_SIZE), i == real_output_index);
+
+        if (status == OP_OK && L_transaction.in_ram == 1)
+        {
+            os_memmove(L_tx_ram + position + (i * SIG_SIZE), terms, SIG_SIZE);
+        }
+        else if (status == OP_OK)
+        {
+            tx_back_written(position);
+
+            nvram_write((void *)N_tx_pool + position + (i * SIG_SIZE), (void *)terms, SIG_SIZE);
+        }
+    }
+
+    hw_nonce_drbg_pause();
+
+    explicit_bzero(signature, sizeof(signature));
+
+    return tx_wipe(&signer, sizeof(signer), status);
+}
+
+/**
+ * Runs the checks that an input has to pass before it is appended: that the output being spent is
+ * one of the ring members and that it belongs to us, in which case its private ephemeral and key
+ * image are derived, and if the host gave a key image, that it is the one derived
+ * @param private_ephemeral where the private ephemeral goes, wiped if a check fails
+ * @param key_image where the derived key image goes, wiped if a check fails
+ * @param tx_public_key
+ * @param output_index
+ * @param public_keys
+ * @param ring_size
+ * @param real_output_index
+ * @param expected_key_image the key image the host put in the prefix, or NULL
+ */
+static uint16_t tx_derive_input(
+    unsigned char *private_ephemeral,
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const unsigned char *public_keys,
+    const uint8_t ring_size,
+    const uint8_t real_output_index,
+    const unsigned char *expected_key_image)
+{
+    // make sure that the output being spent is actually one of the ring members
+    if (real_output_index >= ring_size)
+    {
+        return ERR_INPUT_NOT_IN_SET;
+    }
+
+    /**
+     * Derive the private ephemeral and the key image for the output being spent in one pass,
+     * this also makes sure that the output key in the position specified belongs to us
+     */
+    uint16_t status = hw__derive_input_keys(
+        private_ephemeral,
+        key_image,
+        tx_public_key,
+        output_index,
+        public_keys + (real_output_index * KEY_SIZE),
+        PTR_VIEW_PRIVATE8,
+        PTR_SPEND_PRIVATE);
+
+    if (status == OP_OK && expected_key_image != NULL && os_memcmp(expected_key_image, key_image, KEY_SIZE) != 0)
+    {
+        status = ERR_TX_KEY_IMAGE;
+    }
+
+    if (status != OP_OK)
+    {
+        explicit_bzero(private_ephemeral, KEY_SIZE);
+
+        explicit_bzero(key_image, KEY_SIZE);
+    }
+
+    return status;
+}
+
+/**
+ * Checks an input as tx_load_input would without loading it, the transaction (if any) is left as
+ * it is and nothing is written to NVRAM
+ * @param key_image where the key image of the input goes (KEY_SIZE), zero if a check fails
+ * @param tx_public_key
+ * @param output_index
+ * @param public_keys
+ * @param ring_size
+ * @param real_output_index
+ */
+uint16_t tx_check_input(
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const unsigned char *public_keys,
+    const uint8_t ring_size,
+    const uint8_t real_output_index)
+{
+    unsigned char private_ephemeral[KEY_SIZE];
+
+    const uint16_t status = tx_derive_input(
+        private_ephemeral, key_image, tx_public_key, output_index, public_keys, ring_size, real_output_index, NULL);
+
+    explicit_bzero(private_ephemeral, sizeof(private_ephemeral));
+
+    return status;
+}
+
+/**
+ * Appends an input to the transaction prefix once the key image checks out against its own derivation
+ * and keeps what is needed to sign it later, both ways of loading an input end up here
+ * @param tx_public_key
+ * @param output_index
+ * @param amount
+ * @param public_keys
+ * @param real_output_index
+ * @param record the input as it goes in the prefix, its last KEY_SIZE bytes are the key image that the
+ *     host put in the prefix or, if there is none, where the derived one goes
+ * @param record_size the size of the input including its key image
+ * @param has_key_image whether the host put the key image in the record
+ * @param sealed_input where the sealed pre-signature state goes when the host holds it (TX_SEALED_INPUT_SIZE)
+ */
+static uint16_t tx_append_input(
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const uint64_t amount,
+    const unsigned char *public_keys,
+    const uint8_t real_output_index,
+    unsigned char *record,
+    const size_t record_size,
+    const bool has_key_image,
+    unsigned char *sealed_input)
+{
+    transaction_input_t tx_input; // 65-bytes
+
+    unsigned char *key_image = record + record_size - KEY_SIZE;
+
+    const uint16_t status = tx_derive_input(
+        tx_input.private_ephemeral,
+        tx_input.key_image,
+        tx_public_key,
+        output_index,
+        public_keys,
+        L_transaction.ring_size,
+        real_output_index,
+        (has_key_image) ? key_image : NULL);
+
+    if (status != OP_OK)
+    {
+        return tx_wipe(&tx_input, sizeof(transaction_input_t), status);
+    }
 
-            // write the key image to the transaction prefix
+    if (NONCE_DRBG == 1)
+    {
+        const uint16_t precompute_status = tx_precompute_input(
+            L_transaction.received_input_count, public_keys, tx_input.key_image, real_output_index);
+
+        if (precompute_status != OP_OK)
+        {
+            return tx_wipe(&tx_input, sizeof(transaction_input_t), precompute_status);
+        }
+    }
+
+    /**
+     * Without precomputed terms the ring is resent to sign the input so its members are warmed up in
+     * the ring point cache between requests, as many as the queue has room for
+     */
+    if (NONCE_DRBG != 1)
+    {
+        uint8_t i;
+        for (i = 0; i < L_transaction.ring_size; i++)
+        {
+            if (!idle_post(hw__ring_member_warm, public_keys + (i * KEY_SIZE)))
             {
-                os_memmove(tx + pos, tx_input.key_image, KEY_SIZE);
+                break;
+            }
+        }
+    }
+
+    // the input goes in the prefix with its key image in a single write
+    if (!has_key_image)
+    {
+        os_memmove(key_image, tx_input.key_image, KEY_SIZE);
+    }
+
+    TX_WRITE_PTR(record, record_size);
+
+    L_transaction.total_input_amount += amount;
+
+    tx_review_update();
+
+    /**
+     * There's some information that we need to save off for when we generate the
+     * ring signatures at the end of the transaction construction process
+     * these parts are not included in the transaction itself that is broadcasted
+     * to the network so we'll throw them over in NVRAM as a nice structure for
+     * later when we need them as we need to limit RAM usage
+     */
+    {
+        tx_input.real_output_index = real_output_index;
+
+        // only a commitment to the ring is kept, the host resends the ring if it is needed to sign
+        hw_keccak(public_keys, L_transaction.ring_size * KEY_SIZE, tx_input.ring_commitment);
+
+        if (L_transaction.seal_inputs == 1)
+        {
+            // the host holds on to it for us instead so nothing more of the input is written
+            hw_seal(
+                sealed_input,
+                (unsigned char *)&tx_input,
+                sizeof(transaction_input_t),
+                L_seal_key,
+                L_transaction.received_input_count);
+        }
+        else if (L_transaction.in_ram == 1)
+        {
+            os_memmove(TX_PRE_SIGNATURE(L_transaction.received_input_count), &tx_input, sizeof(transaction_input_t));
+        }
+        else
+        {
+            PRE_SIG_WRITE(tx_input);
+        }
+    }
+
+    L_transaction.received_input_count++;
+
+    // if we've now received all of the inputs that we expected, change the transaction state
+    if (L_transaction.received_input_count == L_transaction.input_count)
+    {
+        L_transaction.state = TX_INPUTS_RECEIVED;
+
+        L_transaction.inputs_end = L_transaction.current_position;
+    }
+
+    // every input is checkpointed as loading them is where the bulk of the work is
+    tx_checkpoint();
+
+    return tx_wipe(&tx_input, sizeof(transaction_input_t), OP_OK);
+}
+
+/**
+ * Appends an output to the transaction prefix
+ * @param serialized the output as it goes in the prefix
+ * @param serialized_size the size of the serialized output
+ * @param amount
+ */
+static uint16_t tx_append_output(const unsigned char *serialized, const size_t serialized_size, const uint64_t amount)
+{
+    // batch write to NVRAM
+    TX_WRITE_PTR(serialized, serialized_size);
+
+    L_transaction.total_output_amount += amount;
+
+    tx_review_update();
+
+    L_transaction.received_output_count++;
+
+    // if we have now received all of the outputs that we were expecting update the transaction state
+    if (L_transaction.received_output_count == L_transaction.output_count)
+    {
+        L_transaction.state = TX_OUTPUTS_RECEIVED;
+
+        tx_checkpoint();
+
+        // the last output is all that the prefix was waiting for
+        if (L_transaction.auto_advance == 1)
+        {
+            return tx_finalize_prefix();
+        }
+    }
+
+    return OP_OK;
+}
+
+/**
+ * Serializes the start of an input, type || amount || ring_size, in front of its offsets
+ * @param record where the input goes (TX_INPUT_MAX_SIZE)
+ * @param amount
+ * @returns the size of what was written
+ */
+static unsigned int tx_serialize_input(unsigned char *record, const uint64_t amount)
+{
+    unsigned int pos = 0;
+
+    record[pos] = 0x02;
+
+    pos += TX_EXTRA_TAG_SIZE;
+
+    pos += encode_varint(record + pos, amount, VARINT_MAX_SIZE);
+
+    pos += encode_varint(record + pos, L_transaction.ring_size, VARINT_MAX_SIZE);
+
+    return pos;
+}
+
+/**
+ * Loads a transaction input
+ * @param tx_public_key
+ * @param output_index
+ * @param amount
+ * @param public_keys
+ * @param offsets
+ * @param real_output_index
+ * @param sealed_input where the sealed pre-signature state goes when the host holds it (TX_SEALED_INPUT_SIZE)
+ */
+uint16_t tx_load_input(
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const uint64_t amount,
+    const unsigned char *public_keys,
+    const uint32_t *offsets,
+    const uint8_t real_output_index,
+    unsigned char *sealed_input)
+{
+    PROFILE_SCOPE();
+
+    if (tx_state() == TX_READY && L_transaction.auto_advance == 1)
+    {
+        tx_start_input_load();
+    }
+
+    // return an error if we are not in the correct state
+    if (tx_state() != TX_RECEIVING_INPUTS)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    // the offsets are no larger than tx_start sized the transaction for, which bounds the size of the input
+    unsigned int offsets_size = 0;
+
+    uint8_t i;
+    for (i = 0; i < L_transaction.ring_size; i++)
+    {
+        const unsigned int size = varint_size(offsets[i]);
+
+        if (size > L_transaction.offset_size)
+        {
+            return ERR_TX_OFFSET_SIZE;
+        }
+
+        offsets_size += size;
+    }
+
+    unsigned char tx[TX_INPUT_MAX_SIZE]; // 104-bytes
+
+    const size_t size = tx_input_size(varint_size(amount), L_transaction.ring_size, offsets_size);
+
+    unsigned int pos = tx_serialize_input(tx, amount);
+
+    for (i = 0; i < L_transaction.ring_size; i++)
+    {
+        pos += encode_varint(tx + pos, offsets[i], size - pos);
+    }
+
+    // the key image follows once it is derived
+    const uint16_t status = tx_append_input(
+        tx_public_key, output_index, amount, public_keys, real_output_index, tx, size, false, sealed_input);
+
+    explicit_bzero(tx, sizeof(tx));
+
+    return status;
+}
+
+/**
+ * Loads a transaction input whose offsets come already encoded as the varints of the prefix,
+ * they are checked and copied into the prefix as they are
+ * @param tx_public_key
+ * @param output_index
+ * @param amount
+ * @param public_keys
+ * @param offsets the varint of every offset of the ring one after the other
+ * @param offsets_length the size of the offsets
+ * @param real_output_index
+ * @param sealed_input where the sealed pre-signature state goes when the host holds it (TX_SEALED_INPUT_SIZE)
+ */
+uint16_t tx_load_encoded_input(
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const uint64_t amount,
+    const unsigned char *public_keys,
+    const unsigned char *offsets,
+    const uint8_t offsets_length,
+    const uint8_t real_output_index,
+    unsigned char *sealed_input)
+{
+    PROFILE_SCOPE();
+
+    if (tx_state() == TX_READY && L_transaction.auto_advance == 1)
+    {
+        tx_start_input_load();
+    }
+
+    if (tx_state() != TX_RECEIVING_INPUTS)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    // the offsets are held to exactly what tx_load_input would have written for them
+    {
+        uint64_t value = 0;
+
+        unsigned int size = 0;
+
+        uint8_t pos = 0;
+
+        uint8_t i;
+        for (i = 0; i < L_transaction.ring_size; i++)
+        {
+            if ((size = decode_canonical_varint(offsets + pos, offsets_length - pos, &value)) == 0
+                || value > UINT32_MAX)
+            {
+                return ERR_TX_LOAD_INPUT;
+            }
+
+            if (size > L_transaction.offset_size)
+            {
+                return ERR_TX_OFFSET_SIZE;
+            }
+
+            pos += size;
+        }
+
+        if (pos != offsets_length)
+        {
+            return ERR_TX_LOAD_INPUT;
+        }
+    }
+
+    unsigned char tx[TX_INPUT_MAX_SIZE]; // 104-bytes
+
+    const size_t size = tx_input_size(varint_size(amount), L_transaction.ring_size, offsets_length);
+
+    // the offsets follow as they came
+    const unsigned int pos = tx_serialize_input(tx, amount);
+
+    os_memmove(tx + pos, offsets, offsets_length);
+
+    const uint16_t status = tx_append_input(
+        tx_public_key, output_index, amount, public_keys, real_output_index, tx, size, false, sealed_input);
+
+    explicit_bzero(tx, sizeof(tx));
+
+    return status;
+}
+
+/**
+ * Loads an output into the transaction
+ * @param amount
+ * @param key
+ */
+uint16_t tx_load_output(const uint64_t amount, const unsigned char *key)
+{
+    PROFILE_SCOPE();
+
+    // the first output comes with the number of outputs
+    if (tx_state() == TX_INPUTS_RECEIVED && L_transaction.auto_advance == 1)
+    {
+        tx_start_output_load();
+    }
+
+    if (tx_state() != TX_RECEIVING_OUTPUTS)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    unsigned char tx[TX_OUTPUT_MAX_SIZE]; // 43-bytes
+
+    const size_t size = tx_output_size(varint_size(amount));
+
+    // amount || type || key
+    unsigned int pos = encode_varint(tx, amount, size);
+
+    tx[pos] = 0x02;
+
+    pos += TX_EXTRA_TAG_SIZE;
+
+    os_memmove(tx + pos, key, KEY_SIZE);
+
+    const uint16_t status = tx_append_output(tx, size, amount);
+
+    explicit_bzero(tx, sizeof(tx));
+
+
+    return status;
+}
+
+/**
+ * Loads several outputs into the transaction at once, none of them are loaded unless they
+ * all fit in what is left of the outputs the transaction was started with
+ * @param count the number of outputs
+ * @param amounts the amount of every output
+ * @param keys the key of every output one after the other
+ */
+uint16_t tx_load_outputs(const uint8_t count, const uint64_t *amounts, const unsigned char *keys)
+{
+    PROFILE_SCOPE();
+
+    const uint8_t state = tx_state();
+
+    if (state != TX_RECEIVING_OUTPUTS && (state != TX_INPUTS_RECEIVED || L_transaction.auto_advance != 1))
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    if (count == 0 || count > L_transaction.output_count - L_transaction.received_output_count)
+    {
+        return ERR_TX_INPUT_OUTPUT_OUT_OF_RANGE;
+    }
+
+    uint16_t status = OP_OK;
+
+    uint8_t i;
+    for (i = 0; i < count && status == OP_OK; i++)
+    {
+        status = tx_load_output(amounts[i], keys + (i * KEY_SIZE));
+    }
+
+    return status;
+}
+
+/**
+ * Loads the next input of the streamed prefix, what the device needs to check the key image against
+ * its own derivation comes first and is not part of the prefix
+ * @param data the streamed prefix
+ * @param length how much of the stream is left
+ * @param consumed where the size of the witnessed input goes
+ * @param sealed_input where the sealed pre-signature state goes when the host holds it (TX_SEALED_INPUT_SIZE)
+ */
+static uint16_t tx_stream_input(
+    const unsigned char *data,
+    const uint16_t length,
+    uint16_t *consumed,
+    unsigned char *sealed_input)
+{
+    // tx_public_key || output_index || real_output_index || public_keys
+    const uint16_t witness_size = KEY_SIZE + sizeof(uint8_t) + sizeof(uint8_t) + (L_transaction.ring_size * KEY_SIZE);
+
+    if (length < witness_size)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    const unsigned char *serialized = data + witness_size;
+
+    const uint16_t available = length - witness_size;
+
+    uint16_t pos = 0;
+
+    uint64_t amount = 0;
+
+    uint64_t value = 0;
+
+    unsigned int size = 0;
+
+    // the input type
+    if (available < TX_EXTRA_TAG_SIZE || serialized[pos] != 0x02)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    pos += TX_EXTRA_TAG_SIZE;
+
+    // the input amount
+    if ((size = decode_canonical_varint(serialized + pos, available - pos, &amount)) == 0)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    pos += size;
+
+    // the number of global index offsets
+    if ((size = decode_canonical_varint(serialized + pos, available - pos, &value)) == 0
+        || value != L_transaction.ring_size)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    pos += size;
+
+    // the offsets are held to what tx_load_input takes as tx_start sized the transaction for those
+    uint8_t i;
+    for (i = 0; i < L_transaction.ring_size; i++)
+    {
+        if ((size = decode_canonical_varint(serialized + pos, available - pos, &value)) == 0 || value > UINT32_MAX)
+        {
+            return ERR_TX_PREFIX;
+        }
+
+        if (size > L_transaction.offset_size)
+        {
+            return ERR_TX_OFFSET_SIZE;
+        }
+
+        pos += size;
+    }
+
+    if (available - pos < KEY_SIZE)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    *consumed = witness_size + pos + KEY_SIZE;
+
+    // the key image is only read, the input goes in the prefix as the host streamed it
+    return tx_append_input(
+        data,
+        data[KEY_SIZE],
+        amount,
+        data + KEY_SIZE + sizeof(uint8_t) + sizeof(uint8_t),
+        data[KEY_SIZE + sizeof(uint8_t)],
+        (unsigned char *)serialized,
+        pos + KEY_SIZE,
+        true,
+        sealed_input);
+}
+
+/**
+ * Loads the number of outputs of the streamed prefix
+ * @param data the streamed prefix
+ * @param length how much of the stream is left
+ * @param consumed where the size of the varint goes
+ */
+static uint16_t tx_stream_output_count(const unsigned char *data, const uint16_t length, uint16_t *consumed)
+{
+    uint64_t value = 0;
+
+    const unsigned int size = decode_canonical_varint(data, length, &value);
+
+    if (size == 0 || value != L_transaction.output_count)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    *consumed = size;
+
+    // that is exactly what is written here
+    return tx_start_output_load();
+}
+
+/**
+ * Loads the next output of the streamed prefix
+ * @param data the streamed prefix
+ * @param length how much of the stream is left
+ * @param consumed where the size of the output goes
+ */
+static uint16_t tx_stream_output(const unsigned char *data, const uint16_t length, uint16_t *consumed)
+{
+    uint64_t amount = 0;
+
+    const unsigned int size = decode_canonical_varint(data, length, &amount);
+
+    // amount || type || key
+    if (size == 0 || length - size < TX_EXTRA_TAG_SIZE + KEY_SIZE || data[size] != 0x02)
+    {
+        return ERR_TX_PREFIX;
+    }
+
+    *consumed = size + TX_EXTRA_TAG_SIZE + KEY_SIZE;
+
+    return tx_append_output(data, *consumed, amount);
+}
+
+/**
+ * Loads a chunk of the serialized transaction prefix that carries on from what tx_start wrote: the
+ * inputs, the number of outputs and the outputs. Each input is preceded by a witness that is not part
+ * of the prefix (tx_public_key || output_index || real_output_index || public_keys) so that its key image
+ * is checked against its own derivation, the totals are added up as the amounts go by and every element is
+ * hashed as it is written. A chunk holds whole elements only, when the inputs are sealed it holds one input
+ * at most as there is only room to return a single sealed input. Each element is loaded as it is read so
+ * those in front of one that fails stay loaded (see tx_received_input_count and tx_received_output_count)
+ * @param data the chunk
+ * @param length the size of the chunk
+ * @param sealed_input where the sealed pre-signature state goes when the host holds it (TX_SEALED_INPUT_SIZE)
+ */
+uint16_t tx_load_prefix(const unsigned char *data, const uint16_t length, unsigned char *sealed_input)
+{
+    PROFILE_SCOPE();
+
+    if (tx_state() == TX_READY)
+    {
+        tx_start_input_load();
+    }
+
+    const uint8_t first_input = L_transaction.received_input_count;
+
+    uint16_t pos = 0;
+
+    while (pos < length)
+    {
+        uint16_t consumed = 0;
+
+        uint16_t status = ERR_TX_PREFIX;
+
+        switch (tx_state())
+        {
+            case TX_RECEIVING_INPUTS:
+                if (L_transaction.seal_inputs != 1 || L_transaction.received_input_count == first_input)
+                {
+                    status = tx_stream_input(data + pos, length - pos, &consumed, sealed_input);
+                }
+                break;
+
+            case TX_INPUTS_RECEIVED:
+                status = tx_stream_output_count(data + pos, length - pos, &consumed);
+                break;
+
+            case TX_RECEIVING_OUTPUTS:
+                status = tx_stream_output(data + pos, length - pos, &consumed);
+                break;
+
+            default:
+                // nothing follows the last output, the prefix may even be finalized already
+                break;
+        }
+
+        if (status != OP_OK)
+        {
+            return status;
+        }
+
+        pos += consumed;
+    }
+
+    return OP_OK;
+}
+
+/**
+ * Returns the total amount of the outputs
+ */
+uint64_t tx_output_amount()
+{
+    return L_transaction.total_output_amount;
+}
+
+/**
+ * Returns the payment id information
+ */
+void tx_payment_id(unsigned char *payment_id)
+{
+    os_memmove(payment_id, TX_INFO->payment_id, KEY_SIZE);
+}
+
+/**
+ * Returns the hash of the transaction prefix once it has been finalized
+ * @param hash the pointer to put the hash into
+ */
+uint16_t tx_prefix_hash(unsigned char *hash)
+{
+    PROFILE_SCOPE();
+
+    os_memmove(hash, L_prefix_hash, KEY_SIZE);
+
+    return OP_OK;
+}
+
+/**
+ * Returns the size of the transaction prefix once it has been finalized
+ */
+uint16_t tx_prefix_size()
+{
+    return L_tx_prefix_size;
+}
+
+/**
+ * Returns the number of inputs that have been loaded so far
+ */
+uint8_t tx_received_input_count()
+{
+    return L_transaction.received_input_count;
+}
+
+/**
+ * Returns the number of outputs that have been loaded so far
+ */
+uint8_t tx_received_output_count()
+{
+    return L_transaction.received_output_count;
+}
+
+/**
+ * Rolls the transaction back to where it stood once its inputs were loaded so that its outputs can be
+ * loaded again, for a different fee or different outputs, without loading the inputs again. The prefix
+ * is cut back to its inputs and hashed again as tx_resume does, the output totals start over and the
+ * pre-signatures and precomputed terms of the inputs are left as they are.
+ *
+ * The nonces expand from the seed of the transaction (NONCE_DRBG) so an input is always signed with
+ * the same k, signing it again for the prefix hash of other outputs would hand out two signatures
+ * with the same k and different challenges, which gives away its private ephemeral. The rollback is
+ * thus refused for good once signing has started, even if tx_resume took the transaction back to
+ * TX_PREFIX_READY since
+ */
+uint16_t tx_reload_outputs()
+{
+    PROFILE_SCOPE();
+
+    if (tx_state() < TX_INPUTS_RECEIVED || tx_state() > TX_PREFIX_READY || L_transaction.signing_started == 1)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    L_transaction.current_position = L_transaction.inputs_end;
+
+    L_transaction.total_output_amount = 0;
+
+    L_transaction.received_output_count = 0;
+
+    L_transaction.state = TX_INPUTS_RECEIVED;
+
+    L_tx_prefix_size = 0;
+
+    explicit_bzero(L_prefix_hash, sizeof(L_prefix_hash));
+
+    explicit_bzero(L_tx_hash, sizeof(L_tx_hash));
+
+    // the inputs were committed when the last of them was checkpointed, the page picks up from there
+    L_tx_page_start = L_transaction.current_position - (L_transaction.current_position % TX_PAGE_SIZE);
+
+    os_memmove(L_tx_page, TX_RAW + L_tx_page_start, L_transaction.current_position - L_tx_page_start);
+
+    hw_keccak_init(&L_prefix_context);
+
+    hw_keccak_update(&L_prefix_context, TX_RAW, L_transaction.current_position);
+
+    tx_review_update();
+
+    tx_checkpoint();
+
+    return OP_OK;
+}
+
+/**
+ * Resets the internal transaction state of the device
+ */
+uint16_t tx_reset()
+{
+    PROFILE_SCOPE();
+
+    TX_RESET();
+
+    // transactions that were built in RAM leave nothing behind here
+    if (TX_WRITTEN.state)
+    {
+        TX_INFO_RESET();
+
+        TX_CHECKPOINT_RESET();
+
+        TX_WRITTEN.state = false;
+    }
+
+    // the cached derivations only live for a single transaction session, or a batch of them
+    if (!batch_active())
+    {
+        cache_reset();
+    }
+
+    // as does the seed of the nonces
+    hw_nonce_drbg_stop();
+
+    // and the work that was queued for it
+    idle_cancel();
+
+    // and whatever was signed ahead of an approval that never came
+    explicit_bzero(&L_tx_speculation, sizeof(L_tx_speculation));
+
+    // and the key that the host held inputs were sealed under
+    explicit_bzero(L_seal_key, sizeof(L_seal_key));
+
+    if (init_tx() != 0)
+    {
+        return ERR_TX_RESET;
+    }
+
+    return OP_OK;
+}
+
+/**
+ * Resumes the transaction session that was checkpointed before the device was reset or the app
+ * was restarted, what only lived in RAM is rebuilt from the raw transaction in NVRAM so that
+ * none of the inputs that were loaded have to be loaded again. None of the signing progress is
+ * checkpointed so a transaction that was being signed resumes with its prefix ready to sign again,
+ * unless its signatures were streamed to the host, that checkpoint is dropped instead
+ */
+uint16_t tx_resume()
+{
+    PROFILE_SCOPE();
+
+    if (tx_state() != TX_UNUSED)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    if (N_tx_checkpoint->transaction.state == TX_UNUSED)
+    {
+        return ERR_TX_RESUME;
+    }
+
+    os_memmove(&L_transaction, (void *)&N_tx_checkpoint->transaction, sizeof(transaction_t));
+
+    L_tx_prefix_size = N_tx_checkpoint->prefix_size;
+
+    L_tx_capacity = tx_pool_capacity();
+
+    // a parked transaction kept everything so it picks up exactly where it was
+    const bool parked = (N_tx_checkpoint->parked == 1);
+
+    if (L_transaction.state == TX_SIGNING && !parked)
+    {
+        // streamed signatures have left the device without being kept so the transaction cannot be finished
+        // from here, the checkpoint is dropped along with the seed that their nonces expanded from
+        if (L_transaction.stream_signatures == 1)
+        {
+            TX_CHECKPOINT_RESET();
+
+            init_tx();
+
+            L_tx_prefix_size = 0;
+
+            return ERR_TX_RESUME;
+        }
+
+        const uint32_t signatures_size = L_transaction.input_count * L_transaction.ring_size * SIG_SIZE;
+
+        // stored signatures may have overwritten the precomputed terms (see TX_TERMS_POSITION) of what was signed
+        if (NONCE_DRBG == 1 && L_tx_prefix_size + signatures_size > L_tx_capacity - signatures_size)
+        {
+            init_tx();
+
+            L_tx_prefix_size = 0;
+
+            return ERR_TX_RESUME;
+        }
+
+        L_transaction.current_position = L_tx_prefix_size;
+
+        L_transaction.signed_input_count = 0;
+
+        L_transaction.state = TX_PREFIX_READY;
+    }
+
+    // the page that appends are staged in picks up from what was committed
+    L_tx_page_start = L_transaction.current_position - (L_transaction.current_position % TX_PAGE_SIZE);
+
+    os_memmove(
+        L_tx_page,
+        (unsigned char *)N_tx_pool + L_tx_page_start,
+        L_transaction.current_position - L_tx_page_start);
+
+    const bool prefix_ready = (L_transaction.state == TX_PREFIX_READY || L_transaction.state == TX_COMPLETE);
+
+    if (parked)
+    {
+        os_memmove(L_prefix_hash, (void *)N_tx_parking->prefix_hash, KEY_SIZE);
+
+        os_memmove(&L_prefix_context, (void *)&N_tx_parking->prefix_context, sizeof(hw_keccak_t));
+
+        os_memmove(&L_tx_context, (void *)&N_tx_parking->tx_context, sizeof(hw_keccak_t));
+
+        // the signing progress moves on from here without being checkpointed so the parking is used up
+        const uint8_t unparked = 0;
+
+        nvram_write((void *)&N_tx_checkpoint->parked, (void *)&unparked, sizeof(uint8_t));
+    }
+    else
+    {
+        // the prefix is hashed again as it was hashed when it was written
+        hw_keccak_init(&L_prefix_context);
+
+        hw_keccak_update(
+            &L_prefix_context,
+            (unsigned char *)N_tx_pool,
+            prefix_ready ? L_tx_prefix_size : L_transaction.current_position);
+
+        if (prefix_ready)
+        {
+            os_memmove(&L_tx_context, &L_prefix_context, sizeof(L_tx_context));
+
+            hw_keccak_final(&L_prefix_context, L_prefix_hash);
+        }
+    }
+
+    // the nonces expand from the same seed so that the precomputed terms still match them
+    if (L_transaction.state != TX_COMPLETE)
+    {
+        hw_nonce_drbg_restore((unsigned char *)N_tx_checkpoint->nonce_seed);
+    }
+
+    os_memmove(L_seal_key, (void *)N_tx_checkpoint->seal_key, KEY_SIZE);
+
+    os_memmove(L_tx_hash, (void *)N_tx_checkpoint->tx_hash, KEY_SIZE);
+
+    tx_review_update();
+
+    return OP_OK;
+}
+
+/**
+ * Copies out the total amount spent and the network fee as they are shown for review
+ * @param amount where the amount goes (TX_REVIEW_TEXT_SIZE)
+ * @param fee where the fee goes (TX_REVIEW_TEXT_SIZE)
+ */
+void tx_review_text(unsigned char *amount, unsigned char *fee)
+{
+    os_memmove(amount, L_tx_review.amount, TX_REVIEW_TEXT_SIZE);
+
+    os_memmove(fee, L_tx_review.fee, TX_REVIEW_TEXT_SIZE);
+}
+
+/**
+ * Returns the number of members in each ring of the transaction
+ */
+uint8_t tx_ring_size()
+{
+    return L_transaction.ring_size;
+}
+
+/**
+ * Generates the ring signatures for a single input and commits them to the transaction,
+ * the signatures pass through the given staging area a window at a time so that the memory
+ * used does not depend on the size of the ring
+ * @param input_index the input to sign
+ * @param input the pre-signature state of the input
+ * @param public_keys the ring resent by the host, only needed if the terms were not precomputed
+ * @param prefix_hash the transaction prefix hash
+ * @param signatures the staging area
+ * @param capacity the number of signatures that fit in the staging area
+ */
+static uint16_t tx_sign_input(
+    const uint8_t input_index,
+    const transaction_input_t *input,
+    const unsigned char *public_keys,
+    const unsigned char *prefix_hash,
+    unsigned char *signatures,
+    const size_t capacity)
+{
+    const uint8_t ring_size = L_transaction.ring_size;
+
+    const uint8_t real_output_index = input->real_output_index;
+
+    // where the signature of the real member lands once the set is completed
+    const uint16_t real_position = L_transaction.current_position + (real_output_index * SIG_SIZE);
+
+    // the terms were precomputed while the input was loaded if the nonces can be expanded again
+    const bool precomputed = (NONCE_DRBG == 1);
+
+    const unsigned char *terms = TX_RAW + TX_TERMS_POSITION(input_index);
+
+    // otherwise the ring has to be resent and be the very one that the input was loaded with
+    if (!precomputed)
+    {
+        unsigned char commitment[KEY_SIZE];
+
+        if (public_keys == NULL)
+        {
+            return ERR_TX_RING_KEYS;
+        }
+
+        hw_keccak(public_keys, ring_size * KEY_SIZE, commitment);
+
+        if (os_memcmp(commitment, input->ring_commitment, KEY_SIZE) != 0)
+        {
+            return ERR_TX_RING_KEYS;
+        }
+    }
+
+    hw_ring_signer_t signer;
+
+    uint16_t status = hw__ring_signer_init(&signer, prefix_hash, precomputed ? NULL : input->key_image);
+
+    if (status != OP_OK)
+    {
+        return tx_wipe(&signer, sizeof(signer), status);
+    }
+
+    size_t staged = 0;
+
+    uint8_t i;
+    for (i = 0; i < ring_size; i++)
+    {
+        if (precomputed)
+        {
+            status = hw__ring_signer_replay(
+                &signer, signatures + (staged * SIG_SIZE), terms + (i * SIG_SIZE), i == real_output_index);
+        }
+        else
+        {
+            status = hw__ring_signer_update(
+                &signer, signatures + (staged * SIG_SIZE), public_keys + (i * KEY_SIZE), i == real_output_index);
+        }
+
+        if (status != OP_OK)
+        {
+            return tx_wipe(&signer, sizeof(signer), status);
+        }
+
+        staged++;
+
+        // the last window is kept back so that the real member can be completed in place when it is there
+        if (staged == capacity && i + 1 != ring_size)
+        {
+            TX_SIGNATURES_WRITE(signatures, staged * SIG_SIZE);
+
+            staged = 0;
+        }
+    }
+
+    if (real_position >= L_transaction.current_position)
+    {
+        // the real member is still staged so it is completed in place
+        hw__ring_signer_final(
+            &signer, signatures + (real_position - L_transaction.current_position), input->private_ephemeral);
+
+        if (L_transaction.stream_signatures == 1)
+        {
+            // the whole set was staged (see tx_sign_begin) and is left there for the host
+            TX_SIGNATURES_STREAM(signatures, staged * SIG_SIZE);
+        }
+        else
+        {
+            TX_SIGNATURES_WRITE(signatures, staged * SIG_SIZE);
+        }
+    }
+    else
+    {
+        // otherwise the real member was already committed as a placeholder that we now replace
+        if (staged != 0)
+        {
+            TX_SIGNATURES_WRITE(signatures, staged * SIG_SIZE);
+        }
+
+        hw__ring_signer_final(&signer, signatures, input->private_ephemeral);
+
+        tx_patch(real_position, signatures, SIG_SIZE);
+    }
+
+    return OP_OK;
+}
+
+/**
+ * Signs the next input ahead of the approval, one input per idle step (see idle_post) so that the
+ * review stays responsive, the signatures are staged in what the review leaves of the working set
+ * @param prefix_hash the transaction prefix hash
+ */
+static uint16_t tx_speculate_step(const unsigned char *prefix_hash)
+{
+    if (!L_tx_speculation.active || L_tx_speculation.stepping
+        || L_transaction.signed_input_count == L_transaction.input_count)
+    {
+        return OP_OK;
+    }
+
+    const arena_mark_t mark = arena_mark();
+
+    const size_t capacity = (WORKING_SET_SIZE - mark) / SIG_SIZE;
+
+    if (capacity == 0)
+    {
+        return OP_NOK;
+    }
+
+    const uint8_t input_index = L_transaction.signed_input_count;
+
+    L_tx_speculation.stepping = true;
+
+    uint16_t status = hw_nonce_drbg_domain(input_index);
+
+    if (status == OP_OK)
+    {
+        status = tx_sign_input(
+            input_index,
+            TX_PRE_SIGNATURE(input_index),
+            NULL,
+            prefix_hash,
+            arena_alloc(capacity * SIG_SIZE),
+            capacity);
+    }
+
+    hw_nonce_drbg_pause();
+
+    arena_release(mark);
+
+    if (status != OP_OK)
+    {
+        // leaves stepping set so that the approval undoes what was done and signs it all over
+        return status;
+    }
+
+    L_transaction.signed_input_count++;
+
+    L_tx_speculation.stepping = false;
+
+    if (L_transaction.signed_input_count != L_transaction.input_count)
+    {
+        idle_post(tx_speculate_step, prefix_hash);
+    }
+
+    return OP_OK;
+}
+
+/**
+ * Starts signing the transaction while the user reviews it, an input at a time between the
+ * events of the review. The signatures go where tx_sign would put them but the transaction is
+ * not completed: tx_sign takes them over and signs what is left once it is approved, and
+ * tx_speculate_abort takes them back when it is rejected. Only the replay of the precomputed
+ * terms is small enough to run between events (see idle_work_t) so this needs NONCE_DRBG, the
+ * work that does not depend on the prefix hash was done when the inputs were loaded. The
+ * transaction stays TX_PREFIX_READY until it is approved, no other request is served meanwhile
+ * (see tx_speculating)
+ */
+uint16_t tx_speculate_begin()
+{
+    if (NONCE_DRBG != 1 || L_transaction.seal_inputs == 1 || L_tx_speculation.active
+        || tx_state() != TX_PREFIX_READY)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    L_tx_speculation.start_position = L_transaction.current_position;
+
+    L_tx_speculation.page_start = L_tx_page_start;
+
+    os_memmove(L_tx_speculation.page, L_tx_page, TX_PAGE_SIZE);
+
+    L_transaction.signed_input_count = 0;
+
+    L_transaction.stream_signatures = 0;
+
+    L_tx_speculation.active = true;
+
+    // if the queue is full the inputs are all signed once approved instead
+    idle_post(tx_speculate_step, L_prefix_hash);
+
+    return OP_OK;
+}
+
+/**
+ * Takes back what was signed ahead of the approval, the transaction is left with its prefix
+ * ready to be signed again. Signatures in RAM are wiped here and those that reached NVRAM are
+ * behind the current position where the next reset wipes them (see TX_WRITTEN)
+ */
+uint16_t tx_speculate_abort()
+{
+    if (!L_tx_speculation.active)
+    {
+        return OP_OK;
+    }
+
+    unsigned char seed[KEY_SIZE];
+
+    // the DRBG is rewound to where the inputs left it, paused at the start of the first domain
+    if (hw_nonce_drbg_save(seed) == OP_OK)
+    {
+        hw_nonce_drbg_restore(seed);
+    }
+    else
+    {
+        hw_nonce_drbg_pause();
+    }
+
+    explicit_bzero(seed, sizeof(seed));
+
+    if (L_transaction.in_ram == 1)
+    {
+        explicit_bzero(
+            L_tx_ram + L_tx_speculation.start_position,
+            L_transaction.current_position - L_tx_speculation.start_position);
+    }
+
+    L_transaction.current_position = L_tx_speculation.start_position;
+
+    L_tx_page_start = L_tx_speculation.page_start;
+
+    os_memmove(L_tx_page, L_tx_speculation.page, TX_PAGE_SIZE);
+
+    L_transaction.signed_input_count = 0;
+
+    return tx_wipe(&L_tx_speculation, sizeof(L_tx_speculation), OP_OK);
+}
+
+/**
+ * Returns whether the transaction is being signed ahead of its approval, the review owns
+ * the working set and the transaction until it is approved or rejected
+ */
+bool tx_speculating()
+{
+    return L_tx_speculation.active;
+}
+
+/**
+ * Moves a transaction with a completed prefix into the signing state, from here on the
+ * nonces are committed to the prefix (see tx_reload_outputs)
+ */
+static void tx_sign_enter()
+{
+    L_transaction.signing_started = 1;
+
+    L_transaction.state = TX_SIGNING;
+
+    // so that tx_resume knows whether any of the signatures may have been stored
+    tx_checkpoint();
+}
+
+/**
+ * Completes the ring signatures for the transaction currently in memory
+ */
+uint16_t tx_sign()
+{
+    PROFILE_SCOPE();
+
+    // what was signed while the transaction was reviewed is kept and the rest is signed now
+    if (L_tx_speculation.active)
+    {
+        if (L_tx_speculation.stepping)
+        {
+            tx_speculate_abort();
+        }
+        else
+        {
+            tx_wipe(&L_tx_speculation, sizeof(L_tx_speculation), OP_OK);
+
+            tx_sign_enter();
+
+            return tx_sign_inputs(L_transaction.input_count);
+        }
+    }
+
+    // the host holds the pre-signature state of sealed inputs so they are only signed one at a time
+    if (L_transaction.seal_inputs == 1)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    const uint16_t status = tx_sign_begin(false);
+
+    if (status != OP_OK)
+    {
+        return status;
+    }
+
+    // if this stops part of the way through, the rest of the inputs can be signed with tx_sign_inputs
+    return tx_sign_inputs(L_transaction.input_count);
+}
+
+/**
+ * Moves a transaction with a completed prefix into the signing state where the inputs
+ * are then signed in order by tx_sign_inputs and/or from mixins prepared by the host,
+ * or by tx_sign_stream_input if the signatures are to be streamed to the host
+ * @param stream whether the signatures are returned to the host instead of being stored
+ */
+uint16_t tx_sign_begin(const bool stream)
+{
+    PROFILE_SCOPE();
+
+    if (tx_state() != TX_PREFIX_READY)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    // a streamed set is returned whole, along with the hash and size after the last one, in a single response
+    if (stream && (L_transaction.ring_size * SIG_SIZE) + KEY_SIZE + sizeof(uint16_t) > TX_MAX_DUMP_SIZE)
+    {
+        return ERR_TX_RING_SIZE;
+    }
+
+    // and it has to fit in front of the ring if the host resends it
+    if (stream && NONCE_DRBG != 1 && L_transaction.ring_size * (SIG_SIZE + KEY_SIZE) > WORKING_SET_SIZE)
+    {
+        return ERR_TX_RING_SIZE;
+    }
+
+    L_transaction.signed_input_count = 0;
+
+    L_transaction.stream_signatures = stream ? 1 : 0;
+
+    tx_sign_enter();
+
+    return OP_OK;
+}
+
+/**
+ * Completes the transaction once the signing cursor has passed the last input
+ */
+static void tx_sign_complete()
+{
+    // the nonces are kept until the approval as the inputs may yet have to be signed again
+    if (L_transaction.signed_input_count != L_transaction.input_count || L_tx_speculation.active)
+    {
+        return;
+    }
 
-                pos += KEY_SIZE;
-            }
+    hw_nonce_drbg_stop();
 
-            // batch write to NVRAM
-            TX_WRITE(tx, pos);
+    if (L_transaction.stream_signatures == 1)
+    {
+        hw_keccak_final(&L_tx_context, L_tx_hash);
+    }
 
-            /**
-             * There's some information that we need to save off for when we generate the
-             * ring signatures at the end of the transaction construction process
-             * these parts are not included in the transaction itself that is broadcasted
-             * to the network so we'll throw them over in NVRAM as a nice structure for
-             * later when we need them as we need to limit RAM usage
-             */
-            {
-                os_memmove(tx_input.public_keys, public_keys, RING_PARTICIPANTS * KEY_SIZE);
+    L_transaction.state = TX_COMPLETE;
 
-                tx_input.real_output_index = real_output_index;
+    // the stored signatures are committed along with it so that a complete transaction can still be dumped
+    tx_checkpoint();
+}
 
-                PRE_SIG_WRITE(tx_input);
-            }
+/**
+ * Signs up to the given number of inputs of the transaction starting at the signing cursor,
+ * every input that is signed is committed before the cursor moves so that the host can
+ * spread a large transaction over many requests and pick up where it left off
+ * @param count the largest number of inputs to sign
+ */
+uint16_t tx_sign_inputs(const uint8_t count)
+{
+    PROFILE_SCOPE();
 
-            L_transaction.received_input_count++;
+    if (tx_state() != TX_SIGNING || L_transaction.stream_signatures == 1 || L_transaction.seal_inputs == 1)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
 
-            // if we've now received all of the inputs that we expected, change the transaction state
-            if (L_transaction.received_input_count == L_transaction.input_count)
-            {
-                L_transaction.state = TX_INPUTS_RECEIVED;
-            }
+#define SIGNATURES WORKING_SET
+#define SIGNATURES_CAPACITY (WORKING_SET_SIZE / SIG_SIZE)
 
-            CLOSE_TRY;
+    uint8_t signed_count;
+    for (signed_count = 0; signed_count < count && L_transaction.signed_input_count < L_transaction.input_count;
+         signed_count++)
+    {
+        const uint8_t input_index = L_transaction.signed_input_count;
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
+        // separate the nonces of every input from one another, these are the same ones tx_precompute_input used
+        if (hw_nonce_drbg_domain(input_index) != OP_OK && NONCE_DRBG == 1)
         {
-            return e;
+            return tx_wipe(WORKING_SET, WORKING_SET_SIZE, ERR_TRANSACTION_STATE);
         }
-        FINALLY
+
+        /**
+         * The signatures are committed to NVRAM as they are produced as there can be
+         * 90 inputs processed and 90 * 256 = 23,040 bytes -- too many to hold on to,
+         * with rings of up to SIGNATURES_CAPACITY members this is a single write per input
+         */
+        const uint16_t status = tx_sign_input(
+            input_index, TX_PRE_SIGNATURE(input_index), NULL, L_prefix_hash, SIGNATURES, SIGNATURES_CAPACITY);
+
+        if (status != OP_OK)
         {
-#undef PUBLIC_EPHEMERAL
-#undef DERIVATION
-            explicit_bzero((void *)&tx_input, sizeof(transaction_input_t));
+            // the seed is kept so that the precomputed terms can still be signed on a retry
+            hw_nonce_drbg_pause();
 
-            explicit_bzero(tx, sizeof(tx));
+            return tx_wipe(WORKING_SET, WORKING_SET_SIZE, status);
         }
+
+        L_transaction.signed_input_count++;
     }
-    END_TRY;
+
+    hw_nonce_drbg_pause();
+
+    tx_sign_complete();
+
+    return tx_wipe(WORKING_SET, WORKING_SET_SIZE, OP_OK);
+#undef SIGNATURES_CAPACITY
+#undef SIGNATURES
 }
 
 /**
- * Loads an output into the transaction
- * @param amount
- * @param key
+ * Signs the next input of the transaction from mixins prepared by the host so that
+ * the only point arithmetic left on the device is k * G and k * Hp(P) of the real member
+ * @param mixins the prepared mixins in ring order skipping the real member (TX_MIXIN_SIZE each)
  */
-uint16_t tx_load_output(const uint64_t amount, const unsigned char *key)
+uint16_t tx_sign_next_input(const unsigned char *mixins)
 {
-    if (tx_state() != TX_RECEIVING_OUTPUTS)
+    PROFILE_SCOPE();
+
+    if (tx_state() != TX_SIGNING || L_transaction.stream_signatures == 1 || L_transaction.seal_inputs == 1)
     {
         return ERR_TRANSACTION_STATE;
     }
 
-    unsigned char tx[TX_EXTRA_MAX_SIZE] = {0};
+    const uint8_t input_index = L_transaction.signed_input_count;
 
-    BEGIN_TRY
-    {
-        TRY
-        {
-            unsigned int pos = 0;
+    const uint8_t ring_size = L_transaction.ring_size;
 
-            // write the amount to the transaction
-            {
-                pos += encode_varint(tx, amount, sizeof(tx));
-            }
+    const transaction_input_t *input = TX_PRE_SIGNATURE(input_index);
 
-            // write the type to the transaction
-            {
-                unsigned char type = 0x02;
+    const uint8_t real_output_index = input->real_output_index;
 
-                os_memmove(tx + pos, &type, TX_EXTRA_TAG_SIZE);
+    /**
+     * Check every mixin before anything is committed so that a bad one leaves the input unsigned,
+     * the points are only ever hashed into the challenge so they are checked to be points on the
+     * curve in their canonical encoding instead of being trusted as the host sent them
+     */
+    uint8_t i;
+    for (i = 0; i < ring_size - 1; i++)
+    {
+        const unsigned char *record = mixins + (i * TX_MIXIN_SIZE);
 
-                pos += TX_EXTRA_TAG_SIZE;
-            }
+        if (!hw_check_scalar(record) || !hw_check_scalar(record + KEY_SIZE) || !hw_check_key(record + (2 * KEY_SIZE))
+            || !hw_check_key(record + (3 * KEY_SIZE)))
+        {
+            return ERR_TX_MIXIN;
+        }
+    }
 
-            // write the key to the transaction
-            {
-                os_memmove(tx + pos, key, KEY_SIZE);
+    // the nonce of the real member must come fresh from the RNG as the host picks the challenge
+    hw_nonce_drbg_pause();
 
-                pos += KEY_SIZE;
-            }
+    const uint16_t real_position = L_transaction.current_position + (real_output_index * SIG_SIZE);
 
-            // batch write to NVRAM
-            TX_WRITE(tx, pos);
+    hw_ring_signer_t signer;
 
-            L_transaction.total_output_amount += amount;
+    unsigned char signature[SIG_SIZE];
 
-            L_transaction.received_output_count++;
+    // the ring is not kept but the public key of the real member is simply x * G
+    unsigned char public_key[KEY_SIZE];
 
-            // if we have now received all of the outputs that we were expecting update the transaction state
-            if (L_transaction.received_output_count == L_transaction.output_count)
-            {
-                L_transaction.state = TX_OUTPUTS_RECEIVED;
-            }
+    uint16_t status = hw_private_key_to_public_key(public_key, input->private_ephemeral);
 
-            CLOSE_TRY;
+    if (status == OP_OK)
+    {
+        status = hw__ring_signer_init(&signer, L_prefix_hash, NULL);
+    }
 
-            return OP_OK;
+    for (i = 0; i < ring_size && status == OP_OK; i++)
+    {
+        if (i == real_output_index)
+        {
+            status = hw__ring_signer_update(&signer, signature, public_key, true);
         }
-        CATCH_OTHER(e)
+        else
         {
-            return ERR_TX_LOAD_OUTPUT;
+            const uint8_t mixin_index = (i < real_output_index) ? i : i - 1;
+
+            status = hw__ring_signer_mixin(&signer, signature, mixins + (mixin_index * TX_MIXIN_SIZE));
         }
-        FINALLY
+
+        if (status == OP_OK)
         {
-            explicit_bzero(tx, sizeof(tx));
+            TX_SIGNATURES_WRITE(signature, SIG_SIZE);
         }
     }
-    END_TRY;
-}
 
-/**
- * Returns the total amount of the outputs
- */
-uint64_t tx_output_amount()
-{
-    return L_transaction.total_output_amount;
+    if (status != OP_OK)
+    {
+        return tx_wipe(&signer, sizeof(signer), status);
+    }
+
+    hw__ring_signer_final(&signer, signature, input->private_ephemeral);
+
+    tx_patch(real_position, signature, SIG_SIZE);
+
+    explicit_bzero(signature, sizeof(signature));
+
+    L_transaction.signed_input_count++;
+
+    tx_sign_complete();
+
+    return OP_OK;
 }
 
 /**
- * Returns the payment id information
+ * Signs the next input of the transaction into the given buffer for the host instead of
+ * storing the signatures, nothing of the input is written to NVRAM and the hash of the whole
+ * transaction is carried along so that the device can still attest to the result
+ * @param signatures where to put the signatures of the input (ring_size * SIG_SIZE)
+ * @param public_keys the ring resent by the host (see tx_sign_input), may overlap anything past the signatures
  */
-void tx_payment_id(unsigned char *payment_id)
+uint16_t tx_sign_stream_input(unsigned char *signatures, const unsigned char *public_keys)
 {
-    os_memmove(payment_id, N_tx_info->payment_id, KEY_SIZE);
+    PROFILE_SCOPE();
+
+    if (tx_state() != TX_SIGNING || L_transaction.stream_signatures != 1 || L_transaction.seal_inputs == 1)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    const uint8_t input_index = L_transaction.signed_input_count;
+
+    if (hw_nonce_drbg_domain(input_index) != OP_OK && NONCE_DRBG == 1)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
+
+    // staging the whole ring at once completes the real member in place
+    const uint16_t status = tx_sign_input(
+        input_index, TX_PRE_SIGNATURE(input_index), public_keys, L_prefix_hash, signatures, L_transaction.ring_size);
+
+    hw_nonce_drbg_pause();
+
+    if (status != OP_OK)
+    {
+        return tx_wipe(signatures, L_transaction.ring_size * SIG_SIZE, status);
+    }
+
+    L_transaction.signed_input_count++;
+
+    tx_sign_complete();
+
+    return OP_OK;
 }
 
 /**
- * Resets the internal transaction state of the device
+ * Signs the next input of the transaction on the device from the ring resent by the host,
+ * which is only needed if the terms of the input were not precomputed when it was loaded
+ * @param public_keys the ring of the input at the end of the working set (see TX_RESENT_RING_CAPACITY)
  */
-uint16_t tx_reset()
+uint16_t tx_sign_ring_input(const unsigned char *public_keys)
 {
-    BEGIN_TRY
+    PROFILE_SCOPE();
+
+    if (tx_state() != TX_SIGNING || L_transaction.stream_signatures == 1 || L_transaction.seal_inputs == 1)
     {
-        TRY
-        {
-            TX_RESET();
+        return ERR_TRANSACTION_STATE;
+    }
 
-            PRE_SIG_RESET();
+    const uint8_t input_index = L_transaction.signed_input_count;
 
-            TX_INFO_RESET();
+    if (hw_nonce_drbg_domain(input_index) != OP_OK && NONCE_DRBG == 1)
+    {
+        return ERR_TRANSACTION_STATE;
+    }
 
-            if (init_tx() != 0)
-            {
-                THROW(ERR_TX_RESET);
-            }
+    const uint16_t status = tx_sign_input(
+        input_index, TX_PRE_SIGNATURE(input_index), public_keys, L_prefix_hash, WORKING_SET, TX_RESENT_RING_CAPACITY);
 
-            CLOSE_TRY;
+    hw_nonce_drbg_pause();
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY {}
+    if (status != OP_OK)
+    {
+        return tx_wipe(WORKING_SET, WORKING_SET_SIZE, status);
     }
-    END_TRY;
+
+    L_transaction.signed_input_count++;
+
+    tx_sign_complete();
+
+    return tx_wipe(WORKING_SET, WORKING_SET_SIZE, OP_OK);
 }
 
 /**
- * Completes the ring signatures for the transaction currently in memory
+ * Signs the next input of the transaction from the pre-signature state that was sealed for
+ * the host when the input was loaded, the signatures are stored or left in the given buffer
+ * for the host depending on how signing was started
+ * @param sealed_input the sealed pre-signature state of the input (TX_SEALED_INPUT_SIZE)
+ * @param signatures the staging area (WORKING_SET) that streamed signatures are left at the start of
+ * @param public_keys the ring resent by the host at the end of the working set (see tx_sign_input)
  */
-uint16_t tx_sign()
+uint16_t tx_sign_sealed_input(
+    const unsigned char *sealed_input,
+    unsigned char *signatures,
+    const unsigned char *public_keys)
 {
-    if (tx_state() != TX_PREFIX_READY)
+    PROFILE_SCOPE();
+
+    if (tx_state() != TX_SIGNING || L_transaction.seal_inputs != 1)
     {
         return ERR_TRANSACTION_STATE;
     }
 
-#define SIGNATURES WORKING_SET
-#define PREFIX_HASH SIGNATURES + (SIG_SIZE * RING_PARTICIPANTS)
+    const uint8_t input_index = L_transaction.signed_input_count;
+
+    transaction_input_t input;
+
+    // anything that was not sealed by us for this very input is turned away here
+    uint16_t status = hw_unseal(
+        (unsigned char *)&input, sealed_input, sizeof(transaction_input_t), L_seal_key, input_index);
 
-    BEGIN_TRY
+    if (status != OP_OK)
     {
-        TRY
-        {
-            // calculate the transaction prefix hash and hold it for later
-            uint16_t status =
-                hw_keccak((unsigned char *)N_raw_transaction, L_transaction.current_position, PREFIX_HASH);
+        return tx_wipe(&input, sizeof(transaction_input_t), status);
+    }
 
-            if (status != OP_OK)
-            {
-                THROW(status);
-            }
+    if (hw_nonce_drbg_domain(input_index) != OP_OK && NONCE_DRBG == 1)
+    {
+        return tx_wipe(&input, sizeof(transaction_input_t), ERR_TRANSACTION_STATE);
+    }
 
-            int i;
-            for (i = 0; i < L_transaction.input_count; i++)
-            {
-                status = hw__generate_ring_signatures(
-                    SIGNATURES,
-                    PREFIX_HASH,
-                    N_tx_pre_signatures[i]->key_image,
-                    N_tx_pre_signatures[i]->public_keys,
-                    N_tx_pre_signatures[i]->private_ephemeral,
-                    N_tx_pre_signatures[i]->real_output_index);
-
-                if (status != OP_OK)
-                {
-                    THROW(status);
-                }
+    // a streamed set is staged whole (see tx_sign_begin) so that it is left there for the host
+    size_t capacity = (public_keys == NULL) ? WORKING_SET_SIZE / SIG_SIZE : TX_RESENT_RING_CAPACITY;
 
-                /**
-                 * Normally, we'd try to batch the write to NVRAM but due to memory constraints
-                 * and the fact that each signature set is 256-bytes, we need to commit the
-                 * signatures to NVRAM during each pass of the loop as there can be 90 inputs
-                 * processed and 90 * 256 = 23,040 bytes -- too many
-                 */
-                TX_WRITE_PTR(SIGNATURES, SIG_SIZE * RING_PARTICIPANTS);
-            }
+    if (L_transaction.stream_signatures == 1)
+    {
+        capacity = L_transaction.ring_size;
+    }
 
-            L_transaction.state = TX_COMPLETE;
+    status = tx_sign_input(input_index, &input, public_keys, L_prefix_hash, signatures, capacity);
 
-            CLOSE_TRY;
+    hw_nonce_drbg_pause();
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-#undef PREFIX_HASH
-#undef SIGNATURES
-            explicit_bzero(WORKING_SET, WORKING_SET_SIZE);
-        }
+    explicit_bzero(&input, sizeof(transaction_input_t));
+
+    if (status != OP_OK)
+    {
+        return tx_wipe(signatures, capacity * SIG_SIZE, status);
     }
-    END_TRY;
+
+    L_transaction.signed_input_count++;
+
+    tx_sign_complete();
+
+    return OP_OK;
+}
+
+/**
+ * Returns the number of inputs that have been signed so far
+ */
+uint8_t tx_signed_input_count()
+{
+    return L_transaction.signed_input_count;
 }
 
 /**
@@ -655,6 +2566,13 @@ uint16_t tx_sign()
  */
 uint16_t tx_size()
 {
+    if (L_transaction.stream_signatures == 1)
+    {
+        // the streamed signatures count towards the size of the transaction the host puts together
+        return L_transaction.current_position
+               + (L_transaction.signed_input_count * L_transaction.ring_size * SIG_SIZE);
+    }
+
     return L_transaction.current_position;
 }
 
@@ -663,96 +2581,154 @@ uint16_t tx_size()
  * @param unlock_time
  * @param input_count
  * @param output_count
+ * @param ring_size
+ * @param offset_size the largest varint that a ring offset may take, tx_load_input holds the offsets to it
  * @param tx_public_key
  * @param has_payment_id
  * @param payment_id
+ * @param seal_inputs whether the pre-signature state of the inputs is sealed and held by the host
+ * @param auto_advance whether the transaction moves on by itself (see tx_auto_advances)
  */
 uint16_t tx_start(
     const uint64_t unlock_time,
     const uint8_t input_count,
     const uint8_t output_count,
+    const uint8_t ring_size,
+    const uint8_t offset_size,
     const unsigned char *tx_public_key,
     const uint8_t has_payment_id,
-    const unsigned char *payment_id)
+    const unsigned char *payment_id,
+    const uint8_t seal_inputs,
+    const uint8_t auto_advance)
 {
+    PROFILE_SCOPE();
+
     unsigned char tx[KEY_SIZE];
 
-    BEGIN_TRY
+    unsigned int pos = 0;
+
+    // the writes of the reset below are the first that the new transaction costs
+    nvram_stats_transaction_start();
+
+    if (tx_reset() != 0)
+    {
+        return ERR_TX_RESET;
+    }
+
+    if (ring_size == 0 || ring_size > TX_MAX_RING_SIZE)
+    {
+        return ERR_TX_RING_SIZE;
+    }
+
+    if (offset_size == 0 || offset_size > TX_OFFSET_MAX_SIZE)
+    {
+        return ERR_TX_OFFSET_SIZE;
+    }
+
+    // validate that the largest transaction this could become fits before any of it is loaded
     {
-        TRY
+        tx_footprint_t footprint;
+
+        tx_footprint(&footprint, input_count, output_count, ring_size, offset_size, seal_inputs);
+
+        if (!footprint.fits)
         {
-            unsigned int pos = 0;
+            return ERR_TX_INPUT_OUTPUT_OUT_OF_RANGE;
+        }
 
-            if (tx_reset() != 0)
-            {
-                THROW(ERR_TX_RESET);
-            }
+        const uint32_t pre_signatures_size = (seal_inputs == 1) ? 0 : input_count * TX_PRE_SIGNATURE_SIZE;
 
-            // validate that we are not trying to start a transaction with more than we can handle
-            if (input_count > TX_MAX_INPUTS || output_count > TX_MAX_OUTPUTS)
-            {
-                THROW(ERR_TX_INPUT_OUTPUT_OUT_OF_RANGE);
-            }
+        if (footprint.in_ram)
+        {
+            L_transaction.in_ram = 1;
 
-            // write the transaction version to the transaction data
-            {
-                unsigned char version = 1;
+            L_tx_capacity = TX_RAM_SIZE - sizeof(transaction_info_t) - pre_signatures_size;
+        }
+        else
+        {
+            L_tx_capacity = TX_POOL_SIZE - pre_signatures_size;
+        }
+    }
 
-                os_memmove(tx, &version, TX_EXTRA_TAG_SIZE);
+    if (seal_inputs == 1)
+    {
+        // the key is new for every transaction so that what was sealed for one is of no use in another
+        hw_random_bytes(L_seal_key, KEY_SIZE);
+    }
 
-                pos += TX_EXTRA_TAG_SIZE;
-            }
+    L_transaction.seal_inputs = (seal_inputs == 1) ? 1 : 0;
 
-            // write the unlock time to the transaction data
-            {
-                pos += encode_varint(tx + pos, unlock_time, sizeof(tx));
-            }
+    L_transaction.auto_advance = (auto_advance == 1) ? 1 : 0;
 
-            L_transaction.input_count = input_count;
+    L_transaction.ring_size = ring_size;
 
-            // write the number of inputs to the transaction data
-            {
-                pos += encode_varint(tx + pos, input_count, sizeof(tx));
-            }
+    L_transaction.offset_size = offset_size;
 
-            L_transaction.output_count = output_count;
+    // write the transaction version to the transaction data
+    {
+        unsigned char version = 1;
 
-            L_transaction.has_payment_id = has_payment_id;
+        os_memmove(tx, &version, TX_EXTRA_TAG_SIZE);
 
-            // we can go ahead and store the start of the transaction prefix
-            TX_WRITE(tx, pos);
+        pos += TX_EXTRA_TAG_SIZE;
+    }
 
-            // allocate an info structure
-            transaction_info_t tx_info;
+    // write the unlock time to the transaction data
+    {
+        pos += encode_varint(tx + pos, unlock_time, sizeof(tx));
+    }
 
-            // copy the transaction public key to the structure
-            os_memmove(tx_info.tx_public_key, tx_public_key, KEY_SIZE);
+    L_transaction.input_count = input_count;
 
-            // if we have a payment_id, then copy that over to the structure
-            if (has_payment_id == 1)
-            {
-                os_memmove(tx_info.payment_id, payment_id, KEY_SIZE);
-            }
+    // write the number of inputs to the transaction data
+    {
+        pos += encode_varint(tx + pos, input_count, sizeof(tx));
+    }
 
-            // write the structure to NVRAM so that we can use it later (saves RAM)
-            TX_INFO_WRITE(tx_info);
+    L_transaction.output_count = output_count;
 
-            L_transaction.state = TX_READY;
+    L_transaction.has_payment_id = has_payment_id;
 
-            CLOSE_TRY;
+    // we can go ahead and store the start of the transaction prefix
+    TX_WRITE(tx, pos);
 
-            return OP_OK;
-        }
-        CATCH_OTHER(e)
-        {
-            return e;
-        }
-        FINALLY
-        {
-            explicit_bzero(tx, sizeof(tx));
-        }
+    // allocate an info structure
+    transaction_info_t tx_info;
+
+    // copy the transaction public key to the structure
+    os_memmove(tx_info.tx_public_key, tx_public_key, KEY_SIZE);
+
+    // if we have a payment_id, then copy that over to the structure
+    if (has_payment_id == 1)
+    {
+        os_memmove(tx_info.payment_id, payment_id, KEY_SIZE);
+    }
+
+    // write the structure to NVRAM so that we can use it later (saves RAM), unless the transaction is in RAM anyway
+    if (L_transaction.in_ram == 1)
+    {
+        os_memmove(TX_INFO, &tx_info, sizeof(transaction_info_t));
+    }
+    else
+    {
+        TX_INFO_WRITE(tx_info);
+
+        TX_WRITTEN.state = true;
     }
-    END_TRY;
+
+    // seed the nonce source once for the whole transaction, it only runs while we precompute or sign
+    hw_nonce_drbg_start();
+
+    hw_nonce_drbg_pause();
+
+    L_transaction.state = TX_READY;
+
+    tx_checkpoint();
+
+    explicit_bzero(tx, sizeof(tx));
+
+
+    return OP_OK;
 }
 
 /**
@@ -760,6 +2736,8 @@ uint16_t tx_start(
  */
 uint16_t tx_start_input_load()
 {
+    PROFILE_SCOPE();
+
     if (tx_state() != TX_READY)
     {
         return ERR_TRANSACTION_STATE;
@@ -767,6 +2745,8 @@ uint16_t tx_start_input_load()
 
     L_transaction.state = TX_RECEIVING_INPUTS;
 
+    tx_checkpoint();
+
     return OP_OK;
 }
 
@@ -775,6 +2755,8 @@ uint16_t tx_start_input_load()
  */
 uint16_t tx_start_output_load()
 {
+    PROFILE_SCOPE();
+
     // check to validate that we are in the proper state to load outputs
     if (tx_state() != TX_INPUTS_RECEIVED)
     {
@@ -792,9 +2774,72 @@ uint16_t tx_start_output_load()
 
     L_transaction.state = TX_RECEIVING_OUTPUTS;
 
+    tx_checkpoint();
+
     return OP_OK;
 }
 
+/**
+ * Returns if the pre-signature state of the inputs is sealed and held by the host
+ */
+unsigned int tx_seals_inputs()
+{
+    return (unsigned int)L_transaction.seal_inputs;
+}
+
+/**
+ * Makes the given slot the one that the transaction methods work on, the transaction of the slot
+ * that was active is parked in its NVRAM areas and whatever the given slot was last left with is
+ * resumed (see tx_resume) so that one transaction can be loaded while another is signed or dumped
+ * @param slot the slot to switch to
+ */
+uint16_t tx_select_slot(const uint8_t slot)
+{
+    PROFILE_SCOPE();
+
+    if (slot >= TX_SLOTS)
+    {
+        return ERR_TX_SLOT;
+    }
+
+    if (slot == L_tx_slot)
+    {
+        return OP_OK;
+    }
+
+    if (tx_state() != TX_UNUSED)
+    {
+        tx_park();
+    }
+
+    // nothing of the transaction that was parked is left behind in RAM
+    TX_RAM_RESET();
+
+    hw_nonce_drbg_stop();
+
+    explicit_bzero(L_seal_key, sizeof(L_seal_key));
+
+    if (init_tx() != OP_OK)
+    {
+        return ERR_TX_INIT;
+    }
+
+    L_tx_slot = slot;
+
+    const uint16_t status = tx_resume();
+
+    // a slot that was left with nothing is simply ready for a new transaction
+    return (status == ERR_TX_RESUME) ? OP_OK : status;
+}
+
+/**
+ * Returns the slot that the transaction methods work on
+ */
+uint8_t tx_slot()
+{
+    return L_tx_slot;
+}
+
 /**
  * Returns the internal transaction state
  */
@@ -802,3 +2847,19 @@ unsigned int tx_state()
 {
     return (unsigned int)L_transaction.state;
 }
+
+/**
+ * Returns how much of the transaction is stored on the device
+ */
+uint16_t tx_stored_size()
+{
+    return L_transaction.current_position;
+}
+
+/**
+ * Returns if the signatures of the transaction are streamed to the host instead of stored
+ */
+unsigned int tx_streams_signatures()
+{
+    return (unsigned int)L_transaction.stream_signatures;
+}
@@ -19,11 +19,25 @@
 
 #include <keys.h>
 
-#define TX_MAX_INPUTS 90
-#define TX_MAX_OUTPUTS 90
-#define TX_MAX_SIZE 38400 // bytes
+#define TX_MAX_INPUTS 255 // soft, how many fit depends on the outputs and the ring size (see TX_POOL_SIZE)
+#define TX_MAX_OUTPUTS 255 // as above
+#define TX_POOL_SIZE 49920 // bytes, the raw transaction and the pre-signatures of its inputs (see tx_pool_t)
 #define TX_EXTRA_MAX_SIZE 80 // bytes
+#ifdef TARGET_NANOX
+#define TX_MAX_DUMP_SIZE 1408 // bytes
+#else
 #define TX_MAX_DUMP_SIZE 448 // bytes
+#endif
+#define TX_MAX_RING_SIZE 12
+#define TX_INPUT_MAX_SIZE 104 // bytes
+#define TX_OFFSET_MAX_SIZE 5 // bytes, the varint of a ring offset
+#define TX_OUTPUT_MAX_SIZE 43 // bytes, amount {up to 10 bytes} || type || key
+#define TX_MIXIN_SIZE 128 // bytes, c || r || L || R of a mixin prepared by the host
+#define TX_PAGE_SIZE 64 // bytes, NVRAM page that appends to the raw transaction are combined into
+#define TX_PRE_SIGNATURE_SIZE 128 // bytes, a transaction_input_t padded to whole NVRAM pages (see tx_pool_t)
+#define TX_SEALED_INPUT_SIZE 129 // bytes, sealed transaction_input_t followed by its MAC
+#define TX_SLOTS 2 // transactions that can be under construction at once, each with its own NVRAM areas
+#define TX_REVIEW_TEXT_SIZE 32 // bytes, an amount followed by the ticker as it is shown for review
 
 #define TX_EXTRA_TAG_SIZE 1
 #define TX_EXTRA_PUBKEY_TAG 0x01
@@ -38,18 +52,17 @@
 #define TX_OUTPUTS_RECEIVED 0x05
 #define TX_PREFIX_READY 0x06
 #define TX_COMPLETE 0x07
-
-typedef unsigned char raw_transaction_t[TX_MAX_SIZE];
+#define TX_SIGNING 0x08
 
 typedef struct transaction_input_s
 {
-    unsigned char public_keys[RING_PARTICIPANTS * KEY_SIZE]; // 128-bytes
-
     unsigned char private_ephemeral[KEY_SIZE]; // 32-bytes
 
     unsigned char key_image[KEY_SIZE]; // 32-bytes
 
     uint8_t real_output_index; // 1-byte
+
+    unsigned char ring_commitment[KEY_SIZE]; // 32-bytes, H(public_keys) of the ring the input was loaded with
 } transaction_input_t;
 
 typedef struct transaction_info_s
@@ -59,7 +72,7 @@ typedef struct transaction_info_s
     unsigned char payment_id[KEY_SIZE]; // 32-bytes
 } transaction_info_t;
 
-typedef struct transaction_s // 24-bytes
+typedef struct transaction_s // 34-bytes
 {
     uint64_t total_input_amount; // 8-bytes
 
@@ -67,6 +80,8 @@ typedef struct transaction_s // 24-bytes
 
     uint16_t current_position; // 2-bytes
 
+    uint16_t inputs_end; // 2-bytes, the size of the prefix once the last input was loaded (see tx_reload_outputs)
+
     uint8_t has_payment_id; // 1-byte
 
     uint8_t input_count; // 1-byte
@@ -77,33 +92,126 @@ typedef struct transaction_s // 24-bytes
 
     uint8_t received_output_count; // 1-byte
 
+    uint8_t ring_size; // 1-byte
+
+    uint8_t offset_size; // 1-byte, the largest varint that a ring offset may take
+
+    uint8_t signed_input_count; // 1-byte
+
+    uint8_t stream_signatures; // 1-byte
+
+    uint8_t signing_started; // 1-byte, set for good once a signature may have left the device (see tx_reload_outputs)
+
+    uint8_t seal_inputs; // 1-byte
+
+    uint8_t in_ram; // 1-byte
+
+    uint8_t auto_advance; // 1-byte
+
     uint8_t state; // 1-byte
 } transaction_t;
 
-typedef transaction_input_t tx_pre_signatures_t[TX_MAX_INPUTS];
+/**
+ * The raw transaction grows from the start of the pool and the pre-signatures of its inputs take
+ * its end, with the boundary between them set by tx_start from the number of inputs. A transaction
+ * with many inputs and few outputs and one with few inputs and many outputs then both fit in the
+ * same NVRAM (the 38400 bytes and 90 pre-signatures that the two used to be sized separately).
+ * The pool starts on a page and is a whole number of pages long, and every pre-signature takes
+ * TX_PRE_SIGNATURE_SIZE bytes, so a pre-signature never shares a page with another one or with
+ * the raw transaction and writing one only ever touches two pages
+ */
+typedef unsigned char tx_pool_t[TX_POOL_SIZE];
+
+/**
+ * The most that a transaction of a given shape can ever store (see tx_footprint), which is what
+ * tx_start holds it to before any of it is loaded
+ */
+typedef struct tx_footprint_s
+{
+    uint32_t pool_size; // the raw transaction, its signatures and the pre-signatures of its inputs
+
+    uint32_t ram_size; // all of that along with what sits behind it when it is built in RAM
+
+    uint8_t fits; // whether it fits in the pool
+
+    uint8_t in_ram; // whether it is built in RAM instead of NVRAM
 
+    uint8_t max_inputs; // the most inputs of the same shape that fit along with the same outputs
+} tx_footprint_t;
+
+typedef struct tx_checkpoint_s // 133-bytes
+{
+    transaction_t transaction; // 34-bytes
+
+    uint16_t prefix_size; // 2-bytes
+
+    // the nonces of the inputs expand from it so it outlives a power cut in NVRAM next to the seal key, it is
+    // wiped once the transaction is complete (see tx_sign_complete) or reset, or its checkpoint is dropped
+    unsigned char nonce_seed[KEY_SIZE]; // 32-bytes
+
+    unsigned char seal_key[KEY_SIZE]; // 32-bytes
+
+    unsigned char tx_hash[KEY_SIZE]; // 32-bytes
+
+    uint8_t parked; // 1-byte, whether the slot was switched away from (see tx_parking_t)
+} tx_checkpoint_t;
+
+typedef struct tx_parking_s // everything else in RAM that a parked transaction picks up exactly where it was with
+{
+    unsigned char prefix_hash[KEY_SIZE]; // 32-bytes
+
+    hw_keccak_t prefix_context;
+
+    hw_keccak_t tx_context;
+} tx_parking_t;
+
+// every slot has its own of each and the macros below point at those of the active slot
 #ifdef TARGET_NANOX
-extern const raw_transaction_t N_state_raw_transaction_pic;
-extern const tx_pre_signatures_t N_state_pre_signatures_pic;
-extern const transaction_info_t N_state_transaction_info_pic;
-#define N_raw_transaction ((volatile raw_transaction_t *)PIC(&N_state_raw_transaction_pic))
-#define N_tx_pre_signatures ((volatile tx_pre_signatures_t *)PIC(&N_state_pre_signatures_pic))
-#define N_tx_info ((volatile tx_info_t *)PIC(&N_state_transaction_info_pic))
+extern const tx_pool_t N_state_pool_pic[TX_SLOTS];
+extern const transaction_info_t N_state_transaction_info_pic[TX_SLOTS];
+extern const tx_checkpoint_t N_state_checkpoint_pic[TX_SLOTS];
+extern const tx_parking_t N_state_parking_pic[TX_SLOTS];
+#define N_tx_pool ((volatile tx_pool_t *)PIC(N_state_pool_pic) + tx_slot())
+#define N_tx_info ((volatile transaction_info_t *)PIC(N_state_transaction_info_pic) + tx_slot())
+#define N_tx_checkpoint ((volatile tx_checkpoint_t *)PIC(N_state_checkpoint_pic) + tx_slot())
+#define N_tx_parking ((volatile tx_parking_t *)PIC(N_state_parking_pic) + tx_slot())
 #else
-extern raw_transaction_t N_state_raw_transaction_pic;
-extern tx_pre_signatures_t N_state_pre_signatures_pic;
-extern transaction_info_t N_state_transaction_info_pic;
-#define N_raw_transaction ((WIDE raw_transaction_t *)PIC(&N_state_raw_transaction_pic))
-#define N_tx_pre_signatures ((WIDE tx_pre_signatures_t *)PIC(&N_state_pre_signatures_pic))
-#define N_tx_info ((WIDE transaction_info_t *)PIC(&N_state_transaction_info_pic))
+extern tx_pool_t N_state_pool_pic[TX_SLOTS];
+extern transaction_info_t N_state_transaction_info_pic[TX_SLOTS];
+extern tx_checkpoint_t N_state_checkpoint_pic[TX_SLOTS];
+extern tx_parking_t N_state_parking_pic[TX_SLOTS];
+#define N_tx_pool ((WIDE tx_pool_t *)PIC(N_state_pool_pic) + tx_slot())
+#define N_tx_info ((WIDE transaction_info_t *)PIC(N_state_transaction_info_pic) + tx_slot())
+#define N_tx_checkpoint ((WIDE tx_checkpoint_t *)PIC(N_state_checkpoint_pic) + tx_slot())
+#define N_tx_parking ((WIDE tx_parking_t *)PIC(N_state_parking_pic) + tx_slot())
 #endif
 
 uint16_t init_tx();
 
+unsigned int tx_auto_advances();
+
+uint16_t tx_capacity();
+
+uint16_t tx_check_input(
+    unsigned char *key_image,
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const unsigned char *public_keys,
+    const uint8_t ring_size,
+    const uint8_t real_output_index);
+
 uint16_t tx_dump(unsigned char *out, const uint16_t start_offset, const uint16_t length);
 
 uint64_t tx_fee();
 
+void tx_footprint(
+    tx_footprint_t *footprint,
+    const uint8_t input_count,
+    const uint8_t output_count,
+    const uint8_t ring_size,
+    const uint8_t offset_size,
+    const uint8_t seal_inputs);
+
 uint16_t tx_finalize_prefix();
 
 unsigned int tx_has_payment_id();
@@ -112,38 +220,108 @@ uint16_t tx_hash(unsigned char *hash);
 
 uint64_t tx_input_amount();
 
+uint8_t tx_input_count();
+
 uint16_t tx_load_input(
     const unsigned char *tx_public_key,
     const uint8_t output_index,
     const uint64_t amount,
     const unsigned char *public_keys,
     const uint32_t *offsets,
-    const uint8_t real_output_index);
+    const uint8_t real_output_index,
+    unsigned char *sealed_input);
+
+uint16_t tx_load_encoded_input(
+    const unsigned char *tx_public_key,
+    const uint8_t output_index,
+    const uint64_t amount,
+    const unsigned char *public_keys,
+    const unsigned char *offsets,
+    const uint8_t offsets_length,
+    const uint8_t real_output_index,
+    unsigned char *sealed_input);
 
 uint16_t tx_load_output(const uint64_t amount, const unsigned char *key);
 
+uint16_t tx_load_outputs(const uint8_t count, const uint64_t *amounts, const unsigned char *keys);
+
+uint16_t tx_load_prefix(const unsigned char *data, const uint16_t length, unsigned char *sealed_input);
+
 uint64_t tx_output_amount();
 
 void tx_payment_id(unsigned char *payment_id);
 
+uint16_t tx_prefix_hash(unsigned char *hash);
+
+uint16_t tx_prefix_size();
+
+uint8_t tx_received_input_count();
+
+uint8_t tx_received_output_count();
+
+uint16_t tx_reload_outputs();
+
 uint16_t tx_reset();
 
+uint16_t tx_resume();
+
+void tx_review_text(unsigned char *amount, unsigned char *fee);
+
+uint8_t tx_ring_size();
+
 uint16_t tx_sign();
 
+uint16_t tx_sign_begin(const bool stream);
+
+uint16_t tx_sign_inputs(const uint8_t count);
+
+uint16_t tx_sign_next_input(const unsigned char *mixins);
+
+uint16_t tx_sign_ring_input(const unsigned char *public_keys);
+
+uint16_t tx_sign_sealed_input(
+    const unsigned char *sealed_input,
+    unsigned char *signatures,
+    const unsigned char *public_keys);
+
+uint16_t tx_sign_stream_input(unsigned char *signatures, const unsigned char *public_keys);
+
+uint8_t tx_signed_input_count();
+
+uint16_t tx_speculate_abort();
+
+uint16_t tx_speculate_begin();
+
+bool tx_speculating();
+
 uint16_t tx_size();
 
 uint16_t tx_start(
     const uint64_t unlock_time,
     const uint8_t input_count,
     const uint8_t output_count,
+    const uint8_t ring_size,
+    const uint8_t offset_size,
     const unsigned char *tx_public_key,
     const uint8_t has_payment_id,
-    const unsigned char *payment_id);
+    const unsigned char *payment_id,
+    const uint8_t seal_inputs,
+    const uint8_t auto_advance);
 
 uint16_t tx_start_input_load();
 
 uint16_t tx_start_output_load();
 
+unsigned int tx_seals_inputs();
+
+uint16_t tx_select_slot(const uint8_t slot);
+
 unsigned int tx_state();
 
+uint8_t tx_slot();
+
+uint16_t tx_stored_size();
+
+unsigned int tx_streams_signatures();
+
 #endif // TRANSACTION_H
@@ -19,6 +19,30 @@
 
 #include "utils.h"
 
+// whether the command being handled has nothing to show (see run_silent)
+static bool L_silent = false;
+
+// whether the busy screen is up since the idle screen was last shown
+static bool L_busy = false;
+
+// whether the response of the command being handled goes back in chunks (see APDU_GET_RESPONSE)
+static bool L_chain_responses = false;
+
+// the rest of a chunked response is left where it was in the IO buffer until it is fetched
+static uint16_t L_pending_offset = 0;
+
+static uint16_t L_pending_end = 0;
+
+static uint16_t L_pending_status = 0;
+
+// the bytes that the status word of the first chunk is written over
+static unsigned char L_pending_head[2];
+
+static uint16_t chunk_status(const uint16_t remaining)
+{
+    return 0x6100 | ((remaining > 0xFF) ? 0x00 : remaining);
+}
+
 uint64_t readUint64BE(uint8_t *buffer)
 {
     return (uint64_t)((uint64_t)buffer[0] << 56) | ((uint64_t)buffer[1] << 48) | ((uint64_t)buffer[2] << 40)
@@ -68,19 +92,134 @@ void uint16ToChar(unsigned char *r, const uint16_t value)
     r[1] = lo;
 }
 
+void uint32ToChar(unsigned char *r, const uint32_t value)
+{
+    r[0] = (value >> 24) & 0xFF;
+
+    r[1] = (value >> 16) & 0xFF;
+
+    r[2] = (value >> 8) & 0xFF;
+
+    r[3] = value & 0xFF;
+}
+
 void sendResponse(size_t tx, bool approve)
 {
-    G_io_apdu_buffer[tx++] = approve ? 0x90 : 0x69;
+    uint16_t status = approve ? 0x9000 : 0x6985;
+
+    if (L_chain_responses && tx > CHAIN_CHUNK_SIZE)
+    {
+        L_pending_offset = CHAIN_CHUNK_SIZE;
+
+        L_pending_end = tx;
+
+        L_pending_status = status;
+
+        os_memmove(L_pending_head, G_io_apdu_buffer + CHAIN_CHUNK_SIZE, sizeof(L_pending_head));
+
+        tx = CHAIN_CHUNK_SIZE;
+
+        status = chunk_status(L_pending_end - L_pending_offset);
+    }
 
-    G_io_apdu_buffer[tx++] = approve ? 0x00 : 0x85;
+    L_chain_responses = false;
+
+    G_io_apdu_buffer[tx++] = status >> 8;
+
+    G_io_apdu_buffer[tx++] = status & 0xFF;
 
     // Send back the response, do not restart the event loop
     io_exchange(CHANNEL_APDU | IO_RETURN_AFTER_TX, tx);
 
+    // a silent command leaves the screen as it was
+    if (L_silent)
+    {
+        return;
+    }
+
+    L_busy = false;
+
     // Display back the original UX
     ui_idle();
 }
 
+void run_silent(void (*action)())
+{
+    // a single busy screen stays up for a whole run of silent commands
+    if (BUSY_SCREEN == 1 && !L_busy)
+    {
+        L_busy = true;
+
+        ui_busy();
+    }
+
+    L_silent = true;
+
+    action();
+
+    L_silent = false;
+}
+
+void chain_responses(const bool chained)
+{
+    L_chain_responses = chained;
+
+    L_pending_offset = 0;
+
+    L_pending_end = 0;
+}
+
+size_t next_response_chunk()
+{
+    if (L_pending_offset == L_pending_end)
+    {
+        unsigned char _errCode[2];
+
+        uint16ToChar(_errCode, ERR_APDU_CHAIN);
+
+        size_t tx = write_io_hybrid(_errCode, sizeof(_errCode), ERR_STR, true);
+
+        G_io_apdu_buffer[tx++] = 0x69;
+
+        G_io_apdu_buffer[tx++] = 0x85;
+
+        return tx;
+    }
+
+    // the first chunk went back with its status word over the start of the rest
+    if (L_pending_offset == CHAIN_CHUNK_SIZE)
+    {
+        os_memmove(G_io_apdu_buffer + CHAIN_CHUNK_SIZE, L_pending_head, sizeof(L_pending_head));
+    }
+
+    const uint16_t length = MIN(CHAIN_CHUNK_SIZE, L_pending_end - L_pending_offset);
+
+    // the chunk always starts past the request that asked for it
+    os_memmove(G_io_apdu_buffer, G_io_apdu_buffer + L_pending_offset, length);
+
+    L_pending_offset += length;
+
+    // the last chunk carries the status of the command itself
+    uint16_t status = L_pending_status;
+
+    if (L_pending_offset == L_pending_end)
+    {
+        chain_responses(false);
+    }
+    else
+    {
+        status = chunk_status(L_pending_end - L_pending_offset);
+    }
+
+    size_t tx = length;
+
+    G_io_apdu_buffer[tx++] = status >> 8;
+
+    G_io_apdu_buffer[tx++] = status & 0xFF;
+
+    return tx;
+}
+
 void sendError(const uint16_t errCode)
 {
     unsigned char _errCode[2];
@@ -163,22 +302,28 @@ size_t write_io_fixed(
 
     size_t tx = 0;
 
-    os_memmove(G_io_apdu_buffer + tx, output, output_size);
+    // handlers that produce their result in IO_RESPONSE have nothing left to copy
+    if (output != G_io_apdu_buffer)
+    {
+        os_memmove(G_io_apdu_buffer + tx, output, output_size);
+    }
 
     tx += output_size;
 
     return tx;
 }
 
+static const char C_hex_digits[] = "0123456789abcdef";
+
 void toHexString(const unsigned char *in, const unsigned int in_len, unsigned char *out, const unsigned int out_len)
 {
     unsigned int i, pos = 0;
 
     for (i = 0; i < in_len; i++)
     {
-        SPRINTF((char *)out + pos, "%02x", in[i]);
+        out[pos++] = C_hex_digits[in[i] >> 4];
 
-        pos += 2;
+        out[pos++] = C_hex_digits[in[i] & 0x0F];
     }
 
     out[out_len] = '\0';
@@ -187,49 +332,44 @@ void toHexString(const unsigned char *in, const unsigned int in_len, unsigned ch
 unsigned int amountToString(unsigned char *out, uint64_t value, const unsigned int max_length)
 {
     /**
-     * SPRINTF and using %llu doesn't seem to work on this platform
-     * for some reason so we have to do this a bit differently which
-     * is very, very, very annoying to say the least.
-     *
-     * Adapted from
-     * https://github.com/LedgerHQ/app-monero/blob/b8eef4f57310ab3fce229e9467b35dda05112af2/src/monero_crypto.c
+     * SPRINTF and using %llu doesn't work on this platform and a 64-bit division is a long
+     * software routine on the Cortex-M0, so the value is split into chunks of nine decimal
+     * digits that are then written out with 32-bit arithmetic
      */
 
-    // max uint64 is 18446744073709551616, aka 20 char, plus dot
-    char string_amount[22] = {0};
-
-    // we start at the length of string_amount minus 1 so that it's a C-string
-    unsigned int offset = 20;
+    // max uint64 is 18446744073709551615, aka 20 digits, least significant first
+    char digits[20];
 
-    unsigned int places = 0;
+    unsigned int count = 0;
 
-    // clear the output area
-    explicit_bzero(out, max_length);
+    unsigned int i;
 
-    // loop through and write it out one position at a time
-    while (value || places < (DECIMAL_PLACES + 1)) // +1 so that we get a leading 0
+    while (value > 0xFFFFFFFF)
     {
-        // if we encounter the position where our point (.) should be, insert it
-        if (places == DECIMAL_PLACES)
+        const uint64_t quotient = value / 1000000000;
+
+        uint32_t chunk = (uint32_t)(value - (quotient * 1000000000));
+
+        for (i = 0; i < 9; i++)
         {
-            string_amount[offset] = '.';
+            digits[count++] = '0' + (chunk % 10);
 
-            offset--;
+            chunk /= 10;
         }
 
-        // modular math because, it's crypto #amirite?
-        string_amount[offset] = 0x30 + (value % 10);
+        value = quotient;
+    }
 
-        // to the left, to the left...
-        value = value / 10;
+    uint32_t chunk = (uint32_t)value;
 
-        offset--;
+    while (chunk || count < (DECIMAL_PLACES + 1)) // +1 so that we get a leading 0
+    {
+        digits[count++] = '0' + (chunk % 10);
 
-        // bump the number of places we've written to
-        places++;
+        chunk /= 10;
     }
 
-    unsigned int length = sizeof(string_amount) - offset - 1; // it's offset based so it's (-1)
+    const unsigned int length = count + 2; // the digits, the point (.) and the terminator
 
     // if our length exceeds that of which we're going to try to dump into, don't
     if (length > max_length)
@@ -237,7 +377,21 @@ unsigned int amountToString(unsigned char *out, uint64_t value, const unsigned i
         THROW(ERR_OUT_OF_RANGE);
     }
 
-    os_memmove(out, string_amount + offset + 1, length);
+    // clear the output area
+    explicit_bzero(out, max_length);
+
+    unsigned int pos = 0;
+
+    while (count > 0)
+    {
+        // if we encounter the position where our point (.) should be, insert it
+        if (count == DECIMAL_PLACES)
+        {
+            out[pos++] = '.';
+        }
+
+        out[pos++] = digits[--count];
+    }
 
     return length;
 }
\ No newline at end of file
@@ -67,10 +67,31 @@ uint8_t readUint8(uint8_t *buffer);
 
 void uint16ToChar(unsigned char *r, const uint16_t value);
 
+void uint32ToChar(unsigned char *r, const uint32_t value);
+
 void sendResponse(size_t tx, bool approve);
 
 void sendError(const uint16_t errCode);
 
+/**
+ * Sets whether the next response goes back in chunks of CHAIN_CHUNK_SIZE, dropping any pending one
+ * @param chained whether the request arrived in fragments (see APDU_GET_RESPONSE)
+ */
+void chain_responses(const bool chained);
+
+/**
+ * Moves the next chunk of a pending response to the front of the IO buffer
+ * @returns the size of the chunk with its status word
+ */
+size_t next_response_chunk();
+
+/**
+ * Handles a command that has nothing worth showing or confirming right away instead of behind
+ * a splash screen, the action sends the response itself as the callback of the splash would
+ * @param action the do_* of the command
+ */
+void run_silent(void (*action)());
+
 void do_deny();
 
 void toHexString(const unsigned char *in, const unsigned int in_len, unsigned char *out, const unsigned int out_len);
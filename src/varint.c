@@ -34,52 +34,102 @@ unsigned int ptrLength(const unsigned char *ptr)
     return (unsigned int)(ptr - orig);
 }
 
+unsigned int varint_size(const uint64_t value)
+{
+    uint64_t val = value >> 7;
+
+    unsigned int size = 1;
+
+    while (val != 0)
+    {
+        val = val >> 7;
+
+        size++;
+    }
+
+    return size;
+}
+
 unsigned int encode_varint(unsigned char *output, const uint64_t value, const size_t max_length)
 {
+    // the size is known up front so the room is only checked once
+    const unsigned int size = varint_size(value);
+
+    if (size > max_length)
+    {
+        THROW(ERR_VARINT_DATA_RANGE);
+    }
+
     uint64_t val = value;
 
-    unsigned int length = 0;
+    unsigned int length;
 
-    while (val >= 0x80)
+    for (length = 0; length < size - 1; length++)
     {
-        if (length == (max_length - 1))
-        {
-            THROW(ERR_VARINT_DATA_RANGE);
-        }
-
         output[length] = (val & 0x7f) | 0x80;
 
         val = val >> 7;
-
-        length++;
     }
 
     output[length] = val;
 
-    return length + 1;
+    return size;
 }
 
 unsigned int decode_varint(const unsigned char *varint, const size_t max_length, uint64_t *value)
 {
+    const size_t limit = (max_length < VARINT_MAX_SIZE) ? max_length : VARINT_MAX_SIZE;
+
     uint64_t val = 0;
 
     unsigned int length = 0;
 
     while ((varint[length]) & 0x80)
     {
-        if (length == (max_length - 1))
+        if (length + 1 >= limit)
         {
             THROW(ERR_VARINT_DATA_RANGE);
         }
 
-        val = val + (((varint[length]) & 0x7f) << (length * 7));
+        val = val | (((uint64_t)(varint[length]) & 0x7f) << (length * 7));
 
         length++;
     }
 
-    val = val + (((varint[length]) & 0x7f) << (length * 7));
+    // the last byte of the longest varint only has room for the top bit of the value
+    if (length == VARINT_MAX_SIZE - 1 && varint[length] > 1)
+    {
+        THROW(ERR_VARINT_DATA_RANGE);
+    }
+
+    val = val | (((uint64_t)(varint[length]) & 0x7f) << (length * 7));
 
     *value = val;
 
     return length + 1;
+}
+
+unsigned int decode_canonical_varint(const unsigned char *varint, const size_t max_length, uint64_t *value)
+{
+    const size_t length = (max_length < VARINT_MAX_SIZE) ? max_length : VARINT_MAX_SIZE;
+
+    size_t size = 0;
+
+    while (size < length && (varint[size] & 0x80))
+    {
+        size++;
+    }
+
+    if (size == length)
+    {
+        return 0;
+    }
+
+    // a trailing zero byte pads the value out and a tenth byte can only carry the top bit
+    if ((size != 0 && varint[size] == 0) || (size == 9 && varint[size] > 1))
+    {
+        return 0;
+    }
+
+    return decode_varint(varint, size + 1, value);
 }
\ No newline at end of file
@@ -21,10 +21,29 @@
 
 #include <common.h>
 
+#define VARINT_MAX_SIZE 10 // bytes, of a 64-bit value
+
 unsigned int ptrLength(const unsigned char *ptr);
 
+/**
+ * The exact size of the varint of a value, which is what encode_varint writes for it
+ */
+unsigned int varint_size(const uint64_t value);
+
 unsigned int encode_varint(unsigned char *output, const uint64_t value, const size_t max_length);
 
+/**
+ * Decodes a varint of no more than max_length bytes, one that runs past VARINT_MAX_SIZE bytes or past
+ * 64 bits throws ERR_VARINT_DATA_RANGE
+ * @returns the size of the varint
+ */
 unsigned int decode_varint(const unsigned char *varint, const size_t max_length, uint64_t *value);
 
+/**
+ * Decodes a varint of no more than max_length bytes, only the shortest encoding of a value that fits in
+ * 64 bits is accepted so that the bytes are exactly what encode_varint would have written
+ * @returns the size of the varint, or 0 if there is no valid varint there
+ */
+unsigned int decode_canonical_varint(const unsigned char *varint, const size_t max_length, uint64_t *value);
+
 #endif // VARINT_H
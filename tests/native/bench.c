@@ -0,0 +1,747 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * Times the hw_* functions of the application on the host and counts the calls that each
+ * makes into the SDK. The host timings only rank the functions against each other, the
+ * call counts carry over to a device as they are
+ *
+ * Usage: ./bench [iterations] [operation]
+ */
+
+#include "shim.h"
+
+#include <apdu_tx_input_load.h>
+#include <base58.h>
+#include <cache.h>
+#include <hw_crypto.h>
+#include <idle.h>
+#include <keys.h>
+#include <stdlib.h>
+#include <time.h>
+#include <transaction.h>
+#include <utils.h>
+
+#define RING_SIZE 4
+
+// enough inputs that the transaction does not fit in RAM and is checkpointed
+#define TX_INPUTS 4
+
+// the inputs that are loaded by a single request have to fit in the working set together
+#define LOAD_RING_SIZE 2
+#define LOAD_INPUT_SIZE (KEY_SIZE + 1 + 8 + (LOAD_RING_SIZE * (KEY_SIZE + 4)) + 1)
+
+typedef struct bench_fixture_s
+{
+    unsigned char private_spend[KEY_SIZE];
+    unsigned char public_spend[KEY_SIZE];
+    unsigned char private_view[KEY_SIZE];
+    unsigned char public_view[KEY_SIZE];
+    unsigned char spend_point[SIG_STR_SIZE];
+    unsigned char view8[SCALAR8_LOADED_SIZE];
+    unsigned char tx_public_key[KEY_SIZE];
+    unsigned char derivation[KEY_SIZE];
+    unsigned char output_key[KEY_SIZE];
+    unsigned char private_ephemeral[KEY_SIZE];
+    unsigned char key_image[KEY_SIZE];
+    unsigned char digest[KEY_SIZE];
+    unsigned char signature[SIG_SIZE];
+    unsigned char ring[RING_SIZE * KEY_SIZE];
+    unsigned char ring_signatures[RING_SIZE * SIG_SIZE];
+    unsigned char sealed[SIG_SIZE + KEY_SIZE];
+} bench_fixture_t;
+
+static bench_fixture_t F;
+
+static const size_t C_output_index = 2;
+
+static uint16_t bench_keccak()
+{
+    unsigned char hash[KEY_SIZE];
+
+    return hw_keccak(F.digest, KEY_SIZE, hash);
+}
+
+static uint16_t bench_retrieve_private_spend_key()
+{
+    unsigned char key[KEY_SIZE];
+
+    return hw_retrieve_private_spend_key(key, 0);
+}
+
+static uint16_t bench_generate_private_view_key()
+{
+    unsigned char key[KEY_SIZE];
+
+    return hw_generate_private_view_key(key, F.private_spend);
+}
+
+static uint16_t bench_private_key_to_public_key()
+{
+    unsigned char key[KEY_SIZE];
+
+    return hw_private_key_to_public_key(key, F.private_spend);
+}
+
+static uint16_t bench_generate_keypair()
+{
+    unsigned char public[KEY_SIZE], private[KEY_SIZE];
+
+    return hw_generate_keypair(public, private);
+}
+
+// the answers of the checks depend on the keys that the run happened to make, only their cost is of interest
+static uint16_t bench_check_key()
+{
+    hw_check_key(F.public_spend);
+
+    return OP_OK;
+}
+
+static uint16_t bench_check_scalar()
+{
+    hw_check_scalar(F.private_spend);
+
+    return OP_OK;
+}
+
+static uint16_t bench_generate_key_derivation()
+{
+    unsigned char derivation[KEY_SIZE];
+
+    return hw_generate_key_derivation(derivation, F.tx_public_key, F.private_view);
+}
+
+static uint16_t bench_generate_key_derivation_loaded()
+{
+    unsigned char derivation[KEY_SIZE];
+
+    return hw_generate_key_derivation_loaded(derivation, F.tx_public_key, F.view8);
+}
+
+static uint16_t bench_generate_key_derivations()
+{
+    unsigned char derivations[RING_SIZE * KEY_SIZE];
+
+    return hw_generate_key_derivations(derivations, F.ring, RING_SIZE, F.private_view);
+}
+
+static uint16_t bench_derive_public_key()
+{
+    unsigned char key[KEY_SIZE];
+
+    return hw_derive_public_key(key, F.derivation, C_output_index, F.spend_point);
+}
+
+static uint16_t bench_derive_secret_key()
+{
+    unsigned char key[KEY_SIZE];
+
+    return hw_derive_secret_key(key, F.derivation, C_output_index, F.private_spend);
+}
+
+static uint16_t bench_generate_key_image()
+{
+    unsigned char key_image[KEY_SIZE];
+
+    return hw_generate_key_image(
+        key_image, F.tx_public_key, C_output_index, F.output_key, F.view8, F.private_spend, F.spend_point);
+}
+
+static uint16_t bench_generate_key_image_primitive()
+{
+    unsigned char key_image[KEY_SIZE];
+
+    return hw_generate_key_image_primitive(
+        key_image, F.derivation, C_output_index, F.output_key, F.private_spend, F.spend_point);
+}
+
+static uint16_t bench_generate_signature()
+{
+    unsigned char signature[SIG_SIZE];
+
+    return hw_generate_signature(signature, F.digest, F.public_spend, F.private_spend);
+}
+
+static uint16_t bench_check_signature()
+{
+    // a valid signature is reported as 1
+    return (hw_check_signature(F.digest, F.public_spend, F.signature) == 1) ? OP_OK : OP_NOK;
+}
+
+static uint16_t bench_generate_ring_signatures()
+{
+    unsigned char signatures[RING_SIZE * SIG_SIZE];
+
+    return hw_generate_ring_signatures(
+        signatures,
+        F.tx_public_key,
+        C_output_index,
+        F.output_key,
+        F.digest,
+        F.ring,
+        0,
+        F.view8,
+        F.private_spend,
+        F.spend_point);
+}
+
+static uint16_t bench_check_ring_signatures()
+{
+    // a valid ring is reported as 1
+    return (hw_check_ring_signatures(F.digest, F.key_image, F.ring, F.ring_signatures) == 1) ? OP_OK : OP_NOK;
+}
+
+// every ring member is decompressed and hashed again, as it is for a ring that has not been seen lately
+static uint16_t bench_check_ring_signatures_cold()
+{
+    cache_reset();
+
+    return bench_check_ring_signatures();
+}
+
+static uint16_t bench_base58_encode()
+{
+    unsigned char address[BASE58_ADDRESS_STR_SIZE];
+
+    // the bytes of the ring stand in for a raw address
+    return base58_encode(F.ring, address);
+}
+
+static uint16_t bench_seal()
+{
+    unsigned char sealed[SIG_SIZE + KEY_SIZE];
+
+    return hw_seal(sealed, F.signature, SIG_SIZE, F.private_view, 1);
+}
+
+static uint16_t bench_unseal()
+{
+    unsigned char unsealed[SIG_SIZE];
+
+    return hw_unseal(unsealed, F.sealed, SIG_SIZE, F.private_view, 1);
+}
+
+typedef struct bench_s
+{
+    const char *name;
+    uint16_t (*run)();
+} bench_t;
+
+static const bench_t C_benchmarks[] = {
+    {"hw_keccak", bench_keccak},
+    {"hw_retrieve_private_spend_key", bench_retrieve_private_spend_key},
+    {"hw_generate_private_view_key", bench_generate_private_view_key},
+    {"hw_private_key_to_public_key", bench_private_key_to_public_key},
+    {"hw_generate_keypair", bench_generate_keypair},
+    {"hw_check_key", bench_check_key},
+    {"hw_check_scalar", bench_check_scalar},
+    {"hw_generate_key_derivation", bench_generate_key_derivation},
+    {"hw_generate_key_derivation_loaded", bench_generate_key_derivation_loaded},
+    {"hw_generate_key_derivations", bench_generate_key_derivations},
+    {"hw_derive_public_key", bench_derive_public_key},
+    {"hw_derive_secret_key", bench_derive_secret_key},
+    {"hw_generate_key_image", bench_generate_key_image},
+    {"hw_generate_key_image_primitive", bench_generate_key_image_primitive},
+    {"hw_generate_signature", bench_generate_signature},
+    {"hw_check_signature", bench_check_signature},
+    {"hw_generate_ring_signatures", bench_generate_ring_signatures},
+    {"hw_check_ring_signatures", bench_check_ring_signatures},
+    {"hw_check_ring_signatures_cold", bench_check_ring_signatures_cold},
+    {"base58_encode", bench_base58_encode},
+    {"hw_seal", bench_seal},
+    {"hw_unseal", bench_unseal}};
+
+static void check(const bool condition, const char *what)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "setup failed: %s\n", what);
+
+        exit(1);
+    }
+}
+
+/**
+ * Builds a wallet, an output that belongs to it and a ring that spends it, checking the
+ * results against each other so that a broken shim is caught before anything is timed
+ */
+static void setup()
+{
+    unsigned char scratch[KEY_SIZE];
+
+    // keccak("") is a published test vector
+    static const unsigned char empty_hash[KEY_SIZE] = {
+        0xc5, 0xd2, 0x46, 0x01, 0x86, 0xf7, 0x23, 0x3c, 0x92, 0x7e, 0x7d, 0xb2, 0xdc, 0xc7, 0x03, 0xc0,
+        0xe5, 0x00, 0xb6, 0x53, 0xca, 0x82, 0x27, 0x3b, 0x7b, 0xfa, 0xd8, 0x04, 0x5d, 0x85, 0xa4, 0x70};
+
+    check(hw_keccak(NULL, 0, scratch) == OP_OK && memcmp(scratch, empty_hash, KEY_SIZE) == 0, "keccak");
+
+    // the reciprocal is exact over the whole range that a base58 digit and the next byte can take
+    for (uint32_t x = 0; x < 58 * 256; x++)
+    {
+        check(DIV58(x) == x / 58, "base58 division");
+    }
+
+    // 1 * G is the base point, y = 4/5
+    unsigned char one[KEY_SIZE] = {1};
+
+    check(hw_private_key_to_public_key(scratch, one) == OP_OK && scratch[0] == 0x58 && scratch[31] == 0x66, "1 * G");
+
+    check(hw_retrieve_private_spend_key(F.private_spend, 0) == OP_OK, "spend key");
+
+    check(hw_private_key_to_public_key(F.public_spend, F.private_spend) == OP_OK, "public spend key");
+
+    check(hw_generate_private_view_key(F.private_view, F.private_spend) == OP_OK, "view key");
+
+    check(hw_private_key_to_public_key(F.public_view, F.private_view) == OP_OK, "public view key");
+
+    check(hw_check_key(F.public_spend) && !hw_check_key(F.private_spend), "public key checked");
+
+    // y = p is the point y = 0 but not in the encoding that compressing it gives back
+    unsigned char non_canonical[KEY_SIZE];
+
+    memset(non_canonical, 0xff, KEY_SIZE);
+
+    non_canonical[0] = 0xed;
+
+    non_canonical[31] = 0x7f;
+
+    check(!hw_check_key(non_canonical), "non-canonical public key refused");
+
+    check(hw_wallet_constants(F.spend_point, F.view8, F.public_spend, F.private_view) == OP_OK, "wallet constants");
+
+    // an output sent to the wallet: D = 8rA, P = Hs(D || n)G + B
+    unsigned char r[KEY_SIZE];
+
+    check(hw_generate_keypair(F.tx_public_key, r) == OP_OK, "transaction key");
+
+    check(hw_generate_key_derivation(F.derivation, F.public_view, r) == OP_OK, "sender derivation");
+
+    check(hw_derive_public_key(F.output_key, F.derivation, C_output_index, F.spend_point) == OP_OK, "output key");
+
+    check(hw_generate_key_derivation(scratch, F.tx_public_key, F.private_view) == OP_OK
+              && memcmp(scratch, F.derivation, KEY_SIZE) == 0,
+          "receiver derivation");
+
+    check(hw_generate_key_derivation_loaded(scratch, F.tx_public_key, F.view8) == OP_OK
+              && memcmp(scratch, F.derivation, KEY_SIZE) == 0,
+          "receiver derivation from 8 * a");
+
+    check(hw_derive_secret_key(F.private_ephemeral, F.derivation, C_output_index, F.private_spend) == OP_OK,
+          "output secret key");
+
+    check(hw_private_key_to_public_key(scratch, F.private_ephemeral) == OP_OK
+              && memcmp(scratch, F.output_key, KEY_SIZE) == 0,
+          "x * G = P");
+
+    check(hw_generate_key_image(
+              F.key_image, F.tx_public_key, C_output_index, F.output_key, F.view8, F.private_spend, F.spend_point)
+              == OP_OK,
+          "key image");
+
+    check(hw_keccak(F.output_key, KEY_SIZE, F.digest) == OP_OK, "digest");
+
+    check(hw_generate_signature(F.signature, F.digest, F.public_spend, F.private_spend) == OP_OK, "signature");
+
+    check(bench_check_signature() == OP_OK, "signature verifies");
+
+    memcpy(F.ring, F.output_key, KEY_SIZE);
+
+    for (size_t i = 1; i < RING_SIZE; i++)
+    {
+        check(hw_generate_keypair(F.ring + (i * KEY_SIZE), scratch) == OP_OK, "decoy");
+    }
+
+    check(hw_generate_ring_signatures(
+              F.ring_signatures,
+              F.tx_public_key,
+              C_output_index,
+              F.output_key,
+              F.digest,
+              F.ring,
+              0,
+              F.view8,
+              F.private_spend,
+              F.spend_point)
+              == OP_OK,
+          "ring signatures");
+
+    check(bench_check_ring_signatures() == OP_OK, "ring signatures verify");
+
+    // an output that was not sent to us is refused with its own status
+    unsigned char scratch_signatures[RING_SIZE * SIG_SIZE];
+
+    check(hw_generate_ring_signatures(
+              scratch_signatures,
+              F.tx_public_key,
+              C_output_index + 1,
+              F.output_key,
+              F.digest,
+              F.ring,
+              0,
+              F.view8,
+              F.private_spend,
+              F.spend_point)
+              == ERR_PUBKEY_MISMATCH,
+          "ring signatures of another output");
+
+    check(hw_complete_ring_signature(
+              scratch_signatures,
+              F.tx_public_key,
+              C_output_index + 1,
+              F.output_key,
+              one,
+              F.view8,
+              F.private_spend,
+              F.spend_point)
+              == ERR_PUBKEY_MISMATCH,
+          "ring signature of another output");
+
+    unsigned char derivations[RING_SIZE * KEY_SIZE];
+
+    check(hw_generate_key_derivations(derivations, F.ring, RING_SIZE, F.private_view) == OP_OK, "derivations");
+
+    for (size_t i = 0; i < RING_SIZE; i++)
+    {
+        check(hw_generate_key_derivation(scratch, F.ring + (i * KEY_SIZE), F.private_view) == OP_OK
+                  && memcmp(scratch, derivations + (i * KEY_SIZE), KEY_SIZE) == 0,
+              "derivations match");
+    }
+
+    check(hw_seal(F.sealed, F.signature, SIG_SIZE, F.private_view, 1) == OP_OK, "seal");
+
+    check(bench_unseal() == OP_OK, "unseal");
+}
+
+/**
+ * Loads a transaction that spends an output of each of the given rings up to its prefix hash,
+ * with enough inputs that it does not fit in RAM and is checkpointed to NVRAM
+ */
+static void setup_transaction_prefix(
+    const unsigned char *tx_public_key,
+    const unsigned char *rings,
+    unsigned char *hash)
+{
+    unsigned char key[KEY_SIZE] = {0};
+
+    const uint32_t offsets[RING_SIZE] = {100, 1, 2, 3};
+
+    check(
+        tx_start(0, TX_INPUTS, 1, RING_SIZE, 2, tx_public_key, 0, tx_public_key, 0, 0) == OP_OK
+            && tx_start_input_load() == OP_OK,
+        "transaction start");
+
+    for (size_t i = 0; i < TX_INPUTS; i++)
+    {
+        check(
+            tx_load_input(
+                tx_public_key, i, 1000000, rings + (i * RING_SIZE * KEY_SIZE), offsets, i % RING_SIZE, NULL)
+                == OP_OK,
+            "transaction input");
+    }
+
+    check(tx_start_output_load() == OP_OK && tx_load_output(1000000, key) == OP_OK, "transaction output");
+
+    // the outputs are free to change until signing starts
+    check(tx_reload_outputs() == OP_OK && tx_state() == TX_INPUTS_RECEIVED, "transaction reload");
+
+    check(
+        tx_start_output_load() == OP_OK && tx_load_output((TX_INPUTS * 1000000) - 10, key) == OP_OK
+            && tx_finalize_prefix() == OP_OK && tx_prefix_hash(hash) == OP_OK,
+        "transaction prefix");
+}
+
+/**
+ * Loads the inputs of a transaction one at a time and then all of them in the fixed format of a
+ * single APDU_TX_LOAD_INPUT, which has to find every input at its own offset in the payload for
+ * both to end up with the same prefix hash
+ */
+static void setup_transaction_input_load(const unsigned char *tx_public_key, const unsigned char *rings)
+{
+    unsigned char keys[TX_INPUTS * LOAD_RING_SIZE * KEY_SIZE], hash[KEY_SIZE], loaded_hash[KEY_SIZE];
+
+    unsigned char payload[TX_INPUTS * LOAD_INPUT_SIZE], key[KEY_SIZE] = {0};
+
+    const uint32_t offsets[LOAD_RING_SIZE] = {100, 1};
+
+    volatile unsigned int flags = 0, tx = 0;
+
+    // the ring of input i is the output it spends followed by a decoy
+    for (size_t i = 0; i < TX_INPUTS; i++)
+    {
+        const unsigned char *ring = rings + (i * RING_SIZE * KEY_SIZE);
+
+        memcpy(keys + (i * LOAD_RING_SIZE * KEY_SIZE), ring + ((i % RING_SIZE) * KEY_SIZE), KEY_SIZE);
+
+        memcpy(keys + (((i * LOAD_RING_SIZE) + 1) * KEY_SIZE), ring + (((i + 1) % RING_SIZE) * KEY_SIZE), KEY_SIZE);
+    }
+
+    for (size_t by_request = 0; by_request < 2; by_request++)
+    {
+        check(
+            tx_start(0, TX_INPUTS, 1, LOAD_RING_SIZE, 2, tx_public_key, 0, tx_public_key, 0, 0) == OP_OK
+                && tx_start_input_load() == OP_OK,
+            "input load start");
+
+        for (size_t i = 0; i < TX_INPUTS; i++)
+        {
+            const unsigned char *ring = keys + (i * LOAD_RING_SIZE * KEY_SIZE);
+
+            if (by_request == 0)
+            {
+                check(tx_load_input(tx_public_key, i, 1000000, ring, offsets, 0, NULL) == OP_OK, "input loaded alone");
+
+                continue;
+            }
+
+            // tx_public_key || output_index || amount || public_keys || offsets || real_output_index
+            unsigned char *input = payload + (i * LOAD_INPUT_SIZE);
+
+            memcpy(input, tx_public_key, KEY_SIZE);
+
+            input[KEY_SIZE] = i;
+
+            for (size_t j = 0; j < sizeof(uint64_t); j++)
+            {
+                input[KEY_SIZE + 1 + j] = (uint8_t)((uint64_t)1000000 >> (56 - (8 * j)));
+            }
+
+            memcpy(input + KEY_SIZE + 9, ring, LOAD_RING_SIZE * KEY_SIZE);
+
+            for (size_t j = 0; j < LOAD_RING_SIZE; j++)
+            {
+                uint32ToChar(input + KEY_SIZE + 9 + (LOAD_RING_SIZE * KEY_SIZE) + (j * 4), offsets[j]);
+            }
+
+            input[LOAD_INPUT_SIZE - 1] = 0;
+        }
+
+        if (by_request == 1)
+        {
+            handle_tx_input_load(0, APDU_TX_INPUT_LOAD_P2_FIXED, payload, sizeof(payload), &flags, &tx);
+        }
+
+        check(tx_state() == TX_INPUTS_RECEIVED, "inputs loaded");
+
+        check(
+            tx_start_output_load() == OP_OK && tx_load_output((TX_INPUTS * 1000000) - 10, key) == OP_OK
+                && tx_finalize_prefix() == OP_OK && tx_prefix_hash((by_request == 0) ? hash : loaded_hash) == OP_OK
+                && tx_reset() == OP_OK,
+            "input load prefix");
+    }
+
+    check(memcmp(hash, loaded_hash, KEY_SIZE) == 0, "inputs loaded by one request");
+}
+
+/**
+ * Signs a transaction ahead of its approval. Until it is approved the transaction is not in the
+ * signing state, so once rejected its outputs can still be reloaded, and once approved the
+ * signing picks up where the review left it
+ */
+static void setup_transaction_speculation(const unsigned char *tx_public_key, const unsigned char *rings)
+{
+    unsigned char prefix_hash[KEY_SIZE];
+
+    setup_transaction_prefix(tx_public_key, rings, prefix_hash);
+
+    check(tx_speculate_begin() == OP_OK && tx_speculating(), "transaction speculated");
+
+    idle_tick();
+
+    check(tx_signed_input_count() == 1 && tx_state() == TX_PREFIX_READY, "transaction ready while speculated");
+
+    check(tx_speculate_abort() == OP_OK && !tx_speculating() && tx_signed_input_count() == 0, "speculation aborted");
+
+    check(tx_reload_outputs() == OP_OK, "transaction reload after a rejection");
+
+    check(tx_reset() == OP_OK, "transaction reset");
+
+    setup_transaction_prefix(tx_public_key, rings, prefix_hash);
+
+    check(tx_speculate_begin() == OP_OK, "transaction speculated");
+
+    for (size_t i = 0; i < TX_INPUTS; i++)
+    {
+        idle_tick();
+    }
+
+    check(tx_signed_input_count() == TX_INPUTS && tx_state() == TX_PREFIX_READY, "transaction speculated whole");
+
+    check(tx_sign() == OP_OK && !tx_speculating() && tx_state() == TX_COMPLETE, "speculated transaction approved");
+
+    check(tx_reset() == OP_OK, "transaction reset");
+}
+
+/**
+ * Signs an input from mixins prepared by the host, a mixin whose points are not in their
+ * canonical encoding is refused before anything of the input is committed
+ */
+static void setup_transaction_mixins(const unsigned char *tx_public_key, const unsigned char *rings)
+{
+    unsigned char prefix_hash[KEY_SIZE], mixins[(RING_SIZE - 1) * TX_MIXIN_SIZE] = {0};
+
+    for (size_t i = 0; i < RING_SIZE - 1; i++)
+    {
+        unsigned char *record = mixins + (i * TX_MIXIN_SIZE);
+
+        record[0] = 1;
+
+        record[KEY_SIZE] = 1;
+
+        memcpy(record + (2 * KEY_SIZE), PTR_SPEND_PUBLIC, KEY_SIZE);
+
+        memcpy(record + (3 * KEY_SIZE), PTR_SPEND_PUBLIC, KEY_SIZE);
+    }
+
+    // L of the last mixin is y = p (see setup)
+    unsigned char *point = mixins + ((RING_SIZE - 2) * TX_MIXIN_SIZE) + (2 * KEY_SIZE);
+
+    memset(point, 0xff, KEY_SIZE);
+
+    point[0] = 0xed;
+
+    point[31] = 0x7f;
+
+    setup_transaction_prefix(tx_public_key, rings, prefix_hash);
+
+    check(
+        tx_sign_begin(false) == OP_OK && tx_sign_next_input(mixins) == ERR_TX_MIXIN && tx_signed_input_count() == 0,
+        "non-canonical mixin refused");
+
+    memcpy(point, PTR_SPEND_PUBLIC, KEY_SIZE);
+
+    check(tx_sign_next_input(mixins) == OP_OK && tx_signed_input_count() == 1, "input signed from mixins");
+
+    check(tx_reset() == OP_OK, "transaction reset");
+}
+
+/**
+ * Signs part of a transaction and loses it as a power cut would. Once resumed its outputs can no
+ * longer be reloaded, as the inputs would then be signed again with the same nonces for another
+ * prefix hash which gives the private ephemerals away, and a transaction whose signatures were
+ * streamed to the host is not resumed at all
+ */
+static void setup_transaction()
+{
+    unsigned char r[KEY_SIZE], tx_public_key[KEY_SIZE], derivation[KEY_SIZE], scratch[KEY_SIZE];
+
+    unsigned char rings[TX_INPUTS * RING_SIZE * KEY_SIZE], prefix_hash[KEY_SIZE], resumed_hash[KEY_SIZE];
+
+    unsigned char signatures[RING_SIZE * SIG_SIZE];
+
+    check(init_keys() == OP_OK && init_tx() == OP_OK, "transaction keys");
+
+    check(hw_generate_keypair(tx_public_key, r) == OP_OK, "transaction key");
+
+    check(hw_generate_key_derivation(derivation, PTR_VIEW_PUBLIC, r) == OP_OK, "transaction derivation");
+
+    // input i spends output i of the transaction, the rest of its ring are decoys
+    for (size_t i = 0; i < TX_INPUTS * RING_SIZE; i++)
+    {
+        check(hw_generate_keypair(rings + (i * KEY_SIZE), scratch) == OP_OK, "transaction decoy");
+    }
+
+    for (size_t i = 0; i < TX_INPUTS; i++)
+    {
+        unsigned char *real = rings + (((i * RING_SIZE) + (i % RING_SIZE)) * KEY_SIZE);
+
+        check(hw_derive_public_key(real, derivation, i, PTR_SPEND_POINT) == OP_OK, "transaction output key");
+    }
+
+    setup_transaction_prefix(tx_public_key, rings, prefix_hash);
+
+    check(tx_sign_begin(false) == OP_OK && tx_sign_inputs(1) == OP_OK, "transaction partly signed");
+
+    check(init_tx() == OP_OK && tx_resume() == OP_OK && tx_state() == TX_PREFIX_READY, "transaction resume");
+
+    check(tx_reload_outputs() == ERR_TRANSACTION_STATE, "transaction reload refused after signing");
+
+    check(
+        tx_prefix_hash(resumed_hash) == OP_OK && memcmp(prefix_hash, resumed_hash, KEY_SIZE) == 0
+            && tx_sign() == OP_OK && tx_state() == TX_COMPLETE,
+        "transaction signed again for the same prefix");
+
+    check(tx_reset() == OP_OK, "transaction reset");
+
+    setup_transaction_prefix(tx_public_key, rings, prefix_hash);
+
+    check(tx_sign_begin(true) == OP_OK && tx_sign_stream_input(signatures, rings) == OP_OK, "transaction streamed");
+
+    check(init_tx() == OP_OK && tx_resume() == ERR_TX_RESUME && tx_state() == TX_UNUSED, "streamed resume refused");
+
+    check(tx_resume() == ERR_TX_RESUME, "streamed checkpoint dropped");
+
+    check(tx_reset() == OP_OK, "transaction reset");
+
+    setup_transaction_speculation(tx_public_key, rings);
+
+    setup_transaction_mixins(tx_public_key, rings);
+
+    setup_transaction_input_load(tx_public_key, rings);
+}
+
+static double now_us()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (ts.tv_sec * 1e6) + (ts.tv_nsec / 1e3);
+}
+
+int main(int argc, char **argv)
+{
+    const unsigned int iterations = (argc > 1) ? (unsigned int)atoi(argv[1]) : 20;
+
+    const char *only = (argc > 2) ? argv[2] : NULL;
+
+    shim_seed_rng(1984);
+
+    setup();
+
+    setup_transaction();
+
+    printf("%-32s %12s  %s\n", "operation", "us/op", "SDK calls per op");
+
+    for (size_t i = 0; i < sizeof(C_benchmarks) / sizeof(bench_t); i++)
+    {
+        const bench_t *bench = &C_benchmarks[i];
+
+        if (only != NULL && strcmp(only, bench->name) != 0)
+        {
+            continue;
+        }
+
+        shim_reset_calls();
+
+        const double start = now_us();
+
+        for (unsigned int j = 0; j < iterations; j++)
+        {
+            if (bench->run() != OP_OK)
+            {
+                fprintf(stderr, "%s failed\n", bench->name);
+
+                return 1;
+            }
+        }
+
+        const double elapsed = now_us() - start;
+
+        printf("%-32s %12.1f ", bench->name, elapsed / iterations);
+
+        for (size_t k = 0; k < SHIM_CALLS; k++)
+        {
+            if (G_shim_calls[k] != 0)
+            {
+                printf(" %s=%.1f", C_shim_call_names[k], (double)G_shim_calls[k] / iterations);
+            }
+        }
+
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,878 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * A software stand in for the cx_* crypto library of the SDK. It favours being short and
+ * obviously correct over being fast: the modular arithmetic is schoolbook multiplication
+ * with bitwise long division, the curve is done in extended coordinates with a single
+ * inversion per call and nothing here runs in constant time. It must never be used to
+ * handle real keys
+ */
+
+#include "cx.h"
+#include "shim.h"
+
+#define BN_LIMBS 32 // the longest number handled is a product of two 64-byte values
+
+#define LIMBS(len) (((len) + 3) / 4)
+
+static uint64_t L_rng_state = 0x5475727466c65ULL;
+
+static void bn_from_be(uint32_t *r, const size_t limbs, const unsigned char *in, const size_t len)
+{
+    memset(r, 0, limbs * sizeof(uint32_t));
+
+    for (size_t i = 0; i < len; i++)
+    {
+        r[i / 4] |= (uint32_t)in[len - 1 - i] << (8 * (i % 4));
+    }
+}
+
+static void bn_to_be(unsigned char *out, const size_t len, const uint32_t *a)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        out[len - 1 - i] = (unsigned char)(a[i / 4] >> (8 * (i % 4)));
+    }
+}
+
+static int bn_cmp(const uint32_t *a, const uint32_t *b, const size_t limbs)
+{
+    for (size_t i = limbs; i-- > 0;)
+    {
+        if (a[i] != b[i])
+        {
+            return (a[i] > b[i]) ? 1 : -1;
+        }
+    }
+
+    return 0;
+}
+
+static uint32_t bn_add(uint32_t *r, const uint32_t *a, const uint32_t *b, const size_t limbs)
+{
+    uint64_t carry = 0;
+
+    for (size_t i = 0; i < limbs; i++)
+    {
+        carry += (uint64_t)a[i] + b[i];
+
+        r[i] = (uint32_t)carry;
+
+        carry >>= 32;
+    }
+
+    return (uint32_t)carry;
+}
+
+static uint32_t bn_sub(uint32_t *r, const uint32_t *a, const uint32_t *b, const size_t limbs)
+{
+    int64_t borrow = 0;
+
+    for (size_t i = 0; i < limbs; i++)
+    {
+        borrow += (int64_t)a[i] - b[i];
+
+        r[i] = (uint32_t)borrow;
+
+        borrow >>= 32;
+    }
+
+    return (uint32_t)(borrow & 1);
+}
+
+/**
+ * r = a mod m, by shifting a into the remainder a bit at a time
+ */
+static void bn_mod(uint32_t *r, const uint32_t *a, const size_t a_limbs, const uint32_t *m, const size_t m_limbs)
+{
+    uint32_t rem[BN_LIMBS + 1] = {0};
+
+    uint32_t mod[BN_LIMBS + 1] = {0};
+
+    memcpy(mod, m, m_limbs * sizeof(uint32_t));
+
+    for (size_t bit = a_limbs * 32; bit-- > 0;)
+    {
+        for (size_t i = m_limbs + 1; i-- > 1;)
+        {
+            rem[i] = (rem[i] << 1) | (rem[i - 1] >> 31);
+        }
+
+        rem[0] = (rem[0] << 1) | ((a[bit / 32] >> (bit % 32)) & 1);
+
+        if (bn_cmp(rem, mod, m_limbs + 1) >= 0)
+        {
+            bn_sub(rem, rem, mod, m_limbs + 1);
+        }
+    }
+
+    memcpy(r, rem, m_limbs * sizeof(uint32_t));
+}
+
+static void bn_mul(uint32_t *r, const uint32_t *a, const uint32_t *b, const size_t limbs)
+{
+    uint32_t w[BN_LIMBS] = {0};
+
+    for (size_t i = 0; i < limbs; i++)
+    {
+        uint64_t carry = 0;
+
+        for (size_t j = 0; j < limbs; j++)
+        {
+            carry += (uint64_t)a[i] * b[j] + w[i + j];
+
+            w[i + j] = (uint32_t)carry;
+
+            carry >>= 32;
+        }
+
+        w[i + limbs] = (uint32_t)carry;
+    }
+
+    memcpy(r, w, 2 * limbs * sizeof(uint32_t));
+}
+
+static void bn_mulm(uint32_t *r, const uint32_t *a, const uint32_t *b, const uint32_t *m, const size_t limbs)
+{
+    uint32_t product[BN_LIMBS];
+
+    bn_mul(product, a, b, limbs);
+
+    bn_mod(r, product, 2 * limbs, m, limbs);
+}
+
+int cx_math_is_zero(const unsigned char *a, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH]++;
+
+    unsigned char bits = 0;
+
+    for (unsigned int i = 0; i < len; i++)
+    {
+        bits |= a[i];
+    }
+
+    return bits == 0;
+}
+
+int cx_math_cmp(const unsigned char *a, const unsigned char *b, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH]++;
+
+    return memcmp(a, b, len);
+}
+
+int cx_math_add(unsigned char *r, const unsigned char *a, const unsigned char *b, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH]++;
+
+    uint32_t x[BN_LIMBS], y[BN_LIMBS];
+
+    bn_from_be(x, LIMBS(len), a, len);
+
+    bn_from_be(y, LIMBS(len), b, len);
+
+    const uint32_t carry = bn_add(x, x, y, LIMBS(len));
+
+    bn_to_be(r, len, x);
+
+    return (int)carry;
+}
+
+int cx_math_sub(unsigned char *r, const unsigned char *a, const unsigned char *b, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH]++;
+
+    uint32_t x[BN_LIMBS], y[BN_LIMBS];
+
+    bn_from_be(x, LIMBS(len), a, len);
+
+    bn_from_be(y, LIMBS(len), b, len);
+
+    const uint32_t borrow = bn_sub(x, x, y, LIMBS(len));
+
+    bn_to_be(r, len, x);
+
+    return (int)borrow;
+}
+
+void cx_math_addm(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *m,
+                  unsigned int len)
+{
+    G_shim_calls[SHIM_MATH_ADDM]++;
+
+    uint32_t x[BN_LIMBS], y[BN_LIMBS], mod[BN_LIMBS];
+
+    const size_t limbs = LIMBS(len);
+
+    bn_from_be(x, limbs + 1, a, len);
+
+    bn_from_be(y, limbs + 1, b, len);
+
+    bn_from_be(mod, limbs, m, len);
+
+    bn_add(x, x, y, limbs + 1);
+
+    bn_mod(x, x, limbs + 1, mod, limbs);
+
+    bn_to_be(r, len, x);
+}
+
+void cx_math_subm(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *m,
+                  unsigned int len)
+{
+    G_shim_calls[SHIM_MATH_SUBM]++;
+
+    uint32_t x[BN_LIMBS], y[BN_LIMBS], mod[BN_LIMBS];
+
+    const size_t limbs = LIMBS(len);
+
+    bn_from_be(x, limbs, a, len);
+
+    bn_from_be(y, limbs, b, len);
+
+    bn_from_be(mod, limbs, m, len);
+
+    bn_mod(x, x, limbs, mod, limbs);
+
+    bn_mod(y, y, limbs, mod, limbs);
+
+    if (bn_sub(x, x, y, limbs))
+    {
+        bn_add(x, x, mod, limbs);
+    }
+
+    bn_to_be(r, len, x);
+}
+
+void cx_math_multm(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *m,
+                   unsigned int len)
+{
+    G_shim_calls[SHIM_MATH_MULTM]++;
+
+    uint32_t x[BN_LIMBS], y[BN_LIMBS], mod[BN_LIMBS];
+
+    const size_t limbs = LIMBS(len);
+
+    bn_from_be(x, limbs, a, len);
+
+    bn_from_be(y, limbs, b, len);
+
+    bn_from_be(mod, limbs, m, len);
+
+    bn_mulm(x, x, y, mod, limbs);
+
+    bn_to_be(r, len, x);
+}
+
+void cx_math_mult(unsigned char *r, const unsigned char *a, const unsigned char *b, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH_MULT]++;
+
+    uint32_t x[BN_LIMBS], y[BN_LIMBS], product[BN_LIMBS];
+
+    const size_t limbs = LIMBS(len);
+
+    bn_from_be(x, limbs, a, len);
+
+    bn_from_be(y, limbs, b, len);
+
+    bn_mul(product, x, y, limbs);
+
+    bn_to_be(r, 2 * len, product);
+}
+
+void cx_math_modm(unsigned char *v, unsigned int len_v, const unsigned char *m, unsigned int len_m)
+{
+    G_shim_calls[SHIM_MATH_MODM]++;
+
+    uint32_t x[BN_LIMBS], mod[BN_LIMBS];
+
+    bn_from_be(x, LIMBS(len_v), v, len_v);
+
+    bn_from_be(mod, LIMBS(len_m), m, len_m);
+
+    bn_mod(x, x, LIMBS(len_v), mod, LIMBS(len_m));
+
+    // the remainder goes in the low bytes of v and the rest of v is cleared
+    memset(v, 0, len_v);
+
+    bn_to_be(v + len_v - len_m, len_m, x);
+}
+
+static void bn_powm(uint32_t *r, const uint32_t *a, const unsigned char *e, const size_t len_e, const uint32_t *m,
+                    const size_t limbs)
+{
+    uint32_t result[BN_LIMBS] = {1};
+
+    for (size_t i = 0; i < len_e * 8; i++)
+    {
+        bn_mulm(result, result, result, m, limbs);
+
+        if ((e[i / 8] >> (7 - (i % 8))) & 1)
+        {
+            bn_mulm(result, result, a, m, limbs);
+        }
+    }
+
+    memcpy(r, result, limbs * sizeof(uint32_t));
+}
+
+void cx_math_powm(unsigned char *r, const unsigned char *a, const unsigned char *e, unsigned int len_e,
+                  const unsigned char *m, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH_POWM]++;
+
+    uint32_t x[BN_LIMBS], mod[BN_LIMBS];
+
+    const size_t limbs = LIMBS(len);
+
+    bn_from_be(x, limbs, a, len);
+
+    bn_from_be(mod, limbs, m, len);
+
+    bn_mod(x, x, limbs, mod, limbs);
+
+    bn_powm(x, x, e, len_e, mod, limbs);
+
+    bn_to_be(r, len, x);
+}
+
+void cx_math_invprimem(unsigned char *r, const unsigned char *a, const unsigned char *m, unsigned int len)
+{
+    G_shim_calls[SHIM_MATH_INVPRIMEM]++;
+
+    uint32_t x[BN_LIMBS], mod[BN_LIMBS], two[BN_LIMBS] = {2}, exponent[BN_LIMBS];
+
+    unsigned char e[BN_LIMBS * 4] = {0};
+
+    const size_t limbs = LIMBS(len);
+
+    bn_from_be(x, limbs, a, len);
+
+    bn_from_be(mod, limbs, m, len);
+
+    // a^-1 = a^(m - 2) mod m for a prime m
+    bn_sub(exponent, mod, two, limbs);
+
+    bn_to_be(e, len, exponent);
+
+    bn_mod(x, x, limbs, mod, limbs);
+
+    bn_powm(x, x, e, len, mod, limbs);
+
+    bn_to_be(r, len, x);
+}
+
+/**
+ * Field elements mod p = 2^255 - 19 as eight little-endian 32-bit limbs, always fully reduced
+ */
+typedef uint32_t fe[8];
+
+static const fe C_p = {
+    0xffffffed, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7fffffff};
+
+// p - 2, (p + 3) / 8 and (p - 1) / 4 as big-endian exponents
+static const unsigned char C_p_minus_2[32] = {
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb};
+
+static const unsigned char C_p_plus_3_div_8[32] = {
+    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe};
+
+static const unsigned char C_p_minus_1_div_4[32] = {
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb};
+
+static fe L_d, L_d2, L_sqrtm1;
+
+static bool L_curve_ready = false;
+
+static void fe_reduce_once(fe r)
+{
+    if (bn_cmp(r, C_p, 8) >= 0)
+    {
+        bn_sub(r, r, C_p, 8);
+    }
+}
+
+static void fe_add(fe r, const fe a, const fe b)
+{
+    bn_add(r, a, b, 8);
+
+    fe_reduce_once(r);
+}
+
+static void fe_sub(fe r, const fe a, const fe b)
+{
+    if (bn_sub(r, a, b, 8))
+    {
+        bn_add(r, r, C_p, 8);
+    }
+}
+
+static void fe_mul(fe r, const fe a, const fe b)
+{
+    uint32_t w[16];
+
+    uint32_t s[9];
+
+    uint64_t carry = 0;
+
+    bn_mul(w, a, b, 8);
+
+    // 2^256 = 38 mod p
+    for (size_t i = 0; i < 8; i++)
+    {
+        carry += (uint64_t)w[i] + (uint64_t)w[i + 8] * 38;
+
+        s[i] = (uint32_t)carry;
+
+        carry >>= 32;
+    }
+
+    s[8] = (uint32_t)carry;
+
+    // 2^255 = 19 mod p
+    carry = (((uint64_t)s[8] << 1) | (s[7] >> 31)) * 19;
+
+    s[7] &= 0x7fffffff;
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        carry += s[i];
+
+        r[i] = (uint32_t)carry;
+
+        carry >>= 32;
+    }
+
+    fe_reduce_once(r);
+}
+
+static void fe_pow(fe r, const fe a, const unsigned char *e)
+{
+    fe result = {1}, base;
+
+    memcpy(base, a, sizeof(fe));
+
+    for (size_t i = 0; i < 256; i++)
+    {
+        fe_mul(result, result, result);
+
+        if ((e[i / 8] >> (7 - (i % 8))) & 1)
+        {
+            fe_mul(result, result, base);
+        }
+    }
+
+    memcpy(r, result, sizeof(fe));
+}
+
+static void fe_invert(fe r, const fe a)
+{
+    fe_pow(r, a, C_p_minus_2);
+}
+
+static bool fe_is_zero(const fe a)
+{
+    uint32_t bits = 0;
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        bits |= a[i];
+    }
+
+    return bits == 0;
+}
+
+static void curve_init(void)
+{
+    if (L_curve_ready)
+    {
+        return;
+    }
+
+    fe numerator = {121665}, denominator = {121666}, zero = {0}, two = {2};
+
+    // d = -121665 / 121666
+    fe_invert(denominator, denominator);
+
+    fe_mul(L_d, numerator, denominator);
+
+    fe_sub(L_d, zero, L_d);
+
+    fe_add(L_d2, L_d, L_d);
+
+    // sqrt(-1) = 2^((p - 1) / 4)
+    fe_pow(L_sqrtm1, two, C_p_minus_1_div_4);
+
+    L_curve_ready = true;
+}
+
+/**
+ * A point in extended coordinates (x = X / Z, y = Y / Z, x * y = T / Z)
+ */
+typedef struct ge_s
+{
+    fe X, Y, Z, T;
+} ge_t;
+
+static void ge_from_affine(ge_t *r, const unsigned char *point)
+{
+    // 0x04 || x || y, both big-endian
+    bn_from_be(r->X, 8, point + 1, 32);
+
+    bn_from_be(r->Y, 8, point + 33, 32);
+
+    memset(r->Z, 0, sizeof(fe));
+
+    r->Z[0] = 1;
+
+    fe_mul(r->T, r->X, r->Y);
+}
+
+static void ge_to_affine(unsigned char *point, const ge_t *p)
+{
+    fe inverse, x, y;
+
+    fe_invert(inverse, p->Z);
+
+    fe_mul(x, p->X, inverse);
+
+    fe_mul(y, p->Y, inverse);
+
+    point[0] = 0x04;
+
+    bn_to_be(point + 1, 32, x);
+
+    bn_to_be(point + 33, 32, y);
+}
+
+/**
+ * r = p + q with the unified formula for a = -1, which also doubles
+ */
+static void ge_add(ge_t *r, const ge_t *p, const ge_t *q)
+{
+    fe a, b, c, d, e, f, g, h, t;
+
+    fe_sub(a, p->Y, p->X);
+
+    fe_sub(t, q->Y, q->X);
+
+    fe_mul(a, a, t);
+
+    fe_add(b, p->Y, p->X);
+
+    fe_add(t, q->Y, q->X);
+
+    fe_mul(b, b, t);
+
+    fe_mul(c, p->T, q->T);
+
+    fe_mul(c, c, L_d2);
+
+    fe_mul(d, p->Z, q->Z);
+
+    fe_add(d, d, d);
+
+    fe_sub(e, b, a);
+
+    fe_sub(f, d, c);
+
+    fe_add(g, d, c);
+
+    fe_add(h, b, a);
+
+    fe_mul(r->X, e, f);
+
+    fe_mul(r->Y, g, h);
+
+    fe_mul(r->T, e, h);
+
+    fe_mul(r->Z, f, g);
+}
+
+int cx_ecfp_add_point(int curve, unsigned char *r, const unsigned char *p, const unsigned char *q, unsigned int len)
+{
+    (void)curve;
+
+    G_shim_calls[SHIM_ECFP_ADD_POINT]++;
+
+    curve_init();
+
+    ge_t a, b;
+
+    ge_from_affine(&a, p);
+
+    ge_from_affine(&b, q);
+
+    ge_add(&a, &a, &b);
+
+    ge_to_affine(r, &a);
+
+    return (int)len;
+}
+
+int cx_ecfp_scalar_mult(int curve, unsigned char *p, unsigned int p_len, const unsigned char *k, unsigned int k_len)
+{
+    (void)curve;
+
+    G_shim_calls[SHIM_ECFP_SCALAR_MULT]++;
+
+    curve_init();
+
+    ge_t base, result = {{0}, {1}, {1}, {0}};
+
+    ge_from_affine(&base, p);
+
+    for (size_t i = 0; i < k_len * 8; i++)
+    {
+        ge_add(&result, &result, &result);
+
+        if ((k[i / 8] >> (7 - (i % 8))) & 1)
+        {
+            ge_add(&result, &result, &base);
+        }
+    }
+
+    ge_to_affine(p, &result);
+
+    return (int)p_len;
+}
+
+void cx_edward_compress_point(int curve, unsigned char *p, unsigned int len)
+{
+    (void)curve;
+    (void)len;
+
+    G_shim_calls[SHIM_EDWARD_COMPRESS]++;
+
+    unsigned char x_lsb = p[32] & 1;
+
+    unsigned char y[32];
+
+    // the encoding is y little-endian with the low bit of x in its top bit
+    for (size_t i = 0; i < 32; i++)
+    {
+        y[i] = p[64 - i];
+    }
+
+    y[31] |= (unsigned char)(x_lsb << 7);
+
+    p[0] = 0x02;
+
+    memcpy(p + 1, y, 32);
+
+    memset(p + 33, 0, 32);
+}
+
+void cx_edward_decompress_point(int curve, unsigned char *p, unsigned int len)
+{
+    (void)curve;
+    (void)len;
+
+    G_shim_calls[SHIM_EDWARD_DECOMPRESS]++;
+
+    curve_init();
+
+    unsigned char encoded[32];
+
+    fe y, x, u, v, check, one = {1}, zero = {0};
+
+    memcpy(encoded, p + 1, 32);
+
+    const unsigned char sign = encoded[31] >> 7;
+
+    encoded[31] &= 0x7f;
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        y[i] = (uint32_t)encoded[4 * i] | ((uint32_t)encoded[4 * i + 1] << 8) | ((uint32_t)encoded[4 * i + 2] << 16)
+               | ((uint32_t)encoded[4 * i + 3] << 24);
+    }
+
+    fe_reduce_once(y);
+
+    // x^2 = (y^2 - 1) / (d * y^2 + 1)
+    fe_mul(u, y, y);
+
+    fe_mul(v, u, L_d);
+
+    fe_sub(u, u, one);
+
+    fe_add(v, v, one);
+
+    fe_invert(v, v);
+
+    fe_mul(u, u, v);
+
+    fe_pow(x, u, C_p_plus_3_div_8);
+
+    fe_mul(check, x, x);
+
+    if (bn_cmp(check, u, 8) != 0)
+    {
+        fe_mul(x, x, L_sqrtm1);
+
+        fe_mul(check, x, x);
+
+        if (bn_cmp(check, u, 8) != 0)
+        {
+            THROW(INVALID_PARAMETER);
+        }
+    }
+
+    if (fe_is_zero(x) && sign)
+    {
+        THROW(INVALID_PARAMETER);
+    }
+
+    if ((x[0] & 1) != sign)
+    {
+        fe_sub(x, zero, x);
+    }
+
+    p[0] = 0x04;
+
+    bn_to_be(p + 1, 32, x);
+
+    bn_to_be(p + 33, 32, y);
+}
+
+static const uint64_t C_keccak_round_constants[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+static const unsigned int C_keccak_rotations[25] = {
+    0, 1, 62, 28, 27, 36, 44, 6, 55, 20, 3, 10, 43, 25, 39, 41, 45, 15, 21, 8, 18, 2, 61, 56, 14};
+
+static uint64_t rotl64(const uint64_t x, const unsigned int n)
+{
+    return (n == 0) ? x : ((x << n) | (x >> (64 - n)));
+}
+
+static void keccakf(uint64_t *a)
+{
+    for (size_t round = 0; round < 24; round++)
+    {
+        uint64_t c[5], b[25];
+
+        for (size_t x = 0; x < 5; x++)
+        {
+            c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+        }
+
+        for (size_t x = 0; x < 5; x++)
+        {
+            const uint64_t d = c[(x + 4) % 5] ^ rotl64(c[(x + 1) % 5], 1);
+
+            for (size_t y = 0; y < 25; y += 5)
+            {
+                a[y + x] ^= d;
+            }
+        }
+
+        // rho and pi: the lane at (x, y) moves to (y, 2x + 3y)
+        for (size_t x = 0; x < 5; x++)
+        {
+            for (size_t y = 0; y < 5; y++)
+            {
+                b[y + 5 * ((2 * x + 3 * y) % 5)] = rotl64(a[x + 5 * y], C_keccak_rotations[x + 5 * y]);
+            }
+        }
+
+        for (size_t y = 0; y < 25; y += 5)
+        {
+            for (size_t x = 0; x < 5; x++)
+            {
+                a[y + x] = b[y + x] ^ ((~b[y + (x + 1) % 5]) & b[y + (x + 2) % 5]);
+            }
+        }
+
+        a[0] ^= C_keccak_round_constants[round];
+    }
+}
+
+int cx_keccak_init(cx_sha3_t *hash, unsigned int size)
+{
+    G_shim_calls[SHIM_KECCAK_INIT]++;
+
+    memset(hash, 0, sizeof(cx_sha3_t));
+
+    hash->output_size = size / 8;
+
+    hash->block_size = 200 - (2 * hash->output_size);
+
+    return 0;
+}
+
+int cx_hash(cx_hash_t *hash, int mode, const unsigned char *in, unsigned int len, unsigned char *out,
+            unsigned int out_len)
+{
+    G_shim_calls[SHIM_HASH]++;
+
+    cx_sha3_t *context = (cx_sha3_t *)hash;
+
+    // the lanes are absorbed as little-endian bytes, which is how the host holds them
+    unsigned char *state = (unsigned char *)context->acc;
+
+    for (unsigned int i = 0; i < len; i++)
+    {
+        state[context->blen++] ^= in[i];
+
+        if (context->blen == context->block_size)
+        {
+            keccakf(context->acc);
+
+            context->blen = 0;
+        }
+    }
+
+    if ((mode & CX_LAST) == 0)
+    {
+        return 0;
+    }
+
+    // the original Keccak padding, not the one of SHA-3
+    state[context->blen] ^= 0x01;
+
+    state[context->block_size - 1] ^= 0x80;
+
+    keccakf(context->acc);
+
+    memcpy(out, state, MIN(out_len, context->output_size));
+
+    return (int)context->output_size;
+}
+
+void shim_seed_rng(uint64_t seed)
+{
+    L_rng_state = seed;
+}
+
+unsigned char *cx_rng(unsigned char *buffer, unsigned int len)
+{
+    G_shim_calls[SHIM_RNG]++;
+
+    for (unsigned int i = 0; i < len; i++)
+    {
+        // splitmix64, a byte at a time
+        uint64_t z = (L_rng_state += 0x9e3779b97f4a7c15ULL);
+
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+        buffer[i] = (unsigned char)(z ^ (z >> 31));
+    }
+
+    return buffer;
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * The parts of the BOLOS cx.h that the crypto core of the application uses, backed by the
+ * software implementation in cx.c for the native host build. The conventions are those
+ * of the SDK: numbers are big-endian byte strings and uncompressed points are
+ * 0x04 || x || y with both coordinates big-endian
+ */
+
+#ifndef SHIM_CX_H
+#define SHIM_CX_H
+
+#include <os.h>
+
+#define CX_LAST (1 << 0)
+
+typedef struct cx_hash_s
+{
+    unsigned int algo;
+    unsigned int counter;
+} cx_hash_t;
+
+typedef struct cx_sha3_s
+{
+    cx_hash_t header;
+    unsigned int output_size;
+    unsigned int block_size;
+    unsigned int blen;
+    unsigned char block[200];
+    uint64_t acc[25];
+} cx_sha3_t;
+
+int cx_keccak_init(cx_sha3_t *hash, unsigned int size);
+
+int cx_hash(
+    cx_hash_t *hash,
+    int mode,
+    const unsigned char *in,
+    unsigned int len,
+    unsigned char *out,
+    unsigned int out_len);
+
+unsigned char *cx_rng(unsigned char *buffer, unsigned int len);
+
+int cx_math_is_zero(const unsigned char *a, unsigned int len);
+
+int cx_math_cmp(const unsigned char *a, const unsigned char *b, unsigned int len);
+
+int cx_math_add(unsigned char *r, const unsigned char *a, const unsigned char *b, unsigned int len);
+
+int cx_math_sub(unsigned char *r, const unsigned char *a, const unsigned char *b, unsigned int len);
+
+void cx_math_addm(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *m,
+                  unsigned int len);
+
+void cx_math_subm(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *m,
+                  unsigned int len);
+
+void cx_math_multm(unsigned char *r, const unsigned char *a, const unsigned char *b, const unsigned char *m,
+                   unsigned int len);
+
+void cx_math_mult(unsigned char *r, const unsigned char *a, const unsigned char *b, unsigned int len);
+
+void cx_math_modm(unsigned char *v, unsigned int len_v, const unsigned char *m, unsigned int len_m);
+
+void cx_math_powm(unsigned char *r, const unsigned char *a, const unsigned char *e, unsigned int len_e,
+                  const unsigned char *m, unsigned int len);
+
+void cx_math_invprimem(unsigned char *r, const unsigned char *a, const unsigned char *m, unsigned int len);
+
+int cx_ecfp_add_point(int curve, unsigned char *r, const unsigned char *p, const unsigned char *q, unsigned int len);
+
+int cx_ecfp_scalar_mult(int curve, unsigned char *p, unsigned int p_len, const unsigned char *k, unsigned int k_len);
+
+void cx_edward_compress_point(int curve, unsigned char *p, unsigned int len);
+
+void cx_edward_decompress_point(int curve, unsigned char *p, unsigned int len);
+
+#endif // SHIM_CX_H
@@ -0,0 +1,8 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+#ifndef SHIM_GLYPHS_H
+#define SHIM_GLYPHS_H
+
+#endif // SHIM_GLYPHS_H
@@ -0,0 +1,133 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * The parts of the BOLOS os.h that the crypto core of the application uses, for the
+ * native host build (see ../Makefile). The exception model is the one of the SDK:
+ * a THROW unwinds to the innermost open TRY through setjmp/longjmp
+ */
+
+#ifndef SHIM_OS_H
+#define SHIM_OS_H
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define WIDE
+#define PIC(x) ((void *)(x))
+#define UNUSED(x) (void)(x)
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#define U2BE(buf, off) ((uint16_t)(((buf)[off] << 8) | (buf)[(off) + 1]))
+#define U4BE(buf, off) ((uint32_t)(((uint32_t)U2BE(buf, off) << 16) | U2BE(buf, (off) + 2)))
+
+#define EXCEPTION 1
+#define INVALID_PARAMETER 2
+#define EXCEPTION_IO_RESET 0x10
+
+typedef unsigned short exception_t;
+
+typedef struct try_context_s
+{
+    jmp_buf jmp_buf;
+    struct try_context_s *previous;
+    exception_t ex;
+} try_context_t;
+
+extern try_context_t *G_try_last_open_context;
+
+__attribute__((noreturn)) void os_longjmp(unsigned int exception);
+
+#define THROW(x) os_longjmp(x)
+
+#define BEGIN_TRY_L(L) \
+    { \
+        try_context_t __try##L;
+
+#define TRY_L(L) \
+    __try##L.ex = setjmp(__try##L.jmp_buf); \
+    if (__try##L.ex == 0) \
+    { \
+        __try##L.previous = G_try_last_open_context; \
+        G_try_last_open_context = &__try##L;
+
+#define CATCH_L(L, x) \
+    goto __FINALLY##L; \
+    } \
+    else if (__try##L.ex == (x)) \
+    { \
+        G_try_last_open_context = __try##L.previous; \
+        __try##L.ex = 0;
+
+#define CATCH_OTHER_L(L, e) \
+    goto __FINALLY##L; \
+    } \
+    else \
+    { \
+        exception_t e = __try##L.ex; \
+        (void)e; \
+        G_try_last_open_context = __try##L.previous; \
+        __try##L.ex = 0;
+
+#define CATCH_ALL_L(L) CATCH_OTHER_L(L, __ignored##L)
+
+#define FINALLY_L(L) \
+    goto __FINALLY##L; \
+    } \
+    __FINALLY##L: \
+    if (G_try_last_open_context == &__try##L) \
+    { \
+        G_try_last_open_context = __try##L.previous; \
+    }
+
+#define END_TRY_L(L) \
+    if (__try##L.ex != 0) \
+    { \
+        THROW(__try##L.ex); \
+    } \
+    }
+
+#define CLOSE_TRY_L(L) G_try_last_open_context = __try##L.previous
+
+#define BEGIN_TRY BEGIN_TRY_L(0)
+#define TRY TRY_L(0)
+#define CATCH(x) CATCH_L(0, x)
+#define CATCH_OTHER(e) CATCH_OTHER_L(0, e)
+#define CATCH_ALL CATCH_ALL_L(0)
+#define FINALLY FINALLY_L(0)
+#define END_TRY END_TRY_L(0)
+#define CLOSE_TRY CLOSE_TRY_L(0)
+
+#define PRINTF(...)
+#define SPRINTF(buf, ...) sprintf((char *)(buf), __VA_ARGS__)
+
+#define os_memmove memmove
+#define os_memcmp memcmp
+#define os_memset memset
+
+void explicit_bzero(void *s, size_t n);
+
+void nvm_write(void *destination, void *source, unsigned int size);
+
+#define HDW_NORMAL 0
+#define CX_CURVE_Ed25519 0x41
+
+void os_perso_derive_node_bip32(
+    unsigned int curve,
+    const uint32_t *path,
+    unsigned int path_length,
+    unsigned char *private_key,
+    unsigned char *chain);
+
+#endif // SHIM_OS_H
@@ -0,0 +1,23 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * The native host build has no transport, only what the shared sources name
+ */
+
+#ifndef SHIM_OS_IO_SEPROXYHAL_H
+#define SHIM_OS_IO_SEPROXYHAL_H
+
+#include <os.h>
+
+#define IO_APDU_BUFFER_SIZE 480
+
+#define CHANNEL_APDU 0
+#define IO_RETURN_AFTER_TX 0x20
+
+extern unsigned char G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+
+unsigned short io_exchange(unsigned char channel, unsigned short tx_len);
+
+#endif // SHIM_OS_IO_SEPROXYHAL_H
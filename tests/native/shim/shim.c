@@ -0,0 +1,128 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * The operating system side of the native host build: exceptions, NVRAM, the key
+ * derivation of the secure element and the IO that the shared sources name but
+ * that a microbenchmark never reaches
+ */
+
+#include "shim.h"
+
+#include <common.h>
+#include <stdlib.h>
+
+uint64_t G_shim_calls[SHIM_CALLS];
+
+const char *const C_shim_call_names[SHIM_CALLS] = {"cx_keccak_init",
+                                                   "cx_hash",
+                                                   "cx_rng",
+                                                   "cx_math",
+                                                   "cx_math_addm",
+                                                   "cx_math_subm",
+                                                   "cx_math_multm",
+                                                   "cx_math_mult",
+                                                   "cx_math_modm",
+                                                   "cx_math_powm",
+                                                   "cx_math_invprimem",
+                                                   "cx_ecfp_add_point",
+                                                   "cx_ecfp_scalar_mult",
+                                                   "cx_edward_compress_point",
+                                                   "cx_edward_decompress_point",
+                                                   "nvm_write",
+                                                   "nvm_write_bytes"};
+
+try_context_t *G_try_last_open_context = NULL;
+
+unsigned char G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+
+void shim_reset_calls(void)
+{
+    memset(G_shim_calls, 0, sizeof(G_shim_calls));
+}
+
+void os_longjmp(unsigned int exception)
+{
+    if (G_try_last_open_context == NULL)
+    {
+        fprintf(stderr, "uncaught exception 0x%04x\n", exception);
+
+        exit(1);
+    }
+
+    longjmp(G_try_last_open_context->jmp_buf, (int)exception);
+}
+
+void nvm_write(void *destination, void *source, unsigned int size)
+{
+    G_shim_calls[SHIM_NVM_WRITE]++;
+
+    G_shim_calls[SHIM_NVM_WRITE_BYTES] += size;
+
+    if (source == NULL)
+    {
+        memset(destination, 0, size);
+    }
+    else
+    {
+        memmove(destination, source, size);
+    }
+}
+
+void os_perso_derive_node_bip32(
+    unsigned int curve,
+    const uint32_t *path,
+    unsigned int path_length,
+    unsigned char *private_key,
+    unsigned char *chain)
+{
+    (void)curve;
+
+    // not BIP-32, only a stable key per path so that every run works with the same wallet
+    uint64_t state = 0x54524c;
+
+    for (unsigned int i = 0; i < path_length; i++)
+    {
+        state = (state ^ path[i]) * 0x100000001b3ULL;
+    }
+
+    for (size_t i = 0; i < KEY_SIZE; i++)
+    {
+        state = (state ^ (state >> 29)) * 0xbf58476d1ce4e5b9ULL + i;
+
+        private_key[i] = (unsigned char)(state >> 32);
+
+        if (chain != NULL)
+        {
+            chain[i] = (unsigned char)(state >> 24);
+        }
+    }
+}
+
+unsigned short io_exchange(unsigned char channel, unsigned short tx_len)
+{
+    (void)channel;
+
+    return tx_len;
+}
+
+unsigned int bagl_label_roundtrip_duration_ms(const bagl_element_t *element, unsigned int average_char_width)
+{
+    (void)element;
+    (void)average_char_width;
+
+    return 0;
+}
+
+void ui_busy()
+{
+}
+
+void ui_idle()
+{
+}
+
+void ui_splash()
+{
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * Counts the calls made into the software SDK of the native host build. The SDK calls
+ * that an operation makes are a proxy for what it costs on a device, where every one
+ * of them is a round trip into the secure element's crypto library
+ */
+
+#ifndef SHIM_H
+#define SHIM_H
+
+#include <stdint.h>
+
+typedef enum shim_call_e
+{
+    SHIM_KECCAK_INIT = 0,
+    SHIM_HASH,
+    SHIM_RNG,
+    SHIM_MATH, // the comparisons, additions and subtractions without a modulus
+    SHIM_MATH_ADDM,
+    SHIM_MATH_SUBM,
+    SHIM_MATH_MULTM,
+    SHIM_MATH_MULT,
+    SHIM_MATH_MODM,
+    SHIM_MATH_POWM,
+    SHIM_MATH_INVPRIMEM,
+    SHIM_ECFP_ADD_POINT,
+    SHIM_ECFP_SCALAR_MULT,
+    SHIM_EDWARD_COMPRESS,
+    SHIM_EDWARD_DECOMPRESS,
+    SHIM_NVM_WRITE,
+    SHIM_NVM_WRITE_BYTES,
+    SHIM_CALLS
+} shim_call_t;
+
+extern uint64_t G_shim_calls[SHIM_CALLS];
+
+extern const char *const C_shim_call_names[SHIM_CALLS];
+
+/**
+ * Sets every call counter back to zero
+ */
+void shim_reset_calls(void);
+
+/**
+ * Restarts the random number generator behind cx_rng from a seed so that runs repeat
+ * @param seed the seed
+ */
+void shim_seed_rng(uint64_t seed);
+
+#endif // SHIM_H
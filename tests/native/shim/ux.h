@@ -0,0 +1,39 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+/**
+ * The native host build has no screen, only the types that the shared headers name
+ */
+
+#ifndef SHIM_UX_H
+#define SHIM_UX_H
+
+#include <os.h>
+
+typedef struct bagl_component_s
+{
+    unsigned char userid;
+} bagl_component_t;
+
+typedef struct bagl_element_s
+{
+    bagl_component_t component;
+    const char *text;
+} bagl_element_t;
+
+typedef struct ux_state_s
+{
+    unsigned int stack_count;
+} ux_state_t;
+
+typedef struct bolos_ux_params_s
+{
+    unsigned int ux_id;
+} bolos_ux_params_t;
+
+#define UX_CALLBACK_SET_INTERVAL(x) (void)(x)
+
+unsigned int bagl_label_roundtrip_duration_ms(const bagl_element_t *element, unsigned int average_char_width);
+
+#endif // SHIM_UX_H
@@ -0,0 +1,618 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { TCPTransport } from './TCPTransport';
+
+/**
+ * The commands of src/apdu.h that the client packs
+ */
+export enum Command {
+    RESOURCES = 0x07,
+    CAPABILITIES = 0x08,
+    PRIVATE_TO_PUBLIC = 0x18,
+    CHECK_KEYS = 0x1a,
+    GENERATE_KEYIMAGES = 0x42,
+    GENERATE_SIGNATURES = 0x53,
+    CHECK_SIGNATURES = 0x54,
+    SCAN_OUTPUTS = 0x63,
+    GENERATE_KEY_DERIVATIONS = 0x64,
+    CHECK_INPUTS = 0x65,
+    TX_LOAD_INPUT = 0x73,
+    TX_LOAD_OUTPUT = 0x75,
+    TX_RELOAD_OUTPUTS = 0x80,
+    GET_RESPONSE = 0xc0
+}
+
+/**
+ * What APDU_RESOURCES says about the build on the other end
+ */
+export interface Resources {
+    working_set_size: number;
+    chain_max_size: number;
+    io_buffer_size: number;
+    tx_pool_size: number;
+    tx_ram_size: number;
+    tx_max_dump_size: number;
+    tx_slots: number;
+    tx_max_inputs: number;
+    tx_max_outputs: number;
+    tx_max_ring_size: number;
+    tx_extra_max_size: number;
+    batches: { [ins: number]: number }; // the most items a single (chained) request of a command may carry
+}
+
+/**
+ * The primitives that APDU_CAPABILITIES calibrates, by P2
+ */
+export enum Primitive {
+    SCALARMULT_BASE = 0x00,
+    KEY_IMAGE = 0x01,
+    DERIVE_PUBLIC_KEY = 0x02,
+    KECCAK = 0x03,
+    RANDOM = 0x04,
+    NVM_PAGE = 0x05
+}
+
+/**
+ * What APDU_CAPABILITIES says about the build on the other end
+ */
+export interface Capabilities {
+    features: number; // the APDU_CAP_* bits of src/apdu_capabilities.h
+    runs: number; // the primitives that can be calibrated
+}
+
+/**
+ * An output as APDU_SCAN_OUTPUTS and APDU_GENERATE_KEYIMAGES take it
+ */
+export interface OutputReference {
+    tx_public_key: string;
+    output_index: number;
+    public_key: string;
+}
+
+/**
+ * An input as APDU_TX_LOAD_INPUT takes it
+ */
+export interface TransactionInput {
+    tx_public_key: string;
+    output_index: number;
+    amount: number;
+    ring: string[];
+    offsets: number[];
+    real_index: number;
+}
+
+/**
+ * An output as APDU_TX_LOAD_OUTPUT takes it
+ */
+export interface TransactionOutput {
+    amount: number;
+    key: string;
+}
+
+/** @ignore */
+const CLA = 0xe0;
+
+/** @ignore */
+const P1_CONFIRM = 0x01;
+
+/** @ignore */
+const P1_MORE = 0x80;
+
+/** @ignore */
+const P1_CALIBRATE = 0x01;
+
+/** @ignore */
+const APDU_MAX_DATA = 255;
+
+/** @ignore */
+const KEY_SIZE = 32;
+
+/** @ignore */
+const SIG_SIZE = 64;
+
+/** @ignore */
+const SEALED_INPUT_SIZE = 129;
+
+/** @ignore */
+const OUTPUT_GROUP_SIZE = KEY_SIZE + 1; // tx_public_key || count
+
+/** @ignore */
+const OUTPUT_SIZE = 4 + KEY_SIZE; // output_index || output_key
+
+/** @ignore */
+const SCAN_BITMAP_SIZE = 8;
+
+/** @ignore */
+const P2_COMPACT = 0x02;
+
+/** @ignore */
+const SAME_TX_KEY = 0x01;
+
+/** @ignore */
+function varint (value: number): Buffer {
+    const bytes: number[] = [];
+
+    while (value >= 0x80) {
+        bytes.push((value % 0x80) | 0x80);
+
+        value = Math.floor(value / 0x80);
+    }
+
+    bytes.push(value);
+
+    return Buffer.from(bytes);
+}
+
+/** @ignore */
+function uint64 (value: number): Buffer {
+    const result = Buffer.alloc(8);
+
+    result.writeUInt32BE(Math.floor(value / 0x100000000), 0);
+
+    result.writeUInt32BE(value % 0x100000000, 4);
+
+    return result;
+}
+
+/** @ignore */
+function bitmap (data: Buffer, count: number): boolean[] {
+    const result: boolean[] = [];
+
+    for (let i = 0; i < count; i++) {
+        result.push(((data[i >> 3] >> (i & 7)) & 1) === 1);
+    }
+
+    return result;
+}
+
+/** @ignore */
+function split (data: Buffer, size: number): string[] {
+    const result: string[] = [];
+
+    for (let i = 0; i + size <= data.length; i += size) {
+        result.push(data.slice(i, i + size).toString('hex'));
+    }
+
+    return result;
+}
+
+/**
+ * Takes high level operations and packs them into as few requests as the build on the other end
+ * (see APDU_RESOURCES) takes, chains the requests that do not fit in a single APDU, fetches the
+ * chunks of the responses that come back with 0x61XX and unpacks the results again, so that the
+ * test suite and the benchmarks fill the batched commands the way a host is meant to.
+ *
+ * The device only answers in chunks when the request was chained, so a request whose response
+ * is longer than an APDU is chained even when its payload would fit in one. The fragments of a
+ * request are handed to the transport all at once so that they go out as fast as
+ * TCPTransport.depth allows. A request that is not chained goes out right behind the one in
+ * front of it, while the requests that follow a chained one wait for its last chunk, as any
+ * other request in between would drop the rest of it
+ */
+export class ApduClient {
+    private readonly m_transport: TCPTransport;
+    private readonly m_resources: Resources;
+    private m_barrier: Promise<any> = Promise.resolve();
+
+    constructor (transport: TCPTransport, resources: Resources) {
+        this.m_transport = transport;
+
+        this.m_resources = resources;
+    }
+
+    /**
+     * Asks the device for its limits and makes a client that packs its requests to them
+     * @param transport the transport to the device
+     */
+    public static async open (transport: TCPTransport): Promise<ApduClient> {
+        const response = await transport.send(CLA, Command.RESOURCES, 0, 0);
+
+        const data = response.slice(0, response.length - 2);
+
+        const batches: { [ins: number]: number } = {};
+
+        for (let i = 0, offset = 28; i < data[27]; i++, offset += 3) {
+            batches[data[offset]] = data.readUInt16BE(offset + 1);
+        }
+
+        return new ApduClient(transport, {
+            working_set_size: data.readUInt16BE(0),
+            chain_max_size: data.readUInt16BE(2),
+            io_buffer_size: data.readUInt16BE(4),
+            tx_pool_size: data.readUInt16BE(6),
+            tx_ram_size: data.readUInt16BE(8),
+            tx_max_dump_size: data.readUInt16BE(10),
+            tx_slots: data[12],
+            tx_max_inputs: data[13],
+            tx_max_outputs: data[14],
+            tx_max_ring_size: data[15],
+            tx_extra_max_size: data[16],
+            batches
+        });
+    }
+
+    public get resources (): Resources {
+        return this.m_resources;
+    }
+
+    /**
+     * Sends a request of any size and returns the whole of its response, without the status word
+     * @param ins the command
+     * @param data the payload, chained when it does not fit in a single APDU
+     * @param p1 P1 of the command, P1_MORE is added to every fragment but the last
+     * @param p2 P2 of the command
+     * @param response_size how long the response is expected to be
+     */
+    public async request (
+        ins: number, data: Buffer = Buffer.alloc(0), p1 = 0, p2 = 0, response_size = 0): Promise<Buffer> {
+        const chained = data.length > APDU_MAX_DATA || (data.length !== 0 && response_size > APDU_MAX_DATA);
+
+        if (chained && data.length > this.m_resources.chain_max_size) {
+            throw new Error('The request does not fit in the working set of the device');
+        }
+
+        const barrier = this.m_barrier;
+
+        const operation = barrier.catch(() => undefined).then(() => this.exchange(ins, data, p1, p2, chained));
+
+        if (chained) {
+            this.m_barrier = operation;
+        }
+
+        return operation;
+    }
+
+    /**
+     * Asks the device which protocol paths it has (APDU_CAPABILITIES)
+     */
+    public async capabilities (): Promise<Capabilities> {
+        const data = await this.request(Command.CAPABILITIES);
+
+        return { features: data.readUInt32BE(0), runs: data[4] };
+    }
+
+    /**
+     * Puts a cost on a primitive for this very device by timing a request that runs it against
+     * one that does not, as the device has no clock of its own (APDU_CAPABILITIES)
+     * @param primitive what to run
+     * @param runs how many times to run it, every run of Primitive.NVM_PAGE wears a page of NVRAM
+     * so it is refused unless the app is a debug build and runs is 16 at most
+     * @returns the milliseconds that one run takes
+     */
+    public async calibrate (primitive: Primitive, runs = 16): Promise<number> {
+        const time = async (count: number) => {
+            const start = process.hrtime.bigint();
+
+            await this.request(Command.CAPABILITIES, Buffer.from([count]), P1_CALIBRATE, primitive);
+
+            return Number(process.hrtime.bigint() - start) / 1e6;
+        };
+
+        const overhead = await time(0);
+
+        return Math.max(0, (await time(runs)) - overhead) / runs;
+    }
+
+    /**
+     * Computes the public keys of many private keys (APDU_PRIVATE_TO_PUBLIC)
+     */
+    public async privateToPublic (private_keys: string[]): Promise<string[]> {
+        const results = await this.batch(private_keys, this.limit(Command.PRIVATE_TO_PUBLIC, KEY_SIZE),
+            keys => this.request(Command.PRIVATE_TO_PUBLIC, Buffer.concat(keys.map(key => Buffer.from(key, 'hex'))),
+                0, 0, keys.length * KEY_SIZE));
+
+        return ([] as string[]).concat(...results.map(data => split(data, KEY_SIZE)));
+    }
+
+    /**
+     * Checks many public keys, or scalars, at once (APDU_CHECK_KEYS)
+     */
+    public async checkKeys (keys: string[], scalars = false): Promise<boolean[]> {
+        const results = await this.batch(keys, Math.floor(this.m_resources.chain_max_size / KEY_SIZE),
+            batch => this.request(Command.CHECK_KEYS, Buffer.concat(batch.map(key => Buffer.from(key, 'hex'))),
+                0, (scalars) ? 0x01 : 0x00).then(data => bitmap(data, batch.length)));
+
+        return ([] as boolean[]).concat(...results);
+    }
+
+    /**
+     * Generates the key derivations of many transaction public keys (APDU_GENERATE_KEY_DERIVATIONS)
+     */
+    public async generateKeyDerivations (tx_public_keys: string[], confirm = true): Promise<string[]> {
+        const results = await this.batch(tx_public_keys, this.limit(Command.GENERATE_KEY_DERIVATIONS, KEY_SIZE),
+            keys => this.request(Command.GENERATE_KEY_DERIVATIONS,
+                Buffer.concat(keys.map(key => Buffer.from(key, 'hex'))), (confirm) ? P1_CONFIRM : 0, 0,
+                keys.length * KEY_SIZE));
+
+        return ([] as string[]).concat(...results.map(data => split(data, KEY_SIZE)));
+    }
+
+    /**
+     * Signs many message digests with the spend key (APDU_GENERATE_SIGNATURES)
+     */
+    public async generateSignatures (message_digests: string[], confirm = true): Promise<string[]> {
+        const results = await this.batch(message_digests, this.limit(Command.GENERATE_SIGNATURES, KEY_SIZE),
+            digests => this.request(Command.GENERATE_SIGNATURES,
+                Buffer.concat(digests.map(digest => Buffer.from(digest, 'hex'))), (confirm) ? P1_CONFIRM : 0, 0,
+                digests.length * SIG_SIZE));
+
+        return ([] as string[]).concat(...results.map(data => split(data, SIG_SIZE)));
+    }
+
+    /**
+     * Checks many signatures made with the same public key (APDU_CHECK_SIGNATURES)
+     */
+    public async checkSignatures (
+        public_key: string, entries: { message_digest: string, signature: string }[]): Promise<boolean[]> {
+        const entry_size = KEY_SIZE + SIG_SIZE;
+
+        const results = await this.batch(entries, Math.floor((this.m_resources.chain_max_size - KEY_SIZE) / entry_size),
+            batch => this.request(Command.CHECK_SIGNATURES, Buffer.concat([Buffer.from(public_key, 'hex')].concat(
+                ...batch.map(entry => [Buffer.from(entry.message_digest, 'hex'), Buffer.from(entry.signature, 'hex')]))))
+                .then(data => bitmap(data, batch.length)));
+
+        return ([] as boolean[]).concat(...results);
+    }
+
+    /**
+     * Checks which of the outputs belong to the wallet (APDU_SCAN_OUTPUTS), the outputs of the same
+     * transaction go together as long as they follow one another
+     */
+    public async scanOutputs (outputs: OutputReference[], confirm = true): Promise<boolean[]> {
+        const results = await Promise.all(this.packOutputs(Command.SCAN_OUTPUTS, outputs).map(async batch => {
+            const data = await this.request(Command.SCAN_OUTPUTS, batch.payload, (confirm) ? P1_CONFIRM : 0);
+
+            return bitmap(data.slice(0, SCAN_BITMAP_SIZE), batch.count);
+        }));
+
+        return ([] as boolean[]).concat(...results);
+    }
+
+    /**
+     * Generates the key images of many outputs of the wallet (APDU_GENERATE_KEYIMAGES), grouped
+     * as they are for scanOutputs
+     */
+    public async generateKeyImages (outputs: OutputReference[], confirm = true): Promise<string[]> {
+        const results = await Promise.all(this.packOutputs(Command.GENERATE_KEYIMAGES, outputs).map(
+            async batch => split(
+                await this.request(Command.GENERATE_KEYIMAGES, batch.payload, (confirm) ? P1_CONFIRM : 0, 0,
+                    batch.count * KEY_SIZE), KEY_SIZE)));
+
+        return ([] as string[]).concat(...results);
+    }
+
+    /**
+     * Checks inputs as APDU_TX_LOAD_INPUT would without loading them (APDU_CHECK_INPUTS), all of
+     * them with rings of the same size
+     * @returns the status of every input (0 if it passes) and its key image if it does
+     */
+    public async checkInputs (
+        inputs: TransactionInput[], confirm = true): Promise<{ status: number, key_image?: string }[]> {
+        if (inputs.length === 0) {
+            return [];
+        }
+
+        const ring_size = inputs[0].ring.length;
+
+        if (inputs.some(input => input.ring.length !== ring_size)) {
+            throw new Error('the rings of the inputs are not all the same size');
+        }
+
+        const result_size = 2 + KEY_SIZE;
+
+        const results = await this.batch(inputs, this.limit(Command.CHECK_INPUTS, KEY_SIZE + 2 + ring_size * KEY_SIZE),
+            batch => this.request(Command.CHECK_INPUTS, Buffer.concat(batch.map(input => Buffer.concat([
+                Buffer.from(input.tx_public_key, 'hex'),
+                Buffer.from([input.output_index, input.real_index]),
+                Buffer.concat(input.ring.map(key => Buffer.from(key, 'hex')))]))),
+            (confirm) ? P1_CONFIRM : 0, ring_size, batch.length * result_size));
+
+        return ([] as { status: number, key_image?: string }[]).concat(...results.map(data => {
+            return split(data, result_size).map(result => {
+                const status = parseInt(result.slice(0, 4), 16);
+
+                return (status === 0) ? { status, key_image: result.slice(4) } : { status };
+            });
+        }));
+    }
+
+    /**
+     * Loads the inputs of the transaction that was started (APDU_TX_LOAD_INPUT) in the compact format,
+     * as many to a request as fit in the working set
+     * @param inputs the inputs
+     * @param sealed whether the transaction was started with sealed inputs
+     * @returns the sealed input of every input if they are sealed
+     */
+    public async loadInputs (inputs: TransactionInput[], sealed = false): Promise<Buffer[]> {
+        const max_size = Math.min(this.m_resources.working_set_size - 2, this.m_resources.chain_max_size);
+
+        const batches: { payload: Buffer[], size: number, count: number, last_key: string }[] = [];
+
+        for (const input of inputs) {
+            let batch = batches[batches.length - 1];
+
+            const encode = (same_key: boolean) => {
+                return Buffer.concat([
+                    Buffer.from([(same_key) ? SAME_TX_KEY : 0x00]),
+                    (same_key) ? Buffer.alloc(0) : Buffer.from(input.tx_public_key, 'hex'),
+                    Buffer.from([input.output_index]),
+                    varint(input.amount),
+                    Buffer.concat(input.ring.map(key => Buffer.from(key, 'hex'))),
+                    Buffer.concat(input.offsets.map(offset => varint(offset))),
+                    Buffer.from([input.real_index])
+                ]);
+            };
+
+            let record = encode(!!batch && batch.last_key === input.tx_public_key);
+
+            /* sealed inputs are returned in place so they may never run ahead of the inputs they replace */
+            const fits = batch && batch.size + record.length <= max_size && batch.count < 255 &&
+                (!sealed || (batch.count + 1) * SEALED_INPUT_SIZE <= batch.size + record.length);
+
+            if (!fits) {
+                record = encode(false);
+
+                batch = { payload: [], size: 0, count: 0, last_key: '' };
+
+                batches.push(batch);
+            }
+
+            batch.payload.push(record);
+
+            batch.size += record.length;
+
+            batch.count++;
+
+            batch.last_key = input.tx_public_key;
+        }
+
+        const results: Buffer[] = [];
+
+        /* the inputs go in order, and the device refuses another request while it is still loading one */
+        for (const batch of batches) {
+            const data = await this.request(Command.TX_LOAD_INPUT, Buffer.concat(batch.payload), 0, P2_COMPACT,
+                (sealed) ? batch.count * SEALED_INPUT_SIZE : 0);
+
+            if (sealed) {
+                for (let i = 0; i < batch.count; i++) {
+                    results.push(data.slice(i * SEALED_INPUT_SIZE, (i + 1) * SEALED_INPUT_SIZE));
+                }
+            }
+        }
+
+        return results;
+    }
+
+    /**
+     * Loads the outputs of the transaction that was started (APDU_TX_LOAD_OUTPUT), as many to a
+     * request as the device takes
+     */
+    public async loadOutputs (outputs: TransactionOutput[]): Promise<void> {
+        const output_size = 8 + KEY_SIZE;
+
+        await this.batch(outputs, this.limit(Command.TX_LOAD_OUTPUT, output_size),
+            batch => this.request(Command.TX_LOAD_OUTPUT, Buffer.concat(([] as Buffer[]).concat(
+                ...batch.map(output => [uint64(output.amount), Buffer.from(output.key, 'hex')])))));
+    }
+
+    /**
+     * Rolls the transaction back to its inputs (APDU_TX_RELOAD_OUTPUTS) so that its outputs are
+     * loaded again from APDU_TX_START_OUTPUT_LOAD
+     */
+    public async reloadOutputs (): Promise<void> {
+        await this.request(Command.TX_RELOAD_OUTPUTS);
+    }
+
+    /**
+     * The most items of a batched command that fit in a request, as the device advertises it
+     * or as the size of a request allows when it does not
+     */
+    private limit (ins: number, item_size: number): number {
+        const fit = Math.floor(this.m_resources.chain_max_size / item_size);
+
+        return Math.max(1, Math.min(fit, this.m_resources.batches[ins] || fit));
+    }
+
+    /**
+     * Splits the items into requests of up to max_count items and sends them all at once
+     */
+    private async batch<T, R> (items: T[], max_count: number, send: (batch: T[]) => Promise<R>): Promise<R[]> {
+        const requests: Promise<R>[] = [];
+
+        for (let i = 0; i < items.length; i += max_count) {
+            requests.push(send(items.slice(i, i + max_count)));
+        }
+
+        return Promise.all(requests);
+    }
+
+    /**
+     * Groups the outputs by transaction, as many to a request as the device takes
+     */
+    private packOutputs (ins: number, outputs: OutputReference[]): { payload: Buffer, count: number }[] {
+        const max_count = this.limit(ins, OUTPUT_SIZE);
+
+        const batches: { payload: Buffer[], size: number, count: number, group?: Buffer }[] = [];
+
+        for (const output of outputs) {
+            let batch = batches[batches.length - 1];
+
+            const same = !!batch && !!batch.group && batch.group.slice(0, KEY_SIZE).toString('hex') ===
+                output.tx_public_key && batch.group[KEY_SIZE] < 255;
+
+            const size = OUTPUT_SIZE + ((same) ? 0 : OUTPUT_GROUP_SIZE);
+
+            if (!batch || batch.count === max_count || batch.size + size > this.m_resources.chain_max_size) {
+                batch = { payload: [], size: 0, count: 0 };
+
+                batches.push(batch);
+            }
+
+            if (!batch.group || !same) {
+                batch.group = Buffer.concat([Buffer.from(output.tx_public_key, 'hex'), Buffer.from([0])]);
+
+                batch.payload.push(batch.group);
+
+                batch.size += OUTPUT_GROUP_SIZE;
+            }
+
+            const entry = Buffer.alloc(OUTPUT_SIZE);
+
+            entry.writeUInt32BE(output.output_index, 0);
+
+            Buffer.from(output.public_key, 'hex').copy(entry, 4);
+
+            batch.payload.push(entry);
+
+            batch.group[KEY_SIZE]++;
+
+            batch.size += OUTPUT_SIZE;
+
+            batch.count++;
+        }
+
+        return batches.map(batch => {
+            return { payload: Buffer.concat(batch.payload), count: batch.count };
+        });
+    }
+
+    /**
+     * Sends the fragments of a request and fetches the chunks of its response
+     */
+    private async exchange (ins: number, data: Buffer, p1: number, p2: number, chained: boolean): Promise<Buffer> {
+        const pieces: Buffer[] = [];
+
+        for (let offset = 0; offset < data.length || pieces.length === 0; offset += APDU_MAX_DATA) {
+            pieces.push(data.slice(offset, offset + APDU_MAX_DATA));
+        }
+
+        /* a payload that fits in one fragment is chained by an empty last fragment */
+        if (chained && pieces.length === 1) {
+            pieces.push(Buffer.alloc(0));
+        }
+
+        const responses = await Promise.all(pieces.map((piece, i) => {
+            const last = i === pieces.length - 1;
+
+            return this.m_transport.exchange(Buffer.concat([
+                Buffer.from([CLA, ins, (last) ? p1 : p1 | P1_MORE, p2, piece.length]),
+                piece
+            ]));
+        }));
+
+        let response = responses[responses.length - 1];
+
+        const chunks: Buffer[] = [response.slice(0, response.length - 2)];
+
+        /* 0x61XX says that there is more of the response to fetch */
+        while ((response.readUInt16BE(response.length - 2) & 0xff00) === 0x6100) {
+            response = await this.m_transport.exchange(Buffer.from([CLA, Command.GET_RESPONSE, 0, 0, 0]));
+
+            chunks.push(response.slice(0, response.length - 2));
+        }
+
+        return Buffer.concat(chunks);
+    }
+}
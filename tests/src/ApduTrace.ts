@@ -0,0 +1,99 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { appendFileSync, readFileSync, writeFileSync } from 'fs';
+
+/**
+ * The first line of a trace file
+ */
+export interface TraceHeader {
+    version: number;
+    host: string;
+    recorded: string; // when the recording started, ISO 8601
+}
+
+/**
+ * An APDU of a recorded session, every line of a trace file after the first
+ */
+export interface TraceExchange {
+    apdu: string; // CLA || INS || P1 || P2 || Lc || data, hex
+    response: string; // the data and the status word, hex
+    sent_ms: number; // since the recording started
+    elapsed_ms: number; // from writing the APDU to its complete response
+}
+
+export interface Trace {
+    header: TraceHeader;
+    exchanges: TraceExchange[];
+}
+
+/**
+ * The instructions that ask the user for confirmation when P1 is P1_CONFIRM (see src/apdu.h),
+ * a replay drives the buttons of Speculos for exactly these so that it never presses a button
+ * on a screen that a recorded request did not show
+ */
+export const confirmingInstructions = [
+    0x10, 0x11, 0x12, 0x13, 0x30, 0x40, 0x41, 0x42, 0x50, 0x51, 0x53, 0x55, 0x57, 0x60, 0x61, 0x62, 0x63, 0x64,
+    0x77, 0x7e, 0xff
+];
+
+/**
+ * Whether the recorded APDU asked the user for confirmation
+ */
+export function confirms (apdu: Buffer): boolean {
+    return apdu.length >= 4 && apdu[2] === 0x01 && confirmingInstructions.indexOf(apdu[1]) !== -1;
+}
+
+/**
+ * Writes every APDU that a transport exchanges, along with its response and how long it took, to a
+ * trace file as it happens so that a session that fails part of the way through is recorded up to
+ * there. The file is one JSON document per line: a TraceHeader and then a TraceExchange per APDU
+ */
+export class TraceRecorder {
+    private readonly m_path: string;
+    private readonly m_started: bigint;
+
+    constructor (path: string, host: string) {
+        this.m_path = path;
+
+        this.m_started = process.hrtime.bigint();
+
+        const header: TraceHeader = { version: 1, host, recorded: new Date().toISOString() };
+
+        writeFileSync(this.m_path, JSON.stringify(header) + '\n');
+    }
+
+    /**
+     * @param apdu the APDU as it was sent, without the framing of the transport
+     * @param response the data of the response followed by the status word
+     * @param sent when the APDU was written (process.hrtime.bigint)
+     * @param received when the response was complete (process.hrtime.bigint)
+     */
+    public record (apdu: Buffer, response: Buffer, sent: bigint, received: bigint) {
+        const exchange: TraceExchange = {
+            apdu: apdu.toString('hex'),
+            response: response.toString('hex'),
+            sent_ms: Number(sent - this.m_started) / 1e6,
+            elapsed_ms: Number(received - sent) / 1e6
+        };
+
+        appendFileSync(this.m_path, JSON.stringify(exchange) + '\n');
+    }
+}
+
+/**
+ * Reads a trace file written by TraceRecorder
+ */
+export function readTrace (path: string): Trace {
+    const lines = readFileSync(path).toString().split('\n').filter(line => line.length !== 0);
+
+    if (lines.length === 0) {
+        throw new Error(path + ' is not a trace');
+    }
+
+    return {
+        header: JSON.parse(lines[0]),
+        exchanges: lines.slice(1).map(line => JSON.parse(line))
+    };
+}
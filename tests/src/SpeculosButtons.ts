@@ -0,0 +1,91 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Socket, createConnection } from 'net';
+
+/**
+ * Drives the button port of Speculos (--button-port, 42000 in docker_test.sh) so that
+ * requests that ask for confirmation on the device do not stall an unattended run.
+ * Every review flow of the application ends in Approve followed by Reject, so
+ * pressing right and then both buttons in turn walks any flow to its approval:
+ * both buttons do nothing on the screens that only show information
+ */
+export class SpeculosButtons {
+    private readonly m_socket: Socket;
+    private readonly m_interval: number;
+    private m_timer?: NodeJS.Timeout;
+
+    constructor (socket: Socket, interval = 100) {
+        this.m_socket = socket;
+
+        this.m_interval = interval;
+    }
+
+    public static async open (host: string, interval = 100): Promise<SpeculosButtons> {
+        return new Promise((resolve, reject) => {
+            const [ip, port] = host.split(':', 2);
+
+            const socket = createConnection({ port: parseInt(port, 10), host: ip });
+
+            socket.once('connect', () => {
+                return resolve(new SpeculosButtons(socket, interval));
+            });
+
+            socket.once('error', error => {
+                return reject(error);
+            });
+        });
+    }
+
+    /**
+     * Approves whatever the device shows for as long as the promise runs
+     * @param operation the request that may ask for confirmation
+     */
+    public async approve<T> (operation: Promise<T>): Promise<T> {
+        this.start();
+
+        try {
+            return await operation;
+        } finally {
+            this.stop();
+        }
+    }
+
+    /**
+     * Presses and releases buttons once, outside of any approval
+     * @param sequence the buttons to press and release, 'Rr' for right and 'LRlr' for both
+     */
+    public press (sequence: string) {
+        this.m_socket.write(sequence);
+    }
+
+    public async close (): Promise<void> {
+        this.stop();
+
+        return new Promise(resolve => {
+            this.m_socket.end(() => {
+                return resolve();
+            });
+        });
+    }
+
+    private start () {
+        let step = 0;
+
+        this.stop();
+
+        this.m_timer = setInterval(() => {
+            /* capitals press a button and lower case letters release it */
+            this.m_socket.write((step++ % 2 === 0) ? 'Rr' : 'LRlr');
+        }, this.m_interval);
+    }
+
+    private stop () {
+        if (this.m_timer) {
+            clearInterval(this.m_timer);
+
+            this.m_timer = undefined;
+        }
+    }
+}
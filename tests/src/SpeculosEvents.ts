@@ -0,0 +1,133 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Socket, createConnection } from 'net';
+
+/**
+ * Something that Speculos drew on the screen, stamped with when the harness heard of it
+ */
+export interface ScreenEvent {
+    time: bigint; // process.hrtime.bigint()
+    text: string;
+}
+
+/**
+ * Listens to the automation port of Speculos (--automation-port, 43000 in docker_test.sh),
+ * which reports every piece of text drawn on the screen as a line of JSON, and keeps the
+ * events in the order they arrived so that a caller can wait for the next one after any
+ * point it has seen
+ */
+export class SpeculosEvents {
+    private readonly m_socket: Socket;
+    private m_received = '';
+    private m_events: ScreenEvent[] = [];
+    private m_waiters: (() => void)[] = [];
+
+    constructor (socket: Socket) {
+        this.m_socket = socket;
+
+        this.m_socket.on('data', data => this.receive(data));
+    }
+
+    public static async open (host: string): Promise<SpeculosEvents> {
+        return new Promise((resolve, reject) => {
+            const [ip, port] = host.split(':', 2);
+
+            const socket = createConnection({ port: parseInt(port, 10), host: ip });
+
+            socket.once('connect', () => {
+                return resolve(new SpeculosEvents(socket));
+            });
+
+            socket.once('error', error => {
+                return reject(error);
+            });
+        });
+    }
+
+    /**
+     * The number of events received so far, which is the index of the next one
+     */
+    public get count (): number {
+        return this.m_events.length;
+    }
+
+    /**
+     * Waits for the event at the given index
+     * @param index the index of the event
+     * @param timeout how long to wait for it, in milliseconds
+     * @returns the event, or undefined if nothing was drawn in time
+     */
+    public async wait (index: number, timeout: number): Promise<ScreenEvent | undefined> {
+        if (index < this.m_events.length) {
+            return this.m_events[index];
+        }
+
+        return new Promise(resolve => {
+            const waiter = () => {
+                if (index < this.m_events.length) {
+                    clearTimeout(timer);
+
+                    this.m_waiters = this.m_waiters.filter(entry => entry !== waiter);
+
+                    return resolve(this.m_events[index]);
+                }
+            };
+
+            const timer = setTimeout(() => {
+                this.m_waiters = this.m_waiters.filter(entry => entry !== waiter);
+
+                return resolve(undefined);
+            }, timeout);
+
+            this.m_waiters.push(waiter);
+        });
+    }
+
+    /**
+     * Waits until nothing has been drawn for the given time
+     * @param quiet how long the screen has to stay unchanged, in milliseconds
+     */
+    public async settle (quiet: number): Promise<void> {
+        while (await this.wait(this.m_events.length, quiet)) {
+            /* keep waiting */
+        }
+    }
+
+    public async close (): Promise<void> {
+        return new Promise(resolve => {
+            this.m_socket.end(() => {
+                return resolve();
+            });
+        });
+    }
+
+    private receive (data: Buffer) {
+        const time = process.hrtime.bigint();
+
+        this.m_received += data.toString();
+
+        const lines = this.m_received.split('\n');
+
+        this.m_received = lines.pop() || '';
+
+        for (const line of lines) {
+            if (line.trim().length === 0) {
+                continue;
+            }
+
+            try {
+                const event = JSON.parse(line);
+
+                this.m_events.push({ time, text: (typeof event.text === 'string') ? event.text : '' });
+            } catch {
+                /* not an event of the screen */
+            }
+        }
+
+        for (const waiter of this.m_waiters.slice()) {
+            waiter();
+        }
+    }
+}
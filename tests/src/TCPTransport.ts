@@ -3,34 +3,76 @@
 // Please see the included LICENSE file for more information.
 
 import Transport, { Observer, Subscription } from '@ledgerhq/hw-transport';
-import { Reader, Writer } from 'bytestream-helper';
+import { TraceRecorder } from './ApduTrace';
+import { Writer } from 'bytestream-helper';
 import { Socket, createConnection } from 'net';
-import { AbortController } from 'abort-controller/dist/abort-controller';
 
+/**
+ * An APDU that has been handed to the transport and is waiting for its response
+ */
+interface Exchange {
+    apdu: Buffer;
+    frame: Buffer;
+    sent?: bigint;
+    resolve: (response: Buffer) => void;
+    reject: (error: Error) => void;
+    timer?: NodeJS.Timeout;
+}
+
+/**
+ * Speaks the APDU protocol of Speculos: every APDU is sent as its length {4 bytes, big endian}
+ * followed by the APDU, and every response comes back as the length of its data {4 bytes, big
+ * endian} followed by the data and the status word {2 bytes}.
+ *
+ * The responses are parsed out of the stream as it arrives, however TCP happens to split or
+ * coalesce it, and are matched in order to the APDUs waiting in the queue. The next APDU is
+ * framed when it is queued and is written as soon as the response before it has arrived, so
+ * that the time between two exchanges is spent on the device rather than in the harness.
+ *
+ * When APDU_TRACE names a file every exchange is recorded to it (see TraceRecorder and
+ * replay.ts), a {host} in the name is replaced by the host so that every device of a pool
+ * is recorded to a file of its own
+ */
 export class TCPTransport extends Transport<string> {
     private readonly m_socket: Socket;
     private readonly m_timeout: number;
     private m_verbose = false;
     private m_scrambleKey?: string;
+    private m_exchanges = 0;
+    private m_bytesSent = 0;
+    private m_bytesReceived = 0;
+    private m_received: Buffer = Buffer.alloc(0);
+    private m_queue: Exchange[] = [];
+    private m_inFlight = 0;
+    private m_depth = 1;
+    private m_recorder?: TraceRecorder;
 
     constructor (socket: Socket, timeout = 30000) {
         super();
 
         this.m_socket = socket;
 
-        this.m_socket.on('error', async () => {
+        this.m_socket.on('error', async error => {
+            this.fail(error);
+
             await this.close();
         });
 
+        this.m_socket.on('close', () => {
+            this.fail(new Error('The connection was closed'));
+        });
+
         this.m_socket.on('data', (data: Buffer) => {
             if (this.verbose) {
                 console.log('<- %s', data.toString('hex'));
             }
+
+            this.receive(data);
         });
 
         this.m_timeout = timeout;
 
-        this.m_socket.setTimeout(timeout);
+        this.m_socket.setNoDelay(true);
     }
 
     public get verbose (): boolean {
@@ -41,6 +83,53 @@ export class TCPTransport extends Transport<string> {
         this.m_verbose = val;
     }
 
+    /**
+     * The number of APDUs that may be written before the responses to those before them
+     * have arrived. Speculos reads the next APDU only once it has answered the last one,
+     * so anything above 1 only saves the round trip of the harness, not any time on the device
+     */
+    public get depth (): number {
+        return this.m_depth;
+    }
+
+    public set depth (val: number) {
+        this.m_depth = Math.max(1, val);
+
+        this.pump();
+    }
+
+    /**
+     * Where the exchanges are recorded, if anywhere
+     */
+    public get recorder (): TraceRecorder | undefined {
+        return this.m_recorder;
+    }
+
+    public set recorder (val: TraceRecorder | undefined) {
+        this.m_recorder = val;
+    }
+
+    /**
+     * The number of APDUs exchanged since the transport was opened
+     */
+    public get exchanges (): number {
+        return this.m_exchanges;
+    }
+
+    /**
+     * The number of APDU bytes sent since the transport was opened
+     */
+    public get bytesSent (): number {
+        return this.m_bytesSent;
+    }
+
+    /**
+     * The number of response bytes (status word included) received since the transport was opened
+     */
+    public get bytesReceived (): number {
+        return this.m_bytesReceived;
+    }
+
     public static async isSupported (): Promise<boolean> {
         return true;
     }
@@ -64,6 +153,11 @@ export class TCPTransport extends Transport<string> {
             socket.once('connect', () => {
                 const instance = new TCPTransport(socket, timeout);
 
+                if (process.env.APDU_TRACE) {
+                    instance.recorder = new TraceRecorder(
+                        process.env.APDU_TRACE.replace('{host}', host.replace(':', '_')), host);
+                }
+
                 return resolve(instance);
             });
 
@@ -87,48 +181,114 @@ export class TCPTransport extends Transport<string> {
 
     public async exchange (apdu: Buffer): Promise<Buffer> {
         return new Promise((resolve, reject) => {
-            const controller = new AbortController();
-
-            controller.signal.addEventListener('abort', () => {
-                return reject(new Error('exchange process timed out'));
-            });
-
-            const timeout = setTimeout(() => controller.abort(), this.m_timeout);
-
             const writer = new Writer();
 
             writer.uint32_t(apdu.length, true);
             writer.write(apdu);
 
-            this.m_socket.once('data', data => {
-                const reader = new Reader(data);
+            this.m_queue.push({ apdu, frame: writer.buffer, resolve, reject });
 
-                const size = reader.uint32_t(true).toJSNumber();
+            this.pump();
+        });
+    }
 
-                if (reader.unreadBytes !== size + 2) {
-                    return reject(new Error('Payload size does not match expected size'));
-                }
+    /**
+     * Writes the APDUs at the front of the queue that are allowed to be in flight
+     */
+    private pump () {
+        while (this.m_inFlight < this.m_depth && this.m_inFlight < this.m_queue.length) {
+            const exchange = this.m_queue[this.m_inFlight++];
 
-                const response = reader.unreadBuffer;
+            exchange.timer = setTimeout(() => {
+                this.fail(new Error('exchange process timed out'));
+            }, this.m_timeout);
 
-                if (size > 0) {
-                    reader.skip(size);
-                }
+            this.m_exchanges++;
 
-                const code = reader.uint16_t(true).toJSNumber();
-                if (code === 0x9000) {
-                    clearTimeout(timeout);
+            this.m_bytesSent += exchange.frame.length - 4;
 
-                    return resolve(response);
-                } else if ((code & 0xff00) !== 0x6100) {
-                    return reject(new Error('Invalid status code supplied'));
-                } else {
-                    return reject(new Error('Unhandled response'));
-                }
-            });
+            exchange.sent = process.hrtime.bigint();
 
-            send(this.m_socket, writer.buffer, this.verbose);
-        });
+            send(this.m_socket, exchange.frame, this.verbose).catch(error => this.fail(error));
+        }
+    }
+
+    /**
+     * Takes every complete response out of what has been received so far and settles
+     * the oldest exchange in flight with each of them
+     */
+    private receive (data: Buffer) {
+        this.m_received = Buffer.concat([this.m_received, data]);
+
+        while (this.m_received.length >= 4) {
+            const size = this.m_received.readUInt32BE(0);
+
+            if (this.m_received.length < 4 + size + 2) {
+                return;
+            }
+
+            const response = this.m_received.slice(4, 4 + size + 2);
+
+            this.m_received = this.m_received.slice(4 + size + 2);
+
+            this.m_bytesReceived += size + 2;
+
+            const exchange = this.m_queue.shift();
+
+            if (!exchange || this.m_inFlight === 0) {
+                return this.fail(new Error('Received a response that nothing was waiting for'));
+            }
+
+            this.m_inFlight--;
+
+            if (exchange.timer) {
+                clearTimeout(exchange.timer);
+            }
+
+            const received = process.hrtime.bigint();
+
+            // the next APDU goes out before the promise of this one is settled
+            this.pump();
+
+            if (this.m_recorder && exchange.sent) {
+                this.m_recorder.record(exchange.apdu, response, exchange.sent, received);
+            }
+
+            const code = response.readUInt16BE(size);
+
+            /**
+             * A chunk of a longer response (0x61XX) is as good as a whole one, the caller fetches the
+             * rest (see ApduClient), and the status word goes along with an error so that a caller
+             * can tell the errors apart
+             */
+            if (code === 0x9000 || (code & 0xff00) === 0x6100) {
+                exchange.resolve(response);
+            } else {
+                exchange.reject(Object.assign(new Error('Invalid status code supplied'), { statusCode: code }));
+            }
+        }
+    }
+
+    /**
+     * Rejects everything that is queued or in flight, as once a response has gone missing
+     * there is no telling which of the responses that follow belongs to which APDU
+     */
+    private fail (error: Error) {
+        const queue = this.m_queue;
+
+        this.m_queue = [];
+
+        this.m_inFlight = 0;
+
+        this.m_received = Buffer.alloc(0);
+
+        for (const exchange of queue) {
+            if (exchange.timer) {
+                clearTimeout(exchange.timer);
+            }
+
+            exchange.reject(error);
+        }
     }
 }
 
@@ -0,0 +1,94 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Address, Crypto } from 'turtlecoin-utils';
+
+/**
+ * The same wallet as the one in index.ts, derived from the seed given to Speculos
+ */
+export const walletSeed = '74e4ac6f5a858c4161593a90d2f6f22d3a57195a89e75d10500d68db3c68c70f';
+
+/**
+ * The ring size that the device uses for the transactions that turtlecoin-utils starts
+ */
+export const ringSize = 4;
+
+/**
+ * An output of the wallet hidden in a ring of random keys, ready to be loaded with
+ * LedgerDevice.loadTransactionInput, along with the key image it is expected to have
+ */
+export interface Input {
+    tx_public_key: string;
+    output_index: number;
+    amount: number;
+    ring: string[];
+    offsets: number[];
+    real_index: number;
+    key_image: string;
+}
+
+/**
+ * An output of the wallet as found on the chain, along with the key image it is expected to have
+ */
+export interface Output {
+    tx_public_key: string;
+    output_index: number;
+    public_key: string;
+    key_image: string;
+}
+
+/**
+ * Makes an output that belongs to the wallet
+ * @param crypto the host library that the device is checked against
+ * @param wallet the wallet of the device
+ * @param output_index the index of the output in its transaction
+ * @param tx_public_key the transaction to put it in, a new one if not given
+ */
+export async function createOutput (
+    crypto: Crypto, wallet: Address, output_index: number, tx_public_key?: string): Promise<Output> {
+    if (!tx_public_key) {
+        tx_public_key = (await crypto.generateKeys()).public_key;
+    }
+
+    const derivation = await crypto.generateKeyDerivation(tx_public_key, wallet.view.privateKey);
+
+    const public_key = await crypto.derivePublicKey(derivation, output_index, wallet.spend.publicKey);
+
+    const private_key = await crypto.deriveSecretKey(derivation, output_index, wallet.spend.privateKey);
+
+    return {
+        tx_public_key,
+        output_index,
+        public_key,
+        key_image: await crypto.generateKeyImage(public_key, private_key)
+    };
+}
+
+/**
+ * Makes an input that spends an output of the wallet hidden in a ring of random keys
+ * @param crypto the host library that the device is checked against
+ * @param wallet the wallet of the device
+ * @param index where the input is in the transaction, which picks the output index and the real index
+ */
+export async function createInput (crypto: Crypto, wallet: Address, index: number): Promise<Input> {
+    const output = await createOutput(crypto, wallet, index % 8);
+
+    const real_index = index % ringSize;
+
+    const ring: string[] = [];
+
+    for (let i = 0; i < ringSize; i++) {
+        ring.push((i === real_index) ? output.public_key : (await crypto.generateKeys()).public_key);
+    }
+
+    return {
+        tx_public_key: output.tx_public_key,
+        output_index: output.output_index,
+        amount: 1000000,
+        ring,
+        offsets: ring.map((_, i) => i),
+        real_index,
+        key_image: output.key_image
+    };
+}
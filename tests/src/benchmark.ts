@@ -0,0 +1,298 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Address, Crypto, LedgerDevice } from 'turtlecoin-utils';
+import { SpeculosButtons } from './SpeculosButtons';
+import { TCPTransport } from './TCPTransport';
+import { writeFileSync } from 'fs';
+
+/** @ignore */
+const confirm = !!(process.env.CONFIRM && process.env.CONFIRM.length !== 0);
+
+/** @ignore */
+const iterations = parseInt(process.env.BENCHMARK_ITERATIONS || '25', 10);
+
+/** @ignore */
+const only = (process.env.BENCHMARK_ONLY || '').split(',').filter(name => name.length !== 0);
+
+/** @ignore */
+const rngSeed = process.env.BENCHMARK_RNG_SEED || '';
+
+/**
+ * Times every command of the application over many iterations against Speculos (or any
+ * device reachable through the TCPTransport) and writes the latency percentiles and the
+ * throughput of each as JSON, to stdout or to the file named by BENCHMARK_OUTPUT, so that
+ * the results of two builds can be compared. Everything a request needs is computed
+ * before the clock starts so that only the exchange with the device is measured.
+ *
+ * With CONFIRM set the requests ask for confirmation and the button port of Speculos
+ * approves them, which makes the time taken by the review part of the result.
+ *
+ * With BENCHMARK_RNG_SEED set to 32 bytes of hex, a debug build has its RNG seeded with them
+ * (APDU_DEBUG, P1 = 0x03) before every benchmark, so that the nonces and keys it draws, and the
+ * time the arithmetic on them takes, are the same from one run to the next
+ */
+
+/**
+ * The same wallet as the one in index.ts, derived from the seed given to Speculos
+ */
+const walletSeed = '74e4ac6f5a858c4161593a90d2f6f22d3a57195a89e75d10500d68db3c68c70f';
+
+interface Benchmark {
+    name: string;
+    confirms: boolean; // whether the request shows a review when CONFIRM is set
+    setup?: () => Promise<void>;
+    run: (iteration: number) => Promise<any>;
+}
+
+interface Result {
+    iterations: number;
+    mean: number; // milliseconds
+    p50: number;
+    p95: number;
+    p99: number;
+    min: number;
+    max: number;
+    ops_per_second: number;
+}
+
+function percentile (sorted: number[], p: number): number {
+    const rank = Math.ceil((p / 100) * sorted.length);
+
+    return sorted[Math.min(sorted.length, Math.max(1, rank)) - 1];
+}
+
+function round (value: number): number {
+    return Math.round(value * 1000) / 1000;
+}
+
+function summarize (samples: number[]): Result {
+    const sorted = samples.slice().sort((a, b) => a - b);
+
+    const total = samples.reduce((sum, sample) => sum + sample, 0);
+
+    return {
+        iterations: samples.length,
+        mean: round(total / samples.length),
+        p50: round(percentile(sorted, 50)),
+        p95: round(percentile(sorted, 95)),
+        p99: round(percentile(sorted, 99)),
+        min: round(sorted[0]),
+        max: round(sorted[sorted.length - 1]),
+        ops_per_second: round(samples.length / (total / 1000))
+    };
+}
+
+async function main () {
+    const transport = await TCPTransport.open(process.env.LEDGER_HOST || '127.0.0.1:9999');
+
+    const buttons = confirm
+        ? await SpeculosButtons.open(process.env.SPECULOS_BUTTONS || '127.0.0.1:42000')
+        : undefined;
+
+    const ledger = new LedgerDevice(transport);
+
+    const TurtleCoinCrypto = new Crypto();
+
+    const Wallet = await Address.fromSeed(walletSeed);
+
+    const message_digest = await TurtleCoinCrypto.cn_fast_hash(walletSeed);
+
+    const output_index = 2;
+
+    /* every key image request gets an output of its own as the device caches key images */
+    const outputs: { tx_public_key: string, derivation: string, public_key: string }[] = [];
+
+    const keys: { public_key: string, private_key: string }[] = [];
+
+    let signature: string;
+
+    const prepareOutputs = async () => {
+        for (let i = outputs.length; i < iterations; i++) {
+            const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+            const derivation = await TurtleCoinCrypto.generateKeyDerivation(tx_public_key, Wallet.view.privateKey);
+
+            const public_key = await TurtleCoinCrypto.derivePublicKey(derivation, output_index, Wallet.spend.publicKey);
+
+            outputs.push({ tx_public_key, derivation, public_key });
+        }
+    };
+
+    const benchmarks: Benchmark[] = [
+        {
+            name: 'version',
+            confirms: false,
+            run: () => ledger.getVersion()
+        },
+        {
+            name: 'ident',
+            confirms: false,
+            run: () => ledger.getIdent()
+        },
+        {
+            name: 'random_key_pair',
+            confirms: false,
+            run: () => ledger.getRandomKeyPair()
+        },
+        {
+            name: 'private_to_public',
+            confirms: false,
+            setup: async () => {
+                for (let i = keys.length; i < iterations; i++) {
+                    keys.push(await TurtleCoinCrypto.generateKeys());
+                }
+            },
+            run: i => ledger.privateToPublic(keys[i].private_key)
+        },
+        {
+            name: 'public_keys',
+            confirms: true,
+            run: () => ledger.getPublicKeys(confirm)
+        },
+        {
+            name: 'view_wallet_keys',
+            confirms: true,
+            run: () => ledger.getViewWallet(confirm)
+        },
+        {
+            name: 'address',
+            confirms: true,
+            run: () => ledger.getAddress(confirm)
+        },
+        {
+            name: 'check_key',
+            confirms: false,
+            run: () => ledger.checkKey(Wallet.spend.publicKey)
+        },
+        {
+            name: 'check_scalar',
+            confirms: false,
+            run: () => ledger.checkScalar(Wallet.spend.privateKey)
+        },
+        {
+            name: 'generate_signature',
+            confirms: true,
+            run: () => ledger.generateSignature(message_digest, confirm)
+        },
+        {
+            name: 'check_signature',
+            confirms: false,
+            setup: async () => {
+                signature = await TurtleCoinCrypto.generateSignature(
+                    message_digest, Wallet.spend.publicKey, Wallet.spend.privateKey);
+            },
+            run: () => ledger.checkSignature(message_digest, Wallet.spend.publicKey, signature)
+        },
+        {
+            name: 'generate_key_derivation',
+            confirms: true,
+            setup: prepareOutputs,
+            run: i => ledger.generateKeyDerivation(outputs[i].tx_public_key, confirm)
+        },
+        {
+            name: 'derive_public_key',
+            confirms: true,
+            setup: prepareOutputs,
+            run: i => ledger.derivePublicKey(outputs[i].derivation, output_index, confirm)
+        },
+        {
+            name: 'derive_secret_key',
+            confirms: true,
+            setup: prepareOutputs,
+            run: i => ledger.deriveSecretKey(outputs[i].derivation, output_index, confirm)
+        },
+        {
+            name: 'generate_key_image',
+            confirms: true,
+            setup: prepareOutputs,
+            run: i => ledger.generateKeyImage(
+                outputs[i].tx_public_key, output_index, outputs[i].public_key, confirm)
+        },
+        {
+            name: 'generate_key_image_cached',
+            confirms: true,
+            setup: prepareOutputs,
+            run: () => ledger.generateKeyImage(
+                outputs[0].tx_public_key, output_index, outputs[0].public_key, confirm)
+        },
+        {
+            name: 'generate_key_image_primitive',
+            confirms: true,
+            setup: prepareOutputs,
+            run: i => ledger.generateKeyImagePrimitive(
+                outputs[i].derivation, output_index, outputs[i].public_key, confirm)
+        },
+        {
+            name: 'transaction_state',
+            confirms: false,
+            run: () => ledger.transactionState()
+        }
+    ];
+
+    const results: {[name: string]: Result} = {};
+
+    const version = await ledger.getVersion();
+
+    try {
+        for (const benchmark of benchmarks) {
+            if (only.length !== 0 && only.indexOf(benchmark.name) === -1) {
+                continue;
+            }
+
+            if (benchmark.setup) {
+                await benchmark.setup();
+            }
+
+            if (rngSeed.length !== 0) {
+                await transport.send(0xe0, 0x02, 0x03, 0x00, Buffer.from(rngSeed, 'hex'));
+            }
+
+            const samples: number[] = [];
+
+            for (let i = 0; i < iterations; i++) {
+                const start = process.hrtime.bigint();
+
+                if (buttons && benchmark.confirms) {
+                    await buttons.approve(benchmark.run(i));
+                } else {
+                    await benchmark.run(i);
+                }
+
+                samples.push(Number(process.hrtime.bigint() - start) / 1e6);
+            }
+
+            results[benchmark.name] = summarize(samples);
+
+            console.error('%s: p50 %d ms', benchmark.name, results[benchmark.name].p50);
+        }
+    } finally {
+        if (buttons) {
+            await buttons.close();
+        }
+
+        await transport.close();
+    }
+
+    const report = JSON.stringify({
+        label: process.env.BENCHMARK_LABEL || '',
+        version,
+        confirm,
+        iterations,
+        rng_seed: rngSeed,
+        results
+    }, undefined, 4);
+
+    if (process.env.BENCHMARK_OUTPUT) {
+        writeFileSync(process.env.BENCHMARK_OUTPUT, report);
+    } else {
+        console.log(report);
+    }
+}
+
+main().catch(error => {
+    console.error(error);
+
+    process.exit(1);
+});
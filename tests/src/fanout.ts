@@ -0,0 +1,337 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Address, Crypto, LedgerDevice } from 'turtlecoin-utils';
+import { ApduClient } from './ApduClient';
+import { SpeculosButtons } from './SpeculosButtons';
+import { TCPTransport } from './TCPTransport';
+import { Input, Output, createInput, createOutput, walletSeed } from './Workload';
+import { writeFileSync } from 'fs';
+
+/** @ignore */
+const confirm = !!(process.env.CONFIRM && process.env.CONFIRM.length !== 0);
+
+/** @ignore */
+function list (value: string | undefined, fallback: string[]): string[] {
+    if (!value) {
+        return fallback;
+    }
+
+    return value.split(',').filter(entry => entry.length !== 0);
+}
+
+/** @ignore */
+function count (value: string | undefined, fallback: number): number {
+    return (value) ? parseInt(value, 10) : fallback;
+}
+
+/**
+ * Spreads a mixed workload of independent jobs over a pool of devices (or Speculos instances)
+ * and reports the throughput of the pool as a whole and how busy each device was, so that the
+ * number of devices a service needs can be planned from measured numbers.
+ *
+ * The devices are given by LEDGER_HOSTS and, when CONFIRM is set, the button ports that approve
+ * their requests by SPECULOS_BUTTONS in the same order. Every device must hold the wallet of
+ * index.ts. The workload is FANOUT_TRANSACTIONS transactions of FANOUT_INPUTS inputs and
+ * FANOUT_OUTPUTS outputs, FANOUT_SCANS batches of FANOUT_BATCH outputs for APDU_SCAN_OUTPUTS and
+ * as many for APDU_GENERATE_KEYIMAGES, all of it packed into requests by ApduClient. Every job is prepared before the clock starts and taken
+ * from a shared queue by whichever device is free first, and every answer is checked against
+ * the TurtleCoin Crypto library. The results are written as JSON to stdout or to the file named
+ * by BENCHMARK_OUTPUT
+ */
+
+/** @ignore */
+const hosts = list(process.env.LEDGER_HOSTS, ['127.0.0.1:9999']);
+
+/** @ignore */
+const buttonHosts = list(process.env.SPECULOS_BUTTONS, hosts.map((_, i) => '127.0.0.1:' + (42000 + i)));
+
+/** @ignore */
+const transactionCount = count(process.env.FANOUT_TRANSACTIONS, 8);
+
+/** @ignore */
+const inputCount = count(process.env.FANOUT_INPUTS, 2);
+
+/** @ignore */
+const outputCount = count(process.env.FANOUT_OUTPUTS, 2);
+
+/** @ignore */
+const batchCount = count(process.env.FANOUT_SCANS, 8);
+
+/**
+ * The outputs of one transaction in a job, ApduClient splits a batch that is larger than a
+ * request of the device takes
+ */
+const batchSize = count(process.env.FANOUT_BATCH, 6);
+
+interface Device {
+    host: string;
+    transport: TCPTransport;
+    ledger: LedgerDevice;
+    client: ApduClient;
+    buttons?: SpeculosButtons;
+}
+
+interface Job {
+    kind: 'transaction' | 'scan' | 'key_images';
+    run: (device: Device) => Promise<void>;
+}
+
+interface Utilization {
+    host: string;
+    jobs: { [kind: string]: number };
+    busy_ms: number;
+    utilization: number; // the share of the wall time that the device spent on a job
+    apdus: number;
+    bytes_sent: number;
+    bytes_received: number;
+}
+
+/** @ignore */
+function round (value: number): number {
+    return Math.round(value * 1000) / 1000;
+}
+
+async function openDevice (host: string, buttonHost: string): Promise<Device> {
+    const transport = await TCPTransport.open(host);
+
+    return {
+        host,
+        transport,
+        ledger: new LedgerDevice(transport),
+        client: await ApduClient.open(transport),
+        buttons: (confirm) ? await SpeculosButtons.open(buttonHost) : undefined
+    };
+}
+
+async function main () {
+    const TurtleCoinCrypto = new Crypto();
+
+    const Wallet = await Address.fromSeed(walletSeed);
+
+    const approve = async <T>(device: Device, operation: Promise<T>): Promise<T> => {
+        return (device.buttons) ? device.buttons.approve(operation) : operation;
+    };
+
+    const createTransaction = async (): Promise<Job> => {
+        const inputs: Input[] = [];
+
+        for (let i = 0; i < inputCount; i++) {
+            inputs.push(await createInput(TurtleCoinCrypto, Wallet, i));
+        }
+
+        const outputAmount = Math.floor((inputCount * 1000000 - 10) / outputCount);
+
+        const outputs: { amount: number, key: string }[] = [];
+
+        for (let i = 0; i < outputCount; i++) {
+            outputs.push({ amount: outputAmount, key: (await TurtleCoinCrypto.generateKeys()).public_key });
+        }
+
+        const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+        const payment_id = (await TurtleCoinCrypto.generateKeys()).private_key;
+
+        return {
+            kind: 'transaction',
+            run: async (device: Device) => {
+                const ledger = device.ledger;
+
+                await ledger.startTransaction(0, inputCount, outputCount, tx_public_key, payment_id);
+
+                await ledger.startTransactionInputLoad();
+
+                await device.client.loadInputs(inputs);
+
+                await ledger.startTransactionOutputLoad();
+
+                await device.client.loadOutputs(outputs);
+
+                await ledger.finalizeTransactionPrefix();
+
+                const signed = await approve(device, ledger.signTransaction(confirm));
+
+                const transaction = await ledger.retrieveTransaction();
+
+                await approve(device, ledger.resetTransaction(confirm));
+
+                if (transaction.size !== signed.size || await transaction.hash() !== signed.hash) {
+                    throw new Error(device.host + ': the transaction does not match its hash or size');
+                }
+
+                inputs.forEach((input, i) => {
+                    if ((transaction.inputs[i] as any).keyImage !== input.key_image) {
+                        throw new Error(device.host + ': the key image of input ' + i + ' does not match');
+                    }
+                });
+            }
+        };
+    };
+
+    /* a transaction that paid the wallet batchSize outputs */
+    const createBatch = async (): Promise<Output[]> => {
+        const outputs = [await createOutput(TurtleCoinCrypto, Wallet, 0)];
+
+        for (let i = 1; i < batchSize; i++) {
+            outputs.push(await createOutput(TurtleCoinCrypto, Wallet, i, outputs[0].tx_public_key));
+        }
+
+        return outputs;
+    };
+
+    const createScan = async (): Promise<Job> => {
+        const outputs = await createBatch();
+
+        /* every other output belongs to someone else, which the bitmap has to show */
+        for (let i = 1; i < outputs.length; i += 2) {
+            outputs[i] = { ...outputs[i], public_key: (await TurtleCoinCrypto.generateKeys()).public_key };
+        }
+
+        return {
+            kind: 'scan',
+            run: async (device: Device) => {
+                const owned = await approve(device, device.client.scanOutputs(outputs, confirm));
+
+                outputs.forEach((_, i) => {
+                    if (owned[i] !== (i % 2 === 0)) {
+                        throw new Error(device.host + ': output ' + i + ' was not scanned correctly');
+                    }
+                });
+            }
+        };
+    };
+
+    const createKeyImages = async (): Promise<Job> => {
+        const outputs = await createBatch();
+
+        return {
+            kind: 'key_images',
+            run: async (device: Device) => {
+                const key_images = await approve(device, device.client.generateKeyImages(outputs, confirm));
+
+                outputs.forEach((output, i) => {
+                    if (key_images[i] !== output.key_image) {
+                        throw new Error(device.host + ': the key image of output ' + i + ' does not match');
+                    }
+                });
+            }
+        };
+    };
+
+    /* interleaved so that every device sees the same mix however the queue drains */
+    const queue: Job[] = [];
+
+    for (let i = 0; i < Math.max(transactionCount, batchCount); i++) {
+        if (i < transactionCount) {
+            queue.push(await createTransaction());
+        }
+
+        if (i < batchCount) {
+            queue.push(await createScan());
+
+            queue.push(await createKeyImages());
+        }
+    }
+
+    const jobCount = queue.length;
+
+    const devices: Device[] = [];
+
+    for (let i = 0; i < hosts.length; i++) {
+        devices.push(await openDevice(hosts[i], buttonHosts[i]));
+    }
+
+    const utilization: Utilization[] = devices.map(device => {
+        return {
+            host: device.host,
+            jobs: {},
+            busy_ms: 0,
+            utilization: 0,
+            apdus: 0,
+            bytes_sent: 0,
+            bytes_received: 0
+        };
+    });
+
+    const start = process.hrtime.bigint();
+
+    try {
+        for (const device of devices) {
+            if (await device.ledger.transactionState() !== 0) {
+                await approve(device, device.ledger.resetTransaction(confirm));
+            }
+        }
+
+        await Promise.all(devices.map(async (device, i) => {
+            const usage = utilization[i];
+
+            for (let job = queue.shift(); job; job = queue.shift()) {
+                const started = process.hrtime.bigint();
+
+                await job.run(device);
+
+                usage.busy_ms += Number(process.hrtime.bigint() - started) / 1e6;
+
+                usage.jobs[job.kind] = (usage.jobs[job.kind] || 0) + 1;
+            }
+        }));
+    } finally {
+        for (const device of devices) {
+            if (device.buttons) {
+                await device.buttons.close();
+            }
+
+            await device.transport.close();
+        }
+    }
+
+    const wall_ms = Number(process.hrtime.bigint() - start) / 1e6;
+
+    devices.forEach((device, i) => {
+        utilization[i].busy_ms = round(utilization[i].busy_ms);
+
+        utilization[i].utilization = round(utilization[i].busy_ms / wall_ms);
+
+        utilization[i].apdus = device.transport.exchanges;
+
+        utilization[i].bytes_sent = device.transport.bytesSent;
+
+        utilization[i].bytes_received = device.transport.bytesReceived;
+    });
+
+    const perSecond = (value: number) => round(value / (wall_ms / 1000));
+
+    const report = JSON.stringify({
+        label: process.env.BENCHMARK_LABEL || '',
+        confirm,
+        devices: hosts.length,
+        workload: {
+            transactions: transactionCount,
+            inputs: inputCount,
+            outputs: outputCount,
+            batches: batchCount,
+            batch_size: batchSize
+        },
+        aggregate: {
+            wall_ms: round(wall_ms),
+            jobs_per_second: perSecond(jobCount),
+            transactions_per_second: perSecond(transactionCount),
+            outputs_scanned_per_second: perSecond(batchCount * batchSize),
+            key_images_per_second: perSecond(batchCount * batchSize)
+        },
+        utilization
+    }, undefined, 4);
+
+    if (process.env.BENCHMARK_OUTPUT) {
+        writeFileSync(process.env.BENCHMARK_OUTPUT, report);
+    } else {
+        console.log(report);
+    }
+}
+
+main().catch(error => {
+    console.error(error);
+
+    process.exit(1);
+});
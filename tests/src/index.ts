@@ -4,13 +4,19 @@
 
 import { Address, Crypto, LedgerDevice } from 'turtlecoin-utils';
 import { before, describe, it } from 'mocha';
+import { ApduClient, Primitive } from './ApduClient';
 import { TCPTransport } from './TCPTransport';
-import Transport from '@ledgerhq/hw-transport';
+import { Input, Output, createInput, createOutput } from './Workload';
 import * as assert from 'assert';
 
 /** @ignore */
 const confirm = !!(process.env.CONFIRM && process.env.CONFIRM.length !== 0);
 
+/** @ignore */
+function budget (name: string, fallback: number): number {
+    return parseInt(process.env[name] || fallback.toString(), 10);
+}
+
 /**
  * This set of tests is designed to test the application and thus the crypto operations
  * provided by the TurtleCoin application running on a Ledger hardware device against
@@ -37,7 +43,7 @@ describe('Ledger Hardware Tests', function () {
     const ledgerIdent = '547572746c65436f696e206973206e6f742061204d6f6e65726f20666f726b21';
 
     let ledger: LedgerDevice;
-    let transport: Transport;
+    let transport: TCPTransport;
     let Wallet: Address;
 
     const TurtleCoinCrypto = new Crypto();
@@ -67,6 +73,16 @@ describe('Ledger Hardware Tests', function () {
             assert(result === ledgerIdent);
         });
 
+        it('Capabilities', async () => {
+            const client = await ApduClient.open(transport);
+
+            const capabilities = await client.capabilities();
+
+            assert((capabilities.features & 0x01) !== 0);
+
+            assert(await client.calibrate(Primitive.KECCAK, 4) >= 0);
+        });
+
         it('Is Debug?', async () => {
             assert(await ledger.isDebug());
         });
@@ -276,6 +292,24 @@ describe('Ledger Hardware Tests', function () {
                 .catch(() => assert(true));
         });
 
+        it('Generate Key Image: Repeated request returns the same key image', async () => {
+            // the second request is answered from the key image cache kept on the device
+            const first = await ledger.generateKeyImage(
+                tx_public_key, output_index, expected_publicEphemeral, confirm);
+
+            const second = await ledger.generateKeyImage(
+                tx_public_key, output_index, expected_publicEphemeral, confirm);
+
+            assert(first === expected_key_image && second === expected_key_image);
+        });
+
+        it('Generate Key Image: Fails when wrong output index after caching', async () => {
+            await ledger.generateKeyImage(
+                tx_public_key, output_index + 1, expected_publicEphemeral, confirm)
+                .then(() => assert(false))
+                .catch(() => assert(true));
+        });
+
         it('Generate Key Image Primitive', async () => {
             const derivation = await TurtleCoinCrypto.generateKeyDerivation(tx_public_key, Wallet.view.privateKey);
 
@@ -294,6 +328,32 @@ describe('Ledger Hardware Tests', function () {
                 .catch(() => assert(true));
         });
 
+        it('Generate Key Image: Matches reference for multiple outputs', async () => {
+            /**
+             * Every key image runs the hash to point map over a different output key so
+             * checking a handful of them against the TurtleCoin Crypto library makes sure
+             * that the map stays bit for bit compatible with the reference implementation
+             */
+            for (let i = 0; i < 8; i++) {
+                const public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+                const derivation = await TurtleCoinCrypto.generateKeyDerivation(
+                    public_key, Wallet.view.privateKey);
+
+                const public_ephemeral = await TurtleCoinCrypto.derivePublicKey(
+                    derivation, i, Wallet.spend.publicKey);
+
+                const private_ephemeral = await TurtleCoinCrypto.deriveSecretKey(
+                    derivation, i, Wallet.spend.privateKey);
+
+                const expected = await TurtleCoinCrypto.generateKeyImage(public_ephemeral, private_ephemeral);
+
+                const key_image = await ledger.generateKeyImage(public_key, i, public_ephemeral, confirm);
+
+                assert(key_image === expected);
+            }
+        });
+
         describe('Ring Signatures', () => {
             const public_keys: string[] = [];
             const real_output_index = 0;
@@ -383,6 +443,97 @@ describe('Ledger Hardware Tests', function () {
         });
     });
 
+    describe('Batched Operations', () => {
+        let client: ApduClient;
+
+        /* more than a single request of any build takes, so that the client has to chain and split them */
+        const count = 20;
+
+        const outputs: Output[] = [];
+
+        before(async () => {
+            client = await ApduClient.open(transport);
+
+            for (let i = 0; i < count; i++) {
+                /* the first half are outputs of the same transaction */
+                outputs.push(await createOutput(
+                    TurtleCoinCrypto, Wallet, i, (i !== 0 && i < count / 2) ? outputs[0].tx_public_key : undefined));
+            }
+        });
+
+        it('Private Keys to Public Keys', async () => {
+            const keys: { public_key: string, private_key: string }[] = [];
+
+            for (let i = 0; i < count; i++) {
+                keys.push(await TurtleCoinCrypto.generateKeys());
+            }
+
+            const public_keys = await client.privateToPublic(keys.map(key => key.private_key));
+
+            assert.deepStrictEqual(public_keys, keys.map(key => key.public_key));
+        });
+
+        it('Check Keys', async () => {
+            const keys: string[] = [];
+
+            for (let i = 0; i < count; i++) {
+                keys.push((i % 2 === 0) ? Wallet.spend.publicKey : Wallet.spend.privateKey);
+            }
+
+            assert.deepStrictEqual(await client.checkKeys(keys), keys.map((_, i) => i % 2 === 0));
+        });
+
+        it('Generate Key Derivations', async () => {
+            const tx_public_keys = outputs.map(output => output.tx_public_key);
+
+            const expected: string[] = [];
+
+            for (const tx_public_key of tx_public_keys) {
+                expected.push(await TurtleCoinCrypto.generateKeyDerivation(tx_public_key, Wallet.view.privateKey));
+            }
+
+            assert.deepStrictEqual(await client.generateKeyDerivations(tx_public_keys, confirm), expected);
+        });
+
+        it('Scan Outputs', async () => {
+            /* every third output belongs to someone else */
+            const scanned: Output[] = [];
+
+            for (let i = 0; i < count; i++) {
+                scanned.push((i % 3 === 2)
+                    ? { ...outputs[i], public_key: (await TurtleCoinCrypto.generateKeys()).public_key }
+                    : outputs[i]);
+            }
+
+            assert.deepStrictEqual(await client.scanOutputs(scanned, confirm), scanned.map((_, i) => i % 3 !== 2));
+        });
+
+        it('Generate Key Images', async () => {
+            assert.deepStrictEqual(
+                await client.generateKeyImages(outputs, confirm), outputs.map(output => output.key_image));
+        });
+
+        it('Check Inputs', async () => {
+            const inputs: Input[] = [];
+
+            for (let i = 0; i < 4; i++) {
+                inputs.push(await createInput(TurtleCoinCrypto, Wallet, i));
+            }
+
+            /* the second input points at a ring member that is not ours and the third one out of its ring */
+            inputs[1] = { ...inputs[1], real_index: (inputs[1].real_index + 1) % inputs[1].ring.length };
+
+            inputs[2] = { ...inputs[2], real_index: inputs[2].ring.length };
+
+            const results = await client.checkInputs(inputs, confirm);
+
+            assert.deepStrictEqual(results.map(result => result.key_image),
+                [inputs[0].key_image, undefined, undefined, inputs[3].key_image]);
+
+            assert(results[1].status !== 0 && results[2].status !== 0);
+        });
+    });
+
     describe('Transaction Construction Tests', function () {
         let skipTests = false;
 
@@ -635,6 +786,26 @@ describe('Ledger Hardware Tests', function () {
                 assert(state === 6);
             });
 
+            it('Reload Outputs', async function () {
+                if (cancelTests) {
+                    return this.skip();
+                }
+
+                const client = await ApduClient.open(transport);
+
+                await client.reloadOutputs();
+
+                assert(await ledger.transactionState() === 3);
+
+                await ledger.startTransactionOutputLoad();
+
+                await ledger.loadTransactionOutput(5000, output_key);
+
+                await ledger.finalizeTransactionPrefix();
+
+                assert(await ledger.transactionState() === 6);
+            });
+
             it('Sign Transaction', async function () {
                 if (cancelTests) {
                     return this.skip();
@@ -899,4 +1070,150 @@ describe('Ledger Hardware Tests', function () {
                 await TurtleCoinCrypto.checkScalar(keys.privateKey));
         });
     });
+
+    /**
+     * These tests fail when a change makes the device do more work or move more data than
+     * it should. The APDU and byte budgets follow from the wire format of each request (with
+     * some headroom) and scale with the inputs and outputs of the transaction so that a change
+     * in the cost per input shows up no matter how small the transaction is. The timing
+     * ceilings are for Speculos and can be tightened or relaxed through the environment
+     * (BUDGET_RING_SIGNATURES_MS and BUDGET_TX_SIGN_MS_PER_INPUT) for slower hosts
+     */
+    describe('Performance Budgets', () => {
+        const inputCount = 2;
+
+        const outputCount = 2;
+
+        const ringSize = 4;
+
+        interface Usage {
+            ms: number;
+            apdus: number;
+            bytes: number;
+        }
+
+        async function measure (operation: () => Promise<any>): Promise<Usage> {
+            const apdus = transport.exchanges;
+
+            const bytes = transport.bytesSent + transport.bytesReceived;
+
+            const start = Date.now();
+
+            await operation();
+
+            return {
+                ms: Date.now() - start,
+                apdus: transport.exchanges - apdus,
+                bytes: transport.bytesSent + transport.bytesReceived - bytes
+            };
+        }
+
+        function within (operation: string, usage: Usage, apdus: number, bytes: number) {
+            assert(usage.apdus <= apdus,
+                operation + ' took ' + usage.apdus + ' APDUs, the budget is ' + apdus);
+
+            assert(usage.bytes <= bytes,
+                operation + ' moved ' + usage.bytes + ' bytes, the budget is ' + bytes);
+        }
+
+        it('Generate Ring Signatures', async () => {
+            const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+            const derivation = await TurtleCoinCrypto.generateKeyDerivation(tx_public_key, Wallet.view.privateKey);
+
+            const output_key = await TurtleCoinCrypto.derivePublicKey(derivation, 0, Wallet.spend.publicKey);
+
+            const public_keys = [output_key];
+
+            for (let i = 1; i < ringSize; i++) {
+                public_keys.push((await TurtleCoinCrypto.generateKeys()).public_key);
+            }
+
+            const tx_prefix_hash = await TurtleCoinCrypto.cn_fast_hash(ledgerIdent);
+
+            const ceiling = budget('BUDGET_RING_SIGNATURES_MS', 10000);
+
+            const usage = await measure(() => ledger.generateRingSignatures(
+                tx_public_key, 0, output_key, tx_prefix_hash, public_keys, 0, confirm));
+
+            assert(usage.ms <= ceiling,
+                'hw_generate_ring_signatures took ' + usage.ms + ' ms, the ceiling is ' + ceiling + ' ms');
+        });
+
+        it('Transaction Stages', async () => {
+            const inputs: any[] = [];
+
+            for (let i = 0; i < inputCount; i++) {
+                const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+                const derivation = await TurtleCoinCrypto.generateKeyDerivation(tx_public_key, Wallet.view.privateKey);
+
+                const ring = [await TurtleCoinCrypto.derivePublicKey(derivation, 0, Wallet.spend.publicKey)];
+
+                for (let j = 1; j < ringSize; j++) {
+                    ring.push((await TurtleCoinCrypto.generateKeys()).public_key);
+                }
+
+                inputs.push({ tx_public_key, ring });
+            }
+
+            const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+            const payment_id = (await TurtleCoinCrypto.generateKeys()).private_key;
+
+            const start = await measure(() =>
+                ledger.startTransaction(0, inputCount, outputCount, tx_public_key, payment_id));
+
+            within('tx_start', start, 1, 128);
+
+            try {
+                // every input is the transaction key, index, amount, ring, offsets and real index
+                const load_inputs = await measure(async () => {
+                    await ledger.startTransactionInputLoad();
+
+                    for (const input of inputs) {
+                        await ledger.loadTransactionInput(
+                            input.tx_public_key, 0, 10000, input.ring, [0, 1, 2, 3], 0);
+                    }
+                });
+
+                within('tx_load_input', load_inputs, 1 + inputCount, 16 + (inputCount * (64 + ringSize * 40)));
+
+                // every output is an amount and a key
+                const load_outputs = await measure(async () => {
+                    await ledger.startTransactionOutputLoad();
+
+                    for (let i = 0; i < outputCount; i++) {
+                        await ledger.loadTransactionOutput(
+                            5000, (await TurtleCoinCrypto.generateKeys()).public_key);
+                    }
+                });
+
+                within('tx_load_output', load_outputs, 1 + outputCount, 16 + (outputCount * 64));
+
+                const finalize = await measure(() => ledger.finalizeTransactionPrefix());
+
+                within('tx_finalize_prefix', finalize, 1, 16);
+
+                let size = 0;
+
+                const ceiling = budget('BUDGET_TX_SIGN_MS_PER_INPUT', 15000) * inputCount;
+
+                const sign = await measure(async () => {
+                    size = (await ledger.signTransaction(confirm)).size;
+                });
+
+                within('tx_sign', sign, 1, 128);
+
+                assert(sign.ms <= ceiling, 'tx_sign took ' + sign.ms + ' ms, the ceiling is ' + ceiling + ' ms');
+
+                // the transaction itself plus the status word and header of each chunk
+                const dump = await measure(() => ledger.retrieveTransaction());
+
+                within('tx_dump', dump, 1 + Math.ceil(size / 128), size + (16 * (1 + Math.ceil(size / 128))));
+            } finally {
+                await ledger.resetTransaction(confirm);
+            }
+        });
+    });
 });
@@ -0,0 +1,202 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { TraceExchange, confirms, readTrace } from './ApduTrace';
+import { SpeculosButtons } from './SpeculosButtons';
+import { TCPTransport } from './TCPTransport';
+import { writeFileSync } from 'fs';
+
+/**
+ * Sends a session recorded with APDU_TRACE (see TCPTransport) to a device or Speculos exactly as
+ * it was recorded and compares how long every APDU takes now with how long it took then, so that
+ * a session that shows a problem can be benchmarked the same way before and after a change.
+ *
+ * The trace is given by REPLAY_TRACE and the device by LEDGER_HOST. When CONFIRM is set the
+ * buttons of Speculos at SPECULOS_BUTTONS approve every APDU that asked for confirmation when it
+ * was recorded (see confirms) and no other. The APDUs go out back to back unless REPLAY_PACED is
+ * set, which waits out the time the host took between them when they were recorded.
+ *
+ * The device has to start out in the state that it was recorded from (the same seed, with no
+ * transaction under way) and a session only replays for as long as nothing that it sends back
+ * depends on the randomness of the device, such as inputs sealed for the host, unless it was
+ * recorded from a debug build that had its RNG seeded first (APDU_DEBUG, P1 = 0x03) by an APDU
+ * that is part of the trace, in which case every response repeats. The status words
+ * are compared as they come back and the data of the responses is counted as changed or not.
+ * The results are written as JSON to stdout or to the file named by BENCHMARK_OUTPUT
+ */
+
+/** @ignore */
+const confirm = !!(process.env.CONFIRM && process.env.CONFIRM.length !== 0);
+
+/** @ignore */
+const paced = !!(process.env.REPLAY_PACED && process.env.REPLAY_PACED.length !== 0);
+
+interface Command {
+    count: number;
+    recorded_ms: number;
+    replayed_ms: number;
+    ratio: number;
+}
+
+/** @ignore */
+function round (value: number): number {
+    return Math.round(value * 1000) / 1000;
+}
+
+/** @ignore */
+function hex (value: number, length: number): string {
+    return '0x' + value.toString(16).padStart(length, '0');
+}
+
+/** @ignore */
+async function sleep (ms: number): Promise<void> {
+    return new Promise(resolve => setTimeout(resolve, ms));
+}
+
+async function main () {
+    if (!process.env.REPLAY_TRACE) {
+        throw new Error('REPLAY_TRACE has to name the trace to replay');
+    }
+
+    const trace = readTrace(process.env.REPLAY_TRACE);
+
+    const transport = await TCPTransport.open(process.env.LEDGER_HOST || '127.0.0.1:9999');
+
+    const buttons = (confirm)
+        ? await SpeculosButtons.open(process.env.SPECULOS_BUTTONS || '127.0.0.1:42000')
+        : undefined;
+
+    const commands: { [ins: string]: Command } = {};
+
+    const mismatches: { index: number; ins: string; recorded: string; replayed: string }[] = [];
+
+    let changed = 0;
+
+    /* sends one recorded APDU and returns its response, status word included, along with how long it took */
+    const exchange = async (recorded: TraceExchange): Promise<{ response: Buffer; elapsed_ms: number }> => {
+        const apdu = Buffer.from(recorded.apdu, 'hex');
+
+        const start = process.hrtime.bigint();
+
+        const operation = transport.exchange(apdu)
+            .catch((error: any) => {
+                if (typeof error.statusCode !== 'number') {
+                    throw error;
+                }
+
+                const status = Buffer.alloc(2);
+
+                status.writeUInt16BE(error.statusCode, 0);
+
+                return status;
+            });
+
+        const response = (buttons && confirms(apdu)) ? await buttons.approve(operation) : await operation;
+
+        return { response, elapsed_ms: Number(process.hrtime.bigint() - start) / 1e6 };
+    };
+
+    const start = process.hrtime.bigint();
+
+    try {
+        for (let i = 0; i < trace.exchanges.length; i++) {
+            const recorded = trace.exchanges[i];
+
+            if (paced && i !== 0) {
+                const previous = trace.exchanges[i - 1];
+
+                const gap = recorded.sent_ms - (previous.sent_ms + previous.elapsed_ms);
+
+                if (gap > 0) {
+                    await sleep(gap);
+                }
+            }
+
+            const { response, elapsed_ms } = await exchange(recorded);
+
+            const expected = Buffer.from(recorded.response, 'hex');
+
+            const ins = hex(Buffer.from(recorded.apdu, 'hex')[1], 2);
+
+            const command = commands[ins] || { count: 0, recorded_ms: 0, replayed_ms: 0, ratio: 0 };
+
+            command.count++;
+
+            command.recorded_ms += recorded.elapsed_ms;
+
+            command.replayed_ms += elapsed_ms;
+
+            commands[ins] = command;
+
+            const recordedStatus = expected.readUInt16BE(expected.length - 2);
+
+            const replayedStatus = response.readUInt16BE(response.length - 2);
+
+            if (recordedStatus !== replayedStatus) {
+                mismatches.push({ index: i, ins, recorded: hex(recordedStatus, 4), replayed: hex(replayedStatus, 4) });
+            } else if (!response.equals(expected)) {
+                changed++;
+            }
+        }
+    } finally {
+        if (buttons) {
+            await buttons.close();
+        }
+
+        await transport.close();
+    }
+
+    const wall_ms = Number(process.hrtime.bigint() - start) / 1e6;
+
+    let recorded_ms = 0;
+
+    let replayed_ms = 0;
+
+    for (const ins of Object.keys(commands)) {
+        const command = commands[ins];
+
+        recorded_ms += command.recorded_ms;
+
+        replayed_ms += command.replayed_ms;
+
+        command.recorded_ms = round(command.recorded_ms);
+
+        command.replayed_ms = round(command.replayed_ms);
+
+        command.ratio = round(command.replayed_ms / command.recorded_ms);
+    }
+
+    const report = JSON.stringify({
+        label: process.env.BENCHMARK_LABEL || '',
+        trace: process.env.REPLAY_TRACE,
+        recorded_from: trace.header.host,
+        recorded: trace.header.recorded,
+        confirm,
+        paced,
+        exchanges: trace.exchanges.length,
+        wall_ms: round(wall_ms),
+        recorded_ms: round(recorded_ms),
+        replayed_ms: round(replayed_ms),
+        ratio: round(replayed_ms / recorded_ms),
+        status_mismatches: mismatches,
+        changed_responses: changed,
+        commands
+    }, undefined, 4);
+
+    if (process.env.BENCHMARK_OUTPUT) {
+        writeFileSync(process.env.BENCHMARK_OUTPUT, report);
+    } else {
+        console.log(report);
+    }
+
+    if (mismatches.length !== 0) {
+        process.exitCode = 1;
+    }
+}
+
+main().catch(error => {
+    console.error(error);
+
+    process.exit(1);
+});
@@ -0,0 +1,247 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Address, Crypto, LedgerDevice } from 'turtlecoin-utils';
+import { SpeculosButtons } from './SpeculosButtons';
+import { TCPTransport } from './TCPTransport';
+import { Input, createInput, ringSize, walletSeed } from './Workload';
+import { writeFileSync } from 'fs';
+
+/** @ignore */
+const confirm = !!(process.env.CONFIRM && process.env.CONFIRM.length !== 0);
+
+/** @ignore */
+function grid (value: string | undefined, fallback: number[]): number[] {
+    if (!value) {
+        return fallback;
+    }
+
+    return value.split(',').map(count => parseInt(count, 10));
+}
+
+/**
+ * The input and output counts that TX_POOL_SIZE of src/transaction.h is sized to hold at once
+ */
+const maxInputs = 90;
+
+const maxOutputs = 90;
+
+/** @ignore */
+const inputCounts = grid(process.env.SWEEP_INPUTS, [1, 4, 16, maxInputs]);
+
+/** @ignore */
+const outputCounts = grid(process.env.SWEEP_OUTPUTS, [1, 4, 16, maxOutputs]);
+
+/**
+ * APDU_NVRAM_STATS of src/apdu.h
+ */
+const nvramStats = 0x06;
+
+/**
+ * Builds a synthetic transaction on the device for every (inputs, outputs) pair of the grid
+ * given by SWEEP_INPUTS and SWEEP_OUTPUTS and records, for every stage of the flow from
+ * tx_start to tx_dump, the time taken and the number of APDUs and bytes exchanged. Every
+ * transaction is checked against the TurtleCoin Crypto library before its numbers count:
+ * the key images, the ring signatures, the hash and the size must all match. The results
+ * along with the NVRAM writes that the transaction cost (see APDU_NVRAM_STATS)
+ * are written as JSON to stdout or to the file named by BENCHMARK_OUTPUT
+ */
+
+interface Stage {
+    ms: number;
+    apdus: number;
+    bytes_sent: number;
+    bytes_received: number;
+}
+
+interface NvramStats {
+    writes: number;
+    bytes: number;
+    pages: number;
+}
+
+async function main () {
+    const transport = await TCPTransport.open(process.env.LEDGER_HOST || '127.0.0.1:9999');
+
+    const buttons = confirm
+        ? await SpeculosButtons.open(process.env.SPECULOS_BUTTONS || '127.0.0.1:42000')
+        : undefined;
+
+    const ledger = new LedgerDevice(transport);
+
+    const TurtleCoinCrypto = new Crypto();
+
+    const Wallet = await Address.fromSeed(walletSeed);
+
+    /* the NVRAM writes since the last tx_start, which is where the wear of a transaction comes from */
+    const transactionWrites = async (): Promise<NvramStats> => {
+        const response = await transport.send(0xe0, nvramStats, 0, 0);
+
+        return {
+            writes: response.readUInt32BE(0),
+            bytes: response.readUInt32BE(4),
+            pages: response.readUInt32BE(8)
+        };
+    };
+
+    const approve = async <T>(operation: Promise<T>): Promise<T> => {
+        return (buttons) ? buttons.approve(operation) : operation;
+    };
+
+    const run = async (inputCount: number, outputCount: number) => {
+        const inputs: Input[] = [];
+
+        for (let i = 0; i < inputCount; i++) {
+            inputs.push(await createInput(TurtleCoinCrypto, Wallet, i));
+        }
+
+        const outputs: string[] = [];
+
+        for (let i = 0; i < outputCount; i++) {
+            outputs.push((await TurtleCoinCrypto.generateKeys()).public_key);
+        }
+
+        /* the fee is whatever is left over after splitting the inputs evenly */
+        const outputAmount = Math.floor((inputCount * 1000000 - 10) / outputCount);
+
+        const stages: {[name: string]: Stage} = {};
+
+        const stage = async <T>(name: string, operation: () => Promise<T>): Promise<T> => {
+            const before = [transport.exchanges, transport.bytesSent, transport.bytesReceived];
+
+            const start = process.hrtime.bigint();
+
+            const result = await operation();
+
+            stages[name] = {
+                ms: Math.round(Number(process.hrtime.bigint() - start) / 1e3) / 1e3,
+                apdus: transport.exchanges - before[0],
+                bytes_sent: transport.bytesSent - before[1],
+                bytes_received: transport.bytesReceived - before[2]
+            };
+
+            return result;
+        };
+
+        const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+        const payment_id = (await TurtleCoinCrypto.generateKeys()).private_key;
+
+        await stage('tx_start', () =>
+            ledger.startTransaction(0, inputCount, outputCount, tx_public_key, payment_id));
+
+        await stage('tx_load_input', async () => {
+            await ledger.startTransactionInputLoad();
+
+            for (const input of inputs) {
+                await ledger.loadTransactionInput(
+                    input.tx_public_key, input.output_index, input.amount, input.ring, input.offsets, input.real_index);
+            }
+        });
+
+        await stage('tx_load_output', async () => {
+            await ledger.startTransactionOutputLoad();
+
+            for (const output of outputs) {
+                await ledger.loadTransactionOutput(outputAmount, output);
+            }
+        });
+
+        await stage('tx_finalize_prefix', () => ledger.finalizeTransactionPrefix());
+
+        const signed = await stage('tx_sign', () => approve(ledger.signTransaction(confirm)));
+
+        const transaction = await stage('tx_dump', () => ledger.retrieveTransaction());
+
+        await stage('tx_reset', () => approve(ledger.resetTransaction(confirm)));
+
+        const nvram = await transactionWrites();
+
+        /* the numbers only count for a transaction that the host library agrees with */
+        if (transaction.size !== signed.size || await transaction.hash() !== signed.hash) {
+            throw new Error('The transaction does not match its hash or size');
+        }
+
+        const prefix_hash: string = await (transaction as any).prefixHash;
+
+        for (let i = 0; i < inputs.length; i++) {
+            const key_image: string = (transaction.inputs[i] as any).keyImage;
+
+            if (key_image !== inputs[i].key_image) {
+                throw new Error('The key image of input ' + i + ' does not match');
+            }
+
+            if (!await TurtleCoinCrypto.checkRingSignatures(
+                prefix_hash, key_image, inputs[i].ring, transaction.signatures[i])) {
+                throw new Error('The ring signatures of input ' + i + ' do not verify');
+            }
+        }
+
+        const total = Object.keys(stages).reduce((sum, name) => {
+            return {
+                ms: Math.round((sum.ms + stages[name].ms) * 1e3) / 1e3,
+                apdus: sum.apdus + stages[name].apdus,
+                bytes_sent: sum.bytes_sent + stages[name].bytes_sent,
+                bytes_received: sum.bytes_received + stages[name].bytes_received
+            };
+        }, { ms: 0, apdus: 0, bytes_sent: 0, bytes_received: 0 });
+
+        return {
+            inputs: inputCount,
+            outputs: outputCount,
+            ring_size: ringSize,
+            size: signed.size,
+            stages,
+            total,
+            nvram
+        };
+    };
+
+    const results = [];
+
+    try {
+        if (await ledger.transactionState() !== 0) {
+            await approve(ledger.resetTransaction(confirm));
+        }
+
+        for (const inputCount of inputCounts) {
+            for (const outputCount of outputCounts) {
+                if (inputCount > maxInputs || outputCount > maxOutputs) {
+                    continue;
+                }
+
+                const result = await run(inputCount, outputCount);
+
+                console.error('%d x %d: %d ms over %d APDUs, %d NVRAM writes', inputCount, outputCount,
+                    result.total.ms, result.total.apdus, result.nvram.writes);
+
+                results.push(result);
+            }
+        }
+    } finally {
+        if (buttons) {
+            await buttons.close();
+        }
+
+        await transport.close();
+    }
+
+    const report = JSON.stringify({
+        label: process.env.BENCHMARK_LABEL || '',
+        confirm,
+        results
+    }, undefined, 4);
+
+    if (process.env.BENCHMARK_OUTPUT) {
+        writeFileSync(process.env.BENCHMARK_OUTPUT, report);
+    } else {
+        console.log(report);
+    }
+}
+
+main().catch(error => {
+    console.error(error);
+
+    process.exit(1);
+});
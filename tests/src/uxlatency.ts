@@ -0,0 +1,323 @@
+// Copyright (c) 2018-2020, The TurtleCoin Developers
+//
+// Please see the included LICENSE file for more information.
+
+import { Address, Crypto, LedgerDevice } from 'turtlecoin-utils';
+import { SpeculosButtons } from './SpeculosButtons';
+import { SpeculosEvents } from './SpeculosEvents';
+import { TCPTransport } from './TCPTransport';
+import { walletSeed } from './Workload';
+import { writeFileSync } from 'fs';
+
+/** @ignore */
+const iterations = parseInt(process.env.BENCHMARK_ITERATIONS || '10', 10);
+
+/** @ignore */
+const only = (process.env.BENCHMARK_ONLY || '').split(',').filter(name => name.length !== 0);
+
+/** @ignore */
+const quiet = parseInt(process.env.UX_QUIET || '100', 10);
+
+/**
+ * Splits the latency of every command of the application between the screens and the work
+ * behind them, using the automation port of Speculos (43000 in docker_test.sh) to learn when
+ * something is drawn and the button port (42000) to walk the confirm flows by hand.
+ *
+ * Every command is run as a splash-only flow (P1 = 0x00, which only shows a busy screen on a
+ * debug build) and, if it has a review, as a confirm flow (P1 = 0x01) in which the right button
+ * is pressed whenever the screen settles until Approve is shown. Per command and flow it reports:
+ *
+ *   first_screen: from sending the APDU to the first screen event
+ *   screen_to_response: from the first screen event to the response
+ *   press_to_response: from pressing Approve to the response (confirm flows only)
+ *   response: from sending the APDU to the response
+ *
+ * A splash-only flow whose first_screen is a large share of its response is paying for the
+ * splash rather than the crypto, which is what the silent fast path is for. The screen is left
+ * to settle for UX_QUIET milliseconds between requests so that the idle screen drawn after a
+ * response is never taken for the next one. The results are written as JSON to stdout or to
+ * the file named by BENCHMARK_OUTPUT
+ */
+
+interface Command {
+    name: string;
+    confirms: boolean; // whether the command has a confirm flow
+    setup?: () => Promise<void>;
+    run: (iteration: number, confirm: boolean) => Promise<any>;
+}
+
+interface Result {
+    iterations: number;
+    mean: number; // milliseconds
+    p50: number;
+    p95: number;
+    min: number;
+    max: number;
+}
+
+interface Flow {
+    first_screen?: Result;
+    screen_to_response?: Result;
+    press_to_response?: Result;
+    response?: Result;
+    screen_events: number; // the mean number of screen events before the response
+    error?: string;
+}
+
+/** @ignore */
+function round (value: number): number {
+    return Math.round(value * 1000) / 1000;
+}
+
+function summarize (samples: number[]): Result | undefined {
+    if (samples.length === 0) {
+        return undefined;
+    }
+
+    const sorted = samples.slice().sort((a, b) => a - b);
+
+    const total = samples.reduce((sum, sample) => sum + sample, 0);
+
+    const percentile = (p: number) => {
+        return sorted[Math.min(sorted.length, Math.max(1, Math.ceil((p / 100) * sorted.length))) - 1];
+    };
+
+    return {
+        iterations: samples.length,
+        mean: round(total / samples.length),
+        p50: round(percentile(50)),
+        p95: round(percentile(95)),
+        min: round(sorted[0]),
+        max: round(sorted[sorted.length - 1])
+    };
+}
+
+/** @ignore */
+function elapsed (from: bigint, to: bigint): number {
+    return Number(to - from) / 1e6;
+}
+
+async function main () {
+    const transport = await TCPTransport.open(process.env.LEDGER_HOST || '127.0.0.1:9999');
+
+    const buttons = await SpeculosButtons.open(process.env.SPECULOS_BUTTONS || '127.0.0.1:42000');
+
+    const events = await SpeculosEvents.open(process.env.SPECULOS_AUTOMATION || '127.0.0.1:43000');
+
+    const ledger = new LedgerDevice(transport);
+
+    const TurtleCoinCrypto = new Crypto();
+
+    const Wallet = await Address.fromSeed(walletSeed);
+
+    const message_digest = await TurtleCoinCrypto.cn_fast_hash(walletSeed);
+
+    const output_index = 2;
+
+    /* both flows of a command get outputs of their own as the device caches key images */
+    const outputs: { tx_public_key: string, derivation: string, public_key: string }[] = [];
+
+    const prepareOutputs = async () => {
+        for (let i = outputs.length; i < iterations * 2; i++) {
+            const tx_public_key = (await TurtleCoinCrypto.generateKeys()).public_key;
+
+            const derivation = await TurtleCoinCrypto.generateKeyDerivation(tx_public_key, Wallet.view.privateKey);
+
+            const public_key = await TurtleCoinCrypto.derivePublicKey(derivation, output_index, Wallet.spend.publicKey);
+
+            outputs.push({ tx_public_key, derivation, public_key });
+        }
+    };
+
+    const commands: Command[] = [
+        {
+            name: 'random_key_pair',
+            confirms: false,
+            run: () => ledger.getRandomKeyPair()
+        },
+        {
+            name: 'check_key',
+            confirms: false,
+            run: () => ledger.checkKey(Wallet.spend.publicKey)
+        },
+        {
+            name: 'public_keys',
+            confirms: true,
+            run: (_, confirm) => ledger.getPublicKeys(confirm)
+        },
+        {
+            name: 'address',
+            confirms: true,
+            run: (_, confirm) => ledger.getAddress(confirm)
+        },
+        {
+            name: 'generate_signature',
+            confirms: true,
+            run: (_, confirm) => ledger.generateSignature(message_digest, confirm)
+        },
+        {
+            name: 'generate_key_derivation',
+            confirms: true,
+            setup: prepareOutputs,
+            run: (i, confirm) => ledger.generateKeyDerivation(outputs[i].tx_public_key, confirm)
+        },
+        {
+            name: 'derive_public_key',
+            confirms: true,
+            setup: prepareOutputs,
+            run: (i, confirm) => ledger.derivePublicKey(outputs[i].derivation, output_index, confirm)
+        },
+        {
+            name: 'generate_key_image',
+            confirms: true,
+            setup: prepareOutputs,
+            run: (i, confirm) => ledger.generateKeyImage(
+                outputs[i].tx_public_key, output_index, outputs[i].public_key, confirm)
+        }
+    ];
+
+    /* sends the request and walks its screens until the response, as long as a confirm flow needs */
+    const measure = async (command: Command, iteration: number, confirm: boolean) => {
+        await events.settle(quiet);
+
+        const start = events.count;
+
+        let index = start;
+
+        let pressed: bigint | undefined;
+
+        const response: { time?: bigint } = {};
+
+        const sent = process.hrtime.bigint();
+
+        const operation = command.run(iteration, confirm).then(() => {
+            response.time = process.hrtime.bigint();
+
+            return undefined;
+        });
+
+        while (response.time === undefined) {
+            const event = await Promise.race([events.wait(index, quiet), operation]);
+
+            if (response.time !== undefined) {
+                break;
+            }
+
+            if (event) {
+                index++;
+
+                if (confirm && pressed === undefined && event.text === 'Approve') {
+                    pressed = process.hrtime.bigint();
+
+                    buttons.press('LRlr');
+                }
+            } else if (confirm && pressed === undefined && index !== start) {
+                /* the screen has settled on something that is not the approval yet */
+                buttons.press('Rr');
+            }
+        }
+
+        const responded = response.time;
+
+        const first = (index !== start) ? await events.wait(start, 0) : undefined;
+
+        return {
+            first_screen: (first) ? elapsed(sent, first.time) : undefined,
+            screen_to_response: (first) ? elapsed(first.time, responded) : undefined,
+            press_to_response: (pressed !== undefined) ? elapsed(pressed, responded) : undefined,
+            response: elapsed(sent, responded),
+            screen_events: index - start
+        };
+    };
+
+    const results: {[name: string]: {[flow: string]: Flow}} = {};
+
+    const version = await ledger.getVersion();
+
+    try {
+        for (const command of commands) {
+            if (only.length !== 0 && only.indexOf(command.name) === -1) {
+                continue;
+            }
+
+            if (command.setup) {
+                await command.setup();
+            }
+
+            results[command.name] = {};
+
+            for (const confirm of (command.confirms) ? [false, true] : [false]) {
+                const flow = (confirm) ? 'confirm' : 'splash';
+
+                const samples: {[measurement: string]: number[]} = {
+                    first_screen: [],
+                    screen_to_response: [],
+                    press_to_response: [],
+                    response: []
+                };
+
+                let screen_events = 0;
+
+                try {
+                    for (let i = 0; i < iterations; i++) {
+                        const timing: {[measurement: string]: number | undefined} =
+                            await measure(command, i + ((confirm) ? iterations : 0), confirm);
+
+                        for (const measurement of Object.keys(samples)) {
+                            const value = timing[measurement];
+
+                            if (value !== undefined) {
+                                samples[measurement].push(value);
+                            }
+                        }
+
+                        screen_events += timing.screen_events || 0;
+                    }
+
+                    results[command.name][flow] = {
+                        first_screen: summarize(samples.first_screen),
+                        screen_to_response: summarize(samples.screen_to_response),
+                        press_to_response: summarize(samples.press_to_response),
+                        response: summarize(samples.response),
+                        screen_events: round(screen_events / iterations)
+                    };
+
+                    console.error('%s (%s): first screen p50 %d ms, response p50 %d ms', command.name, flow,
+                        (results[command.name][flow].first_screen || { p50: NaN }).p50,
+                        (results[command.name][flow].response || { p50: NaN }).p50);
+                } catch (error) {
+                    /* a release build refuses the splash-only flows of the commands that it reviews */
+                    results[command.name][flow] = { screen_events: 0, error: error.toString() };
+
+                    console.error('%s (%s): %s', command.name, flow, error.toString());
+                }
+            }
+        }
+    } finally {
+        await events.close();
+
+        await buttons.close();
+
+        await transport.close();
+    }
+
+    const report = JSON.stringify({
+        label: process.env.BENCHMARK_LABEL || '',
+        version,
+        iterations,
+        quiet_ms: quiet,
+        results
+    }, undefined, 4);
+
+    if (process.env.BENCHMARK_OUTPUT) {
+        writeFileSync(process.env.BENCHMARK_OUTPUT, report);
+    } else {
+        console.log(report);
+    }
+}
+
+main().catch(error => {
+    console.error(error);
+
+    process.exit(1);
+});